@@ -133,6 +133,14 @@ void Context::setBenchmarkCuDNN(bool b) {
   benchmark_cudnn = b;
 }
 
+bool Context::benchmarkCPU() const {
+  return benchmark_cpu;
+}
+
+void Context::setBenchmarkCPU(bool b) {
+  benchmark_cpu = b;
+}
+
 bool Context::allowTF32CuBLAS() const {
   return allow_tf32_cublas;
 }
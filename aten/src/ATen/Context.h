@@ -113,6 +113,11 @@ class TORCH_API Context {
   void setUserEnabledMkldnn(bool e);
   bool benchmarkCuDNN() const;
   void setBenchmarkCuDNN(bool);
+  // CPU analogue of benchmarkCuDNN(): when enabled, CPU convolutions time
+  // every eligible backend for a new input signature once and cache the
+  // winner for subsequent calls.
+  bool benchmarkCPU() const;
+  void setBenchmarkCPU(bool);
   bool deterministicCuDNN() const;
   void setDeterministicCuDNN(bool);
 
@@ -229,6 +234,7 @@ class TORCH_API Context {
   bool deterministic_cudnn = false;
   bool _deterministic_algorithms = false;
   bool benchmark_cudnn = false;
+  bool benchmark_cpu = false;
   bool allow_tf32_cudnn = true;
   bool allow_tf32_cublas = true;
   bool enabled_mkldnn = true;
@@ -9,11 +9,13 @@ class TORCH_API PTThreadPool : public c10::ThreadPool {
 public:
   explicit PTThreadPool(
       int pool_size,
-      int numa_node_id = -1)
-    : c10::ThreadPool(pool_size, numa_node_id, [](){
+      int numa_node_id = -1,
+      bool spawn_lazily = false)
+    : c10::ThreadPool(pool_size, numa_node_id, [numa_node_id](){
         c10::setThreadName("PTThreadPool");
+        c10::NUMABind(numa_node_id);
         at::init_num_threads();
-      }) {}
+      }, spawn_lazily) {}
 };
 
 } // namespace at
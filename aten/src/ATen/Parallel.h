@@ -3,6 +3,9 @@
 #include <ATen/core/ivalue.h>
 #include <c10/macros/Macros.h>
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace at {
 
 inline int64_t divup(int64_t x, int64_t y) {
@@ -12,7 +15,11 @@ inline int64_t divup(int64_t x, int64_t y) {
 // Called during new thread initialization
 TORCH_API void init_num_threads();
 
-// Sets the number of threads to be used in parallel region
+// Sets the number of threads to be used in parallel region.
+// With the native parallel backend this also works after parallel work has
+// started: the intra-op pool's thread budget is adjusted in place (shrinking
+// lets excess workers exit after their current task; growth is capped by the
+// pool's original size).
 TORCH_API void set_num_threads(int);
 
 // Returns the maximum number of threads that may be used in a parallel region
@@ -36,6 +43,30 @@ inline TORCH_API void lazy_init_num_threads() {
   }
 }
 
+// The grain size a kernel passes to parallel_for/parallel_reduce is a
+// per-kernel cost hint: cheap elementwise ops pass at::internal::GRAIN_SIZE,
+// more expensive kernels pass a fraction of it.  The right absolute
+// threshold additionally depends on the machine (core count, frequency,
+// thread wake-up latency), so the hints can be rescaled globally with
+// ATEN_GRAIN_SIZE_SCALE, a percentage: 200 doubles every grain size (fork
+// less eagerly), 50 halves it (fork more eagerly).  Calibrate once per
+// machine with a sweep over representative ops and pin the result in the
+// environment.
+inline int64_t scale_grain_size(int64_t grain_size) {
+  static const int64_t scale_pct = []() -> int64_t {
+    const char* env = std::getenv("ATEN_GRAIN_SIZE_SCALE");
+    if (env == nullptr) {
+      return 100;
+    }
+    const auto val = strtoll(env, nullptr, 10);
+    return val > 0 ? val : 100;
+  }();
+  if (C10_LIKELY(scale_pct == 100) || grain_size <= 0) {
+    return grain_size;
+  }
+  return std::max<int64_t>(1, grain_size * scale_pct / 100);
+}
+
 }
 
 /*
@@ -45,7 +76,9 @@ begin: index at which to start applying user function
 
 end: index at which to stop applying user function
 
-grain_size: number of elements per chunk. impacts the degree of parallelization
+grain_size: number of elements per chunk. impacts the degree of parallelization;
+  treated as a per-kernel cost hint that may be rescaled globally via
+  ATEN_GRAIN_SIZE_SCALE (see internal::scale_grain_size)
 
 f: user function applied in parallel to the chunks, signature:
   void f(int64_t begin, int64_t end)
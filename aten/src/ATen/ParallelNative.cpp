@@ -9,7 +9,13 @@
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #endif // C10_MOBILE
 
+#include <c10/util/numa.h>
+
+#include <algorithm>
 #include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -69,23 +75,123 @@ int _num_pool_threads(int nthreads) {
 }
 
 TaskThreadPoolBase& _get_intraop_pool() {
+  // A separate, lazily spawning thread pool for intra-op: worker slots are
+  // reserved up to the configured size, but threads are only started when
+  // parallel_for submits work nobody idle can pick up, so lightly-parallel
+  // processes keep their footprint (see Note [Lazy worker spawning] in
+  // c10/core/thread_pool.cpp).
   static std::shared_ptr<TaskThreadPoolBase> pool =
-      ThreadPoolRegistry()->Create(
-          "C10",
-          /* device_id */ 0,
+      std::make_shared<PTThreadPool>(
           /* pool_size */ _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
-          /* create_new */ true); // create a separate thread pool for intra-op
+          /* numa_node_id */ -1,
+          /* spawn_lazily */ true);
   return *pool;
 }
 
+// Note [NUMA-aware intra-op pools]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// By default there is one flat intra-op pool with unpinned workers, so on
+// multi-socket machines a parallel region's tasks land on arbitrary nodes
+// and pull the caller's data across the interconnect.  When
+// ATEN_INTRAOP_BIND_NUMA=1 is set (and NUMA support is compiled in and the
+// machine actually has more than one node), the thread budget is split into
+// one sub-pool per NUMA node with the workers bound to their node, and each
+// parallel region runs on the sub-pool of the node the *calling* thread is
+// currently on.  Under the usual first-touch allocation policy the caller's
+// node is where freshly produced operands live, so this keeps both the
+// workers and the data of a region on one socket.
+bool _numa_subpools_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("ATEN_INTRAOP_BIND_NUMA");
+    return env != nullptr && env[0] == '1' &&
+        c10::IsNUMAEnabled() && c10::GetNumNUMANodes() > 1;
+  }();
+  return enabled;
+}
+
+std::vector<std::shared_ptr<TaskThreadPoolBase>>& _get_numa_subpools() {
+  static std::vector<std::shared_ptr<TaskThreadPoolBase>> pools = []() {
+    const int num_nodes = c10::GetNumNUMANodes();
+    const int nthreads =
+        _num_pool_threads(num_intraop_threads.exchange(CONSUMED));
+    std::vector<std::shared_ptr<TaskThreadPoolBase>> result;
+    result.reserve(num_nodes);
+    for (int node = 0; node < num_nodes; ++node) {
+      // Every node gets at least one worker so that no sub-pool is ever
+      // empty, even when the thread budget is smaller than the node count.
+      const int node_threads = std::max(
+          1, nthreads / num_nodes + (node < nthreads % num_nodes ? 1 : 0));
+      result.push_back(std::make_shared<PTThreadPool>(
+          node_threads, node, /* spawn_lazily */ true));
+    }
+    return result;
+  }();
+  return pools;
+}
+
+TaskThreadPoolBase& _get_pool_for_current_numa_node() {
+  if (!_numa_subpools_enabled()) {
+    return _get_intraop_pool();
+  }
+  auto& pools = _get_numa_subpools();
+  int node = c10::GetCurrentNUMANode();
+  if (node < 0 || node >= static_cast<int>(pools.size())) {
+    node = 0;
+  }
+  return *pools[node];
+}
+
+bool _in_intraop_pool() {
+  if (_numa_subpools_enabled()) {
+    for (auto& pool : _get_numa_subpools()) {
+      if (pool->inThreadPool()) {
+        return true;
+      }
+    }
+    return false;
+  }
+  return _get_intraop_pool().inThreadPool();
+}
+
+size_t _intraop_pool_size() {
+  if (_numa_subpools_enabled()) {
+    size_t size = 0;
+    for (auto& pool : _get_numa_subpools()) {
+      size += pool->size();
+    }
+    return size;
+  }
+  return _get_intraop_pool().size();
+}
+
+// Moves the thread budget of the (already initialized) intra-op pool to
+// `nthreads` workers. Growth stays demand-driven and is capped by the slot
+// capacity the pool was created with; shrinking takes effect as workers
+// finish their current task.
+bool _resize_intraop_pool(int nthreads) {
+  if (_numa_subpools_enabled()) {
+    auto& pools = _get_numa_subpools();
+    const int num_nodes = pools.size();
+    bool resized = true;
+    for (int node = 0; node < num_nodes; ++node) {
+      const int node_threads = std::max(
+          1, nthreads / num_nodes + (node < nthreads % num_nodes ? 1 : 0));
+      resized = pools[node]->setNumThreads(node_threads) && resized;
+    }
+    return resized;
+  }
+  return _get_intraop_pool().setNumThreads(nthreads);
+}
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
 // `fn` will be called with params: (thread_pool_task_id, task_id).
 void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 #ifndef C10_MOBILE
+  auto& pool = _get_pool_for_current_numa_node();
   for (size_t i = 1; i < range; ++i) {
-    _get_intraop_pool().run([fn, i]() { fn((int)i, i); });
+    pool.run([fn, i]() { fn((int)i, i); });
   }
   // Run the first task on the current thread directly.
   fn(0, 0);
@@ -197,15 +303,17 @@ void set_num_threads(int nthreads) {
   TORCH_CHECK(nthreads > 0, "Expected positive number of threads");
   int no_value = NOT_SET;
   if (!num_intraop_threads.compare_exchange_strong(no_value, nthreads)) {
-    // num_intraop_threads either stores a positive integer or CONSUMED,
-    // check that requested size is the same as the current one
     int stored_nthreads = num_intraop_threads.load();
-    if (stored_nthreads <= 0) {
-      // plus one because of master thread
-      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
-      stored_nthreads = _get_intraop_pool().size() + 1;
+    if (stored_nthreads > 0) {
+      // Pool not initialized yet: just replace the pending value.
+      num_intraop_threads.compare_exchange_strong(stored_nthreads, nthreads);
+      return;
     }
-    if (stored_nthreads != nthreads) {
+    // Pool is initialized: adjust its thread budget in place. Shrinking lets
+    // excess workers exit after their current task; growth stays lazy and is
+    // capped by the slot capacity the pool was created with.
+    // minus one because of the master thread
+    if (!_resize_intraop_pool(nthreads - 1)) {
       TORCH_WARN(
         "Cannot set number of intraop threads "
         "after parallel work has started or after set_num_threads call "
@@ -231,7 +339,7 @@ int get_num_threads() {
   } else {
     TORCH_INTERNAL_ASSERT(nthreads == CONSUMED);
     // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
-    return _get_intraop_pool().size() + 1;
+    return _intraop_pool_size() + 1;
   }
 #else
   caffe2::PThreadPool* const pool = caffe2::pthreadpool();
@@ -249,7 +357,7 @@ bool in_parallel_region() {
   return in_parallel_region_ || (
     num_intraop_threads.load() == CONSUMED &&
     // Needed as intraop_launch() doesn't set in_parallel_region().
-    _get_intraop_pool().inThreadPool()
+    _in_intraop_pool()
   );
 #else
   return in_parallel_region_;
@@ -259,7 +367,7 @@ bool in_parallel_region() {
 void intraop_launch(std::function<void()> func) {
 #ifndef C10_MOBILE
   if (!in_parallel_region() && get_num_threads() > 1) {
-    _get_intraop_pool().run(func);
+    _get_pool_for_current_numa_node().run(func);
   } else {
     // execute inline if we're in parallel region
     func();
@@ -276,7 +384,7 @@ std::shared_ptr<c10::ivalue::Future> intraop_launch_future(
 #ifndef C10_MOBILE
   auto future = std::make_shared<c10::ivalue::Future>(c10::NoneType::get());
   if (!in_parallel_region() && get_num_threads() > 1) {
-    _get_intraop_pool().run(
+    _get_pool_for_current_numa_node().run(
       [func, future]() {
         func();
         future->markCompleted();
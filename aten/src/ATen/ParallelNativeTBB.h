@@ -19,9 +19,11 @@ template <class F>
 inline void parallel_for(
     const int64_t begin,
     const int64_t end,
-    const int64_t grain_size,
+    const int64_t grain_size_hint,
     const F& f) {
-  TORCH_CHECK(grain_size >= 0);
+  TORCH_CHECK(grain_size_hint >= 0);
+  // Apply the machine-wide calibration; see scale_grain_size in Parallel.h.
+  const int64_t grain_size = internal::scale_grain_size(grain_size_hint);
   at::internal::lazy_init_num_threads();
   if (begin >= end) {
     return;
@@ -57,11 +59,13 @@ template <class scalar_t, class F, class SF>
 inline scalar_t parallel_reduce(
     const int64_t begin,
     const int64_t end,
-    const int64_t grain_size,
+    const int64_t grain_size_hint,
     const scalar_t ident,
     const F& f,
     const SF& sf) {
-  TORCH_CHECK(grain_size >= 0);
+  TORCH_CHECK(grain_size_hint >= 0);
+  // Apply the machine-wide calibration; see scale_grain_size in Parallel.h.
+  const int64_t grain_size = internal::scale_grain_size(grain_size_hint);
   at::internal::lazy_init_num_threads();
   if (begin >= end) {
     return ident;
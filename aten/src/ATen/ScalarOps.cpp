@@ -10,6 +10,8 @@
 #include <ATen/ATen.h>
 #include <ATen/Utils.h>
 
+#include <array>
+
 namespace at {
 namespace {
 template <typename scalar_t>
@@ -18,6 +20,46 @@ inline void fill_inplace(Tensor& self, const Scalar& value_scalar) {
   scalar_t* dptr = static_cast<scalar_t*>(self.data_ptr());
   *dptr = value;
 }
+
+// Note [Recycling wrapped scalar tensors]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every Tensor-Scalar op wraps the scalar in a fresh 0-dim CPU tensor, and
+// in scripting-heavy code that is an allocation (TensorImpl + StorageImpl +
+// data) per op.  The wrapped tensor almost always dies before the next one
+// is created, so each thread keeps one slot per common wrap dtype and
+// refills it in place instead of reallocating.  Reuse is only legal when
+// the previous consumer has let go of the tensor; the slot holding the sole
+// strong reference (and no weak ones) proves that, and anything still
+// referenced -- e.g. saved for backward -- is simply left to the slot's
+// replacement logic.  The values are never shared between two live wrapped
+// tensors, so there is no interning of "popular" constants here: a wrapped
+// scalar is mutable like any tensor, and handing the same instance to two
+// callers would let one corrupt the other.
+int wrapped_scalar_slot_index(ScalarType t) {
+  switch (t) {
+    case ScalarType::Double:
+      return 0;
+    case ScalarType::Long:
+      return 1;
+    case ScalarType::Bool:
+      return 2;
+    case ScalarType::ComplexDouble:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+constexpr int kNumWrappedScalarSlots = 4;
+
+Tensor* wrapped_scalar_slot(ScalarType t) {
+  const int index = wrapped_scalar_slot_index(t);
+  if (index < 0) {
+    return nullptr;
+  }
+  static thread_local std::array<Tensor, kNumWrappedScalarSlots> slots;
+  return &slots[index];
+}
 }
 
 namespace detail {
@@ -32,8 +74,26 @@ Tensor& scalar_fill(Tensor& self, const Scalar& value) {
 Tensor scalar_tensor_static(const Scalar& s, c10::optional<ScalarType> dtype_opt, c10::optional<Device> device_opt) {
   at::tracer::impl::NoTracerDispatchMode tracer_guard;
   at::AutoDispatchBelowAutograd mode;
+  // See Note [Recycling wrapped scalar tensors].
+  Tensor* slot = dtype_opt.has_value()
+      ? wrapped_scalar_slot(*dtype_opt)
+      : nullptr;
+  // A consumer could in principle have restrided or retyped the tensor
+  // while it held the only other reference, so double-check the metadata
+  // still matches a freshly wrapped scalar before refilling in place.
+  if (slot != nullptr && slot->defined() && slot->use_count() == 1 &&
+      slot->weak_use_count() == 1 && slot->dim() == 0 &&
+      slot->scalar_type() == *dtype_opt &&
+      slot->storage().nbytes() >= slot->element_size()) {
+    slot->unsafeGetTensorImpl()->set_wrapped_number(false);
+    scalar_fill(*slot, s);
+    return *slot;
+  }
   auto result = at::detail::empty_cpu({}, dtype_opt, c10::nullopt, device_opt, c10::nullopt, c10::nullopt);
   scalar_fill(result, s);
+  if (slot != nullptr) {
+    *slot = result;
+  }
   return result;
 }
 } // namespace detail
@@ -69,6 +69,7 @@ void SparseCsrTensorImpl::resize_and_clear_(
   col_indices_ = empty_col_indices;
   values_ = empty_values;
   sizes_and_strides_.set_sizes(size);
+  invalidate_backend_handle();
 }
 
 void SparseCsrTensorImpl::resize_as_sparse_csr_tensor_(const Tensor& src) {
@@ -85,6 +86,7 @@ void SparseCsrTensorImpl::resize_as_sparse_csr_tensor_(const Tensor& src) {
       src.values().options(),
       src.values().suggest_memory_format());
   sizes_and_strides_.set_sizes(src.sizes());
+  invalidate_backend_handle();
 }
 
 void SparseCsrTensorImpl::set_member_tensors(
@@ -149,5 +151,6 @@ void SparseCsrTensorImpl::set_member_tensors(
   crow_indices_ = crow_indices;
   col_indices_ = col_indices;
   values_ = values;
+  invalidate_backend_handle();
 }
 } // namespace at
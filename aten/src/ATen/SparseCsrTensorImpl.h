@@ -4,6 +4,9 @@
 #include <c10/core/TensorImpl.h>
 #include <c10/util/Exception.h>
 
+#include <memory>
+#include <mutex>
+
 namespace at {
 
 // Struct implementing a sparse CSR tensor. It uses three 1-D tensors for
@@ -44,7 +47,33 @@ struct TORCH_API SparseCsrTensorImpl : public TensorImpl {
   const Tensor& values() const { return values_; }
   int nnz() { return values_.size(0); }
 
+  // Type-erased cache slot for a library handle derived from this tensor's
+  // sparsity pattern (e.g. an MKL inspector-executor handle). `key` must
+  // encode everything the handle aliases -- typically the member tensors'
+  // data pointers and version counters -- so a stale handle is never
+  // returned after an in-place update. Replacing the member tensors drops
+  // the cache unconditionally.
+  std::shared_ptr<void> cached_backend_handle(uint64_t key) const {
+    std::lock_guard<std::mutex> guard(backend_handle_mutex_);
+    return backend_handle_key_ == key ? backend_handle_ : nullptr;
+  }
+  void set_cached_backend_handle(uint64_t key, std::shared_ptr<void> handle) {
+    std::lock_guard<std::mutex> guard(backend_handle_mutex_);
+    backend_handle_key_ = key;
+    backend_handle_ = std::move(handle);
+  }
+
  private:
+  void invalidate_backend_handle() {
+    std::lock_guard<std::mutex> guard(backend_handle_mutex_);
+    backend_handle_.reset();
+    backend_handle_key_ = 0;
+  }
+
+  mutable std::mutex backend_handle_mutex_;
+  std::shared_ptr<void> backend_handle_;
+  uint64_t backend_handle_key_ = 0;
+
   explicit SparseCsrTensorImpl(
       at::DispatchKeySet key_set,
       const caffe2::TypeMeta data_type,
@@ -1222,8 +1222,181 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
   return FastSetupType::NONE;
 }
 
+// NOTE [ TensorIterator geometry cache ]
+//
+// Small-tensor workloads issue the same operators with identical operand
+// geometry call after call, and for operands that miss fast_set_up the
+// slow path re-derives the exact same plan every time: compute_strides,
+// reorder_dimensions and coalesce_dimensions are pure functions of the
+// broadcast shape plus each operand's sizes, strides and dtype. Memoize
+// that analysis in a small thread-local table. The key packs those inputs
+// into a flat integer vector; the value is the post-coalesce shape, the
+// permutation and every operand's byte strides. Only iterators whose
+// outputs are already allocated (defined and not resized) are cacheable,
+// so a hit never skips an allocation, and set_output is still invoked per
+// output so structured-kernel subclasses observe the final geometry.
+namespace {
+
+constexpr size_t kGeometryCacheSize = 8;
+
+struct GeometryCacheEntry {
+  SmallVector<int64_t, 64> key;
+  DimVector shape;
+  DimVector perm;
+  SmallVector<TensorIteratorBase::StrideVector, 4> stride_bytes;
+};
+
+thread_local std::array<GeometryCacheEntry, kGeometryCacheSize> geometry_cache;
+thread_local size_t geometry_cache_next_slot = 0;
+
+} // namespace
+
+bool TensorIteratorBase::make_geometry_cache_key(SmallVector<int64_t, 64>& key) const {
+  for (int i = 0; i < num_outputs_; i++) {
+    const auto& op = operands_[i];
+    if (!op.tensor->defined() || op.will_resize) {
+      return false;
+    }
+  }
+  key.push_back(ntensors());
+  key.push_back(num_outputs_);
+  key.push_back(static_cast<int64_t>(shape_.size()));
+  key.insert(key.end(), shape_.begin(), shape_.end());
+  for (const auto& op : operands_) {
+    if (!op.tensor->defined()) {
+      return false;
+    }
+    key.push_back(static_cast<int64_t>(op.target_dtype));
+    auto sizes = op.tensor->sizes();
+    auto strides = op.tensor->strides();
+    key.push_back(static_cast<int64_t>(sizes.size()));
+    key.insert(key.end(), sizes.begin(), sizes.end());
+    key.insert(key.end(), strides.begin(), strides.end());
+  }
+  return true;
+}
+
+bool TensorIteratorBase::try_restore_cached_geometry(const SmallVector<int64_t, 64>& key) {
+  for (auto& entry : geometry_cache) {
+    if (entry.key == key) {
+      shape_ = entry.shape;
+      perm_ = entry.perm;
+      has_coalesced_dimensions_ = true;
+      for (int i = 0; i < ntensors(); i++) {
+        operands_[i].stride_bytes = entry.stride_bytes[i];
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+void TensorIteratorBase::cache_computed_geometry(const SmallVector<int64_t, 64>& key) const {
+  auto& entry = geometry_cache[geometry_cache_next_slot];
+  geometry_cache_next_slot = (geometry_cache_next_slot + 1) % kGeometryCacheSize;
+  entry.key = key;
+  entry.shape = shape_;
+  entry.perm = perm_;
+  entry.stride_bytes.clear();
+  for (const auto& op : operands_) {
+    entry.stride_bytes.push_back(op.stride_bytes);
+  }
+}
+
 TensorIteratorBase::TensorIteratorBase() = default;
 
+// NOTE [ Trivial contiguous build fast path ]
+//
+// The generic build() walks the operand list roughly eight times (overlap
+// checks, name inference, shape computation, type computation, fast setup,
+// ...), and for small tensors that bookkeeping dwarfs the actual kernel. The
+// overwhelmingly common case — every operand defined, contiguous, unnamed,
+// same sizes, same dtype, same CPU device — needs none of the generic
+// machinery: the final state is always the 1-d collapsed shape with unit
+// byte strides. Recognize that case with a single pass over the operands and
+// produce the same post-conditions as compute_shape + compute_types +
+// fast_set_up directly. Anything unusual (undefined outputs, broadcasting,
+// promotion, named tensors, non-CPU devices, reductions, meta tensors)
+// falls through to the generic passes.
+bool TensorIteratorBase::fast_build_trivial(const TensorIteratorConfig& config) {
+  if (is_reduction_ || is_meta_) {
+    return false;
+  }
+  if (config.static_shape_.has_value() || config.static_dtype_and_device_.has_value()) {
+    return false;
+  }
+  const auto& first = *operands_[0].tensor;
+  if (!first.defined()) {
+    return false;
+  }
+  const auto first_dtype = operands_[0].target_dtype;
+  if (config.promote_integer_inputs_to_float_ &&
+      c10::isIntegralType(first_dtype, /*includeBool=*/true)) {
+    return false;
+  }
+  for (auto& op : operands_) {
+    if (!op.tensor->defined() || !op.is_type_defined()) {
+      return false;
+    }
+    const auto& t = *op.tensor;
+    if (op.target_dtype != first_dtype ||
+        t.layout() != kStrided ||
+        !t.device().is_cpu() ||
+        t.has_names() ||
+        !t.sizes().equals(first.sizes()) ||
+        !t.is_contiguous(MemoryFormat::Contiguous)) {
+      return false;
+    }
+  }
+
+  // Equivalent of compute_mem_overlaps: internal overlap is impossible for
+  // contiguous tensors, so only the output/input partial overlap check is
+  // left.
+  if (config.check_mem_overlap_) {
+    for (int i = 0; i < num_outputs_; i++) {
+      for (int j = num_outputs_; j < ntensors(); j++) {
+        assert_no_partial_overlap(*operands_[i].tensor, *operands_[j].tensor);
+      }
+    }
+  }
+
+  all_ops_same_shape_ = true;
+  common_dtype_ = first_dtype;
+  common_device_ = first.device();
+
+  // Same collapsed geometry fast_set_up produces for CONTIGUOUS.
+  const int64_t orig_ndim = first.dim();
+  if (orig_ndim > 1) {
+    has_coalesced_dimensions_ = true;
+  }
+  if (orig_ndim >= 1) {
+    shape_.resize(1);
+    shape_[0] = first.numel();
+  } else {
+    shape_.resize(0);
+  }
+
+  for (int i = 0; i < num_outputs_; i++) {
+    auto& op = operands_[i];
+    // Outputs are already allocated with the right geometry, but set_output
+    // still has to run so structured-kernel subclasses observe them.
+    set_output(i, op.tensor->sizes(), {}, original_options(op), names_);
+  }
+
+  for (auto& op : operands_) {
+    auto element_size_in_bytes = op.tensor->element_size();
+    op.stride_bytes.resize(ndim());
+    if (ndim() > 0) {
+      op.stride_bytes[0] = element_size_in_bytes;
+    }
+    op.data = op.tensor->data_ptr();
+  }
+
+  int64_t ndim_offsets = (ndim() ? ndim() : 1);
+  view_offsets_ = DimVector(ndim_offsets, 0);
+  return true;
+}
+
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
@@ -1232,6 +1405,12 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   populate_operands(config);
   // set is_output and is_read_write flags on appropriate tensors
   mark_outputs();
+
+  // single fused pass for trivially contiguous same-dtype CPU operands
+  // (see NOTE [ Trivial contiguous build fast path ])
+  if (fast_build_trivial(config)) {
+    return;
+  }
   // Check that the outputs have no internal overlap
   // and do not share memory with inputs.
   compute_mem_overlaps(config);
@@ -1245,14 +1424,30 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   compute_types(config);
   // try fast setup output tensor, if failed, fallback to normal setup
   if (!fast_set_up(config)) {
-    // compute each tensor's stride after broadcasting
-    compute_strides(config);
-    // re-order dimensions to improve coalescing
-    reorder_dimensions();
-    // allocate the output tensor if it's not provided
-    allocate_or_resize_outputs();
-    // coalesce adjacent dimensions when possible
-    if (!is_meta_) coalesce_dimensions();
+    // See NOTE [ TensorIterator geometry cache ]
+    SmallVector<int64_t, 64> geometry_key;
+    const bool cacheable = !is_meta_ && make_geometry_cache_key(geometry_key);
+    if (cacheable && try_restore_cached_geometry(geometry_key)) {
+      // set_output still has to run for every (already allocated) output so
+      // subclasses observe the final geometry, exactly as
+      // allocate_or_resize_outputs does for defined outputs.
+      for (int i = 0; i < num_outputs_; i++) {
+        auto& op = operands_[i];
+        set_output(i, op.tensor->sizes(), {}, original_options(op), names_);
+      }
+    } else {
+      // compute each tensor's stride after broadcasting
+      compute_strides(config);
+      // re-order dimensions to improve coalescing
+      reorder_dimensions();
+      // allocate the output tensor if it's not provided
+      allocate_or_resize_outputs();
+      // coalesce adjacent dimensions when possible
+      if (!is_meta_) coalesce_dimensions();
+      if (cacheable) {
+        cache_computed_geometry(geometry_key);
+      }
+    }
   }
 
   if (is_meta_) return;
@@ -357,6 +357,12 @@ protected:
   void compute_names(const TensorIteratorConfig&);
   void propagate_names_to_outputs();
   void coalesce_dimensions();
+  // See NOTE [ Trivial contiguous build fast path ] in TensorIterator.cpp
+  bool fast_build_trivial(const TensorIteratorConfig&);
+  // See NOTE [ TensorIterator geometry cache ] in TensorIterator.cpp
+  bool make_geometry_cache_key(SmallVector<int64_t, 64>& key) const;
+  bool try_restore_cached_geometry(const SmallVector<int64_t, 64>& key);
+  void cache_computed_geometry(const SmallVector<int64_t, 64>& key) const;
 
 protected:
 
@@ -8,7 +8,7 @@
 
 namespace at {
 
-ThreadLocalState::ThreadLocalState(bool keep_grad_mode)
+ThreadLocalState::Snapshot::Snapshot(bool keep_grad_mode)
     : dispatch_key_(c10::impl::tls_local_dispatch_key_set()),
       debug_info_(c10::ThreadLocalDebugInfo::current()),
       inference_mode_enabled_(c10::InferenceMode::is_enabled()) {
@@ -23,22 +23,26 @@ ThreadLocalState::ThreadLocalState(bool keep_grad_mode)
   bumped_record_all_functions_ = at::checkRecordAllFunctions();
 }
 
+ThreadLocalState::ThreadLocalState(bool keep_grad_mode)
+    : snapshot_(std::make_shared<const Snapshot>(keep_grad_mode)) {}
+
 /* static */
 void ThreadLocalState::setThreadLocalState(
     const ThreadLocalState& state) {
+  const Snapshot& snapshot = *state.snapshot_;
 #if !defined(CAFFE2_IS_XPLAT_BUILD) && !defined(C10_MOBILE)
-  if (state.keep_grad_mode_) {
-    GradMode::set_enabled(state.grad_mode_enabled_);
+  if (snapshot.keep_grad_mode_) {
+    GradMode::set_enabled(snapshot.grad_mode_enabled_);
   }
 #endif
 
-  at::set_record_function_tls_(state.rf_tls_);
+  at::set_record_function_tls_(snapshot.rf_tls_);
 
-  c10::ThreadLocalDebugInfo::_forceCurrentDebugInfo(state.debug_info_);
+  c10::ThreadLocalDebugInfo::_forceCurrentDebugInfo(snapshot.debug_info_);
 
-  c10::impl::_force_tls_local_dispatch_key_set(state.dispatch_key_);
+  c10::impl::_force_tls_local_dispatch_key_set(snapshot.dispatch_key_);
 
-  c10::InferenceMode::set_enabled(state.inference_mode_enabled_);
+  c10::InferenceMode::set_enabled(snapshot.inference_mode_enabled_);
 }
 
 } // namespace at
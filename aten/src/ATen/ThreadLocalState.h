@@ -26,25 +26,41 @@ class TORCH_API ThreadLocalState {
   static void setThreadLocalState(const ThreadLocalState& state);
 
  private:
-  c10::impl::LocalDispatchKeySet dispatch_key_;
-
-  // ThreadLocalDebugInfo does not change after being created
-  // with DebugInfoGuard
-  std::shared_ptr<c10::ThreadLocalDebugInfo> debug_info_;
-
-  // RecordFunction TLS
-  RecordFunctionTLS rf_tls_;
+  // Note [Shared ThreadLocalState snapshots]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // The captured values live in an immutable refcounted block. A
+  // ThreadLocalState gets copied well beyond the initial capture: into every
+  // guard's prev_state_, and into every copy of a std::function holding a
+  // wrapped continuation (common with inter-op parallelism, where tasks are
+  // requeued and forwarded). Sharing one snapshot turns those copies into a
+  // refcount bump instead of a deep copy of the RecordFunction callback list
+  // and debug info chain. The block is never mutated after capture, so it is
+  // safe to share across threads.
+  struct Snapshot {
+    explicit Snapshot(bool keep_grad_mode);
+
+    c10::impl::LocalDispatchKeySet dispatch_key_;
+
+    // ThreadLocalDebugInfo does not change after being created
+    // with DebugInfoGuard
+    std::shared_ptr<c10::ThreadLocalDebugInfo> debug_info_;
+
+    // RecordFunction TLS
+    RecordFunctionTLS rf_tls_;
 
 #if !defined(CAFFE2_IS_XPLAT_BUILD) && !defined(C10_MOBILE)
-  bool keep_grad_mode_ = true;
-  bool grad_mode_enabled_;
+    bool keep_grad_mode_ = true;
+    bool grad_mode_enabled_;
 #endif
 
-  // TLS for InferenceMode
-  bool inference_mode_enabled_;
+    // TLS for InferenceMode
+    bool inference_mode_enabled_;
 
-  // Whether pre-sampling RecordFunction optimization was enabled
-  bool bumped_record_all_functions_ = false;
+    // Whether pre-sampling RecordFunction optimization was enabled
+    bool bumped_record_all_functions_ = false;
+  };
+
+  std::shared_ptr<const Snapshot> snapshot_;
 
   friend class ThreadLocalStateGuard;
 };
@@ -54,7 +70,7 @@ class TORCH_API ThreadLocalStateGuard {
  public:
   explicit ThreadLocalStateGuard(const ThreadLocalState& state)
       : prev_state_(ThreadLocalState()),
-        bumped_record_all_functions_(state.bumped_record_all_functions_) {
+        bumped_record_all_functions_(state.snapshot_->bumped_record_all_functions_) {
     // Special handling of RecordFunction pre-sampling optimization:
     // pre-samping is enabled (bumped) when there're non-sampled
     // (or high-frequency) global or TLS callbacks.
@@ -75,13 +75,74 @@ using can_unbox =
 //
 template <class... Args>
 torch::jit::Stack boxArgs(Args... args) {
-  // TODO Reuse stack vector instead of allocating?
   torch::jit::Stack stack;
   stack.reserve(sizeof...(Args));
   torch::jit::push(stack, std::forward<Args>(args)...);
   return stack;
 }
 
+// boxArgsInto - like boxArgs, but fills a caller-provided stack, so the
+// wrappers below can use a pooled stack instead of allocating one.
+template <class... Args>
+void boxArgsInto(torch::jit::Stack& stack, Args... args) {
+  stack.reserve(sizeof...(Args));
+  torch::jit::push(stack, std::forward<Args>(args)...);
+}
+
+//
+// PooledStack - RAII loan of a stack from a per-thread freelist.
+//
+// The boxed-kernel wrappers build one stack per call; reusing the vectors
+// (and the capacity they have grown) across calls means features implemented
+// as boxed fallbacks - batching, conj, named tensors - stop paying a heap
+// allocation on every op. A freelist rather than a single thread_local stack
+// because a boxed kernel may redispatch and re-enter a wrapper while the
+// outer stack is still live.
+//
+class PooledStack final {
+ public:
+  PooledStack() : stack_(acquire()) {}
+  ~PooledStack() {
+    release(std::move(stack_));
+  }
+  PooledStack(const PooledStack&) = delete;
+  PooledStack& operator=(const PooledStack&) = delete;
+
+  torch::jit::Stack& get() {
+    return stack_;
+  }
+
+ private:
+  // Bounds the memory idle threads keep; stacks past the cap are simply
+  // destroyed on release.
+  static constexpr size_t kMaxPooledStacks = 8;
+
+  static std::vector<torch::jit::Stack>& pool() {
+    thread_local std::vector<torch::jit::Stack> instance;
+    return instance;
+  }
+
+  static torch::jit::Stack acquire() {
+    auto& p = pool();
+    if (p.empty()) {
+      return torch::jit::Stack();
+    }
+    torch::jit::Stack stack = std::move(p.back());
+    p.pop_back();
+    return stack;
+  }
+
+  static void release(torch::jit::Stack&& stack) {
+    auto& p = pool();
+    if (p.size() < kMaxPooledStacks) {
+      stack.clear();
+      p.push_back(std::move(stack));
+    }
+  }
+
+  torch::jit::Stack stack_;
+};
+
 //
 // PopResult is a helper class whose specializations handle popping single and
 // multiple return values, respectively.
@@ -176,7 +237,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     Args... args
   ) {
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    PooledStack pooled;
+    torch::jit::Stack& stack = pooled.get();
+    boxArgsInto<Args...>(stack, std::forward<Args>(args)...);
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
 
     return guts::if_constexpr<!std::is_same<void, Result>::value>(
@@ -217,7 +280,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs<at::Tensor&, OtherArgs...>(outArg, std::forward<OtherArgs>(otherArgs)...);
+    PooledStack pooled;
+    torch::jit::Stack& stack = pooled.get();
+    boxArgsInto<at::Tensor&, OtherArgs...>(stack, outArg, std::forward<OtherArgs>(otherArgs)...);
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -244,7 +309,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     const at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs(outArg, otherArgs...);
+    PooledStack pooled;
+    torch::jit::Stack& stack = pooled.get();
+    boxArgsInto(stack, outArg, otherArgs...);
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -282,7 +349,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     FirstArg firstArg, RestArgs... restArgs
   ) {
-    torch::jit::Stack stack = boxArgs<FirstArg, RestArgs...>(std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
+    PooledStack pooled;
+    torch::jit::Stack& stack = pooled.get();
+    boxArgsInto<FirstArg, RestArgs...>(stack, std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -322,7 +391,9 @@ struct BoxedKernelWrapper<
     using ArgTuple = std::tuple<Args...>;
     constexpr int RetCount = std::tuple_size<Result>();
 
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    PooledStack pooled;
+    torch::jit::Stack& stack = pooled.get();
+    boxArgsInto<Args...>(stack, std::forward<Args>(args)...);
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == RetCount,
@@ -158,7 +158,13 @@ public:
 
   [[noreturn]] void reportError(DispatchKey dispatchKey) const;
 
-  const KernelFunction& lookup(DispatchKey k) const {
+  // Resolving a kernel is a single direct-indexed load: dispatchTable_ is a
+  // flat per-key array kept up to date on (de)registration, so steady-state
+  // callers that always resolve to the same key hit the same cache line every
+  // time. A separate last-(keyset -> kernel) memo would not remove any work,
+  // since the dispatch keyset still has to be computed from the arguments and
+  // TLS on every call to know whether such a memo even applies.
+  C10_ALWAYS_INLINE const KernelFunction& lookup(DispatchKey k) const {
     const auto& kernel = dispatchTable_[static_cast<uint8_t>(k)];
     // A valid kernel *always* has a boxed kernel and *may* have an
     // unboxed kernel. However, we typically do unboxed calls in at::
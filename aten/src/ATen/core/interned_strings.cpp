@@ -20,8 +20,21 @@ const std::string& domain_prefix() {
 }
 
 Symbol InternedStrings::symbol(const std::string& s) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  return _symbol(s);
+  // Fast path: wait-free lookup of an already registered symbol.
+  auto hit = registry_.read([&](const Registry& registry) -> c10::optional<Symbol> {
+    auto it = registry.string_to_sym.find(s);
+    if (it != registry.string_to_sym.end()) {
+      return it->second;
+    }
+    return c10::nullopt;
+  });
+  if (hit) {
+    return *hit;
+  }
+  // Slow path: register the symbol. A thread that raced us here may already
+  // have registered s, which _symbol handles by returning the existing entry.
+  return registry_.write(
+      [&](Registry& registry) { return _symbol(registry, s); });
 }
 
 std::pair<const char*, const char*> InternedStrings::string(Symbol sym) {
@@ -46,8 +59,8 @@ std::pair<const char*, const char*> InternedStrings::string(Symbol sym) {
 
 Symbol InternedStrings::ns(Symbol sym) {
 #if defined C10_MOBILE
-  std::lock_guard<std::mutex> guard(mutex_);
-  return sym_to_info_.at(sym).ns;
+  return registry_.read(
+      [&](const Registry& registry) { return registry.sym_to_info.at(sym).ns; });
 #else
   switch (sym) {
 #define DEFINE_CASE(ns, s) \
@@ -56,17 +69,17 @@ Symbol InternedStrings::ns(Symbol sym) {
     // NOLINTNEXTLINE(bugprone-branch-clone)
     FORALL_NS_SYMBOLS(DEFINE_CASE)
 #undef DEFINE_CASE
-    default: {
-      std::lock_guard<std::mutex> guard(mutex_);
-      return sym_to_info_.at(sym).ns;
-    }
+    default:
+      return registry_.read([&](const Registry& registry) {
+        return registry.sym_to_info.at(sym).ns;
+      });
   }
 #endif
 }
 
-Symbol InternedStrings::_symbol(const std::string& s) {
-  auto it = string_to_sym_.find(s);
-  if (it != string_to_sym_.end())
+Symbol InternedStrings::_symbol(Registry& registry, const std::string& s) {
+  auto it = registry.string_to_sym.find(s);
+  if (it != registry.string_to_sym.end())
     return it->second;
 
   auto pos = s.find("::");
@@ -75,18 +88,23 @@ Symbol InternedStrings::_symbol(const std::string& s) {
     ss << "all symbols must have a namespace, <namespace>::<string>, but found: " << s;
     throw std::runtime_error(ss.str());
   }
-  Symbol ns = _symbol("namespaces::" + s.substr(0, pos));
+  Symbol ns = _symbol(registry, "namespaces::" + s.substr(0, pos));
 
-  Symbol sym(sym_to_info_.size());
-  string_to_sym_[s] = sym;
-  sym_to_info_.push_back({ns, s, s.substr(pos + strlen("::"))});
+  Symbol sym(registry.sym_to_info.size());
+  registry.string_to_sym[s] = sym;
+  registry.sym_to_info.push_back({ns, s, s.substr(pos + strlen("::"))});
   return sym;
 }
 
 std::pair<const char*, const char*> InternedStrings::customString(Symbol sym) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  SymbolInfo& s = sym_to_info_.at(sym);
-  return {s.qual_name.c_str(), s.unqual_name.c_str()};
+  // The deque backing sym_to_info never relocates its elements, so these
+  // pointers stay valid after the read section ends, even while other
+  // threads register new symbols.
+  return registry_.read(
+      [&](const Registry& registry) -> std::pair<const char*, const char*> {
+        const SymbolInfo& s = registry.sym_to_info.at(sym);
+        return {s.qual_name.c_str(), s.unqual_name.c_str()};
+      });
 }
 
 static InternedStrings & globalStrings() {
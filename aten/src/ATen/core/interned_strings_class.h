@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <iostream>
 #include <mutex>
 #include <sstream>
@@ -8,6 +9,7 @@
 #include <vector>
 #include <ATen/core/interned_strings.h>
 #include <c10/util/Exception.h>
+#include <c10/util/LeftRight.h>
 
 namespace c10 {
 
@@ -18,19 +20,30 @@ struct TORCH_API InternedStrings {
   Symbol ns(Symbol sym);
 
  private:
-  // prereq - holding mutex_
-  Symbol _symbol(const std::string& s);
-  std::pair<const char*, const char*> customString(Symbol sym);
-  std::unordered_map<std::string, Symbol> string_to_sym_;
-
   struct SymbolInfo {
     Symbol ns;
     std::string qual_name;
     std::string unqual_name;
   };
-  std::vector<SymbolInfo> sym_to_info_;
 
-  std::mutex mutex_;
+  // All interned symbols. Lookups vastly outnumber registrations (a symbol is
+  // registered once but resolved on every schema parse and graph
+  // construction), so the registry lives in a LeftRight: reads are wait-free
+  // and never contend with each other, while registration of new symbols is
+  // serialized on LeftRight's internal write mutex. string() hands out
+  // pointers into sym_to_info entries, so elements must stay at stable
+  // addresses as the registry grows; the deque guarantees that where a
+  // vector would not.
+  struct Registry {
+    std::unordered_map<std::string, Symbol> string_to_sym;
+    std::deque<SymbolInfo> sym_to_info;
+  };
+
+  // prereq - only called from within registry_.write()
+  static Symbol _symbol(Registry& registry, const std::string& s);
+  std::pair<const char*, const char*> customString(Symbol sym);
+
+  LeftRight<Registry> registry_;
 };
 
 } // namespace c10
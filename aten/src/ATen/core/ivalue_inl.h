@@ -312,6 +312,11 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
 
  public:
   explicit Future(TypePtr type) : type_(type) {}
+
+  // Posts a unit of work onto some executor (e.g. a thread pool). Used as an
+  // affinity hint for where this future's callbacks should run.
+  using TaskLauncher = std::function<void(std::function<void(void)>)>;
+
   struct TORCH_API FutureError final : public std::exception {
     explicit FutureError(std::string&& error_msg_)
         : error_msg(std::move(error_msg_)) {}
@@ -388,13 +393,18 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
     value_ = std::move(value);
     completed_ = true;
 
-    std::vector<std::function<void(void)>> cbs;
+    std::vector<Callback> cbs;
     cbs.swap(callbacks_);
+    TaskLauncher launcher = launcher_;
     lock.unlock();
 
     finished_cv_.notify_all();
     for (auto& callback : cbs) {
-      callback();
+      if (launcher && !callback.run_inline) {
+        launcher(std::move(callback.fn));
+      } else {
+        callback.fn();
+      }
     }
   }
 
@@ -447,13 +457,48 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
     return value_;
   }
 
+  /**
+   * Set an executor for this future's callbacks. When set, callbacks (other
+   * than those added with addCallbackInline) are posted to the launcher
+   * instead of running on whichever thread happens to complete the future,
+   * which keeps continuations on the cores that own their data.
+   */
+  void setCallbackLauncher(TaskLauncher launcher) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    launcher_ = std::move(launcher);
+  }
+
   /**
    * Add a callback to the future.
    * The callbacks will be executed once the future completes.
    * If the future has already completed,
-   * this function will execute the callback immediately.
+   * this function will execute the callback immediately (or post it to the
+   * launcher, if one is set).
    */
   void addCallback(std::function<void(void)> callback) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    callback = wrapCallback(std::move(callback));
+    if (completed()) {
+      TaskLauncher launcher = launcher_;
+      lock.unlock();
+      if (launcher) {
+        launcher(std::move(callback));
+      } else {
+        callback();
+      }
+      return;
+    }
+    callbacks_.push_back(Callback{std::move(callback), /*run_inline=*/false});
+  }
+
+  /**
+   * Like addCallback, but the callback never bounces through the launcher: it
+   * runs immediately on the calling thread when the future is already
+   * complete, and otherwise on whichever thread completes the future. Use
+   * this for continuations cheap enough that handing them to an executor
+   * would cost more than running them in place.
+   */
+  void addCallbackInline(std::function<void(void)> callback) {
     std::unique_lock<std::mutex> lock(mutex_);
     callback = wrapCallback(std::move(callback));
     if (completed()) {
@@ -461,7 +506,7 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
       callback();
       return;
     }
-    callbacks_.emplace_back(std::move(callback));
+    callbacks_.push_back(Callback{std::move(callback), /*run_inline=*/true});
   }
 
   /**
@@ -484,6 +529,33 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
     return fut;
   }
 
+  /**
+   * Variant of then() whose callback receives the completed parent future.
+   * The callback can read the parent's value through constValue(), i.e. by
+   * const reference, instead of capturing the future and paying for a copy of
+   * the IValue via value() on every hop of a chain. Errors are forwarded to
+   * the returned future directly, without the rethrow/catch round trip that
+   * calling value() from the callback would incur.
+   */
+  c10::intrusive_ptr<Future> then(
+      std::function<IValue(Future&)> callback,
+      TypePtr type) {
+    auto fut = createInstance(std::move(type));
+    auto self = intrusive_from_this();
+    addCallback([fut, self, cb = std::move(callback)]() {
+      if (self->hasError()) {
+        fut->setError(self->exception_ptr());
+        return;
+      }
+      try {
+        fut->markCompleted(cb(*self));
+      } catch (std::exception&) {
+        fut->setError(std::current_exception());
+      }
+    });
+    return fut;
+  }
+
   // Tries to retrieve the error message from std::exception_ptr.
   std::string tryRetrieveErrorMessage() const {
     TORCH_CHECK(hasError(), "No error present on the future.");
@@ -577,13 +649,18 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
 
     // Do not call preMarkCompletedHook() here as there isn't any value.
 
-    std::vector<std::function<void(void)>> cbs;
+    std::vector<Callback> cbs;
     cbs.swap(callbacks_);
+    TaskLauncher launcher = launcher_;
     lock.unlock();
 
     finished_cv_.notify_all();
     for (auto& callback : cbs) {
-      callback();
+      if (launcher && !callback.run_inline) {
+        launcher(std::move(callback.fn));
+      } else {
+        callback.fn();
+      }
     }
   }
 
@@ -598,14 +675,24 @@ struct C10_EXPORT ivalue::Future : c10::intrusive_ptr_target {
     }
   }
 
+  // A pending callback, and whether it must run on the completing thread
+  // even when a launcher is set (see addCallbackInline).
+  struct Callback {
+    std::function<void(void)> fn;
+    bool run_inline;
+  };
+
   mutable std::mutex mutex_;
   std::atomic_bool completed_ = {false}; // is this future complete
   std::condition_variable finished_cv_;
 
   IValue value_; // when finished the value
   TypePtr type_;
-  std::vector<std::function<void(void)>> callbacks_;
+  std::vector<Callback> callbacks_;
   std::exception_ptr eptr_;
+  // Optional affinity hint: when set, callbacks are posted here rather than
+  // run on the completing thread.
+  TaskLauncher launcher_;
 };
 
 // Input is a list of Futures with the same target type.
@@ -42,20 +42,24 @@ constexpr Entry entries[] = {
 
 } // namespace
 
-InternedStrings::InternedStrings()
-    : sym_to_info_(static_cast<size_t>(_keys::num_symbols)) {
+InternedStrings::InternedStrings() {
   // Instead of a loop, this could be done by expanding the
   // assignments directly into FORALL_NS_SYMBOLS, but it would create
   // a huge function (thanks to all the std::string constructors and
   // operator[]s) which would take several minutes to optimize. A
   // static C array of constexpr-constructible structs takes instead
   // no time to compile.
-  for (const auto& entry : entries) {
-    auto qual_name = qual_name_for_entry(entry);
-    string_to_sym_[qual_name] = entry.sym;
-    sym_to_info_[entry.sym] = {
-      entry.ns_sym, std::move(qual_name), entry.unqual_name};
-  }
+  // The write lambda runs once per LeftRight copy, seeding both with the
+  // builtin symbols.
+  registry_.write([](Registry& registry) {
+    registry.sym_to_info.resize(static_cast<size_t>(_keys::num_symbols));
+    for (const auto& entry : entries) {
+      auto qual_name = qual_name_for_entry(entry);
+      registry.string_to_sym[qual_name] = entry.sym;
+      registry.sym_to_info[entry.sym] = {
+        entry.ns_sym, std::move(qual_name), entry.unqual_name};
+    }
+  });
 }
 
 } // namespace c10
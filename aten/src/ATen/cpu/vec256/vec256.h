@@ -3,6 +3,14 @@
 // DO NOT DEFINE STATIC DATA IN THIS HEADER!
 // See Note [Do not compile initializers with AVX]
 
+// The AVX512 kernel tier reuses the 256-bit vector classes for now: every
+// AVX2 intrinsic is valid under -mavx512*, and the EVEX encodings plus the
+// doubled register file already buy a good chunk of the win. A dedicated
+// 512-bit class family can be layered underneath without touching kernels.
+#if defined(CPU_CAPABILITY_AVX512) && !defined(CPU_CAPABILITY_AVX2)
+#define CPU_CAPABILITY_AVX2
+#endif
+
 #include <ATen/cpu/vec256/intrinsics.h>
 
 #include <ATen/cpu/vec256/vec256_base.h>
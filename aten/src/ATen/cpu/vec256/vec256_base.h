@@ -527,6 +527,25 @@ public:
   Vec256<T> le(const Vec256<T>& other) const { return binary_pred_bool(other, std::less_equal<T>()); }
 };
 
+// Stores a full vector with a non-temporal (streaming) hint where the ISA
+// provides one, bypassing the cache hierarchy so huge writes do not evict
+// the working set. `ptr` must be aligned to the width of the vector, and
+// callers must issue a stream_sync() after their last streaming store.
+// This generic version is an ordinary store; ISA-specific headers overload
+// it for the types that have streaming instructions.
+template <class T>
+inline void stream_store(const Vec256<T>& vec, T* ptr) {
+  vec.store(ptr);
+}
+
+// Makes streaming stores issued via stream_store visible to subsequent loads
+// and stores from any core.
+inline void stream_sync() {
+#if defined(CPU_CAPABILITY_AVX) || defined(CPU_CAPABILITY_AVX2)
+  _mm_sfence();
+#endif
+}
+
 template <class T> Vec256<T> inline operator+(const Vec256<T> &a, const Vec256<T> &b) {
   Vec256<T> c = Vec256<T>();
   for (int i = 0; i != Vec256<T>::size(); i++) {
@@ -154,7 +154,66 @@ public:
     return Vec256<double>(Sleef_erfcd4_u15(values));
   }
   Vec256<double> erfinv() const {
-    return map(calc_erfinv);
+    // Same scheme as calc_erfinv, evaluated branch-free on all lanes: a
+    // rational approximation per range followed by two Newton steps, with
+    // the |y| == 1 and |y| > 1 special cases blended in at the end.
+    const auto one = _mm256_set1_pd(1.0);
+    const auto sign_mask = _mm256_set1_pd(-0.0);
+    const auto y_abs = _mm256_andnot_pd(sign_mask, values);
+    const auto y_sign = _mm256_and_pd(sign_mask, values);
+
+    // Central range: |y| <= 0.7
+    auto z = _mm256_mul_pd(values, values);
+    auto num = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(-0.140543331), z),
+        _mm256_set1_pd(0.914624893));
+    num = _mm256_add_pd(_mm256_mul_pd(num, z), _mm256_set1_pd(-1.645349621));
+    num = _mm256_add_pd(_mm256_mul_pd(num, z), _mm256_set1_pd(0.886226899));
+    auto dem = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(0.012229801), z),
+        _mm256_set1_pd(-0.329097515));
+    dem = _mm256_add_pd(_mm256_mul_pd(dem, z), _mm256_set1_pd(1.442710462));
+    dem = _mm256_add_pd(_mm256_mul_pd(dem, z), _mm256_set1_pd(-2.118377725));
+    dem = _mm256_add_pd(_mm256_mul_pd(dem, z), one);
+    const auto x_central = _mm256_div_pd(_mm256_mul_pd(values, num), dem);
+
+    // Tail: 0.7 < |y| < 1
+    auto zt = _mm256_sqrt_pd(_mm256_xor_pd(
+        sign_mask,
+        Sleef_logd4_u10(_mm256_mul_pd(
+            _mm256_sub_pd(one, y_abs), _mm256_set1_pd(0.5)))));
+    auto numt = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(1.641345311), zt),
+        _mm256_set1_pd(3.429567803));
+    numt = _mm256_add_pd(_mm256_mul_pd(numt, zt), _mm256_set1_pd(-1.624906493));
+    numt = _mm256_add_pd(_mm256_mul_pd(numt, zt), _mm256_set1_pd(-1.970840454));
+    auto demt = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(1.637067800), zt),
+        _mm256_set1_pd(3.543889200));
+    demt = _mm256_add_pd(_mm256_mul_pd(demt, zt), one);
+    const auto x_tail = _mm256_div_pd(_mm256_or_pd(numt, y_sign), demt);
+
+    const auto central_mask = _mm256_cmp_pd(y_abs, _mm256_set1_pd(0.7), _CMP_LE_OQ);
+    auto x = _mm256_blendv_pd(x_tail, x_central, central_mask);
+
+    // Two steps of Newton-Raphson correction
+    const auto k = _mm256_set1_pd(2.0 / std::sqrt(c10::pi<double>));
+    for (int i = 0; i < 2; ++i) {
+      const auto e = _mm256_sub_pd(Sleef_erfd4_u10(x), values);
+      const auto d = _mm256_mul_pd(
+          k, Sleef_expd4_u10(_mm256_xor_pd(sign_mask, _mm256_mul_pd(x, x))));
+      x = _mm256_sub_pd(x, _mm256_div_pd(e, d));
+    }
+
+    x = _mm256_blendv_pd(
+        x,
+        _mm256_or_pd(_mm256_set1_pd(INFINITY), y_sign),
+        _mm256_cmp_pd(y_abs, one, _CMP_EQ_OQ));
+    x = _mm256_blendv_pd(
+        x,
+        _mm256_set1_pd(NAN),
+        _mm256_cmp_pd(y_abs, one, _CMP_GT_OQ));
+    return x;
   }
   Vec256<double> exp() const {
     return Vec256<double>(Sleef_expd4_u10(values));
@@ -293,6 +352,10 @@ public:
   Vec256<double> ge(const Vec256<double>& other) const;
 };
 
+inline void stream_store(const Vec256<double>& vec, double* ptr) {
+  _mm256_stream_pd(ptr, vec);
+}
+
 template <>
 Vec256<double> inline operator+(const Vec256<double>& a, const Vec256<double>& b) {
   return _mm256_add_pd(a, b);
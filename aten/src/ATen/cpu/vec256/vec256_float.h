@@ -161,7 +161,66 @@ public:
     return Vec256<float>(Sleef_erfcf8_u15(values));
   }
   Vec256<float> erfinv() const {
-    return map(calc_erfinv);
+    // Same scheme as calc_erfinv, evaluated branch-free on all lanes: a
+    // rational approximation per range followed by two Newton steps, with
+    // the |y| == 1 and |y| > 1 special cases blended in at the end.
+    const auto one = _mm256_set1_ps(1.0f);
+    const auto sign_mask = _mm256_set1_ps(-0.0f);
+    const auto y_abs = _mm256_andnot_ps(sign_mask, values);
+    const auto y_sign = _mm256_and_ps(sign_mask, values);
+
+    // Central range: |y| <= 0.7
+    auto z = _mm256_mul_ps(values, values);
+    auto num = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(-0.140543331f), z),
+        _mm256_set1_ps(0.914624893f));
+    num = _mm256_add_ps(_mm256_mul_ps(num, z), _mm256_set1_ps(-1.645349621f));
+    num = _mm256_add_ps(_mm256_mul_ps(num, z), _mm256_set1_ps(0.886226899f));
+    auto dem = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(0.012229801f), z),
+        _mm256_set1_ps(-0.329097515f));
+    dem = _mm256_add_ps(_mm256_mul_ps(dem, z), _mm256_set1_ps(1.442710462f));
+    dem = _mm256_add_ps(_mm256_mul_ps(dem, z), _mm256_set1_ps(-2.118377725f));
+    dem = _mm256_add_ps(_mm256_mul_ps(dem, z), one);
+    const auto x_central = _mm256_div_ps(_mm256_mul_ps(values, num), dem);
+
+    // Tail: 0.7 < |y| < 1
+    auto zt = _mm256_sqrt_ps(_mm256_xor_ps(
+        sign_mask,
+        Sleef_logf8_u10(_mm256_mul_ps(
+            _mm256_sub_ps(one, y_abs), _mm256_set1_ps(0.5f)))));
+    auto numt = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(1.641345311f), zt),
+        _mm256_set1_ps(3.429567803f));
+    numt = _mm256_add_ps(_mm256_mul_ps(numt, zt), _mm256_set1_ps(-1.624906493f));
+    numt = _mm256_add_ps(_mm256_mul_ps(numt, zt), _mm256_set1_ps(-1.970840454f));
+    auto demt = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(1.637067800f), zt),
+        _mm256_set1_ps(3.543889200f));
+    demt = _mm256_add_ps(_mm256_mul_ps(demt, zt), one);
+    const auto x_tail = _mm256_div_ps(_mm256_or_ps(numt, y_sign), demt);
+
+    const auto central_mask = _mm256_cmp_ps(y_abs, _mm256_set1_ps(0.7f), _CMP_LE_OQ);
+    auto x = _mm256_blendv_ps(x_tail, x_central, central_mask);
+
+    // Two steps of Newton-Raphson correction
+    const auto k = _mm256_set1_ps(2.0f / static_cast<float>(std::sqrt(c10::pi<double>)));
+    for (int i = 0; i < 2; ++i) {
+      const auto e = _mm256_sub_ps(Sleef_erff8_u10(x), values);
+      const auto d = _mm256_mul_ps(
+          k, Sleef_expf8_u10(_mm256_xor_ps(sign_mask, _mm256_mul_ps(x, x))));
+      x = _mm256_sub_ps(x, _mm256_div_ps(e, d));
+    }
+
+    x = _mm256_blendv_ps(
+        x,
+        _mm256_or_ps(_mm256_set1_ps(INFINITY), y_sign),
+        _mm256_cmp_ps(y_abs, one, _CMP_EQ_OQ));
+    x = _mm256_blendv_ps(
+        x,
+        _mm256_set1_ps(NAN),
+        _mm256_cmp_ps(y_abs, one, _CMP_GT_OQ));
+    return x;
   }
   Vec256<float> exp() const {
     return Vec256<float>(Sleef_expf8_u10(values));
@@ -412,6 +471,10 @@ inline void convert(const float* src, float* dst, int64_t n) {
   }
 }
 
+inline void stream_store(const Vec256<float>& vec, float* ptr) {
+  _mm256_stream_ps(ptr, vec);
+}
+
 #ifdef CPU_CAPABILITY_AVX2
 template <>
 Vec256<float> inline fmadd(const Vec256<float>& a, const Vec256<float>& b, const Vec256<float>& c) {
@@ -829,6 +829,22 @@ Vec256<int64_t> inline emulate(const Vec256<int64_t>& a, const Vec256<int64_t>&
   return _mm256_set_epi64x(c3, c2, c1, c0);
 }
 
+inline void stream_store(const Vec256<int64_t>& vec, int64_t* ptr) {
+  _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);
+}
+
+inline void stream_store(const Vec256<int32_t>& vec, int32_t* ptr) {
+  _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);
+}
+
+inline void stream_store(const Vec256<int16_t>& vec, int16_t* ptr) {
+  _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);
+}
+
+inline void stream_store(const Vec256<int8_t>& vec, int8_t* ptr) {
+  _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), vec);
+}
+
 template <typename op_t>
 Vec256<int64_t> inline emulate(const Vec256<int64_t>& a, const Vec256<int64_t>& b, const Vec256<int64_t>& c, const op_t& op) {
   int64_t a0 = _mm256_extract_epi64(a, 0);
@@ -0,0 +1,100 @@
+#include <ATen/cuda/BatchedTransfer.h>
+
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/PinnedMemoryAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <THC/THCCachingHostAllocator.h>
+
+#include <cstring>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+// Matches the device allocator's minimum block alignment, and keeps every
+// staged tensor's byte offset divisible by any element size.
+constexpr size_t kStagingAlignment = 256;
+
+size_t align_up(size_t n) {
+  return (n + kStagingAlignment - 1) & ~(kStagingAlignment - 1);
+}
+
+} // namespace
+
+std::vector<Tensor> batched_to_device(
+    TensorList tensors,
+    Device device,
+    bool non_blocking) {
+  TORCH_CHECK(
+      device.is_cuda(), "batched_to_device expects a CUDA device, got ",
+      device);
+  if (tensors.empty()) {
+    return {};
+  }
+
+  // Materialize contiguous host sources and lay them out in one buffer.
+  std::vector<Tensor> contig_srcs;
+  std::vector<size_t> offsets;
+  contig_srcs.reserve(tensors.size());
+  offsets.reserve(tensors.size());
+  size_t total_bytes = 0;
+  for (const auto& tensor : tensors) {
+    TORCH_CHECK(
+        tensor.device().is_cpu() && tensor.layout() == kStrided,
+        "batched_to_device expects strided CPU tensors, got a ",
+        tensor.layout(), " tensor on ", tensor.device());
+    contig_srcs.push_back(tensor.contiguous());
+    offsets.push_back(total_bytes);
+    total_bytes = align_up(total_bytes + contig_srcs.back().nbytes());
+  }
+
+  CUDAGuard device_guard(device);
+  CUDAStream stream = getCurrentCUDAStream();
+
+  auto staging = getPinnedMemoryAllocator()->allocate(total_bytes);
+  char* staging_data = static_cast<char*>(staging.get());
+  for (size_t i = 0; i < contig_srcs.size(); ++i) {
+    if (contig_srcs[i].nbytes() > 0) {
+      std::memcpy(
+          staging_data + offsets[i],
+          contig_srcs[i].data_ptr(),
+          contig_srcs[i].nbytes());
+    }
+  }
+
+  // One transfer; every output aliases a range of this buffer.
+  Tensor device_buffer = at::empty(
+      {static_cast<int64_t>(total_bytes)},
+      at::TensorOptions().dtype(kByte).device(device));
+  AT_CUDA_CHECK(cudaMemcpyAsync(
+      device_buffer.data_ptr(),
+      staging_data,
+      total_bytes,
+      cudaMemcpyHostToDevice,
+      stream));
+  if (non_blocking) {
+    // The caching host allocator defers reusing the staging buffer until
+    // this event fires, the same protocol copy_ uses for pinned sources.
+    AT_CUDA_CHECK(THCCachingHostAllocator_recordEvent(staging_data, stream));
+  } else {
+    AT_CUDA_CHECK(cudaStreamSynchronize(stream));
+  }
+
+  std::vector<Tensor> outputs;
+  outputs.reserve(tensors.size());
+  for (size_t i = 0; i < contig_srcs.size(); ++i) {
+    const Tensor& src = contig_srcs[i];
+    Tensor out = at::empty({0}, src.options().device(device));
+    out.set_(
+        device_buffer.storage(),
+        static_cast<int64_t>(offsets[i]) / src.element_size(),
+        src.sizes());
+    outputs.push_back(std::move(out));
+  }
+  return outputs;
+}
+
+} // namespace cuda
+} // namespace at
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/ATenCUDAGeneral.h>
+#include <c10/core/Device.h>
+
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+// Copies a batch of small CPU tensors to `device` with a single
+// host-to-device transfer.
+//
+// Each tensor individually copied via Tensor::copy_ costs one
+// cudaMemcpyAsync launch; for the hundreds of tiny tensors a
+// preprocessing step typically uploads, launch overhead dominates the
+// actual transfer time. This routine instead stages all sources into one
+// pinned host buffer, issues one cudaMemcpyAsync into one device buffer,
+// and returns contiguous device tensors that view disjoint (256-byte
+// aligned) ranges of that buffer - so no per-tensor device work is needed
+// at all.
+//
+// With non_blocking=true the staging buffer is handed back to the caching
+// host allocator with a recorded event (like an ordinary pinned-memory
+// copy_), so the call returns as soon as the copy is enqueued on the
+// current stream. Sources must be strided CPU tensors; non-contiguous
+// sources are made contiguous on the host first.
+TORCH_CUDA_CPP_API std::vector<Tensor> batched_to_device(
+    TensorList tensors,
+    Device device,
+    bool non_blocking = false);
+
+} // namespace cuda
+} // namespace at
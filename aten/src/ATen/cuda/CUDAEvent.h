@@ -2,6 +2,7 @@
 
 #include <ATen/cuda/ATenCUDAGeneral.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAStream.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <ATen/cuda/Exceptions.h>
@@ -49,7 +50,13 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
     try {
       if (is_created_) {
         CUDAGuard guard(device_index_);
-        cudaEventDestroy(event_);
+        if (from_pool_) {
+          // Returning a possibly still pending event is fine: the pool's
+          // next acquirer records it before using it, which resets it.
+          c10::cuda::returnEventToPool(device_index_, event_);
+        } else {
+          cudaEventDestroy(event_);
+        }
       }
     } catch (...) { /* No throw */ }
   }
@@ -107,7 +114,10 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
   // Note: cudaEventRecord must be called on the same device as the event.
   void record(const CUDAStream& stream) {
     if (!is_created_) {
-      createEvent(stream.device_index());
+      // The pool is only usable here: record() immediately re-records the
+      // event, so it doesn't matter that a pooled event may carry the state
+      // of its previous life. (Pool events are all cudaEventDisableTiming.)
+      createEvent(stream.device_index(), /*from_pool=*/flags_ == cudaEventDisableTiming);
     }
 
     TORCH_CHECK(device_index_ == stream.device_index(), "Event device ", device_index_,
@@ -148,8 +158,9 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
     #ifndef __HIP_PLATFORM_HCC__
       if (!is_created_) {
         // this CUDAEvent object was initially constructed from flags but event_
-        // is not created yet.
-        createEvent(getCurrentCUDAStream().device_index());
+        // is not created yet. Don't draw from the pool: a recycled event's
+        // stale state must not leak across process boundaries.
+        createEvent(getCurrentCUDAStream().device_index(), /*from_pool=*/false);
       }
       CUDAGuard guard(device_index_);
       AT_CUDA_CHECK(cudaIpcGetEventHandle(handle, event_));
@@ -162,13 +173,19 @@ private:
   unsigned int flags_ = cudaEventDisableTiming;
   bool is_created_ = false;
   bool was_recorded_ = false;
+  bool from_pool_ = false;
   DeviceIndex device_index_ = -1;
   cudaEvent_t event_;
 
-  void createEvent(DeviceIndex device_index) {
+  void createEvent(DeviceIndex device_index, bool from_pool) {
     device_index_ = device_index;
     CUDAGuard guard(device_index_);
-    AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    if (from_pool) {
+      event_ = c10::cuda::getEventFromPool(device_index_);
+    } else {
+      AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    }
+    from_pool_ = from_pool;
     is_created_ = true;
   }
 
@@ -176,6 +193,7 @@ private:
     std::swap(flags_, other.flags_);
     std::swap(is_created_, other.is_created_);
     std::swap(was_recorded_, other.was_recorded_);
+    std::swap(from_pool_, other.from_pool_);
     std::swap(device_index_, other.device_index_);
     std::swap(event_, other.event_);
   }
@@ -0,0 +1,115 @@
+#include <ATen/cuda/detail/LazyCuFFT.h>
+
+#include <ATen/DynamicLibrary.h>
+#include <c10/macros/Macros.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace at {
+namespace cuda {
+namespace detail {
+
+#if defined(AT_CUFFT_LAZY_LOAD)
+
+// See NOTE [ Lazy loading of cuFFT ] in LazyCuFFT.h. Each stub resolves its
+// symbol on first call, patches the corresponding lazyCuFFT member so later
+// calls skip the lookup, and then forwards the call.
+namespace _stubs {
+
+at::DynamicLibrary& getCUFFTLibrary() {
+#if defined(_WIN32)
+  static std::string libname =
+      std::string("cufft64_") + std::to_string(CUFFT_VER_MAJOR) + ".dll";
+  static at::DynamicLibrary lib(libname.c_str());
+#else
+  static std::string libname =
+      std::string("libcufft.so.") + std::to_string(CUFFT_VER_MAJOR);
+  static at::DynamicLibrary lib(libname.c_str(), "libcufft.so");
+#endif
+  return lib;
+}
+
+#define _CUFFT_STUB(NAME, PARAMS, ARGS)                                      \
+  cufftResult NAME PARAMS {                                                  \
+    auto fn =                                                                \
+        reinterpret_cast<decltype(&NAME)>(getCUFFTLibrary().sym(__func__));  \
+    if (!fn)                                                                 \
+      throw std::runtime_error("Can't get " C10_STRINGIZE(NAME));            \
+    lazyCuFFT.NAME = fn;                                                     \
+    return fn ARGS;                                                          \
+  }
+
+_CUFFT_STUB(cufftCreate, (cufftHandle* plan), (plan))
+_CUFFT_STUB(cufftDestroy, (cufftHandle plan), (plan))
+_CUFFT_STUB(
+    cufftSetAutoAllocation,
+    (cufftHandle plan, int autoAllocate),
+    (plan, autoAllocate))
+_CUFFT_STUB(
+    cufftSetStream,
+    (cufftHandle plan, cudaStream_t stream),
+    (plan, stream))
+_CUFFT_STUB(
+    cufftSetWorkArea,
+    (cufftHandle plan, void* workArea),
+    (plan, workArea))
+_CUFFT_STUB(
+    cufftXtMakePlanMany,
+    (cufftHandle plan,
+     int rank,
+     long long int* n,
+     long long int* inembed,
+     long long int istride,
+     long long int idist,
+     cudaDataType inputtype,
+     long long int* onembed,
+     long long int ostride,
+     long long int odist,
+     cudaDataType outputtype,
+     long long int batch,
+     size_t* workSize,
+     cudaDataType executiontype),
+    (plan,
+     rank,
+     n,
+     inembed,
+     istride,
+     idist,
+     inputtype,
+     onembed,
+     ostride,
+     odist,
+     outputtype,
+     batch,
+     workSize,
+     executiontype))
+_CUFFT_STUB(
+    cufftXtExec,
+    (cufftHandle plan, void* input, void* output, int direction),
+    (plan, input, output, direction))
+
+#undef _CUFFT_STUB
+
+} // namespace _stubs
+
+CuFFT lazyCuFFT = {
+#define _REFERENCE_MEMBER(name) _stubs::name,
+    AT_FORALL_CUFFT(_REFERENCE_MEMBER)
+#undef _REFERENCE_MEMBER
+};
+
+#else
+
+// cuFFT is linked directly; the struct just points at the real entry points.
+CuFFT lazyCuFFT = {
+#define _REFERENCE_MEMBER(name) ::name,
+    AT_FORALL_CUFFT(_REFERENCE_MEMBER)
+#undef _REFERENCE_MEMBER
+};
+
+#endif // AT_CUFFT_LAZY_LOAD
+
+} // namespace detail
+} // namespace cuda
+} // namespace at
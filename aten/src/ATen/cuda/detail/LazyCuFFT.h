@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ATen/cuda/ATenCUDAGeneral.h>
+#include <cufft.h>
+#include <cufftXt.h>
+
+// NOTE [ Lazy loading of cuFFT ]
+//
+// ATen only calls the handful of cuFFT entry points listed below. When the
+// build sets AT_CUFFT_LAZY_LOAD (USE_LAZY_CUFFT=ON), libcufft is not linked
+// at all; the members of lazyCuFFT start out as trampolines that dlopen the
+// library and resolve the real symbol on first call, then patch themselves so
+// subsequent calls go straight through. Processes that never run an FFT then
+// never pay the cost of mapping the library at startup. Without the flag (and
+// always when CUDA libraries are linked statically) the members simply point
+// at the directly linked functions.
+//
+// If a new cuFFT function is needed, add it to this list and route the call
+// through at::cuda::detail::lazyCuFFT.
+
+#if defined(__HIP_PLATFORM_HCC__)
+// The plan-construction and execution paths have explicit HIP branches that
+// call hipfft directly, so only the shared entry points go through the
+// struct; hipfft is always linked directly.
+#define AT_FORALL_CUFFT(_)  \
+  _(cufftCreate)            \
+  _(cufftSetAutoAllocation) \
+  _(cufftSetStream)         \
+  _(cufftSetWorkArea)
+#else
+#define AT_FORALL_CUFFT(_)  \
+  _(cufftCreate)            \
+  _(cufftDestroy)           \
+  _(cufftSetAutoAllocation) \
+  _(cufftSetStream)         \
+  _(cufftSetWorkArea)       \
+  _(cufftXtMakePlanMany)    \
+  _(cufftXtExec)
+#endif
+
+namespace at { namespace cuda {
+
+struct CuFFT {
+#define CREATE_MEMBER(name) decltype(&::name) name;
+  AT_FORALL_CUFFT(CREATE_MEMBER)
+#undef CREATE_MEMBER
+};
+
+namespace detail {
+extern CuFFT lazyCuFFT;
+} // namespace detail
+
+}} // namespace at::cuda
@@ -43,6 +43,71 @@ const input_t* cus_lower_bound(const input_t* start, const input_t* end, input_t
   return start;
 }
 
+// Advance predicates shared by the branchless searches below. They mirror
+// cus_lower_bound / std::upper_bound, including sending 'nan', 'inf' etc. to
+// the end of the boundaries.
+template<bool right, typename input_t>
+inline bool bd_advances(input_t bd_val, input_t val) {
+  return right ? !(val < bd_val) : !(bd_val >= val);
+}
+
+// Branchless search over one shared boundary row: every value walks the same
+// fixed-depth halving ladder (the schedule only depends on the row length and
+// is computed once per call), and the data-dependent branch of the classic
+// binary search becomes a conditional add. Values are processed in small
+// batches of independent searches so the loads can overlap instead of
+// serializing on every probe.
+template<bool right, typename input_t, typename output_t>
+void searchsorted_ladder(
+    const input_t* data_bd,
+    int64_t idim_bd,
+    const input_t* data_in,
+    output_t* data_out,
+    int64_t n) {
+  // Halving schedule: probing pos + halves[d] - 1 with len -= halves[d] stays
+  // within the row for any row length, padded or not.
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  int64_t halves[64];
+  int64_t depth = 0;
+  for (int64_t len = idim_bd; len > 1; len -= len >> 1) {
+    halves[depth++] = len >> 1;
+  }
+
+  constexpr int64_t kBatch = 16;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  int64_t pos[kBatch];
+  int64_t i = 0;
+  for (; i + kBatch <= n; i += kBatch) {
+    for (int64_t l = 0; l < kBatch; ++l) {
+      pos[l] = 0;
+    }
+    for (int64_t d = 0; d < depth; ++d) {
+      const int64_t half = halves[d];
+      for (int64_t l = 0; l < kBatch; ++l) {
+        pos[l] += static_cast<int64_t>(bd_advances<right>(
+                      data_bd[pos[l] + half - 1], data_in[i + l])) *
+            half;
+      }
+    }
+    for (int64_t l = 0; l < kBatch; ++l) {
+      // type conversion might happen here
+      data_out[i + l] = pos[l] +
+          static_cast<int64_t>(
+              bd_advances<right>(data_bd[pos[l]], data_in[i + l]));
+    }
+  }
+  for (; i < n; ++i) {
+    int64_t p = 0;
+    for (int64_t d = 0; d < depth; ++d) {
+      p += static_cast<int64_t>(
+               bd_advances<right>(data_bd[p + halves[d] - 1], data_in[i])) *
+          halves[d];
+    }
+    data_out[i] =
+        p + static_cast<int64_t>(bd_advances<right>(data_bd[p], data_in[i]));
+  }
+}
+
 template<typename input_t, typename output_t>
 void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tensor& boundaries, const bool& right) {
   int64_t numel_in = input.numel();
@@ -56,6 +121,21 @@ void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tens
   output_t *data_out = result.data_ptr<output_t>();
 
   bool is_1d_boundaries = boundaries.dim() == 1;
+  if (is_1d_boundaries && idim_bd > 0) {
+    // One boundary row shared by all values (the bucketize case): use the
+    // branchless fixed-depth ladder.
+    at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+      if (right) {
+        searchsorted_ladder<true>(
+            data_bd, idim_bd, data_in + start, data_out + start, end - start);
+      }
+      else {
+        searchsorted_ladder<false>(
+            data_bd, idim_bd, data_in + start, data_out + start, end - start);
+      }
+    });
+    return;
+  }
   at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
     for (int64_t i = start; i < end; ++i) {
       // If boundaries tensor is 1d, we always search the entire boundary tensor
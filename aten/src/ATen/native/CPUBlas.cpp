@@ -1,6 +1,8 @@
 #include <ATen/native/CPUBlas.h>
 #include <ATen/Config.h>
 
+#include <c10/util/irange.h>
+
 #include <climits>
 
 #if AT_BUILD_WITH_BLAS()
@@ -59,6 +61,17 @@ void normalize_last_dims(
 
 namespace {
 
+// Below this many multiply-accumulates, the fixed overhead of a library
+// gemm call exceeds the arithmetic, so the hand-tiled microkernels in
+// BlasKernel.cpp are faster. 32^3 comfortably covers the single-step
+// decoding shapes this path is aimed at while staying far below sizes
+// where a tuned library kernel wins.
+constexpr int64_t kSmallGemmThreshold = 32 * 32 * 32;
+
+bool use_small_gemm(int64_t m, int64_t n, int64_t k) {
+  return m > 0 && n > 0 && k > 0 && m * n * k <= kSmallGemmThreshold;
+}
+
 bool use_blas_gemm(
     TransposeType transa, TransposeType transb,
     int64_t m, int64_t n, int64_t k,
@@ -99,6 +112,8 @@ fbgemm::matrix_op_t to_fbgemm(TransposeType trans) {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(gemm_stub);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(gemm_small_stub);
 
 void gemm(
     TransposeType transa, TransposeType transb,
@@ -109,6 +124,12 @@ void gemm(
     const double beta,
     double *c, int64_t ldc) {
   internal::normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  if (use_small_gemm(m, n, k)) {
+    gemm_small_stub(
+        at::kCPU, at::kDouble,
+        transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
 #if AT_BUILD_WITH_BLAS()
   if (use_blas_gemm(transa, transb, m, n, k, lda, ldb, ldc)) {
     int m_ = m, n_ = n, k_ = k, lda_ = lda, ldb_ = ldb, ldc_ = ldc;
@@ -139,6 +160,12 @@ void gemm(
     const float beta,
     float *c, int64_t ldc) {
   internal::normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  if (use_small_gemm(m, n, k)) {
+    gemm_small_stub(
+        at::kCPU, at::kFloat,
+        transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
 #if AT_BUILD_WITH_BLAS()
   if (use_blas_gemm(transa, transb, m, n, k, lda, ldb, ldc)) {
     int m_ = m, n_ = n, k_ = k, lda_ = lda, ldb_ = ldb, ldc_ = ldc;
@@ -433,4 +460,60 @@ void copy(int64_t n, const c10::complex<float> *x, int64_t incx, c10::complex<fl
       n, x, incx, y, incy);
 }
 
+namespace {
+
+template <typename scalar_t>
+void gemm_batched_impl(
+    at::ScalarType type,
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t * const *a, int64_t lda,
+    const scalar_t * const *b, int64_t ldb,
+    scalar_t beta,
+    scalar_t * const *c, int64_t ldc) {
+  internal::normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  if (use_small_gemm(m, n, k)) {
+    // Route the whole batch to the microkernel directly: the threshold and
+    // dispatch decision is made once instead of once per matrix.
+    for (const auto i : c10::irange(batch_size)) {
+      gemm_small_stub(
+          at::kCPU, type,
+          transa, transb, m, n, k, alpha, a[i], lda, b[i], ldb, beta, c[i], ldc);
+    }
+    return;
+  }
+  for (const auto i : c10::irange(batch_size)) {
+    gemm(transa, transb, m, n, k, alpha, a[i], lda, b[i], ldb, beta, c[i], ldc);
+  }
+}
+
+}  // namespace (anonymous)
+
+void gemm_batched(
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    double alpha,
+    const double * const *a, int64_t lda,
+    const double * const *b, int64_t ldb,
+    double beta,
+    double * const *c, int64_t ldc) {
+  gemm_batched_impl(
+      at::kDouble, transa, transb, batch_size, m, n, k,
+      alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm_batched(
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    float alpha,
+    const float * const *a, int64_t lda,
+    const float * const *b, int64_t ldb,
+    float beta,
+    float * const *c, int64_t ldc) {
+  gemm_batched_impl(
+      at::kFloat, transa, transb, batch_size, m, n, k,
+      alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
 }}}  // namespace at::native::cpublas
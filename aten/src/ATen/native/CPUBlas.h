@@ -34,6 +34,11 @@ using gemm_fn = void(*)(
 
 DECLARE_DISPATCH(gemm_fn, gemm_stub);
 
+// Hand-tiled microkernels for problems small enough that the fixed call
+// overhead of a BLAS library dominates the flops. Only registered for
+// float and double; selected by a size threshold inside cpublas::gemm.
+DECLARE_DISPATCH(gemm_fn, gemm_small_stub);
+
 template <typename scalar_t>
 void gemm(
     TransposeType transa, TransposeType transb,
@@ -94,6 +99,27 @@ void gemm(
     int64_t beta,
     int64_t *c, int64_t ldc);
 
+// Multiplies `batch_size` independent matrix pairs that share their
+// dimensions and strides. The small-gemm routing decision is made once for
+// the whole batch, so the per-call setup overhead is amortized across it.
+void gemm_batched(
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    double alpha,
+    const double * const *a, int64_t lda,
+    const double * const *b, int64_t ldb,
+    double beta,
+    double * const *c, int64_t ldc);
+
+void gemm_batched(
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    float alpha,
+    const float * const *a, int64_t lda,
+    const float * const *b, int64_t ldb,
+    float beta,
+    float * const *c, int64_t ldc);
+
 using axpy_fn = void(*)(at::ScalarType type, int64_t n, const Scalar& a, const void *x, int64_t incx, void *y, int64_t incy);
 
 DECLARE_DISPATCH(axpy_fn, axpy_stub);
@@ -12,7 +12,13 @@
 #include <ATen/Config.h>
 #include <c10/macros/Macros.h>
 
+#include <ATen/core/grad_mode.h>
+
+#include <chrono>
 #include <limits>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 
 #if AT_NNPACK_ENABLED()
 #include <nnpack.h>
@@ -25,6 +31,8 @@ namespace at { namespace native {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(convolution_depthwise5x5_stub);
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 struct ConvParams {
@@ -48,6 +56,7 @@ struct ConvParams {
   bool is_stride_nonpos() const;
   void view1d_as_2d();
   bool use_cpu_depthwise3x3_winograd(const at::Tensor& input, const at::Tensor& weight, const at::Tensor& bias) const;
+  bool use_cpu_depthwise5x5(const at::Tensor& input, const at::Tensor& weight, const at::Tensor& bias) const;
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn_depthwise(const at::Tensor& input, const at::Tensor& weight) const;
@@ -180,6 +189,42 @@ auto ConvParams::use_cpu_depthwise3x3_winograd(
 #endif
 }
 
+auto ConvParams::use_cpu_depthwise5x5(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias) const -> bool {
+#if defined(__ARM_NEON__)
+  // Direct 5x5 depthwise convolutions on float tensors, stride 1 or 2.
+  return (input.ndimension() == 4) &&
+         (input.size(1) == groups) &&
+         (weight.ndimension() == 4 ) &&
+         (weight.size(0) % input.size(1) == 0) &&
+         (weight.size(1) == 1) &&
+         (weight.size(2) == 5) &&
+         (weight.size(3) == 5) &&
+         (input.device().is_cpu()) &&
+         (input.scalar_type() == at::kFloat) &&
+         input.is_contiguous() &&
+         (weight.device().is_cpu()) &&
+         (weight.scalar_type() == at::kFloat) &&
+         weight.is_contiguous() &&
+         (!bias.defined() ||
+            ((bias.device().is_cpu()) &&
+             (bias.scalar_type() == at::kFloat))) &&
+         (stride[0] == stride[1]) &&
+         (stride[0] == 1 || stride[0] == 2) &&
+         !is_dilated() &&
+         // 5x5 depthwise convolution implementation is inference only
+         !(GradMode::is_enabled() &&
+                 (input.requires_grad() ||
+                  weight.requires_grad() ||
+                 (bias.defined() && bias.requires_grad()))) &&
+         !transposed;
+#else
+  return false;
+#endif
+}
+
 auto ConvParams::needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const -> bool {
   constexpr int64_t int_max = std::numeric_limits<int>::max();
   int64_t numel_input = input.numel();
@@ -821,6 +866,200 @@ at::Tensor convolution_overrideable(
   TORCH_CHECK_NOT_IMPLEMENTED(false, "convolution_overrideable not implemented. You are likely triggering this with tensor backend other than CPU/CUDA/MKLDNN, if this is intended, please use TORCH_LIBRARY_IMPL to override this function ");
 }
 
+// CPU convolution benchmark mode (see Context::benchmarkCPU). The hard-coded
+// backend heuristics in _convolution can be far from optimal for a given
+// shape, so when the flag is set we time every eligible CPU backend once per
+// (shape, dtype, layout, conv params) signature and reuse the winner. The
+// cache lives for the process; a repeated workload warms it in one pass.
+enum class CpuConvBackend : int8_t {
+  Mkldnn,
+  Xnnpack,
+  Winograd3x3,
+  Depthwise5x5,
+  Fallback,
+};
+
+static std::string cpu_conv_signature(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    const ConvParams& params) {
+  std::ostringstream oss;
+  oss << input.scalar_type() << ';' << input.suggest_memory_format() << ';';
+  for (auto s : input.sizes()) {
+    oss << s << ',';
+  }
+  oss << ';';
+  for (auto s : weight.sizes()) {
+    oss << s << ',';
+  }
+  oss << ';' << bias.defined() << ';';
+  for (auto s : params.stride) {
+    oss << s << ',';
+  }
+  oss << ';';
+  for (auto s : params.padding) {
+    oss << s << ',';
+  }
+  oss << ';';
+  for (auto s : params.dilation) {
+    oss << s << ',';
+  }
+  oss << ';' << params.groups;
+  return oss.str();
+}
+
+static at::Tensor run_cpu_conv_backend(
+    CpuConvBackend backend,
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    const ConvParams& params) {
+  switch (backend) {
+    case CpuConvBackend::Mkldnn:
+#if AT_MKLDNN_ENABLED()
+      return at::mkldnn_convolution(
+          input.contiguous(), weight.contiguous(),
+          bias.defined() ? bias.contiguous() : bias,
+          params.padding, params.stride, params.dilation, params.groups);
+#else
+      TORCH_INTERNAL_ASSERT(false, "mkldnn backend selected without MKLDNN support");
+#endif
+    case CpuConvBackend::Xnnpack:
+      return xnnpack::convolution2d(
+          input, weight, bias,
+          params.padding, params.stride, params.dilation, params.groups);
+    case CpuConvBackend::Winograd3x3:
+      return convolution_depthwise3x3_winograd_stub(
+          input.device().type(),
+          input, weight, bias, params.stride, params.padding, params.groups);
+    case CpuConvBackend::Depthwise5x5:
+      return convolution_depthwise5x5_stub(
+          input.device().type(),
+          input, weight, bias, params.stride, params.padding, params.groups);
+    case CpuConvBackend::Fallback:
+      break;
+  }
+  // Mirrors the trailing (non-specialized) branches of _convolution.
+  if (params.is_depthwise(input, weight)) {
+    auto kernel_size = weight.sizes().slice(2);
+    if (input.ndimension() == 4) {
+      return at::thnn_conv_depthwise2d(
+          input.contiguous(), weight, kernel_size, bias,
+          params.stride, params.padding, params.dilation);
+    }
+    TORCH_CHECK(input.ndimension() == 5);
+    return at::conv_depthwise3d(
+        input.contiguous(), weight, kernel_size, bias,
+        params.stride, params.padding, params.dilation);
+  }
+  if (input.ndimension() == 5 && !params.is_dilated()) {
+    return at::slow_conv3d(
+        input, weight, weight.sizes().slice(2), bias,
+        params.stride, params.padding);
+  }
+  if (params.groups == 1) {
+    return at::_convolution_nogroup(
+        input.contiguous(), weight, bias, params.stride, params.padding,
+        params.dilation, params.transposed, params.output_padding);
+  }
+  std::vector<at::Tensor> outputs(params.groups);
+  auto input_c = input.contiguous();
+  auto weight_c = weight;
+  auto bias_c = bias;
+  for (int g = 0; g < params.groups; ++g) {
+    auto input_g = subtensor(input_c, 1, params.groups, g);
+    auto weight_g = subtensor(weight_c, 0, params.groups, g);
+    auto bias_g = subtensor(bias_c, 0, params.groups, g);
+    outputs[g] = at::_convolution_nogroup(
+        input_g, weight_g, bias_g, params.stride, params.padding,
+        params.dilation, params.transposed, params.output_padding);
+  }
+  return at::cat(outputs, 1);
+}
+
+static std::vector<CpuConvBackend> cpu_conv_candidates(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    const ConvParams& params) {
+  std::vector<CpuConvBackend> candidates;
+  if (params.use_mkldnn(input, weight)) {
+    candidates.push_back(CpuConvBackend::Mkldnn);
+  }
+  if (params.use_xnnpack(input, weight, bias)) {
+    candidates.push_back(CpuConvBackend::Xnnpack);
+  }
+  if (params.use_cpu_depthwise3x3_winograd(input, weight, bias)) {
+    candidates.push_back(CpuConvBackend::Winograd3x3);
+  }
+  if (params.use_cpu_depthwise5x5(input, weight, bias)) {
+    candidates.push_back(CpuConvBackend::Depthwise5x5);
+  }
+  candidates.push_back(CpuConvBackend::Fallback);
+  return candidates;
+}
+
+static CpuConvBackend pick_cpu_conv_backend(
+    const std::vector<CpuConvBackend>& candidates,
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    const ConvParams& params) {
+  // Keep autograd out of the timing runs; the winner is re-run normally.
+  at::NoGradGuard no_grad;
+  CpuConvBackend best = candidates[0];
+  double best_time = std::numeric_limits<double>::infinity();
+  for (auto candidate : candidates) {
+    // The first call may pay one-time setup (weight reordering, thread pool
+    // spin-up); warm up once and time the second run.
+    run_cpu_conv_backend(candidate, input, weight, bias, params);
+    const auto start = std::chrono::steady_clock::now();
+    run_cpu_conv_backend(candidate, input, weight, bias, params);
+    const double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count();
+    if (elapsed < best_time) {
+      best_time = elapsed;
+      best = candidate;
+    }
+  }
+  return best;
+}
+
+static at::Tensor benchmark_cpu_convolution(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    const ConvParams& params) {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::mutex cache_mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::unordered_map<std::string, CpuConvBackend> cache;
+
+  auto candidates = cpu_conv_candidates(input, weight, bias, params);
+  if (candidates.size() == 1) {
+    return run_cpu_conv_backend(candidates[0], input, weight, bias, params);
+  }
+  const std::string signature = cpu_conv_signature(input, weight, bias, params);
+  c10::optional<CpuConvBackend> winner;
+  {
+    std::lock_guard<std::mutex> guard(cache_mutex);
+    auto it = cache.find(signature);
+    if (it != cache.end()) {
+      winner = it->second;
+    }
+  }
+  if (!winner.has_value()) {
+    // The mutex is not held while timing; concurrent first encounters may
+    // both benchmark and the last writer wins, which is harmless.
+    winner = pick_cpu_conv_backend(candidates, input, weight, bias, params);
+    std::lock_guard<std::mutex> guard(cache_mutex);
+    cache.emplace(signature, *winner);
+  }
+  return run_cpu_conv_backend(*winner, input, weight, bias, params);
+}
+
 at::Tensor _convolution(
     const Tensor& input_r, const Tensor& weight_r, const c10::optional<Tensor>& bias_r_opt,
     IntArrayRef stride_, IntArrayRef padding_, IntArrayRef dilation_,
@@ -899,6 +1138,17 @@ at::Tensor _convolution(
     cudnn_memory_format = (k == 5) ? at::MemoryFormat::ChannelsLast3d : at::MemoryFormat::ChannelsLast;
   }
 
+  // Benchmark-driven CPU backend selection; see benchmark_cpu_convolution.
+  if (at::globalContext().benchmarkCPU() && input.device().is_cpu() &&
+      !input_is_mkldnn && !params.transposed &&
+      (input.scalar_type() == kFloat || input.scalar_type() == kDouble)) {
+    Tensor output = benchmark_cpu_convolution(input, weight, bias, params);
+    if (k == 3) {
+      output = view3d(output);
+    }
+    return output;
+  }
+
   Tensor output;
   if (params.is_depthwise(input, weight)) {
       /* output.resize_(output_size(input, weight)); */
@@ -1007,6 +1257,15 @@ at::Tensor _convolution(
         params.stride,
         params.padding,
         params.groups);
+  } else if (params.use_cpu_depthwise5x5(input, weight, bias)) {
+    output = convolution_depthwise5x5_stub(
+        input.device().type(),
+        input,
+        weight,
+        bias,
+        params.stride,
+        params.padding,
+        params.groups);
   } else if (
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
         !params.transposed && (input.ndimension() == 5) &&
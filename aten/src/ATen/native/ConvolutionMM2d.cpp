@@ -197,6 +197,95 @@ static void slow_conv2d_update_output_frame(
   }
 }
 
+// target size for the per-strip column buffer; a strip of output rows is
+// unfolded and multiplied at a time so the columns stay roughly L2-resident
+constexpr int64_t kMaxColumnWorkspaceBytes = 256 * 1024;
+
+// Per-thread im2col workspace, allocated lazily and reused across frames and
+// calls (the threads of the intra-op pool are long lived). It only ever grows.
+static Tensor& conv2d_columns_workspace(int64_t min_bytes) {
+  thread_local Tensor workspace;
+  if (!workspace.defined() || workspace.numel() < min_bytes) {
+    workspace = at::empty({min_bytes}, at::device(kCPU).dtype(kByte));
+  }
+  return workspace;
+}
+
+// Computes one output frame without materializing the frame's full im2col
+// buffer: output rows are processed in strips, each strip unfolded into the
+// per-thread workspace and multiplied immediately, fusing the GEMM per strip.
+// Shifting the base input pointer by the strip's first input row moves every
+// channel by the same amount, since the unfold kernel strides channels by the
+// full input_height * input_width; that trick requires pad_height == 0, so
+// with height padding the frame is processed as a single strip (still reusing
+// the workspace instead of a per-call allocation).
+static void slow_conv2d_blocked_output_frame(
+    const Tensor& input_frame,
+    Tensor& output_frame,
+    const Tensor& weight,
+    const Tensor& bias,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t stride_height,
+    int64_t stride_width,
+    int64_t pad_height,
+    int64_t pad_width,
+    int64_t n_input_plane,
+    int64_t input_height,
+    int64_t input_width,
+    int64_t n_output_plane,
+    int64_t output_height,
+    int64_t output_width) {
+  const int64_t kernel_numel = n_input_plane * kernel_height * kernel_width;
+  const int64_t element_size = input_frame.element_size();
+  int64_t strip_rows = output_height;
+  if (pad_height == 0 && output_height > 0) {
+    const int64_t row_bytes = kernel_numel * output_width * element_size;
+    strip_rows = std::max<int64_t>(
+        1, kMaxColumnWorkspaceBytes / std::max<int64_t>(row_bytes, 1));
+    strip_rows = std::min(strip_rows, output_height);
+  }
+  Tensor workspace = conv2d_columns_workspace(
+      kernel_numel * strip_rows * output_width * element_size);
+
+  auto output2d =
+      output_frame.reshape({n_output_plane, output_height * output_width});
+  if (bias.defined()) {
+    output_frame.copy_(bias.unsqueeze(-1).unsqueeze(-1));
+  }
+
+  Tensor frame_flat =
+      input_frame.view({n_input_plane * input_height * input_width});
+  for (int64_t row = 0; row < output_height; row += strip_rows) {
+    const int64_t rows = std::min(strip_rows, output_height - row);
+    Tensor columns = at::from_blob(
+        workspace.data_ptr(),
+        {kernel_numel, rows * output_width},
+        input_frame.options());
+    const int64_t offset = row * stride_height * input_width;
+    Tensor input_strip =
+        frame_flat.narrow(0, offset, frame_flat.size(0) - offset);
+    unfolded2d_copy_stub(
+        kCPU,
+        columns,
+        input_strip,
+        kernel_height,
+        kernel_width,
+        stride_height,
+        stride_width,
+        pad_height,
+        pad_width,
+        n_input_plane,
+        input_height,
+        input_width,
+        rows,
+        output_width);
+    auto output_strip =
+        output2d.narrow(1, row * output_width, rows * output_width);
+    output_strip.addmm_(weight, columns, bias.defined() ? 1 : 0, 1);
+  }
+}
+
 void slow_conv2d_backward_update_grad_input_frame(
     Tensor& grad_input,
     const Tensor& grad_output,
@@ -436,8 +525,48 @@ std::tuple<Tensor&, Tensor&, Tensor&> slow_conv2d_forward_out_cpu(const Tensor&
 
   const int64_t batch_size = input.size(0);
 
-  if ((input.ndimension() == 4) && (kernel_height == 1) && (stride_height == 1) && (pad_height == 0) &&
-      (kernel_width == 1) && (stride_width == 1) && (pad_width == 0)) {
+  const bool is_1x1 = (kernel_height == 1) && (stride_height == 1) &&
+      (pad_height == 0) && (kernel_width == 1) && (stride_width == 1) &&
+      (pad_width == 0);
+  // The full finput buffer is only an output so the backward can reuse it;
+  // when no gradient will flow it is batch_size * k * output_height *
+  // output_width of pure transient, so take the blocked route instead and
+  // leave finput empty.
+  const bool finput_needed = at::GradMode::is_enabled() &&
+      (input.requires_grad() || weight_.requires_grad() ||
+       (bias.defined() && bias.requires_grad()));
+  if (!is_1x1 && !finput_needed) {
+    finput.resize_({0});
+    output.resize_({batch_size, n_output_plane, output_height, output_width});
+    at::parallel_for(0, batch_size, 0, [&](int64_t start, int64_t end) {
+      NoGradGuard no_grad;
+      AutoDispatchBelowInplaceOrView non_variable_type_mode;
+      for (int64_t t = start; t < end; t++) {
+        Tensor input_t = input[t];
+        Tensor output_t = output[t];
+        slow_conv2d_blocked_output_frame(
+            input_t,
+            output_t,
+            weight_2d,
+            bias,
+            kernel_height,
+            kernel_width,
+            stride_height,
+            stride_width,
+            pad_height,
+            pad_width,
+            n_input_plane,
+            input_height,
+            input_width,
+            n_output_plane,
+            output_height,
+            output_width);
+      }
+    });
+    return std::tuple<Tensor&, Tensor&, Tensor&>(output, finput, fgrad_input);
+  }
+
+  if (is_1x1) {
     finput =
         input.view({batch_size, n_input_plane, output_height * output_width})
             .detach();
@@ -43,46 +43,52 @@ void copy_same_type_transpose_(Tensor& self, const Tensor& src) {
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
     BLOCK_SZ = 60;
   }
-  Tensor buf = empty({BLOCK_SZ, BLOCK_SZ}, self.options());
-
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(kHalf, kBool, kBFloat16, self.scalar_type(), "copy_", [&] {
     scalar_t* sp = src.data_ptr<scalar_t>();
     scalar_t* rp = self.data_ptr<scalar_t>();
-    scalar_t* bp = buf.data_ptr<scalar_t>();
 
     int64_t NR = src.size(0);
     int64_t NC = src.size(1);
-    for (int64_t R = 0; R < NR; R += BLOCK_SZ) {
-      for (int64_t C = 0; C < NC; C += BLOCK_SZ) {
-        scalar_t* spo = sp + R + C * NR;
-        scalar_t* rpo = rp + C + R * NC;
-
-        int nr = std::min(NR - R, BLOCK_SZ);
-        int nc = std::min(NC - C, BLOCK_SZ);
-
-        // 1. copy columns from src to buf
-        for (int c = 0; c < nc; c++) {
-          memcpy(bp + c * BLOCK_SZ, spo + c * NR, nr * sizeof(scalar_t));
-        }
+    const int64_t num_tile_rows = (NR + BLOCK_SZ - 1) / BLOCK_SZ;
+    // Tiles are independent, so parallelize over rows of tiles. Each task
+    // keeps its own scratch tile so threads never share a buffer; one
+    // BLOCK_SZ^2 tile stays comfortably inside the private caches.
+    at::parallel_for(0, num_tile_rows, 1, [&](int64_t tile_begin, int64_t tile_end) {
+      std::vector<scalar_t> buf(BLOCK_SZ * BLOCK_SZ);
+      scalar_t* bp = buf.data();
+      for (int64_t Rt = tile_begin; Rt < tile_end; ++Rt) {
+        const int64_t R = Rt * BLOCK_SZ;
+        for (int64_t C = 0; C < NC; C += BLOCK_SZ) {
+          scalar_t* spo = sp + R + C * NR;
+          scalar_t* rpo = rp + C + R * NC;
+
+          int nr = std::min(NR - R, BLOCK_SZ);
+          int nc = std::min(NC - C, BLOCK_SZ);
+
+          // 1. copy columns from src to buf
+          for (int c = 0; c < nc; c++) {
+            memcpy(bp + c * BLOCK_SZ, spo + c * NR, nr * sizeof(scalar_t));
+          }
 
-        // 2. transpose buf in place
-        int rc_max = std::max(nr, nc);
-        int rc_min = std::min(nr, nc);
-        for (int r = 0; r < rc_max; r++) {
-          int end = std::min(r, rc_min);
-          for (int c = 0; c < end; c++) {
-            scalar_t tmp = bp[r + BLOCK_SZ * c];
-            bp[r + BLOCK_SZ * c] = bp[r * BLOCK_SZ + c];
-            bp[r * BLOCK_SZ + c] = tmp;
+          // 2. transpose buf in place
+          int rc_max = std::max(nr, nc);
+          int rc_min = std::min(nr, nc);
+          for (int r = 0; r < rc_max; r++) {
+            int end = std::min(r, rc_min);
+            for (int c = 0; c < end; c++) {
+              scalar_t tmp = bp[r + BLOCK_SZ * c];
+              bp[r + BLOCK_SZ * c] = bp[r * BLOCK_SZ + c];
+              bp[r * BLOCK_SZ + c] = tmp;
+            }
           }
-        }
 
-        // 3. copy rows from buf to dst
-        for (int r = 0; r < nr; r++) {
-          memcpy(rpo + r * NC, bp + r * BLOCK_SZ, nc * sizeof(scalar_t));
+          // 3. copy rows from buf to dst
+          for (int r = 0; r < nr; r++) {
+            memcpy(rpo + r * NC, bp + r * BLOCK_SZ, nc * sizeof(scalar_t));
+          }
         }
       }
-    }
+    });
   });
 }
 
@@ -211,6 +217,40 @@ static Tensor & copy_impl(Tensor & self, const Tensor & src, bool non_blocking)
     return at::metal::metal_copy_(self, src);
   }
 
+  // Large same-dtype contiguous CPU copies are pure byte moves, but funneled
+  // through a single thread they are limited to one core's share of memory
+  // bandwidth. Split them across the intra-op pool in page-aligned chunks:
+  // each page is then written by exactly one thread, and because the chunk
+  // partitioning is deterministic, repeated copies between buffers that were
+  // first-touched by the same pool keep the traffic NUMA-local. (Explicit
+  // placement of chunks on the node owning the pages would require querying
+  // and pinning per-thread affinity, which the pool does not expose.)
+  constexpr int64_t kParallelCopyThresholdBytes = int64_t(1) << 22;
+  if (self.device().is_cpu() && src.device().is_cpu() &&
+      !self.is_quantized() && !src.is_quantized() &&
+      self.scalar_type() == src.scalar_type() &&
+      self.is_contiguous() && src.is_contiguous() &&
+      self.sizes().equals(src.sizes()) &&
+      at::get_num_threads() > 1) {
+    const int64_t nbytes = self.numel() * static_cast<int64_t>(self.element_size());
+    if (nbytes >= kParallelCopyThresholdBytes) {
+      char* dst = static_cast<char*>(self.data_ptr());
+      const char* from = static_cast<const char*>(src.data_ptr());
+      if (dst == from) {
+        return self;
+      }
+      assert_no_partial_overlap(self, src);
+      constexpr int64_t kPageBytes = 4096;
+      const int64_t pages = (nbytes + kPageBytes - 1) / kPageBytes;
+      at::parallel_for(0, pages, 1, [&](int64_t begin, int64_t end) {
+        const int64_t offset = begin * kPageBytes;
+        const int64_t length = std::min(end * kPageBytes, nbytes) - offset;
+        std::memcpy(dst + offset, from + offset, length);
+      });
+      return self;
+    }
+  }
+
   auto iter = TensorIteratorConfig()
     .add_output(self)
     .add_input(src)
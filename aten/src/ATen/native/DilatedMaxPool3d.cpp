@@ -197,6 +197,27 @@ void max_pool3d_with_indices_out_cpu_template(
     itime, iheight, iwidth,
     otime, oheight, owidth);
 
+  /* channels last: vectorized kernel over the channels dimension */
+  if (input_.ndimension() == 5 &&
+      input_.suggest_memory_format() == at::MemoryFormat::ChannelsLast3d) {
+    const int64_t nbatch = input_.size(0);
+    Tensor input = input_.contiguous(at::MemoryFormat::ChannelsLast3d);
+
+    output.resize_({nbatch, nslices, otime, oheight, owidth},
+      at::MemoryFormat::ChannelsLast3d);
+    /* indices will contain ti,i,j locations for each output point */
+    indices.resize_({nbatch, nslices, otime, oheight, owidth},
+      at::MemoryFormat::ChannelsLast3d);
+
+    max_pool3d_kernel(
+      kCPU, output, indices, input,
+      kW, kH, kT,
+      dW, dH, dT,
+      pW, pH, pT,
+      dilationW, dilationH, dilationT);
+    return;
+  }
+
   /* get contiguous input */
   Tensor input = input_.contiguous();
 
@@ -392,6 +413,30 @@ Tensor& max_pool3d_with_indices_backward_out_cpu_template(
   const int64_t iheight = input.size(-2);
   const int64_t iwidth = input.size(-1);
 
+  /* channels last: vectorized kernel over the channels dimension */
+  if (input.ndimension() == 5 &&
+      input.suggest_memory_format() == at::MemoryFormat::ChannelsLast3d) {
+    Tensor gradOutput = gradOutput_.contiguous(at::MemoryFormat::ChannelsLast3d);
+
+    gradInput.resize_(input.sizes(), at::MemoryFormat::ChannelsLast3d);
+    gradInput.zero_();
+
+    max_pool3d_backward_shape_check(
+      input,
+      gradOutput,
+      indices,
+      nslices,
+      kT, kH, kW,
+      dT, dH, dW,
+      pT, pH, pW,
+      dilationT, dilationH, dilationW,
+      itime, iheight, iwidth,
+      gradOutput.size(-3), gradOutput.size(-2), gradOutput.size(-1));
+
+    max_pool3d_backward_kernel(kCPU, gradInput, gradOutput, indices);
+    return gradInput;
+  }
+
   /* get contiguous gradOutput */
   Tensor gradOutput = gradOutput_.contiguous();
 
@@ -472,6 +517,9 @@ Tensor& max_pool3d_with_indices_backward_out_cpu_template(
 
 } // namespace
 
+DEFINE_DISPATCH(max_pool3d_kernel);
+DEFINE_DISPATCH(max_pool3d_backward_kernel);
+
 std::tuple<Tensor&, Tensor&> max_pool3d_with_indices_out_cpu(const Tensor& input,
   IntArrayRef kernel_size,
   IntArrayRef stride,
@@ -1,10 +1,15 @@
 #include <ATen/native/DispatchStub.h>
 
 #include <c10/util/Exception.h>
+#include <c10/util/Type.h>
 
 #include <cpuinfo.h>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
 
 namespace at { namespace native {
 
@@ -16,6 +21,9 @@ static CPUCapability compute_cpu_capability() {
       return CPUCapability::VSX;
     }
 #else
+    if (strcmp(envar, "avx512") == 0) {
+      return CPUCapability::AVX512;
+    }
     if (strcmp(envar, "avx2") == 0) {
       return CPUCapability::AVX2;
     }
@@ -31,6 +39,14 @@ static CPUCapability compute_cpu_capability() {
 
 #if !defined(__powerpc__) && !defined(__s390x__)
   if (cpuinfo_initialize()) {
+    // The minimum AVX512 feature set we require matches the flags the AVX512
+    // kernel tier is compiled with (avx512f/bw/vl/dq), which every Skylake-SP
+    // and later server part provides.
+    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() &&
+        cpuinfo_has_x86_avx512vl() && cpuinfo_has_x86_avx512dq() &&
+        cpuinfo_has_x86_fma3()) {
+      return CPUCapability::AVX512;
+    }
     if (cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3()) {
       return CPUCapability::AVX2;
     }
@@ -51,8 +67,98 @@ CPUCapability get_cpu_capability() {
   return capability;
 }
 
+namespace {
+
+bool parse_capability(const std::string& token, CPUCapability* out) {
+#ifdef HAVE_VSX_CPU_DEFINITION
+  if (token == "vsx") {
+    *out = CPUCapability::VSX;
+    return true;
+  }
+#else
+  if (token == "avx512") {
+    *out = CPUCapability::AVX512;
+    return true;
+  }
+  if (token == "avx2") {
+    *out = CPUCapability::AVX2;
+    return true;
+  }
+  if (token == "avx") {
+    *out = CPUCapability::AVX;
+    return true;
+  }
+#endif
+  if (token == "default") {
+    *out = CPUCapability::DEFAULT;
+    return true;
+  }
+  return false;
+}
+
+// Loads the per-stub capability pins from the calibration file named by
+// ATEN_KERNEL_CALIBRATION_FILE, if any. "%m" in the path expands to the CPU
+// package name (spaces replaced with '_'), so one environment setting can
+// serve hosts with different CPU models. Lines are "<stub name> <tier>";
+// '#' starts a comment. Returns nullptr when no calibration is in effect.
+const std::unordered_map<std::string, CPUCapability>* calibration_table() {
+  static const std::unordered_map<std::string, CPUCapability>* table = []()
+      -> const std::unordered_map<std::string, CPUCapability>* {
+    auto envar = std::getenv("ATEN_KERNEL_CALIBRATION_FILE");
+    if (!envar) {
+      return nullptr;
+    }
+    std::string path(envar);
+    const auto model_pos = path.find("%m");
+    if (model_pos != std::string::npos) {
+      std::string model = "unknown";
+      if (cpuinfo_initialize() && cpuinfo_get_packages_count() > 0) {
+        model = cpuinfo_get_package(0)->name;
+        for (auto& c : model) {
+          if (c == ' ' || c == '/') {
+            c = '_';
+          }
+        }
+      }
+      path.replace(model_pos, 2, model);
+    }
+    std::ifstream file(path);
+    if (!file) {
+      TORCH_WARN("Could not open kernel calibration file: ", path);
+      return nullptr;
+    }
+    auto* entries = new std::unordered_map<std::string, CPUCapability>();
+    std::string line;
+    while (std::getline(file, line)) {
+      const auto comment = line.find('#');
+      if (comment != std::string::npos) {
+        line.resize(comment);
+      }
+      std::istringstream tokens(line);
+      std::string stub_name;
+      std::string tier;
+      if (!(tokens >> stub_name >> tier)) {
+        continue;
+      }
+      CPUCapability capability = CPUCapability::DEFAULT;
+      if (!parse_capability(tier, &capability)) {
+        TORCH_WARN(
+            "ignoring invalid capability '", tier, "' for ", stub_name,
+            " in ", path);
+        continue;
+      }
+      (*entries)[stub_name] = capability;
+    }
+    return entries;
+  }();
+  return table;
+}
+
+} // namespace
+
 void* DispatchStubImpl::get_call_ptr(
-  DeviceType device_type
+  const std::type_info& stub_type
+  , DeviceType device_type
   , void *DEFAULT
 #ifdef HAVE_AVX_CPU_DEFINITION
   , void *AVX
@@ -60,6 +166,9 @@ void* DispatchStubImpl::get_call_ptr(
 #ifdef HAVE_AVX2_CPU_DEFINITION
   , void *AVX2
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+  , void *AVX512
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
   , void *VSX
 #endif
@@ -71,13 +180,17 @@ void* DispatchStubImpl::get_call_ptr(
       auto fptr = cpu_dispatch_ptr.load(std::memory_order_relaxed);
       if (!fptr) {
         fptr = choose_cpu_impl(
-          DEFAULT
+          stub_type
+          , DEFAULT
 #ifdef HAVE_AVX_CPU_DEFINITION
           , AVX
 #endif
 #ifdef HAVE_AVX2_CPU_DEFINITION
           , AVX2
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+          , AVX512
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
           , VSX
 #endif
@@ -101,19 +214,47 @@ void* DispatchStubImpl::get_call_ptr(
 }
 
 void* DispatchStubImpl::choose_cpu_impl(
-  void *DEFAULT
+  const std::type_info& stub_type
+  , void *DEFAULT
 #ifdef HAVE_AVX_CPU_DEFINITION
   , void *AVX
 #endif
 #ifdef HAVE_AVX2_CPU_DEFINITION
   , void *AVX2
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+  , void *AVX512
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
   , void *VSX
 #endif
 ) {
   auto capability = static_cast<int>(get_cpu_capability());
   (void)capability;
+  // A calibration pin replaces the capability ladder's starting point for
+  // this stub; the measured winner may be a lower tier than the CPU
+  // supports. Pins above the supported capability cannot run and are
+  // ignored. The chosen pointer is cached by the caller, so the name lookup
+  // happens once per stub.
+  if (const auto* table = calibration_table()) {
+    const auto it = table->find(c10::demangle(stub_type.name()));
+    if (it != table->end()) {
+      const auto pinned = static_cast<int>(it->second);
+      if (pinned <= capability) {
+        capability = pinned;
+      } else {
+        TORCH_WARN(
+            "ignoring kernel calibration pin above the supported CPU "
+            "capability for ", c10::demangle(stub_type.name()));
+      }
+    }
+  }
+#ifdef HAVE_AVX512_CPU_DEFINITION
+  if (capability >= static_cast<int>(CPUCapability::AVX512)) {
+    TORCH_INTERNAL_ASSERT(AVX512, "DispatchStub: missing AVX512 kernel");
+    return AVX512;
+  }
+#endif
 #ifdef HAVE_AVX2_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX2)) {
     TORCH_INTERNAL_ASSERT(AVX2, "DispatchStub: missing AVX2 kernel");
@@ -6,6 +6,7 @@
 
 #include <type_traits>
 #include <atomic>
+#include <typeinfo>
 
 // Implements instruction set specific function dispatch.
 //
@@ -34,6 +35,18 @@
 // To call:
 //   stub(kCPU, tensor);
 //
+// Capability is not always speed: e.g. on AVX-512-throttling SKUs some AVX2
+// kernels beat their AVX512 counterparts. The selection can therefore be
+// overridden per stub with a calibration file named by the
+// ATEN_KERNEL_CALIBRATION_FILE environment variable ("%m" in the path is
+// replaced with the CPU package name, so one setting serves a heterogeneous
+// fleet). Each line pins one stub to a tier, e.g.:
+//   at::native::add_stub avx2
+// Stub names are the demangled names of the DECLARE_DISPATCH structs; pins
+// above the capability cpuinfo reports are ignored with a warning. The file
+// is typically produced by timing a representative workload once per tier
+// (forced via ATEN_CPU_CAPABILITY) and recording the winners.
+//
 // TODO: CPU instruction set selection should be folded into whatever
 // the main dispatch mechanism is.
 
@@ -52,6 +65,7 @@ enum class CPUCapability {
 #else
   AVX = 1,
   AVX2 = 2,
+  AVX512 = 3,
 #endif
   NUM_OPTIONS
 };
@@ -69,7 +83,8 @@ struct DispatchStub;
  */
 struct TORCH_API DispatchStubImpl {
   void* get_call_ptr(
-    DeviceType device_type
+    const std::type_info& stub_type
+    , DeviceType device_type
     , void *DEFAULT
 #ifdef HAVE_AVX_CPU_DEFINITION
       , void *AVX
@@ -77,6 +92,9 @@ struct TORCH_API DispatchStubImpl {
 #ifdef HAVE_AVX2_CPU_DEFINITION
       , void *AVX2
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+      , void *AVX512
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
       , void *VSX
 #endif
@@ -88,13 +106,17 @@ struct TORCH_API DispatchStubImpl {
    * DispatchStubImpl::get_call_ptr() in cpu_dispatch_ptr.
    */
   void* choose_cpu_impl(
-    void *DEFAULT
+    const std::type_info& stub_type
+    , void *DEFAULT
 #ifdef HAVE_AVX_CPU_DEFINITION
     , void *AVX
 #endif
 #ifdef HAVE_AVX2_CPU_DEFINITION
     , void *AVX2
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+    , void *AVX512
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
     , void *VSX
 #endif
@@ -124,7 +146,8 @@ struct DispatchStub<rT (*)(Args...), T> {
 private:
   FnPtr get_call_ptr(DeviceType device_type) {
     return reinterpret_cast<FnPtr>(
-      impl.get_call_ptr(device_type
+      impl.get_call_ptr(typeid(T)
+      , device_type
       , reinterpret_cast<void*>(DEFAULT)
 #ifdef HAVE_AVX_CPU_DEFINITION
       , reinterpret_cast<void*>(AVX)
@@ -132,6 +155,9 @@ private:
 #ifdef HAVE_AVX2_CPU_DEFINITION
       , reinterpret_cast<void*>(AVX2)
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+      , reinterpret_cast<void*>(AVX512)
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
       , reinterpret_cast<void*>(VSX)
 #endif
@@ -161,6 +187,9 @@ public:
 #ifdef HAVE_AVX2_CPU_DEFINITION
   static FnPtr AVX2;
 #endif
+#ifdef HAVE_AVX512_CPU_DEFINITION
+  static FnPtr AVX512;
+#endif
 #ifdef HAVE_VSX_CPU_DEFINITION
   static FnPtr VSX;
 #endif
@@ -215,6 +244,12 @@ struct RegisterHIPDispatch {
 #define REGISTER_AVX2_DISPATCH(name, fn)
 #endif
 
+#ifdef HAVE_AVX512_CPU_DEFINITION
+#define REGISTER_AVX512_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, AVX512, fn)
+#else
+#define REGISTER_AVX512_DISPATCH(name, fn)
+#endif
+
 #ifdef HAVE_VSX_CPU_DEFINITION
 #define REGISTER_VSX_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, VSX, fn)
 #else
@@ -225,6 +260,7 @@ struct RegisterHIPDispatch {
   REGISTER_ARCH_DISPATCH(name, DEFAULT, static_cast<fn_type>(nullptr))         \
   REGISTER_AVX_DISPATCH(name, static_cast<fn_type>(nullptr))                   \
   REGISTER_AVX2_DISPATCH(name, static_cast<fn_type>(nullptr))          \
+  REGISTER_AVX512_DISPATCH(name, static_cast<fn_type>(nullptr))        \
   REGISTER_VSX_DISPATCH(name, static_cast<fn_type>(nullptr))
 
 #define REGISTER_CUDA_DISPATCH(name, fn) \
@@ -143,6 +143,8 @@ DEFINE_DISPATCH(exponential_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(multinomial_with_replacement_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(multinomial_alias_draw_stub);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(geometric_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(log_normal_stub);
@@ -622,4 +624,105 @@ Tensor multinomial(
   return result;
 }
 
+// Builds the alias table for Walker/Vose sampling from a fixed distribution.
+// The returned plan (J, q) is what _multinomial_alias_draw consumes: sampling
+// picks a uniform slot i and returns i with probability q[i], J[i] otherwise,
+// so each draw is O(1) no matter how many categories there are. Build once,
+// draw as often as you like; unlike multinomial with replacement there is no
+// per-call normalization or binary search.
+std::tuple<Tensor, Tensor> multinomial_alias_setup(const Tensor& probs) {
+  TORCH_CHECK(probs.dim() == 1, "probs must be 1 dimensional");
+  TORCH_CHECK(
+      at::isFloatingType(probs.scalar_type()),
+      "multinomial alias setup only supports floating-point dtypes for probs, got: ",
+      probs.scalar_type());
+  TORCH_CHECK(
+      !(probs.device().is_cpu() && probs.scalar_type() == ScalarType::Half),
+      "_multinomial_alias_setup is not implemented for half on CPU");
+  int64_t n_categories = probs.size(0);
+  TORCH_CHECK(n_categories > 0, "probs must be non-empty");
+
+  Tensor J = at::empty({n_categories}, probs.options().dtype(kLong));
+  Tensor q = at::empty({n_categories}, probs.options());
+  auto probs_c = probs.contiguous();
+
+  AT_DISPATCH_FLOATING_TYPES(probs.scalar_type(), "multinomial_alias_setup", [&] {
+    const scalar_t* probs_ptr = probs_c.data_ptr<scalar_t>();
+    int64_t* J_ptr = J.data_ptr<int64_t>();
+    scalar_t* q_ptr = q.data_ptr<scalar_t>();
+
+    double sum = 0;
+    for (int64_t i = 0; i < n_categories; i++) {
+      scalar_t val = probs_ptr[i];
+      TORCH_CHECK(val >= 0, "invalid multinomial distribution (encountering probability entry < 0)");
+      TORCH_CHECK(std::isfinite(static_cast<double>(val)),
+                  "invalid multinomial distribution (encountering probability entry = infinity or NaN)");
+      sum += static_cast<double>(val);
+    }
+    TORCH_CHECK(sum > 0, "invalid multinomial distribution (sum of probabilities <= 0)");
+
+    // Vose's construction: scale to mean 1, then repeatedly pair an
+    // under-full slot with an over-full one. Identity aliases cover the
+    // slots that end up exactly full.
+    std::vector<int64_t> small, large;
+    double scale = n_categories / sum;
+    for (int64_t i = 0; i < n_categories; i++) {
+      q_ptr[i] = static_cast<scalar_t>(probs_ptr[i] * scale);
+      J_ptr[i] = i;
+      if (q_ptr[i] < scalar_t(1)) {
+        small.push_back(i);
+      } else {
+        large.push_back(i);
+      }
+    }
+    while (!small.empty() && !large.empty()) {
+      int64_t s = small.back();
+      small.pop_back();
+      int64_t l = large.back();
+      large.pop_back();
+      J_ptr[s] = l;
+      q_ptr[l] = q_ptr[l] + q_ptr[s] - scalar_t(1);
+      if (q_ptr[l] < scalar_t(1)) {
+        small.push_back(l);
+      } else {
+        large.push_back(l);
+      }
+    }
+    // whatever is left is full up to rounding error
+    while (!large.empty()) {
+      q_ptr[large.back()] = scalar_t(1);
+      large.pop_back();
+    }
+    while (!small.empty()) {
+      q_ptr[small.back()] = scalar_t(1);
+      small.pop_back();
+    }
+  });
+  return std::make_tuple(J, q);
+}
+
+Tensor multinomial_alias_draw(
+    const Tensor& J,
+    const Tensor& q,
+    int64_t n_sample,
+    c10::optional<Generator> gen) {
+  TORCH_CHECK(
+      J.device() == q.device(),
+      "multinomial alias draw arguments must have the same device");
+  TORCH_CHECK(J.dim() == 1 && q.dim() == 1, "J and q must be 1 dimensional");
+  TORCH_CHECK(J.size(0) == q.size(0), "J and q must have the same number of categories");
+  TORCH_CHECK(J.scalar_type() == ScalarType::Long,
+      "multinomial alias draw expects Long tensor J, got: ", J.scalar_type());
+  TORCH_CHECK(
+      at::isFloatingType(q.scalar_type()),
+      "multinomial alias draw only supports floating-point dtypes for q, got: ",
+      q.scalar_type());
+  TORCH_CHECK(n_sample > 0, "cannot sample n_sample <= 0 samples");
+
+  Tensor result = at::empty({n_sample}, J.options());
+  multinomial_alias_draw_stub(
+      result.device().type(), result, J.contiguous(), q.contiguous(), gen);
+  return result;
+}
+
 }} // namespace at::native
@@ -65,6 +65,52 @@ bool is_fast_path(const Tensor& src, const c10::optional<Tensor>& scale, Tensor&
          is_fast_path_index_select(src, output, padding_idx);
 }
 
+// Software prefetch of an upcoming embedding row. The index list is known
+// well in advance of its use, so pulling the next rows into cache hides the
+// DRAM latency of the random row accesses in the bag reduction.
+constexpr int64_t kEmbeddingPrefetchDistance = 8;
+
+template <typename data_t>
+inline void prefetch_embedding_row(const data_t* row, int64_t ddim) {
+#if defined(__GNUC__) || defined(__clang__)
+  constexpr int64_t kCacheLineBytes = 64;
+  const auto* ptr = reinterpret_cast<const char*>(row);
+  const int64_t bytes = std::min<int64_t>(
+      ddim * static_cast<int64_t>(sizeof(data_t)), 4 * kCacheLineBytes);
+  for (int64_t off = 0; off < bytes; off += kCacheLineBytes) {
+    __builtin_prefetch(ptr + off);
+  }
+#else
+  (void)row;
+  (void)ddim;
+#endif
+}
+
+// Runs f(i) over [0, numel) in parallel, partitioned so that every bag
+// (i.e. every run of equal add_indices values) is processed by exactly one
+// task. That keeps concurrent tasks from accumulating into the same output
+// row without any locking; add_indices is non-decreasing by construction.
+template <typename index_t, typename func_t>
+void parallel_for_each_bag(
+    int64_t numel, int64_t ddim, const index_t* add_indices_data, const func_t& f) {
+  const int64_t grain_size =
+      std::max<int64_t>(1, at::internal::GRAIN_SIZE / std::max<int64_t>(1, ddim));
+  at::parallel_for(0, numel, grain_size, [&](int64_t begin, int64_t end) {
+    // Skip the tail of a bag owned by the previous task, and finish the bag
+    // that starts inside our range even if it extends past `end`.
+    while (begin > 0 && begin < numel &&
+           add_indices_data[begin] == add_indices_data[begin - 1]) {
+      ++begin;
+    }
+    while (end < numel && add_indices_data[end] == add_indices_data[end - 1]) {
+      ++end;
+    }
+    for (int64_t i = begin; i < end; ++i) {
+      f(i);
+    }
+  });
+}
+
 // This function combines index_select (using select_indices as the index) and
 // index_add (using add_indices as the index), without creating an intermediary
 // tensor to hold the selected embeddings
@@ -95,10 +141,16 @@ index_select_add(const Tensor &select_indices,
   auto output_stride0 = output.strides()[0];
   auto output_stride1 = output.strides()[1];
 
-  for (int64_t i = 0; i < numel; i++) {
+  parallel_for_each_bag(numel, ddim, add_indices_data, [&](int64_t i) {
     // We can skip indices equal to padding_idx so they are not included in
     // the reduction
     if (select_indices_data[i] != padding_idx) {
+      if (i + kEmbeddingPrefetchDistance < numel &&
+          select_indices_data[i + kEmbeddingPrefetchDistance] != padding_idx) {
+        prefetch_embedding_row(
+            src_data + src_stride0 * select_indices_data[i + kEmbeddingPrefetchDistance],
+            ddim);
+      }
       at::native::cpublas::axpy<data_t>(ddim, 1,
               src_data + src_stride0 * select_indices_data[i], src_stride1,
               output_data + output_stride0 * add_indices_data[i], output_stride1);
@@ -107,7 +159,7 @@ index_select_add(const Tensor &select_indices,
       // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
       bag_size_data[add_indices_data[i]]--;
     }
-  }
+  });
 }
 
 template<typename data_t, typename index_t>
@@ -197,10 +249,16 @@ index_select_add(const Tensor &select_indices,
     auto output_stride0 = output.strides()[0];
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
-    for (int64_t i = 0; i < numel; i++) {
+    parallel_for_each_bag(numel, ddim, add_indices_data, [&](int64_t i) {
       // We can skip indices equal to padding_idx so they are not included in
       // the reduction
       if (select_indices_data[i] != padding_idx) {
+        if (i + kEmbeddingPrefetchDistance < numel &&
+            select_indices_data[i + kEmbeddingPrefetchDistance] != padding_idx) {
+          prefetch_embedding_row(
+              src_data + src_stride0 * select_indices_data[i + kEmbeddingPrefetchDistance],
+              ddim);
+        }
         at::native::cpublas::axpy<float>(
             ddim,
             1,
@@ -213,7 +271,7 @@ index_select_add(const Tensor &select_indices,
         // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
         bag_size_data[add_indices_data[i]]--;
       }
-    }
+    });
   }
 }
 
@@ -252,10 +310,16 @@ index_select_scale_add(const Tensor &select_indices,
   auto* scale_data = scale.data_ptr<data_t>();
   auto scale_stride = scale.strides()[0];
 
-  for (int64_t i = 0; i < numel; i++) {
+  parallel_for_each_bag(numel, ddim, add_indices_data, [&](int64_t i) {
     // We can skip indices equal to padding_idx so they are not included in
     // the reduction
     if (select_indices_data[i] != padding_idx) {
+      if (i + kEmbeddingPrefetchDistance < numel &&
+          select_indices_data[i + kEmbeddingPrefetchDistance] != padding_idx) {
+        prefetch_embedding_row(
+            src_data + src_stride0 * select_indices_data[i + kEmbeddingPrefetchDistance],
+            ddim);
+      }
       auto* src_base = src_data + src_stride0 * select_indices_data[i];
       auto* output_base = output_data + output_stride0 * add_indices_data[i];
       auto scale = scale_data[i * scale_stride];
@@ -267,7 +331,7 @@ index_select_scale_add(const Tensor &select_indices,
       // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
       bag_size_data[add_indices_data[i]]--;
     }
-  }
+  });
 }
 
 template<typename data_t, typename index_t>
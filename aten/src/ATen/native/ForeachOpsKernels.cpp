@@ -1,13 +1,92 @@
 #include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/ForeachUtils.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 namespace at { namespace native {
 
-#define FOREACH_BINARY_OP_SCALAR(OP)                                                                      \
+namespace {
+
+// The per-tensor loops below pay one dispatch plus one TensorIterator setup
+// per tensor, which dominates runtime when an optimizer step walks hundreds
+// of small parameter tensors. For the in-place ops we instead flatten the
+// list into (pointer, length) spans and sweep all of them inside a single
+// parallel_for, so work is balanced by element count rather than by tensor.
+//
+// The fused path is restricted to contiguous strided CPU tensors of the same
+// floating dtype; everything else falls through to the per-tensor loops.
+bool can_use_fused_cpu_route(ArrayRef<TensorList> tensorLists) {
+  const auto expected_dtype = tensorLists[0][0].scalar_type();
+  if (expected_dtype != at::kFloat && expected_dtype != at::kDouble) {
+    return false;
+  }
+  for (const auto& tensorList : tensorLists) {
+    for (const auto& tensor : tensorList) {
+      if (!tensor.device().is_cpu() ||
+          tensor.layout() != at::kStrided ||
+          !tensor.is_contiguous() ||
+          tensor.scalar_type() != expected_dtype) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Invokes op(tensor_index, offset_within_tensor, length) for a set of spans
+// that exactly covers every element of `tensors`, from inside one
+// parallel_for partitioned over the total element count.
+template <typename func_t>
+void foreach_fused_apply(TensorList tensors, const func_t& op) {
+  std::vector<int64_t> offsets(tensors.size() + 1, 0);
+  for (const auto i : c10::irange(tensors.size())) {
+    offsets[i + 1] = offsets[i] + tensors[i].numel();
+  }
+  at::parallel_for(0, offsets.back(), at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    size_t k = std::upper_bound(offsets.begin(), offsets.end(), begin) -
+        offsets.begin() - 1;
+    int64_t pos = begin;
+    while (pos < end) {
+      const int64_t span_end = std::min(end, offsets[k + 1]);
+      op(k, pos - offsets[k], span_end - pos);
+      pos = span_end;
+      k++;
+    }
+  });
+}
+
+template <typename scalar_t>
+std::vector<scalar_t*> collect_data_ptrs(TensorList tensors) {
+  std::vector<scalar_t*> ptrs(tensors.size());
+  for (const auto i : c10::irange(tensors.size())) {
+    ptrs[i] = tensors[i].data_ptr<scalar_t>();
+  }
+  return ptrs;
+}
+
+} // namespace
+
+#define FOREACH_BINARY_OP_SCALAR(OP, OPERATOR)                                                            \
 void foreach_tensor_##OP##_scalar_kernel_slow_(TensorList tensors, const Scalar& scalar) {                       \
   check_foreach_api_restrictions(tensors);                                                                \
                                                                                                           \
+  if (can_use_fused_cpu_route({tensors})) {                                                               \
+    AT_DISPATCH_FLOATING_TYPES(tensors[0].scalar_type(), "foreach_" #OP "_scalar_cpu_", [&] {             \
+      auto ptrs = collect_data_ptrs<scalar_t>(tensors);                                                   \
+      const auto val = scalar.to<scalar_t>();                                                             \
+      foreach_fused_apply(tensors, [&](size_t k, int64_t start, int64_t len) {                            \
+        scalar_t* p = ptrs[k] + start;                                                                    \
+        for (const auto i : c10::irange(len)) {                                                           \
+          p[i] = p[i] OPERATOR val;                                                                       \
+        }                                                                                                 \
+      });                                                                                                 \
+    });                                                                                                   \
+    return;                                                                                               \
+  }                                                                                                       \
+                                                                                                          \
   for (auto& t: tensors) {                                                                                \
     t.OP##_(scalar);                                                                                      \
   }                                                                                                       \
@@ -25,10 +104,28 @@ std::vector<Tensor> foreach_tensor_##OP##_scalar_kernel_slow(TensorList tensors,
   return result;                                                                                          \
 }
 
-#define FOREACH_BINARY_OP_SCALARLIST(OP)                                                                                \
+#define FOREACH_BINARY_OP_SCALARLIST(OP, OPERATOR)                                                                      \
 void foreach_tensor_##OP##_scalarlist_kernel_slow_(TensorList tensors, at::ArrayRef<Scalar> scalars) {                  \
   check_foreach_api_restrictions(tensors, scalars);                                                                     \
                                                                                                                         \
+  if (can_use_fused_cpu_route({tensors})) {                                                                             \
+    AT_DISPATCH_FLOATING_TYPES(tensors[0].scalar_type(), "foreach_" #OP "_scalarlist_cpu_", [&] {                       \
+      auto ptrs = collect_data_ptrs<scalar_t>(tensors);                                                                 \
+      std::vector<scalar_t> vals(scalars.size());                                                                       \
+      for (const auto i : c10::irange(scalars.size())) {                                                                \
+        vals[i] = scalars[i].to<scalar_t>();                                                                            \
+      }                                                                                                                 \
+      foreach_fused_apply(tensors, [&](size_t k, int64_t start, int64_t len) {                                          \
+        scalar_t* p = ptrs[k] + start;                                                                                  \
+        const scalar_t val = vals[k];                                                                                   \
+        for (const auto i : c10::irange(len)) {                                                                         \
+          p[i] = p[i] OPERATOR val;                                                                                     \
+        }                                                                                                               \
+      });                                                                                                               \
+    });                                                                                                                 \
+    return;                                                                                                             \
+  }                                                                                                                     \
+                                                                                                                        \
   for (const auto i : c10::irange(tensors.size())) {                                                                    \
       tensors[i].OP##_(scalars[i]);                                                                                     \
     }                                                                                                                   \
@@ -45,7 +142,7 @@ std::vector<Tensor> foreach_tensor_##OP##_scalarlist_kernel_slow(TensorList tens
   return result;                                                                                                        \
 }
 
-#define FOREACH_BINARY_OP_LIST(OP)                                                                        \
+#define FOREACH_BINARY_OP_LIST(OP, OPERATOR)                                                              \
 std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2) {    \
   check_foreach_api_restrictions(tensors1, tensors2);                                                     \
                                                                                                           \
@@ -61,12 +158,27 @@ std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1,
 void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2) {                  \
   check_foreach_api_restrictions(tensors1, tensors2);                                                     \
                                                                                                           \
+  if (can_use_fused_cpu_route({tensors1, tensors2})) {                                                    \
+    AT_DISPATCH_FLOATING_TYPES(tensors1[0].scalar_type(), "foreach_" #OP "_list_cpu_", [&] {              \
+      auto ptrs1 = collect_data_ptrs<scalar_t>(tensors1);                                                 \
+      auto ptrs2 = collect_data_ptrs<scalar_t>(tensors2);                                                 \
+      foreach_fused_apply(tensors1, [&](size_t k, int64_t start, int64_t len) {                           \
+        scalar_t* p1 = ptrs1[k] + start;                                                                  \
+        const scalar_t* p2 = ptrs2[k] + start;                                                            \
+        for (const auto i : c10::irange(len)) {                                                           \
+          p1[i] = p1[i] OPERATOR p2[i];                                                                   \
+        }                                                                                                 \
+      });                                                                                                 \
+    });                                                                                                   \
+    return;                                                                                               \
+  }                                                                                                       \
+                                                                                                          \
   for (const auto i : c10::irange(tensors1.size())) {                                                     \
     tensors1[i].OP##_(tensors2[i]);                                                                       \
   }                                                                                                       \
 }
 
-#define FOREACH_BINARY_OP_LIST_ALPHA(OP)                                                                                \
+#define FOREACH_BINARY_OP_LIST_ALPHA(OP, OPERATOR)                                                                      \
 std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {    \
   check_foreach_api_restrictions(tensors1, tensors2);                                                                   \
                                                                                                                         \
@@ -82,6 +194,22 @@ std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1,
 void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {                  \
   check_foreach_api_restrictions(tensors1, tensors2);                                                                   \
                                                                                                                         \
+  if (can_use_fused_cpu_route({tensors1, tensors2})) {                                                                  \
+    AT_DISPATCH_FLOATING_TYPES(tensors1[0].scalar_type(), "foreach_" #OP "_list_cpu_", [&] {                            \
+      auto ptrs1 = collect_data_ptrs<scalar_t>(tensors1);                                                               \
+      auto ptrs2 = collect_data_ptrs<scalar_t>(tensors2);                                                               \
+      const auto alpha_val = alpha.to<scalar_t>();                                                                      \
+      foreach_fused_apply(tensors1, [&](size_t k, int64_t start, int64_t len) {                                         \
+        scalar_t* p1 = ptrs1[k] + start;                                                                                \
+        const scalar_t* p2 = ptrs2[k] + start;                                                                          \
+        for (const auto i : c10::irange(len)) {                                                                         \
+          p1[i] = p1[i] OPERATOR alpha_val * p2[i];                                                                     \
+        }                                                                                                               \
+      });                                                                                                               \
+    });                                                                                                                 \
+    return;                                                                                                             \
+  }                                                                                                                     \
+                                                                                                                        \
   for (const auto i : c10::irange(tensors1.size())) {                                                                   \
     tensors1[i].OP##_(tensors2[i], alpha);                                                                              \
   }                                                                                                                     \
@@ -148,21 +276,21 @@ void foreach_tensor_##OP##_scalarlist_slow_(TensorList input, TensorList tensors
   }                                                                                                                                                     \
 }                                                                                                                                                       \
 
-FOREACH_BINARY_OP_LIST_ALPHA(add);
-FOREACH_BINARY_OP_LIST_ALPHA(sub);
+FOREACH_BINARY_OP_LIST_ALPHA(add, +);
+FOREACH_BINARY_OP_LIST_ALPHA(sub, -);
 
-FOREACH_BINARY_OP_SCALAR(add);
-FOREACH_BINARY_OP_SCALAR(sub);
-FOREACH_BINARY_OP_SCALAR(mul);
-FOREACH_BINARY_OP_SCALAR(div);
+FOREACH_BINARY_OP_SCALAR(add, +);
+FOREACH_BINARY_OP_SCALAR(sub, -);
+FOREACH_BINARY_OP_SCALAR(mul, *);
+FOREACH_BINARY_OP_SCALAR(div, /);
 
-FOREACH_BINARY_OP_SCALARLIST(add);
-FOREACH_BINARY_OP_SCALARLIST(sub);
-FOREACH_BINARY_OP_SCALARLIST(mul);
-FOREACH_BINARY_OP_SCALARLIST(div);
+FOREACH_BINARY_OP_SCALARLIST(add, +);
+FOREACH_BINARY_OP_SCALARLIST(sub, -);
+FOREACH_BINARY_OP_SCALARLIST(mul, *);
+FOREACH_BINARY_OP_SCALARLIST(div, /);
 
-FOREACH_BINARY_OP_LIST(mul);
-FOREACH_BINARY_OP_LIST(div);
+FOREACH_BINARY_OP_LIST(mul, *);
+FOREACH_BINARY_OP_LIST(div, /);
 
 FOREACH_UNARY_OP(sqrt);
 FOREACH_UNARY_OP(exp);
@@ -218,6 +346,16 @@ FOREACH_MAXIMUM_MINIMUM_OP(minimum)
 void foreach_tensor_zero_slow_(TensorList tensors) {
   check_foreach_api_restrictions(tensors);
 
+  if (can_use_fused_cpu_route({tensors})) {
+    AT_DISPATCH_FLOATING_TYPES(tensors[0].scalar_type(), "foreach_zero_cpu_", [&] {
+      auto ptrs = collect_data_ptrs<scalar_t>(tensors);
+      foreach_fused_apply(tensors, [&](size_t k, int64_t start, int64_t len) {
+        std::fill_n(ptrs[k] + start, len, scalar_t(0));
+      });
+    });
+    return;
+  }
+
   for (auto& t : tensors) {
     t.zero_();
   }
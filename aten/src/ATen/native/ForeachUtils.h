@@ -8,7 +8,10 @@ namespace native {
 namespace {
 // Check foreach API restrictions
 // - Tensor lists must be non-empty.
-// - All tensors in all lists must have the same dtype.
+// - All tensors in all lists must have the same dtype, except in the
+//   two-list case, where only corresponding tensors must match (this is
+//   what lets mixed fp16/fp32 batches through; see
+//   can_use_grouped_fast_route below).
 // - All TensorLists and ScalarLists must have the same number of elements.
 // - Corresponding tensors must have the same size.
 void check_foreach_api_restrictions(TensorList tensors) {
@@ -29,11 +32,8 @@ void check_foreach_api_restrictions(TensorList tensors1, TensorList tensors2) {
   TORCH_CHECK(tensors2.size() > 0, "Tensor list must have at least one tensor.");
   TORCH_CHECK(tensors1.size() == tensors2.size(), "Tensor lists must have the same number of tensors, got ", tensors1.size(), " and ", tensors2.size());
 
-  auto expected_dtype = tensors1[0].dtype();
-
   for (const auto i : c10::irange(tensors1.size())) {
-    TORCH_CHECK(tensors1[i].dtype() == expected_dtype, "All tensors in the tensor list must have the same dtype.");
-    TORCH_CHECK(tensors2[i].dtype() == expected_dtype, "All tensors in the tensor list must have the same dtype.");
+    TORCH_CHECK(tensors1[i].dtype() == tensors2[i].dtype(), "Corresponding tensors in lists must have the same dtype, got ", tensors1[i].dtype(), " and ", tensors2[i].dtype());
     TORCH_CHECK(tensors1[i].sizes() == tensors2[i].sizes(), "Corresponding tensors in lists must have the same size, got ", tensors1[i].sizes(), " and ", tensors2[i].sizes());
   }
 }
@@ -82,11 +82,14 @@ bool will_promote_tensor(const Tensor& tensor, const Scalar& scalar, bool does_o
 bool check_fast_path_restrictions(
   ArrayRef<TensorList> tensorLists,
   ArrayRef<Scalar> scalarList = {},
-  bool does_op_promote_integer_inputs_to_float = false) {
+  bool does_op_promote_integer_inputs_to_float = false,
+  bool allow_mixed_dtypes = false) {
     auto expected_device = tensorLists[0][0].device();
+    auto expected_dtype = tensorLists[0][0].dtype();
 
     auto is_tensor_okay = [&](const Tensor& tensor) {
       return tensor.device() == expected_device &&
+             (allow_mixed_dtypes || tensor.dtype() == expected_dtype) &&
              tensor.layout() == at::kStrided &&
              tensor.is_non_overlapping_and_dense();
     };
@@ -155,5 +158,32 @@ bool can_use_fast_route(TensorList tensors1, TensorList tensors2, bool does_op_p
 #endif
 }
 
+// A batch whose tensors don't all share one dtype (e.g. fp16/fp32 optimizer
+// state) can still take a single fused launch, provided corresponding
+// tensors match and every dtype is one the grouped kernels instantiate.
+// See GroupedTensorListMetadata in MultiTensorApply.cuh.
+bool can_use_grouped_fast_route(TensorList tensors1,
+                                TensorList tensors2,
+                                ArrayRef<Scalar> scalarList = {}) {
+#ifdef __HIP_PLATFORM_HCC__
+  return false;
+#else
+  for (const auto i : c10::irange(tensors1.size())) {
+    auto dtype = tensors1[i].scalar_type();
+    if (dtype != tensors2[i].scalar_type()) {
+      return false;
+    }
+    if (dtype != ScalarType::Half && dtype != ScalarType::BFloat16 &&
+        dtype != ScalarType::Float && dtype != ScalarType::Double) {
+      return false;
+    }
+  }
+  return check_fast_path_restrictions(
+      {tensors1, tensors2}, scalarList,
+      /*does_op_promote_integer_inputs_to_float=*/false,
+      /*allow_mixed_dtypes=*/true);
+#endif
+}
+
 }
 }} // at::native
@@ -1330,6 +1330,49 @@ The behavior depends on the dimensionality of the Tensors as follows:
   must be broadcastable).  For example, if tensor1 is a (j x 1 x n x m) Tensor
   and tensor2 is a (k x m x p) Tensor, the returned tensor will be an (j x k x n x p) Tensor.
 */
+// Collapses the batch dimensions of an expanded matmul operand into a single
+// leading dimension, producing the given 3-D view_shape. Returns a no-copy
+// as_strided view when the flattened batch walks through storage at one fixed
+// stride -- zero for a fully broadcast batch -- so bmm can issue a single
+// strided-batched GEMM over it. Falls back to reshape(), which materializes a
+// contiguous copy, when the batch slices are laid out irregularly.
+static Tensor collapse_expanded_batch(const Tensor& tensor, IntArrayRef view_shape) {
+  const int64_t n_batch_dims = tensor.dim() - 2;
+  const int64_t row_stride = tensor.stride(n_batch_dims);
+  const int64_t col_stride = tensor.stride(n_batch_dims + 1);
+  // as_strided does not support negative strides; leave those to reshape()
+  if (row_stride >= 0 && col_stride >= 0) {
+    int64_t batch_stride = -1; // not yet determined
+    int64_t suffix_numel = 1; // batch elements covered by the dims behind d
+    bool regular = true;
+    for (int64_t d = n_batch_dims - 1; d >= 0; d--) {
+      const int64_t size = tensor.size(d);
+      if (size != 1) {
+        // The flattened batch advances by a fixed stride iff every non-unit
+        // batch dim's stride is that stride scaled by the number of batch
+        // elements behind it. The innermost non-unit dim pins the stride;
+        // a broadcast (all strides zero) batch pins it to zero.
+        const int64_t stride = tensor.stride(d);
+        if (stride < 0 ||
+            (batch_stride >= 0 && stride != batch_stride * suffix_numel)) {
+          regular = false;
+          break;
+        }
+        if (batch_stride < 0) {
+          batch_stride = stride;
+        }
+      }
+      suffix_numel *= size;
+    }
+    if (regular) {
+      return tensor.as_strided(
+          view_shape,
+          {std::max<int64_t>(batch_stride, 0), row_stride, col_stride});
+    }
+  }
+  return tensor.reshape(view_shape);
+}
+
 Tensor matmul(
     c10::optional<Tensor> out_opt,
     const Tensor& tensor1,
@@ -1418,9 +1461,13 @@ Tensor matmul(
     std::vector<int64_t> tensor2_bmm_view({expand_batch_product});
     tensor2_bmm_view.insert(tensor2_bmm_view.end(), {m2, p});
 
-    // flatten expanded batches
-    Tensor tensor1_expanded = tensor1.expand(tensor1_expand_size).reshape(tensor1_bmm_view);
-    Tensor tensor2_expanded = tensor2.expand(tensor2_expand_size).reshape(tensor2_bmm_view);
+    // flatten expanded batches; cublas/mkl take a per-operand batch stride
+    // (including zero), so a regular batch collapses into one strided-batched
+    // GEMM without materializing broadcast copies
+    Tensor tensor1_expanded = collapse_expanded_batch(
+        tensor1.expand(tensor1_expand_size), tensor1_bmm_view);
+    Tensor tensor2_expanded = collapse_expanded_batch(
+        tensor2.expand(tensor2_expand_size), tensor2_bmm_view);
 
     // reshape batches back into result
     std::vector<int64_t> output_shape(expand_batch_portion);
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at {
+namespace native {
+
+using ctc_loss_fn = void (*)(
+    Tensor& /* log_alpha */,
+    Tensor& /* neg_log_likelihood */,
+    const Tensor& /* log_probs */,
+    const Tensor& /* targets */,
+    IntArrayRef /* input_lengths */,
+    IntArrayRef /* target_lengths */,
+    int64_t /* BLANK */);
+
+using ctc_loss_backward_fn = void (*)(
+    Tensor& /* grad */,
+    const Tensor& /* grad_out */,
+    const Tensor& /* log_probs */,
+    const Tensor& /* targets */,
+    IntArrayRef /* input_lengths */,
+    IntArrayRef /* target_lengths */,
+    const Tensor& /* neg_log_likelihood */,
+    const Tensor& /* log_alpha */,
+    int64_t /* BLANK */,
+    bool /* zero_infinity */);
+
+DECLARE_DISPATCH(ctc_loss_fn, ctc_loss_stub);
+DECLARE_DISPATCH(ctc_loss_backward_fn, ctc_loss_backward_stub);
+
+} // namespace native
+} // namespace at
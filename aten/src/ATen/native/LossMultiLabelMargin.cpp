@@ -1,9 +1,12 @@
 #include <ATen/ATen.h>
 #include <ATen/AccumulateType.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/native/LossMulti.h>
 
+#include <algorithm>
+
 namespace at {
 namespace native {
 
@@ -58,19 +61,30 @@ static void multilabel_margin_loss_forward_out_frame(
   int64_t* target_data = target_contiguous.data_ptr<int64_t>();
   scalar_t* is_target_data = is_target.data_ptr<scalar_t>();
 
+  // each frame reads and writes only its own rows of input/target/is_target,
+  // so the frame loops parallelize; the inner sum is O(dim^2) in the worst
+  // case, hence the conservative grain
+  const int64_t grain = std::max(int64_t(1), internal::GRAIN_SIZE / dim);
+
   if (reduction != Reduction::None || output.dim() == 0) {
     scalar_t* output_data = output.data_ptr<scalar_t>();
 
-    accscalar_t sum = 0;
-
-    for (int64_t t = 0; t < nframe; t++) {
-      sum += multilabel_margin_loss_forward_inner_sum_cpu(
-          input_data, target_data, is_target_data, dim);
-
-      input_data += dim;
-      target_data += dim;
-      is_target_data += dim;
-    }
+    accscalar_t sum = at::parallel_reduce(
+        0,
+        nframe,
+        grain,
+        accscalar_t(0),
+        [&](int64_t begin, int64_t end, accscalar_t partial) {
+          for (int64_t t = begin; t < end; t++) {
+            partial += multilabel_margin_loss_forward_inner_sum_cpu(
+                input_data + t * dim,
+                target_data + t * dim,
+                is_target_data + t * dim,
+                dim);
+          }
+          return partial;
+        },
+        std::plus<accscalar_t>());
 
     sum /= dim;
     if (reduction == Reduction::Mean) {
@@ -81,17 +95,18 @@ static void multilabel_margin_loss_forward_out_frame(
   } else {
     auto output_acc = output.accessor<scalar_t, 1>();
 
-    for (int64_t t = 0; t < nframe; t++) {
-      scalar_t sum = multilabel_margin_loss_forward_inner_sum_cpu(
-          input_data, target_data, is_target_data, dim);
-
-      sum /= dim;
-      output_acc[t] = sum;
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        scalar_t sum = multilabel_margin_loss_forward_inner_sum_cpu(
+            input_data + t * dim,
+            target_data + t * dim,
+            is_target_data + t * dim,
+            dim);
 
-      input_data += dim;
-      target_data += dim;
-      is_target_data += dim;
-    }
+        sum /= dim;
+        output_acc[t] = sum;
+      }
+    });
   }
 }
 
@@ -173,18 +188,25 @@ static void multilabel_margin_loss_backward_out_frame(
       // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
       reduction == Reduction::Mean ? 1. / (nframe * dim) : 1. / dim);
 
-  scalar_t* grad_input_row_data = grad_input.data_ptr<scalar_t>();
-  for (int64_t t = 0; t < nframe; t++) {
+  scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+
+  // computes one unscaled gradient row, then scales it by the frame's output
+  // gradient; frames are independent, so the loop over them parallelizes
+  auto grad_frame = [&](int64_t t, scalar_t grad_output_t) {
+    const scalar_t* input_row_data = input_data + t * dim;
+    const int64_t* target_row_data = target_data + t * dim;
+    const scalar_t* is_target_row_data = is_target_data + t * dim;
+    scalar_t* grad_input_row_data = grad_input_data + t * dim;
     for (int64_t dt = 0; dt < dim; dt++) {
-      int64_t target_idx = target_data[dt];
+      int64_t target_idx = target_row_data[dt];
       if (target_idx < 0) {
         break;
       }
 
-      scalar_t input_target = input_data[target_idx];
+      scalar_t input_target = input_row_data[target_idx];
       for (int64_t d = 0; d < dim; d++) {
-        if (!is_target_data[d]) {
-          scalar_t z = 1 - input_target + input_data[d];
+        if (!is_target_row_data[d]) {
+          scalar_t z = 1 - input_target + input_row_data[d];
           if (z > 0) {
             grad_input_row_data[target_idx] -= g;
             grad_input_row_data[d] += g;
@@ -192,28 +214,29 @@ static void multilabel_margin_loss_backward_out_frame(
         }
       }
     }
-    input_data += dim;
-    target_data += dim;
-    is_target_data += dim;
-    grad_input_row_data += dim;
-  }
+    for (int64_t d = 0; d < dim; d++) {
+      grad_input_row_data[d] *= grad_output_t;
+    }
+  };
 
-  scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+  const int64_t grain = std::max(int64_t(1), internal::GRAIN_SIZE / dim);
   if (reduction != Reduction::None || grad_output.dim() == 0) {
     assert(
         reduction != Reduction::None || grad_output.dim() > 0 || nframe == 1);
     const auto d = *grad_output.data_ptr<scalar_t>();
-    for (int64_t t = 0; t < nframe * dim; t++) {
-      grad_input_data[t] *= d;
-    }
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        grad_frame(t, d);
+      }
+    });
   } else {
     check_dim_size(grad_output, 1, 0, nframe);
     auto grad_output_acc = grad_output.accessor<scalar_t, 1>();
-    for (int64_t t = 0; t < nframe; t++) {
-      for (int64_t d = 0; d < dim; d++) {
-        grad_input_data[t * dim + d] *= grad_output_acc[t];
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        grad_frame(t, grad_output_acc[t]);
       }
-    }
+    });
   }
 }
 
@@ -1,8 +1,11 @@
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
 #include <ATen/AccumulateType.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/LossMulti.h>
 
+#include <algorithm>
+
 namespace at {
 namespace native {
 
@@ -59,30 +62,40 @@ static inline void multi_margin_loss_cpu_kernel(
     const int64_t reduction) {
   using accscalar_t = at::acc_type<scalar_t, false>;
 
+  // each frame costs O(dim) work, so hand parallel_for/parallel_reduce a
+  // grain that still covers roughly GRAIN_SIZE elements
+  const int64_t grain = std::max(int64_t(1), internal::GRAIN_SIZE / dim);
+
   // dim() != 0 check is for 1d input which produces a scalar output (that
   // cannot be handled by TensorAccessor)
   if (reduction == Reduction::None && output.dim() > 0) {
     auto output_acc = output.accessor<scalar_t, 1>();
-    for (int64_t t = 0; t < nframe; t++) {
-      const auto idx = target_index_checked(target_data, t, dim);
-      auto sum = multi_margin_inner_sum_cpu(
-          input_data, weight_data, p, margin, dim, idx);
-      output_acc[t] = sum;
-      input_data += dim;
-    }
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        const auto idx = target_index_checked(target_data, t, dim);
+        output_acc[t] = multi_margin_inner_sum_cpu(
+            input_data + t * dim, weight_data, p, margin, dim, idx);
+      }
+    });
   } else {
-    accscalar_t sum = 0;
-    auto output_acc = output.data_ptr<scalar_t>();
-    for (int64_t t = 0; t < nframe; t++) {
-      const auto idx = target_index_checked(target_data, t, dim);
-      sum += multi_margin_inner_sum_cpu(
-          input_data, weight_data, p, margin, dim, idx);
-      input_data += dim;
-    }
+    accscalar_t sum = at::parallel_reduce(
+        0,
+        nframe,
+        grain,
+        accscalar_t(0),
+        [&](int64_t begin, int64_t end, accscalar_t partial) {
+          for (int64_t t = begin; t < end; t++) {
+            const auto idx = target_index_checked(target_data, t, dim);
+            partial += multi_margin_inner_sum_cpu(
+                input_data + t * dim, weight_data, p, margin, dim, idx);
+          }
+          return partial;
+        },
+        std::plus<accscalar_t>());
     if (reduction == Reduction::Mean) {
       sum /= nframe;
     }
-    output_acc[0] = sum;
+    *output.data_ptr<scalar_t>() = sum;
   }
 }
 
@@ -148,13 +161,17 @@ static void multi_margin_loss_backward_cpu_kernel(
     int64_t nframe,
     int64_t dim,
     int64_t reduction) {
-  scalar_t* grad_input_row_data = grad_input_data;
-  for (int64_t t = 0; t < nframe; t++) {
+  // computes one unscaled gradient row, then scales it by the frame's
+  // output gradient; frames are independent, so the loop over them is
+  // parallelized below
+  auto grad_frame = [&](int64_t t, scalar_t grad_output_t) {
+    const scalar_t* input_row_data = input_data + t * dim;
+    scalar_t* grad_input_row_data = grad_input_data + t * dim;
     int64_t target_idx = target_index_checked(target_data, t, dim);
-    scalar_t input_target = input_data[target_idx];
+    scalar_t input_target = input_row_data[target_idx];
     scalar_t grad_input_target = 0;
     for (int64_t d = 0; d < dim; d++) {
-      scalar_t z = margin - input_target + input_data[d];
+      scalar_t z = margin - input_target + input_row_data[d];
       if (d == target_idx) {
         continue;
       }
@@ -165,32 +182,32 @@ static void multi_margin_loss_backward_cpu_kernel(
           h *= weight_data[target_idx];
         }
         grad_input_target -= h;
-        grad_input_row_data[d] = h;
+        grad_input_row_data[d] = h * grad_output_t;
       } else {
         grad_input_row_data[d] = 0;
       }
     }
-    grad_input_row_data[target_idx] = grad_input_target;
-
-    input_data += dim;
-    grad_input_row_data += dim;
-  }
+    grad_input_row_data[target_idx] = grad_input_target * grad_output_t;
+  };
 
+  const int64_t grain = std::max(int64_t(1), internal::GRAIN_SIZE / dim);
   if (reduction != Reduction::None || grad_output.dim() == 0) {
     assert(
         reduction != Reduction::None || grad_output.dim() > 0 ||
         nframe == 1); // check 1d scalar fallback-case
     const auto d = *grad_output.data_ptr<scalar_t>();
-    for (int64_t t = 0; t < nframe * dim; t++) {
-      grad_input_data[t] *= d;
-    }
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        grad_frame(t, d);
+      }
+    });
   } else {
     auto grad_output_acc = grad_output.accessor<scalar_t, 1>();
-    for (int64_t t = 0; t < nframe; t++) {
-      for (int64_t d = 0; d < dim; d++) {
-        grad_input_data[t * dim + d] *= grad_output_acc[t];
+    at::parallel_for(0, nframe, grain, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; t++) {
+        grad_frame(t, grad_output_acc[t]);
       }
-    }
+    });
   }
 }
 
@@ -18,6 +18,8 @@ namespace at { namespace native {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(batch_norm_cpu_inference_contiguous_stub);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(batch_norm_cpu_inference_relu_stub);
 
 namespace {
   void check_dims_match_num_input_features(const char* arg_name, int64_t expected, int64_t actual){
@@ -526,6 +528,39 @@ Tensor batch_norm(
                                                 training, momentum, eps, cudnn_enabled));
 }
 
+Tensor batch_norm_relu_inference(
+    const Tensor& input, const c10::optional<Tensor>& weight_opt, const c10::optional<Tensor>& bias_opt,
+    const c10::optional<Tensor>& running_mean_opt, const c10::optional<Tensor>& running_var_opt,
+    double eps) {
+  const Tensor& weight = c10::value_or_else(weight_opt, [] {return Tensor();});
+  const Tensor& bias = c10::value_or_else(bias_opt, [] {return Tensor();});
+  const Tensor& running_mean = c10::value_or_else(running_mean_opt, [] {return Tensor();});
+  const Tensor& running_var = c10::value_or_else(running_var_opt, [] {return Tensor();});
+
+  bool can_use_fused_kernel = input.device().is_cpu() && !input.is_quantized() &&
+      input.dim() >= 2 && input.numel() != 0 &&
+      (input.scalar_type() == kFloat || input.scalar_type() == kDouble) &&
+      running_mean.defined() && running_mean.is_contiguous() &&
+      running_mean.scalar_type() == input.scalar_type() &&
+      running_var.defined() && running_var.is_contiguous() &&
+      running_var.scalar_type() == input.scalar_type() &&
+      (!weight.defined() ||
+       (weight.is_contiguous() && weight.scalar_type() == input.scalar_type())) &&
+      (!bias.defined() ||
+       (bias.is_contiguous() && bias.scalar_type() == input.scalar_type())) &&
+      (input.is_contiguous() || input.is_contiguous(at::MemoryFormat::ChannelsLast));
+  if (can_use_fused_kernel) {
+    Tensor output = input.is_contiguous(at::MemoryFormat::ChannelsLast)
+        ? at::empty_like(input, at::MemoryFormat::ChannelsLast)
+        : at::empty_like(input, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+    batch_norm_cpu_inference_relu_stub(kCPU, output, input, weight, bias,
+        running_mean, running_var, eps);
+    return output;
+  }
+  return at::relu(at::batch_norm(input, weight_opt, bias_opt, running_mean_opt, running_var_opt,
+      /*training=*/false, /*momentum=*/0.0, eps, /*cudnn_enabled=*/false));
+}
+
 Tensor instance_norm(
     const Tensor& input, const c10::optional<Tensor>& weight_opt /* optional */, const c10::optional<Tensor>& bias_opt /* optional */, const c10::optional<Tensor>& running_mean_opt /* optional */, const c10::optional<Tensor>& running_var_opt /* optional */,
     bool use_input_stats, double momentum, double eps, bool cudnn_enabled) {
@@ -1,5 +1,6 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/core/grad_mode.h>
 
 #include <c10/util/irange.h>
 
@@ -42,8 +43,6 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     }
   }
 
-  std::vector<at::Tensor> steps;
-  steps.reserve(batch_size);
   at::Tensor batch_sizes_t = at::empty(lengths[0], _lengths.options());
   int64_t * batch_sizes = batch_sizes_t.data_ptr<int64_t>();
 
@@ -56,6 +55,19 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     step_shape.insert(step_shape.end(), s_input_sizes.begin(), s_input_sizes.end());
   }
 
+  // When every sequence has the same length, the time-major padded storage is
+  // already in packed order, so the packed data can simply be a reshaped view
+  // of the input. Since the output then aliases the input storage without
+  // autograd knowing about the relationship, only take this path when no
+  // graph is being recorded.
+  if (!at::GradMode::is_enabled() && input.is_contiguous() &&
+      lengths[0] == lengths[batch_size - 1]) {
+    for (const auto i : c10::irange(lengths[0])) {
+      batch_sizes[i] = batch_size;
+    }
+    return std::make_tuple(input.view(step_shape), batch_sizes_t);
+  }
+
   // To understand what's going on in this loop imagine that the input is a padded 2D
   // array that looks like this (x = valid entry, . = padding)
   //
@@ -74,14 +86,35 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
   // that corresponds to this length, and hasn't been sliced yet (the steps at which each
   // element is sliced are annotated in the array above).  You can think of this as if we
   // were scanning the sequences from the shortest one, and every time we realize there's
-  // more elements below in our column, we lower the counter (prev_l), and append the new
-  // block to the output.
+  // more elements below in our column, we lower the counter (prev_l), and copy the new
+  // block into the output. The output is allocated up front and every block is
+  // copied straight into its final position, rather than making each block
+  // contiguous and concatenating afterwards, which would move the data twice.
+  int64_t total_rows = 0;
+  for (const auto i : c10::irange(batch_size)) {
+    total_rows += lengths[i];
+  }
+  std::vector<int64_t> packed_shape = step_shape; // == [sum(lengths), *input.shape[2:]]
+  packed_shape[0] = total_rows;
+  at::Tensor packed = at::empty(packed_shape, input.options());
+
+  std::vector<int64_t> block_shape; // == [l - prev_l, current_batch_size, *input.shape[2:]]
+  block_shape.assign(step_shape.begin(), step_shape.end());
+  block_shape.insert(block_shape.begin(), 0);
+
+  int64_t row_offset = 0;
   int64_t prev_l = 0;
   for (int64_t i = 0; i < batch_size; ++i) {
     int64_t l = lengths[batch_size - 1 - i];
     if (l > prev_l) {
       auto current_batch_size = batch_size - i;
-      steps.push_back(input.slice(0, prev_l, l).slice(1, 0, current_batch_size).contiguous().view(step_shape));
+      int64_t rows = (l - prev_l) * current_batch_size;
+      block_shape[0] = l - prev_l;
+      block_shape[1] = current_batch_size;
+      packed.narrow(0, row_offset, rows)
+          .view(block_shape)
+          .copy_(input.slice(0, prev_l, l).slice(1, 0, current_batch_size));
+      row_offset += rows;
       for (int64_t j = 0; j < (l - prev_l); ++j) {
         (*batch_sizes++) = current_batch_size;
       }
@@ -90,7 +123,7 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     TORCH_CHECK(l >= prev_l);
   }
 
-  return std::make_tuple(at::cat(steps), batch_sizes_t);
+  return std::make_tuple(packed, batch_sizes_t);
 }
 
 // `grad` could be on arbitrary device and of arbitrary dtype, but `_batch_sizes`
@@ -145,6 +178,24 @@ std::tuple<Tensor, Tensor> _pad_packed_sequence(const Tensor& data, const Tensor
     auto s_data_size = data.sizes().slice(1);
     output_size.insert(output_size.end(), s_data_size.begin(), s_data_size.end());
   }
+
+  // If every step is full (no sequence is shorter than the longest) and no
+  // extra padding was requested, the packed data already is the padded output
+  // in time-major order, so hand back a reshaped view instead of copying.
+  // The output then aliases the input storage without autograd knowing about
+  // the relationship, so only do this when no graph is being recorded.
+  if (!at::GradMode::is_enabled() && data.is_contiguous() &&
+      max_seq_length == max_real_seq_length &&
+      batch_sizes[max_real_seq_length - 1] == max_batch_size) {
+    at::Tensor full_lengths_t = at::empty(max_batch_size, batch_sizes_t.options());
+    full_lengths_t.fill_(max_real_seq_length);
+    auto view_output = data.view(output_size);
+    if (batch_first) {
+      view_output = view_output.transpose(0, 1);
+    }
+    return std::make_tuple(view_output, full_lengths_t);
+  }
+
   auto output = at::full(output_size, padding_value, data.options());
 
   // This will be modified at every iteration, but we reserve memory for it now.
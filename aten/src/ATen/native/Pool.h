@@ -15,6 +15,14 @@ using max_pool2d_backward_fn = void(*)(Tensor& grad_input, const Tensor& grad_ou
 DECLARE_DISPATCH(max_pool2d_fn, max_pool2d_kernel);
 DECLARE_DISPATCH(max_pool2d_backward_fn, max_pool2d_backward_kernel);
 
+using max_pool3d_fn = void(*)(Tensor& output, Tensor& indices, const Tensor& input,
+    int kW, int kH, int kT, int dW, int dH, int dT,
+    int padW, int padH, int padT, int dilationW, int dilationH, int dilationT);
+using max_pool3d_backward_fn = void(*)(Tensor& grad_input, const Tensor& grad_output, const Tensor& indices);
+
+DECLARE_DISPATCH(max_pool3d_fn, max_pool3d_kernel);
+DECLARE_DISPATCH(max_pool3d_backward_fn, max_pool3d_backward_kernel);
+
 namespace {
 
 template <typename dest_t, typename src_t>
@@ -3,6 +3,8 @@
 #include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <list>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -40,6 +42,76 @@ namespace native {
 
 #ifdef USE_FBGEMM
 
+namespace {
+
+// Capacity of the implicit prepack caches below. Serving processes usually
+// hold a handful of dynamic linear weights; the cap only exists to bound
+// memory if weights are created in a loop.
+constexpr size_t kPackedWeightCacheCapacity = 32;
+
+// Identity key for a weight tensor: storage address plus the in-place
+// version counter, so any mutation of the weight produces a miss. Sizes are
+// included to disambiguate an allocation that was freed and reused.
+struct WeightCacheKey {
+  const void* data;
+  uint32_t version;
+  std::vector<int64_t> sizes;
+
+  bool operator==(const WeightCacheKey& other) const {
+    return data == other.data && version == other.version &&
+        sizes == other.sizes;
+  }
+};
+
+WeightCacheKey MakeWeightCacheKey(const Tensor& weight) {
+  return {
+      weight.data_ptr(),
+      weight.unsafeGetTensorImpl()->version_counter().current_version(),
+      weight.sizes().vec()};
+}
+
+// Small LRU cache so callers going through the non-prepacked dynamic linear
+// API pay the fbgemm repack once per weight instead of once per call. Each
+// entry keeps the source tensor alive, which both pins the data pointer in
+// the key and keeps cheap repeated lookups valid. Entries are few, so a
+// linear scan beats maintaining a hash map.
+template <typename Payload>
+class PackedWeightCache {
+ public:
+  c10::optional<Payload> Lookup(const WeightCacheKey& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->key == key) {
+        // Move to the front so the cap evicts the least recently used.
+        entries_.splice(entries_.begin(), entries_, it);
+        return entries_.front().payload;
+      }
+    }
+    return c10::nullopt;
+  }
+
+  void Insert(WeightCacheKey key, Tensor source, Payload payload) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    entries_.push_front(
+        {std::move(key), std::move(source), std::move(payload)});
+    if (entries_.size() > kPackedWeightCacheCapacity) {
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  struct Entry {
+    WeightCacheKey key;
+    Tensor source;
+    Payload payload;
+  };
+
+  std::mutex mutex_;
+  std::list<Entry> entries_;
+};
+
+} // namespace
+
 Tensor fbgemm_linear_int8_weight_fp32_activation(
     const Tensor& input,
     const Tensor& weight,
@@ -223,6 +295,15 @@ std::tuple<Tensor, Tensor, double, int64_t> fbgemm_linear_quantize_weight(
   // same numerics across different machines. Therefore, we do not provide a
   // fallback path and rather fail loudly if we cannot run FBGEMM.
   TORCH_CHECK(fbgemm::fbgemmSupportedCPU(), "Your CPU doesn't support FBGEMM.");
+
+  // Dynamic linear calls without explicit prepacking re-quantize the same
+  // fp32 weight every iteration; cache the result per weight identity.
+  static PackedWeightCache<std::tuple<Tensor, Tensor, double, int64_t>> cache;
+  const auto key = MakeWeightCacheKey(weight);
+  if (auto cached = cache.Lookup(key)) {
+    return *cached;
+  }
+
   const Tensor weight_contig = weight.contiguous();
 
   // Calculate weight statistics
@@ -279,8 +360,10 @@ std::tuple<Tensor, Tensor, double, int64_t> fbgemm_linear_quantize_weight(
       /*B_zero_point=*/q_params.zero_point,
       /*col_offsets=*/col_offsets.data_ptr<int32_t>());
 
-  return std::make_tuple(
+  auto result = std::make_tuple(
       quantized, col_offsets, q_params.scale, q_params.zero_point);
+  cache.Insert(key, weight, result);
+  return result;
 }
 
 Tensor fbgemm_pack_quantized_matrix(const Tensor& weight) {
@@ -288,6 +371,15 @@ Tensor fbgemm_pack_quantized_matrix(const Tensor& weight) {
   // same numerics across different machines. Therefore, we do not provide a
   // fallback path and rather fail loudly if we cannot run FBGEMM.
   TORCH_CHECK(fbgemm::fbgemmSupportedCPU(), "Your CPU doesn't support FBGEMM.");
+
+  // Returning the cached owner tensor shares the PackBMatrix; callers treat
+  // the packed tensor as opaque and read-only, so sharing is safe.
+  static PackedWeightCache<Tensor> cache;
+  const auto key = MakeWeightCacheKey(weight);
+  if (auto cached = cache.Lookup(key)) {
+    return *cached;
+  }
+
   const int64_t K = weight.size(1);
   const int64_t N = weight.size(0);
   const Tensor weight_contig = weight.contiguous();
@@ -300,7 +392,9 @@ Tensor fbgemm_pack_quantized_matrix(const Tensor& weight) {
       /*ld=*/K,
       /*pmat=*/nullptr, // PackBMatrix manages ownership of pmat
       /*groups=*/1);
-  return cpp_custom_type_hack::create(std::move(ptr), weight.options());
+  Tensor packed = cpp_custom_type_hack::create(std::move(ptr), weight.options());
+  cache.Insert(key, weight, packed);
+  return packed;
 }
 
 Tensor fbgemm_pack_quantized_matrix(
@@ -371,6 +465,12 @@ Tensor fbgemm_pack_gemm_matrix_fp16(const Tensor& weight) {
   // fallback path and rather fail loudly if we cannot run FBGEMM.
   TORCH_CHECK(fbgemm::fbgemmSupportedCPU(), "Your CPU doesn't support FBGEMM.");
 
+  static PackedWeightCache<Tensor> cache;
+  const auto key = MakeWeightCacheKey(weight);
+  if (auto cached = cache.Lookup(key)) {
+    return *cached;
+  }
+
   const int64_t K = weight.size(1);
   const int64_t N = weight.size(0);
   Tensor weight_contig = weight.contiguous();
@@ -390,8 +490,10 @@ Tensor fbgemm_pack_gemm_matrix_fp16(const Tensor& weight) {
       c10::make_intrusive<PackedLinearWeightFp16>(std::move(ptr), c10::nullopt);
   auto unique_ptr_wrapper =
       std::make_unique<decltype(packed_weight)>(std::move(packed_weight));
-  return cpp_custom_type_hack::create(
+  Tensor packed = cpp_custom_type_hack::create(
       std::move(unique_ptr_wrapper), weight.options());
+  cache.Insert(key, weight, packed);
+  return packed;
 }
 
 Tensor fbgemm_linear_fp16_weight_fp32_activation(
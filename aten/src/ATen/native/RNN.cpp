@@ -2,6 +2,7 @@
 
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/core/op_registration/op_registration.h>
 #include <ATen/cpp_custom_type_hack.h>
 #include <ATen/native/quantized/cpu/packed_params.h>
@@ -763,6 +764,23 @@ struct SimpleCell : Cell<Tensor, cell_params> {
   }
 };
 
+// The fused CPU cell below bypasses autograd, so it may only run when no
+// graph is being recorded for any of its inputs; the tensor-op chain stays
+// as the differentiable reference implementation.
+bool can_use_fused_lstm_cell(const Tensor& gates, const Tensor& cx) {
+  if (at::GradMode::is_enabled() &&
+      (gates.requires_grad() || cx.requires_grad())) {
+    return false;
+  }
+  if (!gates.is_contiguous() || !cx.is_contiguous()) {
+    return false;
+  }
+  if (gates.scalar_type() != cx.scalar_type()) {
+    return false;
+  }
+  return gates.scalar_type() == kFloat || gates.scalar_type() == kDouble;
+}
+
 // TODO: can use inplace ops?
 template <typename cell_params>
 struct LSTMCell : Cell<std::tuple<Tensor, Tensor>, cell_params> {
@@ -790,6 +808,16 @@ struct LSTMCell : Cell<std::tuple<Tensor, Tensor>, cell_params> {
 
     const auto gates = params.linear_hh(hx).add_(
         pre_compute_input ? input : params.linear_ih(input));
+    if (can_use_fused_lstm_cell(gates, cx)) {
+      // Inference fast path: one vectorized pass over the packed gate buffer
+      // instead of the chain of slice/activation/mul ops below, which
+      // allocates an intermediate per op at every timestep.
+      auto hy = at::empty_like(cx, at::MemoryFormat::Contiguous);
+      auto cy = at::empty_like(cx, at::MemoryFormat::Contiguous);
+      fused_lstm_cell_cpu_stub(kCPU, hy, cy, gates, cx);
+      hy = params.matmul_hr(hy);
+      return std::make_tuple(std::move(hy), std::move(cy));
+    }
     auto chunked_gates = gates.unsafe_chunk(4, 1);
     auto ingate = chunked_gates[0].sigmoid_();
     auto forgetgate = chunked_gates[1].sigmoid_();
@@ -1471,6 +1499,8 @@ using relu_cell_type = SimpleCell<relu_f, CellParams>;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 ONE_HIDDEN_RNN(rnn_relu, relu_cell_type);
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(fused_lstm_cell_cpu_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(lstm_cudnn_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -1,7 +1,10 @@
 #include <ATen/ATen.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/native/Repeat.h>
 #include <ATen/Parallel.h>
 
+#include <cstring>
+
 template <typename index_t>
 static void compute_cpu(index_t *repeat_ptr, int64_t *cumsum_ptr, index_t *result_ptr, int64_t size) {
   at::parallel_for(0, size, 1, [&](int64_t i_begin, int64_t i_end) {
@@ -27,6 +30,47 @@ Tensor repeat_interleave_cpu(const Tensor &repeat) {
   return output;
 }
 
+namespace {
+
+// Fast path for repeating along dim 0 of a contiguous CPU tensor: instead of
+// materializing the index map and gathering element-wise through index_select,
+// copy each input row into its (disjoint) output range as repeats[i] block
+// copies. The cumsum of repeats doubles as the prefix sum locating each row's
+// output offset, so the loop over input rows parallelizes without any
+// coordination.
+Tensor repeat_interleave_dim0_cpu(const Tensor& input, const Tensor& repeats) {
+  TORCH_CHECK((repeats >= 0).all().item<uint8_t>(), "repeats can not be negative");
+  int64_t n_rows = input.size(0);
+  Tensor cumsum = repeats.cumsum(0);
+  int64_t total = n_rows > 0 ? cumsum[-1].item<int64_t>() : 0;
+  auto output_size = input.sizes().vec();
+  output_size[0] = total;
+  Tensor result = at::empty(output_size, input.options());
+  if (result.numel() == 0) {
+    return result;
+  }
+
+  int64_t row_bytes = (input.numel() / n_rows) * input.element_size();
+  const char* src = static_cast<const char*>(input.data_ptr());
+  char* dst = static_cast<char*>(result.data_ptr());
+  const int64_t* cumsum_ptr = cumsum.data_ptr<int64_t>();
+  at::parallel_for(0, n_rows, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      int64_t row_start = (i == 0) ? 0 : cumsum_ptr[i - 1];
+      int64_t row_end = cumsum_ptr[i];
+      const char* src_row = src + i * row_bytes;
+      char* out = dst + row_start * row_bytes;
+      for (int64_t j = row_start; j < row_end; j++) {
+        std::memcpy(out, src_row, row_bytes);
+        out += row_bytes;
+      }
+    }
+  });
+  return result;
+}
+
+} // anonymous namespace
+
 Tensor repeat_interleave(const Tensor &self, const Tensor &repeats, c10::optional<int64_t> dim) {
   Tensor input = self;
   if(!dim) {
@@ -45,6 +89,16 @@ Tensor repeat_interleave(const Tensor &self, const Tensor &repeats, c10::optiona
     AT_ERROR("repeats must be 0-dim or 1-dim tensor");
   }
 
+  // this wrapper is composite, so the block-copy path must not be taken when
+  // autograd needs to record the index_select
+  if (input.device().is_cpu() && input.layout() == kStrided &&
+      !input.is_quantized() && input.dim() >= 1 &&
+      maybe_wrap_dim(dim.value(), input.dim()) == 0 &&
+      input.is_contiguous() && repeats_.dim() == 1 &&
+      !(at::GradMode::is_enabled() && input.requires_grad())) {
+    return repeat_interleave_dim0_cpu(input, repeats_.contiguous());
+  }
+
   return input.index_select(dim.value(), at::repeat_interleave(repeats_));
 }
 
@@ -3,6 +3,11 @@
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace at {
 namespace native {
@@ -12,6 +17,52 @@ DEFINE_DISPATCH(_segment_reduce_stub);
 
 namespace {
 
+template <typename scalar_t>
+inline scalar_t max_with_nan(scalar_t acc, scalar_t val) {
+  return at::_isnan(val) ? val : std::max<scalar_t>(acc, val);
+}
+
+// Reduces one contiguous run of values, starting from `acc`. The vectorized
+// overload keeps the NaN-propagating semantics of max_with_nan via
+// vec256::maximum.
+template <typename scalar_t>
+inline typename std::enable_if<
+    !(std::is_same<scalar_t, float>::value ||
+      std::is_same<scalar_t, double>::value),
+    scalar_t>::type
+reduce_run_max(const scalar_t* data, int64_t n, scalar_t acc) {
+  for (int64_t i = 0; i < n; ++i) {
+    acc = max_with_nan(acc, data[i]);
+  }
+  return acc;
+}
+
+template <typename scalar_t>
+inline typename std::enable_if<
+    std::is_same<scalar_t, float>::value ||
+        std::is_same<scalar_t, double>::value,
+    scalar_t>::type
+reduce_run_max(const scalar_t* data, int64_t n, scalar_t acc) {
+  using Vec = vec256::Vec256<scalar_t>;
+  int64_t i = 0;
+  if (n >= Vec::size()) {
+    Vec acc_vec = Vec::loadu(data);
+    for (i = Vec::size(); i + Vec::size() <= n; i += Vec::size()) {
+      acc_vec = vec256::maximum(acc_vec, Vec::loadu(data + i));
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    scalar_t buffer[Vec::size()];
+    acc_vec.store(buffer);
+    for (int64_t j = 0; j < Vec::size(); ++j) {
+      acc = max_with_nan(acc, buffer[j]);
+    }
+  }
+  for (; i < n; ++i) {
+    acc = max_with_nan(acc, data[i]);
+  }
+  return acc;
+}
+
 Tensor _segment_reduce_cpu_kernel(
     const Tensor& data,
     const Tensor& lengths,
@@ -42,19 +93,85 @@ Tensor _segment_reduce_cpu_kernel(
       ([&]() {
         auto* output_data = output.data_ptr<scalar_t>();
         const auto* values_data = data_contig.data_ptr<scalar_t>();
-        int64_t k = 0;
+        const scalar_t init = std::numeric_limits<scalar_t>::lowest();
+
+        // Segment boundaries, so chunks of the value range can be mapped
+        // back to the segments they intersect.
+        std::vector<int64_t> offsets(batch_size + 1);
+        offsets[0] = 0;
         for (int64_t i = 0; i < batch_size; ++i) {
-          scalar_t reduction = std::numeric_limits<scalar_t>::lowest();
-          for (int64_t j = 0; j < lengths_data[i]; ++j) {
-            const auto data = values_data[k];
-            reduction =
-                at::_isnan(data) ? data : std::max<scalar_t>(reduction, data);
-            k++;
+          offsets[i + 1] = offsets[i] + lengths_data[i];
+        }
+        const int64_t numel = offsets[batch_size];
+
+        // If unsafe is false, the check on lengths above covers cases where
+        // lengths for a particular segment is non-positive. If unsafe is
+        // true, zero-length segments simply stay at the numerical limit for
+        // the reduction; prefilling also spares the chunk loop from having
+        // to track them at chunk boundaries.
+        std::fill(output_data, output_data + batch_size, init);
+        if (numel == 0) {
+          return;
+        }
+
+        // Partition the values - not the segments - across threads, so one
+        // giant segment still spreads over all of them. Each chunk reduces
+        // the slices of the segments it overlaps; slices it covers
+        // completely go straight to the output, and the (at most two)
+        // partial slices at the chunk edges are merged serially afterwards.
+        const int64_t num_chunks = std::min<int64_t>(
+            at::get_num_threads(), divup(numel, internal::GRAIN_SIZE));
+        const int64_t chunk_size = divup(numel, num_chunks);
+        std::vector<int64_t> partial_seg(2 * num_chunks, -1);
+        std::vector<scalar_t> partial_val(2 * num_chunks, init);
+
+        at::parallel_for(
+            0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+              for (int64_t chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+                const int64_t begin = chunk * chunk_size;
+                const int64_t end = std::min(begin + chunk_size, numel);
+                // First segment reaching past `begin`.
+                int64_t s =
+                    std::upper_bound(
+                        offsets.begin() + 1, offsets.end(), begin) -
+                    (offsets.begin() + 1);
+                int64_t slot = 2 * chunk;
+                for (; s < batch_size && offsets[s] < end; ++s) {
+                  const int64_t lo = std::max(offsets[s], begin);
+                  const int64_t hi = std::min(offsets[s + 1], end);
+                  const scalar_t partial =
+                      reduce_run_max(values_data + lo, hi - lo, init);
+                  if (lo == offsets[s] && hi == offsets[s + 1]) {
+                    output_data[s] = partial;
+                  } else {
+                    partial_seg[slot] = s;
+                    partial_val[slot] = partial;
+                    ++slot;
+                  }
+                }
+              }
+            });
+
+        // Merge the chunk-edge slices. Records appear in chunk order, so
+        // all partials of one segment are adjacent.
+        int64_t cur_seg = -1;
+        scalar_t cur_val = init;
+        for (size_t slot = 0; slot < partial_seg.size(); ++slot) {
+          if (partial_seg[slot] < 0) {
+            continue;
           }
-          // If unsafe is false, check on lengths or indices should cover cases
-          // where lengths for a particular segment is non-positive. If unsafe
-          // is true, simply set to numerical limits for particular reduction
-          output_data[i] = reduction;
+          if (partial_seg[slot] != cur_seg) {
+            if (cur_seg >= 0) {
+              output_data[cur_seg] = cur_val;
+            }
+            cur_seg = partial_seg[slot];
+            cur_val = partial_val[slot];
+          } else {
+            cur_val = max_with_nan(cur_val, partial_val[slot]);
+          }
+        }
+        if (cur_seg >= 0) {
+          output_data[cur_seg] = cur_val;
         }
       }));
 
@@ -2,14 +2,56 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 
 #include <tuple>
+#include <vector>
 
 namespace at { namespace native {
 
 ///////////////// bincount /////////////////
 namespace {
 
+// Scatters the (optionally weighted) counts of self into output. Large
+// inputs are processed with one private histogram per thread — scattering
+// into a shared histogram would race — which are then merged in parallel
+// over chunks of bins so that a large bin count does not serialize the
+// merge. `weights_p` may be null, in which case every element counts as one.
+template <typename input_t, typename acc_t>
+void _bincount_cpu_accumulate(
+    const input_t* self_p,
+    int64_t self_size,
+    const acc_t* weights_p,
+    acc_t* output_p,
+    int64_t nbins) {
+  const int num_threads = at::get_num_threads();
+  if (self_size < at::internal::GRAIN_SIZE || num_threads == 1) {
+    for (int64_t i = 0; i < self_size; i++) {
+      output_p[self_p[i]] += weights_p ? weights_p[i] : static_cast<acc_t>(1);
+    }
+    return;
+  }
+  std::vector<acc_t> partial(
+      static_cast<size_t>(num_threads) * nbins, static_cast<acc_t>(0));
+  at::parallel_for(
+      0, self_size, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        acc_t* hist =
+            partial.data() + static_cast<int64_t>(at::get_thread_num()) * nbins;
+        for (int64_t i = begin; i < end; i++) {
+          hist[self_p[i]] += weights_p ? weights_p[i] : static_cast<acc_t>(1);
+        }
+      });
+  at::parallel_for(
+      0, nbins, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (int t = 0; t < num_threads; t++) {
+          const acc_t* hist = partial.data() + static_cast<int64_t>(t) * nbins;
+          for (int64_t b = begin; b < end; b++) {
+            output_p[b] += hist[b];
+          }
+        }
+      });
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -45,15 +87,12 @@ Tensor _bincount_cpu_template(
         weights.options().pinned_memory_opt());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (int64_t i = 0; i < self_size; i++) {
-      output_p[self_p[i]] += weights_p[i];
-    }
+    _bincount_cpu_accumulate(self_p, self_size, weights_p, output_p, nbins);
   } else {
     output = native::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (int64_t i = 0; i < self_size; i++) {
-      output_p[self_p[i]] += 1L;
-    }
+    _bincount_cpu_accumulate(
+        self_p, self_size, static_cast<const int64_t*>(nullptr), output_p, nbins);
   }
   return output;
 }
@@ -32,6 +32,8 @@ namespace native {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(cat_serial_stub);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(cat_contig_stub);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -213,6 +215,14 @@ Tensor & _cat_out_cpu(TensorList tensors, int64_t dim, Tensor& result) {
     return result;
   }
 
+  // large contiguous same-dtype concatenations take the parallel block-copy
+  // kernel: one pointer table instead of a TensorIterator per input, with
+  // threads owning disjoint output spans
+  if (allContiguous && no_type_promotion) {
+    cat_contig_stub(kCPU, result, tensors, dim);
+    return result;
+  }
+
   int64_t offset = 0;
   if (reuse_iterator &&
       result.is_contiguous(first_tensor_mem_format) &&
@@ -84,6 +84,9 @@ DECLARE_DISPATCH(void(*)(TensorIteratorBase&, const Scalar& a, const Scalar& b),
 DECLARE_DISPATCH(
     void (*)(Tensor&, const Tensor&, int64_t, c10::optional<Generator>),
     multinomial_with_replacement_stub);
+DECLARE_DISPATCH(
+    void (*)(Tensor&, const Tensor&, const Tensor&, c10::optional<Generator>),
+    multinomial_alias_draw_stub);
 DECLARE_DISPATCH(
     void (*)(
         TensorIteratorBase&,
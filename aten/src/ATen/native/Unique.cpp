@@ -2,17 +2,109 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 
+#include <algorithm>
+#include <mutex>
 #include <set>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace at {
 namespace native{
 
 namespace {
 
+// Parallel hash path for large integer inputs when sorted output is not
+// requested: each chunk of the input builds its own hash set, the sets are
+// merged in chunk order into one value -> output-index table, and the inverse
+// mapping and counts are produced from that table (lookups are concurrent,
+// count merging is per chunk under a lock). Unlike the generic template below
+// there is no whole-input serial set construction and no extra per-output
+// maps for inverse/counts.
+template <typename scalar_t>
+std::tuple<Tensor, Tensor, Tensor> unique_unsorted_hash_cpu_template(
+    const Tensor& self,
+    const bool return_inverse,
+    const bool return_counts) {
+  const Tensor& input = self.contiguous();
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  int64_t numel = input.numel();
+  Tensor inverse_indices = at::empty({0}, self.options().dtype(kLong));
+  Tensor counts = at::empty({0}, self.options().dtype(kLong));
+
+  const int64_t chunk_size = std::max<int64_t>(
+      at::internal::GRAIN_SIZE,
+      (numel + at::get_num_threads() - 1) / std::max(1, at::get_num_threads()));
+  const int64_t n_chunks = (numel + chunk_size - 1) / chunk_size;
+
+  std::vector<std::unordered_set<scalar_t>> chunk_sets(n_chunks);
+  at::parallel_for(0, n_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t c = begin; c < end; c++) {
+      int64_t chunk_begin = c * chunk_size;
+      int64_t chunk_end = std::min(numel, chunk_begin + chunk_size);
+      chunk_sets[c].insert(input_data + chunk_begin, input_data + chunk_end);
+    }
+  });
+
+  // merge in chunk order so the result does not depend on hash iteration
+  // interleaving across runs with different thread counts
+  size_t max_uniques = 0;
+  for (const auto& set : chunk_sets) {
+    max_uniques += set.size();
+  }
+  std::unordered_map<scalar_t, int64_t> index_map;
+  index_map.reserve(max_uniques);
+  std::vector<scalar_t> uniques;
+  uniques.reserve(max_uniques);
+  for (const auto& set : chunk_sets) {
+    for (const scalar_t v : set) {
+      if (index_map.emplace(v, static_cast<int64_t>(uniques.size())).second) {
+        uniques.push_back(v);
+      }
+    }
+  }
+
+  Tensor output = at::empty({static_cast<int64_t>(uniques.size())}, input.options());
+  std::copy(uniques.begin(), uniques.end(), output.data_ptr<scalar_t>());
+
+  if (return_inverse) {
+    inverse_indices.resize_(input.sizes());
+    int64_t* inverse_indices_data = inverse_indices.data_ptr<int64_t>();
+    at::parallel_for(0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; i++) {
+        inverse_indices_data[i] = index_map.find(input_data[i])->second;
+      }
+    });
+  }
+
+  if (return_counts) {
+    counts.resize_(output.sizes());
+    counts.zero_();
+    int64_t* counts_data = counts.data_ptr<int64_t>();
+    std::mutex mutex;
+    at::parallel_for(0, n_chunks, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t c = begin; c < end; c++) {
+        int64_t chunk_begin = c * chunk_size;
+        int64_t chunk_end = std::min(numel, chunk_begin + chunk_size);
+        std::unordered_map<scalar_t, int64_t> local_counts;
+        local_counts.reserve(chunk_sets[c].size());
+        for (int64_t i = chunk_begin; i < chunk_end; i++) {
+          local_counts[input_data[i]] += 1;
+        }
+        std::lock_guard<std::mutex> guard(mutex);
+        for (const auto& entry : local_counts) {
+          counts_data[index_map.find(entry.first)->second] += entry.second;
+        }
+      }
+    });
+  }
+
+  return std::make_tuple(output, inverse_indices, counts);
+}
+
 template <typename scalar_t>
 std::tuple<Tensor, Tensor, Tensor> unique_cpu_template(
     const Tensor& self,
@@ -234,8 +326,20 @@ std::tuple<Tensor, Tensor, Tensor> _unique_dim_cpu_template(
 } // namespace
 
 
+static bool use_unsorted_hash_unique(const Tensor& self, const bool sorted) {
+  return !sorted && self.numel() >= at::internal::GRAIN_SIZE &&
+      at::isIntegralType(self.scalar_type(), /*includeBool=*/false);
+}
+
 std::tuple<Tensor, Tensor>
 _unique_cpu(const Tensor& self, const bool sorted, const bool return_inverse) {
+  if (use_unsorted_hash_unique(self, sorted)) {
+    return AT_DISPATCH_INTEGRAL_TYPES(self.scalar_type(), "unique", [&] {
+      Tensor output, inverse;
+      std::tie(output, inverse, std::ignore) = unique_unsorted_hash_cpu_template<scalar_t>(self, return_inverse, false);
+      return std::make_tuple(output, inverse);
+    });
+  }
   return AT_DISPATCH_ALL_TYPES_AND(at::ScalarType::Bool, self.scalar_type(), "unique", [&] {
     Tensor output, inverse;
     std::tie(output, inverse, std::ignore) = unique_cpu_template<scalar_t>(self, sorted, return_inverse, false);
@@ -245,6 +349,11 @@ _unique_cpu(const Tensor& self, const bool sorted, const bool return_inverse) {
 
 std::tuple<Tensor, Tensor, Tensor>
 _unique2_cpu(const Tensor& self, const bool sorted, const bool return_inverse, const bool return_counts) {
+  if (use_unsorted_hash_unique(self, sorted)) {
+    return AT_DISPATCH_INTEGRAL_TYPES(self.scalar_type(), "unique", [&] {
+      return unique_unsorted_hash_cpu_template<scalar_t>(self, return_inverse, return_counts);
+    });
+  }
   return AT_DISPATCH_ALL_TYPES_AND(at::ScalarType::Bool, self.scalar_type(), "unique", [&] {
     return unique_cpu_template<scalar_t>(self, sorted, return_inverse, return_counts);
   });
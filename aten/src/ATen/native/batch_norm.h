@@ -11,6 +11,19 @@ using batch_norm_fn = void (*)(Tensor&, const Tensor&, const Tensor&,
     const Tensor&, const Tensor&, const Tensor&, double);
 
 DECLARE_DISPATCH(batch_norm_fn, batch_norm_cpu_inference_contiguous_stub);
+DECLARE_DISPATCH(batch_norm_fn, batch_norm_cpu_inference_relu_stub);
+
+/// Fused inference-only batch_norm followed by relu, clamping in-register
+/// so the activation does not re-read and re-write the normalized tensor.
+/// Falls back to batch_norm + relu when the fused CPU kernel does not
+/// apply. Used by the frozen graph BN+ReLU fusion pass.
+TORCH_API Tensor batch_norm_relu_inference(
+    const Tensor& input,
+    const c10::optional<Tensor>& weight,
+    const c10::optional<Tensor>& bias,
+    const c10::optional<Tensor>& running_mean,
+    const c10::optional<Tensor>& running_var,
+    double eps);
 
 } // namespace native
 
@@ -1,4 +1,5 @@
 #include <ATen/Dispatch.h>
+#include <ATen/cpu/vec256/vec256.h>
 #include <ATen/native/CPUBlas.h>
 
 namespace at {
@@ -167,6 +168,103 @@ void gemm_core_(
   }
 }
 
+// Computes `col_tile` columns of c starting at column j, vectorized along m
+// with one accumulator register per column. Requires transa == NoTranspose so
+// that columns of a (and c) are contiguous.
+template <typename scalar_t, int col_tile>
+void gemm_small_cols_(
+    int64_t m, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t b_l_stride, int64_t b_j_stride,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc,
+    int64_t j) {
+  using Vec = vec256::Vec256<scalar_t>;
+  const Vec alpha_vec(alpha);
+  const Vec beta_vec(beta);
+  int64_t i = 0;
+  for (; i + Vec::size() <= m; i += Vec::size()) {
+    Vec acc[col_tile];
+    for (int jj = 0; jj < col_tile; jj++) {
+      acc[jj] = Vec(scalar_t(0));
+    }
+    for (int64_t l = 0; l < k; l++) {
+      const Vec a_vec = Vec::loadu(a + i + l * lda);
+      for (int jj = 0; jj < col_tile; jj++) {
+        acc[jj] = acc[jj] + a_vec * Vec(b[l * b_l_stride + (j + jj) * b_j_stride]);
+      }
+    }
+    for (int jj = 0; jj < col_tile; jj++) {
+      scalar_t *c_ptr = c + i + (j + jj) * ldc;
+      Vec out = acc[jj] * alpha_vec;
+      if (beta != scalar_t(0)) {
+        out = out + Vec::loadu(c_ptr) * beta_vec;
+      }
+      out.store(c_ptr);
+    }
+  }
+  for (; i < m; i++) {
+    for (int jj = 0; jj < col_tile; jj++) {
+      scalar_t sum = 0;
+      for (int64_t l = 0; l < k; l++) {
+        sum += a[i + l * lda] * b[l * b_l_stride + (j + jj) * b_j_stride];
+      }
+      scalar_t *c_ptr = c + i + (j + jj) * ldc;
+      *c_ptr = beta == scalar_t(0) ? alpha * sum : alpha * sum + beta * *c_ptr;
+    }
+  }
+}
+
+template <typename scalar_t>
+void gemm_small_(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc) {
+  if (transa != NoTranspose) {
+    // With a transposed, each output needs a strided walk over a row of a;
+    // the plain dot-product kernels already handle that layout well.
+    return gemm_core_(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+  }
+  const int64_t b_l_stride = transb == NoTranspose ? 1 : ldb;
+  const int64_t b_j_stride = transb == NoTranspose ? ldb : 1;
+  constexpr int kColTile = 4;
+  int64_t j = 0;
+  for (; j + kColTile <= n; j += kColTile) {
+    gemm_small_cols_<scalar_t, kColTile>(
+        m, k, alpha, a, lda, b, b_l_stride, b_j_stride, beta, c, ldc, j);
+  }
+  for (; j < n; j++) {
+    gemm_small_cols_<scalar_t, 1>(
+        m, k, alpha, a, lda, b, b_l_stride, b_j_stride, beta, c, ldc, j);
+  }
+}
+
+void cpublas_gemm_small_impl(
+    at::ScalarType type,
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    const Scalar& alpha,
+    const void *a, int64_t lda,
+    const void *b, int64_t ldb,
+    const Scalar& beta,
+    void *c, int64_t ldc) {
+  AT_DISPATCH_FLOATING_TYPES(type, "cpublas_gemm_small_impl",
+      [&]{
+        gemm_small_(
+            transa, transb, m, n, k,
+            alpha.to<scalar_t>(),
+            static_cast<const scalar_t *>(a), lda,
+            static_cast<const scalar_t *>(b), ldb,
+            beta.to<scalar_t>(),
+            static_cast<scalar_t *>(c), ldc);
+      });
+}
+
 void cpublas_gemm_impl(
     at::ScalarType type,
     TransposeType transa, TransposeType transb,
@@ -218,6 +316,8 @@ void cpublas_copy_impl(at::ScalarType type, int64_t n, const void *_x, int64_t i
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(cpublas::gemm_stub, &cpublas::cpublas_gemm_impl);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(cpublas::gemm_small_stub, &cpublas::cpublas_gemm_small_impl);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(cpublas::axpy_stub, &cpublas::cpublas_axpy_impl);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(cpublas::copy_stub, &cpublas::cpublas_copy_impl);
@@ -0,0 +1,406 @@
+// CPU kernels for the Connectionist Temporal Loss (see native/LossCTC.cpp for
+// the wrappers and the argument checking). The recursions follow Graves et al:
+// http://www.cs.toronto.edu/~graves/icml_2006.pdf, computed in log space for
+// numerical stability.
+//
+// Within one time step the alpha (and beta) row only depends on the previous
+// (next) row, so the loop over s is vectorized: the three log-sum-exp summands
+// are unaligned loads of the neighbouring row at offsets s, s-1 and s-2. The
+// augmented target sequence l' and the "repeated character" exclusion of eq (6)
+// do not depend on t, so both are precomputed per batch element; the exclusion
+// is folded into a per-s additive penalty (0 or -inf), which keeps the vector
+// loop branch free.
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <ATen/native/LossCTC.h>
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+namespace at { namespace native {
+
+namespace {
+
+// this ad-hoc converts from targets (l in [1]) to augmented targets (l' in [1]) note that no bound-checking is done
+template<typename target_t>
+static inline int64_t get_target_prime(const target_t* target, int64_t offset, int64_t stride, int64_t idx, int64_t BLANK) {
+  if (idx % 2 == 0) {
+    return BLANK;
+  } else {
+    return target[offset + stride * (idx / 2)];
+  }
+}
+
+template <typename target_t>
+std::tuple<std::vector<int64_t>, int64_t, int64_t> ctc_target_layout(
+    const Tensor& targets, IntArrayRef target_lengths, int64_t batch_size) {
+  int64_t tg_target_stride;
+  int64_t max_target_length = 0;
+  std::vector<int64_t> tg_batch_offsets(batch_size);
+  if (targets.dim() == 1) { // concatenated targets
+    int64_t pos = 0;
+    for (int64_t i = 0; i < batch_size; i++) {
+      tg_batch_offsets[i] = pos;
+      pos += target_lengths[i];
+      if (max_target_length < target_lengths[i])
+        max_target_length = target_lengths[i];
+    }
+    tg_target_stride = targets.stride(0);
+  } else { // batch x max_target_length
+    int64_t tg_batch_stride = targets.stride(0);
+    for (int64_t i = 0; i < batch_size; i++) {
+      tg_batch_offsets[i] = i * tg_batch_stride;
+      if (max_target_length < target_lengths[i])
+        max_target_length = target_lengths[i];
+    }
+    tg_target_stride = targets.stride(1);
+  }
+  return std::make_tuple(std::move(tg_batch_offsets), tg_target_stride, max_target_length);
+}
+
+// The alpha recursion of the forward backward algorithm (section 4.1), eq (6)
+// and (7). log_probs is expected contiguous; log_alpha is batch_size x
+// max_input_length x (2 * max_target_length + 1).
+template <typename scalar_t, typename target_t>
+void cpu_ctc_loss(
+    Tensor& log_alpha,
+    Tensor& neg_log_likelihood,
+    const Tensor& log_probs,
+    const Tensor& targets,
+    IntArrayRef input_lengths,
+    IntArrayRef target_lengths,
+    int64_t BLANK) {
+  using Vec = vec256::Vec256<scalar_t>;
+  constexpr scalar_t neginf = -std::numeric_limits<scalar_t>::infinity();
+
+  int64_t max_input_length = log_probs.size(0);
+  int64_t batch_size = log_probs.size(1);
+  int64_t num_labels = log_probs.size(2);
+  int64_t max_target_length = 0;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t tg_target_stride;
+  std::vector<int64_t> tg_batch_offsets;
+  std::tie(tg_batch_offsets, tg_target_stride, max_target_length) =
+      ctc_target_layout<target_t>(targets, target_lengths, batch_size);
+  (void)max_target_length;
+  int64_t s_max = log_alpha.size(2); // 2 * max_target_length + 1
+
+  // alpha calculation for the first row, the three equations for alpha_1 above eq (6)
+  // first the default
+  log_alpha.narrow(1, 0, 1).fill_(neginf);
+
+  const scalar_t* log_probs_data = log_probs.data_ptr<scalar_t>();
+  scalar_t* log_alpha_data = log_alpha.data_ptr<scalar_t>();
+  scalar_t* nll_data = neg_log_likelihood.data_ptr<scalar_t>();
+  const target_t* targets_data = targets.data_ptr<target_t>();
+
+  at::parallel_for(0, batch_size, 0, [&](int64_t begin, int64_t end) {
+    // per-thread scratch: the augmented targets l' and the additive penalty
+    // encoding the third-summand exclusion of eq (6); both are t-invariant
+    std::vector<int64_t> target_prime(s_max);
+    std::vector<scalar_t> skip_penalty(s_max, neginf);
+    std::array<scalar_t, Vec::size()> lp_gathered;
+    for (int64_t b = begin; b < end; b++) {
+      int64_t input_length = input_lengths[b];
+      int64_t target_length = target_lengths[b];
+      int64_t tg_batch_offset = tg_batch_offsets[b];
+      int64_t s_len = 2 * target_length + 1;
+
+      for (int64_t s = 0; s < s_len; s++) {
+        target_prime[s] = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+      }
+      for (int64_t s = 2; s < s_len; s++) {
+        skip_penalty[s] = (target_prime[s - 2] != target_prime[s]) ? scalar_t(0) : neginf;
+      }
+
+      scalar_t* log_alpha_b = log_alpha_data + b * max_input_length * s_max;
+      const scalar_t* lp_row = log_probs_data + b * num_labels;
+
+      // the first two items of alpha_t above eq (6)
+      log_alpha_b[0] = lp_row[BLANK];
+      if (target_length > 0)
+        log_alpha_b[1] = lp_row[target_prime[1]];
+
+      // now the loop over the inputs
+      for (int64_t t = 1; t < input_length; t++) {
+        const scalar_t* prev = log_alpha_b + (t - 1) * s_max;
+        scalar_t* cur = log_alpha_b + t * s_max;
+        lp_row = log_probs_data + (t * batch_size + b) * num_labels;
+
+        // This is eq (6) and (7), la1,2,3 are the three summands. We keep
+        // track of the maximum for the logsumexp calculation.
+        auto alpha_scalar = [&](int64_t s) {
+          scalar_t la1 = prev[s];
+          scalar_t lamax = la1;
+          scalar_t la2 = (s > 0) ? prev[s - 1] : neginf;
+          if (la2 > lamax)
+            lamax = la2;
+          scalar_t la3 = (s > 1) ? prev[s - 2] + skip_penalty[s] : neginf;
+          if (la3 > lamax)
+            lamax = la3;
+          if (lamax == neginf) // cannot do neginf-neginf
+            lamax = 0;
+          // this is the assignment of eq (6)
+          cur[s] = std::log(std::exp(la1 - lamax) + std::exp(la2 - lamax) + std::exp(la3 - lamax)) + lamax + lp_row[target_prime[s]];
+        };
+
+        int64_t s = 0;
+        for (; s < std::min<int64_t>(2, s_len); s++) {
+          alpha_scalar(s);
+        }
+        const Vec neginf_vec(neginf);
+        for (; s + Vec::size() <= s_len; s += Vec::size()) {
+          Vec la1 = Vec::loadu(prev + s);
+          Vec la2 = Vec::loadu(prev + s - 1);
+          Vec la3 = Vec::loadu(prev + s - 2) + Vec::loadu(skip_penalty.data() + s);
+          Vec lamax = vec256::maximum(la1, vec256::maximum(la2, la3));
+          lamax = Vec::blendv(lamax, Vec(scalar_t(0)), lamax == neginf_vec);
+          for (int64_t k = 0; k < Vec::size(); k++) {
+            lp_gathered[k] = lp_row[target_prime[s + k]];
+          }
+          Vec sum = (la1 - lamax).exp() + (la2 - lamax).exp() + (la3 - lamax).exp();
+          (sum.log() + lamax + Vec::loadu(lp_gathered.data())).store(cur + s);
+        }
+        for (; s < s_len; s++) {
+          alpha_scalar(s);
+        }
+      }
+
+      // the likelihood is the the sum of the last two alphas, eq (8), the loss is the negative log likelihood
+      const scalar_t* last = log_alpha_b + (input_length - 1) * s_max;
+      if (target_length == 0) {
+        // if the target is empty then there is no preceding BLANK state and hence there is no path to merge
+        nll_data[b] = -last[0];
+      } else {
+        scalar_t l1 = last[target_length * 2];
+        scalar_t l2 = last[target_length * 2 - 1];
+        scalar_t m = std::max(l1, l2);
+        m = ((m == neginf) ? 0 : m);
+        scalar_t log_likelihood = std::log(std::exp(l1 - m) + std::exp(l2 - m)) + m;
+        nll_data[b] = -log_likelihood;
+      }
+    }
+  });
+}
+
+// The beta recursion (eq (10) and (11)) fused with the gradient collection and
+// wrap-up of eq (16). For each t the beta row is produced by the vector loop
+// and the alpha * beta terms are collected into grad while the row is still in
+// cache; the scatter per s stays scalar because several s can map to the same
+// target character.
+template <typename scalar_t, typename target_t>
+void cpu_ctc_loss_backward(
+    Tensor& grad,
+    const Tensor& grad_out,
+    const Tensor& log_probs,
+    const Tensor& targets,
+    IntArrayRef input_lengths,
+    IntArrayRef target_lengths,
+    const Tensor& neg_log_likelihood,
+    const Tensor& log_alpha,
+    int64_t BLANK,
+    bool zero_infinity) {
+  using Vec = vec256::Vec256<scalar_t>;
+  constexpr scalar_t neginf = -std::numeric_limits<scalar_t>::infinity();
+
+  int64_t max_input_length = log_probs.size(0);
+  int64_t batch_size = log_probs.size(1);
+  int64_t num_labels = log_probs.size(2);
+  int64_t max_target_length = 0;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t tg_target_stride;
+  std::vector<int64_t> tg_batch_offsets;
+  std::tie(tg_batch_offsets, tg_target_stride, max_target_length) =
+      ctc_target_layout<target_t>(targets, target_lengths, batch_size);
+  (void)max_target_length;
+  // row stride of log_beta must match the log_alpha the forward produced
+  int64_t s_max = log_alpha.size(2); // 2 * max_target_length + 1
+
+  Tensor log_beta = at::empty_like(log_alpha, LEGACY_CONTIGUOUS_MEMORY_FORMAT); // could be optimized to use only 2 rows
+
+  const scalar_t* log_probs_data = log_probs.data_ptr<scalar_t>();
+  const scalar_t* log_alpha_data = log_alpha.data_ptr<scalar_t>();
+  scalar_t* log_beta_data = log_beta.data_ptr<scalar_t>();
+  scalar_t* grad_data = grad.data_ptr<scalar_t>();
+  const target_t* targets_data = targets.data_ptr<target_t>();
+  auto grad_out_a = grad_out.accessor<scalar_t, 1>();
+  auto nll_a = neg_log_likelihood.accessor<scalar_t, 1>();
+
+  at::parallel_for(0, batch_size, 0, [&](int64_t begin, int64_t end) {
+    std::vector<int64_t> target_prime(s_max);
+    std::vector<scalar_t> skip_penalty(s_max, neginf);
+    std::array<scalar_t, Vec::size()> lp_gathered;
+    for (int64_t b = begin; b < end; b++) {
+      scalar_t nll = nll_a[b];
+      if (zero_infinity && nll == std::numeric_limits<scalar_t>::infinity()) {
+        grad.narrow(1, b, 1).zero_();
+        continue;
+      }
+
+      int64_t input_length = input_lengths[b];
+      int64_t target_length = target_lengths[b];
+      int64_t tg_batch_offset = tg_batch_offsets[b];
+      int64_t s_len = 2 * target_length + 1;
+
+      for (int64_t s = 0; s < s_len; s++) {
+        target_prime[s] = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+      }
+      // the penalty excluding the third summand of eq (10) for repeated characters
+      for (int64_t s = 0; s < s_len - 2; s++) {
+        skip_penalty[s] = (target_prime[s + 2] != target_prime[s]) ? scalar_t(0) : neginf;
+      }
+
+      const scalar_t* log_alpha_b = log_alpha_data + b * max_input_length * s_max;
+      scalar_t* log_beta_b = log_beta_data + b * max_input_length * s_max;
+
+      // the initialization of beta before eq (10)
+      // here we do the fill for each batch item separately, as the input lengths will differ, so the t in which
+      // we start varies
+      if (input_length > 0) {
+        scalar_t* lb_last = log_beta_b + (input_length - 1) * s_max;
+        const scalar_t* la_last = log_alpha_b + (input_length - 1) * s_max;
+        scalar_t* grad_last = grad_data + ((input_length - 1) * batch_size + b) * num_labels;
+        const scalar_t* lp_last = log_probs_data + ((input_length - 1) * batch_size + b) * num_labels;
+        std::fill(lb_last, lb_last + s_max, neginf);
+        lb_last[2 * target_length] = lp_last[BLANK];
+        grad_last[BLANK] = la_last[2 * target_length] + lb_last[2 * target_length];
+
+        if (target_length > 0) {
+          auto current_target_prime = target_prime[2 * target_length - 1];
+          lb_last[2 * target_length - 1] = lp_last[current_target_prime];
+
+          // the first two are a blank and a non-blank, so we know they are different and we don't need to do log+
+          grad_last[current_target_prime] = la_last[2 * target_length - 1] + lb_last[2 * target_length - 1];
+        }
+      }
+
+      // now loop applying eq (10) / (11)
+      for (int64_t t = input_length - 2; t >= 0; t--) {
+        const scalar_t* next = log_beta_b + (t + 1) * s_max;
+        scalar_t* cur = log_beta_b + t * s_max;
+        const scalar_t* la_row = log_alpha_b + t * s_max;
+        const scalar_t* lp_row = log_probs_data + (t * batch_size + b) * num_labels;
+        scalar_t* grad_row = grad_data + (t * batch_size + b) * num_labels;
+
+        auto beta_scalar = [&](int64_t s) {
+          scalar_t lb1 = next[s];
+          scalar_t lbmax = lb1;
+          scalar_t lb2 = (s < s_len - 1) ? next[s + 1] : neginf;
+          if (lb2 > lbmax)
+            lbmax = lb2;
+          scalar_t lb3 = (s < s_len - 2) ? next[s + 2] + skip_penalty[s] : neginf;
+          if (lb3 > lbmax)
+            lbmax = lb3;
+          if (lbmax == neginf)
+            lbmax = 0;
+          cur[s] = std::log(std::exp(lb1 - lbmax) + std::exp(lb2 - lbmax) + std::exp(lb3 - lbmax)) + lbmax + lp_row[target_prime[s]];
+        };
+
+        int64_t s = 0;
+        const Vec neginf_vec(neginf);
+        for (; s + Vec::size() + 2 <= s_len; s += Vec::size()) {
+          Vec lb1 = Vec::loadu(next + s);
+          Vec lb2 = Vec::loadu(next + s + 1);
+          Vec lb3 = Vec::loadu(next + s + 2) + Vec::loadu(skip_penalty.data() + s);
+          Vec lbmax = vec256::maximum(lb1, vec256::maximum(lb2, lb3));
+          lbmax = Vec::blendv(lbmax, Vec(scalar_t(0)), lbmax == neginf_vec);
+          for (int64_t k = 0; k < Vec::size(); k++) {
+            lp_gathered[k] = lp_row[target_prime[s + k]];
+          }
+          Vec sum = (lb1 - lbmax).exp() + (lb2 - lbmax).exp() + (lb3 - lbmax).exp();
+          (sum.log() + lbmax + Vec::loadu(lp_gathered.data())).store(cur + s);
+        }
+        for (; s < s_len; s++) {
+          beta_scalar(s);
+        }
+
+        // now that we have beta, we fill in the sum of alpha*beta in eq (16)
+        // in contrast to the cuda implementation, we only parallelize over the batch, so we don't have a concurrency
+        // issue (several s can map to the same target character)
+        // collected[b, t, target'[s]] "log+=" log_alpha[t, s]+log_beta[t, s]
+        for (s = 0; s < s_len; s++) {
+          scalar_t log_alpha_beta = la_row[s] + cur[s];
+          scalar_t& lcab = grad_row[target_prime[s]];
+          if (lcab == neginf) {
+            lcab = log_alpha_beta;
+          } else {
+            scalar_t max = std::max(lcab, log_alpha_beta);
+            lcab = std::log(std::exp(lcab - max) + std::exp(log_alpha_beta - max)) + max;
+          }
+        }
+      }
+
+      // now grad has the sum of eq (16)
+      // now we wrap up the calculation by adding in the remaining items of eq (16)
+      // grad is the output gradient, nll is the loss. Note that the likelihood -nll is the Z of eq (16)
+      scalar_t gr = grad_out_a[b];
+      const Vec gr_vec(gr);
+      const Vec nll_vec(nll);
+      for (int64_t t = 0; t < input_length; t++) { // or go for the full thing?
+        scalar_t* grad_row = grad_data + (t * batch_size + b) * num_labels;
+        const scalar_t* lp_row = log_probs_data + (t * batch_size + b) * num_labels;
+        int64_t c = 0;
+        for (; c + Vec::size() <= num_labels; c += Vec::size()) {
+          Vec lp = Vec::loadu(lp_row + c);
+          Vec res = Vec::loadu(grad_row + c);
+          ((lp.exp() - (res + nll_vec - lp).exp()) * gr_vec).store(grad_row + c);
+        }
+        for (; c < num_labels; c++) {
+          scalar_t lp = lp_row[c];
+          grad_row[c] = (std::exp(lp) - std::exp(grad_row[c] + nll - lp)) * gr;
+        }
+      }
+      // zero the remainder
+      if (input_length < max_input_length) {
+        grad.narrow(0, input_length, max_input_length - input_length).narrow(1, b, 1).zero_();
+      }
+    }
+  });
+}
+
+void ctc_loss_kernel_impl(
+    Tensor& log_alpha,
+    Tensor& neg_log_likelihood,
+    const Tensor& log_probs,
+    const Tensor& targets,
+    IntArrayRef input_lengths,
+    IntArrayRef target_lengths,
+    int64_t BLANK) {
+  AT_DISPATCH_FLOATING_TYPES(log_probs.scalar_type(), "ctc_loss_cpu", [&] {
+    if (targets.scalar_type() == kLong) {
+      cpu_ctc_loss<scalar_t, int64_t>(log_alpha, neg_log_likelihood, log_probs, targets, input_lengths, target_lengths, BLANK);
+    } else {
+      cpu_ctc_loss<scalar_t, int>(log_alpha, neg_log_likelihood, log_probs, targets, input_lengths, target_lengths, BLANK);
+    }
+  });
+}
+
+void ctc_loss_backward_kernel_impl(
+    Tensor& grad,
+    const Tensor& grad_out,
+    const Tensor& log_probs,
+    const Tensor& targets,
+    IntArrayRef input_lengths,
+    IntArrayRef target_lengths,
+    const Tensor& neg_log_likelihood,
+    const Tensor& log_alpha,
+    int64_t BLANK,
+    bool zero_infinity) {
+  AT_DISPATCH_FLOATING_TYPES(log_probs.scalar_type(), "ctc_loss_backward_cpu", [&] {
+    if (targets.scalar_type() == kLong) {
+      cpu_ctc_loss_backward<scalar_t, int64_t>(grad, grad_out, log_probs, targets, input_lengths, target_lengths, neg_log_likelihood, log_alpha, BLANK, zero_infinity);
+    } else {
+      cpu_ctc_loss_backward<scalar_t, int>(grad, grad_out, log_probs, targets, input_lengths, target_lengths, neg_log_likelihood, log_alpha, BLANK, zero_infinity);
+    }
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(ctc_loss_stub, &ctc_loss_kernel_impl);
+REGISTER_DISPATCH(ctc_loss_backward_stub, &ctc_loss_backward_kernel_impl);
+
+}} // namespace at::native
@@ -7,5 +7,6 @@ namespace at { namespace native {
 
 using cat_serial_fn = void(*)(Tensor &, TensorList, int64_t);
 DECLARE_DISPATCH(cat_serial_fn, cat_serial_stub);
+DECLARE_DISPATCH(cat_serial_fn, cat_contig_stub);
 
 }}  // namespace at::native
@@ -1,6 +1,7 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
@@ -10,6 +11,77 @@ namespace at {
 namespace native {
 namespace {
 
+// Same-dtype contiguous copies at or above this many bytes write through
+// streaming stores so a huge copy does not evict the working set from the
+// caches; TensorIterator's loop already splits the range across the
+// intra-op pool either way.
+constexpr int64_t kCopyStreamThresholdBytes = int64_t(1) << 25;
+
+bool use_stream_copy(TensorIterator& iter) {
+  return iter.is_contiguous() &&
+      iter.numel() * iter.element_size(0) >= kCopyStreamThresholdBytes;
+}
+
+template <typename scalar_t>
+void copy_contiguous_stream(scalar_t* dst, const scalar_t* src, int64_t numel) {
+  using Vec = Vec256<scalar_t>;
+  at::parallel_for(0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    scalar_t* out = dst + begin;
+    const scalar_t* in = src + begin;
+    scalar_t* const out_end = dst + end;
+    // Streaming stores require vector-width alignment of the destination.
+    while (out < out_end &&
+           (reinterpret_cast<uintptr_t>(out) % sizeof(Vec)) != 0) {
+      *out++ = *in++;
+    }
+    for (; out + Vec::size() <= out_end; out += Vec::size(), in += Vec::size()) {
+      vec256::stream_store(Vec::loadu(in), out);
+    }
+    for (; out < out_end; out++, in++) {
+      *out = *in;
+    }
+    // Each worker must fence its own streaming stores before signaling
+    // completion; an sfence only orders the stores of the core executing it,
+    // so fencing once on the joining thread would not cover the pool's
+    // workers.
+    vec256::stream_sync();
+  });
+}
+
+// Bulk conversion for the mixed-precision pairs (Half|BFloat16) <-> float.
+// Contiguous converting copies go through vec256::convert (F16C for Half,
+// bit shifts for BFloat16) instead of the per-element static_cast loop;
+// at::to on a contiguous tensor funnels into the same copy_stub, so it takes
+// this path as well.
+template <typename dst_t, typename src_t>
+void convert_contiguous(TensorIterator& iter) {
+  dst_t* dst = static_cast<dst_t*>(iter.data_ptr(0));
+  const src_t* src = static_cast<const src_t*>(iter.data_ptr(1));
+  at::parallel_for(0, iter.numel(), internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    vec256::convert(src + begin, dst + begin, end - begin);
+  });
+}
+
+bool try_bulk_cast_copy(TensorIterator& iter) {
+  if (!iter.is_contiguous()) {
+    return false;
+  }
+  const auto dst_dtype = iter.dtype(0);
+  const auto src_dtype = iter.dtype(1);
+  if (dst_dtype == ScalarType::Float && src_dtype == ScalarType::Half) {
+    convert_contiguous<float, at::Half>(iter);
+  } else if (dst_dtype == ScalarType::Half && src_dtype == ScalarType::Float) {
+    convert_contiguous<at::Half, float>(iter);
+  } else if (dst_dtype == ScalarType::Float && src_dtype == ScalarType::BFloat16) {
+    convert_contiguous<float, at::BFloat16>(iter);
+  } else if (dst_dtype == ScalarType::BFloat16 && src_dtype == ScalarType::Float) {
+    convert_contiguous<at::BFloat16, float>(iter);
+  } else {
+    return false;
+  }
+  return true;
+}
+
 static void copy_kernel(TensorIterator& iter, bool non_blocking) {
   ScalarType dtype = iter.dtype(0);
   if (dtype == iter.dtype(1)) {
@@ -26,6 +98,13 @@ static void copy_kernel(TensorIterator& iter, bool non_blocking) {
       });
     } else if (isComplexType(dtype)) {
       AT_DISPATCH_COMPLEX_TYPES(dtype, "copy_kernel", [&] {
+          if (use_stream_copy(iter)) {
+            copy_contiguous_stream(
+                static_cast<scalar_t*>(iter.data_ptr(0)),
+                static_cast<const scalar_t*>(iter.data_ptr(1)),
+                iter.numel());
+            return;
+          }
           cpu_kernel_vec(
             iter,
             [=](scalar_t a) -> scalar_t { return a; },
@@ -34,6 +113,13 @@ static void copy_kernel(TensorIterator& iter, bool non_blocking) {
     } else {
       AT_DISPATCH_ALL_TYPES_AND2(
           ScalarType::Bool, ScalarType::BFloat16,dtype, "copy_kernel", [&] {
+            if (use_stream_copy(iter)) {
+              copy_contiguous_stream(
+                  static_cast<scalar_t*>(iter.data_ptr(0)),
+                  static_cast<const scalar_t*>(iter.data_ptr(1)),
+                  iter.numel());
+              return;
+            }
             cpu_kernel_vec(
                 iter,
                 [=](scalar_t a) -> scalar_t { return a; },
@@ -41,6 +127,9 @@ static void copy_kernel(TensorIterator& iter, bool non_blocking) {
           });
     }
   } else {
+    if (try_bulk_cast_copy(iter)) {
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16, dtype, "copy_", [&] {
       using dest_t = scalar_t;
       AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16, iter.dtype(1), "copy_", [&] {
@@ -235,6 +235,77 @@ void convolution_depthwise3x3_winograd_impl(
   }
 }
 
+// Direct 5x5 depthwise convolution, stride 1 or 2. Unlike the 3x3 kernel
+// above there is no Winograd transform (F(2x2, 5x5) needs an 8x8 tile and
+// loses the arithmetic advantage for depthwise work); instead the inner loop
+// computes four adjacent output columns at a time, broadcasting each of the
+// 25 taps with a fused multiply-accumulate. Stride-2 lanes are gathered with
+// de-interleaving loads. Rows whose receptive field straddles the padding
+// fall back to a scalar loop with explicit bounds checks.
+void convolution_depthwise5x5_impl(
+    const Arguments& args,
+    const float* const input,
+    const float* const kernel,
+    const float* const bias,
+    float* const output) {
+  constexpr int64_t k_rows = 5;
+  constexpr int64_t k_cols = 5;
+
+  const auto compute_scalar = [&](const int64_t oh, const int64_t ow) {
+    float acc = *bias;
+    const int64_t ih0 = oh * args.stride - args.pad_rows;
+    const int64_t iw0 = ow * args.stride - args.pad_cols;
+    for (int64_t kr = 0; kr < k_rows; ++kr) {
+      const int64_t ih = ih0 + kr;
+      if (ih < 0 || ih >= args.in_rows) {
+        continue;
+      }
+      for (int64_t kc = 0; kc < k_cols; ++kc) {
+        const int64_t iw = iw0 + kc;
+        if (iw >= 0 && iw < args.in_cols) {
+          acc += input[ih * args.in_cols + iw] * kernel[kr * k_cols + kc];
+        }
+      }
+    }
+    output[oh * args.out_cols + ow] = acc;
+  };
+
+  for (int64_t oh = 0; oh < args.out_rows; ++oh) {
+    const int64_t ih0 = oh * args.stride - args.pad_rows;
+    int64_t ow = 0;
+    if (ih0 >= 0 && ih0 + k_rows <= args.in_rows) {
+      // Scalar prologue until the receptive field clears the left padding.
+      while (ow < args.out_cols && ow * args.stride < args.pad_cols) {
+        compute_scalar(oh, ow);
+        ++ow;
+      }
+      // Vectorized interior: four output columns per iteration, as long as
+      // the widest lane still reads in-bounds.
+      for (; ow + 4 <= args.out_cols; ow += 4) {
+        const int64_t iw0 = ow * args.stride - args.pad_cols;
+        if (iw0 + 3 * args.stride + k_cols > args.in_cols) {
+          break;
+        }
+        float32x4_t acc = vdupq_n_f32(*bias);
+        for (int64_t kr = 0; kr < k_rows; ++kr) {
+          const float* const row = input + (ih0 + kr) * args.in_cols + iw0;
+          for (int64_t kc = 0; kc < k_cols; ++kc) {
+            const float32x4_t v = (args.stride == 1)
+                ? vld1q_f32(row + kc)
+                : vld2q_f32(row + kc).val[0];
+            acc = vmlaq_n_f32(acc, v, kernel[kr * k_cols + kc]);
+          }
+        }
+        vst1q_f32(output + oh * args.out_cols + ow, acc);
+      }
+    }
+    // Scalar epilogue: right padding and rows touching the top/bottom pads.
+    for (; ow < args.out_cols; ++ow) {
+      compute_scalar(oh, ow);
+    }
+  }
+}
+
 #else
 
 void convolution_depthwise3x3_winograd_impl(
@@ -245,6 +316,14 @@ void convolution_depthwise3x3_winograd_impl(
     float* const) {
 }
 
+void convolution_depthwise5x5_impl(
+    const Arguments&,
+    const float* const,
+    const float* const,
+    const float* const,
+    float* const) {
+}
+
 #endif /* __ARM_NEON__ */
 
 Tensor _convolution_depthwise3x3_winograd(
@@ -297,10 +376,62 @@ Tensor _convolution_depthwise3x3_winograd(
   return output;
 }
 
+Tensor _convolution_depthwise5x5(
+    const Tensor & input,
+    const Tensor & kernel,
+    const Tensor & bias_potentially_undefined,
+    const IntArrayRef stride,
+    const IntArrayRef padding,
+    const int64_t groups)
+{
+  const IntArrayRef input_sizes = input.sizes();
+  const IntArrayRef kernel_sizes = kernel.sizes();
+
+  Tensor output = at::empty(
+    calculate_conv_output_size(input_sizes, kernel_sizes, stride, padding),
+    input.options());
+
+  const IntArrayRef output_sizes = output.sizes();
+
+  const Arguments args {
+      input_sizes[0],     // Input N
+      input_sizes[2],     // Input H
+      input_sizes[3],     // Input W
+      stride[0],          // Stride
+      padding[0],         // Padding Rows
+      padding[1],         // Padding Columns
+      output_sizes[2],    // Output H
+      output_sizes[3],    // Output W
+  };
+
+  const int64_t input_hxw = args.in_rows * args.in_cols;
+  const int64_t output_hxw = args.out_rows * args.out_cols;
+
+  const Tensor bias = bias_potentially_undefined.defined() ?
+                      bias_potentially_undefined :
+                      at::zeros({kernel_sizes[0]}, input.options());
+
+  at::parallel_for(0, args.batch * groups, 0, [&](int64_t start, int64_t end) {
+    for (int64_t k = start; k < end; ++k) {
+      const int64_t g = k % groups;
+      convolution_depthwise5x5_impl(
+          args,
+          input.data_ptr<float>() + k * input_hxw,
+          kernel.data_ptr<float>() + g * 5 * 5,
+          bias.data_ptr<float>() + g,
+          output.data_ptr<float>() + k * output_hxw);
+    }
+  });
+
+  return output;
+}
+
 }  // namespace
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(convolution_depthwise3x3_winograd_stub, &_convolution_depthwise3x3_winograd);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(convolution_depthwise5x5_stub, &_convolution_depthwise5x5);
 
 }  // namespace native
 }  // namespace at
@@ -4,7 +4,7 @@
 #include <ATen/native/DispatchStub.h>
 
 /*
-  Depthwise 3x3 Winograd convolution operator
+  Depthwise 3x3 Winograd and direct 5x5 convolution operators
 */
 
 namespace at {
@@ -15,5 +15,10 @@ using convolution_depthwise3x3_winograd_fn =
 
 DECLARE_DISPATCH(convolution_depthwise3x3_winograd_fn, convolution_depthwise3x3_winograd_stub);
 
+using convolution_depthwise5x5_fn =
+    Tensor (*)(const Tensor &, const Tensor &, const Tensor &,IntArrayRef, IntArrayRef, int64_t);
+
+DECLARE_DISPATCH(convolution_depthwise5x5_fn, convolution_depthwise5x5_stub);
+
 }  // namespace native
 }  // namespace at
@@ -215,37 +215,37 @@ struct Dist {
     int64_t size1 = r1 * m;
     int64_t size2 = r2 * m;
 
+    // Tile both row sets so one tile of each operand stays resident in a
+    // typical per-core L2 cache while all of its row pairs are processed;
+    // walking the result row-major instead would stream the whole of t2 from
+    // DRAM again for every row of t1. The tile pairs write disjoint result
+    // blocks, so we parallelize over them directly.
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    parallel_for(0, combs * d, internal::GRAIN_SIZE / (16 * m), [=](int64_t start, int64_t end) {
-      scalar_t * res = res_start + start;
-      const scalar_t * const res_end = res_start + end;
-      int64_t l = start / combs;
-      int64_t k = start % combs;
-      int64_t i = k / r2;
-      int64_t j = k % r2;
-      i = i * m;
-      j = j * m;
-
-      while (res != res_end) {
-        const scalar_t * self_i = t1_start + size1 * l + i;
-        const scalar_t * self_j = t2_start + size2 * l + j;
-
-        scalar_t agg = 0;
-        for (int x = 0; x < m; x++) {
-          scalar_t a = *(self_i + x);
-          scalar_t b = *(self_j + x);
-          agg = F::red(agg, F::map(std::abs(a-b), p));
-        }
-        *res = F::finish(agg, p);
-
-        res += 1;
-        j += m;
-        if (j == size2) {
-          j = 0;
-          i += m;
-          if (i == size1) {
-            i = 0;
-            l += 1;
+    constexpr int64_t kTileBytes = 128 * 1024;
+    const int64_t row_bytes = std::max(int64_t{1}, m * static_cast<int64_t>(sizeof(scalar_t)));
+    const int64_t tile_rows = std::max(int64_t{1}, kTileBytes / row_bytes);
+    const int64_t tiles1 = (r1 + tile_rows - 1) / tile_rows;
+    const int64_t tiles2 = (r2 + tile_rows - 1) / tile_rows;
+    const int64_t grain = std::max(
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+        int64_t{1}, internal::GRAIN_SIZE / (16 * m * tile_rows * tile_rows));
+
+    parallel_for(0, d * tiles1 * tiles2, grain, [=](int64_t start, int64_t end) {
+      const Vec pvec(p);
+      for (int64_t t = start; t < end; t++) {
+        const int64_t l = t / (tiles1 * tiles2);
+        const int64_t i_begin = ((t / tiles2) % tiles1) * tile_rows;
+        const int64_t i_end = std::min(i_begin + tile_rows, r1);
+        const int64_t j_begin = (t % tiles2) * tile_rows;
+        const int64_t j_end = std::min(j_begin + tile_rows, r2);
+        for (int64_t i = i_begin; i < i_end; i++) {
+          const scalar_t * const self_i = t1_start + size1 * l + i * m;
+          const scalar_t * self_j = t2_start + size2 * l + j_begin * m;
+          scalar_t * res = res_start + combs * l + i * r2 + j_begin;
+          for (int64_t j = j_begin; j < j_end; j++, self_j += m) {
+            *res++ = F::finish(vec256::map2_reduce_all<scalar_t>(
+              [&pvec](Vec a, Vec b) { return F::map((a - b).abs(), pvec); },
+              F::red, self_i, self_j, m), p);
           }
         }
       }
@@ -254,16 +254,16 @@ struct Dist {
 
   static void apply_cdist(Tensor& result, const Tensor& x1, const Tensor& x2, const scalar_t p) {
     if (p == 0.0) {
-      run_parallel_cdist<zdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<zdist_calc<Vec>>(result, x1, x2, p);
     } else if (p == 1.0) {
-      run_parallel_cdist<odist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<odist_calc<Vec>>(result, x1, x2, p);
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
     } else if (p == 2.0) {
-      run_parallel_cdist<tdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<tdist_calc<Vec>>(result, x1, x2, p);
     } else if (std::isinf(p)) {
-      run_parallel_cdist<idist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<idist_calc<Vec>>(result, x1, x2, p);
     } else {
-      run_parallel_cdist<pdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<pdist_calc<Vec>>(result, x1, x2, p);
     }
   }
 
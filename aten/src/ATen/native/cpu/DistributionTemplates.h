@@ -2,7 +2,9 @@
 
 #include <ATen/Dispatch.h>
 #include <ATen/CPUApplyUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
 #include <limits>
@@ -81,6 +83,47 @@ struct RandomKernel {
   }
 };
 
+// ============================================= Philox uniform fill ==================================================
+
+// Note [Philox uniform fill]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The serial kernels in this file draw every value from the generator's
+// MT19937 engine under its mutex, which makes big contiguous fills (randn,
+// rand, dropout masks) single threaded. For those we instead draw one 64 bit
+// seed from the generator and expand it with the counter-based Philox4_32_10
+// engine: element i always consumes draws [i * draws_per_element,
+// (i + 1) * draws_per_element) of the Philox stream, so the result depends
+// only on the seed and the element index, never on how at::parallel_for
+// chunks the range or how many threads run it. The values differ from the
+// serial MT19937 stream, which is in line with the AVX2 and non-AVX2 builds
+// of normal_fill already producing different streams.
+
+template <typename RNG>
+uint64_t philox_seed(RNG generator) {
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(generator->mutex_);
+  return generator->random64();
+}
+
+template <typename scalar_t, typename transform_t>
+void philox_uniform_fill(scalar_t* data, int64_t begin, int64_t end, uint64_t seed, const transform_t& transform) {
+  // doubles consume 64 bits of the stream per element, everything else 32
+  constexpr uint64_t draws_per_element = std::is_same<scalar_t, double>::value ? 2 : 1;
+  const uint64_t first_draw = static_cast<uint64_t>(begin) * draws_per_element;
+  // the engine's offset is in groups of four 32 bit draws
+  at::Philox4_32_10 engine(seed, 0, first_draw / 4);
+  for (uint64_t burn = first_draw % 4; burn > 0; --burn) {
+    engine();
+  }
+  for (int64_t i = begin; i < end; ++i) {
+    uint64_t val = engine();
+    if (draws_per_element == 2) {
+      val = (static_cast<uint64_t>(engine()) << 32) | val;
+    }
+    data[i] = transform(transformation::uniform_real<scalar_t>(val, 0, 1));
+  }
+}
+
 // ==================================================== Normal ========================================================
 
 #ifdef CPU_CAPABILITY_AVX2
@@ -107,29 +150,26 @@ template<typename RNG>
 void normal_fill_AVX2(Tensor& self, const float mean, const float std, RNG generator) {
   float *data = self.data_ptr<float>();
   auto size = self.numel();
-  std::lock_guard<std::mutex> lock(generator->mutex_);
-  for (int64_t i = 0; i < size; ++i) {
-    at::uniform_real_distribution<float> uniform(0, 1);
-    data[i] = uniform(generator);
-  }
+  const auto seed = philox_seed(generator);
   const __m256 two_pi = _mm256_set1_ps(2.0f * c10::pi<double>);
   const __m256 one = _mm256_set1_ps(1.0f);
   const __m256 minus_two = _mm256_set1_ps(-2.0f);
   const __m256 mean_v = _mm256_set1_ps(mean);
   const __m256 std_v = _mm256_set1_ps(std);
 
-  for (int64_t i = 0; i < size - 15; i += 16) {
-    normal_fill_16_AVX2(data + i, &two_pi, &one, &minus_two, &mean_v, &std_v);
-  }
+  // See Note [Philox uniform fill]
+  at::parallel_for(0, size / 16, at::internal::GRAIN_SIZE / 16, [&](int64_t begin, int64_t end) {
+    philox_uniform_fill(data, begin * 16, end * 16, seed, [](float u) { return u; });
+    for (int64_t i = begin * 16; i < end * 16; i += 16) {
+      normal_fill_16_AVX2(data + i, &two_pi, &one, &minus_two, &mean_v, &std_v);
+    }
+  });
 
   if (size % 16 != 0) {
-    // Recompute the last 16 values.
-    data = data + size - 16;
-    for (int64_t i = 0; i < 16; ++i) {
-      at::uniform_real_distribution<float> uniform(0, 1);
-      data[i] = uniform(generator);
-    }
-    normal_fill_16_AVX2(data, &two_pi, &one, &minus_two, &mean_v, &std_v);
+    // Recompute the last 16 values; the Philox stream hands back exactly the
+    // uniforms that belong to these indices.
+    philox_uniform_fill(data, size - 16, size, seed, [](float u) { return u; });
+    normal_fill_16_AVX2(data + size - 16, &two_pi, &one, &minus_two, &mean_v, &std_v);
   }
 }
 #endif
@@ -150,23 +190,20 @@ template <typename scalar_t, typename RNG>
 void normal_fill(Tensor& self, const scalar_t mean, const scalar_t std, RNG generator) {
   scalar_t *data = self.data_ptr<scalar_t>();
   auto size = self.numel();
-  std::lock_guard<std::mutex> lock(generator->mutex_);
-  for (int64_t i = 0; i < size; ++i) {
-    at::uniform_real_distribution<scalar_t> uniform(0, 1);
-    data[i] = uniform(generator);
-  }
+  const auto seed = philox_seed(generator);
 
-  for (int64_t i = 0; i < size - 15; i += 16) {
-    normal_fill_16<scalar_t>(data + i, mean, std);
-  }
-  if (size % 16 != 0) {
-    // Recompute the last 16 values.
-    data = data + size - 16;
-    for (int64_t i = 0; i < 16; ++i) {
-      at::uniform_real_distribution<scalar_t> uniform(0, 1);
-      data[i] = uniform(generator);
+  // See Note [Philox uniform fill]
+  at::parallel_for(0, size / 16, at::internal::GRAIN_SIZE / 16, [&](int64_t begin, int64_t end) {
+    philox_uniform_fill(data, begin * 16, end * 16, seed, [](dist_acctype<scalar_t> u) { return u; });
+    for (int64_t i = begin * 16; i < end * 16; i += 16) {
+      normal_fill_16<scalar_t>(data + i, mean, std);
     }
-    normal_fill_16<scalar_t>(data, mean, std);
+  });
+  if (size % 16 != 0) {
+    // Recompute the last 16 values; the Philox stream hands back exactly the
+    // uniforms that belong to these indices.
+    philox_uniform_fill(data, size - 16, size, seed, [](dist_acctype<scalar_t> u) { return u; });
+    normal_fill_16<scalar_t>(data + size - 16, mean, std);
   }
 }
 
@@ -206,6 +243,22 @@ struct NormalKernel {
 
 template<typename RNG>
 void uniform_kernel(TensorIteratorBase& iter, double from_, double to_, RNG generator) {
+  if (iter.numel() > 0 && iter.is_contiguous() &&
+      (iter.dtype() == ScalarType::Float || iter.dtype() == ScalarType::Double)) {
+    // See Note [Philox uniform fill]
+    AT_DISPATCH_FLOATING_TYPES(iter.dtype(), "uniform_kernel_cpu", [&]() {
+      auto from = static_cast<scalar_t>(from_);
+      auto to = static_cast<scalar_t>(to_);
+      scalar_t* data = static_cast<scalar_t*>(iter.data_ptr(0));
+      const auto seed = philox_seed(generator);
+      at::parallel_for(0, iter.numel(), at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        philox_uniform_fill(data, begin, end, seed, [from, to](scalar_t u) {
+          return u * (to - from) + from;
+        });
+      });
+    });
+    return;
+  }
   AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, iter.dtype(), "uniform_kernel_cpu", [&]() {
     std::lock_guard<std::mutex> lock(generator->mutex_);
     auto from = static_cast<scalar_t>(from_);
@@ -338,6 +391,21 @@ void bernoulli_kernel(Tensor& self, const Tensor& p_, RNG generator) {
 
 template<typename RNG>
 void bernoulli_kernel(Tensor& self, double p, RNG generator) {
+  if (self.numel() > 0 && self.is_contiguous() &&
+      (self.scalar_type() == ScalarType::Float || self.scalar_type() == ScalarType::Double)) {
+    // Covers the dropout mask case; see Note [Philox uniform fill]
+    AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "bernoulli_scalar_cpu_", [&] {
+      scalar_t* data = self.data_ptr<scalar_t>();
+      const auto threshold = static_cast<scalar_t>(p);
+      const auto seed = philox_seed(generator);
+      at::parallel_for(0, self.numel(), at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        philox_uniform_fill(data, begin, end, seed, [threshold](scalar_t u) -> scalar_t {
+          return u < threshold ? 1 : 0;
+        });
+      });
+    });
+    return;
+  }
   AT_DISPATCH_ALL_TYPES_AND(at::ScalarType::Bool, self.scalar_type(), "bernoulli_scalar_cpu_", [&] {
     // See Note [Acquire lock when using random generators]
     std::lock_guard<std::mutex> lock(generator->mutex_);
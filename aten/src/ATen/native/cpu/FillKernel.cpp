@@ -10,6 +10,42 @@
 namespace at { namespace native {
 namespace {
 
+// Fills at or above this many bytes use streaming stores, so zeroing a
+// multi-GB buffer does not evict the rest of the working set from the
+// caches. The threshold is a multiple of typical last-level cache sizes;
+// below it the cached data may be about to be read back.
+constexpr int64_t kFillStreamThresholdBytes = int64_t(1) << 25;
+
+bool use_stream_fill(TensorIterator& iter) {
+  return iter.is_contiguous() &&
+      iter.numel() * iter.element_size(0) >= kFillStreamThresholdBytes;
+}
+
+template <typename scalar_t>
+void fill_contiguous_stream(scalar_t* data, int64_t numel, scalar_t value) {
+  using Vec = Vec256<scalar_t>;
+  const Vec value_vec(value);
+  at::parallel_for(0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    scalar_t* ptr = data + begin;
+    scalar_t* const end_ptr = data + end;
+    // Streaming stores require vector-width alignment.
+    while (ptr < end_ptr &&
+           (reinterpret_cast<uintptr_t>(ptr) % sizeof(Vec)) != 0) {
+      *ptr++ = value;
+    }
+    for (; ptr + Vec::size() <= end_ptr; ptr += Vec::size()) {
+      vec256::stream_store(value_vec, ptr);
+    }
+    for (; ptr < end_ptr; ptr++) {
+      *ptr = value;
+    }
+    // Each worker must fence its own streaming stores before signaling
+    // completion; an sfence only orders the stores of the core executing it,
+    // so fencing once on the joining thread would not cover the pool's
+    // workers.
+    vec256::stream_sync();
+  });
+}
 
 template <typename scalar_t>
 void fill_non_native_type(TensorIterator& iter, const Scalar& value_scalar) {
@@ -17,6 +53,10 @@ void fill_non_native_type(TensorIterator& iter, const Scalar& value_scalar) {
   using H = typename std::make_signed<decltype(value)>::type;  // Signed type has more acceleration
   // Reserve the representation of value. static_cast<H>(value) is implementation defined.
   H val = *reinterpret_cast<H*>(std::addressof(value));
+  if (use_stream_fill(iter)) {
+    fill_contiguous_stream(static_cast<H*>(iter.data_ptr(0)), iter.numel(), val);
+    return;
+  }
   cpu_kernel_vec</*check_dynamic_cast=*/false>(
       iter,
       [val]() -> H { return val; },
@@ -28,6 +68,10 @@ void fill_non_native_type<c10::complex<at::Half>>(TensorIterator& iter, const Sc
   static_assert(sizeof(c10::complex<at::Half>) == sizeof(int32_t), "Size of ComplexHalf should be 32-bits");
   auto value = c10::complex<at::Half>(value_scalar.to<c10::complex<float>>());
   auto val = *reinterpret_cast<int32_t*>(std::addressof(value));
+  if (use_stream_fill(iter)) {
+    fill_contiguous_stream(static_cast<int32_t*>(iter.data_ptr(0)), iter.numel(), val);
+    return;
+  }
   cpu_kernel_vec</*check_dynamic_cast=*/false>(
       iter,
       [val]() -> int32_t { return val; },
@@ -44,6 +88,11 @@ void fill_kernel(TensorIterator& iter, const Scalar& value_scalar) {
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND(at::ScalarType::Bool, iter.dtype(), "fill_cpu", [&]() {
       scalar_t value = value_scalar.to<scalar_t>();
+      if (use_stream_fill(iter)) {
+        fill_contiguous_stream(
+            static_cast<scalar_t*>(iter.data_ptr(0)), iter.numel(), value);
+        return;
+      }
       cpu_kernel_vec(
           iter,
           [=]() -> scalar_t { return value; },
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cstring>
 #include <type_traits>
+#include <vector>
 
 namespace at { namespace native { namespace {
 
@@ -591,6 +592,109 @@ struct ApplyGridSample<scalar_t, 2, GridSamplerInterpolation::Bilinear,
     }
   }
 
+  // See NOTE [ Shared-grid interpolation plans ]. Computes the corner
+  // weights, gather offsets and in-bound masks for one grid block and stores
+  // them into the plan buffers. Each corner occupies a segment of
+  // `plan_stride` elements so forward_from_plan can issue full vector loads.
+  inline void compute_interp_plan(const Vec& grid_x, const Vec& grid_y,
+                                  int64_t offset, int64_t len,
+                                  int64_t plan_stride,
+                                  scalar_t* plan_weights,
+                                  integer_t* plan_offsets,
+                                  scalar_t* plan_masks) const {
+    auto x = compute_W.apply(grid_x);
+    auto y = compute_H.apply(grid_y);
+
+    auto interp_params = compute_interp_params(x, y);
+
+    auto nw = std::get<4>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto ne = std::get<5>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto sw = std::get<6>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto se = std::get<7>(interp_params);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto nw_mask = std::get<8>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto ne_mask = std::get<9>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto sw_mask = std::get<10>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto se_mask = std::get<11>(interp_params);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto i_y_n = std::get<12>(interp_params);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    auto i_x_w = std::get<13>(interp_params);
+
+    auto i_nw_offset = i_y_n * iVec(inp_sH) + i_x_w * iVec(inp_sW);
+    auto i_ne_offset = i_nw_offset + iVec(inp_sW);
+    auto i_sw_offset = i_nw_offset + iVec(inp_sH);
+    auto i_se_offset = i_sw_offset + iVec(inp_sW);
+
+    nw.store(plan_weights + offset, len);
+    ne.store(plan_weights + plan_stride + offset, len);
+    sw.store(plan_weights + 2 * plan_stride + offset, len);
+    se.store(plan_weights + 3 * plan_stride + offset, len);
+
+    i_nw_offset.store(plan_offsets + offset, len);
+    i_ne_offset.store(plan_offsets + plan_stride + offset, len);
+    i_sw_offset.store(plan_offsets + 2 * plan_stride + offset, len);
+    i_se_offset.store(plan_offsets + 3 * plan_stride + offset, len);
+
+    nw_mask.store(plan_masks + offset, len);
+    ne_mask.store(plan_masks + plan_stride + offset, len);
+    sw_mask.store(plan_masks + 2 * plan_stride + offset, len);
+    se_mask.store(plan_masks + 3 * plan_stride + offset, len);
+  }
+
+  // Replays a precomputed plan block: no coordinate unnormalization, corner
+  // arithmetic or clamping left, only gathers and fused multiply-adds.
+  inline void forward_from_plan(TensorAccessor<scalar_t, 3>& out_slice,
+                                const TensorAccessor<scalar_t, 3>& inp_slice,
+                                int64_t offset, int64_t len,
+                                int64_t plan_stride,
+                                const scalar_t* plan_weights,
+                                const integer_t* plan_offsets,
+                                const scalar_t* plan_masks) const {
+    auto nw = Vec::loadu(plan_weights + offset);
+    auto ne = Vec::loadu(plan_weights + plan_stride + offset);
+    auto sw = Vec::loadu(plan_weights + 2 * plan_stride + offset);
+    auto se = Vec::loadu(plan_weights + 3 * plan_stride + offset);
+
+    auto i_nw_offset = iVec::loadu(plan_offsets + offset);
+    auto i_ne_offset = iVec::loadu(plan_offsets + plan_stride + offset);
+    auto i_sw_offset = iVec::loadu(plan_offsets + 2 * plan_stride + offset);
+    auto i_se_offset = iVec::loadu(plan_offsets + 3 * plan_stride + offset);
+
+    auto nw_mask = Vec::loadu(plan_masks + offset);
+    auto ne_mask = Vec::loadu(plan_masks + plan_stride + offset);
+    auto sw_mask = Vec::loadu(plan_masks + 2 * plan_stride + offset);
+    auto se_mask = Vec::loadu(plan_masks + 3 * plan_stride + offset);
+
+    #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+    # pragma unroll
+    #endif
+    for (int64_t c = 0; c < C; ++c) {
+      auto inp_slice_C_ptr = inp_slice[c].data();
+
+      // mask_gather zeros out the mask, so we need to make copies
+      Vec nw_mask_copy = nw_mask;
+      Vec ne_mask_copy = ne_mask;
+      Vec sw_mask_copy = sw_mask;
+      Vec se_mask_copy = se_mask;
+      auto nw_val = mask_gather<sizeof(scalar_t)>(Vec(0), inp_slice_C_ptr, i_nw_offset, nw_mask_copy);
+      auto ne_val = mask_gather<sizeof(scalar_t)>(Vec(0), inp_slice_C_ptr, i_ne_offset, ne_mask_copy);
+      auto sw_val = mask_gather<sizeof(scalar_t)>(Vec(0), inp_slice_C_ptr, i_sw_offset, sw_mask_copy);
+      auto se_val = mask_gather<sizeof(scalar_t)>(Vec(0), inp_slice_C_ptr, i_se_offset, se_mask_copy);
+
+      auto interpolated = (nw_val * nw) + (ne_val * ne) + (sw_val * sw) + (se_val * se);
+      interpolated.store(out_slice[c].data() + offset, len);
+    }
+  }
+
   inline void backward(TensorAccessor<scalar_t, 3>& gInp_slice,
                        TensorAccessor<scalar_t, 3>& gGrid_slice,
                        const TensorAccessor<scalar_t, 3>& gOut_slice,
@@ -1150,6 +1254,79 @@ Tensor grid_sampler_2d_cpu_kernel_impl(const Tensor& input, const Tensor& grid,
   auto grain_size = spatial_size == 0 ? (N + 1)
                                       : at::divup(at::internal::GRAIN_SIZE, spatial_size * 4 /* 2d * 2 tensors*/);
 
+  // NOTE [ Shared-grid interpolation plans ]
+  //
+  // When the grid is broadcast along the batch dimension (stride(0) == 0,
+  // i.e. a single [1, H, W, 2] warp field expanded over a batch of frames,
+  // as optical-flow style workloads do), every batch element uses identical
+  // interpolation weights, gather offsets and border masks. Instead of
+  // recomputing the coordinate unnormalization, clamping and corner
+  // arithmetic N times, compute them once into a plan (one segment per
+  // corner, padded to the vector width so the replay loop can issue full
+  // loads) and replay the plan for each batch element as pure gathers and
+  // multiply-adds. Only done for bilinear, where the per-pixel setup
+  // dominates; the plan lives for this call only since kernels here are
+  // stateless.
+  if (static_cast<GridSamplerInterpolation>(interpolation_mode) ==
+          GridSamplerInterpolation::Bilinear &&
+      N > 1 && grid.stride(0) == 0 && spatial_size > 0) {
+#define HANDLE_PLAN_CASE(padding, align_corners)                               \
+  case padding: {                                                              \
+    using integer_t = int_same_size_t<scalar_t>;                               \
+    ApplyGridSample<scalar_t, 2, GridSamplerInterpolation::Bilinear,           \
+                    padding, align_corners>                                    \
+    grid_sample(inp_acc);                                                      \
+    constexpr int64_t step = Vec256<scalar_t>::size();                         \
+    const int64_t plan_stride = spatial_size + step;                           \
+    std::vector<scalar_t> plan_weights(4 * plan_stride, scalar_t(0));          \
+    std::vector<integer_t> plan_offsets(4 * plan_stride, integer_t(0));        \
+    std::vector<scalar_t> plan_masks(4 * plan_stride, scalar_t(0));            \
+    grid_sample_2d_grid_slice_iterator(                                        \
+      grid_acc[0],                                                             \
+      [&](const Vec256<scalar_t>& grid_x, const Vec256<scalar_t>& grid_y,      \
+          int64_t spatial_offset, int64_t len) {                               \
+        grid_sample.compute_interp_plan(                                       \
+          grid_x, grid_y, spatial_offset, len, plan_stride,                    \
+          plan_weights.data(), plan_offsets.data(), plan_masks.data());        \
+      });                                                                      \
+    parallel_for(0, N, grain_size, [&](int64_t begin, int64_t end) {           \
+      for (int64_t n = begin; n < end; n++) {                                  \
+        auto out_slice = out_acc[n];                                           \
+        auto inp_slice = inp_acc[n];                                           \
+        for (int64_t spatial_offset = 0; spatial_offset < spatial_size;        \
+             spatial_offset += step) {                                         \
+          const int64_t len = std::min(step, spatial_size - spatial_offset);   \
+          grid_sample.forward_from_plan(                                       \
+            out_slice, inp_slice, spatial_offset, len, plan_stride,            \
+            plan_weights.data(), plan_offsets.data(), plan_masks.data());      \
+        }                                                                      \
+      }                                                                        \
+    });                                                                        \
+    return;                                                                    \
+  }
+
+    AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "grid_sampler_2d_cpu_kernel_impl", [&] {
+      auto out_acc = output.accessor<scalar_t, 4>();
+      auto inp_acc = input.accessor<scalar_t, 4>();
+      auto grid_acc = grid.accessor<scalar_t, 4>();
+      if (align_corners) {
+        switch (static_cast<GridSamplerPadding>(padding_mode)) {
+          HANDLE_PLAN_CASE(GridSamplerPadding::Zeros, true);
+          HANDLE_PLAN_CASE(GridSamplerPadding::Border, true);
+          HANDLE_PLAN_CASE(GridSamplerPadding::Reflection, true);
+        }
+      } else {
+        switch (static_cast<GridSamplerPadding>(padding_mode)) {
+          HANDLE_PLAN_CASE(GridSamplerPadding::Zeros, false);
+          HANDLE_PLAN_CASE(GridSamplerPadding::Border, false);
+          HANDLE_PLAN_CASE(GridSamplerPadding::Reflection, false);
+        }
+      }
+    });
+#undef HANDLE_PLAN_CASE
+    return output;
+  }
+
 #define HANDLE_CASE(interp, padding, align_corners)                            \
   case padding: {                                                              \
     ApplyGridSample<scalar_t, 2, interp, padding, align_corners>               \
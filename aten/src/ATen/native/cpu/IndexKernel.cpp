@@ -1,8 +1,11 @@
 #include <ATen/native/TensorAdvancedIndexing.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <ATen/Dispatch.h>
+#include <c10/util/llvmMathExtras.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/Parallel.h>
 #include <ATen/cpu/vec256/vec256.h>
@@ -49,6 +52,138 @@ struct Indexer {
   }
 };
 
+#if defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+// How many elements ahead of the current position we issue prefetches for
+// the gathered source data. Chosen to roughly cover DRAM latency at typical
+// gather throughput on recent server cores.
+constexpr int64_t kIndexPrefetchDistance = 16;
+
+// Vectorized gather through a single contiguous int64 index tensor for
+// 32/64-bit elements. Byte offsets are formed in SIMD registers and fed to
+// AVX2 gather instructions, with explicit prefetch of upcoming source
+// locations. Returns false if an index is out of bounds (or the layout is
+// unsupported) so the caller can rerun the scalar loop, which raises the
+// usual error message.
+template <typename scalar_t, size_t element_size = sizeof(scalar_t)>
+struct VectorizedGather {
+  static bool apply(char*, const char*, const int64_t*, int64_t, int64_t, int64_t) {
+    return false;
+  }
+};
+
+inline bool gather_offsets(
+    const int64_t* idx, int64_t i, int64_t size, const __m256i& size_v,
+    const __m256i& shift_v, __m256i& offsets) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi64x(1);
+  __m256i ind = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + i));
+  // Reject any index outside [-size, size); the scalar rerun reports it.
+  const __m256i too_low =
+      _mm256_cmpgt_epi64(_mm256_sub_epi64(zero, size_v), ind);
+  const __m256i too_high =
+      _mm256_cmpgt_epi64(ind, _mm256_sub_epi64(size_v, one));
+  const __m256i oob = _mm256_or_si256(too_low, too_high);
+  if (!_mm256_testz_si256(oob, oob)) {
+    return false;
+  }
+  // Wrap negative indices, then scale to byte offsets.
+  const __m256i neg = _mm256_cmpgt_epi64(zero, ind);
+  ind = _mm256_add_epi64(ind, _mm256_and_si256(neg, size_v));
+  offsets = _mm256_sllv_epi64(ind, shift_v);
+  return true;
+}
+
+inline void prefetch_gathered(
+    const char* src, const int64_t* idx, int64_t i, int64_t n,
+    int64_t size, int64_t stride) {
+  for (int64_t k = 0; k < 4; ++k) {
+    const int64_t j = i + kIndexPrefetchDistance + k;
+    if (j >= n) {
+      break;
+    }
+    int64_t value = idx[j];
+    if (value < 0) {
+      value += size;
+    }
+    if (value >= 0 && value < size) {
+      _mm_prefetch(src + value * stride, _MM_HINT_T0);
+    }
+  }
+}
+
+template <typename scalar_t>
+struct VectorizedGather<scalar_t, 4> {
+  static bool apply(char* dst, const char* src, const int64_t* idx, int64_t n,
+                    int64_t size, int64_t stride) {
+    // Strides that aren't a power of two can't be turned into a shift;
+    // AVX2 has no 64-bit multiply, so leave those to the scalar loop.
+    if (stride <= 0 || (stride & (stride - 1)) != 0) {
+      return false;
+    }
+    const __m256i size_v = _mm256_set1_epi64x(size);
+    const __m256i shift_v = _mm256_set1_epi64x(llvm::findLastSet<uint64_t>(stride));
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      prefetch_gathered(src, idx, i, n, size, stride);
+      __m256i offsets;
+      if (!gather_offsets(idx, i, size, size_v, shift_v, offsets)) {
+        return false;
+      }
+      const __m128i values = _mm256_i64gather_epi32(
+          reinterpret_cast<const int*>(src), offsets, 1);
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(dst + i * sizeof(scalar_t)), values);
+    }
+    for (; i < n; ++i) {
+      int64_t value = idx[i];
+      if (value < -size || value >= size) {
+        return false;
+      }
+      if (value < 0) {
+        value += size;
+      }
+      std::memcpy(dst + i * sizeof(scalar_t), src + value * stride, sizeof(scalar_t));
+    }
+    return true;
+  }
+};
+
+template <typename scalar_t>
+struct VectorizedGather<scalar_t, 8> {
+  static bool apply(char* dst, const char* src, const int64_t* idx, int64_t n,
+                    int64_t size, int64_t stride) {
+    if (stride <= 0 || (stride & (stride - 1)) != 0) {
+      return false;
+    }
+    const __m256i size_v = _mm256_set1_epi64x(size);
+    const __m256i shift_v = _mm256_set1_epi64x(llvm::findLastSet<uint64_t>(stride));
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      prefetch_gathered(src, idx, i, n, size, stride);
+      __m256i offsets;
+      if (!gather_offsets(idx, i, size, size_v, shift_v, offsets)) {
+        return false;
+      }
+      const __m256i values = _mm256_i64gather_epi64(
+          reinterpret_cast<const long long*>(src), offsets, 1);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(dst + i * sizeof(scalar_t)), values);
+    }
+    for (; i < n; ++i) {
+      int64_t value = idx[i];
+      if (value < -size || value >= size) {
+        return false;
+      }
+      if (value < 0) {
+        value += size;
+      }
+      std::memcpy(dst + i * sizeof(scalar_t), src + value * stride, sizeof(scalar_t));
+    }
+    return true;
+  }
+};
+#endif // CPU_CAPABILITY_AVX2
+
 static bool is_constant_index(int ntensor, const int64_t* strides) {
   AT_ASSERT(ntensor >= 3);
   for (int arg = 2; arg < ntensor; arg++) {
@@ -59,7 +194,7 @@ static bool is_constant_index(int ntensor, const int64_t* strides) {
   return true;
 }
 
-template <typename scalar_t, typename func_t>
+template <typename scalar_t, bool is_gather = false, typename func_t>
 void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
                       const func_t& f, bool serial_execution=false)
 {
@@ -85,6 +220,20 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
         }
       }
     } else {
+#if defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+      // Plain gathers through a single contiguous int64 index tensor go
+      // through AVX2 gather instructions with software prefetch. On failure
+      // (out-of-bounds index or unsupported stride) we fall through to the
+      // scalar loop, which handles every layout and raises the usual error.
+      if (is_gather && ntensor == 3 && strides[0] == sizeof(scalar_t) &&
+          strides[1] == 0 && strides[2] == sizeof(int64_t)) {
+        const auto* idx = reinterpret_cast<const int64_t*>(data[2]);
+        if (VectorizedGather<scalar_t>::apply(
+                dst, src, idx, n, index_size[0], index_stride[0])) {
+          return;
+        }
+      }
+#endif
       for (int64_t i = 0; i < n; i++) {
         int64_t offset = indexer.get(i);
         f(dst + strides[0] * i, src + strides[1] * i, offset);
@@ -98,10 +247,61 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
   }
 }
 
+// Atomic-free parallel accumulation for index_put_. Two writes can only race
+// when they target the same destination element, and the destination address
+// of an element is its iterator offset (which is unique per iteration) plus
+// the offset computed from the index tensors. Duplicate indices therefore
+// collide exactly when their index offsets are equal, so partitioning the
+// index-offset range into per-thread bins makes the bins' writes disjoint.
+// Every thread streams the full update list and applies only the updates that
+// land in its bin, the same ownership scheme embedding_dense_backward_cpu
+// uses. Each destination is updated by a single thread in iteration order, so
+// the result is bitwise identical to the serial kernel and this path stays
+// valid when deterministic algorithms are enabled.
+template <typename scalar_t, typename func_t>
+void cpu_index_put_accum_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
+                                const func_t& f)
+{
+  int ntensor = iter.ntensors();
+  // Range of offsets the Indexer can produce; strides may be negative for
+  // flipped views of self.
+  int64_t min_offset = 0;
+  int64_t max_offset = 0;
+  for (size_t j = 0; j < index_size.size(); j++) {
+    int64_t extent = (index_size[j] - 1) * index_stride[j];
+    if (extent >= 0) {
+      max_offset += extent;
+    } else {
+      min_offset += extent;
+    }
+  }
+  const int64_t span = max_offset - min_offset + 1;
+  const int64_t num_bins = std::min<int64_t>(at::get_num_threads(), span);
+  const int64_t bin_bytes = (span + num_bins - 1) / num_bins;
+  at::parallel_for(0, num_bins, 1, [&](int64_t bin_begin, int64_t bin_end) {
+    for (int64_t bin = bin_begin; bin < bin_end; bin++) {
+      const int64_t lo = min_offset + bin * bin_bytes;
+      const int64_t hi = std::min(lo + bin_bytes, max_offset + 1);
+      auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+        auto indexer = Indexer(ntensor - 2, &data[2], &strides[2], index_size, index_stride);
+        char* dst = data[0];
+        char* src = data[1];
+        for (int64_t i = 0; i < n; i++) {
+          int64_t offset = indexer.get(i);
+          if (offset >= lo && offset < hi) {
+            f(dst + strides[0] * i, src + strides[1] * i, offset);
+          }
+        }
+      };
+      iter.serial_for_each(loop, {0, iter.numel()});
+    }
+  });
+}
+
 void index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16,
     iter.dtype(), "index_cpu", [&] {
-    cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+    cpu_index_kernel<scalar_t, /*is_gather=*/true>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
       *(scalar_t*)dst = *(scalar_t*)(src + offset);
     });
   });
@@ -232,19 +432,17 @@ void index_put_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16,
     iter.dtype(), "index_put", [&] {
     if (accumulate) {
-      // See Note [Enabling Deterministic Operations]
-      // Parallel cpu_index_kernel with accumulation is nondeterministic, so we
-      // must enable serial execution if deterministic algorithms are enabled.
-      bool is_deterministic = at::globalContext().deterministicAlgorithms();
-      bool use_parallel_for = (!is_deterministic) && (
-        (iter.numel() >= internal::GRAIN_SIZE) && (at::get_num_threads() > 1));
-      if (use_parallel_for && iter.dtype() == ScalarType::Float) {
-        cpu_index_kernel<float>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
-          cpu_atomic_add_float((float*)(dst + offset), *(float*)src);
+      // The binned kernel is deterministic (see its comment), so unlike the
+      // old atomic float path it needs no deterministic-algorithms gate and
+      // covers every dtype. Each bin rescans the whole update list, so only
+      // engage it when there is enough work to amortize the extra passes.
+      bool use_parallel_for =
+        (iter.numel() >= internal::GRAIN_SIZE) && (at::get_num_threads() > 1);
+      if (use_parallel_for) {
+        cpu_index_put_accum_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+          *(scalar_t*)(dst + offset) += *(scalar_t*)src;
         });
       } else {
-        // TODO: investigate parallelization of the accumulate kernel. Unlike the non-accumulate case,
-        // this needs to be thread-safe.
         cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset) += *(scalar_t*)src;
         }, /*serial_execution=*/true);
@@ -109,6 +109,53 @@ execute_op(char* C10_RESTRICT data[], const int64_t* strides, int64_t i, int64_t
   }
 }
 
+// Contiguous counterparts of dereference / basic_loop: every stride is the
+// compile-time sizeof of the corresponding argument type, so the generated
+// code is a plain pointer bump with no stride array left for the compiler to
+// reason about. Selected by the is_contiguous branches below, which already
+// guarantee the layout.
+template <typename traits, std::size_t... INDEX>
+typename traits::ArgsTuple
+dereference_contiguous_impl(char* C10_RESTRICT data[], int64_t i,
+                            std::index_sequence<INDEX...>) {
+  return std::make_tuple(
+      *(typename traits::template arg<INDEX>::type*)
+        (data[INDEX] + i * sizeof(typename traits::template arg<INDEX>::type))...);
+}
+
+template <typename traits>
+typename traits::ArgsTuple
+dereference_contiguous(char* C10_RESTRICT data[], int64_t i) {
+  using Indices = std::make_index_sequence<traits::arity>;
+  return dereference_contiguous_impl<traits>(data, i, Indices{});
+}
+
+template <typename func_t,
+    typename std::enable_if<!std::is_void<typename function_traits<func_t>::result_type>::value>::type* = nullptr>
+static inline void
+contiguous_loop(char* C10_RESTRICT data[], int64_t i, int64_t n, func_t&& op) {
+  using traits = function_traits<func_t>;
+  using result_type = typename traits::result_type;
+  for (; i < n; i++) {
+    result_type* out_ptr = (result_type*)(data[0] + i * sizeof(result_type));
+    *out_ptr = c10::guts::apply(std::forward<func_t>(op), dereference_contiguous<traits>(
+        &data[1],
+        i));
+  }
+}
+
+template <typename func_t,
+    typename std::enable_if<std::is_void<typename function_traits<func_t>::result_type>::value>::type* = nullptr>
+static inline void
+contiguous_loop(char* C10_RESTRICT data[], int64_t i, int64_t n, func_t&& op) {
+  using traits = function_traits<func_t>;
+  for (; i < n; i++) {
+    c10::guts::apply(std::forward<func_t>(op), dereference_contiguous<traits>(
+        &data[0],
+        i));
+  }
+}
+
 // Basic loop operation (one output, N inputs). May be auto-vectorized
 // by the compiler. Supports inputs and outputs of different types.
 template <typename func_t>
@@ -219,11 +266,15 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
     out2.store(data[0] + (i + Vec::size()) * sizeof(scalar_t));
   }
   if (i < n) {
-    int64_t strides[ntensors];
-    for (int arg = 0; arg < ntensors; arg++) {
-      strides[arg] = (S > 0 && arg == S) ? 0 : sizeof(scalar_t);
+    if (S == 0) {
+      contiguous_loop(data, i, n, std::forward<func_t>(op));
+    } else {
+      int64_t strides[ntensors];
+      for (int arg = 0; arg < ntensors; arg++) {
+        strides[arg] = (arg == S) ? 0 : sizeof(scalar_t);
+      }
+      basic_loop(data, strides, i, n, std::forward<func_t>(op));
     }
-    basic_loop(data, strides, i, n, std::forward<func_t>(op));
   }
 }
 
@@ -259,7 +310,7 @@ void cpu_kernel(TensorIteratorBase& iter, func_t&& op) {
 
   iter.for_each([&](char** data, const int64_t* strides, int64_t n) {
     if (is_contiguous<traits>(strides)) {
-      basic_loop(data, strides, 0, n, std::forward<func_t>(op));
+      contiguous_loop(data, 0, n, std::forward<func_t>(op));
     } else {
       using Indices = std::make_index_sequence<traits::arity>;
       unroll_contiguous_scalar_checks<traits>(strides, Indices{}, [&](size_t _idx) {
@@ -337,7 +388,7 @@ void cpu_serial_kernel(TensorIteratorBase& iter, func_t&& op, const Range& range
 
   iter.serial_for_each([&](char** data, const int64_t* strides, int64_t n) {
     if (is_contiguous<traits>(strides)) {
-      basic_loop(data, strides, 0, n, std::forward<func_t>(op));
+      contiguous_loop(data, 0, n, std::forward<func_t>(op));
     } else {
       using Indices = std::make_index_sequence<traits::arity>;
       unroll_contiguous_scalar_checks<traits>(strides, Indices{}, [&](size_t _idx) {
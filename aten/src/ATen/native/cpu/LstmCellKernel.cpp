@@ -0,0 +1,75 @@
+#include <ATen/native/RNN.h>
+
+#include <cmath>
+
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// Fused pointwise half of an LSTM cell. The caller has already computed the
+// packed gate buffer (input_gate | forget_gate | cell_gate | output_gate,
+// each of width `hidden_size`); this kernel applies the activations and the
+// state update in a single pass, writing hy and cy without materializing any
+// of the per-gate intermediates the unfused tensor-op chain allocates.
+static void fused_lstm_cell_kernel(
+    Tensor& hy,
+    Tensor& cy,
+    const Tensor& gates,
+    const Tensor& cx) {
+  AT_DISPATCH_FLOATING_TYPES(gates.scalar_type(), "fused_lstm_cell_cpu", [&] {
+    using Vec = vec256::Vec256<scalar_t>;
+    const int64_t hidden_size = cx.size(-1);
+    const int64_t batch_size = cx.numel() / hidden_size;
+    const scalar_t* gates_data = gates.data_ptr<scalar_t>();
+    const scalar_t* cx_data = cx.data_ptr<scalar_t>();
+    scalar_t* hy_data = hy.data_ptr<scalar_t>();
+    scalar_t* cy_data = cy.data_ptr<scalar_t>();
+    const Vec one_vec(static_cast<scalar_t>(1));
+    at::parallel_for(0, batch_size, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t b = begin; b < end; b++) {
+        const scalar_t* in_gate = gates_data + b * 4 * hidden_size;
+        const scalar_t* forget_gate = in_gate + hidden_size;
+        const scalar_t* cell_gate = in_gate + 2 * hidden_size;
+        const scalar_t* out_gate = in_gate + 3 * hidden_size;
+        const scalar_t* cx_row = cx_data + b * hidden_size;
+        scalar_t* hy_row = hy_data + b * hidden_size;
+        scalar_t* cy_row = cy_data + b * hidden_size;
+        int64_t h = 0;
+        for (; h + Vec::size() <= hidden_size; h += Vec::size()) {
+          const Vec i = one_vec / (one_vec + Vec::loadu(in_gate + h).neg().exp());
+          const Vec f = one_vec / (one_vec + Vec::loadu(forget_gate + h).neg().exp());
+          const Vec g = Vec::loadu(cell_gate + h).tanh();
+          const Vec o = one_vec / (one_vec + Vec::loadu(out_gate + h).neg().exp());
+          const Vec c = f * Vec::loadu(cx_row + h) + i * g;
+          c.store(cy_row + h);
+          (o * c.tanh()).store(hy_row + h);
+        }
+        for (; h < hidden_size; h++) {
+          const scalar_t i =
+              static_cast<scalar_t>(1) / (static_cast<scalar_t>(1) + std::exp(-in_gate[h]));
+          const scalar_t f =
+              static_cast<scalar_t>(1) / (static_cast<scalar_t>(1) + std::exp(-forget_gate[h]));
+          const scalar_t g = std::tanh(cell_gate[h]);
+          const scalar_t o =
+              static_cast<scalar_t>(1) / (static_cast<scalar_t>(1) + std::exp(-out_gate[h]));
+          const scalar_t c = f * cx_row[h] + i * g;
+          cy_row[h] = c;
+          hy_row[h] = o * std::tanh(c);
+        }
+      }
+    });
+  });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(fused_lstm_cell_cpu_stub, &fused_lstm_cell_kernel);
+
+} // namespace native
+} // namespace at
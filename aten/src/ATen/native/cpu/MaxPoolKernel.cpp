@@ -304,6 +304,184 @@ void cpu_max_pool_backward_channels_last(
   }
 }
 
+template <typename scalar_t>
+void cpu_max_pool3d_channels_last(
+    Tensor& output_,
+    Tensor indices_,
+    const Tensor& input_,
+    int kW, int kH, int kT,
+    int dW, int dH, int dT,
+    int padW, int padH, int padT,
+    int dilationW, int dilationH, int dilationT) {
+  TORCH_CHECK(input_.ndimension() == 5,
+              "3d max pooling with channels last format supports tensors with 5 dims");
+  auto memory_format = at::MemoryFormat::ChannelsLast3d;
+  auto input = input_.contiguous(memory_format);
+  auto output = output_.contiguous(memory_format);
+  auto indices = indices_.contiguous(memory_format);
+
+  auto input_data = input.data_ptr<scalar_t>();
+  auto output_data = output.data_ptr<scalar_t>();
+  auto indices_data = indices.data_ptr<int64_t>();
+
+  int64_t nbatch = input.size(0);
+  int64_t channels = input.size(1);
+  int64_t input_time = input.size(2);
+  int64_t input_height = input.size(3);
+  int64_t input_width = input.size(4);
+  int64_t output_time = output.size(2);
+  int64_t output_height = output.size(3);
+  int64_t output_width = output.size(4);
+
+  using Vec = vec256::Vec256<scalar_t>;
+  using integer_t = vec256::int_same_size_t<scalar_t>;
+  using iVec = vec256::Vec256<integer_t>;
+  // for the convience of vectorization, use integer of the same size of scalar_t,
+  //   e.g. int32_t for float, int64_t for double
+  // need to make sure doesn't overflow
+  TORCH_CHECK(input_time * input_height <= std::ceil((double)std::numeric_limits<integer_t>::max() / (double)input_width));
+
+  // parallel on dim N, T, H, W
+  at::parallel_for(0, nbatch * output_time * output_height * output_width, 0, [&](int64_t begin, int64_t end) {
+    int64_t n = 0;
+    int64_t ot = 0;
+    int64_t oh = 0;
+    int64_t ow = 0;
+    data_index_init(begin, n, nbatch, ot, output_time, oh, output_height, ow, output_width);
+
+    int64_t size = channels;
+    int64_t len = size - (size % Vec::size());
+    // temp buffer holding index with integer_t
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    std::unique_ptr<integer_t []> index_buffer(new integer_t[len]);
+
+    for (int64_t i = begin; i < end; i++) {
+      int64_t it0 = ot * dT - padT;
+      int64_t ih0 = oh * dH - padH;
+      int64_t iw0 = ow * dW - padW;
+      int64_t it1 = std::min(it0 + (kT - 1) * dilationT + 1, input_time);
+      int64_t ih1 = std::min(ih0 + (kH - 1) * dilationH + 1, input_height);
+      int64_t iw1 = std::min(iw0 + (kW - 1) * dilationW + 1, input_width);
+      while(it0 < 0) { it0 += dilationT; }
+      while(ih0 < 0) { ih0 += dilationH; }
+      while(iw0 < 0) { iw0 += dilationW; }
+
+      scalar_t* out = output_data + i * channels;
+      int64_t* ind = indices_data + i * channels;
+
+      // Pass I: init out lane
+      integer_t index0 = (it0 * input_height + ih0) * input_width + iw0;
+      iVec index0_vec = iVec(index0);
+      Vec out_vec = Vec(-std::numeric_limits<scalar_t>::infinity());
+      int64_t d1 = 0;
+      for (; d1 < len; d1 += Vec::size()) {
+        index0_vec.store(index_buffer.get() + d1);
+        out_vec.store(out + d1);
+      }
+      for (; d1 < size; d1++) {
+        ind[d1] = index0;
+        out[d1] = -std::numeric_limits<scalar_t>::infinity();
+      }
+      // Pass II: compute local max
+      for (int64_t it = it0; it < it1; it += dilationT) {
+        for (int64_t ih = ih0; ih < ih1; ih += dilationH) {
+          for (int64_t iw = iw0; iw < iw1; iw += dilationW) {
+            scalar_t* in = input_data +
+                ((n * input_time + it) * input_height * input_width +
+                 ih * input_width + iw) * channels;
+            integer_t index = (it * input_height + ih) * input_width + iw;
+
+            int64_t d2 = 0;
+            for (; d2 < len; d2 += Vec::size()) {
+              iVec index_vec = iVec(index);
+              Vec val_vec = Vec::loadu(in + d2);
+              iVec maxindex_vec = iVec::loadu(index_buffer.get() + d2);
+              Vec maxval_vec = Vec::loadu(out + d2);
+
+              // true = all ones, false = all zeros
+              Vec mask = (val_vec > maxval_vec) | val_vec.isnan();
+              iVec imask = vec256::cast<integer_t>(mask);
+              Vec out_vec = Vec::blendv(maxval_vec, val_vec, mask);
+              iVec ind_vec = iVec::blendv(maxindex_vec, index_vec, imask);
+
+              out_vec.store(out + d2);
+              ind_vec.store(index_buffer.get() + d2);
+            }
+            for (; d2 < size; d2++) {
+              scalar_t val = in[d2];
+              int64_t maxindex = ind[d2];
+              scalar_t maxval = out[d2];
+
+              bool mask = (val > maxval) || std::isnan(val);
+              out[d2] = mask ? val : maxval;
+              ind[d2] = mask ? index : maxindex;
+            }
+          }
+        }
+      }
+      // convert indice data type
+      vec256::convert<integer_t, int64_t>(index_buffer.get(), ind, len);
+
+      // move on to next output index
+      data_index_step(n, nbatch, ot, output_time, oh, output_height, ow, output_width);
+    }
+  });
+
+  if (!output_.is_contiguous(memory_format)) {
+    output_.copy_(output);
+  }
+  if (!indices_.is_contiguous(memory_format)) {
+    indices_.copy_(indices);
+  }
+}
+
+template <typename scalar_t>
+void cpu_max_pool3d_backward_channels_last(
+    Tensor& grad_input_,
+    const Tensor& grad_output_,
+    const Tensor& indices_) {
+  TORCH_CHECK(grad_output_.ndimension() == 5,
+              "3d max pooling backward with channels last format supports tensors with 5 dims.");
+  auto memory_format = at::MemoryFormat::ChannelsLast3d;
+  auto grad_input = grad_input_.contiguous(memory_format);
+  auto grad_output = grad_output_.contiguous(memory_format);
+  auto indices = indices_.contiguous(memory_format);
+
+  auto grad_input_data = grad_input.data_ptr<scalar_t>();
+  auto grad_output_data = grad_output.data_ptr<scalar_t>();
+  auto indices_data = indices.data_ptr<int64_t>();
+
+  int64_t nbatch = grad_input.size(0);
+  int64_t channels = grad_input.size(1);
+  int64_t input_image_size = grad_input.size(2) * grad_input.size(3) * grad_input.size(4);
+  int64_t output_image_size = grad_output.size(2) * grad_output.size(3) * grad_output.size(4);
+
+  // parallel on dim N
+  at::parallel_for(0, nbatch, 0, [&](int64_t begin, int64_t end) {
+    for (int64_t n = begin; n < end; n++) {
+      scalar_t* grad_input_ptr = grad_input_data + n * input_image_size * channels;
+      scalar_t* grad_output_ptr = grad_output_data + n * output_image_size * channels;
+      int64_t* indices_ptr = indices_data + n * output_image_size * channels;
+
+      for (int64_t i = 0; i < output_image_size; i++) {
+        scalar_t* gout = grad_output_ptr + i * channels;
+        int64_t* ind = indices_ptr + i * channels;
+        // TODO: gcc vectorization
+        for (int64_t c = 0; c < channels; c++) {
+          int64_t maxindex = ind[c];
+          if (maxindex != -1) {
+            grad_input_ptr[maxindex * channels + c] += gout[c];
+          }
+        }
+      }
+    }
+  });
+
+  if (!grad_input_.is_contiguous(memory_format)) {
+    grad_input_.copy_(grad_input);
+  }
+}
+
 void max_pool2d_kernel_impl(
     Tensor& output,
     Tensor& indices,
@@ -352,11 +530,53 @@ void max_pool2d_backward_kernel_impl(
   }
 }
 
+void max_pool3d_kernel_impl(
+    Tensor& output,
+    Tensor& indices,
+    const Tensor& input,
+    int kW, int kH, int kT,
+    int dW, int dH, int dT,
+    int padW, int padH, int padT,
+    int dilationW, int dilationH, int dilationT) {
+  // the NCDHW (Contiguous) path stays in DilatedMaxPool3d.cpp
+  switch (input.suggest_memory_format()) {
+    case at::MemoryFormat::ChannelsLast3d: {
+      AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "max_pool3d_channels_last", [&] {
+        cpu_max_pool3d_channels_last<scalar_t>(output, indices, input,
+            kW, kH, kT, dW, dH, dT, padW, padH, padT, dilationW, dilationH, dilationT);
+      });
+      break;
+    }
+    default:
+      TORCH_CHECK(false, "Unsupported memory format. Supports only ChannelsLast3d");
+  }
+}
+
+void max_pool3d_backward_kernel_impl(
+    Tensor& grad_input,
+    const Tensor& grad_output,
+    const Tensor& indices) {
+  switch (grad_output.suggest_memory_format()) {
+    case at::MemoryFormat::ChannelsLast3d: {
+      AT_DISPATCH_FLOATING_TYPES(grad_output.scalar_type(), "max_pool3d_backward_channels_last", [&] {
+        cpu_max_pool3d_backward_channels_last<scalar_t>(grad_input, grad_output, indices);
+      });
+      break;
+    }
+    default:
+      TORCH_CHECK(false, "Unsupported memory format. Supports only ChannelsLast3d");
+  }
+}
+
 } // anonymous namespace
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(max_pool2d_kernel, &max_pool2d_kernel_impl);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(max_pool2d_backward_kernel, &max_pool2d_backward_kernel_impl);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(max_pool3d_kernel, &max_pool3d_kernel_impl);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(max_pool3d_backward_kernel, &max_pool3d_backward_kernel_impl);
 
 }} // at::native
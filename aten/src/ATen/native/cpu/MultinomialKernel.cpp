@@ -111,6 +111,48 @@ void multinomial_with_replacement_apply(
   }
 }
 
+// The O(1) draw half of the alias method (see multinomial_alias_setup in
+// native/Distributions.cpp for the plan construction): one uniform in [0, n)
+// selects a slot with its integer part and runs the biased coin flip against
+// q with its fractional part.
+template <typename scalar_t>
+void multinomial_alias_draw_apply(
+    Tensor& result,
+    const Tensor& J,
+    const Tensor& q,
+    c10::optional<Generator> generator) {
+  auto gen = get_generator_or_default<CPUGeneratorImpl>(generator, detail::getDefaultCPUGenerator());
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(gen->mutex_);
+
+  int64_t n_categories = J.size(0);
+  int64_t n_sample = result.size(0);
+
+  const int64_t* const J_ptr = J.data_ptr<int64_t>();
+  const scalar_t* const q_ptr = q.data_ptr<scalar_t>();
+  int64_t* const result_ptr = result.data_ptr<int64_t>();
+
+  at::uniform_real_distribution<double> uniform(0, n_categories);
+  for (int64_t i = 0; i < n_sample; i++) {
+    double sample = uniform(gen);
+    auto idx = static_cast<int64_t>(sample);
+    // uniform samples in [0, n), but guard against rounding at the edge
+    idx = std::min(idx, n_categories - 1);
+    double frac = sample - static_cast<double>(idx);
+    result_ptr[i] = frac < static_cast<double>(q_ptr[idx]) ? idx : J_ptr[idx];
+  }
+}
+
+static void multinomial_alias_draw_kernel_impl(
+    Tensor& result,
+    const Tensor& J,
+    const Tensor& q,
+    c10::optional<Generator> gen) {
+  AT_DISPATCH_FLOATING_TYPES(q.scalar_type(), "multinomial_alias_draw", [&] {
+    multinomial_alias_draw_apply<scalar_t>(result, J, q, gen);
+  });
+}
+
 static void multinomial_with_replacement_kernel_impl(
     Tensor& result,
     const Tensor& self,
@@ -126,5 +168,9 @@ static void multinomial_with_replacement_kernel_impl(
 REGISTER_DISPATCH(
     multinomial_with_replacement_stub,
     &multinomial_with_replacement_kernel_impl);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(
+    multinomial_alias_draw_stub,
+    &multinomial_alias_draw_kernel_impl);
 }
 }
@@ -8,6 +8,8 @@
 #include <ATen/native/Sorting.h>
 #include <ATen/native/SortingUtils.h>
 
+#include <mutex>
+
 namespace at { namespace native {
 
 namespace {
@@ -93,6 +95,136 @@ struct KeyValueCompDesc {
   }
 };
 
+// Comparison sorts are a poor fit for large integer slices, so those go
+// through an LSD radix sort instead. Each 8-bit digit pass builds per-chunk
+// histograms in parallel, turns them into scatter cursors with an exclusive
+// scan in (bucket, chunk) order, and scatters chunks in parallel; keeping
+// chunks in order makes every pass (and hence the sort) stable. Digits are
+// extracted from a copy of the key that is sign-flipped when signed (and
+// complemented for descending sorts), so the stored keys are never
+// transformed. Passes whose
+// digit is constant over all keys are skipped, which typically removes the
+// high passes for ID-style int64 data.
+constexpr int64_t kMinRadixSortSize = 4096;
+
+template <typename scalar_t>
+void radix_sort_kv(scalar_t* keys, int64_t* vals, int64_t n, bool descending) {
+  using unsigned_t = typename std::make_unsigned<scalar_t>::type;
+  constexpr int kDigitBits = 8;
+  constexpr int kNumBuckets = 1 << kDigitBits;
+  constexpr int kNumPasses = sizeof(scalar_t);
+  // Flipping the sign bit maps signed keys onto unsigned values with the
+  // same order; unsigned keys (kByte) are already in radix order and must
+  // not be flipped.
+  constexpr unsigned_t kSignMask = std::is_signed<scalar_t>::value
+      ? static_cast<unsigned_t>(1) << (sizeof(scalar_t) * 8 - 1)
+      : static_cast<unsigned_t>(0);
+
+  const auto transform = [descending](scalar_t v) -> unsigned_t {
+    const unsigned_t u = static_cast<unsigned_t>(v) ^ kSignMask;
+    return descending ? static_cast<unsigned_t>(~u) : u;
+  };
+
+  const int64_t num_chunks = std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          at::get_num_threads(),
+          (n + at::internal::GRAIN_SIZE - 1) / at::internal::GRAIN_SIZE));
+  const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+  std::vector<scalar_t> keys_tmp(n);
+  std::vector<int64_t> vals_tmp(n);
+  scalar_t* keys_in = keys;
+  int64_t* vals_in = vals;
+  scalar_t* keys_out = keys_tmp.data();
+  int64_t* vals_out = vals_tmp.data();
+
+  std::vector<int64_t> histograms(num_chunks * kNumBuckets);
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    const int shift = pass * kDigitBits;
+
+    std::fill(histograms.begin(), histograms.end(), 0);
+    at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t c = begin; c < end; ++c) {
+        int64_t* hist = histograms.data() + c * kNumBuckets;
+        const int64_t lo = c * chunk_size;
+        const int64_t hi = std::min(lo + chunk_size, n);
+        for (int64_t i = lo; i < hi; ++i) {
+          ++hist[(transform(keys_in[i]) >> shift) & (kNumBuckets - 1)];
+        }
+      }
+    });
+
+    // Exclusive scan in (bucket, chunk) order turns the histograms into
+    // per-chunk scatter cursors. A pass where every key lands in the same
+    // bucket would be the identity permutation, so skip its scatter.
+    int64_t num_nonempty = 0;
+    int64_t running = 0;
+    for (int64_t b = 0; b < kNumBuckets; ++b) {
+      int64_t bucket_total = 0;
+      for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t& cursor = histograms[c * kNumBuckets + b];
+        bucket_total += cursor;
+        const int64_t count = cursor;
+        cursor = running;
+        running += count;
+      }
+      num_nonempty += (bucket_total != 0);
+    }
+    if (num_nonempty <= 1) {
+      continue;
+    }
+
+    at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t c = begin; c < end; ++c) {
+        int64_t* cursor = histograms.data() + c * kNumBuckets;
+        const int64_t lo = c * chunk_size;
+        const int64_t hi = std::min(lo + chunk_size, n);
+        for (int64_t i = lo; i < hi; ++i) {
+          const int64_t dst =
+              cursor[(transform(keys_in[i]) >> shift) & (kNumBuckets - 1)]++;
+          keys_out[dst] = keys_in[i];
+          vals_out[dst] = vals_in[i];
+        }
+      }
+    });
+    std::swap(keys_in, keys_out);
+    std::swap(vals_in, vals_out);
+  }
+
+  if (keys_in != keys) {
+    at::parallel_for(0, n, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      std::copy(keys_in + begin, keys_in + end, keys + begin);
+      std::copy(vals_in + begin, vals_in + end, vals + begin);
+    });
+  }
+}
+
+template <
+    typename scalar_t,
+    bool is_radix_key = std::is_integral<scalar_t>::value &&
+        !std::is_same<scalar_t, bool>::value>
+struct MaybeRadixSort {
+  static bool apply(scalar_t*, int64_t, int64_t*, int64_t, int64_t, bool) {
+    return false;
+  }
+};
+
+template <typename scalar_t>
+struct MaybeRadixSort<scalar_t, true> {
+  static bool apply(
+      scalar_t* values, int64_t values_dim_stride,
+      int64_t* indices, int64_t indices_dim_stride,
+      int64_t dim_size, bool descending) {
+    if (values_dim_stride != 1 || indices_dim_stride != 1 ||
+        dim_size < kMinRadixSortSize) {
+      return false;
+    }
+    radix_sort_kv(values, indices, dim_size, descending);
+    return true;
+  }
+};
+
 static void sort_kernel(
     Tensor& values,
     Tensor& indices,
@@ -109,6 +241,14 @@ static void sort_kernel(
       int64_t dim_size
     ) {
       using scalar_t = typename std::remove_pointer<decltype(values)>::type;
+      // Radix sort is stable, so it serves both the stable and regular
+      // variants for large contiguous integer slices.
+      if (MaybeRadixSort<scalar_t>::apply(
+              values, values_dim_stride,
+              indices, indices_dim_stride,
+              dim_size, descending)) {
+        return;
+      }
       auto values_accessor = StridedRandomAccessor<scalar_t>(
         values, values_dim_stride);
       auto indices_accessor = StridedRandomAccessor<int64_t>(
@@ -141,6 +281,65 @@ static void sort_kernel(
   );
 }
 
+// Chunked parallel selection for one big slice with small k. dim_apply only
+// parallelizes across slices, so a single huge slice runs serially and the
+// per-slice path also materializes an n-sized (value, index) array. Here each
+// parallel chunk streams its range once, keeping a k-sized heap of candidates
+// whose worst element sits at the front, and the surviving
+// num_chunks * k candidates are merged with one partial sort at the end. The
+// per-element cost is a single compare against the heap front, so throughput
+// is close to memory bandwidth.
+template <typename scalar_t>
+void topk_single_slice_parallel(
+    Tensor& values,
+    Tensor& indices,
+    const Tensor& self,
+    int64_t k,
+    bool largest) {
+  using elem_t = std::pair<scalar_t, int64_t>;
+  // returns true if x must come before y in the output; NaN is sorted as top
+  // for numpy compatibility, as in the per-slice path
+  auto comp = [largest](const elem_t& x, const elem_t& y) -> bool {
+    if (largest) {
+      return (_isnan<scalar_t>(x.first) && !_isnan<scalar_t>(y.first)) || (x.first > y.first);
+    }
+    return (!_isnan<scalar_t>(x.first) && _isnan<scalar_t>(y.first)) || (x.first < y.first);
+  };
+
+  const int64_t n = self.size(0);
+  const scalar_t* self_data = self.data_ptr<scalar_t>();
+
+  std::vector<elem_t> candidates;
+  std::mutex mutex;
+  at::parallel_for(0, n, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    // heap front is the worst element kept, per make_heap with comp
+    std::vector<elem_t> heap;
+    heap.reserve(k);
+    for (int64_t j = begin; j < end; j++) {
+      elem_t e(self_data[j], j);
+      if ((int64_t)heap.size() < k) {
+        heap.push_back(e);
+        std::push_heap(heap.begin(), heap.end(), comp);
+      } else if (comp(e, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), comp);
+        heap.back() = e;
+        std::push_heap(heap.begin(), heap.end(), comp);
+      }
+    }
+    std::lock_guard<std::mutex> guard(mutex);
+    candidates.insert(candidates.end(), heap.begin(), heap.end());
+  });
+
+  std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end(), comp);
+
+  scalar_t* values_data = values.data_ptr<scalar_t>();
+  int64_t* indices_data = indices.data_ptr<int64_t>();
+  for (int64_t j = 0; j < k; j++) {
+    values_data[j] = candidates[j].first;
+    indices_data[j] = candidates[j].second;
+  }
+}
+
 static void topk_kernel(
     Tensor& values,
     Tensor& indices,
@@ -149,6 +348,15 @@ static void topk_kernel(
     int64_t dim,
     bool largest,
     bool sorted) {
+  if (self.dim() == 1 && self.is_contiguous() &&
+      values.is_contiguous() && indices.is_contiguous() &&
+      k > 0 && k * 64 <= self.size(0) &&
+      self.size(0) >= internal::GRAIN_SIZE) {
+    AT_DISPATCH_ALL_TYPES(self.scalar_type(), "topk_cpu", [&] {
+      topk_single_slice_parallel<scalar_t>(values, indices, self, k, largest);
+    });
+    return;
+  }
   AT_DISPATCH_ALL_TYPES(self.scalar_type(), "topk_cpu", [&] {
     dim_apply(
         {self, values, indices},
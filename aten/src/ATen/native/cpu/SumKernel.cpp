@@ -290,6 +290,98 @@ void scalar_outer_sum(
   }
 }
 
+// Vectorized bf16 sums keep the data in packed bf16 lanes: a whole
+// Vec256<BFloat16> is loaded at a time and widened into two Vec256<float>
+// halves which are accumulated independently. The cascaded summation used by
+// multi_row_sum is not needed here since the fp32 accumulators already carry
+// 16 more mantissa bits than the bf16 inputs.
+void bf16_inner_sum(
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char * C10_RESTRICT data[2], int64_t outer_stride, int64_t out_stride,
+    int64_t size0, int64_t size1) {
+  using bVec = Vec256<BFloat16>;
+  using fVec = Vec256<float>;
+
+  for (int64_t j = 0; j < size1; ++j) {
+    const auto *row_in = data[1] + j * outer_stride;
+    fVec acc0(0.f), acc1(0.f), acc2(0.f), acc3(0.f);
+
+    int64_t i = 0;
+    for (; i + 2 * bVec::size() <= size0; i += 2 * bVec::size()) {
+      const auto v0 = load<bVec>(row_in, sizeof(BFloat16), i);
+      const auto v1 = load<bVec>(row_in, sizeof(BFloat16), i + bVec::size());
+      fVec lo0, hi0, lo1, hi1;
+      std::tie(lo0, hi0) = convert_bfloat16_float(v0);
+      std::tie(lo1, hi1) = convert_bfloat16_float(v1);
+      acc0 = acc0 + lo0;
+      acc1 = acc1 + hi0;
+      acc2 = acc2 + lo1;
+      acc3 = acc3 + hi1;
+    }
+    for (; i + bVec::size() <= size0; i += bVec::size()) {
+      const auto v = load<bVec>(row_in, sizeof(BFloat16), i);
+      fVec lo, hi;
+      std::tie(lo, hi) = convert_bfloat16_float(v);
+      acc0 = acc0 + lo;
+      acc1 = acc1 + hi;
+    }
+    acc0 = (acc0 + acc1) + (acc2 + acc3);
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    float partials[fVec::size()];
+    acc0.store(partials);
+    float final_acc = 0;
+    for (int64_t k = 0; k < fVec::size(); ++k) {
+      final_acc += partials[k];
+    }
+    for (; i < size0; ++i) {
+      final_acc += float(load<BFloat16>(row_in, sizeof(BFloat16), i));
+    }
+    accumulate_result(data[0], out_stride, j, BFloat16(final_acc));
+  }
+}
+
+void bf16_outer_sum(
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char * C10_RESTRICT data[2], int64_t inner_stride, int64_t out_stride,
+    int64_t size0, int64_t size1) {
+  using bVec = Vec256<BFloat16>;
+  using fVec = Vec256<float>;
+
+  // Input is contiguous over the second (non-reduced) dimension
+  int64_t j = 0;
+  for (; j + bVec::size() <= size1; j += bVec::size()) {
+    const auto *cols_in = data[1] + j * sizeof(BFloat16);
+    fVec acc_lo(0.f), acc_hi(0.f);
+    for (int64_t i = 0; i < size0; ++i) {
+      const auto v = bVec::loadu(cols_in + i * inner_stride);
+      fVec lo, hi;
+      std::tie(lo, hi) = convert_bfloat16_float(v);
+      acc_lo = acc_lo + lo;
+      acc_hi = acc_hi + hi;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    std::array<float, bVec::size()> partials;
+    acc_lo.store(partials.data());
+    acc_hi.store(partials.data() + fVec::size());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    std::array<BFloat16, bVec::size()> ans;
+    for (int64_t k = 0; k < bVec::size(); ++k) {
+      ans[k] = BFloat16(partials[k]);
+    }
+    accumulate_result(data[0], out_stride, j, ans);
+  }
+
+  for (; j < size1; ++j) {
+    const auto *col_in = data[1] + j * sizeof(BFloat16);
+    float acc = 0;
+    for (int64_t i = 0; i < size0; ++i) {
+      acc += float(load<BFloat16>(col_in, inner_stride, i));
+    }
+    accumulate_result(data[0], out_stride, j, BFloat16(acc));
+  }
+}
+
 void sum_kernel_impl(TensorIterator &iter) {
   if (isIntegralType(iter.dtype(), /*includeBool=*/ true)) {
     AT_DISPATCH_INTEGRAL_TYPES_AND(ScalarType::Bool, iter.dtype(), "sum_cpu",
@@ -339,10 +431,18 @@ void sum_kernel_impl(TensorIterator &iter) {
 
           if (in_strides[0] == sizeof(scalar_t) && size0 >= Vec256<scalar_t>::size()) {
             // Contiguous inner reduction
-            vectorized_inner_sum<scalar_t>(data, in_strides[1], out_stride, size0, size1);
+            if (std::is_same<scalar_t, BFloat16>::value) {
+              bf16_inner_sum(data, in_strides[1], out_stride, size0, size1);
+            } else {
+              vectorized_inner_sum<scalar_t>(data, in_strides[1], out_stride, size0, size1);
+            }
           } else if (in_strides[1] == sizeof(scalar_t) && size1 >= Vec256<scalar_t>::size()) {
             // Contiguous outer reduction
-            vectorized_outer_sum<scalar_t>(data, in_strides[0], out_stride, size0, size1);
+            if (std::is_same<scalar_t, BFloat16>::value) {
+              bf16_outer_sum(data, in_strides[0], out_stride, size0, size1);
+            } else {
+              vectorized_outer_sum<scalar_t>(data, in_strides[0], out_stride, size0, size1);
+            }
           } else if (in_strides[0] < in_strides[1]) {
             scalar_inner_sum<scalar_t>(data, in_strides, out_stride, size0, size1);
           } else {
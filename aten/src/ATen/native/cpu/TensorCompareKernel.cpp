@@ -3,6 +3,7 @@
 #include <numeric>
 #include <iterator>
 #include <algorithm>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/Resize.h>
 #include <ATen/native/cpu/Loops.h>
+#include <ATen/cpu/vec256/vec256.h>
 
 namespace at { namespace native { namespace {
 
@@ -200,22 +202,57 @@ static void _aminmax_kernel_impl(
   });
 }
 
-static void where_kernel_impl(TensorIterator &iter, ScalarType condition_type) {
+// where() mixes a one-byte condition operand with scalar_t data, so it cannot
+// go through cpu_kernel_vec, which loads every operand at the same lane width.
+// Instead we widen the condition bytes into a Vec256 lane mask by hand and
+// blend, which keeps the contiguous inner loop branch-free for all dtypes.
+template <typename scalar_t>
+static inline void where_loop(char** data, const int64_t* strides, int64_t n) {
+  using Vec = vec256::Vec256<scalar_t>;
+  char* out_bytes = data[0];
+  const char* cond_bytes = data[1];
+  const char* self_bytes = data[2];
+  const char* other_bytes = data[3];
+  if (strides[0] == sizeof(scalar_t) && strides[1] == sizeof(unsigned char) &&
+      strides[2] == sizeof(scalar_t) && strides[3] == sizeof(scalar_t)) {
+    auto* out = reinterpret_cast<scalar_t*>(out_bytes);
+    const auto* cond = reinterpret_cast<const unsigned char*>(cond_bytes);
+    const auto* self = reinterpret_cast<const scalar_t*>(self_bytes);
+    const auto* other = reinterpret_cast<const scalar_t*>(other_bytes);
+    int64_t d = 0;
+    for (; d + Vec::size() <= n; d += Vec::size()) {
+      // Expand each condition byte into an all-ones (or all-zeros) lane,
+      // which is the mask encoding Vec256::blendv expects.
+      // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+      scalar_t mask_buf[Vec::size()];
+      for (int64_t k = 0; k < Vec::size(); k++) {
+        std::memset(&mask_buf[k], cond[d + k] != 0 ? 0xFF : 0x00, sizeof(scalar_t));
+      }
+      auto self_vec = Vec::loadu(self + d);
+      auto other_vec = Vec::loadu(other + d);
+      Vec::blendv(other_vec, self_vec, Vec::loadu(mask_buf)).store(out + d);
+    }
+    for (; d < n; d++) {
+      out[d] = cond[d] != 0 ? self[d] : other[d];
+    }
+  } else {
+    for (int64_t i = 0; i < n; i++) {
+      const auto cond_val =
+          *reinterpret_cast<const unsigned char*>(cond_bytes + i * strides[1]);
+      *reinterpret_cast<scalar_t*>(out_bytes + i * strides[0]) = cond_val != 0
+          ? *reinterpret_cast<const scalar_t*>(self_bytes + i * strides[2])
+          : *reinterpret_cast<const scalar_t*>(other_bytes + i * strides[3]);
+    }
+  }
+}
+
+static void where_kernel_impl(TensorIterator &iter, ScalarType /*condition_type*/) {
+  // Byte and bool conditions are both one byte wide and share the same truth
+  // test (any nonzero byte selects self), so one loop serves either
+  // condition type.
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(at::ScalarType::Half, at::ScalarType::BFloat16, at::ScalarType::Bool,
     iter.dtype(), "where_cpu", [&] {
-    if (condition_type == at::ScalarType::Byte) {
-      cpu_kernel(
-        iter,
-        [=](uint8_t cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
-          return cond_val ? self_val : other_val;
-        });
-    } else {
-      cpu_kernel(
-        iter,
-        [=](bool cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
-          return cond_val ? self_val : other_val;
-        });
-    }
+    iter.for_each(&where_loop<scalar_t>);
   });
 }
 
@@ -360,11 +360,63 @@ static void atanh_kernel(TensorIteratorBase& iter) {
     });
 }
 
+// Vectorized digamma following the same Cephes-derived scheme as
+// calc_digamma: reflect negative arguments, push the argument above 10 with
+// masked recurrence steps, then evaluate the asymptotic series in 1/x^2.
+// Only generic Vec256 ops are used, so this works at every capability level.
+template <typename scalar_t>
+static inline Vec256<scalar_t> vec_digamma(Vec256<scalar_t> x) {
+  using Vec = Vec256<scalar_t>;
+  const Vec zero(scalar_t(0));
+  const Vec one(scalar_t(1));
+  const Vec ten(scalar_t(10));
+  const Vec pi_vec(scalar_t(c10::pi<double>));
+
+  const Vec neg_mask = x < zero;
+  const Vec zero_mask = x == zero;
+  const Vec neg_int_mask = neg_mask & (x == x.trunc());
+
+  // digamma(x) = digamma(1 - x) - pi / tan(pi * x) for x < 0; the tangent is
+  // evaluated on the fractional part of x for accuracy (see calc_digamma).
+  Vec xx = Vec::blendv(x, one - x, neg_mask);
+
+  // Push xx to be >= 10. The argument is positive here, so at most ten
+  // masked recurrence steps are ever needed.
+  Vec result = zero;
+  for (int i = 0; i < 10; ++i) {
+    const Vec small = xx < ten;
+    result = result - Vec::blendv(zero, xx.reciprocal(), small);
+    xx = xx + Vec::blendv(zero, one, small);
+  }
+
+  // Asymptotic series, same coefficients as calc_digamma.
+  const Vec z = (xx * xx).reciprocal();
+  Vec y = Vec(scalar_t(8.33333333333333333333E-2));
+  y = y * z + Vec(scalar_t(-2.10927960927960927961E-2));
+  y = y * z + Vec(scalar_t(7.57575757575757575758E-3));
+  y = y * z + Vec(scalar_t(-4.16666666666666666667E-3));
+  y = y * z + Vec(scalar_t(3.96825396825396825397E-3));
+  y = y * z + Vec(scalar_t(-8.33333333333333333333E-3));
+  y = y * z + Vec(scalar_t(8.33333333333333333333E-2));
+  result = result + xx.log() - Vec(scalar_t(0.5)) * xx.reciprocal() - y * z;
+
+  const Vec r = x - x.trunc();
+  const Vec reflection = result - pi_vec / (pi_vec * r).tan();
+  result = Vec::blendv(result, reflection, neg_mask);
+  // digamma(±0) returns ∓inf and negative integers are poles (NaN), as per
+  // the C++ standard for gamma-related functions and SciPy.
+  result = Vec::blendv(
+      result, Vec(scalar_t(INFINITY)).copysign(x.neg()), zero_mask);
+  result = Vec::blendv(result, Vec(scalar_t(NAN)), neg_int_mask);
+  return result;
+}
+
 static void digamma_kernel(TensorIteratorBase& iter) {
   AT_DISPATCH_FLOATING_TYPES(iter.common_dtype(), "digamma", [&]() {
-    cpu_kernel(
+    cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return calc_digamma(a); });
+        [=](scalar_t a) -> scalar_t { return calc_digamma(a); },
+        [=](Vec256<scalar_t> a) { return vec_digamma(a); });
   });
 }
 
@@ -380,11 +380,31 @@ void cpu_upsample_linear_channels_last(
   int64_t output_slice_size = output_depth * output_height * output_width * channels;
 
   using Vec = vec256::Vec256<scalar_t>;
+
+  // Source indices and lambdas along the width (and height, in the 3d case)
+  // are shared by every output row, so precompute them once instead of
+  // redoing the float index math per output pixel.
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t iw0, iw1;
+  scalar_t w0lambda, w1lambda;
+  const scalar_t width_scale = area_pixel_compute_scale<scalar_t>(
+      input_width, output_width, align_corners, scales[ndim - 3]);
+  std::vector<int64_t> iw0s(output_width), iw1s(output_width);
+  std::vector<scalar_t> w0lambdas(output_width), w1lambdas(output_width);
+  for (int64_t ow = 0; ow < output_width; ow++) {
+    compute_source_index_and_lambda(
+        iw0, iw1, w0lambda, w1lambda, width_scale, ow, input_width, output_width, align_corners);
+    iw0s[ow] = iw0;
+    iw1s[ow] = iw1;
+    w0lambdas[ow] = w0lambda;
+    w1lambdas[ow] = w1lambda;
+  }
+
+  // Parallelize over output rows rather than the batch so a single image
+  // (the common segmentation serving case) still uses every thread.
   auto loop2d = [&](int64_t begin, int64_t end) {
     const scalar_t height_scale = area_pixel_compute_scale<scalar_t>(
         input_height, output_height, align_corners, scales[0]);
-    const scalar_t width_scale = area_pixel_compute_scale<scalar_t>(
-        input_width, output_width, align_corners, scales[1]);
 
     auto input_indexr = [=](int64_t n, int64_t h, int64_t w) {
       return input_data + n * input_height * input_width * channels +
@@ -392,42 +412,41 @@ void cpu_upsample_linear_channels_last(
     };
 
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    int64_t ih0, ih1, iw0, iw1;
-    scalar_t h0lambda, h1lambda, w0lambda, w1lambda;
-    for (int64_t n = begin; n < end; n++) {
-      for (int64_t oh = 0; oh < output_height; oh++) {
-        compute_source_index_and_lambda(
-            ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
-        for (int64_t ow = 0; ow < output_width; ow++) {
-          compute_source_index_and_lambda(
-              iw0, iw1, w0lambda, w1lambda, width_scale, ow, input_width, output_width, align_corners);
-
-          scalar_t* out = output_data + n * output_slice_size +
-              oh * output_width * channels + ow * channels;
-          scalar_t* i00 = input_indexr(n, ih0, iw0);
-          scalar_t* i01 = input_indexr(n, ih0, iw1);
-          scalar_t* i10 = input_indexr(n, ih1, iw0);
-          scalar_t* i11 = input_indexr(n, ih1, iw1);
-
-          int64_t size = channels;
-          int64_t d = 0;
-          for (; d < size - (size % Vec::size()); d += Vec::size()) {
-            Vec out_vec =
-                Vec(h0lambda * w0lambda) * Vec::loadu(i00 + d) + /* h0 * w0 * i00 */
-                Vec(h0lambda * w1lambda) * Vec::loadu(i01 + d) + /* h0 * w1 * i01 */
-                Vec(h1lambda * w0lambda) * Vec::loadu(i10 + d) + /* h1 * w0 * i10 */
-                Vec(h1lambda * w1lambda) * Vec::loadu(i11 + d);  /* h1 * w1 * i11 */
-            out_vec.store(out + d);
-          }
-          for (; d < size; d++) {
-            out[d] =
-                h0lambda * w0lambda * i00[d] + /* h0 * w0 * i00 */
-                h0lambda * w1lambda * i01[d] + /* h0 * w1 * i01 */
-                h1lambda * w0lambda * i10[d] + /* h1 * w0 * i10 */
-                h1lambda * w1lambda * i11[d];  /* h1 * w1 * i11 */
-          }
+    int64_t ih0, ih1;
+    scalar_t h0lambda, h1lambda;
+    int64_t n = 0;
+    int64_t oh = 0;
+    data_index_init(begin, n, num_batches, oh, output_height);
+    for (int64_t i = begin; i < end; i++) {
+      compute_source_index_and_lambda(
+          ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        scalar_t* out = output_data + n * output_slice_size +
+            oh * output_width * channels + ow * channels;
+        scalar_t* i00 = input_indexr(n, ih0, iw0s[ow]);
+        scalar_t* i01 = input_indexr(n, ih0, iw1s[ow]);
+        scalar_t* i10 = input_indexr(n, ih1, iw0s[ow]);
+        scalar_t* i11 = input_indexr(n, ih1, iw1s[ow]);
+
+        int64_t size = channels;
+        int64_t d = 0;
+        for (; d < size - (size % Vec::size()); d += Vec::size()) {
+          Vec out_vec =
+              Vec(h0lambda * w0lambdas[ow]) * Vec::loadu(i00 + d) + /* h0 * w0 * i00 */
+              Vec(h0lambda * w1lambdas[ow]) * Vec::loadu(i01 + d) + /* h0 * w1 * i01 */
+              Vec(h1lambda * w0lambdas[ow]) * Vec::loadu(i10 + d) + /* h1 * w0 * i10 */
+              Vec(h1lambda * w1lambdas[ow]) * Vec::loadu(i11 + d);  /* h1 * w1 * i11 */
+          out_vec.store(out + d);
+        }
+        for (; d < size; d++) {
+          out[d] =
+              h0lambda * w0lambdas[ow] * i00[d] + /* h0 * w0 * i00 */
+              h0lambda * w1lambdas[ow] * i01[d] + /* h0 * w1 * i01 */
+              h1lambda * w0lambdas[ow] * i10[d] + /* h1 * w0 * i10 */
+              h1lambda * w1lambdas[ow] * i11[d];  /* h1 * w1 * i11 */
         }
       }
+      data_index_step(n, num_batches, oh, output_height);
     }
   };
 
@@ -436,8 +455,6 @@ void cpu_upsample_linear_channels_last(
         input_depth, output_depth, align_corners, scales[0]);
     const scalar_t height_scale = area_pixel_compute_scale<scalar_t>(
         input_height, output_height, align_corners, scales[1]);
-    const scalar_t width_scale = area_pixel_compute_scale<scalar_t>(
-        input_width, output_width, align_corners, scales[2]);
 
     auto input_indexr = [=](int64_t n, int64_t d, int64_t h, int64_t w) {
       return input_data + n * input_depth * input_height * input_width * channels +
@@ -446,70 +463,73 @@ void cpu_upsample_linear_channels_last(
     };
 
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    int64_t id0, id1, ih0, ih1, iw0, iw1;
-    scalar_t d0lambda, d1lambda, h0lambda, h1lambda, w0lambda, w1lambda;
-    for (int64_t n = begin; n < end; n++) {
-      for (int64_t od = 0; od < output_depth; od++) {
-        compute_source_index_and_lambda(
-            id0, id1, d0lambda, d1lambda, depth_scale, od, input_depth, output_depth, align_corners);
-        for (int64_t oh = 0; oh < output_height; oh++) {
-          compute_source_index_and_lambda(
-              ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
-          for (int64_t ow = 0; ow < output_width; ow++) {
-            compute_source_index_and_lambda(
-                iw0, iw1, w0lambda, w1lambda, width_scale, ow, input_width, output_width, align_corners);
-
-            scalar_t* out = output_data + n * output_slice_size +
-                od * output_height * output_width * channels +
-                oh * output_width * channels + ow * channels;
-            scalar_t* i000 = input_indexr(n, id0, ih0, iw0);
-            scalar_t* i001 = input_indexr(n, id0, ih0, iw1);
-            scalar_t* i010 = input_indexr(n, id0, ih1, iw0);
-            scalar_t* i011 = input_indexr(n, id0, ih1, iw1);
-            scalar_t* i100 = input_indexr(n, id1, ih0, iw0);
-            scalar_t* i101 = input_indexr(n, id1, ih0, iw1);
-            scalar_t* i110 = input_indexr(n, id1, ih1, iw0);
-            scalar_t* i111 = input_indexr(n, id1, ih1, iw1);
-
-            int64_t size = channels;
-            int64_t d = 0;
-            for (; d < size - (size % Vec::size()); d += Vec::size()) {
-              Vec out_vec =
-                  Vec(d0lambda * h0lambda * w0lambda) * Vec::loadu(i000 + d) + /* d0 * h0 * w0 * i000 */
-                  Vec(d0lambda * h0lambda * w1lambda) * Vec::loadu(i001 + d) + /* d0 * h0 * w1 * i001 */
-                  Vec(d0lambda * h1lambda * w0lambda) * Vec::loadu(i010 + d) + /* d0 * h1 * w0 * i010 */
-                  Vec(d0lambda * h1lambda * w1lambda) * Vec::loadu(i011 + d) + /* d0 * h1 * w1 * i011 */
-                  Vec(d1lambda * h0lambda * w0lambda) * Vec::loadu(i100 + d) + /* d1 * h0 * w0 * i100 */
-                  Vec(d1lambda * h0lambda * w1lambda) * Vec::loadu(i101 + d) + /* d1 * h0 * w1 * i101 */
-                  Vec(d1lambda * h1lambda * w0lambda) * Vec::loadu(i110 + d) + /* d1 * h1 * w0 * i110 */
-                  Vec(d1lambda * h1lambda * w1lambda) * Vec::loadu(i111 + d);  /* d1 * h1 * w1 * i111 */
-              out_vec.store(out + d);
-            }
-            for (; d < size; d++) {
-              out[d] =
-                  d0lambda * h0lambda * w0lambda * i000[d] + /* d0 * h0 * w0 * i000 */
-                  d0lambda * h0lambda * w1lambda * i001[d] + /* d0 * h0 * w1 * i001 */
-                  d0lambda * h1lambda * w0lambda * i010[d] + /* d0 * h1 * w0 * i010 */
-                  d0lambda * h1lambda * w1lambda * i011[d] + /* d0 * h1 * w1 * i011 */
-                  d1lambda * h0lambda * w0lambda * i100[d] + /* d1 * h0 * w0 * i100 */
-                  d1lambda * h0lambda * w1lambda * i101[d] + /* d1 * h0 * w1 * i101 */
-                  d1lambda * h1lambda * w0lambda * i110[d] + /* d1 * h1 * w0 * i110 */
-                  d1lambda * h1lambda * w1lambda * i111[d];  /* d1 * h1 * w1 * i111 */
-            }
-          }
+    int64_t id0, id1, ih0, ih1;
+    scalar_t d0lambda, d1lambda, h0lambda, h1lambda;
+    int64_t n = 0;
+    int64_t od = 0;
+    int64_t oh = 0;
+    data_index_init(begin, n, num_batches, od, output_depth, oh, output_height);
+    for (int64_t i = begin; i < end; i++) {
+      compute_source_index_and_lambda(
+          id0, id1, d0lambda, d1lambda, depth_scale, od, input_depth, output_depth, align_corners);
+      compute_source_index_and_lambda(
+          ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        const scalar_t w0lambda = w0lambdas[ow];
+        const scalar_t w1lambda = w1lambdas[ow];
+        scalar_t* out = output_data + n * output_slice_size +
+            od * output_height * output_width * channels +
+            oh * output_width * channels + ow * channels;
+        scalar_t* i000 = input_indexr(n, id0, ih0, iw0s[ow]);
+        scalar_t* i001 = input_indexr(n, id0, ih0, iw1s[ow]);
+        scalar_t* i010 = input_indexr(n, id0, ih1, iw0s[ow]);
+        scalar_t* i011 = input_indexr(n, id0, ih1, iw1s[ow]);
+        scalar_t* i100 = input_indexr(n, id1, ih0, iw0s[ow]);
+        scalar_t* i101 = input_indexr(n, id1, ih0, iw1s[ow]);
+        scalar_t* i110 = input_indexr(n, id1, ih1, iw0s[ow]);
+        scalar_t* i111 = input_indexr(n, id1, ih1, iw1s[ow]);
+
+        int64_t size = channels;
+        int64_t d = 0;
+        for (; d < size - (size % Vec::size()); d += Vec::size()) {
+          Vec out_vec =
+              Vec(d0lambda * h0lambda * w0lambda) * Vec::loadu(i000 + d) + /* d0 * h0 * w0 * i000 */
+              Vec(d0lambda * h0lambda * w1lambda) * Vec::loadu(i001 + d) + /* d0 * h0 * w1 * i001 */
+              Vec(d0lambda * h1lambda * w0lambda) * Vec::loadu(i010 + d) + /* d0 * h1 * w0 * i010 */
+              Vec(d0lambda * h1lambda * w1lambda) * Vec::loadu(i011 + d) + /* d0 * h1 * w1 * i011 */
+              Vec(d1lambda * h0lambda * w0lambda) * Vec::loadu(i100 + d) + /* d1 * h0 * w0 * i100 */
+              Vec(d1lambda * h0lambda * w1lambda) * Vec::loadu(i101 + d) + /* d1 * h0 * w1 * i101 */
+              Vec(d1lambda * h1lambda * w0lambda) * Vec::loadu(i110 + d) + /* d1 * h1 * w0 * i110 */
+              Vec(d1lambda * h1lambda * w1lambda) * Vec::loadu(i111 + d);  /* d1 * h1 * w1 * i111 */
+          out_vec.store(out + d);
+        }
+        for (; d < size; d++) {
+          out[d] =
+              d0lambda * h0lambda * w0lambda * i000[d] + /* d0 * h0 * w0 * i000 */
+              d0lambda * h0lambda * w1lambda * i001[d] + /* d0 * h0 * w1 * i001 */
+              d0lambda * h1lambda * w0lambda * i010[d] + /* d0 * h1 * w0 * i010 */
+              d0lambda * h1lambda * w1lambda * i011[d] + /* d0 * h1 * w1 * i011 */
+              d1lambda * h0lambda * w0lambda * i100[d] + /* d1 * h0 * w0 * i100 */
+              d1lambda * h0lambda * w1lambda * i101[d] + /* d1 * h0 * w1 * i101 */
+              d1lambda * h1lambda * w0lambda * i110[d] + /* d1 * h1 * w0 * i110 */
+              d1lambda * h1lambda * w1lambda * i111[d];  /* d1 * h1 * w1 * i111 */
         }
       }
+      data_index_step(n, num_batches, od, output_depth, oh, output_height);
     }
   };
 
+  int64_t output_row_size = output_width * channels;
   if (ndim == 4) {
-    // upsample nearest 2d
-    at::parallel_for(0, num_batches, at::internal::GRAIN_SIZE / output_slice_size / 4, loop2d);
+    // upsample bilinear 2d
+    at::parallel_for(0, num_batches * output_height,
+        at::internal::GRAIN_SIZE / output_row_size / 4, loop2d);
   } else {
-    // upsample nearest 3d
+    // upsample trilinear 3d
     TORCH_INTERNAL_ASSERT(ndim == 5);
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    at::parallel_for(0, num_batches, at::internal::GRAIN_SIZE / output_slice_size / 8, loop3d);
+    at::parallel_for(0, num_batches * output_depth * output_height,
+        at::internal::GRAIN_SIZE / output_row_size / 8, loop3d);
   }
 
   if (!output_.is_contiguous(channels_last_memory_format)) {
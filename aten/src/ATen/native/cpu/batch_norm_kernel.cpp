@@ -100,6 +100,117 @@ void batch_norm_cpu_inference_contiguous_impl(Tensor& output,
   }
 }
 
+/// Fused (batch_norm -> relu) variant of the contiguous fast path above.
+/// The clamp happens in-register, so the activation costs no extra pass
+/// over memory.
+template<typename scalar_t>
+void batch_norm_cpu_inference_relu_contiguous_impl(Tensor& output,
+    const Tensor& input, const Tensor& weight, const Tensor& bias,
+    const Tensor& mean, const Tensor& variance, double eps) {
+
+  using Vec = Vec256<scalar_t>;
+  int64_t n_batch = input.size(0);
+  int64_t n_channel = input.size(1);
+  int64_t image_size = input.numel() / n_batch / n_channel;
+
+  Tensor alpha = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor beta = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  auto alpha_data = alpha.accessor<scalar_t, 1>();
+  auto beta_data = beta.accessor<scalar_t, 1>();
+
+  batch_norm_cpu_inference_collect_linear_and_constant_terms<scalar_t>(
+     alpha_data, beta_data, n_channel, weight, bias, mean, variance, eps);
+
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+
+  // output(n, c, h, w) = max(input(n, c, h, w) * alpha(c) + beta(c), 0)
+  const Vec zero_vec(scalar_t(0));
+  if (image_size != 1) {
+    const int64_t n_offset = n_channel * image_size;
+    const int64_t loop_size = image_size - (image_size % Vec::size());
+    for (int64_t n = 0; n < n_batch; n++) {
+      for (int64_t c = 0; c < n_channel; c++) {
+        const Vec alpha_vec(alpha_data[c]);
+        const Vec beta_vec(beta_data[c]);
+        int64_t offset = n * n_offset + c * image_size;
+        int64_t d = 0;
+        for (; d < loop_size; d += Vec::size()) {
+          Vec data_vec = Vec::loadu(input_data + offset + d);
+          Vec output_vec = maximum(data_vec * alpha_vec + beta_vec, zero_vec);
+          output_vec.store(output_data + offset + d);
+        }
+        if (image_size - d > 0) {
+          Vec data_vec = Vec::loadu(input_data + offset + d, image_size - d);
+          Vec output_vec = maximum(data_vec * alpha_vec + beta_vec, zero_vec);
+          output_vec.store(output_data + offset + d, image_size - d);
+        }
+      }
+    }
+  } else {
+    // image_size == 1
+    for (int64_t n = 0; n < n_batch; ++n) {
+      for (int64_t c = 0; c < n_channel; ++c) {
+        int64_t offset = n * n_channel + c;
+        output_data[offset] = std::max(
+            input_data[offset] * alpha_data[c] + beta_data[c], scalar_t(0));
+      }
+    }
+  }
+}
+
+/// Fused (batch_norm -> relu) for channels last contiguous tensors. The
+/// per-channel scale and shift are themselves contiguous over c, so the
+/// inner loop vectorizes across channels with partial loads for the tail.
+template<typename scalar_t>
+void batch_norm_cpu_inference_relu_channels_last_impl(Tensor& output,
+    const Tensor& input, const Tensor& weight, const Tensor& bias,
+    const Tensor& mean, const Tensor& variance, double eps) {
+
+  using Vec = Vec256<scalar_t>;
+  int64_t n_batch = input.size(0);
+  int64_t n_channel = input.size(1);
+  int64_t image_size = input.numel() / n_batch / n_channel;
+
+  Tensor alpha = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor beta = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  auto alpha_a = alpha.accessor<scalar_t, 1>();
+  auto beta_a = beta.accessor<scalar_t, 1>();
+
+  batch_norm_cpu_inference_collect_linear_and_constant_terms<scalar_t>(
+     alpha_a, beta_a, n_channel, weight, bias, mean, variance, eps);
+
+  const scalar_t* alpha_data = alpha.data_ptr<scalar_t>();
+  const scalar_t* beta_data = beta.data_ptr<scalar_t>();
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+
+  // output(n, c, h, w) = max(input(n, c, h, w) * alpha(c) + beta(c), 0)
+  const Vec zero_vec(scalar_t(0));
+  const int64_t loop_size = n_channel - (n_channel % Vec::size());
+  for (int64_t n = 0; n < n_batch; ++n) {
+    for (int64_t i = 0; i < image_size; ++i) {
+      int64_t offset = (n * image_size + i) * n_channel;
+      int64_t c = 0;
+      for (; c < loop_size; c += Vec::size()) {
+        Vec data_vec = Vec::loadu(input_data + offset + c);
+        Vec output_vec = maximum(
+            data_vec * Vec::loadu(alpha_data + c) + Vec::loadu(beta_data + c),
+            zero_vec);
+        output_vec.store(output_data + offset + c);
+      }
+      if (n_channel - c > 0) {
+        Vec data_vec = Vec::loadu(input_data + offset + c, n_channel - c);
+        Vec output_vec = maximum(
+            data_vec * Vec::loadu(alpha_data + c, n_channel - c) +
+                Vec::loadu(beta_data + c, n_channel - c),
+            zero_vec);
+        output_vec.store(output_data + offset + c, n_channel - c);
+      }
+    }
+  }
+}
+
 void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& input,
     const Tensor& weight, const Tensor& bias, const Tensor& mean, const Tensor& variance, double eps) {
   AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_inference_contiguous", [&] {
@@ -107,9 +218,22 @@ void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& in
   });
 }
 
+void batch_norm_cpu_inference_relu_kernel(Tensor& output, const Tensor& input,
+    const Tensor& weight, const Tensor& bias, const Tensor& mean, const Tensor& variance, double eps) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_inference_relu", [&] {
+    if (input.is_contiguous(at::MemoryFormat::ChannelsLast)) {
+      batch_norm_cpu_inference_relu_channels_last_impl<scalar_t>(output, input, weight, bias, mean, variance, eps);
+    } else {
+      batch_norm_cpu_inference_relu_contiguous_impl<scalar_t>(output, input, weight, bias, mean, variance, eps);
+    }
+  });
+}
+
 }// anonymous namespace
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(batch_norm_cpu_inference_contiguous_stub, &batch_norm_cpu_inference_contiguous_kernel);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(batch_norm_cpu_inference_relu_stub, &batch_norm_cpu_inference_relu_kernel);
 
 }} // namespace at::native
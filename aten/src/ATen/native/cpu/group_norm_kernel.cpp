@@ -206,13 +206,24 @@ void GroupNormInputBackward(
       const T c2 =
           (db_val * mean[i] - ds_val) * rstd[i] * rstd[i] * rstd[i] * s;
       const T c3 = -c2 * mean[i] - db_val * rstd[i] * s;
+      const vec256::Vec256<T> c2_vec(c2);
+      const vec256::Vec256<T> c3_vec(c3);
+      const int64_t inner_size = HxW / K * K;
       for (int64_t j = 0; j < D; ++j) {
         const int64_t c = g * D + j;
         const T* dY_ptr = dY + (i * D + j) * HxW;
         const T* X_ptr = X + (i * D + j) * HxW;
         T* dX_ptr = dX + (i * D + j) * HxW;
         const T c1 = rstd[i] * (gamma_null ? T(1) : gamma[c]);
-        for (int64_t k = 0; k < HxW; ++k) {
+        const vec256::Vec256<T> c1_vec(c1);
+        int64_t k = 0;
+        for (; k < inner_size; k += K) {
+          const vec256::Vec256<T> dy_vec = vec256::Vec256<T>::loadu(dY_ptr + k);
+          const vec256::Vec256<T> x_vec = vec256::Vec256<T>::loadu(X_ptr + k);
+          const vec256::Vec256<T> dx_vec = c1_vec * dy_vec + c2_vec * x_vec + c3_vec;
+          dx_vec.store(dX_ptr + k);
+        }
+        for (; k < HxW; ++k) {
           dX_ptr[k] = c1 * dY_ptr[k] + c2 * X_ptr[k] + c3;
         }
       }
@@ -232,18 +243,30 @@ void GammaBackward(
     T* dgamma) {
   const int64_t G = group;
   const int64_t D = C / G;
-  constexpr int64_t K = vec256::Vec256<T>::size();
-  at::parallel_for(0, D, K, [=](int64_t start, int64_t end) {
-    for (int64_t i = 0; i < G; ++i) {
-      std::memset(dgamma + i * D + start, 0, (end - start) * sizeof(T));
-    }
-    for (int64_t i = 0; i < N * G; ++i) {
-      const T* ds_ptr = ds + i * D;
-      const T* db_ptr = db + i * D;
-      const int64_t g = i % G;
-      for (int64_t j = start; j < end; ++j) {
-        const int64_t c = g * D + j;
-        dgamma[c] += (ds_ptr[j] - db_ptr[j] * mean[i]) * rstd[i];
+  // mean and rstd are constant within a group, so accumulating a whole
+  // group segment at a time keeps the inner loop a pure vector fma.
+  at::parallel_for(0, G, 1, [=](int64_t start, int64_t end) {
+    constexpr int64_t K = vec256::Vec256<T>::size();
+    const int64_t inner_size = D / K * K;
+    for (int64_t g = start; g < end; ++g) {
+      T* dgamma_ptr = dgamma + g * D;
+      std::memset(dgamma_ptr, 0, D * sizeof(T));
+      for (int64_t n = 0; n < N; ++n) {
+        const int64_t i = n * G + g;
+        const T* ds_ptr = ds + i * D;
+        const T* db_ptr = db + i * D;
+        const vec256::Vec256<T> mean_vec(mean[i]);
+        const vec256::Vec256<T> rstd_vec(rstd[i]);
+        int64_t j = 0;
+        for (; j < inner_size; j += K) {
+          const vec256::Vec256<T> sum_vec = vec256::Vec256<T>::loadu(dgamma_ptr + j) +
+              (vec256::Vec256<T>::loadu(ds_ptr + j) -
+               vec256::Vec256<T>::loadu(db_ptr + j) * mean_vec) * rstd_vec;
+          sum_vec.store(dgamma_ptr + j);
+        }
+        for (; j < D; ++j) {
+          dgamma_ptr[j] += (ds_ptr[j] - db_ptr[j] * mean[i]) * rstd[i];
+        }
       }
     }
   });
@@ -256,7 +279,13 @@ void BetaBackward(int64_t N, int64_t C, const T* db, T* dbeta) {
     std::memset(dbeta + start, 0, (end - start) * sizeof(T));
     for (int64_t i = 0; i < N; ++i) {
       const T* db_ptr = db + i * C;
-      for (int64_t j = start; j < end; ++j) {
+      int64_t j = start;
+      for (; j + K <= end; j += K) {
+        const vec256::Vec256<T> sum_vec =
+            vec256::Vec256<T>::loadu(dbeta + j) + vec256::Vec256<T>::loadu(db_ptr + j);
+        sum_vec.store(dbeta + j);
+      }
+      for (; j < end; ++j) {
         dbeta[j] += db_ptr[j];
       }
     }
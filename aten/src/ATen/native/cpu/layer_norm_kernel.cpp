@@ -1,12 +1,14 @@
 #include <ATen/native/layer_norm.h>
 
 #include <cmath>
+#include <tuple>
 
 #include <ATen/ATen.h>
 #include <ATen/CPUApplyUtils.h>
 #include <ATen/Dispatch.h>
 #include <ATen/cpu/vec256/functional.h>
 #include <ATen/cpu/vec256/vec256.h>
+#include <ATen/native/cpu/moments_utils.h>
 #include <ATen/Parallel.h>
 
 namespace at {
@@ -35,25 +37,19 @@ void LayerNormKernelImplInternal(
   T* Y_data = Y->data_ptr<T>();
   T* mean_data = mean->data_ptr<T>();
   T* rstd_data = rstd->data_ptr<T>();
-  const T c = T(1) / static_cast<T>(N);
   const bool gamma_null = gamma_data == nullptr;
   const bool beta_null = beta_data == nullptr;
   at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
     for (int64_t i = start; i < end; ++i) {
       T* X_ptr = X_data + i * N;
       T* Y_ptr = Y_data + i * N;
-      T mean_val = vec256::reduce_all<T>(
-          [](Vec& x, Vec& y) { return x + y; },
-          X_ptr,
-          N);
-      T rstd_val = vec256::map_reduce_all<T>(
-          [](Vec x) { return x * x; },
-          [](Vec x, Vec y) { return x + y; },
-          X_ptr,
-          N);
-      mean_val *= c;
-      rstd_val = std::max(rstd_val * c - mean_val * mean_val, T(0));
-      rstd_val = T(1) / std::sqrt(rstd_val + eps);
+      // Single pass over the row: mean and variance come out of one
+      // vectorized Welford sweep instead of separate sum and sum-of-squares
+      // reductions, so each row is read once while it is hot in cache.
+      T mean_val;
+      T rstd_val;
+      std::tie(mean_val, rstd_val) = utils::RowwiseMoments(X_ptr, N);
+      rstd_val = T(1) / std::sqrt(std::max(rstd_val, T(0)) + eps);
       const T scale = rstd_val;
       const T bias = -rstd_val * mean_val;
       if (gamma_null || beta_null) {
@@ -95,6 +91,81 @@ void LayerNormKernelImpl(
   });
 }
 
+template <typename T>
+void ResidualLayerNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    T eps,
+    Tensor* Y) {
+  using Vec = vec256::Vec256<T>;
+  DCHECK_EQ(X.numel(), M * N);
+  DCHECK_EQ(R.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* X_data = X.data_ptr<T>();
+  const T* R_data = R.data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  const bool gamma_null = gamma_data == nullptr;
+  const bool beta_null = beta_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const T* X_ptr = X_data + i * N;
+      const T* R_ptr = R_data + i * N;
+      T* Y_ptr = Y_data + i * N;
+      // One read of each operand per row: the residual sum lands in Y, its
+      // moments are taken while the row is still hot in cache, and Y is
+      // normalized in place.
+      vec256::map2<T>(
+          [](Vec x, Vec r) { return x + r; }, Y_ptr, X_ptr, R_ptr, N);
+      T mean_val;
+      T rstd_val;
+      std::tie(mean_val, rstd_val) = utils::RowwiseMoments(Y_ptr, N);
+      rstd_val = T(1) / std::sqrt(std::max(rstd_val, T(0)) + eps);
+      const T scale = rstd_val;
+      const T bias = -rstd_val * mean_val;
+      if (gamma_null || beta_null) {
+        for (int64_t j = 0; j < N; ++j) {
+          const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+          const T beta_v = beta_null ? T(0) : beta_data[j];
+          Y_ptr[j] = (Y_ptr[j] * scale + bias) * gamma_v + beta_v;
+        }
+      } else {
+        vec256::map3<T>(
+            [scale, bias](Vec y, Vec gamma, Vec beta) {
+              return (y * Vec(scale) + Vec(bias)) * gamma + beta;
+            },
+            Y_ptr,
+            Y_ptr,
+            gamma_data,
+            beta_data,
+            N);
+      }
+    }
+  });
+}
+
+void ResidualLayerNormKernelImpl(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y) {
+  AT_DISPATCH_FLOATING_TYPES(
+      X.scalar_type(), "ResidualLayerNormKernelImpl", [&]() {
+        ResidualLayerNormKernelImplInternal<scalar_t>(
+            X, R, gamma, beta, M, N, static_cast<scalar_t>(eps), Y);
+      });
+}
+
 template <typename T>
 void LayerNormBackwardKernelImplInternal(
     const Tensor& dY,
@@ -292,6 +363,8 @@ void LayerNormBackwardKernelImpl(
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_DISPATCH(ResidualLayerNormKernel, &ResidualLayerNormKernelImpl);
 
 } // namespace native
 } // namespace at
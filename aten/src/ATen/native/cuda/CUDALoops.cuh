@@ -98,6 +98,31 @@ static inline void launch_vectorized_kernel(int64_t N, const func_t& f, array_t
   auto stream = at::cuda::getCurrentCUDAStream();
   int vec_size = memory::can_vectorize_up_to<func_t>(data);
 
+  // Identically sliced operands are misaligned by the same number of
+  // elements, so peeling a scalar head off restores full vectorization for
+  // the bulk (the tail is already handled by the vectorized kernel's
+  // remainder path). The peel costs an extra launch, so only bother when
+  // the realigned bulk is large enough to pay for it.
+  if (vec_size < 4 && N >= 4 * block_work_size) {
+    int64_t head = memory::vec4_alignment_head<func_t>(data);
+    if (head > 0) {
+      auto input_calc = TrivialOffsetCalculator<traits::arity>();
+      auto output_calc = TrivialOffsetCalculator<1>();
+      auto loader = memory::LoadWithoutCast();
+      auto storer = memory::StoreWithoutCast();
+      // The head is at most a vector's worth of elements, so one block is
+      // plenty.
+      unrolled_elementwise_kernel<func_t, array_t><<<1, num_threads, 0, stream>>>(
+          head, f, data, input_calc, output_calc, loader, storer);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+      auto aligned_data = data;
+      memory::advance_pointers<func_t>(aligned_data, head);
+      // Re-enters with every pointer vec4 aligned.
+      launch_vectorized_kernel(N - head, f, aligned_data);
+      return;
+    }
+  }
+
   switch (vec_size) {
   case 4:
     vectorized_elementwise_kernel<4, func_t, array_t><<<grid, num_threads, 0, stream>>>(N, f, data);
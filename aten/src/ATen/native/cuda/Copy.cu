@@ -4,11 +4,15 @@
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAEvent.h>
 #include <c10/cuda/CUDAStream.h>
+#include <ATen/core/jit_type.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
+#include <ATen/native/cuda/Copy.h>
 #include <ATen/native/cuda/Loops.cuh>
 #include <THC/THC.h>
 
+#include <memory>
+
 #ifdef __HIP_PLATFORM_HCC__
 #include <hip/hip_version.h>
 #endif
@@ -18,6 +22,86 @@ namespace native {
 
 using namespace at::cuda;
 
+namespace {
+
+constexpr int kTransposeTileDim = 32;
+constexpr int kTransposeBlockRows = 8;
+
+// Tiled transpose: a tile is read coalesced from src into shared memory and
+// written coalesced to dst, instead of letting one side of the copy stride
+// through memory. The +1 padding keeps the transposed reads off a single
+// shared memory bank.
+template <typename scalar_t>
+C10_LAUNCH_BOUNDS_1(kTransposeTileDim * kTransposeBlockRows)
+__global__ void transpose_copy_kernel(
+    scalar_t* dst, const scalar_t* src, int64_t src_rows, int64_t src_cols) {
+  // src is viewed row-major (src_rows x src_cols); dst is the row-major
+  // transpose (src_cols x src_rows).
+  __shared__ scalar_t tile[kTransposeTileDim][kTransposeTileDim + 1];
+
+  int64_t col = blockIdx.x * kTransposeTileDim + threadIdx.x;
+  int64_t row = blockIdx.y * kTransposeTileDim + threadIdx.y;
+  #pragma unroll
+  for (int i = 0; i < kTransposeTileDim; i += kTransposeBlockRows) {
+    if (col < src_cols && row + i < src_rows) {
+      tile[threadIdx.y + i][threadIdx.x] = src[(row + i) * src_cols + col];
+    }
+  }
+
+  __syncthreads();
+
+  col = blockIdx.y * kTransposeTileDim + threadIdx.x;
+  row = blockIdx.x * kTransposeTileDim + threadIdx.y;
+  #pragma unroll
+  for (int i = 0; i < kTransposeTileDim; i += kTransposeBlockRows) {
+    if (col < src_rows && row + i < src_cols) {
+      dst[(row + i) * src_rows + col] = tile[threadIdx.x][threadIdx.y + i];
+    }
+  }
+}
+
+// Mirrors copy_transpose_valid in Copy.cpp: contiguous dst, 2d transposed
+// src of the same dtype, big enough that tiling pays off. The CUDA version
+// additionally requires both tensors on one device and sizes within the
+// kernel's grid limits.
+bool copy_transpose_valid_cuda(TensorIterator& iter) {
+  constexpr int64_t kMinNumel = 60 * 60;
+  const Tensor& dst = iter.tensor(0);
+  const Tensor& src = iter.tensor(1);
+  return iter.device(0) == iter.device(1) &&
+      iter.dtype(0) == iter.dtype(1) &&
+      dst.is_contiguous() && src.dim() == 2 &&
+      src.stride(0) == 1 && src.stride(1) == src.size(0) &&
+      dst.sizes().equals(src.sizes()) &&
+      src.numel() >= kMinNumel &&
+      src.size(1) <= kTransposeTileDim * int64_t(65535); // gridDim.y limit
+}
+
+void copy_same_type_transpose_cuda(TensorIterator& iter) {
+  const Tensor& dst = iter.tensor(0);
+  const Tensor& src = iter.tensor(1);
+  // src[r, c] lives at data[r + c * nr], i.e. its memory is a row-major
+  // (nc x nr) matrix and dst is that matrix's row-major transpose.
+  const int64_t nr = src.size(0);
+  const int64_t nc = src.size(1);
+
+  CUDAGuard device_guard(src.device());
+  auto stream = getCurrentCUDAStream();
+  dim3 block(kTransposeTileDim, kTransposeBlockRows);
+  dim3 grid(
+      (nr + kTransposeTileDim - 1) / kTransposeTileDim,
+      (nc + kTransposeTileDim - 1) / kTransposeTileDim);
+
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
+      kHalf, kBool, kBFloat16, dst.scalar_type(), "copy_transpose_cuda", [&] {
+    transpose_copy_kernel<scalar_t><<<grid, block, 0, stream>>>(
+        dst.data_ptr<scalar_t>(), src.data_ptr<scalar_t>(), nc, nr);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  });
+}
+
+} // namespace
+
 // device-to-device copy, does type conversion
 void copy_device_to_device(TensorIterator& iter, bool non_blocking) {
   int64_t numel = iter.numel();
@@ -167,7 +251,14 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
 
   // Copy on GPU (or between GPUs)
   if (dst_device.is_cuda() && src_device.is_cuda()) {
-    copy_device_to_device(iter, non_blocking);
+    // 2d transposes into a contiguous destination go through a tiled
+    // shared memory kernel; the generic TensorIterator path would stride
+    // through one side of the copy uncoalesced.
+    if (copy_transpose_valid_cuda(iter)) {
+      copy_same_type_transpose_cuda(iter);
+    } else {
+      copy_device_to_device(iter, non_blocking);
+    }
     return;
   }
 
@@ -205,5 +296,75 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
 
 REGISTER_DISPATCH(copy_stub, &copy_kernel_cuda);
 
+// Note [Non-blocking copy completion futures]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A non_blocking device-to-host copy returns before the data is on the host,
+// and the only stock way to learn when it lands is to synchronize the copy
+// stream, which stalls everything else queued on it. copy_non_blocking gives
+// pipelined readback stages a precise per-copy signal instead: it enqueues
+// the usual non_blocking copy_, then enqueues a host callback on the copy
+// stream that marks the returned future completed. The callback runs on a
+// CUDA driver thread, so callbacks attached to the future via then() must
+// not invoke CUDA APIs; hand the value off to a worker thread instead.
+
+namespace {
+
+struct CopyFutureState {
+  c10::intrusive_ptr<c10::ivalue::Future> future;
+  Tensor result;
+};
+
+void markCopyFutureCompleted(void* raw) {
+  std::unique_ptr<CopyFutureState> state(static_cast<CopyFutureState*>(raw));
+  state->future->markCompleted(state->result);
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || CUDA_VERSION < 10000
+void copyFutureStreamCallback(cudaStream_t, cudaError_t status, void* raw) {
+  if (status != cudaSuccess) {
+    std::unique_ptr<CopyFutureState> state(static_cast<CopyFutureState*>(raw));
+    state->future->setError(std::make_exception_ptr(
+        std::runtime_error(cudaGetErrorString(status))));
+    return;
+  }
+  markCopyFutureCompleted(raw);
+}
+#endif
+
+} // namespace
+
+c10::intrusive_ptr<c10::ivalue::Future> copy_non_blocking(
+    Tensor& dst,
+    const Tensor& src) {
+  dst.copy_(src, /*non_blocking=*/true);
+
+  auto future = c10::make_intrusive<c10::ivalue::Future>(TensorType::get());
+  if (!dst.is_cuda() && !src.is_cuda()) {
+    // CPU-only copies are complete by the time copy_ returns.
+    future->markCompleted(dst);
+    return future;
+  }
+
+  // copy_kernel_cuda queues CPU<->GPU and cross-device copies on the current
+  // stream of the CUDA source (or the CUDA destination, for H2D), so that
+  // stream's progress decides when dst is readable.
+  Device signal_device = src.is_cuda() ? src.device() : dst.device();
+  CUDAGuard device_guard(signal_device);
+  CUDAStream stream = getCurrentCUDAStream(signal_device.index());
+
+  auto* state = new CopyFutureState{future, dst};
+#if !defined(__HIP_PLATFORM_HCC__) && CUDA_VERSION >= 10000
+  const auto err = cudaLaunchHostFunc(stream, markCopyFutureCompleted, state);
+#else
+  const auto err =
+      cudaStreamAddCallback(stream, copyFutureStreamCallback, state, 0);
+#endif
+  if (err != cudaSuccess) {
+    delete state;
+  }
+  AT_CUDA_CHECK(err);
+  return future;
+}
+
 } // namespace native
 } // namespace at
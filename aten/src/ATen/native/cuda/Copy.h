@@ -0,0 +1,20 @@
+#pragma once
+
+#include <ATen/core/ivalue.h>
+#include <c10/macros/Export.h>
+
+namespace at {
+class Tensor;
+
+namespace native {
+
+// Performs `dst.copy_(src, /*non_blocking=*/true)` and returns a future that
+// is marked completed (with dst as its value) once the copy has actually
+// landed, i.e. once it is safe for a host thread to read dst. See
+// Note [Non-blocking copy completion futures] in Copy.cu.
+TORCH_CUDA_CU_API c10::intrusive_ptr<c10::ivalue::Future> copy_non_blocking(
+    Tensor& dst,
+    const Tensor& src);
+
+} // namespace native
+} // namespace at
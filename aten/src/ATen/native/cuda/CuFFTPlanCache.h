@@ -1,6 +1,7 @@
 #include <ATen/ATen.h>
 #include <ATen/Config.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/detail/LazyCuFFT.h>
 #include <ATen/native/cuda/CuFFTUtils.h>
 #include <ATen/native/utils/ParamsHash.h>
 #include <c10/util/accumulate.h>
@@ -103,7 +104,7 @@ class CuFFTHandle {
 public:
 
   CuFFTHandle() {
-    CUFFT_CHECK(cufftCreate(&handle_));
+    CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftCreate(&handle_));
   }
 
   ::cufftHandle & get() { return handle_; }
@@ -112,7 +113,7 @@ public:
   ~CuFFTHandle() {
 // Not using fftDestroy() for rocFFT to work around double freeing of handles
 #ifndef __HIP_PLATFORM_HCC__
-    cufftDestroy(handle_);
+    at::cuda::detail::lazyCuFFT.cufftDestroy(handle_);
 #endif
   }
 };
@@ -339,7 +340,8 @@ public:
 #endif
 
     // disable auto allocation of workspace to use THC allocator
-    CUFFT_CHECK(cufftSetAutoAllocation(plan(), /* autoAllocate */ 0));
+    CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftSetAutoAllocation(
+        plan(), /* autoAllocate */ 0));
 
     size_t ws_size_t;
 
@@ -356,7 +358,8 @@ public:
         /* onembed */ nullptr, /* base_ostride */ 1, /* odist */ 1,
         exec_type, batch, &ws_size_t));
 #else
-      CUFFT_CHECK(cufftXtMakePlanMany(plan(), signal_ndim, signal_sizes.data(),
+      CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftXtMakePlanMany(
+        plan(), signal_ndim, signal_sizes.data(),
         /* inembed */ nullptr, /* base_istride */ 1, /* idist */ 1, itype,
         /* onembed */ nullptr, /* base_ostride */ 1, /* odist */ 1, otype,
         batch, &ws_size_t, exec_type));
@@ -368,7 +371,8 @@ public:
         out_layout.embed.data(), out_layout.stride, out_layout.dist,
         exec_type, batch, &ws_size_t));
 #else
-      CUFFT_CHECK(cufftXtMakePlanMany(plan(), signal_ndim, signal_sizes.data(),
+      CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftXtMakePlanMany(
+            plan(), signal_ndim, signal_sizes.data(),
             in_layout.embed.data(), in_layout.stride, in_layout.dist, itype,
             out_layout.embed.data(), out_layout.stride, out_layout.dist, otype,
             batch, &ws_size_t, exec_type));
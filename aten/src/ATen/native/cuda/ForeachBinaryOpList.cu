@@ -49,6 +49,42 @@ void foreach_tensor_list_op_(TensorList tensors1, TensorList tensors2, const Sca
     });
 }
 
+// Mixed-dtype batches, one launch. See GroupedBinaryOpListAlphaFunctor.
+template<template<class> class Op>
+std::vector<Tensor> foreach_tensor_list_op_grouped(TensorList tensors1, TensorList tensors2, const Scalar& alpha = 1) {
+    std::vector<std::vector<at::Tensor>> tensor_lists;
+    std::vector<at::Tensor> vec_res;
+    vec_res.reserve(tensors1.size());
+    for (const auto& t: tensors1) {
+        vec_res.emplace_back(at::native::empty_like(t));
+    }
+
+    tensor_lists.emplace_back(tensors1.vec());
+    tensor_lists.emplace_back(tensors2.vec());
+    tensor_lists.emplace_back(std::move(vec_res));
+
+    multi_tensor_apply_grouped<3>(tensor_lists,
+                                  GroupedBinaryOpListAlphaFunctor<Op,
+                                                                  /* depth */ 3,
+                                                                  /* r_args_depth */ 2,
+                                                                  /* res_arg_index */ 2>{alpha.to<double>()});
+
+    return tensor_lists[2];
+}
+
+template<template<class> class Op>
+void foreach_tensor_list_op_grouped_(TensorList tensors1, TensorList tensors2, const Scalar& alpha = 1) {
+    std::vector<std::vector<at::Tensor>> tensor_lists;
+    tensor_lists.emplace_back(tensors1.vec());
+    tensor_lists.emplace_back(tensors2.vec());
+
+    multi_tensor_apply_grouped<2>(tensor_lists,
+                                  GroupedBinaryOpListAlphaFunctor<Op,
+                                                                  /* depth */ 2,
+                                                                  /* r_args_depth */ 2,
+                                                                  /* res_arg_index */ 0>{alpha.to<double>()});
+}
+
 #define FOREACH_BINARY_OP_LIST(NAME, OP, DIVISION_OP)                                                       \
 void foreach_tensor_##NAME##_list_kernel_cuda_(TensorList tensors1, TensorList tensors2) {                  \
     check_foreach_api_restrictions(tensors1, tensors2);                                                     \
@@ -71,20 +107,26 @@ std::vector<Tensor> foreach_tensor_##NAME##_list_kernel_cuda(TensorList tensors1
 #define FOREACH_BINARY_OP_LIST_ALPHA(NAME, OP)                                                                          \
 void foreach_tensor_##NAME##_list_kernel_cuda_(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {                \
     check_foreach_api_restrictions(tensors1, tensors2);                                                                 \
-    if (!can_use_fast_route({tensors1, tensors2}, alpha)) {                                                             \
-        return at::native::foreach_tensor_##NAME##_list_kernel_slow_(tensors1, tensors2, alpha);                        \
+    if (can_use_fast_route({tensors1, tensors2}, alpha)) {                                                              \
+        return foreach_tensor_list_op_<OP>(tensors1, tensors2, alpha);                                                  \
+    }                                                                                                                   \
+    if (can_use_grouped_fast_route(tensors1, tensors2, alpha)) {                                                        \
+        return foreach_tensor_list_op_grouped_<OP>(tensors1, tensors2, alpha);                                          \
     }                                                                                                                   \
                                                                                                                         \
-    foreach_tensor_list_op_<OP>(tensors1, tensors2, alpha);                                                             \
+    at::native::foreach_tensor_##NAME##_list_kernel_slow_(tensors1, tensors2, alpha);                                   \
 }                                                                                                                       \
                                                                                                                         \
 std::vector<Tensor> foreach_tensor_##NAME##_list_kernel_cuda(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {  \
     check_foreach_api_restrictions(tensors1, tensors2);                                                                 \
-    if (!can_use_fast_route({tensors1, tensors2}, alpha)) {                                                             \
-        return at::native::foreach_tensor_##NAME##_list_kernel_slow(tensors1, tensors2, alpha);                         \
+    if (can_use_fast_route({tensors1, tensors2}, alpha)) {                                                              \
+        return foreach_tensor_list_op<OP>(tensors1, tensors2, alpha);                                                   \
+    }                                                                                                                   \
+    if (can_use_grouped_fast_route(tensors1, tensors2, alpha)) {                                                        \
+        return foreach_tensor_list_op_grouped<OP>(tensors1, tensors2, alpha);                                           \
     }                                                                                                                   \
                                                                                                                         \
-    return foreach_tensor_list_op<OP>(tensors1, tensors2, alpha);                                                       \
+    return at::native::foreach_tensor_##NAME##_list_kernel_slow(tensors1, tensors2, alpha);                             \
 }
 
 FOREACH_BINARY_OP_LIST_ALPHA(add, std::plus);
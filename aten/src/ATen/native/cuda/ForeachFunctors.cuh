@@ -243,6 +243,38 @@ struct BinaryOpListAlphaFunctor {
         }
 };
 
+// Mixed-dtype counterpart of BinaryOpListAlphaFunctor: each block reads its
+// tensor's dtype tag from the grouped metadata and runs the matching
+// instantiation. Only the floating types that optimizer state mixes are
+// instantiated; can_use_grouped_fast_route keeps everything else off this
+// path. alpha travels as double and is narrowed to each dtype's opmath type.
+template<template<class> class Op, int depth, int r_args_depth, int res_arg_index>
+struct GroupedBinaryOpListAlphaFunctor {
+    double alpha;
+
+    template<typename T>
+    __device__ __forceinline__ void apply(
+        int chunk_size,
+        GroupedTensorListMetadata<depth>& tl) {
+            using opmath_t = typename get_opmath_t<T>::opmath_t;
+            BinaryOpListAlphaFunctor<T, depth, r_args_depth, res_arg_index>()(
+                chunk_size, tl, Op<opmath_t>(), static_cast<opmath_t>(alpha));
+    }
+
+    __device__ void operator() (
+        int chunk_size,
+        GroupedTensorListMetadata<depth>& tl) {
+            const ScalarType dtype = tl.dtype_for_tensor[tl.block_to_tensor[blockIdx.x]];
+            switch (dtype) {
+                case ScalarType::Half: apply<at::Half>(chunk_size, tl); break;
+                case ScalarType::BFloat16: apply<at::BFloat16>(chunk_size, tl); break;
+                case ScalarType::Float: apply<float>(chunk_size, tl); break;
+                case ScalarType::Double: apply<double>(chunk_size, tl); break;
+                default: CUDA_KERNEL_ASSERT(false); break;
+            }
+        }
+};
+
 //
 // Unary Functors
 //
@@ -351,4 +351,61 @@ inline int can_vectorize_up_to(array_t pointers) {
   return result;
 }
 
+// Sliced and storage-offset tensors are usually misaligned for vec4 access
+// in the same way for every operand: all pointers are shifted by the same
+// number of elements, because they were sliced identically. In that case a
+// small scalar head can be peeled off so the bulk of the kernel still runs
+// fully vectorized. The helpers below compute the head count and shift the
+// pointers past it; the launch-side peeling lives in launch_vectorized_kernel.
+
+template<int i>
+struct vec4_alignment_head_helper {
+  template <typename array_t, typename traits>
+  static void apply(bool& ok, array_t pointers, int64_t head, traits _) {
+    using arg_t = typename traits::template arg<i>::type;
+    constexpr int alignment = std::alignment_of<aligned_vector<arg_t, 4>>::value;
+    uint64_t address = reinterpret_cast<uint64_t>(pointers[i + 1]) + head * sizeof(arg_t);
+    ok = ok && (address % alignment == 0);
+  }
+};
+
+// Returns the number of leading elements to peel off so that every pointer
+// becomes aligned for vec4 access: 0 if they already are, -1 if no single
+// head count can align them all (the operands are mutually misaligned).
+template<typename func_t, typename array_t>
+inline int64_t vec4_alignment_head(array_t pointers) {
+  using traits = function_traits<func_t>;
+  using return_t = typename traits::result_type;
+  constexpr int arity = traits::arity;
+  constexpr int alignment = std::alignment_of<aligned_vector<return_t, 4>>::value;
+  uint64_t address = reinterpret_cast<uint64_t>(pointers[0]);
+  uint64_t misalignment = address % alignment;
+  if (misalignment % sizeof(return_t) != 0) {
+    // The output isn't even element aligned; leave it to the scalar path.
+    return -1;
+  }
+  int64_t head = misalignment == 0 ? 0 : (alignment - misalignment) / sizeof(return_t);
+  bool ok = true;
+  detail::static_unroll<vec4_alignment_head_helper, arity>::with_args(ok, pointers, head, traits());
+  return ok ? head : -1;
+}
+
+template<int i>
+struct advance_pointers_helper {
+  template <typename array_t, typename traits>
+  static void apply(array_t& pointers, int64_t n, traits _) {
+    using arg_t = typename traits::template arg<i>::type;
+    pointers[i + 1] += n * sizeof(arg_t);
+  }
+};
+
+// Advances every pointer of `pointers` by `n` elements of its own type.
+template<typename func_t, typename array_t>
+inline void advance_pointers(array_t& pointers, int64_t n) {
+  using traits = function_traits<func_t>;
+  using return_t = typename traits::result_type;
+  pointers[0] += n * sizeof(return_t);
+  detail::static_unroll<advance_pointers_helper, traits::arity>::with_args(pointers, n, traits());
+}
+
 }}} // namespace at::native::memory
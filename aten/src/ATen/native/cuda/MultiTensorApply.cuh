@@ -45,6 +45,16 @@ template<typename scalar_vals_t, int n> struct TensorListScalarListMetadata
   int block_to_chunk[depth_to_max_blocks[n-1]];
 };
 
+// Metadata for batches whose tensors don't all share one dtype (e.g. mixed
+// fp16/fp32 optimizer state). Each tensor carries a dtype tag that the
+// functor switches on per block, so the whole batch still takes a single
+// launch. The extra tag array is at most depth_to_max_tensors bytes, which
+// keeps every instantiation comfortably under the 4KB argument limit.
+template<int n> struct GroupedTensorListMetadata : TensorListMetadata<n>
+{
+  ScalarType dtype_for_tensor[depth_to_max_tensors[n-1]];
+};
+
 template<typename T, typename U, typename... ArgTypes>
 C10_LAUNCH_BOUNDS_1(kBlockSize)
 __global__ void
@@ -168,5 +178,64 @@ void multi_tensor_apply(
             }
         }
     }
+
+// Like multi_tensor_apply, but the tensor lists may mix dtypes (per slot the
+// lists must still agree). The callable receives GroupedTensorListMetadata
+// and is expected to dispatch on dtype_for_tensor per block; see e.g.
+// GroupedBinaryOpListAlphaFunctor in ForeachFunctors.cuh.
+template<int depth, typename T, typename... ArgTypes>
+void multi_tensor_apply_grouped(
+    std::vector<std::vector<at::Tensor>>& tensor_lists,
+    T callable,
+    ArgTypes... args) {
+        TORCH_CHECK(tensor_lists.size() == depth, "Number of tensor lists has to match the depth.");
+        size_t n_tensors = tensor_lists[0].size();
+        GroupedTensorListMetadata<depth> tensorListMeta;
+
+        int loc_block_info = 0;
+        int loc_tensor_info = 0;
+        for(size_t t = 0; t < n_tensors; t++) {
+            tensorListMeta.dtype_for_tensor[loc_tensor_info] = tensor_lists[0][t].scalar_type();
+            tensorListMeta.numel_for_tensor[loc_tensor_info] = tensor_lists[0][t].numel();
+            for (int d = 0; d < depth; d++) {
+                tensorListMeta.addresses[d][loc_tensor_info] = tensor_lists[d][t].data_ptr();
+            }
+            loc_tensor_info++;
+
+            int chunks = (tensor_lists[0][t].numel() + kChunkSize - 1)/kChunkSize;
+            for (int chunk = 0; chunk < chunks; chunk++) {
+                tensorListMeta.block_to_tensor[loc_block_info] = loc_tensor_info - 1;
+                tensorListMeta.block_to_chunk[loc_block_info] = chunk;
+                loc_block_info++;
+
+                bool tensors_full = (loc_tensor_info == depth_to_max_tensors[depth-1] &&
+                    chunk == chunks - 1);
+                bool blocks_full = (loc_block_info == depth_to_max_blocks[depth-1]);
+                bool last_chunk = (t == n_tensors - 1 && chunk == chunks - 1);
+
+                if (tensors_full || blocks_full || last_chunk) {
+                    multi_tensor_apply_kernel<<<loc_block_info, kBlockSize, 0, at::cuda::getCurrentCUDAStream()>>>(
+                        tensorListMeta,
+                        callable,
+                        args...);
+                    C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+                    // Reset.
+                    loc_block_info = 0;
+                    if(chunk == chunks - 1) {
+                        loc_tensor_info = 0;
+                    }
+                    else {
+                        tensorListMeta.dtype_for_tensor[0] = tensorListMeta.dtype_for_tensor[loc_tensor_info-1];
+                        tensorListMeta.numel_for_tensor[0] = tensorListMeta.numel_for_tensor[loc_tensor_info-1];
+                        for(int d = 0; d < depth; d++) {
+                            tensorListMeta.addresses[d][0] = tensorListMeta.addresses[d][loc_tensor_info-1];
+                        }
+                        loc_tensor_info = 1;
+                    }
+                }
+            }
+        }
+    }
 } // namespace
 }} // at::native
@@ -9,6 +9,7 @@
 #include <ATen/native/TensorIterator.h>
 
 #include <ATen/native/cuda/Loops.cuh>
+#include <ATen/native/cuda/MemoryAccess.cuh>
 #include <ATen/cuda/detail/OffsetCalculator.cuh>
 #include <ATen/cuda/CUDAContext.h>
 #include <THC/THCAtomics.cuh>
@@ -79,6 +80,119 @@ static void _launch_scatter_gather_kernel(int64_t N, const func_t& f) {
   C10_CUDA_KERNEL_LAUNCH_CHECK();
 }
 
+// NOTE [ Warp-per-row scatter/gather ]
+// The element-granular kernel above assigns one thread per element, paying an
+// offset calculation and an index load for every element. When gather/scatter
+// moves whole contiguous rows -- the index is expanded along the innermost
+// dim, so every element of a row resolves to the same slice -- it is cheaper
+// to hand each row to a warp: one index load and one offset calculation per
+// row, with the copy itself fully coalesced and issued as 16-byte accesses
+// when both row pointers are suitably aligned. This is the layout produced by
+// index.unsqueeze(-1).expand_as(...) over wide embedding-style rows.
+template <bool is_scatter_like, typename scalar_t, typename offset_calc_t>
+C10_LAUNCH_BOUNDS_1(num_threads)
+__global__ void _scatter_gather_rows_kernel(
+    int num_rows, int64_t row_size,
+    char* self_ptr, char* src_ptr, char* index_ptr,
+    offset_calc_t offset_calc, int64_t index_size, int64_t index_stride) {
+  constexpr int warps_per_block = num_threads / C10_WARP_SIZE;
+  const int lane = threadIdx.x % C10_WARP_SIZE;
+
+  for (int row = blockIdx.x * warps_per_block + threadIdx.x / C10_WARP_SIZE;
+       row < num_rows;
+       row += gridDim.x * warps_per_block) {
+    const auto offsets = offset_calc.get(row);
+    const int64_t idx_dim = *(int64_t*)(index_ptr + offsets[2]);
+    CUDA_KERNEL_ASSERT(idx_dim >= 0 && idx_dim < index_size
+      && "index out of bounds");
+
+    scalar_t* dst_row = (scalar_t*)(self_ptr + offsets[0])
+        + (is_scatter_like ? idx_dim * index_stride : 0);
+    const scalar_t* src_row = (const scalar_t*)(src_ptr + offsets[1])
+        + (is_scatter_like ? 0 : idx_dim * index_stride);
+
+    constexpr int vec_size = 16 / sizeof(scalar_t);
+    using vec_t = memory::aligned_vector<scalar_t, vec_size>;
+    int64_t el = 0;
+    if (vec_size > 1 &&
+        reinterpret_cast<uintptr_t>(dst_row) % sizeof(vec_t) == 0 &&
+        reinterpret_cast<uintptr_t>(src_row) % sizeof(vec_t) == 0) {
+      const int64_t num_vecs = row_size / vec_size;
+      const vec_t* src_vec = reinterpret_cast<const vec_t*>(src_row);
+      vec_t* dst_vec = reinterpret_cast<vec_t*>(dst_row);
+      for (int64_t v = lane; v < num_vecs; v += C10_WARP_SIZE) {
+        dst_vec[v] = src_vec[v];
+      }
+      el = num_vecs * vec_size;
+    }
+    for (el += lane; el < row_size; el += C10_WARP_SIZE) {
+      dst_row[el] = src_row[el];
+    }
+  }
+}
+
+// See NOTE [ Warp-per-row scatter/gather ]. self and src have been restrided
+// to index's shape already. The indexed dim must not be the innermost one,
+// every element of a row must resolve to the same index (an expanded index
+// has stride 0 there), and both data tensors need contiguous rows wide enough
+// to feed a warp of 16-byte accesses; otherwise the element-granular kernel
+// utilizes the machine better.
+static bool can_use_row_wise_kernel(
+    const Tensor& self, const Tensor& src, const Tensor& index, int64_t dim) {
+  const int64_t ndim = index.dim();
+  if (ndim < 2 || dim == ndim - 1) {
+    return false;
+  }
+  if (index.stride(ndim - 1) != 0) {
+    return false;
+  }
+  if (self.stride(ndim - 1) != 1 || src.stride(ndim - 1) != 1) {
+    return false;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+  return index.size(ndim - 1) * self.element_size() >= 512;
+}
+
+template <bool is_scatter_like, typename scalar_t>
+struct _cuda_scatter_gather_row_internal_kernel {
+  void operator() (
+    TensorIterator& iter,
+    int64_t row_size,
+    int64_t index_size,
+    int64_t index_stride
+  ) {
+    if (iter.numel() == 0) {
+      return;
+    }
+
+    if (!iter.can_use_32bit_indexing()) {
+      for (auto& sub_iter : iter.with_32bit_indexing()) {
+        _cuda_scatter_gather_row_internal_kernel<is_scatter_like, scalar_t>()(
+          sub_iter, row_size, index_size, index_stride
+        );
+      }
+      return;
+    }
+
+    char* self_ptr = (char*)iter.data_ptr(0);
+    char* src_ptr = (char*)iter.data_ptr(1);
+    char* index_ptr = (char*)iter.data_ptr(2);
+
+    auto offset_calc = make_offset_calculator<3>(iter);
+
+    const int64_t num_rows = iter.numel();
+    constexpr int warps_per_block = num_threads / C10_WARP_SIZE;
+    const dim3 block(num_threads);
+    const dim3 grid((num_rows + warps_per_block - 1) / warps_per_block);
+    const auto stream = at::cuda::getCurrentCUDAStream();
+    _scatter_gather_rows_kernel<is_scatter_like, scalar_t>
+      <<<grid, block, 0, stream>>>(
+        num_rows, row_size, self_ptr, src_ptr, index_ptr,
+        offset_calc, index_size, index_stride);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  }
+}; // struct _cuda_scatter_gather_row_internal_kernel
+
 
 template <bool is_scatter_like, typename scalar_t>
 struct _cuda_scatter_gather_internal_kernel {
@@ -170,15 +284,6 @@ struct cuda_scatter_gather_base_kernel {
         src.as_strided(index_sizes, src_strides)
       : restride_dim(src, dim, index_sizes);
 
-    auto iter = TensorIteratorConfig()
-      .set_check_mem_overlap(false)
-      .check_all_same_dtype(false)
-      .resize_outputs(false)
-      .add_output(self_restrided)
-      .add_input(src_restrided)
-      .add_input(index)
-      .build();
-
     auto self_dim_stride = ensure_nonempty_stride(self, dim);
     auto self_dim_size = ensure_nonempty_size(self, dim);
 
@@ -188,6 +293,45 @@ struct cuda_scatter_gather_base_kernel {
     auto index_size = is_scatter_like ? self_dim_size : src_dim_size;
     auto index_stride = is_scatter_like ? self_dim_stride : src_dim_stride;
 
+    // See NOTE [ Warp-per-row scatter/gather ]. The fast path performs plain
+    // assignment, so only the non-reducing functor may take it.
+    if (std::is_same<func_t, TensorAssign>::value &&
+        can_use_row_wise_kernel(self_restrided, src_restrided, index, dim)) {
+      const int64_t ndim = index.dim();
+      const int64_t row_size = index.size(ndim - 1);
+      // one iterator element per row: drop the innermost dim everywhere
+      auto row_iter = TensorIteratorConfig()
+        .set_check_mem_overlap(false)
+        .check_all_same_dtype(false)
+        .resize_outputs(false)
+        .add_output(self_restrided.select(ndim - 1, 0))
+        .add_input(src_restrided.select(ndim - 1, 0))
+        .add_input(index.select(ndim - 1, 0))
+        .build();
+
+      AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
+        at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
+        row_iter.dtype(),
+        "cuda_scatter_gather_base_kernel_rows", [&] {
+          using dtype = typename std::conditional<cast_to_opaque,
+            OpaqueType<sizeof(scalar_t)>, scalar_t>::type;
+
+          _cuda_scatter_gather_row_internal_kernel<is_scatter_like, dtype>()(
+            row_iter, row_size, index_size, index_stride
+          );
+        }
+      );
+      return;
+    }
+
+    auto iter = TensorIteratorConfig()
+      .set_check_mem_overlap(false)
+      .check_all_same_dtype(false)
+      .resize_outputs(false)
+      .add_output(self_restrided)
+      .add_input(src_restrided)
+      .add_input(index)
+      .build();
 
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
       at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
@@ -182,8 +182,8 @@ static void exec_cufft_plan(
   }
   TORCH_CHECK(false, "hipFFT doesn't support transforms on type: ", value_type);
 #else
-  CUFFT_CHECK(cufftXtExec(plan, in_data, out_data,
-                          forward ? CUFFT_FORWARD : CUFFT_INVERSE));
+  CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftXtExec(
+      plan, in_data, out_data, forward ? CUFFT_FORWARD : CUFFT_INVERSE));
 #endif
 }
 
@@ -247,10 +247,11 @@ static inline Tensor _run_cufft(
   auto output = at::empty(output_sizes, input.options());
 
   // set to current stream
-  CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
+  CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftSetStream(
+      plan, at::cuda::getCurrentCUDAStream()));
 
   auto ws = at::empty({ config.workspace_size() }, at::device(at::kCUDA).dtype(at::kByte));
-  CUFFT_CHECK(cufftSetWorkArea(plan, ws.data_ptr()));
+  CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftSetWorkArea(plan, ws.data_ptr()));
 
   // run
   exec_cufft_plan(config, input.data_ptr(), output.data_ptr(), !inverse);
@@ -424,9 +425,11 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   }
 
   // prepare cufft for execution
-  CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
+  CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftSetStream(
+      plan, at::cuda::getCurrentCUDAStream()));
   auto workspace = at::empty({ config->workspace_size() }, at::device(at::kCUDA).dtype(at::kByte));
-  CUFFT_CHECK(cufftSetWorkArea(plan, workspace.data_ptr()));
+  CUFFT_CHECK(at::cuda::detail::lazyCuFFT.cufftSetWorkArea(
+      plan, workspace.data_ptr()));
 
   // execute transform plan
   exec_cufft_plan(*config, input.data_ptr(), out.data_ptr(), forward);
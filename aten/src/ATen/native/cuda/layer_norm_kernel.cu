@@ -71,6 +71,57 @@ __global__ void LayerNormForwardCUDAKernel(
   }
 }
 
+// Fused residual-block forward: Y = layer_norm(X + R) in one kernel. The sum
+// is written to Y while its moments accumulate, then Y is normalized in place
+// after the block reduction, so X and R are each read exactly once and the
+// re-read of Y mostly hits cache.
+template <typename T>
+__global__ void ResidualLayerNormCUDAKernel(
+    int64_t N,
+    T eps,
+    const T* X,
+    const T* R,
+    const T* gamma,
+    const T* beta,
+    T* Y) {
+  using T_ACC = acc_type<T, true>;
+  __shared__ T_ACC m_shared[C10_WARP_SIZE];
+  __shared__ T_ACC v_shared[C10_WARP_SIZE];
+  __shared__ T_ACC mean_shared;
+  __shared__ T_ACC rstd_shared;
+  const int64_t i = blockIdx.x;
+  T_ACC sum1 = 0;
+  T_ACC sum2 = 0;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC x = static_cast<T_ACC>(X[index]) + static_cast<T_ACC>(R[index]);
+    Y[index] = static_cast<T>(x);
+    sum1 += x;
+    sum2 += x * x;
+  }
+  sum1 = cuda_utils::BlockReduceSum<T_ACC>(sum1, m_shared);
+  sum2 = cuda_utils::BlockReduceSum<T_ACC>(sum2, v_shared);
+  if (threadIdx.x == 0) {
+    const T_ACC scale = T_ACC(1) / static_cast<T_ACC>(N);
+    sum1 *= scale;
+    sum2 = c10::cuda::compat::max(sum2 * scale - sum1 * sum1, T_ACC(0));
+    mean_shared = sum1;
+    rstd_shared = c10::cuda::compat::rsqrt(sum2 + static_cast<T_ACC>(eps));
+  }
+  __syncthreads();
+  const T_ACC mean = mean_shared;
+  const T_ACC rstd = rstd_shared;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    const T_ACC beta_v =
+        beta == nullptr ? T_ACC(0) : static_cast<T_ACC>(beta[j]);
+    Y[index] =
+        (static_cast<T_ACC>(Y[index]) - mean) * rstd * gamma_v + beta_v;
+  }
+}
+
 template <typename T>
 __global__ void ComputeInternalGradientsCUDAKernel(
     int64_t N,
@@ -301,6 +352,42 @@ void LayerNormKernelImpl(
       });
 }
 
+void ResidualLayerNormKernelImpl(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y) {
+  DCHECK_EQ(X.numel(), M * N);
+  DCHECK_EQ(R.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::Half, at::ScalarType::BFloat16,
+      X.scalar_type(), "ResidualLayerNormKernelImpl", [&]() {
+        const scalar_t* X_data = X.data_ptr<scalar_t>();
+        const scalar_t* R_data = R.data_ptr<scalar_t>();
+        const scalar_t* gamma_data =
+            gamma.defined() ? gamma.data_ptr<scalar_t>() : nullptr;
+        const scalar_t* beta_data =
+            beta.defined() ? beta.data_ptr<scalar_t>() : nullptr;
+        scalar_t* Y_data = Y->data_ptr<scalar_t>();
+        ResidualLayerNormCUDAKernel<scalar_t>
+            <<<M, cuda_utils::kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+                N,
+                static_cast<scalar_t>(eps),
+                X_data,
+                R_data,
+                gamma_data,
+                beta_data,
+                Y_data);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
 template <typename T>
 void LayerNormBackwardKernelImplInternal(
     const Tensor& dY,
@@ -542,6 +629,7 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cuda(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(ResidualLayerNormKernel, &ResidualLayerNormKernelImpl);
 
 } // namespace native
 } // namespace at
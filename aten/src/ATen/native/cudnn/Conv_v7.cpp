@@ -19,6 +19,18 @@
 
 #include <ATen/TensorUtils.h>
 
+#include <ATen/cuda/CUDAContext.h>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <sstream>
@@ -26,6 +38,7 @@
 #include <memory>
 #include <mutex>
 #include <stdint.h>
+#include <string>
 #include <unordered_map>
 
 // Note [behavior of cudnnFind and cudnnGet]
@@ -95,13 +108,93 @@ std::ostream& operator<<(std::ostream & out, const ConvolutionArgs& args) {
 //
 // ---------------------------------------------------------------------
 
+// Note [Persistent benchmark cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With cudnn.benchmark, every process restart used to re-run the exhaustive
+// algorithm search (tens of seconds of warmup for conv-heavy models). If
+// PYTORCH_CUDNN_BENCHMARK_CACHE_DIR is set, each BenchmarkCache is loaded
+// from a file in that directory on first use and rewritten (atomically, via
+// a temp file + rename) whenever a new result is inserted; inserts only
+// happen on benchmark misses, so the rewrite cost disappears in the noise
+// of the search it follows.
+//
+// The file name is keyed by the model of GPU 0 and the cuDNN version, and
+// the header additionally records a format version, the sizes of the key
+// and result PODs, and the full device topology (the ConvolutionParams key
+// contains a device index, so results are only valid on a machine where
+// that index maps to the same GPU model). Any mismatch makes the loader
+// ignore the file; the next insert overwrites it with fresh results.
+
+constexpr char kBenchmarkCacheMagic[8] = {'P', 'T', 'C', 'U', 'D', 'N', 'N', '1'};
+constexpr uint32_t kBenchmarkCacheMaxDevices = 16;
+
+struct BenchmarkCacheFileHeader {
+  char magic[8];
+  uint64_t cudnn_version;
+  uint32_t params_size;
+  uint32_t value_size;
+  uint32_t num_devices;
+  char device_names[kBenchmarkCacheMaxDevices][64];
+  uint64_t num_entries;
+};
+
+int benchmark_cache_pid() {
+#ifdef _WIN32
+  return _getpid();
+#else
+  return getpid();
+#endif
+}
+
+// Returns false if the topology is too big to record.
+bool fill_benchmark_cache_header(BenchmarkCacheFileHeader* header, size_t value_size, size_t num_entries) {
+  const int64_t num_devices = at::cuda::device_count();
+  if (num_devices > static_cast<int64_t>(kBenchmarkCacheMaxDevices)) {
+    return false;
+  }
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, kBenchmarkCacheMagic, sizeof(kBenchmarkCacheMagic));
+  header->cudnn_version = cudnnGetVersion();
+  header->params_size = sizeof(ConvolutionParams);
+  header->value_size = value_size;
+  header->num_devices = num_devices;
+  for (int64_t i = 0; i < num_devices; ++i) {
+    strncpy(header->device_names[i], at::cuda::getDeviceProperties(i)->name,
+            sizeof(header->device_names[i]) - 1);
+  }
+  header->num_entries = num_entries;
+  return true;
+}
+
+std::string benchmark_cache_path(const char* kind) {
+  const char* dir = std::getenv("PYTORCH_CUDNN_BENCHMARK_CACHE_DIR");
+  if (dir == nullptr || dir[0] == '\0') {
+    return std::string();
+  }
+  // Key the name by GPU 0's model so identical pods sharing a directory
+  // never read each other's results across hardware generations.
+  std::string model = at::cuda::getDeviceProperties(0)->name;
+  for (auto& c : model) {
+    if (!isalnum(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  std::ostringstream path;
+  path << dir << "/" << model << "_cudnn" << cudnnGetVersion() << "_" << kind
+       << ".cache";
+  return path.str();
+}
+
 // TODO: Use something less heavy duty than a big honking mutex
 template <typename T>
 struct BenchmarkCache {
+  explicit BenchmarkCache(const char* kind) : kind_(kind) {}
+
   std::mutex mutex;
   std::unordered_map<ConvolutionParams, T, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>> map;
 
   bool find(const ConvolutionParams& params, T* results) {
+    ensureLoaded();
     std::lock_guard<std::mutex> guard(mutex);
     auto it = map.find(params);
     if (it == map.end()) {
@@ -112,14 +205,87 @@ struct BenchmarkCache {
   }
 
   void insert(const ConvolutionParams& params, const T& results) {
+    ensureLoaded();
     std::lock_guard<std::mutex> guard(mutex);
     map[params] = results;
+    persistLocked();
+  }
+
+ private:
+  const char* kind_;
+  std::once_flag loaded_;
+
+  // See Note [Persistent benchmark cache]
+  void ensureLoaded() {
+    std::call_once(loaded_, [&] { loadFromDisk(); });
+  }
+
+  void loadFromDisk() {
+    auto path = benchmark_cache_path(kind_);
+    if (path.empty()) {
+      return;
+    }
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+      return;
+    }
+    BenchmarkCacheFileHeader header;
+    BenchmarkCacheFileHeader expected;
+    bool ok = std::fread(&header, sizeof(header), 1, f) == 1 &&
+        fill_benchmark_cache_header(&expected, sizeof(T), 0);
+    if (ok) {
+      expected.num_entries = header.num_entries;
+      ok = memcmp(&header, &expected, sizeof(header)) == 0;
+    }
+    if (ok) {
+      std::lock_guard<std::mutex> guard(mutex);
+      for (uint64_t i = 0; i < header.num_entries; ++i) {
+        ConvolutionParams params;
+        T value;
+        if (std::fread(&params, sizeof(params), 1, f) != 1 ||
+            std::fread(&value, sizeof(value), 1, f) != 1) {
+          break;
+        }
+        map.emplace(params, value);
+      }
+    }
+    std::fclose(f);
+  }
+
+  // Rewrites the whole file under a temp name, then renames it into place
+  // so concurrent readers never see a half-written cache. Called with the
+  // cache mutex held, only on benchmark misses.
+  void persistLocked() {
+    auto path = benchmark_cache_path(kind_);
+    if (path.empty()) {
+      return;
+    }
+    BenchmarkCacheFileHeader header;
+    if (!fill_benchmark_cache_header(&header, sizeof(T), map.size())) {
+      return;
+    }
+    std::string tmp_path = path + ".tmp." + std::to_string(benchmark_cache_pid());
+    std::FILE* f = std::fopen(tmp_path.c_str(), "wb");
+    if (f == nullptr) {
+      return;
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+    for (auto it = map.begin(); ok && it != map.end(); ++it) {
+      ok = std::fwrite(&it->first, sizeof(it->first), 1, f) == 1 &&
+          std::fwrite(&it->second, sizeof(it->second), 1, f) == 1;
+    }
+    ok = (std::fclose(f) == 0) && ok;
+    if (ok) {
+      std::rename(tmp_path.c_str(), path.c_str());
+    } else {
+      std::remove(tmp_path.c_str());
+    }
   }
 };
 
-BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
-BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos;
-BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos;
+BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos("fwd");
+BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos("bwd_data");
+BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos("bwd_filter");
 
 // TODO: Stop manually allocating CUDA memory; allocate an ATen byte
 // tensor instead.
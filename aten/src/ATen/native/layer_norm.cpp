@@ -10,6 +10,7 @@
 #include <ATen/AccumulateType.h>
 #include <ATen/CPUApplyUtils.h>
 #include <ATen/Config.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Parallel.h>
 #include <torch/library.h>
@@ -166,10 +167,71 @@ Tensor layer_norm(
   return std::get<0>(at::native_layer_norm(input, normalized_shape, weight, bias, eps));
 }
 
+// Fused transformer residual block: layer_norm(dropout(input, p, train) +
+// residual). Inference graphs run it as a single one-pass kernel instead of
+// three full tensor sweeps. Whenever autograd needs to see the block (any
+// input requires grad with grad mode on) or training-mode dropout needs RNG
+// state and a saved mask, the call decomposes into the constituent ops, which
+// also provides the backward through their existing derivatives.
+Tensor _residual_dropout_layer_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape, const c10::optional<Tensor>& weight_opt /* optional */, const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    double eps) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned = at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  const bool needs_grad = at::GradMode::is_enabled() &&
+      (input.requires_grad() || residual.requires_grad() ||
+       (weight.defined() && weight.requires_grad()) ||
+       (bias.defined() && bias.requires_grad()));
+  const bool can_fuse = !needs_grad && !(train && p > 0) &&
+      (input.device().is_cpu() || input.device().is_cuda()) &&
+      input.device() == residual.device() &&
+      input.scalar_type() == residual.scalar_type() &&
+      input.sizes().equals(residual.sizes());
+  if (!can_fuse) {
+    return at::layer_norm(
+        at::dropout(input, p, train) + residual,
+        normalized_shape,
+        weight_opt,
+        bias_opt,
+        eps,
+        /* cudnn_enable, deprecated */ true);
+  }
+
+  auto inputs = _prepare_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto X = std::get<0>(inputs);
+  auto gamma = std::get<1>(inputs);
+  auto beta = std::get<2>(inputs);
+  auto M = std::get<3>(inputs);
+  auto N = std::get<4>(inputs);
+  const auto& R = residual.is_contiguous() ? residual : residual.contiguous();
+
+  Tensor Y = at::native::empty_like(
+      X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  if (M > 0) {
+    ResidualLayerNormKernel(X.device().type(), X, R, gamma, beta, M, N, eps, &Y);
+  }
+  return Y;
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(LayerNormKernel);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(LayerNormBackwardKernel);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(ResidualLayerNormKernel);
 
 // Ported from pytorch/xla repo
 std::tuple<Tensor, Tensor, Tensor> math_native_layer_norm(
@@ -102,8 +102,22 @@ using backward_fn = void (*)(
     Tensor* /* dgamma */,
     Tensor* /* dbeta */);
 
+// Fused residual-block forward: Y = layer_norm(X + R). The kernel makes one
+// read of each operand and one write of Y; mean/rstd are not produced, so it
+// is only used on the inference path (see _residual_dropout_layer_norm).
+using residual_forward_fn = void (*)(
+    const Tensor& /* X */,
+    const Tensor& /* R */,
+    const Tensor& /* gamma */,
+    const Tensor& /* beta */,
+    int64_t /* M */,
+    int64_t /* N */,
+    double /* eps */,
+    Tensor* /* Y */);
+
 DECLARE_DISPATCH(forward_fn, LayerNormKernel);
 DECLARE_DISPATCH(backward_fn, LayerNormBackwardKernel);
+DECLARE_DISPATCH(residual_forward_fn, ResidualLayerNormKernel);
 
 } // namespace native
 } // namespace at
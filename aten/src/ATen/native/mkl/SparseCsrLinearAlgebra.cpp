@@ -40,6 +40,9 @@ Tensor& _sparse_mm_mkl_(
 #include <ATen/Dispatch.h>
 #include <ATen/ExpandUtils.h>
 #include <ATen/SparseCsrTensorImpl.h>
+#include <c10/util/hash.h>
+
+#include <memory>
 
 namespace at {
 namespace sparse_csr {
@@ -146,30 +149,120 @@ class SparseCsrMKLInterface {
     TORCH_CHECK(stat == 0, "mkl_sparse_d_mm failed with error code: ", stat);
   }
 
+  // Runs the inspector phase so subsequent multiplies with this handle use
+  // the optimized execute path. MKL may report the hint as unsupported for
+  // some configurations; the handle stays usable either way.
+  void analyze(MKL_INT dense_ncols) {
+    // Expected call count only steers how aggressively MKL optimizes; any
+    // value well above one tells it the handle is long-lived.
+    constexpr MKL_INT expected_calls = 1000;
+    int stat = mkl_sparse_set_mm_hint(
+        A,
+        SPARSE_OPERATION_NON_TRANSPOSE,
+        desc,
+        SPARSE_LAYOUT_ROW_MAJOR,
+        dense_ncols,
+        expected_calls);
+    TORCH_CHECK(
+        stat == SPARSE_STATUS_SUCCESS || stat == SPARSE_STATUS_NOT_SUPPORTED,
+        "mkl_sparse_set_mm_hint failed with error code: ",
+        stat);
+    stat = mkl_sparse_optimize(A);
+    TORCH_CHECK(
+        stat == SPARSE_STATUS_SUCCESS || stat == SPARSE_STATUS_NOT_SUPPORTED,
+        "mkl_sparse_optimize failed with error code: ",
+        stat);
+  }
+
+  SparseCsrMKLInterface(const SparseCsrMKLInterface&) = delete;
+  SparseCsrMKLInterface& operator=(const SparseCsrMKLInterface&) = delete;
+
   ~SparseCsrMKLInterface() {
     mkl_sparse_destroy(A);
   }
 };
 
+// Cache entry stored on SparseCsrTensorImpl: the MKL handle aliases the
+// index/value buffers rather than copying them, so the (possibly converted)
+// tensors must stay alive as long as the handle does.
+struct CachedMklSpmmHandle {
+  Tensor col_indices;
+  Tensor crow_indices;
+  Tensor values;
+  std::unique_ptr<SparseCsrMKLInterface> impl;
+
+  CachedMklSpmmHandle(
+      Tensor col_indices_,
+      Tensor crow_indices_,
+      Tensor values_,
+      MKL_INT nrows,
+      MKL_INT ncols)
+      : col_indices(std::move(col_indices_)),
+        crow_indices(std::move(crow_indices_)),
+        values(std::move(values_)) {
+    if (values.scalar_type() == kDouble) {
+      impl = std::make_unique<SparseCsrMKLInterface>(
+          col_indices.data_ptr<MKL_INT>(),
+          crow_indices.data_ptr<MKL_INT>(),
+          values.data_ptr<double>(),
+          nrows,
+          ncols);
+    } else {
+      impl = std::make_unique<SparseCsrMKLInterface>(
+          col_indices.data_ptr<MKL_INT>(),
+          crow_indices.data_ptr<MKL_INT>(),
+          values.data_ptr<float>(),
+          nrows,
+          ncols);
+    }
+  }
+};
+
+// Key for the cached handle: the handle aliases the member tensors' storages
+// and was analyzed for their current contents, so it is keyed on the data
+// pointers plus the in-place version counters. Any out-of-place replacement
+// of the members drops the cache via set_member_tensors instead.
+static uint64_t mkl_spmm_handle_key(const SparseCsrTensor& sparse) {
+  auto version = [](const Tensor& t) -> uint64_t {
+    return t.unsafeGetTensorImpl()->version_counter().current_version();
+  };
+  return c10::get_hash(
+      reinterpret_cast<uintptr_t>(sparse.crow_indices().data_ptr()),
+      reinterpret_cast<uintptr_t>(sparse.col_indices().data_ptr()),
+      reinterpret_cast<uintptr_t>(sparse.values().data_ptr()),
+      version(sparse.crow_indices()),
+      version(sparse.col_indices()),
+      version(sparse.values()));
+}
+
 template <typename scalar_t>
 static inline void sparse_mm_mkl_template(
     Tensor& res,
-    const Tensor& col_indices,
-    const Tensor& crow_indices,
-    const Tensor& values,
+    const SparseCsrTensor& sparse,
     const Tensor& dense,
     const Tensor& t,
     const Scalar& alpha,
     const Scalar& beta,
     IntArrayRef size,
     IntArrayRef dense_size) {
-  SparseCsrMKLInterface mkl_impl(
-      col_indices.data_ptr<MKL_INT>(),
-      crow_indices.data_ptr<MKL_INT>(),
-      values.data_ptr<scalar_t>(),
-      size[0],
-      size[1]);
-  mkl_impl.sparse_mm(
+  // Reuse the analyzed handle when the sparsity pattern and values are
+  // unchanged (e.g. a frozen weight), so repeated SpMM only pays the
+  // inspector phase once.
+  auto* sparse_impl = get_sparse_csr_impl(sparse);
+  const auto key = mkl_spmm_handle_key(sparse);
+  auto handle = std::static_pointer_cast<CachedMklSpmmHandle>(
+      sparse_impl->cached_backend_handle(key));
+  if (!handle) {
+    handle = std::make_shared<CachedMklSpmmHandle>(
+        sparse.col_indices().to(TORCH_INT_TYPE),
+        sparse.crow_indices().to(TORCH_INT_TYPE),
+        sparse.values(),
+        size[0],
+        size[1]);
+    handle->impl->analyze(dense_size[1]);
+    sparse_impl->set_cached_backend_handle(key, handle);
+  }
+  handle->impl->sparse_mm(
       res.data_ptr<scalar_t>(),
       dense.data_ptr<scalar_t>(),
       alpha.to<scalar_t>(),
@@ -217,9 +310,7 @@ Tensor& _sparse_mm_mkl_(
       dense.scalar_type(), "addmm_sparse_csr_dense", [&] {
         sparse_mm_mkl_template<scalar_t>(
             self,
-            sparse_.col_indices().to(TORCH_INT_TYPE),
-            sparse_.crow_indices().to(TORCH_INT_TYPE),
-            sparse_.values(),
+            sparse_,
             dense,
             t,
             alpha,
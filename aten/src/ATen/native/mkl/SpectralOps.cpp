@@ -39,6 +39,22 @@ Tensor& _fft_c2c_mkl_out(const Tensor& self, IntArrayRef dim, int64_t normalizat
   AT_ERROR("fft: ATen not compiled with MKL support");
 }
 
+int64_t _cpu_fft_get_plan_cache_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+int64_t _cpu_fft_get_plan_cache_max_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _cpu_fft_set_plan_cache_max_size(int64_t max_size) {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _cpu_fft_clear_plan_cache() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
 }}
 
 #else // AT_MKL_ENABLED
@@ -53,8 +69,13 @@ Tensor& _fft_c2c_mkl_out(const Tensor& self, IntArrayRef dim, int64_t normalizat
 #include <ATen/native/TensorIterator.h>
 
 #include <algorithm>
-#include <vector>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 #include <cmath>
 
 #include <mkl_dfti.h>
@@ -290,6 +311,129 @@ static DftiDescriptor _plan_mkl_fft(
   return descriptor;
 }
 
+// LRU cache of committed DFTI descriptors, the CPU analogue of the cuFFT
+// plan cache. Committing a descriptor is not cheap, and workloads that
+// transform the same signal shape over and over (e.g. STFT featurizers)
+// otherwise rebuild an identical plan for every call. Keyed by everything
+// _plan_mkl_fft folds into the descriptor: strides, sizes, domain,
+// normalization, direction and precision. Descriptors are handed out as
+// shared_ptr so an evicted plan stays alive while a concurrent caller is
+// still computing with it; MKL documents the compute functions as
+// thread-safe for a committed descriptor.
+class DftiPlanCache {
+ public:
+  static constexpr int64_t kDefaultMaxSize = 64;
+
+  std::shared_ptr<DftiDescriptor> lookup(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    // move to the front of the LRU list
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+  }
+
+  void insert(const std::string& key, std::shared_ptr<DftiDescriptor> descriptor) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (max_size_ <= 0) {
+      return;
+    }
+    if (index_.count(key) != 0) {
+      return;  // raced with another thread planning the same transform
+    }
+    lru_.emplace_front(key, std::move(descriptor));
+    index_.emplace(key, lru_.begin());
+    while (static_cast<int64_t>(lru_.size()) > max_size_) {
+      index_.erase(lru_.back().first);
+      lru_.pop_back();
+    }
+  }
+
+  int64_t size() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return static_cast<int64_t>(lru_.size());
+  }
+
+  int64_t max_size() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return max_size_;
+  }
+
+  void set_max_size(int64_t max_size) {
+    TORCH_CHECK(max_size >= 0, "cpu_fft_plan_cache: max_size must be non-negative");
+    std::lock_guard<std::mutex> guard(mutex_);
+    max_size_ = max_size;
+    while (static_cast<int64_t>(lru_.size()) > max_size_) {
+      index_.erase(lru_.back().first);
+      lru_.pop_back();
+    }
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    index_.clear();
+    lru_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  int64_t max_size_ = kDefaultMaxSize;
+  std::list<std::pair<std::string, std::shared_ptr<DftiDescriptor>>> lru_;
+  std::unordered_map<
+      std::string,
+      std::list<std::pair<std::string, std::shared_ptr<DftiDescriptor>>>::iterator>
+      index_;
+};
+
+static DftiPlanCache& dfti_plan_cache() {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static DftiPlanCache cache;
+  return cache;
+}
+
+static std::string _mkl_fft_plan_signature(
+    IntArrayRef in_strides, IntArrayRef out_strides, IntArrayRef sizes,
+    bool complex_input, bool complex_output,
+    int64_t normalization, bool forward, ScalarType dtype) {
+  std::ostringstream oss;
+  for (auto s : in_strides) {
+    oss << s << ',';
+  }
+  oss << ';';
+  for (auto s : out_strides) {
+    oss << s << ',';
+  }
+  oss << ';';
+  for (auto s : sizes) {
+    oss << s << ',';
+  }
+  oss << ';' << complex_input << complex_output << forward << ';'
+      << normalization << ';' << dtype;
+  return oss.str();
+}
+
+// Returns a committed descriptor for the transform, from the cache if an
+// identical one was planned before.
+static std::shared_ptr<DftiDescriptor> _get_mkl_fft_plan(
+    IntArrayRef in_strides, IntArrayRef out_strides, IntArrayRef sizes,
+    bool complex_input, bool complex_output,
+    int64_t normalization, bool forward, ScalarType dtype) {
+  const auto key = _mkl_fft_plan_signature(
+      in_strides, out_strides, sizes, complex_input, complex_output,
+      normalization, forward, dtype);
+  auto& cache = dfti_plan_cache();
+  auto descriptor = cache.lookup(key);
+  if (!descriptor) {
+    descriptor = std::make_shared<DftiDescriptor>(_plan_mkl_fft(
+        in_strides, out_strides, sizes, complex_input, complex_output,
+        normalization, forward, dtype));
+    cache.insert(key, descriptor);
+  }
+  return descriptor;
+}
+
 // Execute a general fft operation (can be c2c, onesided r2c or onesided c2r)
 static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
                          IntArrayRef dim, int64_t normalization, bool forward) {
@@ -342,15 +486,15 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   const auto value_type = c10::toValueType(input.scalar_type());
   out.resize_(batched_out_sizes, MemoryFormat::Contiguous);
 
-  auto descriptor = _plan_mkl_fft(
+  auto descriptor = _get_mkl_fft_plan(
       input.strides(), out.strides(), signal_size, input.is_complex(),
       out.is_complex(), normalization, forward, value_type);
 
   // run the FFT
   if (forward) {
-    MKL_DFTI_CHECK(DftiComputeForward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeForward(descriptor->get(), input.data_ptr(), out.data_ptr()));
   } else {
-    MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeBackward(descriptor->get(), input.data_ptr(), out.data_ptr()));
   }
 
   // Inplace reshaping to original batch shape and inverting the dimension permutation
@@ -460,6 +604,22 @@ Tensor& _fft_c2c_mkl_out(const Tensor& self, IntArrayRef dim, int64_t normalizat
   return out.copy_(result);
 }
 
+int64_t _cpu_fft_get_plan_cache_size() {
+  return dfti_plan_cache().size();
+}
+
+int64_t _cpu_fft_get_plan_cache_max_size() {
+  return dfti_plan_cache().max_size();
+}
+
+void _cpu_fft_set_plan_cache_max_size(int64_t max_size) {
+  dfti_plan_cache().set_max_size(max_size);
+}
+
+void _cpu_fft_clear_plan_cache() {
+  dfti_plan_cache().clear();
+}
+
 }} // namespace at::native
 
 #endif
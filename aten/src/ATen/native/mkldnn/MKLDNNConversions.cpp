@@ -142,6 +142,28 @@ Tensor mkldnn_reorder_conv3d_weight(
   return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
 }
 
+// Analogous to the conv reorders above: inner_product also wants its weight
+// in a blocked format and will repack a public-format weight on every call,
+// so frozen linear (and attention projection / RNN gate) weights are
+// reordered ahead of time.
+Tensor mkldnn_reorder_linear_weight(const Tensor& self) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "mkldnn_reorder_linear_weight: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+
+  auto w = itensor_from_mkldnn(self);
+
+  auto desc = ideep::inner_product_forward::expected_weights_desc(
+      w.get_dims(), w.get_data_type());
+  ideep::tensor result;
+  result.init(desc);
+  result.feed_from(w);
+
+  return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()),
+                                 self.options().device_opt());
+}
+
 #else
 
 Tensor mkldnn_to_dense(const Tensor& mkldnn_tensor, c10::optional<ScalarType> dtype) {
@@ -170,6 +192,10 @@ Tensor mkldnn_reorder_conv3d_weight(
   TORCH_CHECK(false, "mkldnn_reorder_conv3d_weight: MKL-DNN build is disabled");
 }
 
+Tensor mkldnn_reorder_linear_weight(const Tensor& self) {
+  TORCH_CHECK(false, "mkldnn_reorder_linear_weight: MKL-DNN build is disabled");
+}
+
 #endif // AT_MKLDNN_ENABLED()
 
 }}
@@ -9,6 +9,7 @@
 #include <ATen/native/quantized/cpu/quantized_ops.h>
 
 #include <cmath>
+#include <cstring>
 #ifdef USE_FBGEMM
 #include <fbgemm/QuantUtils.h>
 #endif
@@ -124,43 +125,56 @@ Tensor qcat_nhwc_kernel(
             constexpr int64_t VLEN = Vec::size();
             int64_t c = 0;
 
-            // Vectorized loop
-            if (c + VLEN <= curr_C) {
-              auto curr_scale_vec = Vec256<float>(curr_scale);
-              auto curr_zero_pt_vec = Vec256<float>((float)curr_zero_pt);
-              auto scale_neg_zp_premul = curr_scale_vec * curr_zero_pt_vec.neg();
+            if (curr_scale == scale && curr_zero_pt == zero_point) {
+              // Matching qparams: concatenation is a plain copy in the
+              // quantized domain; a fused ReLU clamps against the zero point
+              // without leaving int8.
+              if (ReLUFused) {
+                auto zero_pt_vec = Vec(static_cast<scalar_t>(zero_point));
+                for (; c + VLEN <= curr_C; c += VLEN) {
+                  Vec::loadu(iptr + c).maximum(zero_pt_vec).store(optr + c);
+                }
+                for (; c < curr_C; ++c) {
+                  optr[c] = std::max<scalar_t::underlying>(iptr[c], zero_point);
+                }
+              } else {
+                std::memcpy(
+                    optr, iptr, curr_C * sizeof(scalar_t::underlying));
+                c = curr_C;
+              }
+            } else {
+              // Mismatched qparams: requantize in the integer domain with a
+              // precomputed multiplier instead of round-tripping through
+              // fp32, mirroring qadd_scalar_kernel.
+              float multiplier = curr_scale * inv_scale;
+              auto curr_zero_pt_vec = Vec(static_cast<scalar_t>(curr_zero_pt));
+
+              // Vectorized loop
               for (; c + VLEN <= curr_C; c += VLEN) {
                 auto inp_vec = Vec::loadu(iptr + c);
-                auto float_values = inp_vec.dequantize(
-                    curr_scale_vec, curr_zero_pt_vec, scale_neg_zp_premul);
-                Vec::float_vec_return_type retvals;
-                for (int i = 0; i < Vec::float_num_vecs(); ++i) {
-                  if (ReLUFused) {
-                    retvals[i] =
-                        vec256::maximum(float_values[i], Vec256<float>(0.0f));
-                  } else {
-                    retvals[i] = float_values[i];
-                  }
+                Vec::int_vec_return_type int_vals =
+                    inp_vec.widening_subtract(curr_zero_pt_vec);
+                Vec rv =
+                    Vec::requantize_from_int(int_vals, multiplier, zero_point);
+                if (ReLUFused) {
+                  rv = rv.maximum(Vec(static_cast<scalar_t>(zero_point)));
                 }
-                auto quantized =
-                    Vec::quantize(retvals, scale, zero_point, inv_scale);
-                quantized.store(optr + c);
+                rv.store(optr + c);
               }
-            }
 
-            // Scalar loop
-            for (; c < curr_C; ++c) {
-              auto float_val = at::native::dequantize_val(
-                  curr_scale,
-                  curr_zero_pt,
-                  reinterpret_cast<scalar_t*>(iptr)[c]);
-              if (ReLUFused) {
-                float_val = std::max(0.0f, float_val);
-              }
-              optr[c] = at::native::quantize_val<scalar_t>(
-                            scale, zero_point, float_val)
-                            .val_;
-            } // for c
+              // Scalar loop
+              for (; c < curr_C; ++c) {
+                int32_t int_val = static_cast<int32_t>(iptr[c]) -
+                    static_cast<int32_t>(curr_zero_pt);
+                scalar_t res = at::native::requantize_from_int<scalar_t>(
+                    multiplier, zero_point, int_val);
+                if (ReLUFused) {
+                  res.val_ =
+                      std::max<scalar_t::underlying>(res.val_, zero_point);
+                }
+                optr[c] = res.val_;
+              } // for c
+            }
 
           } // for tidx
         } // for col
@@ -2437,6 +2451,61 @@ void quantized_normalize_kernel(
   });
 }
 
+// Vectorized (de)quantization over a contiguous run that shares one
+// (scale, zero_point) pair. Like the fbgemm and NEON kernels, the quantize
+// path multiplies by the reciprocal of the scale, which can differ from
+// quantize_val (value / scale) by one ulp for a handful of inputs; the
+// scalar tail keeps quantize_val semantics for the leftovers.
+template <typename T>
+void quantize_block_vec256(
+    const float* in,
+    T* out,
+    int64_t N,
+    float scale,
+    int32_t zero_point) {
+  using qVec = Vec256<T>;
+  using fVec = Vec256<float>;
+  constexpr int64_t kBlock = fVec::size() * qVec::float_num_vecs();
+  const float inv_scale = 1.0f / scale;
+  int64_t i = 0;
+  for (; i + kBlock <= N; i += kBlock) {
+    typename qVec::float_vec_return_type fvals;
+    for (int j = 0; j < qVec::float_num_vecs(); ++j) {
+      fvals[j] = fVec::loadu(in + i + j * fVec::size());
+    }
+    qVec::quantize(fvals, scale, zero_point, inv_scale).store(out + i);
+  }
+  for (; i < N; ++i) {
+    out[i] = at::native::quantize_val<T>(scale, zero_point, in[i]);
+  }
+}
+
+template <typename T>
+void dequantize_block_vec256(
+    const T* in,
+    float* out,
+    int64_t N,
+    float scale,
+    int32_t zero_point) {
+  using qVec = Vec256<T>;
+  using fVec = Vec256<float>;
+  constexpr int64_t kBlock = fVec::size() * qVec::float_num_vecs();
+  const fVec scale_vec(scale);
+  const fVec zero_point_vec(static_cast<float>(zero_point));
+  const fVec scale_neg_zp_premul = scale_vec * zero_point_vec.neg();
+  int64_t i = 0;
+  for (; i + kBlock <= N; i += kBlock) {
+    auto fvals = qVec::loadu(in + i).dequantize(
+        scale_vec, zero_point_vec, scale_neg_zp_premul);
+    for (int j = 0; j < qVec::float_num_vecs(); ++j) {
+      fvals[j].store(out + i + j * fVec::size());
+    }
+  }
+  for (; i < N; ++i) {
+    out[i] = at::native::dequantize_val<T>(scale, zero_point, in[i]);
+  }
+}
+
 #ifdef USE_FBGEMM
 void quantize_tensor_per_tensor_affine_cpu(
     Tensor rtensor,
@@ -2618,10 +2687,8 @@ void quantize_tensor_per_tensor_affine_cpu(
         check_tensor_memory_format(rtensor, qtensor);
         const float* const rdata = rtensor.data_ptr<float>();
         auto qdata = qtensor.data_ptr<scalar_t>();
-        auto numel = rtensor.numel();
-        for (int i = 0; i < numel; ++i) {
-          qdata[i] = quantize_val<scalar_t>(scale, zero_point, rdata[i]);
-        }
+        quantize_block_vec256<scalar_t>(
+            rdata, qdata, rtensor.numel(), scale, zero_point);
       });
 #endif // __ARM_NEON__
 }
@@ -2636,10 +2703,8 @@ void dequantize_tensor_per_tensor_affine_cpu(
       check_tensor_memory_format(qtensor, rtensor);
         const auto* qd = qtensor.data_ptr<scalar_t>();
         float* rd = rtensor.data_ptr<float>();
-        auto numel = qtensor.numel();
-        for (auto i = 0; i < numel; ++i) {
-          rd[i] = dequantize_val<scalar_t>(scale, zero_point, qd[i]);
-        }
+        dequantize_block_vec256<scalar_t>(
+            qd, rd, qtensor.numel(), scale, zero_point);
       });
 }
 #endif // USE_FBGEMM
@@ -2674,6 +2739,8 @@ void quantize_tensor_per_channel_impl(
     // channels_last contig.
     // If axis = 0 and channels_last contig, implementation for channels
     // first (NCHW) works.
+    // Stays scalar because the scale changes on every lane; the NEON
+    // specialization below covers quint8 with vectors of per-channel scales.
     for (auto b = 0; b < batches; ++b) {
       for (auto e = 0; e < elements_per_channel; ++e) {
         for (auto c = 0; c < channels; ++c) {
@@ -2684,14 +2751,18 @@ void quantize_tensor_per_channel_impl(
       }
     }
   } else {
+    // Channels-first: each channel is a contiguous run with a single
+    // (scale, zero_point), so the per-tensor vector kernel applies per run.
     for (auto b = 0; b < batches; ++b) {
       for (auto c = 0; c < channels; ++c) {
-        for (auto e = 0; e < elements_per_channel; ++e) {
-          auto i = b * channels * elements_per_channel +
-              c * elements_per_channel + e;
-          out[i] = at::native::quantize_val<T>(
-              scales_data[c], zero_points_data[c], in[i]);
-        }
+        auto i = b * channels * elements_per_channel +
+            c * elements_per_channel;
+        quantize_block_vec256<T>(
+            in + i,
+            out + i,
+            elements_per_channel,
+            scales_data[c],
+            zero_points_data[c]);
       }
     }
   }
@@ -2987,7 +3058,43 @@ void dequantize_tensor_per_channel_affine_cpu(
     int64_t axis) {
   AT_DISPATCH_QINT_TYPES(
       qtensor.scalar_type(), "dequantize_tensor_per_channel_affine_cpu", [&]() {
-        dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(qtensor, rtensor, scales, zero_points, axis);
+        if (axis == 1 &&
+            (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+             rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+          // Per-lane scales keep the channels_last layout on the scalar
+          // kernel.
+          dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(
+              qtensor, rtensor, scales, zero_points, axis);
+          return;
+        }
+        TORCH_CHECK(
+            rtensor.is_contiguous() || (axis <= 1),
+            "If tensor is channels_last contig then per channel quantization "
+            "is supported only for axis = 0 or 1.");
+        // Channels-first: each channel is a contiguous run with a single
+        // (scale, zero_point), so the per-tensor vector kernel applies per
+        // run.
+        int64_t batches = size_to_dim_(axis, rtensor.sizes());
+        int64_t elements_per_channel =
+            size_from_dim_(axis + 1, rtensor.sizes());
+        int64_t channels = rtensor.size(axis);
+        auto scales_data = scales.data_ptr<double>();
+        auto zero_points_data = zero_points.data_ptr<int64_t>();
+        check_tensor_memory_format(qtensor, rtensor);
+        const auto* qd = qtensor.data_ptr<scalar_t>();
+        float* rd = rtensor.data_ptr<float>();
+        for (auto b = 0; b < batches; ++b) {
+          for (auto c = 0; c < channels; ++c) {
+            auto i = b * channels * elements_per_channel +
+                c * elements_per_channel;
+            dequantize_block_vec256<scalar_t>(
+                qd + i,
+                rd + i,
+                elements_per_channel,
+                scales_data[c],
+                zero_points_data[c]);
+          }
+        }
       });
 }
 
@@ -135,13 +135,31 @@ at::Tensor& embedding_lookup_fallback_impl(
         bias = weight_val * bias_val;
       }
 
-      for (int j = 0; j < block_size; ++j) {
-        uint8_t quantized =
-            weight_data[idx * weight_size + j / NUM_ELEM_PER_BYTE];
-        quantized >>= (j % NUM_ELEM_PER_BYTE) * BIT_RATE;
-        quantized &= (1 << BIT_RATE) - 1;
-
-        output_data[j] = fma(scale, quantized, output_data[j] + bias);
+      const uint8_t* row_data = weight_data + idx * weight_size;
+      if (NUM_ELEM_PER_BYTE == 1) {
+        for (int j = 0; j < block_size; ++j) {
+          output_data[j] = fma(scale, row_data[j], output_data[j] + bias);
+        }
+      } else {
+        // Sub-byte rows: unpack a full byte per iteration so the byte load
+        // and shift/mask work is shared by the elements packed into it,
+        // keeping the unpack fused with the accumulation.
+        constexpr uint8_t kMask = (1 << BIT_RATE) - 1;
+        int j = 0;
+        for (int b = 0; b < block_size / NUM_ELEM_PER_BYTE; ++b) {
+          uint8_t quantized = row_data[b];
+          for (int k = 0; k < NUM_ELEM_PER_BYTE; ++k, ++j) {
+            output_data[j] =
+                fma(scale, quantized & kMask, output_data[j] + bias);
+            quantized >>= BIT_RATE;
+          }
+        }
+        for (; j < block_size; ++j) {
+          uint8_t quantized = row_data[j / NUM_ELEM_PER_BYTE];
+          quantized >>= (j % NUM_ELEM_PER_BYTE) * BIT_RATE;
+          output_data[j] =
+              fma(scale, quantized & kMask, output_data[j] + bias);
+        }
       }
     } // for each i
     output_data += block_size;
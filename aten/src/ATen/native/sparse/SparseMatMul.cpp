@@ -6,6 +6,8 @@
 #include <ATen/SparseTensorImpl.h>
 #include <ATen/SparseTensorUtils.h>
 #include <ATen/native/Resize.h>
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
 
 namespace at { namespace native {
@@ -38,7 +40,39 @@ void csr_to_coo(const int64_t n_row, const int64_t Ap[], int64_t Bi[]) {
   }
 }
 
-int64_t _csr_matmult_maxnnz(
+// Number of rows a thread claims per fetch off the shared chunk counter.
+// Small enough that nnz-per-row skew (power-law graphs) cannot strand the
+// bulk of the work on one thread, large enough to amortize the atomic.
+constexpr int64_t kSpGemmRowsPerChunk = 64;
+
+// Hands out [0, n_row) in chunks of kSpGemmRowsPerChunk off a shared atomic
+// counter and invokes f(row_begin, row_end) on each claimed chunk; make_state
+// is run once per worker thread and its result is passed to f as scratch.
+// Static partitioning performs poorly here since the cost of a row is
+// proportional to its intermediate product count, which can vary by orders
+// of magnitude.
+template <typename MakeState, typename F>
+void parallel_rows_dynamic(
+    const int64_t n_row,
+    const MakeState& make_state,
+    const F& f) {
+  const int64_t num_chunks = divup(n_row, kSpGemmRowsPerChunk);
+  std::atomic<int64_t> next_chunk(0);
+  at::parallel_for(0, at::get_num_threads(), 1, [&](int64_t, int64_t) {
+    auto state = make_state();
+    while (true) {
+      int64_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks) {
+        break;
+      }
+      int64_t row_begin = chunk * kSpGemmRowsPerChunk;
+      int64_t row_end = std::min(row_begin + kSpGemmRowsPerChunk, n_row);
+      f(state, row_begin, row_end);
+    }
+  });
+}
+
+void _csr_matmult_row_counts(
     const int64_t n_row,
     const int64_t n_col,
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
@@ -48,32 +82,37 @@ int64_t _csr_matmult_maxnnz(
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     const int64_t Bp[],
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
-    const int64_t Bj[]) {
+    const int64_t Bj[],
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    int64_t Cp[]) {
   /*
-    Compute needed buffer size for matrix `C` in `C = A@B` operation.
+    Symbolic phase of `C = A@B`: stores the number of nonzeros of row `i`
+    of `C` into `Cp[i + 1]`. The caller turns the counts into a row pointer
+    with a prefix sum, after which the numeric phase can fill each row
+    independently at its exact offset.
 
     The matrices should be in proper CSR structure, and their dimensions
     should be compatible.
   */
-  std::vector<int64_t> mask(n_col, -1);
-  int64_t nnz = 0;
-  for (int64_t i = 0; i < n_row; i++) {
-    int64_t row_nnz = 0;
-
-    for (int64_t jj = Ap[i]; jj < Ap[i + 1]; jj++) {
-      int64_t j = Aj[jj];
-      for (int64_t kk = Bp[j]; kk < Bp[j + 1]; kk++) {
-        int64_t k = Bj[kk];
-        if (mask[k] != i) {
-          mask[k] = i;
-          row_nnz++;
+  parallel_rows_dynamic(
+      n_row,
+      [n_col]() { return std::vector<int64_t>(n_col, -1); },
+      [&](std::vector<int64_t>& mask, int64_t row_begin, int64_t row_end) {
+        for (int64_t i = row_begin; i < row_end; i++) {
+          int64_t row_nnz = 0;
+          for (int64_t jj = Ap[i]; jj < Ap[i + 1]; jj++) {
+            int64_t j = Aj[jj];
+            for (int64_t kk = Bp[j]; kk < Bp[j + 1]; kk++) {
+              int64_t k = Bj[kk];
+              if (mask[k] != i) {
+                mask[k] = i;
+                row_nnz++;
+              }
+            }
+          }
+          Cp[i + 1] = row_nnz;
         }
-      }
-    }
-    int64_t next_nnz = nnz + row_nnz;
-    nnz = next_nnz;
-  }
-  return nnz;
+      });
 }
 
 template<class scalar_t>
@@ -93,7 +132,7 @@ void _csr_matmult(
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     const scalar_t Bx[],
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
-    int64_t Cp[],
+    const int64_t Cp[],
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     int64_t Cj[],
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
@@ -113,60 +152,70 @@ void _csr_matmult(
       `Bp[?]`         - row pointer
       `Bj[nnz(B)]`    - column indices
       `Bx[nnz(B)]`    - nonzeros
+    Inputs (cont.):
+      `Cp[n_row+1]` - row pointer, produced by _csr_matmult_row_counts plus
+                      a prefix sum
     Outputs:
-      `Cp[n_row+1]` - row pointer
       `Cj[nnz(C)]`  - column indices
       `Cx[nnz(C)]`  - nonzeros
 
     Note:
-      Output arrays Cp, Cj, and Cx must be preallocated
+      Output arrays Cj and Cx must be preallocated. Since `Cp` already
+      holds the exact offset of every row, rows are filled in parallel
+      without any synchronization on the output arrays.
   */
-  std::vector<int64_t> next(n_col, -1);
-  std::vector<scalar_t> sums(n_col, 0);
-
-  int64_t nnz = 0;
-
-  Cp[0] = 0;
-
-  for (int64_t i = 0; i < n_row; i++) {
-    int64_t head = -2;
-    int64_t length = 0;
-
-    int64_t jj_start = Ap[i];
-    int64_t jj_end = Ap[i + 1];
-    for (int64_t jj = jj_start; jj < jj_end; jj++) {
-      int64_t j = Aj[jj];
-      scalar_t v = Ax[jj];
-
-      int64_t kk_start = Bp[j];
-      int64_t kk_end = Bp[j + 1];
-      for (int64_t kk = kk_start; kk < kk_end; kk++) {
-        int64_t k = Bj[kk];
-
-        sums[k] += v * Bx[kk];
-
-        if (next[k] == -1) {
-          next[k] = head;
-          head = k;
-          length++;
+  struct RowState {
+    std::vector<int64_t> next;
+    std::vector<scalar_t> sums;
+  };
+  parallel_rows_dynamic(
+      n_row,
+      [n_col]() {
+        return RowState{
+            std::vector<int64_t>(n_col, -1), std::vector<scalar_t>(n_col, 0)};
+      },
+      [&](RowState& state, int64_t row_begin, int64_t row_end) {
+        auto& next = state.next;
+        auto& sums = state.sums;
+        for (int64_t i = row_begin; i < row_end; i++) {
+          int64_t head = -2;
+          int64_t length = 0;
+
+          int64_t jj_start = Ap[i];
+          int64_t jj_end = Ap[i + 1];
+          for (int64_t jj = jj_start; jj < jj_end; jj++) {
+            int64_t j = Aj[jj];
+            scalar_t v = Ax[jj];
+
+            int64_t kk_start = Bp[j];
+            int64_t kk_end = Bp[j + 1];
+            for (int64_t kk = kk_start; kk < kk_end; kk++) {
+              int64_t k = Bj[kk];
+
+              sums[k] += v * Bx[kk];
+
+              if (next[k] == -1) {
+                next[k] = head;
+                head = k;
+                length++;
+              }
+            }
+          }
+
+          int64_t nnz = Cp[i];
+          for (int64_t jj = 0; jj < length; jj++) {
+            Cj[nnz] = head;
+            Cx[nnz] = sums[head];
+            nnz++;
+
+            int64_t temp = head;
+            head = next[head];
+
+            next[temp] = -1; // clear arrays
+            sums[temp] = 0;
+          }
         }
-      }
-    }
-
-    for (int64_t jj = 0; jj < length; jj++) {
-      Cj[nnz] = head;
-      Cx[nnz] = sums[head];
-      nnz++;
-
-      int64_t temp = head;
-      head = next[head];
-
-      next[temp] = -1; // clear arrays
-      sums[temp] = 0;
-    }
-
-    Cp[i + 1] = nnz;
-  }
+      });
 }
 
 
@@ -197,13 +246,21 @@ void sparse_matmul_kernel(
 
   Tensor mat2_indptr = coo_to_csr(mat2_row_indices.data_ptr<int64_t>(), K, mat2._nnz());
 
-  auto nnz = _csr_matmult_maxnnz(M, N, mat1_indptr.data_ptr<int64_t>(), mat1_col_indices.data_ptr<int64_t>(),
-      mat2_indptr.data_ptr<int64_t>(), mat2_col_indices.data_ptr<int64_t>());
+  // Symbolic phase: count the nonzeros of every output row in parallel, then
+  // prefix-sum the counts into a row pointer so the numeric phase can write
+  // each row at its exact final offset.
+  Tensor output_indptr = at::empty({M + 1}, kLong);
+  int64_t* output_indptr_ptr = output_indptr.data_ptr<int64_t>();
+  _csr_matmult_row_counts(M, N, mat1_indptr.data_ptr<int64_t>(), mat1_col_indices.data_ptr<int64_t>(),
+      mat2_indptr.data_ptr<int64_t>(), mat2_col_indices.data_ptr<int64_t>(), output_indptr_ptr);
+  output_indptr_ptr[0] = 0;
+  for (int64_t i = 0; i < M; i++) {
+    output_indptr_ptr[i + 1] += output_indptr_ptr[i];
+  }
+  auto nnz = output_indptr_ptr[M];
 
   auto output_indices = output._indices();
   auto output_values = output._values();
-
-  Tensor output_indptr = at::empty({M + 1}, kLong);
   at::native::resize_output(output_indices, {2, nnz});
   at::native::resize_output(output_values, nnz);
 
@@ -11,6 +11,10 @@
 
 #include <ATen/native/CPUBlas.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace at {
 namespace native {
 
@@ -531,6 +535,89 @@ SparseTensor coalesce(const SparseTensor& self) {
   return at::_coalesce(self);
 }
 
+namespace {
+
+// Number of key bits consumed per radix-sort pass.
+constexpr int64_t kRadixBits = 8;
+constexpr int64_t kRadixSize = int64_t(1) << kRadixBits;
+constexpr int64_t kRadixMask = kRadixSize - 1;
+
+// Parallel least-significant-digit radix sort of `keys` with `perm` carried
+// along as payload. Only processes enough 8-bit digits to cover `max_key`,
+// and skips scatter passes where all keys share the current digit. `tmp_*`
+// are scratch buffers of the same length used for ping-ponging.
+void radix_sort_kv(
+    int64_t* keys,
+    int64_t* perm,
+    int64_t* tmp_keys,
+    int64_t* tmp_perm,
+    const int64_t n,
+    const int64_t max_key) {
+  const int64_t num_chunks = at::get_num_threads();
+  const int64_t chunk_size = divup(n, num_chunks);
+  std::vector<int64_t> counts(num_chunks * kRadixSize);
+
+  int64_t* keys_in = keys;
+  int64_t* perm_in = perm;
+  int64_t* keys_out = tmp_keys;
+  int64_t* perm_out = tmp_perm;
+
+  for (int64_t shift = 0; (max_key >> shift) != 0; shift += kRadixBits) {
+    std::fill(counts.begin(), counts.end(), 0);
+    // Per-chunk digit histograms. Chunk boundaries are fixed so the scan
+    // below can assign every chunk a disjoint output range per digit.
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+      for (int64_t t = chunk_begin; t < chunk_end; t++) {
+        int64_t begin = t * chunk_size;
+        int64_t end = std::min(begin + chunk_size, n);
+        int64_t* chunk_counts = counts.data() + t * kRadixSize;
+        for (int64_t j = begin; j < end; j++) {
+          chunk_counts[(keys_in[j] >> shift) & kRadixMask]++;
+        }
+      }
+    });
+    // Exclusive scan in digit-major order turns the histograms into write
+    // offsets. If one digit holds all keys this pass is the identity.
+    bool single_bucket = false;
+    int64_t total = 0;
+    for (int64_t d = 0; d < kRadixSize; d++) {
+      for (int64_t t = 0; t < num_chunks; t++) {
+        int64_t c = counts[t * kRadixSize + d];
+        if (c == n) {
+          single_bucket = true;
+        }
+        counts[t * kRadixSize + d] = total;
+        total += c;
+      }
+    }
+    if (single_bucket) {
+      continue;
+    }
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+      for (int64_t t = chunk_begin; t < chunk_end; t++) {
+        int64_t begin = t * chunk_size;
+        int64_t end = std::min(begin + chunk_size, n);
+        int64_t* offsets = counts.data() + t * kRadixSize;
+        for (int64_t j = begin; j < end; j++) {
+          int64_t pos = offsets[(keys_in[j] >> shift) & kRadixMask]++;
+          keys_out[pos] = keys_in[j];
+          perm_out[pos] = perm_in[j];
+        }
+      }
+    });
+    std::swap(keys_in, keys_out);
+    std::swap(perm_in, perm_out);
+  }
+  if (keys_in != keys) {
+    at::parallel_for(0, n, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      std::copy(keys_in + begin, keys_in + end, keys + begin);
+      std::copy(perm_in + begin, perm_in + end, perm + begin);
+    });
+  }
+}
+
+} // namespace
+
 SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
   AT_ASSERT(self.defined());
   TORCH_INTERNAL_ASSERT(at::impl::variable_excluded_from_dispatch());
@@ -564,57 +651,136 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
   Tensor newValues = at::empty(values.sizes(), values.options());
   alias_into_sparse(dst, newIndices, newValues);
 
-  Tensor indicesBuffer;
-  Tensor indicesPermutation;
-  std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
+  Tensor indicesBuffer = indices_scalar.contiguous();
+  int64_t* keys = indicesBuffer.data_ptr<int64_t>();
+
+  // Single pass checking whether the flattened indices are already sorted
+  // (gradient pipelines often emit ordered streams) and finding the largest
+  // key, which bounds how many radix passes a sort would need. Chunk
+  // boundaries are fixed so per-chunk results can be combined serially.
+  const int64_t num_chunks = at::get_num_threads();
+  const int64_t chunk_size = divup(nnz, num_chunks);
+  std::vector<unsigned char> chunk_sorted(num_chunks, 1);
+  std::vector<int64_t> chunk_max(num_chunks, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (int64_t t = chunk_begin; t < chunk_end; t++) {
+      int64_t begin = t * chunk_size;
+      int64_t end = std::min(begin + chunk_size, nnz);
+      for (int64_t j = begin; j < end; j++) {
+        chunk_max[t] = std::max(chunk_max[t], keys[j]);
+        if (j + 1 < nnz && keys[j] > keys[j + 1]) {
+          chunk_sorted[t] = 0;
+        }
+      }
+    }
+  });
+  bool already_sorted = true;
+  int64_t max_key = 0;
+  for (int64_t t = 0; t < num_chunks; t++) {
+    already_sorted = already_sorted && chunk_sorted[t];
+    max_key = std::max(max_key, chunk_max[t]);
+  }
+
+  Tensor indicesPermutation = at::empty({nnz}, indicesBuffer.options());
+  int64_t* perm = indicesPermutation.data_ptr<int64_t>();
+  at::parallel_for(0, nnz, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    std::iota(perm + begin, perm + end, begin);
+  });
+  if (!already_sorted) {
+    Tensor tmpKeys = at::empty({nnz}, indicesBuffer.options());
+    Tensor tmpPerm = at::empty({nnz}, indicesBuffer.options());
+    radix_sort_kv(
+        keys,
+        perm,
+        tmpKeys.data_ptr<int64_t>(),
+        tmpPerm.data_ptr<int64_t>(),
+        nnz,
+        max_key);
+  }
+
+  // Count segment starts per chunk, then prefix-sum the counts so every
+  // thread knows the output row of the first segment starting in its chunk
+  // without materializing a full nnz-sized position array.
+  std::vector<int64_t> row_offsets(num_chunks + 1, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (int64_t t = chunk_begin; t < chunk_end; t++) {
+      int64_t begin = t * chunk_size;
+      int64_t end = std::min(begin + chunk_size, nnz);
+      int64_t starts = 0;
+      for (int64_t j = begin; j < end; j++) {
+        starts += (j == 0 || keys[j] != keys[j - 1]) ? 1 : 0;
+      }
+      row_offsets[t + 1] = starts;
+    }
+  });
+  for (int64_t t = 0; t < num_chunks; t++) {
+    row_offsets[t + 1] += row_offsets[t];
+  }
+  const int64_t new_nnz = row_offsets[num_chunks];
+
   // NB: The accessor accesses here rely on self._nnz() > 0 (tested earlier in
   // this function)
   auto newIndicesAccessor = newIndices.accessor<int64_t, 2>();
   auto indicesAccessor = indices.accessor<int64_t, 2>();
-  auto indicesPermutationAccessor = indicesPermutation.accessor<int64_t, 1>();
-  auto indicesBufferAccessor = indicesBuffer.accessor<int64_t, 1>();
 
-  int64_t i = -1;
   AT_DISPATCH_ALL_TYPES(values.scalar_type(), "coalesce", [&] {
-    int64_t prev = -1;
     int64_t blockSize = values.stride(0);
     scalar_t* values_ptr = values.data_ptr<scalar_t>();
     scalar_t* newValues_ptr = newValues.data_ptr<scalar_t>();
-    for (int64_t j = 0; j < nnz; j++) {
-      int64_t pos = indicesPermutationAccessor[j];
-      int64_t curr = indicesBufferAccessor[j];
-      if (curr == prev) {
-        if (values.numel() >
-            0) { // if values is an empty tensor, there are no elements to copy
-          at::native::cpublas::axpy<scalar_t>(
-              blockSize,
-              1,
-              values_ptr + pos * blockSize,
-              1,
-              newValues_ptr + i * blockSize,
-              1);
+    // A chunk owns every segment of duplicate keys that starts inside it,
+    // including any tail running into later chunks, so output rows are
+    // written by exactly one thread.
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+      for (int64_t t = chunk_begin; t < chunk_end; t++) {
+        int64_t begin = t * chunk_size;
+        int64_t end = std::min(begin + chunk_size, nnz);
+        int64_t j = begin;
+        // Skip the tail of a segment owned by a previous chunk.
+        while (j < end && !(j == 0 || keys[j] != keys[j - 1])) {
+          j++;
         }
-      } else {
-        ++i;
-        for (int64_t d = 0; d < sparse_dim; d++) {
-          newIndicesAccessor[d][i] = indicesAccessor[d][pos];
+        if (j >= end) {
+          continue;
         }
-        if (values.numel() >
-            0) { // if values is an empty tensor, there are no elements to copy
-          at::native::cpublas::copy<scalar_t>(
-              blockSize,
-              values_ptr + pos * blockSize,
-              1,
-              newValues_ptr + i * blockSize,
-              1);
+        int64_t i = row_offsets[t] - 1;
+        for (; j < nnz; j++) {
+          if (j == 0 || keys[j] != keys[j - 1]) {
+            if (j >= end) {
+              break; // the next chunk owns this segment
+            }
+            ++i;
+            int64_t pos = perm[j];
+            for (int64_t d = 0; d < sparse_dim; d++) {
+              newIndicesAccessor[d][i] = indicesAccessor[d][pos];
+            }
+            if (values.numel() >
+                0) { // if values is an empty tensor, there are no elements to copy
+              at::native::cpublas::copy<scalar_t>(
+                  blockSize,
+                  values_ptr + pos * blockSize,
+                  1,
+                  newValues_ptr + i * blockSize,
+                  1);
+            }
+          } else {
+            if (values.numel() >
+                0) { // if values is an empty tensor, there are no elements to copy
+              at::native::cpublas::axpy<scalar_t>(
+                  blockSize,
+                  1,
+                  values_ptr + perm[j] * blockSize,
+                  1,
+                  newValues_ptr + i * blockSize,
+                  1);
+            }
+          }
         }
       }
-      prev = curr;
-    }
+    });
   });
 
   dst._coalesced_(true);
-  get_sparse_impl(dst)->set_nnz_and_narrow(i + 1);
+  get_sparse_impl(dst)->set_nnz_and_narrow(new_nnz);
 
   return dst;
 }
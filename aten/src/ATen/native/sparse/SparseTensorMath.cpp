@@ -12,8 +12,10 @@
 #include <ATen/WrapDimUtilsMulti.h>
 #include <ATen/native/BinaryOps.h>
 #include <ATen/native/CPUBlas.h>
+#include <ATen/cpu/vec256/vec256.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace at { namespace native {
 
@@ -834,21 +836,75 @@ void s_addmm_out_sparse_dense_worker(int64_t nnz, int64_t dim_i, int64_t dim_j,
   int64_t dense_stride1 = dense.stride(1);
   int64_t r_stride0 = r.stride(0);
   int64_t r_stride1 = r.stride(1);
+
+  // Validate all indices up front so the accumulation loops below can run
+  // without per-element branches (and in parallel, where throwing would be
+  // awkward).
   for (auto i: c10::irange(nnz)) {
-    scalar_t val = values_accessor[i];
     int64_t row = indices_accessor[0][i];
     int64_t col = indices_accessor[1][i];
-    if (col >= 0 && col < dim_j && row >= 0 && row < dim_i) {
+    if (col < 0 || col >= dim_j) {
+      AT_ERROR("addmm: index out of column bound: ", col, " not between 1 and ", dim_j);
+    }
+    if (row < 0 || row >= dim_i) {
+      AT_ERROR("addmm: index out of row bound: ", row, " not between 1 and ", dim_i);
+    }
+  }
+
+  if (r_stride1 == 1 && dense_stride1 == 1) {
+    // Row-scatter fast path: group the nnz by output row so each row is
+    // accumulated by exactly one thread, then parallelize over rows with a
+    // vectorized inner loop over the dense row. This is the layout GNN
+    // aggregations hit (contiguous output, contiguous dense features).
+    std::vector<int64_t> row_ptr(dim_i + 1, 0);
+    for (auto i: c10::irange(nnz)) {
+      row_ptr[indices_accessor[0][i] + 1]++;
+    }
+    for (int64_t row = 0; row < dim_i; row++) {
+      row_ptr[row + 1] += row_ptr[row];
+    }
+    std::vector<int64_t> sorted_cols(nnz);
+    std::vector<scalar_t> sorted_vals(nnz);
+    {
+      std::vector<int64_t> fill_pos(row_ptr.begin(), row_ptr.end() - 1);
+      for (auto i: c10::irange(nnz)) {
+        int64_t pos = fill_pos[indices_accessor[0][i]]++;
+        sorted_cols[pos] = indices_accessor[1][i];
+        sorted_vals[pos] = cast_alpha * values_accessor[i];
+      }
+    }
+    using Vec = vec256::Vec256<scalar_t>;
+    at::parallel_for(
+        0,
+        dim_i,
+        std::max<int64_t>(1, internal::GRAIN_SIZE / std::max<int64_t>(1, dim_k)),
+        [&](int64_t row_begin, int64_t row_end) {
+          for (int64_t row = row_begin; row < row_end; row++) {
+            scalar_t* r_row = r_ptr + row * r_stride0;
+            for (int64_t p = row_ptr[row]; p < row_ptr[row + 1]; p++) {
+              const scalar_t* dense_row = dense_ptr + sorted_cols[p] * dense_stride0;
+              const Vec val_vec(sorted_vals[p]);
+              int64_t k = 0;
+              for (; k + Vec::size() <= dim_k; k += Vec::size()) {
+                auto acc = Vec::loadu(r_row + k);
+                acc += val_vec * Vec::loadu(dense_row + k);
+                acc.store(r_row + k);
+              }
+              for (; k < dim_k; k++) {
+                r_row[k] += sorted_vals[p] * dense_row[k];
+              }
+            }
+          }
+        });
+  } else {
+    for (auto i: c10::irange(nnz)) {
+      scalar_t val = values_accessor[i];
+      int64_t row = indices_accessor[0][i];
+      int64_t col = indices_accessor[1][i];
       at::native::cpublas::axpy<scalar_t>(dim_k,
             cast_alpha * val,
             dense_ptr + col * dense_stride0, dense_stride1,
             r_ptr + row * r_stride0, r_stride1);
-    } else {
-      if (col < 0 || col >= dim_j) {
-        AT_ERROR("addmm: index out of column bound: ", col, " not between 1 and ", dim_j);
-      } else {
-        AT_ERROR("addmm: index out of row bound: ", row, " not between 1 and ", dim_i);
-      }
     }
   }
 };
@@ -2,7 +2,9 @@
 #include <ATen/core/dispatch/Dispatcher.h>
 #include <c10/macros/Macros.h>
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <mutex>
 #include <random>
 
 namespace at {
@@ -542,4 +544,169 @@ bool shouldRunRecordFunction(bool* pre_sampled) {
   }
 }
 
+// Sampled op profiler
+namespace {
+
+// Ring slots pack (name id << 16 | duration bucket) into a single atomic
+// word, so the aggregator can never observe a torn event; ~32KB per thread
+constexpr uint64_t kSampledOpRingSize = 4096; // power of two
+
+struct SampledOpRing {
+  std::array<std::atomic<uint64_t>, kSampledOpRingSize> slots;
+  // Total number of events pushed; event i lives in slot i % kSampledOpRingSize
+  // until the writer laps the aggregator and overwrites it. Written only by
+  // the owning thread.
+  std::atomic<uint64_t> head{0};
+  // Next event to fold into the cumulative histograms; written only by the
+  // aggregator, under SampledOpState::mutex
+  uint64_t read_pos = 0;
+
+  void push(uint64_t packed) {
+    const auto h = head.load(std::memory_order_relaxed);
+    slots[h & (kSampledOpRingSize - 1)].store(packed, std::memory_order_relaxed);
+    head.store(h + 1, std::memory_order_release);
+  }
+};
+
+struct SampledOpState {
+  std::mutex mutex;
+  // all rings ever created; the shared_ptr keeps a ring alive after its
+  // owning thread exits, so its remaining events are still aggregated
+  std::vector<std::shared_ptr<SampledOpRing>> rings;
+  // interned op names; an id is an index into names/histograms
+  std::unordered_map<std::string, uint64_t> name_ids;
+  std::vector<std::string> names;
+  // cumulative per-op bucket counts, indexed by name id
+  std::vector<std::array<uint64_t, kSampledOpNumBuckets>> histograms;
+  c10::optional<CallbackHandle> handle;
+};
+
+SampledOpState& sampled_op_state() {
+  static SampledOpState state;
+  return state;
+}
+
+SampledOpRing& sampled_op_ring() {
+  thread_local std::shared_ptr<SampledOpRing> ring = [] {
+    auto r = std::make_shared<SampledOpRing>();
+    auto& state = sampled_op_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.rings.push_back(r);
+    return r;
+  }();
+  return *ring;
+}
+
+uint64_t sampled_op_name_id(const char* name) {
+  // Per-thread cache so that only the first occurrence of a name per thread
+  // takes the intern table mutex; keyed by value rather than by pointer
+  // because user scope names may be transient strings
+  thread_local std::unordered_map<std::string, uint64_t> cache;
+  std::string key(name);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto& state = sampled_op_state();
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  uint64_t id;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto inserted = state.name_ids.emplace(key, state.names.size());
+    if (inserted.second) {
+      state.names.push_back(key);
+      state.histograms.emplace_back();
+    }
+    id = inserted.first->second;
+  }
+  cache.emplace(std::move(key), id);
+  return id;
+}
+
+uint64_t sampled_op_bucket(int64_t ns) {
+  uint64_t bucket = 0;
+  while ((ns >>= 1) > 0) {
+    ++bucket;
+  }
+  return std::min(bucket, uint64_t(kSampledOpNumBuckets - 1));
+}
+
+struct SampledOpContext : public ObserverContext {
+  std::chrono::time_point<std::chrono::steady_clock> start;
+};
+
+std::unique_ptr<ObserverContext> sampledOpStart(const RecordFunction& fn) {
+  auto ctx = std::make_unique<SampledOpContext>();
+  ctx->start = std::chrono::steady_clock::now();
+  return ctx;
+}
+
+void sampledOpEnd(const RecordFunction& fn, ObserverContext* ctx_ptr) {
+  if (ctx_ptr == nullptr) {
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  auto* ctx = static_cast<SampledOpContext*>(ctx_ptr);
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      end - ctx->start).count();
+  const auto id = sampled_op_name_id(fn.name().str());
+  sampled_op_ring().push((id << 16) | sampled_op_bucket(ns));
+}
+
+} // namespace
+
+void enableSampledOpProfiler(double sampling_prob) {
+  auto& state = sampled_op_state();
+  TORCH_CHECK(!state.handle, "Sampled op profiler is already enabled");
+  state.handle = addGlobalCallback(
+      RecordFunctionCallback(&sampledOpStart, &sampledOpEnd)
+          .samplingProb(sampling_prob));
+}
+
+void disableSampledOpProfiler() {
+  auto& state = sampled_op_state();
+  if (state.handle) {
+    removeCallback(*state.handle);
+    state.handle = c10::nullopt;
+  }
+}
+
+bool isSampledOpProfilerEnabled() {
+  return sampled_op_state().handle.has_value();
+}
+
+std::vector<SampledOpHistogram> sampledOpHistograms() {
+  auto& state = sampled_op_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (const auto& ring_ptr : state.rings) {
+    auto& ring = *ring_ptr;
+    const auto head = ring.head.load(std::memory_order_acquire);
+    auto pos = ring.read_pos;
+    if (head > kSampledOpRingSize && pos < head - kSampledOpRingSize) {
+      // the writer lapped the aggregator; the overwritten events are lost
+      pos = head - kSampledOpRingSize;
+    }
+    for (; pos < head; ++pos) {
+      const auto packed = ring.slots[pos & (kSampledOpRingSize - 1)].load(
+          std::memory_order_relaxed);
+      if (ring.head.load(std::memory_order_acquire) > pos + kSampledOpRingSize) {
+        // the slot may have been overwritten while we were reading it; the
+        // newer event has index >= head and is picked up on the next drain
+        continue;
+      }
+      state.histograms[packed >> 16][packed & 0xffff]++;
+    }
+    ring.read_pos = head;
+  }
+  std::vector<SampledOpHistogram> result(state.names.size());
+  for (size_t id = 0; id < state.names.size(); ++id) {
+    result[id].name = state.names[id];
+    result[id].buckets = state.histograms[id];
+    for (const auto count : state.histograms[id]) {
+      result[id].count += count;
+    }
+  }
+  return result;
+}
+
 } // namespace at
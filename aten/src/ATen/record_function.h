@@ -612,4 +612,56 @@ TORCH_API void bumpRecordAllFunctions();
 TORCH_API void releaseRecordAllFunctions();
 TORCH_API bool checkRecordAllFunctions();
 
+// Sampled op profiler - a built-in, low overhead consumer of the sampled
+// callback machinery above; intended for passive, always-on monitoring of
+// op-level latencies in long-running processes. For the sampled fraction of
+// calls it records (op name id, log2 duration bucket) into per-thread
+// lock-free ring buffers; sampledOpHistograms() folds the buffers into
+// cumulative per-op latency histograms on demand. At the default 1:1000
+// sampling rate the callback stays below the kLowProb pre-sampling
+// threshold, so unsampled calls cost only the thread local pre-sampling
+// counter decrement.
+
+// Number of power-of-two latency buckets; bucket b counts sampled calls with
+// duration in [2^b, 2^(b+1)) nanoseconds (bucket 0 also covers zero, the
+// last bucket is unbounded above)
+constexpr size_t kSampledOpNumBuckets = 40;
+
+struct TORCH_API SampledOpHistogram {
+  // op name as reported by RecordFunction::name()
+  std::string name;
+  // total number of sampled calls
+  uint64_t count = 0;
+  // per-bucket counts of sampled calls
+  std::array<uint64_t, kSampledOpNumBuckets> buckets{};
+};
+
+/**
+ * enableSampledOpProfiler registers the built-in sampled collector as a
+ * global callback with the given sampling probability;
+ *
+ * WARNING: like addGlobalCallback, not thread safe, typically called
+ * only during the program initialization
+ */
+TORCH_API void enableSampledOpProfiler(double sampling_prob = 1e-3);
+
+/**
+ * disableSampledOpProfiler removes the built-in sampled collector;
+ * already collected histograms are kept and remain available through
+ * sampledOpHistograms()
+ *
+ * WARNING: like removeCallback, not thread safe
+ */
+TORCH_API void disableSampledOpProfiler();
+
+TORCH_API bool isSampledOpProfilerEnabled();
+
+/**
+ * sampledOpHistograms drains the per-thread ring buffers collected so far
+ * and returns the cumulative per-op latency histograms; thread safe and
+ * cheap enough to poll periodically - events that are not drained before
+ * their ring buffer wraps around are dropped
+ */
+TORCH_API std::vector<SampledOpHistogram> sampledOpHistograms();
+
 } // namespace at
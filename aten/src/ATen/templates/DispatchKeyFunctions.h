@@ -2,6 +2,28 @@
 
 // NB: The implementing C++ file is RegisterDispatchKey.cpp
 
+// The functions in this file are direct entry points into the kernels
+// registered for this dispatch key: at::${dispatch_namespace}::add(a, b) jumps
+// straight to the same wrapper that the dispatcher would eventually select,
+// at plain function-call cost.  See Note [Direct dispatch bindings] in
+// tools/codegen/dest/register_dispatch_key.py.
+//
+// These are intended for hand-written C++ hot loops where the backend and
+// dtype are known statically and dispatch overhead matters.  The caller takes
+// on the responsibilities the skipped layers normally handle:
+//
+//  - No autograd.  Nothing is recorded on the tape and version counters are
+//    not bumped, so only call these under c10::InferenceMode (or on tensors
+//    that require no grad, at your own risk).
+//  - No redispatch.  Tensor subclasses, tracing, batching, functorch-style
+//    wrappers etc. are all bypassed; inputs must be plain tensors on this
+//    backend.
+//  - No BackendSelect/common device checks.  Passing tensors from the wrong
+//    backend is undefined behavior, not an error message.
+//
+// The per-backend wrappers do still install the appropriate DeviceGuard where
+// the kernel needs one.
+
 // TODO: tighten this include
 #include <ATen/Functions.h>
 
@@ -4,6 +4,7 @@
 
 #include <TH/generic/THTensorApply.hpp>
 #include <ATen/CPUGeneratorImpl.h>
+#include <ATen/Parallel.h>
 #include <ATen/Utils.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/WrapDimUtils.h>
@@ -343,6 +344,36 @@ void THTensor_(histc)(THTensor *hist, THTensor *tensor, int64_t nbins, scalar_t
 
   h_data = hist->data<scalar_t>();
 
+  if (THTensor_(isContiguous)(tensor)) {
+    // Threads accumulate into private histograms that are merged at the end;
+    // scattering into the shared histogram directly would race. The merge is
+    // parallelized over chunks of bins so a large bin count does not
+    // serialize it.
+    const scalar_t *t_data = tensor->data<scalar_t>();
+    const int64_t size = THTensor_(nElement)(tensor);
+    const int num_threads = at::get_num_threads();
+    std::vector<scalar_t> partial(static_cast<size_t>(num_threads) * nbins, 0);
+    at::parallel_for(0, size, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      scalar_t *local = partial.data() + static_cast<int64_t>(at::get_thread_num()) * nbins;
+      for (int64_t i = begin; i < end; i++) {
+        const scalar_t val = t_data[i];
+        if (val >= minval && val <= maxval) {
+          const int64_t bin = (int64_t)((val - minval) / (maxval - minval) * nbins);
+          local[THMin(bin, nbins - 1)] += 1;
+        }
+      }
+    });
+    at::parallel_for(0, nbins, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      for (int t = 0; t < num_threads; t++) {
+        const scalar_t *local = partial.data() + static_cast<int64_t>(t) * nbins;
+        for (int64_t b = begin; b < end; b++) {
+          h_data[b] += local[b];
+        }
+      }
+    });
+    return;
+  }
+
   TH_TENSOR_APPLY(scalar_t, tensor,
     if (*tensor_data >= minval && *tensor_data <= maxval) {
       const int bin = (int)((*tensor_data-minval) / (maxval-minval) * nbins);
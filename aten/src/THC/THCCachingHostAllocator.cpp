@@ -12,6 +12,7 @@
 #include <unordered_set>
 #include <set>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -42,6 +43,30 @@ static bool BlockComparator(const BlockSize& a, const BlockSize& b)
   return (uintptr_t)a.ptr < (uintptr_t)b.ptr;
 }
 
+// Rounds allocation requests up to a power-of-two size class (with a one
+// page floor). cudaHostAlloc takes ~1ms and synchronizes the device, so
+// cache hits are everything: without rounding, a dataloader that pins
+// slightly different sizes every step (variable batch tails, string
+// lengths) misses the cache and pays the driver call each time. Rounding
+// collapses those requests onto a few recurring classes and bounds the
+// internal waste of a hit at 2x.
+static size_t sizeClass(size_t size)
+{
+  constexpr size_t kMinSizeClass = 4096;
+  if (size <= kMinSizeClass) {
+    return kMinSizeClass;
+  }
+  size_t rounded = kMinSizeClass;
+  while (rounded < size) {
+    rounded <<= 1;
+    if (rounded == 0) {
+      // size is within a factor of 2 of SIZE_MAX; don't round.
+      return size;
+    }
+  }
+  return rounded;
+}
+
 struct HostAllocator
 {
   typedef bool (*Comparison)(const BlockSize&, const BlockSize&);
@@ -55,8 +80,19 @@ struct HostAllocator
   // pointers that are ready to be allocated (event_count=0)
   std::set<BlockSize, Comparison> available;
 
+  struct EventRecord {
+    cudaEvent_t event;
+    void* ptr;
+    int device; // device the event was created on
+  };
+
   // outstanding cuda events
-  std::deque<std::pair<cudaEvent_t, void*>> cuda_events;
+  std::deque<EventRecord> cuda_events;
+
+  // completed events kept for reuse (per device; an event can only be
+  // recorded on streams of the device it was created on), so steady-state
+  // frees of cross-stream blocks don't call cudaEventCreate/Destroy
+  std::unordered_map<int, std::vector<cudaEvent_t>> event_pool;
 
   HostAllocator() : available(BlockComparator) {}
 
@@ -70,6 +106,10 @@ struct HostAllocator
       return err;
     }
 
+    if (size > 0) {
+      size = sizeClass(size);
+    }
+
     // search for the smallest block which can hold this allocation
     BlockSize search_key(size);
     auto it = available.lower_bound(search_key);
@@ -169,7 +209,7 @@ struct HostAllocator
     // the processing of some events may be delayed.
     while (!cuda_events.empty()) {
       auto& e = cuda_events.front();
-      cudaEvent_t event = e.first;
+      cudaEvent_t event = e.event;
 
       cudaError_t err = cudaEventQuery(event);
       if (err == cudaErrorNotReady) {
@@ -177,12 +217,9 @@ struct HostAllocator
       } else if (err != cudaSuccess) {
         return err;
       }
-      err = cudaEventDestroy(event);
-      if (err != cudaSuccess) {
-        return err;
-      }
+      event_pool[e.device].push_back(event);
 
-      Block& block = blocks.at(e.second);
+      Block& block = blocks.at(e.ptr);
       block.event_count--;
       if (block.event_count == 0 && !block.allocated) {
         available.insert(block);
@@ -198,8 +235,8 @@ struct HostAllocator
 
     // remove events for freed blocks
     for (auto it = cuda_events.begin(); it != cuda_events.end(); ++it) {
-      cudaEvent_t event = it->first;
-      Block& block = blocks.at(it->second);
+      cudaEvent_t event = it->event;
+      Block& block = blocks.at(it->ptr);
       if (!block.allocated) {
         THCudaCheckWarn(cudaEventDestroy(event));
         block.event_count--;
@@ -209,6 +246,14 @@ struct HostAllocator
     // all cuda_events have been processed
     cuda_events.clear();
 
+    // drop recycled events along with the cache
+    for (auto& pooled : event_pool) {
+      for (auto event : pooled.second) {
+        THCudaCheckWarn(cudaEventDestroy(event));
+      }
+    }
+    event_pool.clear();
+
     // clear list of available blocks
     available.clear();
 
@@ -238,14 +283,20 @@ struct HostAllocator
       if (err != cudaSuccess) break;
 
       cudaEvent_t event;
-      err = cudaEventCreateWithFlags(&event, cudaEventDisableTiming);
-      if (err != cudaSuccess) break;
+      auto& pooled = event_pool[it->device_index()];
+      if (!pooled.empty()) {
+        event = pooled.back();
+        pooled.pop_back();
+      } else {
+        err = cudaEventCreateWithFlags(&event, cudaEventDisableTiming);
+        if (err != cudaSuccess) break;
+      }
 
       err = cudaEventRecord(event, it->stream());
       if (err != cudaSuccess) break;
 
       block.event_count++;
-      cuda_events.emplace_back(event, block.ptr);
+      cuda_events.push_back({event, block.ptr, it->device_index()});
     }
 
     cudaSetDevice(prev_device);
@@ -0,0 +1,191 @@
+// Pure C++ microbenchmarks for ATen operator overhead.
+//
+// The Python-driven suites (benchmarks/operator_benchmark,
+// benchmarks/instruction_counts) cannot separate C++ dispatch and kernel
+// cost from Python binding cost; this target calls the ATen C++ API
+// directly so overhead regressions are caught where they happen.
+//
+// Two modes share one case registry:
+//  - wall time (default): every case is registered as a google benchmark;
+//  - instruction counts: build with USE_VALGRIND and run
+//      valgrind --tool=callgrind --instr-atstart=no \
+//          ./aten_overhead_bench --callgrind
+//    each case warms up, toggles collection around its measured loop and
+//    dumps a per-case stats file, so callgrind_annotate attributes
+//    instruction counts to individual (op, shape class) pairs.
+//
+// Cases run through a std::function so both modes measure the same code;
+// the indirect call costs a few ns, which is constant across cases and
+// negligible against the ~1us dispatch cost being measured.
+
+#include <benchmark/benchmark.h>
+
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <c10/util/Flags.h>
+
+#if defined(USE_VALGRIND)
+#include <callgrind.h>
+#endif
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+C10_DEFINE_bool(
+    callgrind,
+    false,
+    "Run every case under callgrind collection instead of timing it");
+C10_DEFINE_int(
+    callgrind_iters,
+    100,
+    "Iterations per case in --callgrind mode");
+
+namespace {
+
+struct OpCase {
+  std::string name;
+  std::function<void()> run;
+};
+
+std::vector<OpCase>& cases() {
+  static std::vector<OpCase> cases_;
+  return cases_;
+}
+
+void addCase(std::string name, std::function<void()> run) {
+  cases().push_back({std::move(name), std::move(run)});
+}
+
+// Shape classes: overhead-bound (1 element), small (fits in L1), medium
+// (fits in L2/L3) and large (memory bound); plus a transposed variant to
+// exercise the non-contiguous TensorIterator path.
+const std::vector<std::pair<std::string, int64_t>> kShapeClasses = {
+    {"1", 1},
+    {"64", 64},
+    {"4096", 4096},
+    {"1048576", 1 << 20},
+};
+
+void registerPointwiseCases() {
+  for (const auto& shape : kShapeClasses) {
+    auto a = at::randn({shape.second});
+    auto b = at::randn({shape.second});
+    auto out = at::empty({shape.second});
+    addCase("add/" + shape.first, [=]() { at::add(a, b); });
+    addCase("add_out/" + shape.first, [=]() mutable { at::add_out(out, a, b); });
+    addCase("add_/" + shape.first, [=]() mutable { a.add_(b); });
+    addCase("mul/" + shape.first, [=]() { at::mul(a, b); });
+    addCase("add_scalar/" + shape.first, [=]() { at::add(a, 1); });
+    addCase("relu/" + shape.first, [=]() { at::relu(a); });
+    addCase("sigmoid/" + shape.first, [=]() { at::sigmoid(a); });
+    addCase("tanh/" + shape.first, [=]() { at::tanh(a); });
+    addCase("exp/" + shape.first, [=]() { at::exp(a); });
+    addCase("clamp/" + shape.first, [=]() { at::clamp(a, -1.0, 1.0); });
+    addCase("copy_/" + shape.first, [=]() mutable { out.copy_(a); });
+    addCase("to_double/" + shape.first, [=]() { a.to(at::kDouble); });
+  }
+  // non-contiguous inputs take the strided TensorIterator path
+  auto base = at::randn({512, 512});
+  auto transposed = base.t();
+  addCase("add_transposed/512x512", [=]() { at::add(transposed, transposed); });
+  addCase("contiguous/512x512", [=]() { transposed.contiguous(); });
+}
+
+void registerReductionCases() {
+  for (const auto& shape : kShapeClasses) {
+    auto a = at::randn({shape.second});
+    addCase("sum/" + shape.first, [=]() { at::sum(a); });
+    addCase("mean/" + shape.first, [=]() { at::mean(a); });
+    addCase("argmax/" + shape.first, [=]() { at::argmax(a); });
+    addCase("norm/" + shape.first, [=]() { a.norm(); });
+  }
+  auto m = at::randn({256, 256});
+  addCase("sum_dim/256x256", [=]() { at::sum(m, {1}); });
+  addCase("softmax/256x256", [=]() { at::softmax(m, 1); });
+}
+
+void registerLinearAlgebraCases() {
+  for (const int64_t n : {8, 64, 256}) {
+    auto a = at::randn({n, n});
+    auto b = at::randn({n, n});
+    auto batched = at::randn({8, n, n});
+    const std::string suffix = std::to_string(n) + "x" + std::to_string(n);
+    addCase("mm/" + suffix, [=]() { at::mm(a, b); });
+    addCase("matmul/" + suffix, [=]() { at::matmul(a, b); });
+    addCase("bmm/8x" + suffix, [=]() { at::bmm(batched, batched); });
+    addCase("addmm/" + suffix, [=]() { at::addmm(a, a, b); });
+  }
+}
+
+void registerShapeAndFactoryCases() {
+  auto a = at::randn({64, 64});
+  addCase("view/64x64", [=]() { a.view({4096}); });
+  addCase("reshape/64x64", [=]() { a.reshape({4096}); });
+  addCase("transpose/64x64", [=]() { a.transpose(0, 1); });
+  addCase("narrow/64x64", [=]() { a.narrow(0, 8, 16); });
+  addCase("select/64x64", [=]() { a.select(0, 8); });
+  addCase("cat/64x64", [=]() { at::cat({a, a}, 0); });
+  addCase("chunk/64x64", [=]() { a.chunk(4, 0); });
+  addCase("empty/4096", []() { at::empty({4096}); });
+  addCase("zeros/4096", []() { at::zeros({4096}); });
+  addCase("empty_like/64x64", [=]() { at::empty_like(a); });
+
+  auto index = at::randint(0, 64, {16});
+  addCase("index_select/64x64", [=]() { at::index_select(a, 0, index); });
+
+  auto weight = at::randn({1000, 64});
+  auto indices = at::randint(0, 1000, {32});
+  addCase("embedding/1000x64", [=]() { at::embedding(weight, indices); });
+}
+
+void registerCases() {
+  registerPointwiseCases();
+  registerReductionCases();
+  registerLinearAlgebraCases();
+  registerShapeAndFactoryCases();
+}
+
+int runCallgrind() {
+#if defined(USE_VALGRIND)
+  for (const auto& op_case : cases()) {
+    // one untimed run to populate dispatch tables and allocator caches
+    op_case.run();
+    CALLGRIND_TOGGLE_COLLECT;
+    for (int i = 0; i < FLAGS_callgrind_iters; ++i) {
+      op_case.run();
+    }
+    CALLGRIND_TOGGLE_COLLECT;
+    CALLGRIND_DUMP_STATS_AT(op_case.name.c_str());
+  }
+  return 0;
+#else
+  std::cerr << "--callgrind requires a build with USE_VALGRIND=1"
+            << std::endl;
+  return 1;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  c10::ParseCommandLineFlags(&argc, &argv);
+  // overhead measurements should not depend on the intra-op pool
+  at::set_num_threads(1);
+  registerCases();
+  if (FLAGS_callgrind) {
+    return runCallgrind();
+  }
+  for (const auto& op_case : cases()) {
+    benchmark::RegisterBenchmark(
+        op_case.name.c_str(), [op_case](benchmark::State& state) {
+          for (auto _ : state) {
+            op_case.run();
+          }
+        });
+  }
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
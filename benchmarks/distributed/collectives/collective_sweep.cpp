@@ -0,0 +1,339 @@
+// Collective operation sweep benchmark.
+//
+// Sweeps (collective type x message size) for a chosen process group
+// backend and reports per-rank latency percentiles plus algorithm/bus
+// bandwidth, nccl-tests style. A gloo process group over the same store is
+// always created as a control plane, so rank statistics can be gathered and
+// printed on rank 0 regardless of the benched backend. With
+// --overlap_compute a background thread runs a GEMM loop during each timed
+// region and its achieved rate is reported relative to a no-communication
+// baseline, which makes lost compute/communication overlap visible.
+//
+// Launch one process per rank, e.g.:
+//   RANK=0 WORLD_SIZE=2 ./collective_sweep --backend=gloo &
+//   RANK=1 WORLD_SIZE=2 ./collective_sweep --backend=gloo
+//
+// Ranks and world size come from the RANK/WORLD_SIZE environment variables;
+// all processes must share --store_path (a file on a shared filesystem).
+
+#include <c10d/FileStore.hpp>
+#include <c10d/PrefixStore.hpp>
+#include <c10d/ProcessGroup.hpp>
+#include <c10d/ProcessGroupGloo.hpp>
+#ifdef USE_C10D_NCCL
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10d/ProcessGroupNCCL.hpp>
+#endif
+
+#include <ATen/ATen.h>
+#include <c10/util/Flags.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+C10_DEFINE_string(backend, "gloo", "Process group backend: gloo or nccl");
+C10_DEFINE_string(
+    collectives,
+    "allreduce,broadcast,allgather,reduce_scatter",
+    "Comma-separated list of collectives to sweep");
+C10_DEFINE_string(
+    store_path,
+    "/tmp/collective_sweep_store",
+    "FileStore path shared by all ranks");
+C10_DEFINE_int64(min_bytes, 1024, "Smallest message size in bytes");
+C10_DEFINE_int64(max_bytes, 64 * 1024 * 1024, "Largest message size in bytes");
+C10_DEFINE_int(iters, 50, "Timed iterations per configuration");
+C10_DEFINE_int(warmup_iters, 5, "Warmup iterations per configuration");
+C10_DEFINE_bool(
+    overlap_compute,
+    false,
+    "Run a GEMM loop concurrently with each timed region and report its "
+    "achieved rate relative to an idle-network baseline");
+
+namespace {
+
+using c10d::ProcessGroup;
+
+struct BenchCase {
+  std::string name;
+  std::function<c10::intrusive_ptr<ProcessGroup::Work>()> run;
+  // busbw = algbw * bus_factor, using the factors from nccl-tests
+  double bus_factor;
+};
+
+// Background GEMM load used to validate compute/communication overlap.
+struct ComputeLoad {
+  explicit ComputeLoad(at::Tensor lhs, at::Tensor rhs)
+      : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+
+  void start() {
+    stop_ = false;
+    iters_ = 0;
+    thread_ = std::thread([this]() {
+      while (!stop_.load(std::memory_order_acquire)) {
+        at::mm(lhs_, rhs_);
+        iters_++;
+      }
+    });
+    begin_ = std::chrono::steady_clock::now();
+  }
+
+  // returns achieved GEMM iterations per second
+  double stop() {
+    stop_.store(true, std::memory_order_release);
+    thread_.join();
+    const double elapsed = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - begin_)
+                               .count();
+    return elapsed > 0 ? iters_.load() / elapsed : 0.0;
+  }
+
+ private:
+  at::Tensor lhs_;
+  at::Tensor rhs_;
+  std::thread thread_;
+  std::atomic<bool> stop_{false};
+  std::atomic<uint64_t> iters_{0};
+  std::chrono::steady_clock::time_point begin_;
+};
+
+double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  const auto idx = std::min(
+      sorted.size() - 1, static_cast<size_t>(p * (sorted.size() - 1)));
+  return sorted[idx];
+}
+
+std::vector<std::string> splitCollectives(const std::string& list) {
+  std::vector<std::string> result;
+  std::stringstream ss(list);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (!item.empty()) {
+      result.push_back(item);
+    }
+  }
+  return result;
+}
+
+std::vector<BenchCase> makeCases(
+    const c10::intrusive_ptr<ProcessGroup>& pg,
+    const std::string& collective,
+    int64_t numel,
+    int world_size,
+    const at::TensorOptions& options) {
+  std::vector<BenchCase> cases;
+  if (collective == "allreduce") {
+    auto tensors = std::make_shared<std::vector<at::Tensor>>(
+        1, at::ones({numel}, options));
+    cases.push_back(
+        {collective,
+         [pg, tensors]() { return pg->allreduce(*tensors); },
+         2.0 * (world_size - 1) / world_size});
+  } else if (collective == "broadcast") {
+    auto tensors = std::make_shared<std::vector<at::Tensor>>(
+        1, at::ones({numel}, options));
+    cases.push_back(
+        {collective,
+         [pg, tensors]() { return pg->broadcast(*tensors); },
+         1.0});
+  } else if (collective == "allgather") {
+    auto inputs = std::make_shared<std::vector<at::Tensor>>(
+        1, at::ones({numel}, options));
+    auto outputs = std::make_shared<std::vector<std::vector<at::Tensor>>>(1);
+    for (int r = 0; r < world_size; ++r) {
+      (*outputs)[0].push_back(at::zeros({numel}, options));
+    }
+    cases.push_back(
+        {collective,
+         [pg, outputs, inputs]() { return pg->allgather(*outputs, *inputs); },
+         static_cast<double>(world_size - 1) / world_size});
+  } else if (collective == "reduce_scatter") {
+    auto outputs = std::make_shared<std::vector<at::Tensor>>(
+        1, at::zeros({numel}, options));
+    auto inputs = std::make_shared<std::vector<std::vector<at::Tensor>>>(1);
+    for (int r = 0; r < world_size; ++r) {
+      (*inputs)[0].push_back(at::ones({numel}, options));
+    }
+    cases.push_back(
+        {collective,
+         [pg, outputs, inputs]() {
+           return pg->reduce_scatter(*outputs, *inputs);
+         },
+         static_cast<double>(world_size - 1) / world_size});
+  } else {
+    TORCH_CHECK(false, "Unknown collective: ", collective);
+  }
+  return cases;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  c10::ParseCommandLineFlags(&argc, &argv);
+
+  const char* rank_env = getenv("RANK");
+  const char* size_env = getenv("WORLD_SIZE");
+  TORCH_CHECK(
+      rank_env != nullptr && size_env != nullptr,
+      "RANK and WORLD_SIZE must be set");
+  const int rank = atoi(rank_env);
+  const int world_size = atoi(size_env);
+
+  auto file_store =
+      c10::make_intrusive<c10d::FileStore>(FLAGS_store_path, world_size);
+
+  // control plane used for barriers and for gathering per-rank stats
+  auto control_store =
+      c10::make_intrusive<c10d::PrefixStore>("control", file_store);
+  auto control_options = c10d::ProcessGroupGloo::Options::create();
+  control_options->devices.push_back(
+      c10d::ProcessGroupGloo::createDefaultDevice());
+  auto control = c10::make_intrusive<c10d::ProcessGroupGloo>(
+      control_store, rank, world_size, control_options);
+
+  auto bench_store =
+      c10::make_intrusive<c10d::PrefixStore>("bench", file_store);
+  c10::intrusive_ptr<ProcessGroup> pg;
+  at::TensorOptions tensor_options = at::TensorOptions(at::kFloat);
+  bool is_cuda = false;
+  if (FLAGS_backend == "gloo") {
+    auto options = c10d::ProcessGroupGloo::Options::create();
+    options->devices.push_back(
+        c10d::ProcessGroupGloo::createDefaultDevice());
+    pg = c10::make_intrusive<c10d::ProcessGroupGloo>(
+        bench_store, rank, world_size, options);
+  } else if (FLAGS_backend == "nccl") {
+#ifdef USE_C10D_NCCL
+    pg = c10::make_intrusive<c10d::ProcessGroupNCCL>(
+        bench_store, rank, world_size);
+    const auto device_index = rank % c10::cuda::device_count();
+    tensor_options =
+        tensor_options.device(at::Device(at::kCUDA, device_index));
+    is_cuda = true;
+#else
+    TORCH_CHECK(false, "This binary was built without NCCL support");
+#endif
+  } else {
+    TORCH_CHECK(false, "Unsupported backend: ", FLAGS_backend);
+  }
+
+  // idle-network compute baseline for the overlap check
+  auto gemm_lhs = at::randn({512, 512}, tensor_options);
+  auto gemm_rhs = at::randn({512, 512}, tensor_options);
+  double baseline_gemm_rate = 0.0;
+  if (FLAGS_overlap_compute) {
+    ComputeLoad baseline(gemm_lhs, gemm_rhs);
+    baseline.start();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    baseline_gemm_rate = baseline.stop();
+  }
+
+  if (rank == 0) {
+    std::cout << "backend: " << FLAGS_backend
+              << ", world size: " << world_size
+              << ", iters/config: " << FLAGS_iters << std::endl;
+    std::cout << "collective, bytes, rank, p50(us), p99(us), "
+              << "algbw(GB/s), busbw(GB/s)"
+              << (FLAGS_overlap_compute ? ", overlap_gemm(%)" : "")
+              << std::endl;
+  }
+
+  for (const auto& collective : splitCollectives(FLAGS_collectives)) {
+    for (int64_t bytes = FLAGS_min_bytes; bytes <= FLAGS_max_bytes;
+         bytes *= 2) {
+      const int64_t numel = std::max<int64_t>(1, bytes / sizeof(float));
+      std::vector<BenchCase> cases;
+      try {
+        cases =
+            makeCases(pg, collective, numel, world_size, tensor_options);
+        // probe once: some backends (e.g. gloo) do not implement every
+        // collective and only fail on the first call
+        cases.front().run()->wait();
+      } catch (const std::exception& e) {
+        if (rank == 0 && bytes == FLAGS_min_bytes) {
+          std::cout << collective << ": skipped (" << e.what() << ")"
+                    << std::endl;
+        }
+        break;
+      }
+      const auto& bench_case = cases.front();
+
+      control->barrier()->wait();
+      for (int i = 0; i < FLAGS_warmup_iters; ++i) {
+        bench_case.run()->wait();
+      }
+#ifdef USE_C10D_NCCL
+      if (is_cuda) {
+        c10::cuda::device_synchronize();
+      }
+#endif
+      control->barrier()->wait();
+
+      ComputeLoad load(gemm_lhs, gemm_rhs);
+      if (FLAGS_overlap_compute) {
+        load.start();
+      }
+      std::vector<double> latencies_us;
+      latencies_us.reserve(FLAGS_iters);
+      for (int i = 0; i < FLAGS_iters; ++i) {
+        const auto begin = std::chrono::steady_clock::now();
+        bench_case.run()->wait();
+#ifdef USE_C10D_NCCL
+        if (is_cuda) {
+          c10::cuda::device_synchronize();
+        }
+#endif
+        const auto end = std::chrono::steady_clock::now();
+        latencies_us.push_back(
+            std::chrono::duration<double, std::micro>(end - begin).count());
+      }
+      double overlap_rate = 0.0;
+      if (FLAGS_overlap_compute) {
+        overlap_rate = load.stop();
+      }
+      std::sort(latencies_us.begin(), latencies_us.end());
+
+      // stats layout: p50, p99, overlap GEMM rate
+      auto local_stats = at::tensor(
+          {static_cast<float>(percentile(latencies_us, 0.5)),
+           static_cast<float>(percentile(latencies_us, 0.99)),
+           static_cast<float>(overlap_rate)});
+      std::vector<std::vector<at::Tensor>> gathered(1);
+      for (int r = 0; r < world_size; ++r) {
+        gathered[0].push_back(at::zeros({3}));
+      }
+      std::vector<at::Tensor> gather_input{local_stats};
+      control->allgather(gathered, gather_input)->wait();
+
+      if (rank == 0) {
+        for (int r = 0; r < world_size; ++r) {
+          const auto stats = gathered[0][r].accessor<float, 1>();
+          const double p50_s = stats[0] * 1e-6;
+          const double algbw = p50_s > 0 ? bytes / p50_s / 1e9 : 0.0;
+          std::cout << collective << ", " << bytes << ", " << r << ", "
+                    << stats[0] << ", " << stats[1] << ", " << algbw << ", "
+                    << algbw * bench_case.bus_factor;
+          if (FLAGS_overlap_compute) {
+            std::cout << ", "
+                      << (baseline_gemm_rate > 0
+                              ? 100.0 * stats[2] / baseline_gemm_rate
+                              : 0.0);
+          }
+          std::cout << std::endl;
+        }
+      }
+      control->barrier()->wait();
+    }
+  }
+  return 0;
+}
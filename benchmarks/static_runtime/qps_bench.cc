@@ -0,0 +1,199 @@
+// Multi-threaded QPS/latency harness for Static Runtime.
+//
+// The google-benchmark driver in deep_wide_pt_bench.cc measures
+// single-thread latency; this harness mimics a serving host instead: N
+// threads share one StaticModule (weights) and drive one StaticRuntime
+// instance each, reporting aggregate throughput, latency percentiles and
+// allocator stats. Build with -DBUILD_STATIC_RUNTIME_BENCHMARK=ON and run
+// e.g.
+//   static_runtime_qps_bench --qps_num_threads=16 --qps_duration_sec=10
+
+#include <torch/csrc/jit/runtime/static/impl.h>
+#include "deep_wide_pt.h"
+
+#include <ATen/Parallel.h>
+#include <c10/core/CPUAllocator.h>
+#include <c10/util/Flags.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+C10_DEFINE_int(
+    qps_num_threads,
+    16,
+    "Number of concurrent StaticRuntime instances");
+C10_DEFINE_int(qps_duration_sec, 10, "Measurement duration in seconds");
+C10_DEFINE_int(qps_batch_size, 1, "Batch size per query");
+C10_DEFINE_int(qps_warmup_iters, 100, "Per-thread warmup iterations");
+
+namespace {
+
+const int embedding_size = 32;
+const int num_features = 50;
+
+// Counts requests going through the default CPU allocator so allocator
+// pressure (the usual culprit when multi-threaded QPS regresses with no
+// single-thread signal) shows up in the report. The wrapper returns the
+// underlying allocator's DataPtr unchanged, so buffers outliving the
+// measurement window are still freed correctly after the swap back.
+class CountingCPUAllocator final : public c10::Allocator {
+ public:
+  explicit CountingCPUAllocator(c10::Allocator* base) : base_(base) {}
+
+  c10::DataPtr allocate(size_t nbytes) const override {
+    num_allocs_++;
+    allocated_bytes_ += nbytes;
+    return base_->allocate(nbytes);
+  }
+
+  c10::DeleterFnPtr raw_deleter() const override {
+    return base_->raw_deleter();
+  }
+
+  uint64_t numAllocs() const {
+    return num_allocs_.load();
+  }
+
+  uint64_t allocatedBytes() const {
+    return allocated_bytes_.load();
+  }
+
+ private:
+  c10::Allocator* base_;
+  mutable std::atomic<uint64_t> num_allocs_{0};
+  mutable std::atomic<uint64_t> allocated_bytes_{0};
+};
+
+struct ThreadResult {
+  std::vector<double> latencies_us;
+  uint64_t queries = 0;
+};
+
+void worker(
+    const torch::jit::StaticModule& smod,
+    std::atomic<int>& num_ready,
+    const std::atomic<bool>& start,
+    const std::atomic<bool>& stop,
+    ThreadResult& result) {
+  torch::jit::StaticRuntime runtime(smod);
+
+  const int batch_size = FLAGS_qps_batch_size;
+  auto ad_emb_packed = torch::randn({batch_size, 1, embedding_size});
+  auto user_emb = torch::randn({batch_size, 1, embedding_size});
+  auto wide = torch::randn({batch_size, num_features});
+  std::vector<at::Tensor> inputs({ad_emb_packed, user_emb, wide});
+
+  for (int i = 0; i < FLAGS_qps_warmup_iters; ++i) {
+    runtime(inputs);
+  }
+
+  result.latencies_us.reserve(1 << 20);
+  num_ready++;
+  while (!start.load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+
+  while (!stop.load(std::memory_order_acquire)) {
+    const auto begin = std::chrono::steady_clock::now();
+    runtime(inputs);
+    const auto end = std::chrono::steady_clock::now();
+    result.latencies_us.push_back(
+        std::chrono::duration<double, std::micro>(end - begin).count());
+    result.queries++;
+  }
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  const auto idx = std::min(
+      sorted.size() - 1, static_cast<size_t>(p * (sorted.size() - 1)));
+  return sorted[idx];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  c10::ParseCommandLineFlags(&argc, &argv);
+
+  // One intra-op thread per runtime: in the serving setup this models,
+  // parallelism comes from concurrent requests, not from the intra-op pool.
+  at::set_num_threads(1);
+
+  auto mod = getDeepAndWideSciptModel(num_features);
+  torch::jit::StaticModule smod(mod);
+
+  auto* base_allocator = c10::GetAllocator(c10::DeviceType::CPU);
+  CountingCPUAllocator counting_allocator(base_allocator);
+  c10::SetCPUAllocator(&counting_allocator);
+
+  std::atomic<int> num_ready{0};
+  std::atomic<bool> start{false};
+  std::atomic<bool> stop{false};
+  std::vector<ThreadResult> results(FLAGS_qps_num_threads);
+  std::vector<std::thread> threads;
+  threads.reserve(FLAGS_qps_num_threads);
+  for (int t = 0; t < FLAGS_qps_num_threads; ++t) {
+    threads.emplace_back(
+        worker,
+        std::cref(smod),
+        std::ref(num_ready),
+        std::cref(start),
+        std::cref(stop),
+        std::ref(results[t]));
+  }
+  while (num_ready.load() < FLAGS_qps_num_threads) {
+    std::this_thread::yield();
+  }
+
+  const auto allocs_before = counting_allocator.numAllocs();
+  const auto bytes_before = counting_allocator.allocatedBytes();
+  const auto bench_begin = std::chrono::steady_clock::now();
+  start.store(true, std::memory_order_release);
+  std::this_thread::sleep_for(std::chrono::seconds(FLAGS_qps_duration_sec));
+  stop.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto bench_end = std::chrono::steady_clock::now();
+  const auto allocs = counting_allocator.numAllocs() - allocs_before;
+  const auto bytes = counting_allocator.allocatedBytes() - bytes_before;
+
+  c10::SetCPUAllocator(base_allocator);
+
+  const double elapsed_sec =
+      std::chrono::duration<double>(bench_end - bench_begin).count();
+  uint64_t total_queries = 0;
+  std::vector<double> latencies;
+  for (const auto& result : results) {
+    total_queries += result.queries;
+    latencies.insert(
+        latencies.end(),
+        result.latencies_us.begin(),
+        result.latencies_us.end());
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  std::cout << "threads: " << FLAGS_qps_num_threads
+            << ", batch_size: " << FLAGS_qps_batch_size
+            << ", duration: " << elapsed_sec << " s" << std::endl;
+  std::cout << "total queries: " << total_queries
+            << ", QPS: " << total_queries / elapsed_sec << std::endl;
+  std::cout << "latency (us): p50: " << percentile(latencies, 0.5)
+            << ", p90: " << percentile(latencies, 0.9)
+            << ", p99: " << percentile(latencies, 0.99)
+            << ", max: " << (latencies.empty() ? 0.0 : latencies.back())
+            << std::endl;
+  std::cout << "cpu allocator: " << allocs << " allocations, " << bytes
+            << " bytes, "
+            << (total_queries > 0
+                    ? static_cast<double>(allocs) / total_queries
+                    : 0.0)
+            << " allocations/query" << std::endl;
+  return 0;
+}
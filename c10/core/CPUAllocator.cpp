@@ -3,6 +3,15 @@
 #include <c10/mobile/CPUCachingAllocator.h>
 #include <c10/mobile/CPUProfilingAllocator.h>
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__) && !defined(C10_MOBILE)
+#include <sys/mman.h>
+#endif
+
 // TODO: rename flags to C10
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 C10_DEFINE_bool(
@@ -22,6 +31,29 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_use_thp,
+    false,
+    "If set, back CPU allocations of 2MB and above with 2MB-aligned mappings "
+    "marked madvise(MADV_HUGEPAGE), so the kernel can use transparent huge "
+    "pages for them (Linux only)");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_use_hugetlbfs,
+    false,
+    "If set, serve CPU allocations of 2MB and above from the explicit huge "
+    "page pool via mmap(MAP_HUGETLB), falling back to transparent huge pages "
+    "when the pool is exhausted (Linux only)");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_use_magazines,
+    false,
+    "If set, the default CPU allocator caches freed blocks in per-thread "
+    "size-class magazines instead of returning them to malloc immediately");
+
 namespace c10 {
 
 void memset_junk(void* data, size_t num) {
@@ -41,6 +73,141 @@ void memset_junk(void* data, size_t num) {
   }
 }
 
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local CPUNUMAPolicy tls_numa_policy = CPUNUMAPolicy::kLocal;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local int tls_numa_policy_node = -1;
+
+#if defined(__linux__) && !defined(C10_MOBILE)
+
+// Allocations of at least one huge page are eligible for huge-page backing.
+constexpr size_t kHugePageBytes = 2 * 1024 * 1024;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_thp_allocations{0};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_thp_bytes{0};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_hugetlb_allocations{0};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_hugetlb_bytes{0};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_thp_madvise_failures{0};
+
+// MAP_HUGETLB mappings must go back through munmap rather than free, so the
+// live ones are tracked in a small side table. The atomic count lets free_cpu
+// skip the mutex entirely when no hugetlbfs blocks exist, which is the common
+// case: only allocations of 2MB and above under an opt-in flag ever land here.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> g_hugetlb_live{0};
+
+struct HugetlbRegistry {
+  std::mutex mutex;
+  std::unordered_map<void*, size_t> blocks;
+};
+
+HugetlbRegistry& hugetlb_registry() {
+  static HugetlbRegistry registry;
+  return registry;
+}
+
+// Attempts a huge-page backed allocation; returns nullptr to make the caller
+// fall back to the regular posix_memalign path.
+void* try_alloc_cpu_huge_pages(size_t nbytes) {
+  if (nbytes < kHugePageBytes ||
+      (!FLAGS_caffe2_cpu_allocator_use_thp &&
+       !FLAGS_caffe2_cpu_allocator_use_hugetlbfs)) {
+    return nullptr;
+  }
+  if (FLAGS_caffe2_cpu_allocator_use_hugetlbfs) {
+    const size_t rounded = (nbytes + kHugePageBytes - 1) & ~(kHugePageBytes - 1);
+    void* data = mmap(
+        nullptr,
+        rounded,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+        -1,
+        0);
+    if (data != MAP_FAILED) {
+      {
+        std::lock_guard<std::mutex> guard(hugetlb_registry().mutex);
+        hugetlb_registry().blocks[data] = rounded;
+      }
+      g_hugetlb_live.fetch_add(1, std::memory_order_release);
+      g_hugetlb_allocations.fetch_add(1, std::memory_order_relaxed);
+      g_hugetlb_bytes.fetch_add(rounded, std::memory_order_relaxed);
+      return data;
+    }
+    // The explicit pool is exhausted or unconfigured; fall through to THP.
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  void* data;
+  if (posix_memalign(&data, kHugePageBytes, nbytes) != 0) {
+    return nullptr;
+  }
+  if (madvise(data, nbytes, MADV_HUGEPAGE) == 0) {
+    g_thp_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_thp_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+  } else {
+    g_thp_madvise_failures.fetch_add(1, std::memory_order_relaxed);
+  }
+  return data;
+}
+
+bool try_free_cpu_hugetlb(void* data) {
+  if (g_hugetlb_live.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+  size_t nbytes = 0;
+  {
+    std::lock_guard<std::mutex> guard(hugetlb_registry().mutex);
+    auto it = hugetlb_registry().blocks.find(data);
+    if (it == hugetlb_registry().blocks.end()) {
+      return false;
+    }
+    nbytes = it->second;
+    hugetlb_registry().blocks.erase(it);
+  }
+  g_hugetlb_live.fetch_sub(1, std::memory_order_release);
+  munmap(data, nbytes);
+  return true;
+}
+
+#endif // defined(__linux__) && !defined(C10_MOBILE)
+} // namespace
+
+CPUHugePageStats GetCPUHugePageStats() {
+  CPUHugePageStats stats;
+#if defined(__linux__) && !defined(C10_MOBILE)
+  stats.thp_allocations = g_thp_allocations.load(std::memory_order_relaxed);
+  stats.thp_bytes = g_thp_bytes.load(std::memory_order_relaxed);
+  stats.hugetlb_allocations =
+      g_hugetlb_allocations.load(std::memory_order_relaxed);
+  stats.hugetlb_bytes = g_hugetlb_bytes.load(std::memory_order_relaxed);
+  stats.thp_madvise_failures =
+      g_thp_madvise_failures.load(std::memory_order_relaxed);
+#endif
+  return stats;
+}
+
+CPUNUMAPolicy GetCPUNUMAPolicy() {
+  return tls_numa_policy;
+}
+
+int GetCPUNUMAPolicyNode() {
+  return tls_numa_policy_node;
+}
+
+void SetCPUNUMAPolicy(CPUNUMAPolicy policy, int node) {
+  TORCH_CHECK(
+      policy != CPUNUMAPolicy::kExplicit || node >= 0,
+      "explicit NUMA placement requires a non-negative node id, got ",
+      node);
+  tls_numa_policy = policy;
+  tls_numa_policy_node = policy == CPUNUMAPolicy::kExplicit ? node : -1;
+}
+
 void* alloc_cpu(size_t nbytes) {
   if (nbytes == 0) {
     return nullptr;
@@ -59,16 +226,23 @@ void* alloc_cpu(size_t nbytes) {
 #elif defined(_MSC_VER)
   data = _aligned_malloc(nbytes, gAlignment);
 #else
-  int err = posix_memalign(&data, gAlignment, nbytes);
-  if (err != 0) {
-    CAFFE_THROW(
-        "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
-        nbytes,
-        " bytes. Error code ",
-        err,
-        " (",
-        strerror(err),
-        ")");
+#if defined(__linux__) && !defined(C10_MOBILE)
+  data = try_alloc_cpu_huge_pages(nbytes);
+#else
+  data = nullptr;
+#endif
+  if (data == nullptr) {
+    int err = posix_memalign(&data, gAlignment, nbytes);
+    if (err != 0) {
+      CAFFE_THROW(
+          "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
+          nbytes,
+          " bytes. Error code ",
+          err,
+          " (",
+          strerror(err),
+          ")");
+    }
   }
 #endif
 
@@ -78,8 +252,22 @@ void* alloc_cpu(size_t nbytes) {
       nbytes,
       " bytes.");
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  // place data according to the current thread's NUMA policy; for
+  // kFirstTouch there is nothing to do, the kernel places each page on the
+  // node of the first thread that writes it
+  switch (GetCPUNUMAPolicy()) {
+    case CPUNUMAPolicy::kLocal:
+      NUMAMove(data, nbytes, GetCurrentNUMANode());
+      break;
+    case CPUNUMAPolicy::kExplicit:
+      NUMAMove(data, nbytes, GetCPUNUMAPolicyNode());
+      break;
+    case CPUNUMAPolicy::kInterleave:
+      NUMAInterleave(data, nbytes);
+      break;
+    case CPUNUMAPolicy::kFirstTouch:
+      break;
+  }
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
@@ -94,6 +282,11 @@ void* alloc_cpu(size_t nbytes) {
 }
 
 void free_cpu(void* data) {
+#if defined(__linux__) && !defined(C10_MOBILE)
+  if (try_free_cpu_hugetlb(data)) {
+    return;
+  }
+#endif
 #ifdef _MSC_VER
   _aligned_free(data);
 #else
@@ -102,13 +295,152 @@ void free_cpu(void* data) {
 #endif
 }
 
+namespace {
+
+// Optional per-thread magazine layer over alloc_cpu/free_cpu for the default
+// (server) CPU allocator. Unlike the mobile CPUCachingAllocator there is no
+// global mutex and no ptr->size table: allocation sizes are rounded up to
+// power-of-two size classes, freed blocks are parked in thread-local
+// magazines, and a gAlignment-sized header in front of every block records
+// its size class so the deleter needs no lookup. The header keeps the pointer
+// handed out to callers 64-byte aligned, exactly as alloc_cpu guarantees.
+//
+// Blocks freed on a different thread than they were allocated on simply land
+// in the freeing thread's magazines; the blocks are plain alloc_cpu memory,
+// so this only costs NUMA locality, never correctness. Garbage return is
+// driven by the byte budget: once a thread caches more than
+// kMagazineByteBudget, everything it holds goes back to the system, and a
+// thread's magazines are drained when the thread exits.
+
+constexpr size_t kNumSizeClasses = 15; // gAlignment << 0 .. gAlignment << 14
+constexpr size_t kMagazineDepth = 16; // cached blocks per size class
+constexpr size_t kMagazineByteBudget = 64 * 1024 * 1024; // per thread
+// Size class stored in the header of blocks too large to cache.
+constexpr size_t kUncachedClass = kNumSizeClasses;
+
+struct alignas(gAlignment) MagazineHeader {
+  size_t size_class;
+};
+
+inline size_t class_bytes(size_t cls) {
+  return gAlignment << cls;
+}
+
+// Smallest size class whose block fits the header plus nbytes, or
+// kUncachedClass if none does.
+inline size_t size_class_for(size_t nbytes) {
+  const size_t needed = nbytes + sizeof(MagazineHeader);
+  for (size_t cls = 0; cls < kNumSizeClasses; cls++) {
+    if (class_bytes(cls) >= needed) {
+      return cls;
+    }
+  }
+  return kUncachedClass;
+}
+
+struct CPUMagazineCache {
+  std::array<std::vector<void*>, kNumSizeClasses> magazines;
+  size_t cached_bytes = 0;
+
+  // Returns a cached block of the given class, or nullptr on a miss.
+  void* take(size_t cls) {
+    auto& magazine = magazines[cls];
+    if (magazine.empty()) {
+      return nullptr;
+    }
+    void* block = magazine.back();
+    magazine.pop_back();
+    cached_bytes -= class_bytes(cls);
+    return block;
+  }
+
+  void put(void* block, size_t cls) {
+    auto& magazine = magazines[cls];
+    if (magazine.size() >= kMagazineDepth) {
+      free_cpu(block);
+      return;
+    }
+    magazine.push_back(block);
+    cached_bytes += class_bytes(cls);
+    if (cached_bytes > kMagazineByteBudget) {
+      drain();
+    }
+  }
+
+  void drain() {
+    for (auto& magazine : magazines) {
+      for (void* block : magazine) {
+        free_cpu(block);
+      }
+      magazine.clear();
+    }
+    cached_bytes = 0;
+  }
+
+  ~CPUMagazineCache() {
+    drain();
+  }
+};
+
+CPUMagazineCache& thread_magazines() {
+  thread_local CPUMagazineCache cache;
+  return cache;
+}
+
+// Latched on first use so that blocks allocated with a header are always
+// freed through the header path, even if the flag is flipped afterwards.
+bool use_magazines() {
+  static const bool enabled = FLAGS_caffe2_cpu_allocator_use_magazines;
+  return enabled;
+}
+
+// Allocates nbytes behind a size-class header. Cache hits skip alloc_cpu, so
+// the zero/junk-fill flags are re-applied to the payload here.
+void* magazine_alloc_cpu(size_t nbytes) {
+  const size_t cls = size_class_for(nbytes);
+  if (cls != kUncachedClass) {
+    if (void* block = thread_magazines().take(cls)) {
+      auto* header = static_cast<MagazineHeader*>(block);
+      header->size_class = cls;
+      void* data = header + 1;
+      if (FLAGS_caffe2_cpu_allocator_do_zero_fill) {
+        memset(data, 0, nbytes);
+      } else if (FLAGS_caffe2_cpu_allocator_do_junk_fill) {
+        memset_junk(data, nbytes);
+      }
+      return data;
+    }
+  }
+  const size_t alloc_bytes =
+      cls != kUncachedClass ? class_bytes(cls) : nbytes + sizeof(MagazineHeader);
+  auto* header = static_cast<MagazineHeader*>(alloc_cpu(alloc_bytes));
+  header->size_class = cls;
+  return header + 1;
+}
+
+void magazine_free_cpu(void* data) {
+  auto* header = static_cast<MagazineHeader*>(data) - 1;
+  const size_t cls = header->size_class;
+  if (cls != kUncachedClass) {
+    thread_magazines().put(header, cls);
+  } else {
+    free_cpu(header);
+  }
+}
+
+} // namespace
+
 struct C10_API DefaultCPUAllocator final : at::Allocator {
   // NOLINTNEXTLINE(modernize-use-equals-default)
   DefaultCPUAllocator() {}
   // NOLINTNEXTLINE(modernize-use-equals-default)
   ~DefaultCPUAllocator() override {}
   at::DataPtr allocate(size_t nbytes) const override {
-    void* data = alloc_cpu(nbytes);
+    void* data = use_magazines() && nbytes != 0 ? magazine_alloc_cpu(nbytes)
+                                                : alloc_cpu(nbytes);
+    // The reporter sees every logical allocation and free, including the ones
+    // served out of the thread-local magazines, so memory profiling stays
+    // accurate with caching enabled.
     profiledCPUMemoryReporter().New(data, nbytes);
     return {data, data, &ReportAndDelete, at::Device(at::DeviceType::CPU)};
   }
@@ -118,7 +450,11 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
       return;
     }
     profiledCPUMemoryReporter().Delete(ptr);
-    free_cpu(ptr);
+    if (use_magazines()) {
+      magazine_free_cpu(ptr);
+    } else {
+      free_cpu(ptr);
+    }
   }
 
   at::DeleterFnPtr raw_deleter() const override {
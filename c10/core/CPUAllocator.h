@@ -11,6 +11,9 @@
 C10_DECLARE_bool(caffe2_report_cpu_memory_usage);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_zero_fill);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_junk_fill);
+C10_DECLARE_bool(caffe2_cpu_allocator_use_magazines);
+C10_DECLARE_bool(caffe2_cpu_allocator_use_thp);
+C10_DECLARE_bool(caffe2_cpu_allocator_use_hugetlbfs);
 
 namespace c10 {
 
@@ -37,6 +40,65 @@ C10_API void memset_junk(void* data, size_t num);
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
 
+// Cumulative statistics for huge-page backed CPU allocations, for verifying
+// huge page coverage in production. Only allocations above the huge page
+// threshold are counted; everything is zero unless one of the
+// caffe2_cpu_allocator_use_thp / caffe2_cpu_allocator_use_hugetlbfs flags is
+// set (Linux only).
+struct C10_API CPUHugePageStats {
+  // allocations that were 2MB-aligned and marked with madvise(MADV_HUGEPAGE)
+  size_t thp_allocations = 0;
+  size_t thp_bytes = 0;
+  // allocations mapped directly from the explicit huge page pool (MAP_HUGETLB)
+  size_t hugetlb_allocations = 0;
+  size_t hugetlb_bytes = 0;
+  // eligible allocations where madvise failed, i.e. THP coverage gaps
+  size_t thp_madvise_failures = 0;
+};
+
+C10_API CPUHugePageStats GetCPUHugePageStats();
+
+// NUMA placement policy applied by alloc_cpu. All of these are no-ops unless
+// NUMA is enabled (see IsNUMAEnabled).
+//
+// kLocal: bind the allocation to the allocating thread's NUMA node.
+// kFirstTouch: leave placement to the kernel, so each page lands on the node
+//   of the first thread that writes it - the right default for buffers that
+//   are initialized by the parallel_for workers that will also process them.
+// kInterleave: spread pages round-robin across all NUMA nodes.
+// kExplicit: bind the allocation to the node passed to SetCPUNUMAPolicy.
+enum class CPUNUMAPolicy : uint8_t {
+  kLocal,
+  kFirstTouch,
+  kInterleave,
+  kExplicit,
+};
+
+C10_API CPUNUMAPolicy GetCPUNUMAPolicy();
+C10_API int GetCPUNUMAPolicyNode();
+// Sets the NUMA placement policy for CPU allocations made on the current
+// thread. `node` is only meaningful (and required) for kExplicit.
+C10_API void SetCPUNUMAPolicy(CPUNUMAPolicy policy, int node = -1);
+
+// RAII guard that applies a NUMA placement policy to CPU allocations made on
+// the current thread, e.g. around an at::empty call that should target a
+// specific node.
+struct C10_API NUMAPolicyGuard {
+  explicit NUMAPolicyGuard(CPUNUMAPolicy policy, int node = -1)
+      : prev_policy_(GetCPUNUMAPolicy()), prev_node_(GetCPUNUMAPolicyNode()) {
+    SetCPUNUMAPolicy(policy, node);
+  }
+  NUMAPolicyGuard(const NUMAPolicyGuard&) = delete;
+  NUMAPolicyGuard& operator=(const NUMAPolicyGuard&) = delete;
+  ~NUMAPolicyGuard() {
+    SetCPUNUMAPolicy(prev_policy_, prev_node_);
+  }
+
+ private:
+  CPUNUMAPolicy prev_policy_;
+  int prev_node_;
+};
+
 // A simple struct that is used to report C10's memory allocation and
 // deallocation status to the profiler
 class C10_API ProfiledCPUMemoryReporter {
@@ -1 +1,22 @@
 #include <c10/core/StorageImpl.h>
+
+#include <c10/core/impl/MetadataFreeList.h>
+
+namespace c10 {
+
+void* StorageImpl::operator new(std::size_t size) {
+  if (impl::metadata_free_list_enabled()) {
+    return impl::metadata_free_list<StorageImpl>().allocate(size);
+  }
+  return ::operator new(size);
+}
+
+void StorageImpl::operator delete(void* ptr, std::size_t size) {
+  if (impl::metadata_free_list_enabled() &&
+      impl::metadata_free_list<StorageImpl>().recycle(ptr, size)) {
+    return;
+  }
+  ::operator delete(ptr);
+}
+
+} // namespace c10
@@ -89,6 +89,10 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
     data_ptr_.clear();
   }
 
+  // See Note [Metadata free lists] in c10/core/impl/MetadataFreeList.h.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+
   size_t nbytes() const {
     return size_bytes_;
   }
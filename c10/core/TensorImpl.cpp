@@ -3,6 +3,7 @@
 #include <c10/core/Backend.h>
 #include <c10/core/WrapDimMinimal.h>
 #include <c10/core/impl/LocalDispatchKeySet.h>
+#include <c10/core/impl/MetadataFreeList.h>
 #include <c10/util/Optional.h>
 #include <c10/core/InferenceMode.h>
 
@@ -284,6 +285,21 @@ void TensorImpl::release_resources() {
   }
 }
 
+void* TensorImpl::operator new(std::size_t size) {
+  if (impl::metadata_free_list_enabled()) {
+    return impl::metadata_free_list<TensorImpl>().allocate(size);
+  }
+  return ::operator new(size);
+}
+
+void TensorImpl::operator delete(void* ptr, std::size_t size) {
+  if (impl::metadata_free_list_enabled() &&
+      impl::metadata_free_list<TensorImpl>().recycle(ptr, size)) {
+    return;
+  }
+  ::operator delete(ptr);
+}
+
 #ifndef C10_DISABLE_TENSORIMPL_EXTENSIBILITY
 int64_t TensorImpl::dim() const {
   return sizes_and_strides_.size();
@@ -449,6 +449,13 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
    */
   virtual void release_resources() override;
 
+  // TensorImpls for temporaries are allocated and freed at very high rates;
+  // these optionally recycle exact-size blocks through a thread-local free
+  // list.  See Note [Metadata free lists] in
+  // c10/core/impl/MetadataFreeList.h.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+
   /**
    * Return the DispatchKeySet corresponding to this Tensor, specifying
    * all of the DispatchKeys that this Tensor identifies as.  This is the
@@ -992,10 +999,12 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   void set_sizes_contiguous(IntArrayRef new_size) {
     TORCH_CHECK(allow_tensor_metadata_change(), "set_sizes_contiguous ", err_msg_tensor_metadata_change_not_allowed);
 
-    sizes_and_strides_.set_sizes(new_size);
+    // Writes sizes and the implied strides in one pass and hands back the
+    // element count, so we don't walk the sizes three times (set_sizes,
+    // refresh_numel, empty_tensor_restride) for this very hot case.
+    numel_ = sizes_and_strides_.set_sizes_contiguous(new_size);
 
-    refresh_numel();
-    empty_tensor_restride(MemoryFormat::Contiguous);
+    refresh_contiguous();
   }
 
   /**
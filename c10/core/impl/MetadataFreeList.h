@@ -0,0 +1,115 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace c10 {
+namespace impl {
+
+// Note [Metadata free lists]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every temporary tensor heap-allocates a TensorImpl and (usually) a
+// StorageImpl, and frees them again moments later when the last
+// intrusive_ptr reference dies.  For small tensors this metadata churn can
+// rival the cost of the kernel itself.  Since intrusive_ptr releases its
+// target with a plain `delete`, the natural place to intercept both
+// allocation and deallocation is a class-level operator new/delete pair,
+// which TensorImpl and StorageImpl implement on top of the thread-local
+// free list below.
+//
+// Design constraints:
+//
+//  - Only exact-size allocations are recycled.  Subclasses (e.g.
+//    SparseTensorImpl) inherit the class-level operator new/delete but have
+//    a different size, so they fall through to the global allocator in both
+//    directions.
+//
+//  - Blocks on the list are ordinary ::operator new memory.  A block
+//    allocated on one thread may therefore be freed (and recycled) on
+//    another thread's list without any cross-thread bookkeeping.
+//
+//  - The list state is trivially destructible on purpose.  Tensors are
+//    routinely freed from destructors of objects with static storage
+//    duration, which may run after this thread's thread_local destructors;
+//    because the state object has no destructor its storage stays valid,
+//    and the `shutdown_` flag (set by the drain guard below) routes any
+//    late frees straight to ::operator delete.
+//
+// The recycler is opt-in: set PYTORCH_METADATA_FREELIST=1 in the
+// environment.  It is most useful for steady-state inference workloads
+// that create and destroy many small tensors per iteration.
+inline bool metadata_free_list_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_METADATA_FREELIST");
+    return env != nullptr && env[0] == '1';
+  }();
+  return enabled;
+}
+
+template <typename T>
+struct MetadataFreeList final {
+  // Bounds the number of cached blocks per thread; with TensorImpl at a few
+  // hundred bytes this caps the cache at roughly 100KB per thread.
+  static constexpr std::size_t kMaxDepth = 256;
+
+  void* allocate(std::size_t size) {
+    if (size == sizeof(T) && head_ != nullptr) {
+      void* block = head_;
+      head_ = *static_cast<void**>(block);
+      --depth_;
+      return block;
+    }
+    return ::operator new(size);
+  }
+
+  // Returns true if the block was taken; otherwise the caller must free it.
+  bool recycle(void* ptr, std::size_t size) {
+    if (shutdown_ || size != sizeof(T) || depth_ >= kMaxDepth) {
+      return false;
+    }
+    *static_cast<void**>(ptr) = head_;
+    head_ = ptr;
+    ++depth_;
+    return true;
+  }
+
+  void drain() {
+    while (head_ != nullptr) {
+      void* block = head_;
+      head_ = *static_cast<void**>(block);
+      ::operator delete(block);
+    }
+    depth_ = 0;
+    shutdown_ = true;
+  }
+
+ private:
+  void* head_ = nullptr;
+  std::size_t depth_ = 0;
+  bool shutdown_ = false;
+};
+
+// Frees the cached blocks at thread exit.  Kept separate from the list so
+// that the list itself stays trivially destructible; see the note above.
+template <typename T>
+struct MetadataFreeListDrainGuard final {
+  explicit MetadataFreeListDrainGuard(MetadataFreeList<T>& list)
+      : list_(list) {}
+  ~MetadataFreeListDrainGuard() {
+    list_.drain();
+  }
+  MetadataFreeList<T>& list_;
+};
+
+template <typename T>
+MetadataFreeList<T>& metadata_free_list() {
+  static thread_local MetadataFreeList<T> list;
+  static thread_local MetadataFreeListDrainGuard<T> guard(list);
+  return list;
+}
+
+} // namespace impl
+} // namespace c10
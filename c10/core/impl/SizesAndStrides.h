@@ -151,6 +151,33 @@ class C10_API SizesAndStrides {
     std::copy(newSizes.begin(), newSizes.end(), sizes_begin());
   }
 
+  // Fused update for the dominant case: set the sizes and the contiguous
+  // strides they imply in a single backward pass, rather than set_sizes()
+  // followed by a separate stride-refresh walk.  Returns the number of
+  // elements so that callers can refresh their cached numel without yet
+  // another pass over the sizes.
+  //
+  // NB: we deliberately keep the implied strides materialized instead of
+  // tagging contiguous tensors and deriving strides on demand:
+  // sizes_data()/strides_data() hand out raw pointers that callers hold
+  // across calls (e.g. TensorImpl::strides()), so there is no safe point
+  // at which to materialize lazily.
+  int64_t set_sizes_contiguous(IntArrayRef newSizes) {
+    resize(newSizes.size());
+    int64_t* sizes = sizes_data();
+    int64_t* strides = strides_data();
+    int64_t expected_stride = 1;
+    int64_t numel = 1;
+    for (size_t i = newSizes.size(); i-- > 0;) {
+      const int64_t size = newSizes[i];
+      sizes[i] = size;
+      strides[i] = expected_stride;
+      expected_stride *= std::max<int64_t>(size, 1);
+      numel *= size;
+    }
+    return numel;
+  }
+
   const int64_t* strides_data() const noexcept {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE];
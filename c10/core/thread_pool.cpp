@@ -1,24 +1,89 @@
 #include <c10/core/thread_pool.h>
 
+#include <algorithm>
+
 namespace c10 {
 
+// Note [Work stealing]
+// ~~~~~~~~~~~~~~~~~~~~
+// The pool used to be a single FIFO queue behind one mutex, which becomes a
+// serialization point once enough cores hammer ThreadPool::run (inter-op
+// parallelism submits a task per fork).  Instead, each worker owns a deque
+// guarded by its own mutex:
+//
+//  - Tasks submitted from outside the pool are spread round-robin across the
+//    deques.  Tasks submitted from inside the pool (e.g. the interpreter
+//    forking a continuation) go to the submitting worker's own deque, whose
+//    back end acts as a LIFO slot: the spawning thread picks the task back
+//    up while its working set is still warm in cache.
+//  - A worker pops from the back of its own deque and, when that is empty,
+//    steals from the front of the others', taking the oldest (and therefore
+//    coldest) task.  Steals use try_lock so a contended victim is simply
+//    skipped.
+//
+// The global mutex is only used for the sleep/wake handshake and for
+// waitWorkComplete; submitters touch it just when a worker is actually
+// asleep (tracked in sleepers_).  Accounting runs on two atomics: pending_
+// counts tasks claimed by a submitter but not yet started, busy_ counts
+// tasks being executed.  pending_ is incremented before the task is pushed
+// and a pop increments busy_ before decrementing pending_, so the pair can
+// never read 0/0 while a task is in flight.
+
+// Note [Lazy worker spawning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A pool constructed with spawn_lazily = true starts with zero threads and
+// grows one worker at a time, only when a task is submitted while every live
+// worker is busy (and the live count is below target_threads_).  A process
+// that only ever runs small parallel regions therefore keeps a small
+// footprint, while a heavily parallel one ramps up to the configured size.
+//
+// setNumThreads moves target_threads_ at runtime.  Shrinking does not
+// interrupt anything: a worker whose slot index is at or above the target
+// simply exits once its current task is done (sleepers are woken so they
+// notice).  The slot's std::thread object is joined and reused the next time
+// the pool grows.  The slot/queue capacity is fixed at construction, so the
+// target can never exceed the originally configured size.
+namespace {
+
+// Set by each worker on entry so that tasks spawned from inside the pool can
+// find their own deque (the LIFO slot above).
+thread_local ThreadPool* current_pool = nullptr;
+thread_local std::size_t current_queue_index = 0;
+
+} // namespace
+
 ThreadPool::ThreadPool(
       int pool_size,
       int numa_node_id,
-      std::function<void()> init_thread)
+      std::function<void()> init_thread,
+      bool spawn_lazily)
     : threads_(pool_size < 0 ? defaultNumThreads() : pool_size),
       running_(true),
-      complete_(true),
-      available_(threads_.size()),
-      total_(threads_.size()),
-      numa_node_id_(numa_node_id) {
+      pending_(0),
+      busy_(0),
+      sleepers_(0),
+      next_queue_(0),
+      numa_node_id_(numa_node_id),
+      init_thread_(std::move(init_thread)),
+      lazy_(spawn_lazily),
+      target_threads_(threads_.size()),
+      live_(0),
+      alive_(new std::atomic<bool>[std::max<std::size_t>(threads_.size(), 1)]) {
+  // At least one queue so that tasks submitted to an empty pool are parked
+  // rather than dropped, matching the old single-queue behavior.
+  const auto num_queues = std::max<std::size_t>(threads_.size(), 1);
+  queues_.reserve(num_queues);
+  for (std::size_t i = 0; i < num_queues; ++i) {
+    queues_.emplace_back(new WorkQueue());
+  }
   for (std::size_t i = 0; i < threads_.size(); ++i) {
-    threads_[i] = std::thread([this, i, init_thread](){
-      if (init_thread) {
-        init_thread();
-      }
-      this->main_loop(i);
-    });
+    alive_[i] = false;
+  }
+  if (!lazy_) {
+    std::lock_guard<std::mutex> guard(spawn_mutex_);
+    for (std::size_t i = 0; i < threads_.size(); ++i) {
+      spawn_worker_locked();
+    }
   }
 }
 
@@ -39,103 +104,206 @@ ThreadPool::~ThreadPool() {
 }
 
 size_t ThreadPool::size() const {
-  return threads_.size();
+  return target_threads_.load();
 }
 
 size_t ThreadPool::numAvailable() const {
-  return available_;
+  return static_cast<std::size_t>(
+      std::max<std::int64_t>(0, live_.load() - busy_.load()));
 }
 
 bool ThreadPool::inThreadPool() const {
-  for (auto& thread : threads_) {
-    if (thread.get_id() == std::this_thread::get_id()) {
-      return true;
+  // Workers register themselves on entry, so no need to scan threads_ (which
+  // can be respawned concurrently; see Note [Lazy worker spawning]).
+  return current_pool == this;
+}
+
+bool ThreadPool::setNumThreads(std::size_t num_threads) {
+  std::lock_guard<std::mutex> guard(spawn_mutex_);
+  const auto capacity = threads_.size();
+  if (num_threads > capacity) {
+    LOG(WARNING) << "ThreadPool was constructed with " << capacity
+                 << " thread slots; clamping requested size " << num_threads;
+    num_threads = capacity;
+  }
+  const auto prev_target = target_threads_.exchange(num_threads);
+  if (num_threads < prev_target) {
+    // Wake sleeping workers so excess ones notice the new target and exit.
+    std::lock_guard<std::mutex> lock(mutex_);
+    condition_.notify_all();
+  } else if (!lazy_) {
+    // Eager pools keep their full complement; lazy ones grow with demand.
+    while (static_cast<std::size_t>(live_.load()) < num_threads) {
+      spawn_worker_locked();
     }
   }
-  return false;
+  return true;
 }
 
 void ThreadPool::run(std::function<void()> func) {
   if (threads_.size() == 0) {
     throw std::runtime_error("No threads to run a task");
   }
-  std::unique_lock<std::mutex> lock(mutex_);
+  enqueue(task_element_t(std::move(func)));
+}
+
+void ThreadPool::enqueue(task_element_t task) {
+  std::size_t index;
+  if (current_pool == this) {
+    // Spawned from inside the pool: the submitting worker's own LIFO slot.
+    index = current_queue_index;
+  } else {
+    index = next_queue_++ % queues_.size();
+  }
+
+  // Claim the task in pending_ before it becomes visible in the queue; see
+  // Note [Work stealing] for why the order matters.
+  ++pending_;
+  {
+    std::lock_guard<std::mutex> guard(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+
+  if (sleepers_.load() > 0) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    condition_.notify_one();
+  }
+
+  if (lazy_) {
+    maybe_spawn_worker();
+  }
+}
 
-  // Set task and signal condition variable so that a worker thread will
-  // wake up and use the task.
-  tasks_.emplace(std::move(func));
-  complete_ = false;
-  condition_.notify_one();
+void ThreadPool::maybe_spawn_worker() {
+  // Grow only when the task just submitted has nobody idle to pick it up;
+  // see Note [Lazy worker spawning].
+  if (live_.load() >= static_cast<std::int64_t>(target_threads_.load()) ||
+      live_.load() > busy_.load()) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(spawn_mutex_);
+  if (live_.load() < static_cast<std::int64_t>(target_threads_.load()) &&
+      live_.load() <= busy_.load()) {
+    spawn_worker_locked();
+  }
+}
+
+void ThreadPool::spawn_worker_locked() {
+  const auto target = target_threads_.load();
+  for (std::size_t i = 0; i < threads_.size() && i < target; ++i) {
+    if (alive_[i].load()) {
+      continue;
+    }
+    if (threads_[i].joinable()) {
+      // The slot's previous worker exited after a shrink; reclaim it.
+      threads_[i].join();
+    }
+    alive_[i] = true;
+    ++live_;
+    threads_[i] = std::thread([this, i]() {
+      if (init_thread_) {
+        init_thread_();
+      }
+      this->main_loop(i);
+    });
+    return;
+  }
+}
+
+c10::optional<ThreadPool::task_element_t> ThreadPool::try_pop(
+    std::size_t index) {
+  const auto n = queues_.size();
+  // Our own deque: newest task first, for cache affinity.
+  {
+    WorkQueue& q = *queues_[index];
+    std::lock_guard<std::mutex> guard(q.mutex);
+    if (!q.tasks.empty()) {
+      ++busy_;
+      --pending_;
+      task_element_t task = std::move(q.tasks.back());
+      q.tasks.pop_back();
+      return task;
+    }
+  }
+  // Steal the oldest (coldest) task from someone else; skip victims whose
+  // lock is contended rather than queueing up on it.
+  for (std::size_t i = 1; i < n; ++i) {
+    WorkQueue& q = *queues_[(index + i) % n];
+    std::unique_lock<std::mutex> guard(q.mutex, std::try_to_lock);
+    if (!guard.owns_lock() || q.tasks.empty()) {
+      continue;
+    }
+    ++busy_;
+    --pending_;
+    task_element_t task = std::move(q.tasks.front());
+    q.tasks.pop_front();
+    return task;
+  }
+  return c10::nullopt;
 }
 
 void ThreadPool::waitWorkComplete() {
   std::unique_lock<std::mutex> lock(mutex_);
-  while (!complete_) {
-    completed_.wait(lock);
-  }
+  completed_.wait(lock, [&]() {
+    return pending_.load() == 0 && busy_.load() == 0;
+  });
 }
 
 void ThreadPool::main_loop(std::size_t index) {
-  std::unique_lock<std::mutex> lock(mutex_);
+  current_pool = this;
+  current_queue_index = index;
   while (running_) {
-    // Wait on condition variable while the task is empty and
-    // the pool is still running.
-    while (tasks_.empty() && running_) {
-      condition_.wait(lock);
-    }
-    // If pool is no longer running, break out of loop.
-    if (!running_) {
+    if (index >= target_threads_.load()) {
+      // The pool shrank below our slot; bow out (the slot thread is joined
+      // and reused if the pool grows again).
       break;
     }
-
-    // Copy task locally and remove from the queue.  This is
-    // done within its own scope so that the task object is
-    // destructed immediately after running the task.  This is
-    // useful in the event that the function contains
-    // shared_ptr arguments bound via bind.
-    {
-      task_element_t tasks = std::move(tasks_.front());
-      tasks_.pop();
-      // Decrement count, indicating thread is no longer available.
-      --available_;
-
-      lock.unlock();
-
-      // Run the task.
-      try {
-        if (tasks.run_with_id) {
-          tasks.with_id(index);
-        } else {
-          tasks.no_id();
-        }
-      } catch (const std::exception& e) {
-        LOG(ERROR) << "Exception in thread pool task: " << e.what();
-      } catch (...) {
-        LOG(ERROR) << "Exception in thread pool task: unknown";
+    c10::optional<task_element_t> task = try_pop(index);
+    if (!task) {
+      if (pending_.load() > 0) {
+        // A submitter has claimed a slot but hasn't finished pushing the
+        // task (or a victim's lock was contended); retry rather than sleep.
+        std::this_thread::yield();
+        continue;
       }
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++sleepers_;
+      while (pending_.load() == 0 && running_ &&
+             index < target_threads_.load()) {
+        condition_.wait(lock);
+      }
+      --sleepers_;
+      continue;
+    }
 
-      // Destruct tasks before taking the lock.  As tasks
-      // are user provided std::function, they can run
-      // arbitrary code during destruction, including code
-      // that can reentrantly call into ThreadPool (which would
-      // cause a deadlock if we were holding the lock).
+    // Run the task.
+    try {
+      if (task->run_with_id) {
+        task->with_id(index);
+      } else {
+        task->no_id();
+      }
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception in thread pool task: " << e.what();
+    } catch (...) {
+      LOG(ERROR) << "Exception in thread pool task: unknown";
     }
 
-    // Update status of empty, maybe
-    // Need to recover the lock first
-    lock.lock();
+    // Destruct the task before the completion bookkeeping.  As tasks are
+    // user provided std::function, they can run arbitrary code during
+    // destruction, including code that can reentrantly call into
+    // ThreadPool.
+    task = c10::nullopt;
 
-    // Increment count, indicating thread is available.
-    ++available_;
-    if (tasks_.empty() && available_ == total_) {
-      complete_ = true;
-      completed_.notify_one();
+    --busy_;
+    if (pending_.load() == 0 && busy_.load() == 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      completed_.notify_all();
     }
-
-    // Deliberately hold the lock on the backedge, so this thread has an
-    // opportunity to acquire a new task before another thread acquires
-    // the lock.
-  } // while running_
+  }
+  alive_[index] = false;
+  --live_;
+  current_pool = nullptr;
 }
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
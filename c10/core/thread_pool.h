@@ -1,11 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <c10/util/Optional.h>
 #include <c10/util/intrusive_ptr.h>
@@ -31,6 +35,14 @@ class C10_API TaskThreadPoolBase {
    */
   virtual bool inThreadPool() const = 0;
 
+  /**
+   * Adjust the number of worker threads at runtime. Returns false if this
+   * pool implementation cannot be resized.
+   */
+  virtual bool setNumThreads(std::size_t /* num_threads */) {
+    return false;
+  }
+
   virtual ~TaskThreadPoolBase() noexcept {}
 
   static size_t defaultNumThreads() {
@@ -55,16 +67,49 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
       : run_with_id(true), no_id(nullptr), with_id(std::move(f)) {}
   };
 
-  std::queue<task_element_t> tasks_;
+  // One deque per worker; see Note [Work stealing] in thread_pool.cpp.
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<task_element_t> tasks;
+  };
+
+  // Worker slots; see Note [Lazy worker spawning] in thread_pool.cpp. Slot
+  // threads are (re)assigned only under spawn_mutex_, and the vector never
+  // reallocates after construction.
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
   std::vector<std::thread> threads_;
+
+  // Guards only the sleep/wake and completion handshakes; tasks are
+  // pushed and popped under the per-queue mutexes above.
   std::mutex mutex_;
   std::condition_variable condition_;
   std::condition_variable completed_;
   std::atomic_bool running_;
-  bool complete_;
-  std::size_t available_;
-  std::size_t total_;
+  // Tasks queued but not yet started / currently executing.  A pop moves
+  // a task from pending_ to busy_ before releasing the queue lock, so
+  // pending_ == 0 && busy_ == 0 really means all work is done.
+  std::atomic<std::int64_t> pending_;
+  std::atomic<std::int64_t> busy_;
+  // Workers blocked on condition_; lets submitters skip the notify (and
+  // the global mutex) entirely when everyone is already awake.
+  std::atomic<std::int64_t> sleepers_;
+  // Round-robin cursor for tasks submitted from outside the pool.
+  std::atomic<std::size_t> next_queue_;
   int numa_node_id_;
+  // Per-worker setup (thread name, NUMA binding, ...), kept so that lazily
+  // spawned and respawned workers get the same initialization.
+  std::function<void()> init_thread_;
+  bool lazy_;
+  // Current thread budget; workers whose slot index is >= target_threads_
+  // exit after their current task. Never exceeds the slot capacity fixed at
+  // construction.
+  std::atomic<std::size_t> target_threads_;
+  // Number of live workers and the per-slot liveness flags.
+  std::atomic<std::int64_t> live_;
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  std::unique_ptr<std::atomic<bool>[]> alive_;
+  // Serializes spawning/joining of slot threads.
+  std::mutex spawn_mutex_;
 
  public:
   ThreadPool() = delete;
@@ -72,7 +117,8 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   explicit ThreadPool(
       int pool_size,
       int numa_node_id = -1,
-      std::function<void()> init_thread = nullptr);
+      std::function<void()> init_thread = nullptr,
+      bool spawn_lazily = false);
 
   ~ThreadPool();
 
@@ -82,25 +128,35 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
   bool inThreadPool() const override;
 
+  bool setNumThreads(std::size_t num_threads) override;
+
   void run(std::function<void()> func) override;
 
   template <typename Task>
   void runTaskWithID(Task task) {
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    // Set task and signal condition variable so that a worker thread will
-    // wake up and use the task.
-    tasks_.emplace(static_cast<std::function<void(std::size_t)>>(task));
-    complete_ = false;
-    condition_.notify_one();
+    enqueue(
+        task_element_t(static_cast<std::function<void(std::size_t)>>(task)));
   }
 
   /// @brief Wait for queue to be empty
   void waitWorkComplete();
 
+ protected:
+  // @brief Queue a task on the appropriate deque and wake a worker.
+  void enqueue(task_element_t task);
+
  private:
+  // @brief Pop from our own deque, stealing from the others if it's empty.
+  c10::optional<task_element_t> try_pop(std::size_t index);
+
   // @brief Entry point for pool threads.
   void main_loop(std::size_t index);
+
+  // @brief Spawn one more worker if demand warrants it (lazy pools only).
+  void maybe_spawn_worker();
+
+  // @brief Start a worker in the first free slot; needs spawn_mutex_.
+  void spawn_worker_locked();
 };
 
 class C10_API TaskThreadPool : public c10::ThreadPool {
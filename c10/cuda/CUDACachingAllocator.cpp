@@ -1,6 +1,8 @@
 
 #include <c10/cuda/CUDACachingAllocator.h>
 
+#include <c10/cuda/CUDAMallocAsyncAllocator.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
@@ -8,17 +10,34 @@
 
 #include <cuda_runtime_api.h>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <array>
 #include <bitset>
+#include <cstdint>
 #include <deque>
 #include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+// Expandable segments are built on the CUDA virtual memory management API
+// (cuMemAddressReserve & friends), which requires CUDA 11 and the driver
+// library. The driver entry points are resolved with dlsym so that c10_cuda
+// keeps linking against the runtime only; see Note [Expandable segments].
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11000 && defined(__linux__) && \
+    !defined(USE_ROCM)
+#define PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+#include <cuda.h>
+#include <dlfcn.h>
+#endif
+
 namespace c10 {
 
 C10_DEFINE_REGISTRY(FreeCudaMemoryCallbacksRegistry, FreeMemoryCallback);
@@ -41,6 +60,9 @@ namespace CUDACachingAllocator {
 //   smallest available free block or allocate a new block using cudaMalloc.
 //   To reduce fragmentation, requests between 1MB and 10MB will allocate and
 //   split a 20MB block, if no free block of sufficient size is available.
+// - Optionally (PYTORCH_CUDA_ALLOC_EXPANDABLE_SEGMENTS=1), large allocations
+//   are served from virtual-memory segments that grow in place rather than
+//   from fresh cudaMallocs; see Note [Expandable segments].
 //
 // With this allocator, allocations and frees should logically be considered
 // "usages" of the memory segment associated with streams, just like kernel
@@ -125,6 +147,7 @@ void update_stat_array(StatArray& stat_array, int64_t amount, const StatTypes& s
 }
 
 struct Block;
+struct ExpandableSegment;
 struct PrivatePool;
 typedef bool (*Comparison)(const Block*, const Block*);
 
@@ -151,6 +174,9 @@ struct Block {
   Block*        prev;        // prev block if split from a larger allocation
   Block*        next;        // next block if split from a larger allocation
   int           event_count; // number of outstanding CUDA events
+  // owning expandable segment, or nullptr for cudaMalloc'ed memory.
+  // See Note [Expandable segments].
+  ExpandableSegment* expandable_segment_{nullptr};
 
   Block(int device, cudaStream_t stream, size_t size, BlockPool* pool, void* ptr) :
     device(device), stream(stream), stream_uses(), size(size), pool(pool),
@@ -177,6 +203,41 @@ static bool BlockComparator(const Block* a, const Block* b)
   return (uintptr_t)a->ptr < (uintptr_t)b->ptr;
 }
 
+/**
+ * Note [Allocator flight recorder]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Aggregate stats tell you how much memory was in flight when something went
+ * wrong, but not what the allocator was doing in the moments before. Each
+ * DeviceCachingAllocator therefore keeps an always-on ring buffer of its
+ * recent events - allocations, frees, segment acquisitions and releases, and
+ * OOMs - each stamped with a steady-clock time, stream, address and size.
+ * Recording is a struct copy into a preallocated buffer under the mutex the
+ * caller already holds, so it is cheap enough to leave enabled in
+ * production. The buffer is dumped through snapshotTrace() (exposed to
+ * Python as torch.cuda.memory_trace), and the OOM error message
+ * includes a summary of the free pools so the state at failure survives in
+ * logs even when nobody thought to grab a snapshot.
+ *
+ * PYTORCH_CUDA_ALLOC_TRACE_ENTRIES overrides the per-device ring size; 0
+ * disables recording.
+ */
+size_t trace_buffer_entries() {
+  static const size_t entries = []() -> size_t {
+    const char* env = std::getenv("PYTORCH_CUDA_ALLOC_TRACE_ENTRIES");
+    if (env == nullptr) {
+      return 16384; // ~0.75MiB per device
+    }
+    return strtoull(env, /*str_end=*/nullptr, /*base=*/10);
+  }();
+  return entries;
+}
+
+int64_t trace_time_us() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
 static std::string format_size(uint64_t size) {
   std::ostringstream os;
   os.precision(2);
@@ -261,6 +322,209 @@ cudaError_t cudaMallocMaybeCapturing(void** p, size_t size) {
 #endif
 }
 
+/**
+ * Note [Expandable segments]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * cudaMalloc'ed segments have a fixed size: when a model's allocation sizes
+ * shift (e.g. a new maximum sequence length), the cached segments frequently
+ * cannot be reassembled into a block of the newly requested size even though
+ * the sum of free memory would suffice, and the allocator has to cudaFree
+ * everything and re-request memory from the driver. Expandable segments
+ * avoid that by reserving a large virtual address range up front
+ * (cuMemAddressReserve, address space is plentiful) and mapping physical
+ * memory into a prefix of that range on demand (cuMemCreate + cuMemMap).
+ * When a request doesn't fit the cached blocks, the segment *grows in
+ * place*: the newly mapped tail is linked (via Block::prev/next) to the
+ * block at the previous end of the segment, so the regular block-merging
+ * logic coalesces memory across growth boundaries and a segment behaves
+ * like one contiguous, resizable slab.
+ *
+ * The mode is opt-in via PYTORCH_CUDA_ALLOC_EXPANDABLE_SEGMENTS=1 and only
+ * used for the large pool (small allocations are packed into fixed 2 MiB
+ * buffers, which don't fragment), outside graph capture and never for a
+ * graph's PrivatePool (capture relies on cudaMalloc's capture-aware path).
+ * A segment is unmapped and its physical handles released only once every
+ * block in it has been freed and coalesced back into one span, mirroring
+ * how cudaMalloc'ed segments are only cudaFree'd when unsplit. Mapped
+ * memory is accounted in reserved_bytes/segment stats exactly like
+ * cudaMalloc'ed segments.
+ */
+
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
+// Entry points into the driver library, resolved lazily so that c10_cuda
+// does not take a link-time dependency on libcuda (which is absent on
+// machines without a driver, e.g. CPU-only CI building with a toolkit).
+struct DriverAPI {
+  decltype(&cuMemGetAllocationGranularity) memGetAllocationGranularity_;
+  decltype(&cuMemAddressReserve) memAddressReserve_;
+  decltype(&cuMemAddressFree) memAddressFree_;
+  decltype(&cuMemCreate) memCreate_;
+  decltype(&cuMemRelease) memRelease_;
+  decltype(&cuMemMap) memMap_;
+  decltype(&cuMemUnmap) memUnmap_;
+  decltype(&cuMemSetAccess) memSetAccess_;
+
+  // Returns nullptr if the driver is unavailable or predates the virtual
+  // memory management API.
+  static DriverAPI* get() {
+    static DriverAPI* instance = []() -> DriverAPI* {
+      // The runtime has already loaded the driver by the time the allocator
+      // runs, so RTLD_NOLOAD either hands back the live handle or tells us
+      // there is no driver to speak of.
+      void* handle = dlopen("libcuda.so.1", RTLD_LAZY | RTLD_NOLOAD);
+      if (!handle) {
+        return nullptr;
+      }
+      static DriverAPI api;
+      bool ok = true;
+      auto resolve = [&](auto& fn, const char* name) {
+        fn = reinterpret_cast<std::decay_t<decltype(fn)>>(dlsym(handle, name));
+        ok = ok && fn != nullptr;
+      };
+      resolve(api.memGetAllocationGranularity_, "cuMemGetAllocationGranularity");
+      resolve(api.memAddressReserve_, "cuMemAddressReserve");
+      resolve(api.memAddressFree_, "cuMemAddressFree");
+      resolve(api.memCreate_, "cuMemCreate");
+      resolve(api.memRelease_, "cuMemRelease");
+      resolve(api.memMap_, "cuMemMap");
+      resolve(api.memUnmap_, "cuMemUnmap");
+      resolve(api.memSetAccess_, "cuMemSetAccess");
+      return ok ? &api : nullptr;
+    }();
+    return instance;
+  }
+};
+
+bool expandable_segments_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_CUDA_ALLOC_EXPANDABLE_SEGMENTS");
+    return env != nullptr && env[0] == '1' && DriverAPI::get() != nullptr;
+  }();
+  return enabled;
+}
+
+// One growable slab of device memory, private to a (device, stream) pair of
+// the large pool. See Note [Expandable segments].
+struct ExpandableSegment {
+  ExpandableSegment(const ExpandableSegment&) = delete;
+  ExpandableSegment& operator=(const ExpandableSegment&) = delete;
+  ExpandableSegment() = default;
+
+  // Reserves the virtual address range (sized to the whole device, rounded
+  // to the mapping granularity). Returns false and leaves the segment empty
+  // if the driver refuses.
+  bool reserve(int device) {
+    device_ = device;
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device;
+    if (DriverAPI::get()->memGetAllocationGranularity_(
+            &granularity_, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM) !=
+        CUDA_SUCCESS) {
+      return false;
+    }
+    size_t device_free = 0;
+    size_t device_total = 0;
+    if (cudaMemGetInfo(&device_free, &device_total) != cudaSuccess) {
+      return false;
+    }
+    reserved_size_ = round_up(device_total);
+    if (DriverAPI::get()->memAddressReserve_(
+            &base_, reserved_size_, 0, 0, 0) != CUDA_SUCCESS) {
+      reserved_size_ = 0;
+      return false;
+    }
+    return true;
+  }
+
+  // Maps `size` more bytes (the caller rounds to granularity) at the end of
+  // the segment and returns a pointer to the start of the new mapping, or
+  // nullptr on failure (the caller falls back to cudaMalloc).
+  void* grow(size_t size) {
+    if (mapped_size_ + size > reserved_size_) {
+      return nullptr;
+    }
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device_;
+    CUmemGenericAllocationHandle handle;
+    if (DriverAPI::get()->memCreate_(&handle, size, &prop, 0) !=
+        CUDA_SUCCESS) {
+      // A failed cuMemCreate (like a failed cudaMalloc) leaves no state to
+      // clean up; the caller treats it as an ordinary OOM.
+      return nullptr;
+    }
+    const CUdeviceptr tail = base_ + mapped_size_;
+    if (DriverAPI::get()->memMap_(tail, size, 0, handle, 0) != CUDA_SUCCESS) {
+      DriverAPI::get()->memRelease_(handle);
+      return nullptr;
+    }
+    CUmemAccessDesc desc = {};
+    desc.location = prop.location;
+    desc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    if (DriverAPI::get()->memSetAccess_(tail, size, &desc, 1) !=
+        CUDA_SUCCESS) {
+      DriverAPI::get()->memUnmap_(tail, size);
+      DriverAPI::get()->memRelease_(handle);
+      return nullptr;
+    }
+    handles_.emplace_back(handle, size);
+    mapped_size_ += size;
+    return reinterpret_cast<void*>(tail);
+  }
+
+  // Unmaps all physical memory and returns the address range to the driver.
+  // Only called once every block of the segment has coalesced back into one
+  // free span.
+  void release() {
+    if (mapped_size_ > 0) {
+      DriverAPI::get()->memUnmap_(base_, mapped_size_);
+    }
+    for (const auto& handle : handles_) {
+      DriverAPI::get()->memRelease_(handle.first);
+    }
+    handles_.clear();
+    if (reserved_size_ > 0) {
+      DriverAPI::get()->memAddressFree_(base_, reserved_size_);
+    }
+    base_ = 0;
+    reserved_size_ = 0;
+    mapped_size_ = 0;
+    tail_block = nullptr;
+  }
+
+  size_t round_up(size_t size) const {
+    return granularity_ * ((size + granularity_ - 1) / granularity_);
+  }
+
+  void* base_ptr() const {
+    return reinterpret_cast<void*>(base_);
+  }
+
+  size_t mapped_size() const {
+    return mapped_size_;
+  }
+
+  // Block at the mapped end of the segment; new growth is linked to it so
+  // that try_merge_blocks coalesces across growth boundaries. Kept up to
+  // date by try_merge_blocks when the tail is merged away.
+  Block* tail_block{nullptr};
+
+ private:
+  int device_{0};
+  CUdeviceptr base_{0};
+  size_t reserved_size_{0};
+  size_t mapped_size_{0};
+  size_t granularity_{0};
+  // Physical allocation handles in mapping order, with their sizes.
+  std::vector<std::pair<CUmemGenericAllocationHandle, size_t>> handles_;
+};
+
+#endif // PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
 } // namespace
 
 class DeviceCachingAllocator {
@@ -290,7 +554,15 @@ class DeviceCachingAllocator {
   // See free() for this thing's purpose
   std::vector<Block*> needs_events_deferred_until_no_capture;
   // outstanding cuda events
-  std::deque<std::pair<cudaEvent_t, Block*>> cuda_events;
+  struct EventRecord {
+    cudaEvent_t event;
+    Block* block;
+    // Device the event was created on (its recording stream's device, which
+    // can differ from this allocator's device for cross-device uses); the
+    // event pool is per device.
+    DeviceIndex device;
+  };
+  std::deque<EventRecord> cuda_events;
 
   // record used memory.
   size_t total_allocated_memory = 0;
@@ -312,6 +584,60 @@ class DeviceCachingAllocator {
   // in case we want multiple captures to share the same pool
   std::unordered_map<CaptureId_t, MempoolId_t> capture_to_pool_map;
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // One growable segment per stream for the (default) large pool.
+  // See Note [Expandable segments].
+  std::unordered_map<cudaStream_t, std::unique_ptr<ExpandableSegment>>
+      expandable_segments_;
+#endif
+
+  // Ring buffer of recent allocator events; alloc_trace_next is the index
+  // of the oldest entry once the buffer has wrapped.
+  // See Note [Allocator flight recorder].
+  std::vector<TraceEntry> alloc_trace;
+  size_t alloc_trace_next = 0;
+
+  // Caller must hold the mutex.
+  void record_trace(
+      TraceEntry::Action action,
+      int device,
+      void* addr,
+      size_t size,
+      cudaStream_t stream) {
+    const size_t max_entries = trace_buffer_entries();
+    if (max_entries == 0) {
+      return;
+    }
+    TraceEntry te;
+    te.action = action;
+    te.device = device;
+    te.addr = reinterpret_cast<int64_t>(addr);
+    te.size = size;
+    te.stream = stream;
+    te.time_us = trace_time_us();
+    if (alloc_trace.size() < max_entries) {
+      alloc_trace.push_back(te);
+    } else {
+      alloc_trace[alloc_trace_next] = te;
+      alloc_trace_next = (alloc_trace_next + 1) % max_entries;
+    }
+  }
+
+  // Summarizes a pool's free blocks in one line for the OOM message.
+  std::string oom_pool_summary(const char* name, const BlockPool& pool) const {
+    size_t count = 0;
+    size_t total = 0;
+    size_t largest = 0;
+    for (const Block* block : pool.blocks) {
+      count++;
+      total += block->size;
+      largest = std::max(largest, block->size);
+    }
+    return std::string(name) + " pool: " + std::to_string(count) +
+        " free blocks (" + format_size(total) + " total, largest " +
+        format_size(largest) + ")";
+  }
+
  public:
 
   DeviceCachingAllocator() :
@@ -370,6 +696,8 @@ class DeviceCachingAllocator {
 
       stats.num_ooms += 1;
 
+      record_trace(TraceEntry::OOM, device, nullptr, alloc_size, stream);
+
       // "total capacity": total global memory on GPU
       // "allowed": memory is allowed to use, which set by fraction.
       // "already allocated": memory allocated by the program using the
@@ -397,7 +725,9 @@ class DeviceCachingAllocator {
         format_size(device_free), " free; ",
         allowed_info,
         format_size(stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].current),
-        " reserved in total by PyTorch)");
+        " reserved in total by PyTorch; ",
+        oom_pool_summary("large", large_blocks), "; ",
+        oom_pool_summary("small", small_blocks), ")");
     }
 
     TORCH_INTERNAL_ASSERT(params.err == cudaSuccess &&
@@ -411,6 +741,7 @@ class DeviceCachingAllocator {
       remaining = block;
 
       block = new Block(device, stream, size, &pool, block->ptr);
+      block->expandable_segment_ = remaining->expandable_segment_;
       block->prev = remaining->prev;
       if (block->prev) {
         block->prev->next = block;
@@ -450,6 +781,8 @@ class DeviceCachingAllocator {
     update_stat_array(stats.active, 1, params.stat_types);
     update_stat_array(stats.active_bytes, block->size, params.stat_types);
 
+    record_trace(TraceEntry::ALLOC, device, block->ptr, block->size, stream);
+
     return block;
   }
 
@@ -468,6 +801,9 @@ class DeviceCachingAllocator {
     update_stat_array(stats.allocation, -1, {stat_types});
     update_stat_array(stats.allocated_bytes, -block->size, {stat_types});
 
+    record_trace(
+        TraceEntry::FREE, block->device, block->ptr, block->size, block->stream);
+
     if (!block->stream_uses.empty()) {
       if (C10_UNLIKELY(captures_underway)) {
         // It's forbidden to cudaEventQuery an event recorded during CUDA graph capture.
@@ -627,6 +963,24 @@ class DeviceCachingAllocator {
     return result;
   }
 
+  /** Dump the flight recorder, oldest entry first. See Note [Allocator flight recorder]. **/
+  std::vector<TraceEntry> trace() const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    std::vector<TraceEntry> result;
+    result.reserve(alloc_trace.size());
+    // Once the ring has wrapped, alloc_trace_next indexes the oldest entry.
+    result.insert(
+        result.end(),
+        alloc_trace.begin() + alloc_trace_next,
+        alloc_trace.end());
+    result.insert(
+        result.end(),
+        alloc_trace.begin(),
+        alloc_trace.begin() + alloc_trace_next);
+    return result;
+  }
+
   static size_t round_size(size_t size) {
     if (size < kMinBlockSize) {
       return kMinBlockSize;
@@ -767,6 +1121,14 @@ class DeviceCachingAllocator {
 
     const size_t subsumed_size = src->size;
     dst->size += subsumed_size;
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    // Keep the segment's tail pointer live across merges so later growth
+    // still links to the block at the mapped end.
+    if (src->expandable_segment_ != nullptr &&
+        src->expandable_segment_->tail_block == src) {
+      src->expandable_segment_->tail_block = dst;
+    }
+#endif
     auto erased = pool.blocks.erase(src);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(erased == 1);
     delete src;
@@ -856,6 +1218,17 @@ class DeviceCachingAllocator {
       stats.num_alloc_retries += 1;
     }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    // Grow an expandable segment in place instead of cudaMalloc'ing a fresh
+    // fixed-size segment; falls through to cudaMalloc if growth fails.
+    // See Note [Expandable segments].
+    if (expandable_segments_enabled() && !p.pool->is_small &&
+        !p.pool->owner_PrivatePool && captures_underway == 0 &&
+        try_expandable_alloc(p)) {
+      return true;
+    }
+#endif
+
     if (set_fraction && total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
       return false;
@@ -888,11 +1261,55 @@ class DeviceCachingAllocator {
     update_stat_array(stats.segment, 1, p.stat_types);
     update_stat_array(stats.reserved_bytes, size, p.stat_types);
 
+    record_trace(TraceEntry::SEGMENT_ALLOC, p.device(), ptr, size, p.stream());
+
     // p.block came from new, not cudaMalloc. It should not be nullptr here.
     TORCH_INTERNAL_ASSERT(p.block != nullptr && p.block->ptr != nullptr);
     return true;
   }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // Satisfies p by growing (or creating) the expandable segment of p's
+  // stream. The new mapping is linked to the block at the previous end of
+  // the segment so the two merge once both are free.
+  // See Note [Expandable segments].
+  bool try_expandable_alloc(AllocParams& p) {
+    auto& segment = expandable_segments_[p.stream()];
+    if (!segment) {
+      auto fresh = std::make_unique<ExpandableSegment>();
+      if (!fresh->reserve(p.device())) {
+        expandable_segments_.erase(p.stream());
+        return false;
+      }
+      segment = std::move(fresh);
+      update_stat_array(stats.segment, 1, p.stat_types);
+    }
+    const size_t mapped_size = segment->round_up(p.alloc_size);
+    if (set_fraction &&
+        total_allocated_memory + mapped_size > allowed_memory_maximum) {
+      return false;
+    }
+    void* ptr = segment->grow(mapped_size);
+    if (ptr == nullptr) {
+      return false;
+    }
+    total_allocated_memory += mapped_size;
+    Block* block = new Block(p.device(), p.stream(), mapped_size, p.pool, ptr);
+    block->expandable_segment_ = segment.get();
+    if (segment->tail_block != nullptr) {
+      block->prev = segment->tail_block;
+      segment->tail_block->next = block;
+    }
+    segment->tail_block = block;
+    p.block = block;
+    p.err = cudaSuccess;
+    update_stat_array(stats.reserved_bytes, mapped_size, p.stat_types);
+    record_trace(
+        TraceEntry::SEGMENT_ALLOC, p.device(), ptr, mapped_size, p.stream());
+    return true;
+  }
+#endif
+
   bool free_cached_blocks()
   {
     // First ensure that all blocks that can't currently be allocated due to
@@ -927,6 +1344,39 @@ class DeviceCachingAllocator {
     while (it != pool.blocks.end()) {
       Block* block = *it;
       if (!block->prev && !block->next) {
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+        if (block->expandable_segment_ != nullptr) {
+          // An unsplit expandable block has coalesced back into the full
+          // mapped span of its segment; unmap it and return the physical
+          // memory (and the address range) to the driver.
+          ExpandableSegment* segment = block->expandable_segment_;
+          TORCH_INTERNAL_ASSERT(
+              block->ptr == segment->base_ptr() &&
+              block->size == segment->mapped_size());
+          segment->release();
+          total_allocated_memory -= block->size;
+
+          StatTypes stat_types;
+          stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+          stat_types[static_cast<size_t>(get_stat_type_for_pool(pool))] = true;
+          update_stat_array(stats.segment, -1, stat_types);
+          update_stat_array(stats.reserved_bytes, -block->size, stat_types);
+
+          record_trace(
+              TraceEntry::SEGMENT_FREE,
+              block->device,
+              block->ptr,
+              block->size,
+              block->stream);
+
+          expandable_segments_.erase(block->stream);
+          auto cur = it;
+          ++it;
+          pool.blocks.erase(cur);
+          delete block;
+          continue;
+        }
+#endif
         C10_CUDA_CHECK(cudaFree((void*)block->ptr));
         total_allocated_memory -= block->size;
 
@@ -942,6 +1392,13 @@ class DeviceCachingAllocator {
         update_stat_array(stats.segment, -1, stat_types);
         update_stat_array(stats.reserved_bytes, -block->size, stat_types);
 
+        record_trace(
+            TraceEntry::SEGMENT_FREE,
+            block->device,
+            block->ptr,
+            block->size,
+            block->stream);
+
         auto cur = it;
         ++it;
         pool.blocks.erase(cur);
@@ -952,14 +1409,15 @@ class DeviceCachingAllocator {
     }
   }
 
-  cudaEvent_t create_event_internal() {
-    cudaEvent_t event;
-    C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
-    return event;
+  // Events come from the per-device pool so the hot free path doesn't pay
+  // for cudaEventCreateWithFlags/cudaEventDestroy; see CUDAEventPool.h.
+  // The caller must have `device` current.
+  cudaEvent_t create_event_internal(DeviceIndex device) {
+    return getEventFromPool(device);
   }
 
-  void free_event_internal(cudaEvent_t event) {
-    C10_CUDA_CHECK(cudaEventDestroy(event));
+  void free_event_internal(DeviceIndex device, cudaEvent_t event) {
+    returnEventToPool(device, event);
   }
 
   void synchronize_and_free_events() {
@@ -971,11 +1429,11 @@ class DeviceCachingAllocator {
     insert_events_deferred_until_no_capture();
 
     for (auto& e : cuda_events) {
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
+      cudaEvent_t event = e.event;
+      Block* block = e.block;
 
       C10_CUDA_CHECK(cudaEventSynchronize(event));
-      free_event_internal(event);
+      free_event_internal(e.device, event);
 
       block->event_count--;
       if (block->event_count == 0) {
@@ -996,11 +1454,11 @@ class DeviceCachingAllocator {
     for (auto it = streams.begin(); it != streams.end(); ++it) {
       C10_CUDA_CHECK(cudaSetDevice(it->device_index()));
 
-      cudaEvent_t event = create_event_internal();
+      cudaEvent_t event = create_event_internal(it->device_index());
       C10_CUDA_CHECK(cudaEventRecord(event, it->stream()));
 
       block->event_count++;
-      cuda_events.emplace_back(event, block);
+      cuda_events.push_back({event, block, it->device_index()});
     }
 
     C10_CUDA_CHECK(cudaSetDevice(prev_device));
@@ -1027,8 +1485,8 @@ class DeviceCachingAllocator {
     // the processing of some events may be delayed.
     while (!cuda_events.empty()) {
       auto& e = cuda_events.front();
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
+      cudaEvent_t event = e.event;
+      Block* block = e.block;
 
       cudaError_t err = cudaEventQuery(event);
       if (err == cudaErrorNotReady) {
@@ -1039,7 +1497,7 @@ class DeviceCachingAllocator {
         C10_CUDA_CHECK(err);
       }
 
-      free_event_internal(event);
+      free_event_internal(e.device, event);
 
       block->event_count--;
       if (block->event_count == 0) {
@@ -1066,17 +1524,43 @@ class THCCachingAllocator {
 
  private:
 
-  std::mutex mutex;
+  // Every allocation and deallocation on every device funnels through the
+  // pointer -> Block table, so a single map and mutex would serialize all
+  // worker threads even when their work never touches the same device pool.
+  // The table is sharded by a hash of the pointer, each shard with its own
+  // mutex on its own cache line.  The per-device pool logic still takes the
+  // device mutex -- its free lists must stay coherent with the cross-stream
+  // event and graph-capture machinery -- but threads working on different
+  // devices, or just hitting different shards, no longer contend here.
+  static constexpr size_t kNumMutexShard = 67;
+
+  struct alignas(64) AlignedMutex {
+    std::mutex m;
+  };
+
+  std::array<AlignedMutex, kNumMutexShard> mutex;
 
-  // allocated blocks by device pointer
-  std::unordered_map<void*, Block*> allocated_blocks;
+  // allocated blocks by device pointer, sharded by pointer hash
+  std::array<std::unordered_map<void*, Block*>, kNumMutexShard>
+      allocated_blocks;
 
   // lock around calls to cudaFree (to prevent deadlocks with NCCL)
   mutable std::mutex cuda_free_mutex;
 
+  static size_t get_mutex_shard_id(void* ptr) {
+    // CUDA pointers are aligned to large powers of two; mix the bits so
+    // consecutive allocations spread across the shards.
+    auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr));
+    key ^= key >> 33;
+    key *= UINT64_C(0xff51afd7ed558ccd);
+    key ^= key >> 33;
+    return static_cast<size_t>(key % kNumMutexShard);
+  }
+
   void add_allocated_block(Block* block) {
-    std::lock_guard<std::mutex> lock(mutex);
-    allocated_blocks[block->ptr] = block;
+    const auto shard_id = get_mutex_shard_id(block->ptr);
+    std::lock_guard<std::mutex> lock(mutex[shard_id].m);
+    allocated_blocks[shard_id][block->ptr] = block;
   }
 
  public:
@@ -1088,14 +1572,16 @@ class THCCachingAllocator {
   }
 
   Block* get_allocated_block(void *ptr, bool remove=false) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto it = allocated_blocks.find(ptr);
-    if (it == allocated_blocks.end()) {
+    const auto shard_id = get_mutex_shard_id(ptr);
+    std::lock_guard<std::mutex> lock(mutex[shard_id].m);
+    auto& shard = allocated_blocks[shard_id];
+    auto it = shard.find(ptr);
+    if (it == shard.end()) {
       return nullptr;
     }
     Block* block = it->second;
     if (remove) {
-      allocated_blocks.erase(it);
+      shard.erase(it);
     }
     return block;
   }
@@ -1198,6 +1684,17 @@ class THCCachingAllocator {
 
     return result;
   }
+
+  std::vector<TraceEntry> snapshotTrace() {
+    std::vector<TraceEntry> result;
+    int count = device_allocator.size();
+    for (int i = 0; i < count; i++) {
+      auto trace = device_allocator[i]->trace();
+      result.insert(result.end(), trace.begin(), trace.end());
+    }
+
+    return result;
+  }
 };
 
 THCCachingAllocator caching_allocator;
@@ -1230,7 +1727,14 @@ struct CudaCachingAllocator : public Allocator {
       return {r, r, &uncached_delete, Device(DeviceType::CUDA, device)};
     }
     if (size != 0) {
-      caching_allocator.malloc(&r, device, size, cuda::getCurrentCUDAStream(device));
+      // The backend choice (see Note [cudaMallocAsync backend]) is fixed for
+      // the process; either way the pointer is freed through raw_delete.
+      if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+        CudaMallocAsync::mallocAsync(
+            &r, device, size, cuda::getCurrentCUDAStream(device));
+      } else {
+        caching_allocator.malloc(&r, device, size, cuda::getCurrentCUDAStream(device));
+      }
     }
     return {r, r, &raw_delete, Device(DeviceType::CUDA, device)};
   }
@@ -1251,28 +1755,46 @@ Allocator* get(void)
 }
 
 void init(int device_count) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::init(device_count);
+  }
   caching_allocator.init(device_count);
 }
 
 void setMemoryFraction(double fraction, int device) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::setMemoryFraction(fraction, device);
+  }
   caching_allocator.setMemoryFraction(fraction, device);
 }
 
 void emptyCache(void) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::emptyCache();
+  }
   caching_allocator.emptyCache();
 }
 
 void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::cacheInfo(dev_id, cachedAndFree, largestBlock);
+  }
   caching_allocator.device_allocator[dev_id]->cacheInfo(cachedAndFree, largestBlock);
 }
 
 void* getBaseAllocation(void *ptr, size_t *size)
 {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::getBaseAllocation(ptr, size);
+  }
   return caching_allocator.getBaseAllocation(ptr, size);
 }
 
 void recordStream(const DataPtr& ptr, cuda::CUDAStream stream)
 {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::recordStream(ptr, stream);
+  }
   caching_allocator.recordStream(ptr, stream);
 }
 
@@ -1287,28 +1809,51 @@ static inline void assertValidDevice(int device) {
 }
 
 DeviceStats getDeviceStats(int device) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::getDeviceStats(device);
+  }
   assertValidDevice(device);
   return caching_allocator.device_allocator[device]->getStats();
 }
 
 void resetAccumulatedStats(int device) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::resetAccumulatedStats(device);
+  }
   assertValidDevice(device);
   caching_allocator.device_allocator[device]->resetAccumulatedStats();
 }
 
 void resetPeakStats(int device) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::resetPeakStats(device);
+  }
   assertValidDevice(device);
   caching_allocator.device_allocator[device]->resetPeakStats();
 }
 
 std::vector<SegmentInfo> snapshot() {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::snapshot();
+  }
   return caching_allocator.snapshot();
 }
 
+std::vector<TraceEntry> snapshotTrace() {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    // The cudaMallocAsync backend does none of this allocator's bookkeeping;
+    // the pool's history lives inside the driver.
+    return {};
+  }
+  return caching_allocator.snapshotTrace();
+}
+
 // CUDAGraph interactions
 void notifyCaptureBegin(int device,
                         CaptureId_t graph_id,
                         MempoolId_t mempool_id) {
+  TORCH_CHECK(!CudaMallocAsync::enabled(),
+    "CUDA graphs are not yet supported with the cudaMallocAsync backend.");
   assertValidDevice(device);
   caching_allocator.device_allocator[device]->notifyCaptureBegin(graph_id, mempool_id);
 }
@@ -1384,6 +1929,11 @@ void* raw_alloc(size_t nbytes) {
   int device;
   C10_CUDA_CHECK(cudaGetDevice(&device));
   void* r = nullptr;
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    CudaMallocAsync::mallocAsync(
+        &r, device, nbytes, cuda::getCurrentCUDAStream(device));
+    return r;
+  }
   caching_allocator.malloc(&r, device, nbytes, cuda::getCurrentCUDAStream(device));
   return r;
 }
@@ -1395,11 +1945,18 @@ void* raw_alloc_with_stream(size_t nbytes, cudaStream_t stream) {
   int device;
   C10_CUDA_CHECK(cudaGetDevice(&device));
   void* r = nullptr;
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    CudaMallocAsync::mallocAsync(&r, device, nbytes, stream);
+    return r;
+  }
   caching_allocator.malloc(&r, device, nbytes, stream);
   return r;
 }
 
 void raw_delete(void* ptr) {
+  if (C10_UNLIKELY(CudaMallocAsync::enabled())) {
+    return CudaMallocAsync::freeAsync(ptr);
+  }
   caching_allocator.free(ptr);
 }
 
@@ -105,6 +105,25 @@ struct SegmentInfo {
   std::vector<BlockInfo> blocks;
 };
 
+// One entry of the allocator's flight recorder, a ring buffer of recent
+// allocator events kept for post-mortem debugging.
+// See Note [Allocator flight recorder].
+struct TraceEntry {
+  enum Action : uint8_t {
+    ALLOC = 0,         // a block was handed out to client code
+    FREE = 1,          // a block was returned by client code
+    SEGMENT_ALLOC = 2, // a new segment was obtained from the driver
+    SEGMENT_FREE = 3,  // a cached segment was returned to the driver
+    OOM = 4            // an allocation failed; size is the requested bytes
+  };
+  Action action = ALLOC;
+  int64_t device = 0;
+  int64_t addr = 0; // 0 for OOM entries
+  int64_t size = 0;
+  cudaStream_t stream = nullptr;
+  int64_t time_us = 0; // steady clock, microseconds
+};
+
 C10_CUDA_API void* raw_alloc(size_t nbytes);
 C10_CUDA_API void* raw_alloc_with_stream(size_t nbytes, cudaStream_t stream);
 C10_CUDA_API void raw_delete(void* ptr);
@@ -120,6 +139,7 @@ C10_CUDA_API DeviceStats getDeviceStats(int device);
 C10_CUDA_API void resetAccumulatedStats(int device);
 C10_CUDA_API void resetPeakStats(int device);
 C10_CUDA_API std::vector<SegmentInfo> snapshot();
+C10_CUDA_API std::vector<TraceEntry> snapshotTrace();
 
 // CUDAGraph interactions
 C10_CUDA_API void notifyCaptureBegin(int device,
@@ -0,0 +1,53 @@
+#include <c10/cuda/CUDAEventPool.h>
+
+#include <c10/cuda/CUDAException.h>
+#include <c10/util/Exception.h>
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace c10 {
+namespace cuda {
+
+namespace {
+
+struct EventPool {
+  std::mutex mutex;
+  std::vector<cudaEvent_t> events;
+};
+
+EventPool& poolForDevice(DeviceIndex device) {
+  // Leaked intentionally; see header.
+  static auto* pools = new std::array<EventPool, C10_COMPILE_TIME_MAX_GPUS>();
+  TORCH_INTERNAL_ASSERT(
+      device >= 0 && device < C10_COMPILE_TIME_MAX_GPUS,
+      "Invalid device index for event pool: ", device);
+  return (*pools)[device];
+}
+
+} // namespace
+
+cudaEvent_t getEventFromPool(DeviceIndex device) {
+  auto& pool = poolForDevice(device);
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (!pool.events.empty()) {
+      cudaEvent_t event = pool.events.back();
+      pool.events.pop_back();
+      return event;
+    }
+  }
+  cudaEvent_t event = nullptr;
+  C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  return event;
+}
+
+void returnEventToPool(DeviceIndex device, cudaEvent_t event) {
+  auto& pool = poolForDevice(device);
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  pool.events.push_back(event);
+}
+
+} // namespace cuda
+} // namespace c10
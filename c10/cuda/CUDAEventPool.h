@@ -0,0 +1,34 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/cuda/CUDAMacros.h>
+
+#include <cuda_runtime_api.h>
+
+namespace c10 {
+namespace cuda {
+
+// Per-device free lists of pre-created cudaEvents (cudaEventDisableTiming).
+//
+// cudaEventCreateWithFlags and cudaEventDestroy take driver locks, and the
+// hot paths that insert one event per cross-stream free or synchronization
+// point (the caching allocator, at::cuda::CUDAEvent users such as
+// ProcessGroupNCCL) were paying that cost on every event. Acquisition from
+// the pool is a pointer pop, only falling back to cudaEventCreateWithFlags
+// on an empty free list; release pushes the event back instead of
+// destroying it. Pooled events are deliberately leaked at process exit
+// (destroying them after CUDA context teardown is not safe).
+//
+// Contract:
+//  - getEventFromPool must be called with `device` current, since a miss
+//    creates the event on the current device.
+//  - events must be returned to the pool of the device they came from
+//    (cudaEventRecord requires the event and stream to share a device).
+//  - a returned event may still be pending; the next acquirer must record
+//    it (which resets its state) before querying or synchronizing on it.
+
+C10_CUDA_API cudaEvent_t getEventFromPool(DeviceIndex device);
+C10_CUDA_API void returnEventToPool(DeviceIndex device, cudaEvent_t event);
+
+} // namespace cuda
+} // namespace c10
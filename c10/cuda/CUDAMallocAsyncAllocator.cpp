@@ -0,0 +1,407 @@
+#include <c10/cuda/CUDAMallocAsyncAllocator.h>
+
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+
+#include <cuda_runtime_api.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace c10 {
+namespace cuda {
+namespace CUDACachingAllocator {
+namespace CudaMallocAsync {
+
+/**
+ * Note [cudaMallocAsync backend]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * CUDA 11.2 added stream-ordered allocation: cudaMallocAsync/cudaFreeAsync
+ * serve (and recycle) memory from a driver-managed pool, ordered with
+ * respect to the work on the allocation stream like any other stream
+ * operation. The driver pool can reassign memory between sizes and even
+ * between processes on the same device, which makes it a better fit than
+ * the built-in caching allocator for bursty, multi-tenant workloads.
+ *
+ * This backend keeps the caching allocator's contract:
+ *  - a pointer may only be assumed valid on its allocation stream, and
+ *    recordStream() declares uses on other streams. freeAsync() turns
+ *    those declarations into events the allocation stream waits on before
+ *    the stream-ordered free is issued, exactly the ordering the driver
+ *    pool needs to reuse the memory safely.
+ *  - getDeviceStats()/snapshot() stay functional: allocation counts and
+ *    bytes are tracked here, and the pool's reserved/used watermarks are
+ *    read back from the driver where the toolkit exposes them (11.3+).
+ *  - setMemoryFraction() remains a hard cap, enforced against our own
+ *    tracked usage since the driver pool has no cap of its own.
+ *
+ * CUDA graph capture (notifyCaptureBegin & friends) and tensor sharing
+ * over CUDA IPC are not supported with this backend and fail loudly.
+ *
+ * The backend is selected with PYTORCH_CUDA_ALLOC_BACKEND=cudaMallocAsync,
+ * checked once; mixing backends within a process is not possible.
+ */
+
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+
+namespace {
+
+struct PtrInfo {
+  size_t size;
+  int device;
+  cudaStream_t creation_stream;
+  // Streams recordStream() declared as users of this allocation, other
+  // than the creation stream.
+  std::vector<cudaStream_t> recorded_streams;
+};
+
+// Protects all backend state below.
+std::mutex general_mutex;
+
+std::unordered_map<void*, PtrInfo> ptr_info;
+
+int dev_count = 0;
+std::vector<bool> devs_initialized;
+std::vector<DeviceStats> device_stats;
+// Hard caps installed by setMemoryFraction (0 = uncapped).
+std::vector<size_t> device_mem_limits;
+
+void update_stat(Stat& stat, int64_t amount) {
+  stat.current += amount;
+  stat.peak = std::max(stat.current, stat.peak);
+  if (amount > 0) {
+    stat.allocated += amount;
+  } else {
+    stat.freed += -amount;
+  }
+}
+
+void assertValidDevice(int device) {
+  TORCH_CHECK(0 <= device && device < dev_count, "Invalid device argument.");
+}
+
+// Raises the driver pool's release threshold so it caches aggressively
+// instead of returning memory to the OS after every synchronize.
+void lazy_init_device(int device) {
+  if (devs_initialized[device]) {
+    return;
+  }
+  cudaMemPool_t pool = nullptr;
+  C10_CUDA_CHECK(cudaDeviceGetDefaultMemPool(&pool, device));
+  uint64_t threshold = UINT64_MAX;
+  C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+      pool, cudaMemPoolAttrReleaseThreshold, &threshold));
+  devs_initialized[device] = true;
+}
+
+} // namespace
+
+bool enabled() {
+  static const bool enabled_ = []() {
+    const char* env = std::getenv("PYTORCH_CUDA_ALLOC_BACKEND");
+    if (env == nullptr || std::strcmp(env, "cudaMallocAsync") != 0) {
+      TORCH_CHECK(
+          env == nullptr || std::strcmp(env, "native") == 0,
+          "Unknown PYTORCH_CUDA_ALLOC_BACKEND: ", env);
+      return false;
+    }
+    // The toolkit supports it; make sure the installed driver does too.
+    int driver_version = 0;
+    C10_CUDA_CHECK(cudaDriverGetVersion(&driver_version));
+    TORCH_CHECK(
+        driver_version >= 11020,
+        "PYTORCH_CUDA_ALLOC_BACKEND=cudaMallocAsync requires a CUDA 11.2+ "
+        "driver, found ", driver_version / 1000, ".", (driver_version % 100) / 10);
+    return true;
+  }();
+  return enabled_;
+}
+
+void init(int device_count) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  if (dev_count == 0) {
+    dev_count = device_count;
+    devs_initialized.resize(device_count, false);
+    device_stats.resize(device_count);
+    device_mem_limits.resize(device_count, 0);
+  }
+}
+
+void mallocAsync(void** devPtr, int device, size_t size, cudaStream_t stream) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  assertValidDevice(device);
+  lazy_init_device(device);
+
+  auto& stats = device_stats[device];
+  const size_t limit = device_mem_limits[device];
+  const size_t used = static_cast<size_t>(
+      stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)].current);
+  cudaError_t err = cudaSuccess;
+  if (limit != 0 && used + size > limit) {
+    err = cudaErrorMemoryAllocation;
+  } else {
+    err = cudaMallocAsync(devPtr, size, stream);
+  }
+
+  if (err == cudaErrorMemoryAllocation) {
+    // Clear CUDA's internal error state so the OOM is recoverable, the same
+    // way the caching allocator forgives a failed cudaMalloc.
+    cudaGetLastError();
+    size_t device_free = 0;
+    size_t device_total = 0;
+    C10_CUDA_CHECK(cudaMemGetInfo(&device_free, &device_total));
+    stats.num_ooms += 1;
+    TORCH_CHECK_WITH(CUDAOutOfMemoryError, false,
+      "CUDA out of memory. Tried to allocate ", size, " bytes (GPU ", device,
+      "; ", device_free, " bytes free; ",
+      stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
+      " bytes allocated by PyTorch; cudaMallocAsync backend)");
+  } else {
+    C10_CUDA_CHECK(err);
+  }
+
+  ptr_info.emplace(*devPtr, PtrInfo{size, device, stream, {}});
+
+  update_stat(
+      stats.allocation[static_cast<size_t>(StatType::AGGREGATE)], 1);
+  update_stat(
+      stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)], size);
+  update_stat(stats.active[static_cast<size_t>(StatType::AGGREGATE)], 1);
+  update_stat(
+      stats.active_bytes[static_cast<size_t>(StatType::AGGREGATE)], size);
+}
+
+void freeAsync(void* ptr) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  auto it = ptr_info.find(ptr);
+  TORCH_INTERNAL_ASSERT(
+      it != ptr_info.end(),
+      "freeAsync on an untracked pointer (double free?)");
+  const PtrInfo& info = it->second;
+  CUDAGuard g(info.device);
+
+  // Make the stream-ordered free wait for every recorded use, so the driver
+  // pool only reuses the memory once those streams are past it.
+  for (cudaStream_t recorded : info.recorded_streams) {
+    cudaEvent_t event = nullptr;
+    C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    C10_CUDA_CHECK(cudaEventRecord(event, recorded));
+    C10_CUDA_CHECK(cudaStreamWaitEvent(info.creation_stream, event, 0));
+    // Destruction is deferred by the driver until the event has fired.
+    C10_CUDA_CHECK(cudaEventDestroy(event));
+  }
+  C10_CUDA_CHECK(cudaFreeAsync(ptr, info.creation_stream));
+
+  auto& stats = device_stats[info.device];
+  update_stat(
+      stats.allocation[static_cast<size_t>(StatType::AGGREGATE)], -1);
+  update_stat(
+      stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)],
+      -static_cast<int64_t>(info.size));
+  update_stat(stats.active[static_cast<size_t>(StatType::AGGREGATE)], -1);
+  update_stat(
+      stats.active_bytes[static_cast<size_t>(StatType::AGGREGATE)],
+      -static_cast<int64_t>(info.size));
+  ptr_info.erase(it);
+}
+
+void recordStream(const DataPtr& ptr, CUDAStream stream) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  auto it = ptr_info.find(ptr.get());
+  TORCH_INTERNAL_ASSERT(
+      it != ptr_info.end(), "recordStream on an untracked pointer");
+  PtrInfo& info = it->second;
+  cudaStream_t s = stream.stream();
+  if (s == info.creation_stream) {
+    return;
+  }
+  auto& recorded = info.recorded_streams;
+  if (std::find(recorded.begin(), recorded.end(), s) == recorded.end()) {
+    recorded.push_back(s);
+  }
+}
+
+void setMemoryFraction(double fraction, int device) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  assertValidDevice(device);
+  TORCH_INTERNAL_ASSERT(
+      0 <= fraction && fraction <= 1,
+      "invalid fraction:", fraction, ". Please set within (0, 1).");
+  size_t device_free = 0;
+  size_t device_total = 0;
+  C10_CUDA_CHECK(cudaMemGetInfo(&device_free, &device_total));
+  device_mem_limits[device] = static_cast<size_t>(fraction * device_total);
+}
+
+void emptyCache() {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  for (int dev = 0; dev < dev_count; ++dev) {
+    if (!devs_initialized[dev]) {
+      continue;
+    }
+    cudaMemPool_t pool = nullptr;
+    C10_CUDA_CHECK(cudaDeviceGetDefaultMemPool(&pool, dev));
+    // Releases the pool's idle memory back to the OS; busy memory stays.
+    C10_CUDA_CHECK(cudaMemPoolTrimTo(pool, 0));
+  }
+}
+
+void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock) {
+  assertValidDevice(dev_id);
+  CUDAGuard g(dev_id);
+  size_t device_free = 0;
+  size_t device_total = 0;
+  C10_CUDA_CHECK(cudaMemGetInfo(&device_free, &device_total));
+  // The driver pool doesn't expose its free-list layout; report free device
+  // memory, which is what callers use this for (sizing cuFFT plan caches).
+  *cachedAndFree = device_free;
+  *largestBlock = device_free;
+}
+
+void* getBaseAllocation(void* ptr, size_t* size) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  auto it = ptr_info.find(ptr);
+  TORCH_INTERNAL_ASSERT(
+      it != ptr_info.end(), "getBaseAllocation on an untracked pointer");
+  if (size) {
+    *size = it->second.size;
+  }
+  // cudaMallocAsync allocations are never split.
+  return ptr;
+}
+
+DeviceStats getDeviceStats(int device) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  assertValidDevice(device);
+  DeviceStats stats = device_stats[device];
+#if CUDA_VERSION >= 11030
+  // Reserved/used watermarks live in the driver pool.
+  if (devs_initialized[device]) {
+    cudaMemPool_t pool = nullptr;
+    C10_CUDA_CHECK(cudaDeviceGetDefaultMemPool(&pool, device));
+    uint64_t reserved_current = 0;
+    uint64_t reserved_peak = 0;
+    C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+        pool, cudaMemPoolAttrReservedMemCurrent, &reserved_current));
+    C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+        pool, cudaMemPoolAttrReservedMemHigh, &reserved_peak));
+    auto& reserved =
+        stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)];
+    reserved.current = static_cast<int64_t>(reserved_current);
+    reserved.peak = static_cast<int64_t>(reserved_peak);
+  }
+#endif
+  return stats;
+}
+
+void resetAccumulatedStats(int device) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  assertValidDevice(device);
+  for (auto& stat_array :
+       {&device_stats[device].allocation,
+        &device_stats[device].allocated_bytes,
+        &device_stats[device].active,
+        &device_stats[device].active_bytes}) {
+    for (auto& stat : *stat_array) {
+      stat.allocated = 0;
+      stat.freed = 0;
+    }
+  }
+  device_stats[device].num_alloc_retries = 0;
+  device_stats[device].num_ooms = 0;
+}
+
+void resetPeakStats(int device) {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  assertValidDevice(device);
+  for (auto& stat_array :
+       {&device_stats[device].allocation,
+        &device_stats[device].allocated_bytes,
+        &device_stats[device].active,
+        &device_stats[device].active_bytes}) {
+    for (auto& stat : *stat_array) {
+      stat.peak = stat.current;
+    }
+  }
+#if CUDA_VERSION >= 11030
+  if (devs_initialized[device]) {
+    cudaMemPool_t pool = nullptr;
+    C10_CUDA_CHECK(cudaDeviceGetDefaultMemPool(&pool, device));
+    uint64_t zero = 0;
+    C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+        pool, cudaMemPoolAttrReservedMemHigh, &zero));
+    C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+        pool, cudaMemPoolAttrUsedMemHigh, &zero));
+  }
+#endif
+}
+
+std::vector<SegmentInfo> snapshot() {
+  std::lock_guard<std::mutex> lk(general_mutex);
+  // The pool's internal segments aren't visible; report each live
+  // allocation as its own fully-allocated segment.
+  std::vector<SegmentInfo> result;
+  result.reserve(ptr_info.size());
+  for (const auto& entry : ptr_info) {
+    SegmentInfo segment;
+    segment.device = entry.second.device;
+    segment.address = reinterpret_cast<int64_t>(entry.first);
+    segment.total_size = static_cast<int64_t>(entry.second.size);
+    segment.allocated_size = segment.total_size;
+    segment.active_size = segment.total_size;
+    segment.is_large = true;
+    BlockInfo block;
+    block.size = segment.total_size;
+    block.allocated = true;
+    block.active = true;
+    segment.blocks.push_back(block);
+    result.push_back(std::move(segment));
+  }
+  return result;
+}
+
+#else // CUDA_VERSION < 11020
+
+namespace {
+[[noreturn]] void not_supported() {
+  TORCH_CHECK(false,
+    "PYTORCH_CUDA_ALLOC_BACKEND=cudaMallocAsync requires PyTorch built "
+    "against CUDA 11.2 or newer.");
+}
+} // namespace
+
+bool enabled() {
+  static const bool enabled_ = []() {
+    const char* env = std::getenv("PYTORCH_CUDA_ALLOC_BACKEND");
+    if (env != nullptr && std::strcmp(env, "cudaMallocAsync") == 0) {
+      not_supported();
+    }
+    return false;
+  }();
+  return enabled_;
+}
+
+void mallocAsync(void**, int, size_t, cudaStream_t) { not_supported(); }
+void freeAsync(void*) { not_supported(); }
+void init(int) { not_supported(); }
+void setMemoryFraction(double, int) { not_supported(); }
+void emptyCache() { not_supported(); }
+void cacheInfo(int, size_t*, size_t*) { not_supported(); }
+void* getBaseAllocation(void*, size_t*) { not_supported(); }
+void recordStream(const DataPtr&, CUDAStream) { not_supported(); }
+DeviceStats getDeviceStats(int) { not_supported(); }
+void resetAccumulatedStats(int) { not_supported(); }
+void resetPeakStats(int) { not_supported(); }
+std::vector<SegmentInfo> snapshot() { not_supported(); }
+
+#endif
+
+} // namespace CudaMallocAsync
+} // namespace CUDACachingAllocator
+} // namespace cuda
+} // namespace c10
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <c10/cuda/CUDACachingAllocator.h>
+
+namespace c10 {
+namespace cuda {
+namespace CUDACachingAllocator {
+
+// Alternative allocator backend built on CUDA 11.2's stream-ordered
+// cudaMallocAsync/cudaFreeAsync driver pools, selected with
+// PYTORCH_CUDA_ALLOC_BACKEND=cudaMallocAsync. The public functions in
+// CUDACachingAllocator.h route here when the backend is enabled; see
+// Note [cudaMallocAsync backend] in CUDAMallocAsyncAllocator.cpp.
+namespace CudaMallocAsync {
+
+// True if PYTORCH_CUDA_ALLOC_BACKEND selects this backend. Throws if the
+// backend is requested but this build or the installed driver can't
+// provide it.
+C10_CUDA_API bool enabled();
+
+C10_CUDA_API void mallocAsync(
+    void** devPtr,
+    int device,
+    size_t size,
+    cudaStream_t stream);
+C10_CUDA_API void freeAsync(void* ptr);
+
+C10_CUDA_API void init(int device_count);
+C10_CUDA_API void setMemoryFraction(double fraction, int device);
+C10_CUDA_API void emptyCache();
+C10_CUDA_API void cacheInfo(
+    int dev_id,
+    size_t* cachedAndFree,
+    size_t* largestBlock);
+C10_CUDA_API void* getBaseAllocation(void* ptr, size_t* size);
+C10_CUDA_API void recordStream(const DataPtr& ptr, CUDAStream stream);
+C10_CUDA_API DeviceStats getDeviceStats(int device);
+C10_CUDA_API void resetAccumulatedStats(int device);
+C10_CUDA_API void resetPeakStats(int device);
+C10_CUDA_API std::vector<SegmentInfo> snapshot();
+
+} // namespace CudaMallocAsync
+} // namespace CUDACachingAllocator
+} // namespace cuda
+} // namespace c10
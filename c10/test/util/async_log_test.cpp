@@ -0,0 +1,50 @@
+#include <c10/util/AsyncLog.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(AsyncLogTest, ConcurrentEnqueueDoesNotLoseOrCrash) {
+  constexpr int kThreads = 8;
+  constexpr int kMessagesPerThread = 100;
+  std::vector<std::thread> threads;
+  threads.reserve(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < kMessagesPerThread; ++i) {
+        C10_LOG_ASYNC("async_log_test thread ", t, " message ", i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  c10::FlushAsyncLog();
+}
+
+TEST(AsyncLogTest, CounterBumpsAreCheapAndVisible) {
+  c10::detail::AsyncLogCounter counter("async_log_test_counter");
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&counter]() {
+      for (int i = 0; i < 1000; ++i) {
+        counter.bump(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.value(), 4000);
+
+  // The macro form registers a static counter on first use.
+  for (int i = 0; i < 3; ++i) {
+    C10_BUMP_COUNTER(async_log_test_macro_counter);
+  }
+  c10::FlushAsyncLog();
+}
+
+} // namespace
@@ -0,0 +1,158 @@
+#include <c10/util/AsyncLog.h>
+#include <c10/util/Flags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_int(
+    caffe2_async_log_flush_interval_ms,
+    100,
+    "How often the background flusher writes out queued async log messages.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_int(
+    caffe2_async_log_counter_interval_ms,
+    60000,
+    "How often async log counters are dumped; 0 dumps them only at shutdown.");
+
+namespace c10 {
+namespace {
+
+struct MessageNode {
+  MessageNode* next;
+  std::string message;
+};
+
+class AsyncLogger {
+ public:
+  static AsyncLogger& instance() {
+    // Deliberately leaked: counters and messages may arrive from static
+    // destructors in arbitrary TU order, so the logger must outlive them
+    // all. The atexit hook below still gets a final flush out.
+    static AsyncLogger* logger = new AsyncLogger();
+    return *logger;
+  }
+
+  void enqueue(std::string message) {
+    auto* node = new MessageNode{nullptr, std::move(message)};
+    // Lock-free MPSC push onto a Treiber stack; the flusher reverses each
+    // drained batch to restore submission order.
+    node->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(
+        node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  void registerCounter(detail::AsyncLogCounter* counter) {
+    std::lock_guard<std::mutex> guard(counters_mutex_);
+    counters_.push_back(counter);
+  }
+
+  void unregisterCounter(detail::AsyncLogCounter* counter) {
+    std::lock_guard<std::mutex> guard(counters_mutex_);
+    counters_.erase(
+        std::remove(counters_.begin(), counters_.end(), counter),
+        counters_.end());
+  }
+
+  void flush() {
+    std::lock_guard<std::mutex> guard(flush_mutex_);
+    drainMessages();
+    dumpCounters();
+  }
+
+  AsyncLogger(const AsyncLogger&) = delete;
+  AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+ private:
+  AsyncLogger() {
+    flusher_ = std::thread([this]() { flusherLoop(); });
+    flusher_.detach();
+    std::atexit([]() { AsyncLogger::instance().flush(); });
+  }
+
+  void flusherLoop() {
+    const auto flush_interval =
+        std::chrono::milliseconds(FLAGS_caffe2_async_log_flush_interval_ms);
+    const auto counter_interval =
+        std::chrono::milliseconds(FLAGS_caffe2_async_log_counter_interval_ms);
+    auto last_counter_dump = std::chrono::steady_clock::now();
+    while (true) {
+      std::this_thread::sleep_for(flush_interval);
+      std::lock_guard<std::mutex> guard(flush_mutex_);
+      drainMessages();
+      const auto now = std::chrono::steady_clock::now();
+      if (counter_interval.count() > 0 &&
+          now - last_counter_dump >= counter_interval) {
+        dumpCounters();
+        last_counter_dump = now;
+      }
+    }
+  }
+
+  void drainMessages() {
+    MessageNode* node = head_.exchange(nullptr, std::memory_order_acquire);
+    // The stack yields newest-first; reverse to write in submission order.
+    MessageNode* reversed = nullptr;
+    while (node) {
+      MessageNode* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    while (reversed) {
+      fprintf(stderr, "%s\n", reversed->message.c_str());
+      MessageNode* next = reversed->next;
+      delete reversed;
+      reversed = next;
+    }
+  }
+
+  void dumpCounters() {
+    std::lock_guard<std::mutex> guard(counters_mutex_);
+    for (auto* counter : counters_) {
+      fprintf(
+          stderr,
+          "[async-log counter] %s = %llu\n",
+          counter->name(),
+          static_cast<unsigned long long>(counter->value()));
+    }
+  }
+
+  std::atomic<MessageNode*> head_{nullptr};
+  std::vector<detail::AsyncLogCounter*> counters_;
+  std::mutex counters_mutex_;
+  // Serializes the periodic flusher against explicit FlushAsyncLog calls.
+  std::mutex flush_mutex_;
+  std::thread flusher_;
+};
+
+} // namespace
+
+void LogAsync(std::string message) {
+  AsyncLogger::instance().enqueue(std::move(message));
+}
+
+void FlushAsyncLog() {
+  AsyncLogger::instance().flush();
+}
+
+namespace detail {
+
+AsyncLogCounter::AsyncLogCounter(const char* name) : name_(name) {
+  AsyncLogger::instance().registerCounter(this);
+}
+
+AsyncLogCounter::~AsyncLogCounter() {
+  AsyncLogger::instance().unregisterCounter(this);
+}
+
+} // namespace detail
+} // namespace c10
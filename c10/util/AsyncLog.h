@@ -0,0 +1,80 @@
+#ifndef C10_UTIL_ASYNCLOG_H_
+#define C10_UTIL_ASYNCLOG_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <c10/macros/Macros.h>
+#include <c10/util/StringUtil.h>
+
+// Low-overhead diagnostics for hot paths.
+//
+// LOG() writes to stderr synchronously under a lock, so a log statement in a
+// kernel-adjacent path (allocator, reducer, ...) stalls the op. Two cheaper
+// alternatives live here:
+//
+//  - C10_LOG_ASYNC(...) formats the message on the calling thread but hands
+//    it to a background flusher over a lock-free MPSC stack, so the hot path
+//    pays one allocation and one compare-exchange, never a write(2).
+//  - C10_BUMP_COUNTER(name) is for telemetry too frequent to log at all: it
+//    is a single relaxed atomic increment of a named process-wide counter.
+//    The flusher dumps all counters periodically (and once at shutdown), so
+//    the data still reaches the logs.
+//
+// Messages can be dropped if the process dies before the flusher runs; this
+// is a diagnostics channel, not an audit trail.
+
+namespace c10 {
+
+/// Queues a preformatted message for the background flusher. Non-blocking
+/// apart from one heap allocation; safe to call from any thread.
+C10_API void LogAsync(std::string message);
+
+/// Drains all queued messages and dumps the counters now. Mainly for tests
+/// and shutdown hooks; the background flusher makes this unnecessary in
+/// steady state.
+C10_API void FlushAsyncLog();
+
+namespace detail {
+
+class C10_API AsyncLogCounter {
+ public:
+  explicit AsyncLogCounter(const char* name);
+  ~AsyncLogCounter();
+  AsyncLogCounter(const AsyncLogCounter&) = delete;
+  AsyncLogCounter& operator=(const AsyncLogCounter&) = delete;
+  void bump(uint64_t delta) {
+    value_.fetch_add(delta, std::memory_order_relaxed);
+  }
+  const char* name() const {
+    return name_;
+  }
+  uint64_t value() const {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const char* name_;
+  std::atomic<uint64_t> value_{0};
+};
+
+} // namespace detail
+} // namespace c10
+
+/// Formats its arguments with c10::str and queues the result; the calling
+/// thread never blocks on I/O.
+#define C10_LOG_ASYNC(...) ::c10::LogAsync(::c10::str(__VA_ARGS__))
+
+/// Increments the named process-wide counter by `delta`. The counter is
+/// registered on first execution of the statement; every later execution is
+/// a single relaxed atomic add.
+#define C10_BUMP_COUNTER_BY(name, delta)                          \
+  do {                                                            \
+    static ::c10::detail::AsyncLogCounter _c10_counter_(#name);   \
+    _c10_counter_.bump(delta);                                    \
+  } while (0)
+
+#define C10_BUMP_COUNTER(name) C10_BUMP_COUNTER_BY(name, 1)
+
+#endif // C10_UTIL_ASYNCLOG_H_
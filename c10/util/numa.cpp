@@ -95,6 +95,26 @@ void NUMAMove(void* ptr, size_t size, int numa_node_id) {
       "Could not move memory to a NUMA node");
 }
 
+void NUMAInterleave(void* ptr, size_t size) {
+  if (!IsNUMAEnabled()) {
+    return;
+  }
+  AT_ASSERT(ptr);
+
+  uintptr_t page_start_ptr =
+      ((reinterpret_cast<uintptr_t>(ptr)) & ~(getpagesize() - 1));
+  ptrdiff_t offset = reinterpret_cast<uintptr_t>(ptr) - page_start_ptr;
+  TORCH_CHECK(
+      mbind(
+          reinterpret_cast<void*>(page_start_ptr),
+          size + offset,
+          MPOL_INTERLEAVE,
+          numa_all_nodes_ptr->maskp,
+          numa_all_nodes_ptr->size + 1,
+          MPOL_MF_MOVE | MPOL_MF_STRICT) == 0,
+      "Could not interleave memory across NUMA nodes");
+}
+
 int GetCurrentNUMANode() {
   if (!IsNUMAEnabled()) {
     return -1;
@@ -124,6 +144,9 @@ int GetNumNUMANodes() {
 void NUMAMove(void* ptr, size_t size, int numa_node_id) {
 }
 
+void NUMAInterleave(void* ptr, size_t size) {
+}
+
 int GetCurrentNUMANode() {
   return -1;
 }
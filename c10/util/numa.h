@@ -32,6 +32,12 @@ C10_API int GetNumNUMANodes();
  */
 C10_API void NUMAMove(void* ptr, size_t size, int numa_node_id);
 
+/**
+ * Interleave the memory pointed to by `ptr` of a given size page by page
+ * across all NUMA nodes
+ */
+C10_API void NUMAInterleave(void* ptr, size_t size);
+
 /**
  * Get the current NUMA node id
  */
@@ -1,14 +1,83 @@
 #include "miniz.h"
-#include <iostream>
 
 #include "caffe2/serialize/crc_alt.h"
 
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// CRC32 over one contiguous chunk. ARMv8's CRC32 instructions implement the
+// zip polynomial directly (unlike SSE4.2's crc32, which is CRC-32C), so use
+// them when the compiler targets them; otherwise fall back to the
+// slicing-by-16 table implementation.
+uint32_t crc32_chunk(const uint8_t* data, size_t length, uint32_t crc) {
+#if defined(__ARM_FEATURE_CRC32)
+  crc = ~crc;
+  while (length >= 8) {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    crc = __crc32d(crc, word);
+    data += 8;
+    length -= 8;
+  }
+  while (length-- > 0) {
+    crc = __crc32b(crc, *data++);
+  }
+  return ~crc;
+#else
+  return crc32_fast(data, length, crc);
+#endif
+}
+
+// Below this per-thread size the thread launch overhead outweighs the win.
+constexpr size_t kParallelCrcMinLength = 1 << 20; // 1 MiB
+
+// Large buffers (multi-gigabyte tensor records, in practice) are split into
+// one contiguous chunk per thread and the per-chunk CRCs are merged with
+// crc32_combine.
+uint32_t crc32_parallel(const uint8_t* data, size_t length, uint32_t crc) {
+  size_t nthreads = std::min<size_t>(
+      std::thread::hardware_concurrency(), length / kParallelCrcMinLength);
+  if (nthreads <= 1) {
+    return crc32_chunk(data, length, crc);
+  }
+  size_t chunk_size = (length + nthreads - 1) / nthreads;
+  std::vector<uint32_t> crcs(nthreads);
+  std::vector<size_t> lengths(nthreads);
+  std::vector<std::thread> threads;
+  threads.reserve(nthreads);
+  for (size_t t = 0; t < nthreads; ++t) {
+    size_t start = t * chunk_size;
+    lengths[t] = std::min(chunk_size, length - start);
+    threads.emplace_back([&, t, start]() {
+      crcs[t] = crc32_chunk(data + start, lengths[t], t == 0 ? crc : 0);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  uint32_t result = crcs[0];
+  for (size_t t = 1; t < nthreads; ++t) {
+    result = crc32_combine(result, crcs[t], lengths[t]);
+  }
+  return result;
+}
+
+} // namespace
+
 extern "C" {
 // See: miniz.h
 #if defined(USE_EXTERNAL_MZCRC)
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8* ptr, size_t buf_len) {
-  auto z = crc32_fast(ptr, buf_len, crc);
-  return z;
+  return crc32_parallel(ptr, buf_len, static_cast<uint32_t>(crc));
 };
 #endif
 }
@@ -2,9 +2,22 @@
 #include <c10/util/Exception.h>
 #include "caffe2/core/common.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
 namespace caffe2 {
 namespace serialize {
 
+#ifdef _WIN32
+
 FileAdapter::FileAdapter(const std::string& file_name) {
   file_stream_.open(file_name, std::ifstream::in | std::ifstream::binary);
   if (!file_stream_) {
@@ -22,8 +35,129 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
   return istream_adapter_->read(pos, buf, n, what);
 }
 
+bool FileAdapter::supportsConcurrentReads() const {
+  return false;
+}
+
 // NOLINTNEXTLINE(modernize-use-equals-default)
 FileAdapter::~FileAdapter() {}
 
+#else
+
+FileAdapter::FileAdapter(const std::string& file_name) {
+  fd_ = open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd_ == -1) {
+    AT_ERROR("open file failed, file path: ", file_name);
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  struct stat file_stat;
+  if (fstat(fd_, &file_stat) == -1) {
+    close(fd_);
+    fd_ = -1;
+    AT_ERROR("stat file failed, file path: ", file_name);
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+}
+
+size_t FileAdapter::size() const {
+  return size_;
+}
+
+size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
+    const {
+  char* out = static_cast<char*>(buf);
+  size_t total = 0;
+  while (total < n) {
+    ssize_t ret = pread(fd_, out + total, n - total, pos + total);
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      AT_ERROR("file reader failed: ", what, ".");
+    }
+    total += ret;
+  }
+  return n;
+}
+
+bool FileAdapter::supportsConcurrentReads() const {
+  return true;
+}
+
+FileAdapter::~FileAdapter() {
+  if (fd_ != -1) {
+    close(fd_);
+  }
+}
+
+#endif // _WIN32
+
+std::unique_ptr<MemoryMappedFileAdapter> MemoryMappedFileAdapter::tryCreate(
+    const std::string& file_name) {
+#ifdef _WIN32
+  (void)file_name;
+  return nullptr;
+#else
+  int fd = open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    return nullptr;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == -1 || file_stat.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+  auto size = static_cast<size_t>(file_stat.st_size);
+  // A private mapping keeps clean pages shared across processes while making
+  // the region writable copy-on-write, so slices of it can back mutable
+  // tensor storages.
+  void* data =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  // The mapping holds its own reference to the file; the descriptor is no
+  // longer needed.
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::unique_ptr<MemoryMappedFileAdapter>(
+      new MemoryMappedFileAdapter(data, size));
+#endif
+}
+
+MemoryMappedFileAdapter::MemoryMappedFileAdapter(void* data, size_t size)
+    : data_(data), size_(size) {}
+
+size_t MemoryMappedFileAdapter::size() const {
+  return size_;
+}
+
+size_t MemoryMappedFileAdapter::read(
+    uint64_t pos,
+    void* buf,
+    size_t n,
+    const char* what) const {
+  if (pos >= size_) {
+    AT_ERROR("position ", pos, " is out of bounds, ", what);
+  }
+  n = std::min(n, size_ - static_cast<size_t>(pos));
+  memcpy(buf, static_cast<char*>(data_) + pos, n);
+  return n;
+}
+
+void* MemoryMappedFileAdapter::mappedData() const {
+  return data_;
+}
+
+bool MemoryMappedFileAdapter::supportsConcurrentReads() const {
+  return true;
+}
+
+MemoryMappedFileAdapter::~MemoryMappedFileAdapter() {
+#ifndef _WIN32
+  munmap(data_, size_);
+#endif
+}
+
 } // namespace serialize
 } // namespace caffe2
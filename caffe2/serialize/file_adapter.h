@@ -17,11 +17,45 @@ class TORCH_API FileAdapter final : public ReadAdapterInterface {
   size_t size() const override;
   size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const override;
+  bool supportsConcurrentReads() const override;
   ~FileAdapter();
 
  private:
+  // On POSIX the file is read with pread(2), which carries its own offset, so
+  // reads are thread-safe; on Windows we fall back to a seeking stream.
+#ifdef _WIN32
   std::ifstream file_stream_;
   std::unique_ptr<IStreamAdapter> istream_adapter_;
+#else
+  int fd_ = -1;
+  size_t size_ = 0;
+#endif
+};
+
+// A read adapter backed by a private (copy-on-write) memory mapping of the
+// whole file. PyTorchStreamReader serves stored (uncompressed) records
+// directly out of the mapping without allocating or copying; see
+// PyTorchStreamReader::getRecord. Clean pages are shared with every other
+// process that maps the same file.
+class TORCH_API MemoryMappedFileAdapter final : public ReadAdapterInterface {
+ public:
+  C10_DISABLE_COPY_AND_ASSIGN(MemoryMappedFileAdapter);
+  // Returns nullptr if the file cannot be memory-mapped (e.g. on Windows, or
+  // for files that cannot be opened); callers should fall back to
+  // FileAdapter.
+  static std::unique_ptr<MemoryMappedFileAdapter> tryCreate(
+      const std::string& file_name);
+  size_t size() const override;
+  size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
+      const override;
+  void* mappedData() const override;
+  bool supportsConcurrentReads() const override;
+  ~MemoryMappedFileAdapter() override;
+
+ private:
+  MemoryMappedFileAdapter(void* data, size_t size);
+  void* data_;
+  size_t size_;
 };
 
 } // namespace serialize
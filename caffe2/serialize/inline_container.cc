@@ -19,9 +19,208 @@
 
 #include "miniz.h"
 
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
 namespace caffe2 {
 namespace serialize {
 
+namespace {
+// Zstd records are stored (uncompressed, as far as the zip format is
+// concerned) entries whose payload is this marker, the original size as a
+// little-endian uint64, and a sequence of independent zstd frames, one per
+// chunk. Independent frames let both compression and decompression run one
+// chunk per thread. The marker is how the reader detects the codec; a stored
+// record whose first eight bytes happen to collide with it would be
+// misdetected, but tensor data starting with this exact byte string is not a
+// practical concern.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+constexpr char kZstdRecordMagic[8] =
+    {'P', 'T', 'Z', 'S', 'T', 'D', '\0', '\x01'};
+constexpr size_t kZstdRecordHeaderSize =
+    sizeof(kZstdRecordMagic) + sizeof(uint64_t);
+
+bool isZstdRecord(const void* data, size_t size) {
+  return size >= kZstdRecordHeaderSize &&
+      memcmp(data, kZstdRecordMagic, sizeof(kZstdRecordMagic)) == 0;
+}
+
+// Runs body(0) .. body(njobs - 1) across up to hardware_concurrency
+// threads, rethrowing the first exception on the calling thread.
+void forEachInParallel(size_t njobs, const std::function<void(size_t)>& body) {
+  size_t nthreads = std::min<size_t>(
+      njobs, std::max(1u, std::thread::hardware_concurrency()));
+  if (nthreads <= 1) {
+    for (size_t i = 0; i < njobs; ++i) {
+      body(i);
+    }
+    return;
+  }
+  std::atomic<size_t> next(0);
+  std::mutex error_guard;
+  std::exception_ptr error;
+  std::vector<std::thread> threads;
+  threads.reserve(nthreads);
+  for (size_t t = 0; t < nthreads; ++t) {
+    threads.emplace_back([&]() {
+      while (true) {
+        size_t i = next.fetch_add(1);
+        if (i >= njobs) {
+          return;
+        }
+        try {
+          body(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> guard(error_guard);
+          if (!error) {
+            error = std::current_exception();
+          }
+          return;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+#ifdef USE_ZSTD
+constexpr size_t kZstdChunkSize = 1ull << 23; // 8 MiB per chunk
+constexpr int kZstdCompressionLevel = 3;
+
+std::string zstdCompressRecord(const void* data, size_t size) {
+  size_t nchunks = (size + kZstdChunkSize - 1) / kZstdChunkSize;
+  std::vector<std::string> chunks(nchunks);
+  forEachInParallel(nchunks, [&](size_t i) {
+    size_t src_offset = i * kZstdChunkSize;
+    size_t src_size = std::min(kZstdChunkSize, size - src_offset);
+    chunks[i].resize(ZSTD_compressBound(src_size));
+    size_t ret = ZSTD_compress(
+        &chunks[i][0],
+        chunks[i].size(),
+        static_cast<const char*>(data) + src_offset,
+        src_size,
+        kZstdCompressionLevel);
+    if (ZSTD_isError(ret)) {
+      CAFFE_THROW("zstd compression failed: ", ZSTD_getErrorName(ret));
+    }
+    chunks[i].resize(ret);
+  });
+  std::string result(kZstdRecordMagic, sizeof(kZstdRecordMagic));
+  for (int shift = 0; shift < 64; shift += 8) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    result.push_back(static_cast<char>((static_cast<uint64_t>(size) >> shift) & 0xff));
+  }
+  for (const auto& chunk : chunks) {
+    result.append(chunk);
+  }
+  return result;
+}
+
+void zstdDecompressRecord(
+    const void* src,
+    size_t src_size,
+    void* dst,
+    size_t dst_size,
+    const char* name) {
+  // Walk the frame headers serially to lay out the chunks, then decompress
+  // them in parallel.
+  struct Chunk {
+    size_t src_offset;
+    size_t src_size;
+    size_t dst_offset;
+    size_t dst_size;
+  };
+  std::vector<Chunk> chunks;
+  size_t src_offset = kZstdRecordHeaderSize;
+  size_t dst_offset = 0;
+  while (src_offset < src_size) {
+    const char* frame = static_cast<const char*>(src) + src_offset;
+    size_t frame_size = ZSTD_findFrameCompressedSize(frame, src_size - src_offset);
+    if (ZSTD_isError(frame_size)) {
+      CAFFE_THROW(
+          "corrupt zstd frame in record ",
+          name,
+          ": ",
+          ZSTD_getErrorName(frame_size));
+    }
+    auto content_size = ZSTD_getFrameContentSize(frame, frame_size);
+    if (content_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        content_size == ZSTD_CONTENTSIZE_ERROR ||
+        dst_offset + content_size > dst_size) {
+      CAFFE_THROW("corrupt zstd frame in record ", name);
+    }
+    chunks.push_back(
+        {src_offset, frame_size, dst_offset, static_cast<size_t>(content_size)});
+    src_offset += frame_size;
+    dst_offset += content_size;
+  }
+  TORCH_CHECK(
+      dst_offset == dst_size,
+      "zstd record ",
+      name,
+      " decompressed to ",
+      dst_offset,
+      " bytes, expected ",
+      dst_size);
+  forEachInParallel(chunks.size(), [&](size_t i) {
+    const auto& chunk = chunks[i];
+    size_t ret = ZSTD_decompress(
+        static_cast<char*>(dst) + chunk.dst_offset,
+        chunk.dst_size,
+        static_cast<const char*>(src) + chunk.src_offset,
+        chunk.src_size);
+    if (ZSTD_isError(ret) || ret != chunk.dst_size) {
+      CAFFE_THROW(
+          "zstd decompression of record ",
+          name,
+          " failed: ",
+          ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "short output");
+    }
+  });
+}
+#endif // USE_ZSTD
+
+// Decodes the uncompressed size from a zstd record header and decompresses
+// the payload into freshly allocated memory.
+std::tuple<at::DataPtr, size_t> decompressZstdRecord(
+    const void* data,
+    size_t size,
+    const char* name) {
+#ifdef USE_ZSTD
+  uint64_t uncomp_size = 0;
+  const auto* header =
+      reinterpret_cast<const uint8_t*>(data) + sizeof(kZstdRecordMagic);
+  for (int shift = 0; shift < 64; shift += 8) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    uncomp_size |= static_cast<uint64_t>(header[shift / 8]) << shift;
+  }
+  at::DataPtr retval = c10::GetCPUAllocator()->allocate(uncomp_size);
+  zstdDecompressRecord(data, size, retval.get(), uncomp_size, name);
+  return std::make_tuple(std::move(retval), uncomp_size);
+#else
+  (void)data;
+  (void)size;
+  CAFFE_THROW(
+      "record ",
+      name,
+      " is zstd-compressed, but this build of PyTorch does not support zstd "
+      "(USE_ZSTD=OFF)");
+#endif
+}
+} // namespace
+
 size_t istream_read_func(void *pOpaque, mz_uint64 file_ofs, void *pBuf, size_t n) {
   auto self = static_cast<PyTorchStreamReader*>(pOpaque);
   return self->read(file_ofs, static_cast<char*>(pBuf), n);
@@ -254,33 +453,174 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+
+  // Serve stored (uncompressed) records straight out of a memory-mapped
+  // archive instead of copying them into freshly allocated memory. Files
+  // produced by PyTorchStreamWriter store everything uncompressed with the
+  // data 64-byte aligned, so tensor reads take this path. The returned
+  // DataPtr shares ownership of the adapter, so it stays valid even if this
+  // reader is destroyed first.
+  void* mapped = in_->mappedData();
+  if (mapped != nullptr && stat.m_method == 0 /* stored, no compression */) {
+    size_t data_offset = getRecordDataOffset(stat.m_local_header_ofs);
+    TORCH_CHECK(
+        data_offset + stat.m_uncomp_size <= in_->size(),
+        "record ",
+        name,
+        " extends past the end of the archive");
+    char* record_data = static_cast<char*>(mapped) + data_offset;
+    if (isZstdRecord(record_data, stat.m_uncomp_size)) {
+      return decompressZstdRecord(
+          record_data, stat.m_uncomp_size, name.c_str());
+    }
+    auto* ctx = new std::shared_ptr<ReadAdapterInterface>(in_);
+    at::DataPtr retval(
+        record_data,
+        ctx,
+        [](void* ctx) {
+          delete static_cast<std::shared_ptr<ReadAdapterInterface>*>(ctx);
+        },
+        at::kCPU);
+    return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+  }
+
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
 
+  // Zstd records are stored entries as far as the zip format is concerned,
+  // so extraction above copied the compressed payload verbatim.
+  if (stat.m_method == 0 && isZstdRecord(retval.get(), stat.m_uncomp_size)) {
+    return decompressZstdRecord(retval.get(), stat.m_uncomp_size, name.c_str());
+  }
+
   return std::make_tuple(std::move(retval), stat.m_uncomp_size);
 }
 
+std::vector<std::tuple<at::DataPtr, size_t>> PyTorchStreamReader::getRecords(
+    const std::vector<std::string>& names) {
+  auto futures = getRecordsAsync(names);
+  std::vector<std::tuple<at::DataPtr, size_t>> result;
+  result.reserve(futures.size());
+  for (auto& future : futures) {
+    result.push_back(future.get());
+  }
+  return result;
+}
+
+std::vector<std::future<std::tuple<at::DataPtr, size_t>>>
+PyTorchStreamReader::getRecordsAsync(const std::vector<std::string>& names) {
+  // Stored records can bypass miniz (whose archive state is what forces the
+  // reader lock) and be fetched with concurrent positional reads when the
+  // adapter allows it. Everything else needs the archive state and so is
+  // fulfilled synchronously below; in particular, memory-mapped archives are
+  // already zero-copy there.
+  struct StoredRecord {
+    size_t index;
+    size_t data_offset;
+    size_t size;
+  };
+  auto promises = std::make_shared<
+      std::vector<std::promise<std::tuple<at::DataPtr, size_t>>>>(names.size());
+  std::vector<std::future<std::tuple<at::DataPtr, size_t>>> futures;
+  futures.reserve(names.size());
+  for (auto& promise : *promises) {
+    futures.push_back(promise.get_future());
+  }
+  auto stored = std::make_shared<std::vector<StoredRecord>>();
+  std::vector<size_t> serial;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    const bool concurrent =
+        in_->supportsConcurrentReads() && in_->mappedData() == nullptr;
+    for (size_t i = 0; i < names.size(); ++i) {
+      if (!concurrent) {
+        serial.push_back(i);
+        continue;
+      }
+      size_t key = getRecordID(names[i]);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), key, &stat);
+      valid("retrieving file meta-data for ", names[i].c_str());
+      if (stat.m_method == 0) {
+        stored->push_back(
+            {i,
+             getRecordDataOffset(stat.m_local_header_ofs),
+             static_cast<size_t>(stat.m_uncomp_size)});
+      } else {
+        serial.push_back(i);
+      }
+    }
+  }
+  for (size_t i : serial) {
+    try {
+      (*promises)[i].set_value(getRecord(names[i]));
+    } catch (...) {
+      (*promises)[i].set_exception(std::current_exception());
+    }
+  }
+  // The workers capture the adapter (not `this`), so in-flight reads remain
+  // valid if the reader is destroyed while futures are still pending.
+  size_t nthreads = std::min<size_t>(
+      stored->size(), std::max(1u, std::thread::hardware_concurrency()));
+  auto record_names = std::make_shared<std::vector<std::string>>(names);
+  auto next = std::make_shared<std::atomic<size_t>>(0);
+  auto in = in_;
+  for (size_t t = 0; t < nthreads; ++t) {
+    std::thread([promises, stored, record_names, next, in]() {
+      while (true) {
+        size_t j = next->fetch_add(1);
+        if (j >= stored->size()) {
+          return;
+        }
+        const auto& record = (*stored)[j];
+        try {
+          at::DataPtr data = c10::GetCPUAllocator()->allocate(record.size);
+          in->read(
+              record.data_offset, data.get(), record.size, "reading record");
+          if (isZstdRecord(data.get(), record.size)) {
+            (*promises)[record.index].set_value(decompressZstdRecord(
+                data.get(), record.size, (*record_names)[record.index].c_str()));
+          } else {
+            (*promises)[record.index].set_value(
+                std::make_tuple(std::move(data), record.size));
+          }
+        } catch (...) {
+          (*promises)[record.index].set_exception(std::current_exception());
+        }
+      }
+    }).detach();
+  }
+  return futures;
+}
+
 static int64_t read_le_16(uint8_t* buf) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+// Returns the offset of the record's data from the start of the archive,
+// given the offset of its local header. Expects reader_lock_ to be held.
+size_t PyTorchStreamReader::getRecordDataOffset(uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+}
+
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordDataOffset(stat.m_local_header_ofs);
 }
 
 
@@ -356,12 +696,38 @@ void PyTorchStreamWriter::writeRecord(
     const void* data,
     size_t size,
     bool compress) {
+  writeRecord(
+      name,
+      data,
+      size,
+      compress ? CompressionMethod::Deflate : CompressionMethod::Stored);
+}
+
+void PyTorchStreamWriter::writeRecord(
+    const std::string& name,
+    const void* data,
+    size_t size,
+    CompressionMethod method) {
   AT_ASSERT(!finalized_);
   AT_ASSERT(!archive_name_plus_slash_.empty());
+  if (method == CompressionMethod::Zstd) {
+#ifdef USE_ZSTD
+    std::string compressed = zstdCompressRecord(data, size);
+    writeRecord(
+        name, compressed.data(), compressed.size(), CompressionMethod::Stored);
+    return;
+#else
+    CAFFE_THROW(
+        "cannot write record ",
+        name,
+        " with zstd compression: this build of PyTorch does not support zstd "
+        "(USE_ZSTD=OFF)");
+#endif
+  }
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
       detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
-  uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
+  uint32_t flags = method == CompressionMethod::Deflate ? MZ_BEST_COMPRESSION : 0;
   mz_zip_writer_add_mem_ex_v2(
       ar_.get(),
       full_name.c_str(),
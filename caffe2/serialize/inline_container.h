@@ -4,6 +4,7 @@
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <istream>
 #include <mutex>
 #include <ostream>
@@ -92,6 +93,19 @@ typedef struct mz_zip_archive mz_zip_archive;
 namespace caffe2 {
 namespace serialize {
 
+// Per-record codec for PyTorchStreamWriter::writeRecord.
+enum class CompressionMethod : uint8_t {
+  Stored,
+  Deflate,
+  // The payload is chunked, each chunk is compressed as an independent zstd
+  // frame on its own thread, and the result is written as a stored zip entry
+  // prefixed with a marker that PyTorchStreamReader uses to detect the codec
+  // (the zip format has no standard method id for zstd that miniz
+  // understands). Requires building with USE_ZSTD=ON; zstd records do not
+  // take the zero-copy memory-mapped read path.
+  Zstd,
+};
+
 class TORCH_API PyTorchStreamReader final {
  public:
   explicit PyTorchStreamReader(const std::string& file_name);
@@ -100,6 +114,21 @@ class TORCH_API PyTorchStreamReader final {
 
   // return dataptr, size
   std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
+  // Bulk variant of getRecord: fetches stored (uncompressed) records on
+  // multiple threads when the underlying adapter supports concurrent reads,
+  // and falls back to serial getRecord calls otherwise. Results are in the
+  // order of `names`. CRCs are not validated for records read concurrently.
+  std::vector<std::tuple<at::DataPtr, size_t>> getRecords(
+      const std::vector<std::string>& names);
+  // Asynchronous variant of getRecords: returns one future per name so
+  // callers can overlap deserialization with I/O. Stored (uncompressed)
+  // records are filled in by background threads when the adapter supports
+  // concurrent reads; all other records are fulfilled synchronously before
+  // this returns. The background reads keep a reference to the underlying
+  // adapter, so pending futures stay valid even if the reader is destroyed
+  // before they complete.
+  std::vector<std::future<std::tuple<at::DataPtr, size_t>>> getRecordsAsync(
+      const std::vector<std::string>& names);
   size_t getRecordOffset(const std::string& name);
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
@@ -114,6 +143,7 @@ class TORCH_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordDataOffset(uint64_t local_header_ofs);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -138,6 +168,11 @@ class TORCH_API PyTorchStreamWriter final {
       const void* data,
       size_t size,
       bool compress = false);
+  void writeRecord(
+      const std::string& name,
+      const void* data,
+      size_t size,
+      CompressionMethod method);
   void writeEndOfFile();
 
   const std::vector<std::string>& getAllWrittenRecords();
@@ -16,6 +16,20 @@ class TORCH_API ReadAdapterInterface {
   virtual size_t size() const = 0;
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
+  // If the underlying bytes are available as one contiguous in-memory region
+  // (e.g. a memory-mapped file), returns its base pointer; returns nullptr
+  // otherwise. The region must stay valid for the lifetime of the adapter
+  // and must be safe to write to (MemoryMappedFileAdapter maps privately,
+  // copy-on-write), because PyTorchStreamReader hands slices of it out as
+  // mutable tensor storage.
+  virtual void* mappedData() const {
+    return nullptr;
+  }
+  // Whether read() may be called from several threads concurrently.
+  // PyTorchStreamReader uses this to fetch records in parallel.
+  virtual bool supportsConcurrentReads() const {
+    return false;
+  }
   virtual ~ReadAdapterInterface();
 };
 
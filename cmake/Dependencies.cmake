@@ -1423,6 +1423,7 @@ if(NOT INTERN_BUILD_MOBILE AND BUILD_CAFFE2_OPS)
 endif()
 
 if(USE_ZSTD)
+  add_definitions(-DUSE_ZSTD)
   list(APPEND Caffe2_DEPENDENCY_LIBS libzstd_static)
   include_directories(SYSTEM ${CMAKE_CURRENT_LIST_DIR}/../third_party/zstd/lib)
   add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/../third_party/zstd/build/cmake)
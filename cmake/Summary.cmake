@@ -72,6 +72,7 @@ function(caffe2_print_configuration_summary)
   if(${USE_CUDA})
     message(STATUS "    Split CUDA          : ${BUILD_SPLIT_CUDA}")
     message(STATUS "    CUDA static link    : ${CAFFE2_STATIC_LINK_CUDA}")
+    message(STATUS "    USE_LAZY_CUFFT      : ${USE_LAZY_CUFFT}")
     message(STATUS "    USE_CUDNN           : ${USE_CUDNN}")
     message(STATUS "    CUDA version        : ${CUDA_VERSION}")
     if(${USE_CUDNN})
@@ -316,7 +316,14 @@ set_property(
 # cufft. CUDA_CUFFT_LIBRARIES is actually a list, so we will make an
 # interface library similar to cudart.
 add_library(caffe2::cufft INTERFACE IMPORTED)
-if(CAFFE2_STATIC_LINK_CUDA AND NOT WIN32)
+if(USE_LAZY_CUFFT)
+    # Do not link cufft at all: ATen resolves the cuFFT entry points it uses
+    # through lazyCuFFT (see ATen/cuda/detail/LazyCuFFT.h) on first use, so
+    # processes that never run an FFT never map the library.
+    set_property(
+        TARGET caffe2::cufft PROPERTY INTERFACE_COMPILE_DEFINITIONS
+        AT_CUFFT_LAZY_LOAD)
+elseif(CAFFE2_STATIC_LINK_CUDA AND NOT WIN32)
     set_property(
         TARGET caffe2::cufft PROPERTY INTERFACE_LINK_LIBRARIES
         "${CUDA_TOOLKIT_ROOT_DIR}/lib64/libcufft_static_nocallback.a"
@@ -281,6 +281,45 @@ void test_DeviceOrDtypeConversionSkipsUndefinedTensor(
   }
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TEST_F(ModuleTest, FlatParametersMatchParametersAndCacheStaysCoherent) {
+  struct TestModule : torch::nn::Module {
+    TestModule() {
+      linear = register_module("linear", Linear(3, 4));
+      weight = register_parameter("weight", torch::ones({4, 4}));
+    }
+    Linear linear{nullptr};
+    torch::Tensor weight;
+  };
+
+  TestModule module;
+
+  // NOTE: `flat_parameters()` returns a reference into the module's cache, so
+  // the sizes below are copied out before the next (invalidating) call.
+  auto expected = module.parameters();
+  size_t initial_size = module.flat_parameters().size();
+  ASSERT_EQ(initial_size, expected.size());
+  for (size_t i = 0; i < initial_size; ++i) {
+    ASSERT_TRUE(pointer_equal(module.flat_parameters()[i], expected[i]));
+  }
+
+  // Registering a new parameter invalidates the cache.
+  module.register_parameter("bias", torch::zeros({4}));
+  ASSERT_EQ(module.flat_parameters().size(), initial_size + 1);
+  // Flat order is the module's own parameters followed by its submodules',
+  // like `parameters()`: the new "bias" lands right after "weight".
+  ASSERT_TRUE(pointer_equal(
+      module.flat_parameters()[1], module.named_parameters()["bias"]));
+
+  // So does registering a parameter on a submodule.
+  module.linear->register_parameter("extra", torch::zeros({2}));
+  ASSERT_EQ(module.flat_parameters().size(), initial_size + 2);
+
+  // Buffers flatten with the same scheme.
+  module.register_buffer("stat", torch::zeros({4}));
+  ASSERT_EQ(module.flat_buffers().size(), 1);
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TEST_F(ModuleTest, DeviceOrDtypeConversionSkipsUndefinedTensor) {
   test_DeviceOrDtypeConversionSkipsUndefinedTensor(torch::kCPU, torch::kDouble);
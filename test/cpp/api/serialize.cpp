@@ -240,6 +240,43 @@ TEST(SerializeTest, TryReadFunc) {
   ASSERT_EQ(ivalue.toInt(), 1);
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TEST(SerializeTest, DeltaCheckpointWritesOnlyChangedTensors) {
+  auto first = c10::make_tempfile();
+  auto second = c10::make_tempfile();
+
+  auto weight = torch::randn({5, 5});
+  auto momentum = torch::randn({5, 5});
+
+  torch::serialize::DeltaCheckpointWriter writer;
+  writer.write("weight", weight);
+  writer.write("momentum", momentum);
+  writer.save_to(first.name);
+
+  // Only `weight` changes before the second checkpoint.
+  weight.add_(1);
+  writer.write("weight", weight);
+  writer.write("momentum", momentum);
+  writer.save_to(second.name);
+
+  // The second archive holds `weight` but defers `momentum` to the first.
+  torch::serialize::InputArchive raw;
+  raw.load_from(second.name);
+  torch::Tensor tensor;
+  ASSERT_TRUE(raw.try_read("weight", tensor));
+  ASSERT_FALSE(raw.try_read("momentum", tensor));
+
+  auto loaded = torch::serialize::load_delta_checkpoint(second.name);
+  ASSERT_EQ(loaded.size(), 2);
+  ASSERT_TRUE(loaded["weight"].allclose(weight));
+  ASSERT_TRUE(loaded["momentum"].allclose(momentum));
+
+  // The first checkpoint is still fully self-contained.
+  auto base = torch::serialize::load_delta_checkpoint(first.name);
+  ASSERT_EQ(base.size(), 2);
+  ASSERT_TRUE(base["momentum"].allclose(momentum));
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TEST(SerializeTest, Basic) {
   torch::manual_seed(0);
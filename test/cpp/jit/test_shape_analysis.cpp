@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/shape_analysis.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+TensorTypePtr contiguousType(std::vector<int64_t> sizes) {
+  return TensorType::createContiguous(at::kFloat, at::kCPU, sizes);
+}
+} // namespace
+
+TEST(ShapeAnalysisTest, BatchDimBecomesSymbolic) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %w : Tensor):
+  %r : Tensor = aten::mm(%a, %w)
+  return (%r)
+  )IR",
+      &*graph);
+  graph->inputs()[0]->setType(contiguousType({4, 10}));
+  graph->inputs()[1]->setType(contiguousType({10, 20}));
+  PropagateInputShapes(graph);
+
+  Value* r = graph->outputs()[0];
+  auto full = r->type()->expect<TensorType>();
+  EXPECT_EQ(full->sizes()[0], 4);
+  EXPECT_EQ(full->sizes()[1], 20);
+
+  // A batch-size-only change generalizes dimension 0 of the input to a
+  // symbolic size and repropagates the cone with it.
+  PropagateInputShapesIncremental(graph, {contiguousType({8, 10}), nullptr});
+  auto a_type = graph->inputs()[0]->type()->expect<TensorType>();
+  EXPECT_FALSE(a_type->sizes()[0].has_value());
+  EXPECT_EQ(a_type->sizes()[1], 10);
+  auto r_type = r->type()->expect<TensorType>();
+  EXPECT_EQ(r_type->dim(), 2);
+  EXPECT_EQ(r_type->scalarType(), at::kFloat);
+  EXPECT_FALSE(r_type->sizes()[0].has_value());
+
+  // Further batch-size-only changes are invisible against the symbolic batch
+  // dimension: no type in the graph is replaced.
+  TypePtr a_before = graph->inputs()[0]->type();
+  TypePtr r_before = r->type();
+  PropagateInputShapesIncremental(graph, {contiguousType({16, 10}), nullptr});
+  EXPECT_EQ(graph->inputs()[0]->type().get(), a_before.get());
+  EXPECT_EQ(r->type().get(), r_before.get());
+}
+
+TEST(ShapeAnalysisTest, RepropagatesOnlyAffectedCone) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::relu(%a)
+  %d : Tensor = aten::relu(%b)
+  %n : NoneType = prim::Constant()
+  %s : Tensor = aten::sum(%a, %n)
+  %t : Tensor = aten::relu(%s)
+  return (%c, %d, %t)
+  )IR",
+      &*graph);
+  graph->inputs()[0]->setType(contiguousType({2, 3}));
+  graph->inputs()[1]->setType(contiguousType({4, 5}));
+  PropagateInputShapes(graph);
+
+  Value* c = graph->outputs()[0];
+  Value* d = graph->outputs()[1];
+  Value* t = graph->outputs()[2];
+  TypePtr d_before = d->type();
+  TypePtr t_before = t->type();
+
+  // Changing a non-batch dimension of %a repropagates its cone, but %d only
+  // depends on the untouched %b and must keep its exact type object, and %t
+  // sits behind a full reduction whose output shape doesn't move, so
+  // propagation stops before reaching it.
+  PropagateInputShapesIncremental(graph, {contiguousType({2, 8}), nullptr});
+  auto c_type = c->type()->expect<TensorType>();
+  EXPECT_EQ(c_type->sizes()[0], 2);
+  EXPECT_EQ(c_type->sizes()[1], 8);
+  EXPECT_EQ(d->type().get(), d_before.get());
+  EXPECT_EQ(t->type().get(), t_before.get());
+}
+
+TEST(ShapeAnalysisTest, UnchangedInputsAreNoOp) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor):
+  %c : Tensor = aten::relu(%a)
+  return (%c)
+  )IR",
+      &*graph);
+  graph->inputs()[0]->setType(contiguousType({2, 3}));
+  PropagateInputShapes(graph);
+
+  Value* c = graph->outputs()[0];
+  TypePtr c_before = c->type();
+  PropagateInputShapesIncremental(graph, {contiguousType({2, 3})});
+  EXPECT_EQ(c->type().get(), c_before.get());
+  PropagateInputShapesIncremental(graph, {nullptr});
+  EXPECT_EQ(c->type().get(), c_before.get());
+}
+
+} // namespace jit
+} // namespace torch
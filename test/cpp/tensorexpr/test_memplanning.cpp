@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/tensorexpr/test_base.h>
+
+#include <test/cpp/tensorexpr/padded_buffer.h>
+#include <torch/csrc/jit/tensorexpr/eval.h>
+#include <torch/csrc/jit/tensorexpr/ir.h>
+#include <torch/csrc/jit/tensorexpr/ir_simplifier.h>
+#include <torch/csrc/jit/tensorexpr/loopnest.h>
+#include <torch/csrc/jit/tensorexpr/tensor.h>
+#include <torch/csrc/jit/testing/file_check.h>
+
+#include <sstream>
+
+namespace torch {
+namespace jit {
+
+using namespace torch::jit::tensorexpr;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TEST(MemPlanning, ReusesDeadBufferMemory) {
+  KernelScope kernel_scope;
+  constexpr int N = 1024;
+  Placeholder a_buf("a", kFloat, {N});
+  Tensor* b = Compute("b", {{N, "i"}}, [&](const VarHandle& i) {
+    return a_buf.load(i) + 1.f;
+  });
+  Tensor* c = Compute(
+      "c", {{N, "i"}}, [&](const VarHandle& i) { return b->load(i) * 2.f; });
+  Tensor* d = Compute(
+      "d", {{N, "i"}}, [&](const VarHandle& i) { return c->load(i) - 3.f; });
+  Tensor* e = Compute(
+      "e", {{N, "i"}}, [&](const VarHandle& i) { return d->load(i) * 4.f; });
+
+  LoopNest l({e}, {b, c, d, e});
+  l.prepareForCodegen();
+  l.planMemory();
+  Stmt* stmt = IRSimplifier::simplify(l.root_stmt());
+
+  // b, c and d occupy 4096 bytes each. b is dead once the loop producing c
+  // has run and d only becomes live in the loop after that, so d reuses b's
+  // bytes and the arena holds two buffers' worth of memory, not three.
+  std::ostringstream oss;
+  oss << *stmt;
+  torch::jit::testing::FileCheck()
+      .check("Allocate(arena); // dtype=uint8_t, dims=[8192]")
+      ->check("PlacementAllocate(b, arena, offset=0)")
+      ->check("PlacementAllocate(c, arena, offset=4096)")
+      ->check("PlacementAllocate(d, arena, offset=0)")
+      ->check("Free(arena)")
+      ->run(oss.str());
+
+  PaddedBuffer<float> a_v(N);
+  PaddedBuffer<float> e_v(N);
+  PaddedBuffer<float> e_ref(N);
+  for (int i = 0; i < N; i++) {
+    a_v(i) = i;
+    e_ref(i) = ((i + 1.f) * 2.f - 3.f) * 4.f;
+  }
+
+  SimpleIREvaluator cg(stmt, {a_buf, e});
+  cg.call({a_v, e_v});
+  ExpectAllNear(e_v, e_ref, 1e-5);
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TEST(MemPlanning, OverlappingLiveRangesDontAlias) {
+  KernelScope kernel_scope;
+  constexpr int N = 1024;
+  Placeholder a_buf("a", kFloat, {N});
+  Tensor* b = Compute("b", {{N, "i"}}, [&](const VarHandle& i) {
+    return a_buf.load(i) + 1.f;
+  });
+  Tensor* c = Compute(
+      "c", {{N, "i"}}, [&](const VarHandle& i) { return b->load(i) * 2.f; });
+  Tensor* d = Compute(
+      "d", {{N, "i"}}, [&](const VarHandle& i) { return c->load(i) - 3.f; });
+  // b stays live until the last loop, so no pair of intermediates can share
+  // memory and each gets its own slice of the arena.
+  Tensor* e = Compute("e", {{N, "i"}}, [&](const VarHandle& i) {
+    return b->load(i) + d->load(i);
+  });
+
+  LoopNest l({e}, {b, c, d, e});
+  l.prepareForCodegen();
+  l.planMemory();
+  Stmt* stmt = IRSimplifier::simplify(l.root_stmt());
+
+  std::ostringstream oss;
+  oss << *stmt;
+  torch::jit::testing::FileCheck()
+      .check("Allocate(arena); // dtype=uint8_t, dims=[12288]")
+      ->check("PlacementAllocate(b, arena, offset=0)")
+      ->check("PlacementAllocate(c, arena, offset=4096)")
+      ->check("PlacementAllocate(d, arena, offset=8192)")
+      ->run(oss.str());
+
+  PaddedBuffer<float> a_v(N);
+  PaddedBuffer<float> e_v(N);
+  PaddedBuffer<float> e_ref(N);
+  for (int i = 0; i < N; i++) {
+    a_v(i) = i;
+    e_ref(i) = (i + 1.f) + ((i + 1.f) * 2.f - 3.f);
+  }
+
+  SimpleIREvaluator cg(stmt, {a_buf, e});
+  cg.call({a_v, e_v});
+  ExpectAllNear(e_v, e_ref, 1e-5);
+}
+
+} // namespace jit
+} // namespace torch
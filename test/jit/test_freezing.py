@@ -1953,6 +1953,41 @@ class TestFrozenOptimizations(JitTestCase):
                         # and we aren't testing aten impls anyways
                         self.assertTrue(torch.allclose(aten_op(x, inplace=False), m(x).to_dense()))
 
+    def test_freeze_residual_layernorm_fusion(self):
+        class Net(nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.dropout = nn.Dropout(0.5)
+                self.ln = nn.LayerNorm(24)
+
+            def forward(self, x, residual):
+                return self.ln(self.dropout(x) + residual)
+
+        with set_default_dtype(torch.float):
+            mod = Net().eval()
+            frozen_mod = torch.jit.freeze(torch.jit.script(mod))
+            # dropout is removed by freezing; the remaining add + layer_norm
+            # collapses into the fused op
+            FileCheck().check("aten::_residual_dropout_layer_norm") \
+                       .check_not("aten::layer_norm").run(frozen_mod.graph)
+            x = torch.randn(4, 24)
+            residual = torch.randn(4, 24)
+            self.assertEqual(frozen_mod(x, residual), mod(x, residual))
+
+            # alpha != 1 must not match
+            class NetAlpha(nn.Module):
+                def __init__(self):
+                    super().__init__()
+                    self.ln = nn.LayerNorm(24)
+
+                def forward(self, x, residual):
+                    return self.ln(torch.add(x, residual, alpha=2))
+
+            mod = NetAlpha().eval()
+            frozen_mod = torch.jit.freeze(torch.jit.script(mod))
+            FileCheck().check("aten::layer_norm").run(frozen_mod.graph)
+            self.assertEqual(frozen_mod(x, residual), mod(x, residual))
+
 @unittest.skipIf(not torch._C.has_mkldnn, "MKL-DNN build is disabled")
 class TestMKLDNNReinplacing(JitTestCase):
     def setUp(self):
@@ -464,6 +464,21 @@ class TestTEFuser(JitTestCase):
                 graph = backward_graph(s)
                 self.assertAllFused(graph, except_for={'aten::Float', 'aten::_grad_sum_to_size'})
 
+    def test_clamp_min_max(self):
+        for device in self.devices:
+            def func_min(a, b):
+                return torch.clamp_min(a + b, 0)
+
+            def func_max(a, b):
+                return torch.clamp_max(a + b, 2)
+
+            a = torch.randn(4, 4, dtype=torch.float, device=device)
+            b = torch.randn(4, 4, dtype=torch.float, device=device)
+
+            for f in (func_min, func_max):
+                s = self.checkScript(f, (a, b), profiling=ProfilingMode.PROFILING)
+                self.assertAllFused(s.graph_for(a, b))
+
     def test_clamp_double(self):
         for device in self.devices:
             def clamp_double(x, eta: float):
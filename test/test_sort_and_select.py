@@ -141,6 +141,23 @@ class TestSortAndSelect(TestCase):
                 torch.arange(start=1, end=2 * ncopies, step=2, device=device)
             )
 
+    @onlyCPU
+    @dtypes(*torch.testing.get_all_int_dtypes())
+    def test_sort_large_integer_slice(self, device, dtype):
+        # Contiguous integer slices of at least 4096 elements take the radix
+        # sort path; in particular uint8 keys must not get the signed-key
+        # sign-bit flip. Sorting the double-cast input takes the comparison
+        # path and serves as an independent reference.
+        info = torch.iinfo(dtype)
+        low = max(info.min, -2 ** 40)
+        high = min(info.max, 2 ** 40)
+        x = torch.randint(low, high + 1, (3, 8192), dtype=dtype, device=device)
+        for descending in (False, True):
+            v, i = x.sort(dim=-1, descending=descending)
+            ref = x.double().sort(dim=-1, descending=descending).values.to(dtype)
+            self.assertEqual(v, ref)
+            self.assertEqual(torch.gather(x, -1, i), v)
+
     @onlyCUDA
     @dtypes(torch.uint8)
     @largeTensorTest('200GB')  # Unfortunately 80GB A100 is not large enough
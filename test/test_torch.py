@@ -794,6 +794,25 @@ class AbstractTestCases:
 
             torch.set_rng_state(rng_state)
 
+        def test_rng_thread_count_invariant(self):
+            # Contiguous fills expand a single seed with a counter-based
+            # stream, so the values must not depend on how many threads
+            # intra-op parallelism uses (size chosen to not be a multiple
+            # of the 16-wide normal transform).
+            num_threads = torch.get_num_threads()
+            try:
+                results = []
+                for threads in (1, 4):
+                    torch.set_num_threads(threads)
+                    torch.manual_seed(2)
+                    results.append((torch.randn(1234),
+                                    torch.rand(1234),
+                                    torch.empty(1234).bernoulli_(0.5)))
+                for single, multi in zip(results[0], results[1]):
+                    self.assertEqual(single, multi, atol=0, rtol=0)
+            finally:
+                torch.set_num_threads(num_threads)
+
         def test_numel(self):
             b = torch.ByteTensor(3, 100, 100)
             self.assertEqual(b.nelement(), 3 * 100 * 100)
@@ -4190,6 +4209,29 @@ else:
     def test_gather_backward_one_dim(self, device) -> None:
         self._test_gather_backward_one_dim(device, False)
 
+    @dtypes(torch.float32, torch.half)
+    def test_gather_scatter_expanded_index_wide_rows(self, device, dtype) -> None:
+        # An index expanded along contiguous innermost rows takes the
+        # row-granular CUDA fast path; compare against the contiguous-index
+        # (element-granular) kernel.
+        src = torch.randn(50, 300, device=device).to(dtype)
+        idx = torch.randint(50, (20,), device=device)
+        expanded_idx = idx.unsqueeze(-1).expand(20, 300)
+        actual = torch.gather(src, 0, expanded_idx)
+        expected = torch.gather(src, 0, expanded_idx.contiguous())
+        self.assertEqual(actual, expected, atol=0, rtol=0)
+        self.assertEqual(actual, src[idx], atol=0, rtol=0)
+
+        # scatter with unique rows so duplicate-index ordering cannot differ
+        scatter_src = torch.randn(20, 300, device=device).to(dtype)
+        unique_idx = torch.randperm(50, device=device)[:20]
+        expanded_idx = unique_idx.unsqueeze(-1).expand(20, 300)
+        actual = torch.zeros(50, 300, device=device, dtype=dtype)
+        expected = torch.zeros(50, 300, device=device, dtype=dtype)
+        actual.scatter_(0, expanded_idx, scatter_src)
+        expected.scatter_(0, expanded_idx.contiguous(), scatter_src)
+        self.assertEqual(actual, expected, atol=0, rtol=0)
+
     @dtypes(*torch.testing.get_all_fp_dtypes())
     def test_log_normal(self, device, dtype):
         a = torch.tensor([10], dtype=dtype, device=device).log_normal_()
@@ -6795,6 +6837,39 @@ else:
         self.assertEqual(sample_indices.dim(), 2, msg="wrong number of dimensions")
         self.assertEqual(sample_indices.size(1), n_sample, msg="wrong number of samples")
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_multinomial_alias(self, device, dtype):
+        # the alias plan serves O(1) draws from a frozen distribution
+        probs = torch.rand(50, device=device, dtype=dtype)
+        J, q = torch._multinomial_alias_setup(probs)
+        self.assertEqual(J.dtype, torch.long)
+        self.assertEqual(J.shape, probs.shape)
+        self.assertEqual(q.shape, probs.shape)
+        # q are per-slot acceptance probabilities (up to rounding)
+        self.assertTrue(bool((q <= 1.001).all() and (q >= 0).all()))
+
+        n_sample = 100000
+        samples = torch._multinomial_alias_draw(J, q, n_sample)
+        self.assertEqual(samples.shape, (n_sample,))
+        self.assertTrue(bool((samples >= 0).all() and (samples < probs.size(0)).all()))
+        # empirical frequencies should approximate the normalized distribution
+        counts = torch.bincount(samples, minlength=probs.size(0)).to(dtype=dtype)
+        self.assertEqual(counts / n_sample, probs / probs.sum(), atol=0.01, rtol=0)
+
+        # a category with zero probability must never be drawn
+        probs = torch.tensor([0.5, 0., 0.5], device=device, dtype=dtype)
+        J, q = torch._multinomial_alias_setup(probs)
+        samples = torch._multinomial_alias_draw(J, q, 10000)
+        self.assertEqual(int((samples == 1).sum()), 0)
+
+        self.assertRaisesRegex(
+            RuntimeError, "probs must be 1 dimensional",
+            lambda: torch._multinomial_alias_setup(probs.expand(2, 3)))
+        self.assertRaisesRegex(
+            RuntimeError, "cannot sample n_sample <= 0 samples",
+            lambda: torch._multinomial_alias_draw(J, q, 0))
+
     @onlyCUDA
     @dtypes(torch.float, torch.double, torch.half)
     def test_multinomial_deterministic(self, device, dtype):
@@ -114,6 +114,7 @@ core_trainer_sources = [
     "torch/csrc/autograd/cpp_hook.cpp",
     "torch/csrc/autograd/custom_function.cpp",
     "torch/csrc/autograd/engine.cpp",
+    "torch/csrc/autograd/flat_grad_buffer.cpp",
     "torch/csrc/autograd/function.cpp",
     "torch/csrc/autograd/function_hook.cpp",
     "torch/csrc/autograd/functions/accumulate_grad.cpp",
@@ -123,6 +124,7 @@ core_trainer_sources = [
     "torch/csrc/autograd/input_buffer.cpp",
     "torch/csrc/autograd/record_function_ops.cpp",
     "torch/csrc/autograd/saved_variable.cpp",
+    "torch/csrc/autograd/slim_mode.cpp",
     "torch/csrc/autograd/variable.cpp",
     "torch/csrc/jit/frontend/name_mangler.cpp",
     "torch/csrc/jit/ir/type_hashing.cpp",
@@ -165,6 +167,7 @@ core_sources_full_mobile = [
     "torch/csrc/jit/ir/subgraph_matcher.cpp",
     "torch/csrc/jit/jit_log.cpp",
     "torch/csrc/jit/jit_opt_limit.cpp",
+    "torch/csrc/jit/jit_pass_stats.cpp",
     "torch/csrc/jit/passes/annotate_warns.cpp",
     "torch/csrc/jit/passes/bailout_graph.cpp",
     "torch/csrc/jit/passes/batch_mm.cpp",
@@ -194,6 +197,7 @@ core_sources_full_mobile = [
     "torch/csrc/jit/passes/inline_fork_wait.cpp",
     "torch/csrc/jit/passes/inliner.cpp",
     "torch/csrc/jit/passes/inplace_check.cpp",
+    "torch/csrc/jit/passes/insert_fork_wait.cpp",
     "torch/csrc/jit/passes/insert_guards.cpp",
     "torch/csrc/jit/passes/lift_closures.cpp",
     "torch/csrc/jit/passes/liveness.cpp",
@@ -209,6 +213,9 @@ core_sources_full_mobile = [
     "torch/csrc/jit/passes/remove_mutation.cpp",
     "torch/csrc/jit/passes/prepack_folding.cpp",
     "torch/csrc/jit/passes/fold_conv_bn.cpp",
+    "torch/csrc/jit/passes/frozen_attention_fusion.cpp",
+    "torch/csrc/jit/passes/frozen_batch_norm_relu_fusion.cpp",
+    "torch/csrc/jit/passes/frozen_residual_layer_norm_fusion.cpp",
     "torch/csrc/jit/passes/frozen_conv_folding.cpp",
     "torch/csrc/jit/passes/frozen_ops_to_mkldnn.cpp",
     "torch/csrc/jit/passes/frozen_graph_optimizations.cpp",
@@ -437,6 +444,7 @@ libtorch_cuda_core_sources = [
     "torch/csrc/jit/codegen/cuda/transform_rfactor.cpp",
     "torch/csrc/jit/codegen/cuda/type.cpp",
     "torch/csrc/jit/tensorexpr/cuda_codegen.cpp",
+    "torch/csrc/jit/cuda/graph_runner.cpp",
     "torch/csrc/jit/runtime/register_cuda_ops.cpp",
 ]
 
@@ -500,6 +508,7 @@ torch_cpp_srcs = [
     "torch/csrc/api/src/optim/sgd.cpp",
     "torch/csrc/api/src/optim/schedulers/lr_scheduler.cpp",
     "torch/csrc/api/src/optim/schedulers/step_lr.cpp",
+    "torch/csrc/api/src/serialize/delta.cpp",
     "torch/csrc/api/src/serialize/input-archive.cpp",
     "torch/csrc/api/src/serialize/output-archive.cpp",
 ]
@@ -762,6 +771,7 @@ aten_native_source_codegen_list = [
     "aten/src/ATen/native/cpu/Activation.cpp",
     "aten/src/ATen/native/cpu/BinaryOpsKernel.cpp",
     "aten/src/ATen/native/cpu/BlasKernel.cpp",
+    "aten/src/ATen/native/cpu/CTCLossKernel.cpp",
     "aten/src/ATen/native/cpu/CatKernel.cpp",
     "aten/src/ATen/native/cpu/ComplexKernel.cpp",
     "aten/src/ATen/native/cpu/CopyKernel.cpp",
@@ -774,6 +784,7 @@ aten_native_source_codegen_list = [
     "aten/src/ATen/native/cpu/IndexKernel.cpp",
     "aten/src/ATen/native/cpu/LerpKernel.cpp",
     "aten/src/ATen/native/cpu/LinearAlgebraKernel.cpp",
+    "aten/src/ATen/native/cpu/LstmCellKernel.cpp",
     "aten/src/ATen/native/cpu/MaxPooling.cpp",
     "aten/src/ATen/native/cpu/MaxPoolKernel.cpp",
     "aten/src/ATen/native/cpu/MultinomialKernel.cpp",
@@ -382,6 +382,12 @@ if (resized) {{
         # (e.g., at::cpu::add).  We don't generate methods (TODO: do this
         # when CPUTensor class is a thing); nor do we generate fallback
         # bindings for manual_cpp_binding functions.
+        #
+        # These bindings call the registered wrapper directly, skipping the
+        # dispatcher, autograd and BackendSelect entirely; the usage contract
+        # (inference only, inputs must already live on this backend) is
+        # documented at the top of the generated {DispatchKey}Functions.h
+        # header.
         cpp_sig_group = CppSignatureGroup.from_native_function(f, method=False, fallback_binding=False)
 
         # Signature of the wrapper function we'll register to the dispatcher
@@ -57,6 +57,11 @@ def make_dual(tensor, tangent, *, level=None):
         >>> out = f(inp)
         >>> y, jvp = unpack_dual(out)
 
+    The :attr:`tangent` may also carry one extra leading "batch" dimension of
+    size ``N``, in which case a single forward pass computes ``N`` jvps at
+    once (one per batch entry). All batched tangents within a level must
+    share the same batch size, and batched tangents only propagate through
+    ops whose jvp formulas broadcast over the extra dimension.
     """
     if level is None:
         level = _current_level
@@ -0,0 +1,62 @@
+import sys
+import torch
+from contextlib import contextmanager
+from torch.backends import ContextProp, PropModule, __allow_nonbracketed_mutation
+
+
+def set_flags(_benchmark):
+    orig_flags = (torch._C._get_cpu_benchmark(),)
+    torch._C._set_cpu_benchmark(_benchmark)
+    return orig_flags
+
+
+@contextmanager
+def flags(benchmark=False):
+    with __allow_nonbracketed_mutation():
+        orig_flags = set_flags(benchmark)
+    try:
+        yield
+    finally:
+        with __allow_nonbracketed_mutation():
+            set_flags(orig_flags[0])
+
+
+class cpuFFTPlanCache(object):
+    r"""
+    Represents the CPU (MKL) FFT plan cache, the analogue of
+    ``torch.backends.cuda.cufft_plan_cache``. ``size`` gives the number of
+    cached plans, ``max_size`` controls the cache capacity and ``clear()``
+    empties it.
+    """
+
+    @property
+    def size(self):
+        return torch._cpu_fft_get_plan_cache_size()
+
+    @property
+    def max_size(self):
+        return torch._cpu_fft_get_plan_cache_max_size()
+
+    @max_size.setter
+    def max_size(self, value):
+        torch._cpu_fft_set_plan_cache_max_size(value)
+
+    def clear(self):
+        return torch._cpu_fft_clear_plan_cache()
+
+
+fft_plan_cache = cpuFFTPlanCache()
+
+
+class CPUModule(PropModule):
+    def __init__(self, m, name):
+        super(CPUModule, self).__init__(m, name)
+
+    # The CPU analogue of torch.backends.cudnn.benchmark: when True, CPU
+    # convolutions time every eligible backend for a new input signature
+    # once and reuse the fastest for subsequent calls with that signature.
+    benchmark = ContextProp(torch._C._get_cpu_benchmark, torch._C._set_cpu_benchmark)
+
+# Cool stuff from torch/backends/cudnn/__init__.py and
+# https://stackoverflow.com/questions/2447353/getattr-on-a-module/7668273#7668273
+sys.modules[__name__] = CPUModule(sys.modules[__name__], __name__)
@@ -38,6 +38,9 @@ class DataLoaderBase {
       // NOLINTNEXTLINE(performance-move-const-arg)
       : options_(std::move(options)),
         main_thread_dataset_(std::move(main_thread_dataset)),
+        // Bound both shuttle queues by the number of jobs that can ever be in
+        // flight, so the transport runs on preallocated ring slots.
+        shuttle_(options_.workers > 0 ? options_.max_jobs : 0),
         sequencer_(new_sequencer()) {}
 
   // NOLINTNEXTLINE(bugprone-exception-escape)
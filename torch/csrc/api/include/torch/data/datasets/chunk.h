@@ -4,8 +4,10 @@
 #include <torch/csrc/utils/memory.h>
 #include <torch/data/datasets/stateful.h>
 #include <torch/data/samplers.h>
+#include <list>
 #include <queue>
 #include <thread>
+#include <unordered_map>
 
 #include <torch/serialize.h>
 
@@ -37,6 +39,107 @@ class ChunkDataReader {
   virtual void reset() = 0;
 };
 
+/// A `ChunkDataReader` decorator that keeps recently decoded chunks in an LRU
+/// cache, so re-reads of the same chunk (across epochs, or within one when
+/// `cross_chunk_shuffle_count` revisits chunks) are served from memory instead
+/// of going back to storage and re-decoding.
+///
+/// The cache survives `reset()`, which is what makes it useful: every epoch
+/// re-reads the same chunks, and with a budget of `capacity` chunks the
+/// storage traffic of an epoch shrinks to the chunks that did not fit. The
+/// budget is expressed in chunks because the reader is generic over the chunk
+/// type; size it from the memory budget divided by the decoded chunk size.
+/// Lookups happen on the dataset's preloader threads, and decoding a miss
+/// runs outside the cache lock, so concurrent preloads do not serialize on
+/// each other (two threads racing on the same missing chunk may decode it
+/// twice; the result is still correct).
+///
+/// Cached chunks are returned by value. For example types with shared
+/// ownership (tensors), the copies alias the cached ones, so treat delivered
+/// examples as read-only or clone them before mutation.
+template <typename ChunkReader>
+class CachedChunkDataReader
+    : public ChunkDataReader<
+          typename ChunkReader::ExampleType,
+          typename ChunkReader::ChunkType> {
+ public:
+  using ChunkType = typename ChunkReader::ChunkType;
+  using ExampleType = typename ChunkReader::ExampleType;
+
+  CachedChunkDataReader(ChunkReader chunk_reader, size_t capacity)
+      : chunk_reader_(std::move(chunk_reader)), capacity_(capacity) {
+    TORCH_CHECK(
+        capacity_ > 0,
+        "Chunk cache capacity is 0. A positive capacity needs to be "
+        "specified.");
+  }
+
+  /// Returns the cached chunk if present, otherwise reads and decodes it
+  /// through the wrapped reader and caches the result.
+  ChunkType read_chunk(size_t chunk_index) override {
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      auto it = cache_.find(chunk_index);
+      if (it != cache_.end()) {
+        // Move the entry to the front of the recency list.
+        lru_order_.splice(lru_order_.begin(), lru_order_, it->second.position);
+        return it->second.data;
+      }
+    }
+    ChunkType data = chunk_reader_.read_chunk(chunk_index);
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      auto it = cache_.find(chunk_index);
+      if (it == cache_.end()) {
+        lru_order_.push_front(chunk_index);
+        cache_.emplace(chunk_index, Entry{data, lru_order_.begin()});
+        while (cache_.size() > capacity_) {
+          cache_.erase(lru_order_.back());
+          lru_order_.pop_back();
+        }
+      }
+    }
+    return data;
+  }
+
+  size_t chunk_count() override {
+    return chunk_reader_.chunk_count();
+  }
+
+  /// Resets the wrapped reader. The cache is deliberately kept, so the next
+  /// epoch benefits from it; call `clear_cache()` to drop it explicitly.
+  void reset() override {
+    chunk_reader_.reset();
+  }
+
+  /// Drops all cached chunks.
+  void clear_cache() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    cache_.clear();
+    lru_order_.clear();
+  }
+
+ private:
+  struct Entry {
+    ChunkType data;
+    typename std::list<size_t>::iterator position;
+  };
+
+  ChunkReader chunk_reader_;
+
+  /// The maximum number of chunks kept decoded at any time.
+  const size_t capacity_;
+
+  /// Cached chunks by index, with their spot in the recency list.
+  std::unordered_map<size_t, Entry> cache_;
+
+  /// Chunk indices, most recently used first.
+  std::list<size_t> lru_order_;
+
+  /// Guards `cache_` and `lru_order_` against concurrent preloader threads.
+  std::mutex cache_mutex_;
+};
+
 namespace detail {
 /// BatchDataBuffer manages a queue of UnwrappedBatchData. After a new chunk is
 /// loaded, BatchDataBuffer splits it into small batches and push them into the
@@ -25,6 +25,15 @@ namespace detail {
 template <typename Job, typename Result>
 class DataShuttle {
  public:
+  DataShuttle() = default;
+
+  /// Constructs a `DataShuttle` whose job and result queues are preallocated
+  /// rings of `capacity` slots each, so pushing into a full queue blocks
+  /// (backpressure) instead of allocating. A capacity of zero leaves both
+  /// queues unbounded.
+  explicit DataShuttle(size_t capacity)
+      : new_jobs_(capacity), results_(capacity) {}
+
   /// Pushes a new job. Called by the main thread.
   void push_job(Job job) {
     new_jobs_.push(std::move(job));
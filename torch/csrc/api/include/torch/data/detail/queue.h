@@ -3,35 +3,57 @@
 #include <torch/types.h>
 
 #include <c10/util/Exception.h>
+#include <c10/util/Optional.h>
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
-#include <queue>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace data {
 namespace detail {
 
-/// A basic locked, blocking MPMC queue.
+/// A locked, blocking MPMC queue backed by a fixed ring of preallocated
+/// slots.
 ///
 /// Every `push` and `pop` is guarded by a mutex. A condition variable is used
 /// to communicate insertion of new elements, such that waiting threads will be
 /// woken up if they are currently waiting inside a call to `pop()`.
 ///
+/// When constructed with a capacity, the slots are allocated once up front
+/// and `push` blocks while all of them are occupied, so producers get
+/// backpressure instead of growing the queue. Elements are moved in and out
+/// of their slot; the queue itself never copies a value or allocates per
+/// element. A capacity of zero means unbounded: the ring grows (amortized)
+/// instead of blocking.
+///
 /// Note that this data structure is written specifically for use with the
 /// `DataLoader`. Its behavior is tailored to this use case and may not be
 /// applicable to more general uses.
 template <typename T>
 class Queue {
  public:
+  explicit Queue(size_t capacity = 0) : capacity_(capacity) {
+    ring_.resize(std::max<size_t>(capacity, 1));
+  }
+
   /// Pushes a new value to the back of the `Queue` and notifies one thread on
-  /// the waiting side about this event.
+  /// the waiting side about this event. If the queue is bounded and full,
+  /// blocks until a slot is freed by `pop()`.
   void push(T value) {
     {
-      std::lock_guard<std::mutex> lock(mutex_);
-      queue_.push(std::move(value));
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (capacity_ > 0) {
+        not_full_.wait(lock, [this] { return size_ < capacity_; });
+      } else if (size_ == ring_.size()) {
+        grow();
+      }
+      ring_[(head_ + size_) % ring_.size()] = std::move(value);
+      ++size_;
     }
     cv_.notify_one();
   }
@@ -43,8 +65,7 @@ class Queue {
   T pop(optional<std::chrono::milliseconds> timeout = nullopt) {
     std::unique_lock<std::mutex> lock(mutex_);
     if (timeout) {
-      if (!cv_.wait_for(
-              lock, *timeout, [this] { return !this->queue_.empty(); })) {
+      if (!cv_.wait_for(lock, *timeout, [this] { return this->size_ > 0; })) {
         // clang-format off
         AT_ERROR(
             "Timeout in DataLoader queue while waiting for next batch"
@@ -52,32 +73,64 @@ class Queue {
         // clang-format on
       }
     } else {
-      cv_.wait(lock, [this] { return !this->queue_.empty(); });
+      cv_.wait(lock, [this] { return this->size_ > 0; });
     }
-    AT_ASSERT(!queue_.empty());
-    T value = queue_.front();
-    queue_.pop();
+    AT_ASSERT(size_ > 0);
+    T value = std::move(ring_[head_]);
+    head_ = (head_ + 1) % ring_.size();
+    --size_;
     lock.unlock();
+    if (capacity_ > 0) {
+      not_full_.notify_one();
+    }
     return value;
   }
 
   /// Empties the queue and returns the number of elements that were present at
-  /// the start of the function. No threads are notified about this event as it
-  /// is assumed to be used to drain the queue during shutdown of a
-  /// `DataLoader`.
+  /// the start of the function. The slots themselves stay allocated. Threads
+  /// blocked in `push()` are notified about the freed slots, since the queue
+  /// may be drained during shutdown of a `DataLoader` while workers are still
+  /// producing results.
   size_t clear() {
-    std::lock_guard<std::mutex> lock(this->mutex_);
-    const auto size = queue_.size();
-    while (!queue_.empty()) {
-      queue_.pop();
+    size_t size = 0;
+    {
+      std::lock_guard<std::mutex> lock(this->mutex_);
+      size = size_;
+      while (size_ > 0) {
+        ring_[head_] = T();
+        head_ = (head_ + 1) % ring_.size();
+        --size_;
+      }
+    }
+    if (capacity_ > 0) {
+      not_full_.notify_all();
     }
     return size;
   }
 
  private:
-  std::queue<T> queue_;
+  /// Doubles the ring in the unbounded case. Called with the lock held.
+  void grow() {
+    std::vector<T> bigger(ring_.size() * 2);
+    for (size_t i = 0; i < size_; ++i) {
+      bigger[i] = std::move(ring_[(head_ + i) % ring_.size()]);
+    }
+    ring_ = std::move(bigger);
+    head_ = 0;
+  }
+
+  /// The preallocated slots, used as a circular buffer.
+  std::vector<T> ring_;
+  /// The maximum number of occupied slots, or zero for unbounded.
+  const size_t capacity_;
+  /// Index of the front element.
+  size_t head_ = 0;
+  /// Number of occupied slots.
+  size_t size_ = 0;
   std::mutex mutex_;
   std::condition_variable cv_;
+  /// Signalled when a slot is freed, for producers blocked in `push()`.
+  std::condition_variable not_full_;
 };
 } // namespace detail
 } // namespace data
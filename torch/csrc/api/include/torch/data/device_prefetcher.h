@@ -0,0 +1,237 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/data/iterator.h>
+#include <torch/types.h>
+
+#include <torch/csrc/utils/memory.h>
+
+#include <c10/core/Device.h>
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/DeviceGuardImplInterface.h>
+#include <c10/util/Exception.h>
+#include <c10/util/Optional.h>
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// Non-tensor batch payloads (labels stored as plain integers, say) have
+/// nothing to transfer and pass through unchanged.
+template <typename T>
+T stage_to_device(T value, Device /*device*/) {
+  return value;
+}
+
+/// Stages a tensor for consumption on `device`: host tensors headed for an
+/// accelerator are first copied into pinned memory (so the following copy can
+/// be a true async DMA) and then moved with `non_blocking=true` on the
+/// current stream.
+inline Tensor stage_to_device(Tensor tensor, Device device) {
+  if (!tensor.defined() || tensor.device() == device) {
+    return tensor;
+  }
+  if (device.is_cuda() && tensor.device().is_cpu() && !tensor.is_pinned()) {
+    tensor = tensor.pin_memory();
+  }
+  return tensor.to(device, /*non_blocking=*/true);
+}
+
+template <typename Data, typename Target>
+Example<Data, Target> stage_to_device(Example<Data, Target> example, Device device) {
+  return {stage_to_device(std::move(example.data), device),
+          stage_to_device(std::move(example.target), device)};
+}
+
+template <typename Data>
+Example<Data, example::NoTarget> stage_to_device(
+    Example<Data, example::NoTarget> example,
+    Device device) {
+  return {stage_to_device(std::move(example.data), device)};
+}
+
+template <typename T>
+std::vector<T> stage_to_device(std::vector<T> batch, Device device) {
+  for (auto& example : batch) {
+    example = stage_to_device(std::move(example), device);
+  }
+  return batch;
+}
+
+template <typename T>
+void record_batch_stream(const T& /*value*/, Stream /*stream*/) {}
+
+/// Tells the caching allocator that `tensor`'s storage is in use on `stream`.
+/// Required because the staged copies above run on a side stream: without
+/// this, freeing the batch could hand the memory to a later allocation while
+/// the consumer stream still reads it.
+inline void record_batch_stream(const Tensor& tensor, Stream stream) {
+  if (tensor.defined() && tensor.device() == stream.device()) {
+    tensor.record_stream(stream);
+  }
+}
+
+template <typename Data, typename Target>
+void record_batch_stream(const Example<Data, Target>& example, Stream stream) {
+  record_batch_stream(example.data, stream);
+  record_batch_stream(example.target, stream);
+}
+
+template <typename Data>
+void record_batch_stream(
+    const Example<Data, example::NoTarget>& example,
+    Stream stream) {
+  record_batch_stream(example.data, stream);
+}
+
+template <typename T>
+void record_batch_stream(const std::vector<T>& batch, Stream stream) {
+  for (const auto& example : batch) {
+    record_batch_stream(example, stream);
+  }
+}
+
+} // namespace detail
+
+/// Wraps a `DataLoader` and keeps the next `depth` batches staged on a target
+/// device, so the copy of batch `n + 1` overlaps the computation on batch `n`.
+///
+/// For an accelerator device, each batch is copied into pinned host memory and
+/// then transferred on a dedicated side stream; an event recorded after the
+/// copy is blocked on (asynchronously, no host sync) just before the batch is
+/// handed out, so the consumer stream orders correctly after the transfer.
+/// For CPU targets the wrapper degenerates to a pass-through and the header
+/// remains usable in CPU-only builds.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto loader = torch::data::make_data_loader(std::move(dataset));
+///   auto prefetcher = torch::data::make_device_prefetcher(*loader, torch::kCUDA);
+///   for (auto& batch : prefetcher) {
+///     // batch is already on the GPU; its H2D copy overlapped the previous
+///     // iteration's compute.
+///   }
+/// \endrst
+template <typename DataLoader>
+class DevicePrefetcher {
+ public:
+  using BatchType = typename DataLoader::BatchType;
+
+  /// Constructs a `DevicePrefetcher` that stages batches from `loader` onto
+  /// `device`, keeping up to `depth` transfers in flight. A depth of two gives
+  /// classic double buffering; larger depths smooth out jittery batch times at
+  /// the cost of device memory.
+  DevicePrefetcher(DataLoader& loader, Device device, size_t depth = 2)
+      : loader_(loader),
+        device_(device),
+        depth_(depth),
+        copy_stream_(acquire_copy_stream(device)) {
+    TORCH_CHECK(depth > 0, "DevicePrefetcher depth must be positive");
+  }
+
+  /// Returns an iterator over staged batches. Like the `DataLoader` iterator
+  /// it wraps, only one active iterator is supported at a time.
+  Iterator<BatchType> begin() {
+    current_ = loader_.begin();
+    staged_.clear();
+    fill();
+    return Iterator<BatchType>(torch::make_unique<detail::ValidIterator<BatchType>>(
+        [this] { return this->next(); }));
+  }
+
+  /// Returns a sentinel that compares equal to the `begin()` iterator once the
+  /// underlying `DataLoader` is exhausted and all staged batches are consumed.
+  Iterator<BatchType> end() {
+    return Iterator<BatchType>(
+        torch::make_unique<detail::SentinelIterator<BatchType>>());
+  }
+
+ private:
+  /// A batch whose copy to the device has been issued, together with the event
+  /// marking the copy's completion on the side stream.
+  struct StagedBatch {
+    BatchType batch;
+    optional<c10::Event> ready;
+  };
+
+  static Stream acquire_copy_stream(Device device) {
+    if (device.is_cuda()) {
+      return c10::impl::VirtualGuardImpl(device.type())
+          .getStreamFromGlobalPool(device);
+    }
+    // CPU (and other single-stream backends): the default stream, on which
+    // staging is a no-op.
+    return Stream(Stream::DEFAULT, device);
+  }
+
+  /// Tops the staging queue back up to `depth_` batches, issuing each copy on
+  /// the side stream without waiting for it.
+  void fill() {
+    while (staged_.size() < depth_ && *current_ != loader_.end()) {
+      BatchType batch = std::move(**current_);
+      ++*current_;
+      StagedBatch staged{std::move(batch), nullopt};
+      if (device_.is_cuda()) {
+        c10::StreamGuard guard(copy_stream_);
+        staged.batch = detail::stage_to_device(std::move(staged.batch), device_);
+        staged.ready.emplace(device_.type());
+        staged.ready->record(copy_stream_);
+      } else {
+        staged.batch = detail::stage_to_device(std::move(staged.batch), device_);
+      }
+      staged_.push_back(std::move(staged));
+    }
+  }
+
+  optional<BatchType> next() {
+    if (staged_.empty()) {
+      return nullopt;
+    }
+    StagedBatch staged = std::move(staged_.front());
+    staged_.pop_front();
+    if (staged.ready) {
+      // Make the consumer stream wait for the copy (device-side only; the
+      // host does not block), and mark the batch as live on it for the
+      // caching allocator.
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      Stream consumer = impl.getStream(device_);
+      staged.ready->block(consumer);
+      detail::record_batch_stream(staged.batch, consumer);
+    }
+    // Issue the replacement copy before handing out the batch, so it overlaps
+    // the caller's compute.
+    fill();
+    return std::move(staged.batch);
+  }
+
+  DataLoader& loader_;
+  const Device device_;
+  const size_t depth_;
+  /// The side stream all staging copies are issued on.
+  Stream copy_stream_;
+  /// The active iterator into the underlying `DataLoader`.
+  optional<Iterator<BatchType>> current_;
+  /// Batches whose transfer has been issued, oldest first.
+  std::deque<StagedBatch> staged_;
+};
+
+/// Creates a `DevicePrefetcher` staging batches from `loader` onto `device`,
+/// with `depth` transfers in flight (see the class documentation).
+template <typename DataLoader>
+DevicePrefetcher<DataLoader> make_device_prefetcher(
+    DataLoader& loader,
+    Device device,
+    size_t depth = 2) {
+  return DevicePrefetcher<DataLoader>(loader, device, depth);
+}
+
+} // namespace data
+} // namespace torch
@@ -15,6 +15,8 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace nn {
@@ -219,6 +221,23 @@ class TORCH_API Module : public std::enable_shared_from_this<Module> {
   /// their keys, and if `recurse` is true also recursively of every submodule.
   OrderedDict<std::string, Tensor> named_buffers(bool recurse = true) const;
 
+  /// Returns the parameters of this `Module` and all of its submodules as one
+  /// flat vector of tensor handles, in the same order as `parameters()`.
+  ///
+  /// Unlike `parameters()`, the flattened vector is cached: repeated calls
+  /// only walk the module hierarchy to check that no parameter or submodule
+  /// was registered or removed since the last call (a pointer and count
+  /// comparison, without building any names or allocating), and hand back the
+  /// same vector. This makes per-step uses such as gradient clipping cheap on
+  /// deep hierarchies. The returned reference stays valid until the next
+  /// registration change on any module in the hierarchy.
+  const std::vector<Tensor>& flat_parameters() const;
+
+  /// Returns the buffers of this `Module` and all of its submodules as one
+  /// flat vector of tensor handles, with the same caching scheme as
+  /// `flat_parameters()`.
+  const std::vector<Tensor>& flat_buffers() const;
+
   /// Returns the submodules of this `Module` (the entire submodule hierarchy)
   /// and if `include_self` is true, also inserts a `shared_ptr` to this module
   /// in the first position.
@@ -588,12 +607,45 @@ class TORCH_API Module : public std::enable_shared_from_this<Module> {
   /// Returns a shared_ptr to `this` in a safe (checked) way.
   std::shared_ptr<Module> shared_from_this_checked() const;
 
+  /// Cache for `flat_parameters()` / `flat_buffers()`: the flattened handles
+  /// plus the hierarchy snapshot (one pre-order entry per module, recording
+  /// its identity and direct parameter or buffer count) they were built from.
+  /// Validity is established by re-walking the hierarchy and comparing against
+  /// the snapshot, since submodules cannot invalidate their ancestors' caches
+  /// (modules hold no parent pointers).
+  struct FlatTensorCache {
+    std::vector<Tensor> tensors;
+    std::vector<std::pair<const Module*, size_t>> snapshot;
+  };
+
+  /// Checks this module's subtree against `cache`, advancing `index` one
+  /// snapshot entry per visited module and `tensor_index` one entry per
+  /// defined tensor. `buffers` selects which of the two tensor dictionaries
+  /// is walked.
+  bool matches_flat_snapshot(
+      const FlatTensorCache& cache,
+      size_t& index,
+      size_t& tensor_index,
+      bool buffers) const;
+
+  /// Rebuilds `cache` from this module's subtree in pre-order.
+  void collect_flat_tensors(FlatTensorCache& cache, bool buffers) const;
+
+  /// Shared implementation of `flat_parameters()` and `flat_buffers()`.
+  const std::vector<Tensor>& flat_tensors(
+      FlatTensorCache& cache,
+      bool buffers) const;
+
   /// The registered buffers of this `Module`.
   OrderedDict<std::string, Tensor> buffers_;
 
   /// The registered (direct) submodules of this `Module`.
   OrderedDict<std::string, std::shared_ptr<Module>> children_;
 
+  /// Caches for `flat_parameters()` and `flat_buffers()`.
+  mutable FlatTensorCache flat_parameters_cache_;
+  mutable FlatTensorCache flat_buffers_cache_;
+
   /// The module's name (e.g. "LSTM").
   mutable optional<std::string> name_;
 
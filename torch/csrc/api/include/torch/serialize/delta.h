@@ -0,0 +1,92 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/ordered_dict.h>
+#include <torch/serialize/output-archive.h>
+#include <torch/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+
+/// Writes checkpoints incrementally: the first `save_to()` writes every
+/// tensor, and each subsequent one writes only tensors whose data changed
+/// since the previous checkpoint, plus a manifest naming the unchanged keys
+/// and the prior archive they can be read from. For large, slowly-changing
+/// state (optimizer moments of embedding tables, say) this cuts checkpoint
+/// I/O to the size of the delta.
+///
+/// Changes are detected through tensor version counters, which every in-place
+/// operation bumps. Mutations that deliberately bypass version counting (such
+/// as `Tensor::set_data` or writes through an aliased storage) are not seen;
+/// call `reset()` to force the next checkpoint to be a full one.
+///
+/// Archives produced this way form a chain through their manifests and are
+/// read back with `load_delta_checkpoint()`, which follows the chain until
+/// every key resolves. The referenced base archives must therefore outlive
+/// the checkpoints that point at them.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::serialize::DeltaCheckpointWriter writer;
+///   for (;;) {
+///     train_for_a_while();
+///     for (const auto& pair : model->named_parameters()) {
+///       writer.write(pair.key(), pair.value());
+///     }
+///     writer.save_to(next_checkpoint_filename());
+///   }
+/// \endrst
+class TORCH_API DeltaCheckpointWriter {
+ public:
+  /// Queues a `(key, tensor)` pair for the next checkpoint. Like
+  /// `OutputArchive::write`, `is_buffer` marks non-differentiable tensors.
+  void write(const std::string& key, Tensor tensor, bool is_buffer = false);
+
+  /// Writes the queued tensors to `filename`: changed ones in full, unchanged
+  /// ones as manifest references to the previous checkpoint. Clears the queue.
+  void save_to(const std::string& filename);
+
+  /// Drops all change tracking, so the next `save_to()` writes a full,
+  /// self-contained checkpoint.
+  void reset();
+
+ private:
+  struct Entry {
+    Tensor tensor;
+    bool is_buffer;
+  };
+
+  /// What was known about a tensor when it was last written: which impl the
+  /// key referred to and its version counter value at the time.
+  struct TrackedVersion {
+    const at::TensorImpl* impl;
+    uint32_t version;
+  };
+
+  /// Tensors queued for the next checkpoint, in `write()` order.
+  std::vector<std::pair<std::string, Entry>> pending_;
+
+  /// Per-key versions as of the last checkpoint that wrote them.
+  std::unordered_map<std::string, TrackedVersion> versions_;
+
+  /// The archive the next checkpoint's manifest will reference; empty until
+  /// the first `save_to()` and after `reset()`.
+  std::string prior_filename_;
+};
+
+/// Loads a checkpoint produced by `DeltaCheckpointWriter`, following the
+/// chain of base archives until every key resolves, and returns the fully
+/// materialized tensors. Also accepts ordinary (non-delta) archives, whose
+/// tensor attributes are returned as-is.
+TORCH_API OrderedDict<std::string, Tensor> load_delta_checkpoint(
+    const std::string& filename);
+
+} // namespace serialize
+} // namespace torch
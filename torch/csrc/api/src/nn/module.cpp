@@ -177,6 +177,78 @@ OrderedDict<std::string, Tensor> Module::named_buffers(bool recurse) const {
   return result;
 }
 
+const std::vector<Tensor>& Module::flat_parameters() const {
+  return flat_tensors(flat_parameters_cache_, /*buffers=*/false);
+}
+
+const std::vector<Tensor>& Module::flat_buffers() const {
+  return flat_tensors(flat_buffers_cache_, /*buffers=*/true);
+}
+
+const std::vector<Tensor>& Module::flat_tensors(
+    FlatTensorCache& cache,
+    bool buffers) const {
+  size_t index = 0;
+  size_t tensor_index = 0;
+  // The cache is valid if the pre-order walk consumes the snapshot exactly:
+  // any registered, removed or replaced parameter, buffer or submodule
+  // anywhere in the hierarchy shifts a pointer or count and forces a rebuild.
+  if (!matches_flat_snapshot(cache, index, tensor_index, buffers) ||
+      index != cache.snapshot.size() ||
+      tensor_index != cache.tensors.size()) {
+    cache.tensors.clear();
+    cache.snapshot.clear();
+    collect_flat_tensors(cache, buffers);
+  }
+  return cache.tensors;
+}
+
+bool Module::matches_flat_snapshot(
+    const FlatTensorCache& cache,
+    size_t& index,
+    size_t& tensor_index,
+    bool buffers) const {
+  const auto& dict = buffers ? buffers_ : parameters_;
+  if (index >= cache.snapshot.size() || cache.snapshot[index].first != this ||
+      cache.snapshot[index].second != dict.size()) {
+    return false;
+  }
+  ++index;
+  for (const auto& item : dict) {
+    if (item.value().defined()) {
+      // Compare the handles themselves, so replacing a tensor in the dict
+      // (possible through `ParameterDict`) also triggers a rebuild.
+      if (tensor_index >= cache.tensors.size() ||
+          cache.tensors[tensor_index].unsafeGetTensorImpl() !=
+              item.value().unsafeGetTensorImpl()) {
+        return false;
+      }
+      ++tensor_index;
+    }
+  }
+  for (const auto& child : children_) {
+    if (!child.value()->matches_flat_snapshot(
+            cache, index, tensor_index, buffers)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Module::collect_flat_tensors(FlatTensorCache& cache, bool buffers) const {
+  const auto& dict = buffers ? buffers_ : parameters_;
+  cache.snapshot.emplace_back(this, dict.size());
+  for (const auto& item : dict) {
+    // Match `parameters()` / `buffers()`, which skip undefined tensors.
+    if (item.value().defined()) {
+      cache.tensors.push_back(item.value());
+    }
+  }
+  for (const auto& child : children_) {
+    child.value()->collect_flat_tensors(cache, buffers);
+  }
+}
+
 std::vector<std::shared_ptr<Module>> Module::modules(bool include_self) const {
   std::vector<std::shared_ptr<Module>> result;
   if (include_self) {
@@ -9,6 +9,8 @@
 
 #include <cmath>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace optim {
@@ -77,14 +79,41 @@ Tensor Adam::step(LossClosure closure)  {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    auto& options = static_cast<AdamOptions&>(group.options());
+    auto beta1 = std::get<0>(options.betas());
+    auto beta2 = std::get<1>(options.betas());
+
+    // Parameters are batched so that every `_foreach_` call below sees
+    // tensors of one dtype on one device, which is all those ops accept; each
+    // batch then costs a fixed number of kernel launches instead of 6+ per
+    // parameter. Per-parameter state layout is unchanged.
+    struct Batch {
+      std::vector<Tensor> params;
+      std::vector<Tensor> grads;
+      std::vector<Tensor> exp_avgs;
+      std::vector<Tensor> exp_avg_sqs;
+      std::vector<Tensor> max_exp_avg_sqs;
+      std::vector<Scalar> step_sizes;
+      std::vector<Scalar> bias_correction2_sqrts;
+    };
+    std::vector<std::pair<std::pair<Device, ScalarType>, Batch>> batches;
+    const auto batch_for = [&batches](const Tensor& p) -> Batch& {
+      const auto key = std::make_pair(p.device(), p.scalar_type());
+      for (auto& batch : batches) {
+        if (batch.first == key) {
+          return batch.second;
+        }
+      }
+      batches.emplace_back(key, Batch());
+      return batches.back().second;
+    };
+
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
       }
-      auto grad = p.grad();
-      TORCH_CHECK(!grad.is_sparse(), "Adam does not support sparse gradients"/*, please consider SparseAdam instead*/);
+      TORCH_CHECK(!p.grad().is_sparse(), "Adam does not support sparse gradients"/*, please consider SparseAdam instead*/);
       auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-      auto& options = static_cast<AdamOptions&>(group.options());
 
       // State initialization
       if(param_state == state_.end()) {
@@ -102,37 +131,55 @@ Tensor Adam::step(LossClosure closure)  {
       }
 
       auto& state = static_cast<AdamParamState&>(*state_[c10::guts::to_string(p.unsafeGetTensorImpl())]);
-      auto& exp_avg = state.exp_avg();
-      auto& exp_avg_sq = state.exp_avg_sq();
-      auto& max_exp_avg_sq = state.max_exp_avg_sq();
-
       state.step(state.step()+1);
-      auto beta1 = std::get<0>(options.betas());
-      auto beta2 = std::get<1>(options.betas());
 
       auto bias_correction1 = 1 - std::pow(beta1, state.step());
       auto bias_correction2 = 1 - std::pow(beta2, state.step());
 
+      auto& batch = batch_for(p);
+      batch.params.push_back(p);
+      batch.grads.push_back(p.grad());
+      batch.exp_avgs.push_back(state.exp_avg());
+      batch.exp_avg_sqs.push_back(state.exp_avg_sq());
+      if (options.amsgrad()) {
+        batch.max_exp_avg_sqs.push_back(state.max_exp_avg_sq());
+      }
+      batch.step_sizes.emplace_back(-options.lr() / bias_correction1);
+      batch.bias_correction2_sqrts.emplace_back(std::sqrt(bias_correction2));
+    }
+
+    for (auto& kv : batches) {
+      auto& batch = kv.second;
+      auto grads = std::move(batch.grads);
       if(options.weight_decay() != 0) {
-        grad = grad.add(p, options.weight_decay());
+        grads = at::_foreach_add(grads, batch.params, options.weight_decay());
       }
 
       // Decay the first and second moment running average coefficient
-      exp_avg.mul_(beta1).add_(grad, 1 - beta1);
-      exp_avg_sq.mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+      at::_foreach_mul_(batch.exp_avgs, beta1);
+      at::_foreach_add_(batch.exp_avgs, grads, 1 - beta1);
+      at::_foreach_mul_(batch.exp_avg_sqs, beta2);
+      at::_foreach_addcmul_(batch.exp_avg_sqs, grads, grads, 1 - beta2);
 
-      Tensor denom;
+      std::vector<Tensor> denom;
       if(options.amsgrad()) {
-        // Maintains the maximum of all 2nd moment running avg. till now
-        torch::max_out(max_exp_avg_sq, exp_avg_sq, max_exp_avg_sq);
+        // Maintains the maximum of all 2nd moment running avg. till now.
+        // Kept per-tensor so the result lands in the state buffers in place.
+        for (size_t i = 0; i < batch.params.size(); ++i) {
+          torch::max_out(
+              batch.max_exp_avg_sqs[i],
+              batch.exp_avg_sqs[i],
+              batch.max_exp_avg_sqs[i]);
+        }
         // Use the max. for normalizing running avg. of gradient
-        denom = (max_exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        denom = at::_foreach_sqrt(batch.max_exp_avg_sqs);
       } else {
-        denom = (exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        denom = at::_foreach_sqrt(batch.exp_avg_sqs);
       }
+      at::_foreach_div_(denom, batch.bias_correction2_sqrts);
+      at::_foreach_add_(denom, options.eps());
 
-      auto step_size = options.lr() / bias_correction1;
-      p.addcdiv_(exp_avg, denom, -step_size);
+      at::_foreach_addcdiv_(batch.params, batch.exp_avgs, denom, batch.step_sizes);
     }
   }
   return loss;
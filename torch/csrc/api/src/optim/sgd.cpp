@@ -10,6 +10,8 @@
 #include <ATen/ATen.h>
 
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace optim {
@@ -74,33 +76,102 @@ Tensor SGD::step(LossClosure closure)  {
     auto dampening = options.dampening();
     auto nesterov = options.nesterov();
 
+    // Dense parameters are batched per device and dtype (all the `_foreach_`
+    // ops accept) so each batch costs a fixed number of kernel launches
+    // instead of several per parameter. Sparse gradients keep the
+    // per-parameter path below, since the foreach ops do not support them.
+    struct Batch {
+      // `params` carries the variables themselves (their impl pointers key
+      // the momentum state); the arithmetic runs on `datas`, mirroring the
+      // `p.data()` use of the per-parameter path.
+      std::vector<Tensor> params;
+      std::vector<Tensor> datas;
+      std::vector<Tensor> d_ps;
+    };
+    std::vector<std::pair<std::pair<Device, ScalarType>, Batch>> batches;
+    const auto batch_for = [&batches](const Tensor& p) -> Batch& {
+      const auto key = std::make_pair(p.device(), p.scalar_type());
+      for (auto& batch : batches) {
+        if (batch.first == key) {
+          return batch.second;
+        }
+      }
+      batches.emplace_back(key, Batch());
+      return batches.back().second;
+    };
+
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
       }
-      auto d_p = p.grad().data();
+      if (p.grad().is_sparse()) {
+        auto d_p = p.grad().data();
+        if (weight_decay != 0) {
+          d_p = d_p.add(p.data(), weight_decay);
+        }
+        p.data().add_(d_p, -1 * options.lr());
+        continue;
+      }
+      auto& batch = batch_for(p);
+      batch.params.push_back(p);
+      batch.datas.push_back(p.data());
+      batch.d_ps.push_back(p.grad().data());
+    }
+
+    for (auto& kv : batches) {
+      auto& batch = kv.second;
+      auto d_ps = std::move(batch.d_ps);
       if (weight_decay != 0) {
-        d_p = d_p.add(p.data(), weight_decay);
+        d_ps = at::_foreach_add(d_ps, batch.datas, weight_decay);
       }
       if (momentum != 0) {
-        Tensor buf;
-        auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-        if(param_state == state_.end()) {
-          buf = torch::clone(d_p).detach();
-          auto state = std::make_unique<SGDParamState>();
-          state->momentum_buffer(buf);
-          state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+        std::vector<Tensor> bufs;
+        bufs.reserve(batch.params.size());
+        // First visit of a parameter seeds its buffer with a clone of the
+        // (weight-decayed) gradient instead of the decay update, exactly like
+        // the per-parameter path did.
+        bool all_have_momentum_buffers = true;
+        for (const auto& p : batch.params) {
+          if (state_.count(c10::guts::to_string(p.unsafeGetTensorImpl())) == 0) {
+            all_have_momentum_buffers = false;
+            break;
+          }
+        }
+        if (all_have_momentum_buffers) {
+          for (const auto& p : batch.params) {
+            bufs.push_back(
+                static_cast<SGDParamState&>(
+                    *state_[c10::guts::to_string(p.unsafeGetTensorImpl())])
+                    .momentum_buffer());
+          }
+          at::_foreach_mul_(bufs, momentum);
+          at::_foreach_add_(bufs, d_ps, 1 - dampening);
         } else {
-          buf = static_cast<SGDParamState&>(*param_state->second).momentum_buffer();
-          buf.mul_(momentum).add_(d_p, 1 - dampening);
+          for (size_t i = 0; i < batch.params.size(); ++i) {
+            const auto& p = batch.params[i];
+            auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
+            Tensor buf;
+            if (param_state == state_.end()) {
+              buf = torch::clone(d_ps[i]).detach();
+              auto state = std::make_unique<SGDParamState>();
+              state->momentum_buffer(buf);
+              state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+            } else {
+              buf = static_cast<SGDParamState&>(*param_state->second).momentum_buffer();
+              buf.mul_(momentum).add_(d_ps[i], 1 - dampening);
+            }
+            bufs.push_back(buf);
+          }
         }
         if (nesterov) {
-          d_p = d_p.add(buf, momentum);
+          // Out of place: with no weight decay `d_ps` still aliases the
+          // gradients, which the update must not clobber.
+          d_ps = at::_foreach_add(d_ps, bufs, momentum);
         } else {
-          d_p = buf;
+          d_ps = std::move(bufs);
         }
       }
-      p.data().add_(d_p, -1 * options.lr());
+      at::_foreach_add_(batch.datas, d_ps, -1 * options.lr());
     }
   }
   return loss;
@@ -0,0 +1,132 @@
+#include <torch/serialize/delta.h>
+
+#include <torch/serialize/input-archive.h>
+#include <torch/types.h>
+
+#include <ATen/core/List.h>
+#include <c10/util/Exception.h>
+
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+namespace {
+/// Manifest attribute naming the archive unchanged tensors live in.
+constexpr const char* kDeltaBaseKey = "__delta_base__";
+/// Manifest attribute listing the keys that were not re-written.
+constexpr const char* kDeltaUnchangedKey = "__delta_unchanged__";
+} // namespace
+
+void DeltaCheckpointWriter::write(
+    const std::string& key,
+    Tensor tensor,
+    bool is_buffer) {
+  pending_.emplace_back(key, Entry{std::move(tensor), is_buffer});
+}
+
+void DeltaCheckpointWriter::save_to(const std::string& filename) {
+  OutputArchive archive;
+  c10::List<std::string> unchanged;
+  for (auto& item : pending_) {
+    const auto& key = item.first;
+    const auto& tensor = item.second.tensor;
+    TORCH_CHECK(
+        key != kDeltaBaseKey && key != kDeltaUnchangedKey,
+        "Key '", key, "' is reserved for the delta checkpoint manifest");
+    const auto* impl = tensor.unsafeGetTensorImpl();
+    const auto version = impl->version_counter().current_version();
+    auto tracked = versions_.find(key);
+    // Only trust the version counter if it belongs to the same impl that was
+    // written last time; a rebound key is always a change.
+    const bool is_unchanged = !prior_filename_.empty() &&
+        tracked != versions_.end() && tracked->second.impl == impl &&
+        tracked->second.version == version;
+    if (is_unchanged) {
+      unchanged.push_back(key);
+    } else {
+      archive.write(key, tensor, item.second.is_buffer);
+      versions_[key] = TrackedVersion{impl, version};
+    }
+  }
+  if (!unchanged.empty()) {
+    archive.write(kDeltaBaseKey, c10::IValue(prior_filename_));
+    archive.write(kDeltaUnchangedKey, c10::IValue(unchanged));
+  }
+  archive.save_to(filename);
+  prior_filename_ = filename;
+  pending_.clear();
+}
+
+void DeltaCheckpointWriter::reset() {
+  versions_.clear();
+  prior_filename_.clear();
+}
+
+OrderedDict<std::string, Tensor> load_delta_checkpoint(
+    const std::string& filename) {
+  OrderedDict<std::string, Tensor> result("Tensor");
+  std::vector<std::string> pending;
+  std::string current = filename;
+  bool top_level = true;
+  while (true) {
+    InputArchive archive;
+    archive.load_from(current);
+
+    c10::IValue base;
+    c10::IValue unchanged;
+    archive.try_read(kDeltaBaseKey, base);
+    std::unordered_set<std::string> deferred;
+    if (archive.try_read(kDeltaUnchangedKey, unchanged)) {
+      for (const auto& key : unchanged.toListRef()) {
+        deferred.insert(key.toStringRef());
+      }
+    }
+
+    std::vector<std::string> next_pending;
+    if (top_level) {
+      for (const auto& key : archive.keys()) {
+        if (key == kDeltaBaseKey || key == kDeltaUnchangedKey) {
+          continue;
+        }
+        Tensor tensor;
+        // Skips incidental non-tensor attributes (e.g. the module's
+        // `training` flag).
+        if (archive.try_read(key, tensor)) {
+          result.insert(key, std::move(tensor));
+        }
+      }
+      next_pending.assign(deferred.begin(), deferred.end());
+    } else {
+      for (const auto& key : pending) {
+        Tensor tensor;
+        if (archive.try_read(key, tensor)) {
+          result.insert(key, std::move(tensor));
+        } else if (deferred.count(key) > 0) {
+          // Unchanged at this level too; resolve from the next base archive.
+          next_pending.push_back(key);
+        } else {
+          TORCH_CHECK(
+              false,
+              "Delta checkpoint chain ending in '", current,
+              "' does not contain tensor '", key, "'");
+        }
+      }
+    }
+
+    if (next_pending.empty()) {
+      return result;
+    }
+    TORCH_CHECK(
+        base.isString(),
+        "Archive '", current, "' defers keys but names no base archive");
+    current = base.toStringRef();
+    pending = std::move(next_pending);
+    top_level = false;
+  }
+}
+
+} // namespace serialize
+} // namespace torch
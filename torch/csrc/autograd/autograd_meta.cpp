@@ -96,6 +96,28 @@ namespace {
     auto res = new_tensor.as_strided(base.sizes(), base.strides(), base.storage_offset());
     return res;
   }
+
+  // Batched variant of new_with_same_meta: each batch entry has the same
+  // metadata as base, and the batch is an outermost dimension striding over
+  // whole storages so that per-entry views behave exactly like views of base.
+  // See Note [Batched forward grad]
+  Tensor new_batched_with_same_meta(const Variable& base, int64_t batch_size) {
+    // Explicit type here to appease Windows build
+    int64_t nelement_in_storage = base.storage().nbytes() / base.itemsize();
+    auto new_tensor = at::zeros({batch_size * nelement_in_storage}, base.options());
+    std::vector<int64_t> sizes{batch_size};
+    sizes.insert(sizes.end(), base.sizes().begin(), base.sizes().end());
+    std::vector<int64_t> strides{nelement_in_storage};
+    strides.insert(strides.end(), base.strides().begin(), base.strides().end());
+    return new_tensor.as_strided(sizes, strides, base.storage_offset());
+  }
+
+  // Check if grad is a batched tangent for base: one extra leading (batch)
+  // dimension on top of base's exact sizes. See Note [Batched forward grad]
+  bool is_batched_fw_grad(const Variable& base, const Variable& grad) {
+    return grad.dim() == base.dim() + 1 &&
+        grad.sizes().slice(1).equals(base.sizes());
+  }
 } // anonymous namespace
 
 // This function is will ensure that the fw_grad_ is properly a view of the base for inplace ops on
@@ -123,11 +145,21 @@ void AutogradMeta::set_fw_grad(const Variable& new_grad_, const Variable& self,
     // TODO(alband) remove this spurious version counter bump
     auto new_grad = new_grad_;
 
-    TORCH_CHECK(self.is_same_size(new_grad_), "Trying to set a forward gradient that has a different size than that "
+    // A tangent may carry one extra leading batch dimension so that a single
+    // forward pass computes one JVP per batch entry.
+    // See Note [Batched forward grad]
+    const bool is_batched = is_batched_fw_grad(self, new_grad_);
+    TORCH_CHECK(self.is_same_size(new_grad_) || is_batched, "Trying to set a forward gradient that has a different size than that "
                 "of the original Tensor, this is not supported. Tensor is of size ", self.sizes(), " while the given "
                 "forward gradient is of size ", new_grad_.sizes(), ".");
+    if (is_batched) {
+      // The level keeps all batched tangents aligned on the same batch size.
+      ForwardADLevel::get_by_idx(level)->set_batch_size(new_grad_.size(0));
+    }
 
     if (is_inplace_op && is_view_) {
+      TORCH_CHECK(!is_batched, "In-place updates of a view without a forward gradient are not "
+                  "supported with batched tangents.");
       auto this_view_meta = static_cast<DifferentiableViewMeta*>(this);
 
       // For inplace ops on a Tensor that does not already have a forward grad and is a view, we propagate
@@ -170,8 +202,16 @@ void AutogradMeta::set_fw_grad(const Variable& new_grad_, const Variable& self,
       }
     }
 
-    // Enforce the basic layout constraint
-    if (!has_same_meta(new_grad, self)) {
+    // Enforce the basic layout constraint. For batched tangents it applies
+    // per batch entry, with the batch striding over whole storages, so that
+    // views of self translate into per-entry views of the tangent.
+    if (is_batched) {
+      if (!has_same_meta(new_grad[0], self)) {
+        Tensor new_grad_with_meta = new_batched_with_same_meta(self, new_grad.size(0));
+        new_grad_with_meta.copy_(new_grad);
+        new_grad = new_grad_with_meta;
+      }
+    } else if (!has_same_meta(new_grad, self)) {
       Tensor new_grad_with_meta = new_with_same_meta(self);
       new_grad_with_meta.copy_(new_grad);
       new_grad = new_grad_with_meta;
@@ -205,7 +245,19 @@ const Variable& AutogradMeta::fw_grad(uint64_t level, const Variable& self) cons
         this_view_meta->fw_grad_ = std::make_shared<ForwardGrad>();
 
         Variable new_val;
-        if (view_info.has_view_fn()) {
+        if (is_batched_fw_grad(base, base_val)) {
+          // The base carries a batched tangent: view every batch entry the
+          // same way self views its base. The layout constraint guarantees
+          // each entry has the base's metadata, so self's sizes/strides/
+          // offset are valid within an entry. See Note [Batched forward grad]
+          TORCH_CHECK(!view_info.has_view_fn(), "Views created with a custom view function are not "
+                      "supported with batched tangents.");
+          std::vector<int64_t> sizes{base_val.size(0)};
+          sizes.insert(sizes.end(), self.sizes().begin(), self.sizes().end());
+          std::vector<int64_t> strides{base_val.stride(0)};
+          strides.insert(strides.end(), self.strides().begin(), self.strides().end());
+          new_val = base_val.as_strided(sizes, strides, self.storage_offset());
+        } else if (view_info.has_view_fn()) {
           new_val = view_info.view_fn()(base_val);
         } else {
           new_val = base_val.as_strided(self.sizes(), self.strides(), self.storage_offset());
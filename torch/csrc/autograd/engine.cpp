@@ -18,6 +18,7 @@
 #include <c10/util/Optional.h>
 #include <c10/core/StreamGuard.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -67,6 +68,13 @@ static void track_bad_autograd_forks() {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 static thread_local int worker_device = NO_DEVICE;
 
+// Index of this thread in Engine::cpu_ready_queues_ if it is a CPU pool
+// worker, -1 otherwise. Used to pick a steal victim starting point so that
+// concurrent stealers fan out over different queues.
+// See Note [CPU work stealing]
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static thread_local int cpu_pool_worker_id = -1;
+
 // This variable is true if ALL invocations in the stack of re-entrant engine
 // invocations are imperative backwards. This special variable is needed for the
 // gradient checkpointing feature only.
@@ -164,6 +172,51 @@ static thread_local std::shared_ptr<ReadyQueue> local_ready_queue = nullptr;
 // the leaf streams with the default streams is sufficient to implement
 // the historic behavior.
 
+// Note [Stream-parallel backwards]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Running every function on its forward stream (see Note [Streaming
+// backwards]) serializes independent branches of the graph whenever the
+// forward ran them on one stream, which is the common case. When a function
+// becomes ready while other ready work is already queued for its device,
+// the engine diverts it to a stream from the device's global pool instead:
+// an event recorded on the function's forward stream carries the
+// input-ready guarantee established by InputBuffer::add over to the pool
+// stream, and all downstream synchronization (input buffer accumulation at
+// join points, leaf stream syncs) then uses the stream the function
+// actually ran on. Joins at accumulation points therefore keep working
+// exactly as before - InputBuffer::add records an event on the producer's
+// stream and blocks the consumer's stream on it.
+//
+// The diversion is only attempted when the device's ready queue is
+// non-empty, i.e. when there really are independent branches to overlap,
+// and can be switched off with TORCH_AUTOGRAD_STREAM_PARALLEL_BACKWARD=0.
+
+// Note [CPU work stealing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// Historically all CPU work of a backward call was drained from the single
+// per-GraphTask cpu_ready_queue_ by the thread that invoked the backward, so
+// independent branches of a CPU graph executed serially even on machines
+// with many cores. The engine now also maintains a pool of CPU worker
+// threads sized to std::thread::hardware_concurrency (overridable with
+// TORCH_AUTOGRAD_CPU_WORKERS; 0 disables the pool), each owning one of the
+// queues in cpu_ready_queues_. Newly ready CPU NodeTasks are scattered
+// round-robin across those queues, and a CPU worker whose own queue runs
+// dry steals from a sibling queue before going back to sleep, so
+// independent branches of the graph actually run concurrently.
+//
+// Only work scheduled through the graph task's own cpu_ready_queue_ is
+// diverted to the pool (see ready_queue_for_push): the distributed engine
+// passes private queues into evaluate_function and drains them until empty,
+// and its tasks must stay where it put them. Completion detection still
+// flows through GraphTask::outstanding_tasks_, but because several threads
+// with worker_device == CPU_DEVICE can now finish work for one graph task,
+// the end-of-task wakeup in thread_main compares ready queues rather than
+// worker devices when deciding whether the owner needs a dummy task.
+//
+// Each queue keeps the existing reentrant-depth-first ordering locally and
+// a steal takes the victim's highest priority task, so deeper reentrant
+// work is still drained first even though there is no global order anymore.
+
 int NodeTask::getReentrantDepth() const {
   std::shared_ptr<GraphTask> graph_task = base_.lock();
   if (graph_task) {
@@ -222,6 +275,17 @@ auto ReadyQueue::pop() -> NodeTask {
   return task;
 }
 
+auto ReadyQueue::tryPop() -> c10::optional<NodeTask> {
+  // Lock mutex for accesses to heap_
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (heap_.empty()) {
+    return c10::nullopt;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto task = std::move(const_cast<NodeTask&>(heap_.top())); heap_.pop();
+  return c10::optional<NodeTask>(std::move(task));
+}
+
 bool ReadyQueue::empty() const {
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
@@ -252,10 +316,16 @@ void Engine::stop() {
   for (auto& queue: device_ready_queues_) {
     noBackward =  noBackward && queue->empty();
   }
+  for (auto& queue: cpu_ready_queues_) {
+    noBackward =  noBackward && queue->empty();
+  }
   if (noBackward && wait_duration > 0.0f) {
     for (auto& queue : device_ready_queues_) {
      queue->pushShutdownTask();
     }
+    for (auto& queue : cpu_ready_queues_) {
+     queue->pushShutdownTask();
+    }
     // Do not wait for termination of global threads on Windows
     // Because CRT terminates DLL threads before calling
     // global object destructors
@@ -392,7 +462,20 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // Scope this block of execution since NodeTask is not needed after this
       // block and can be deallocated (release any references to grad tensors
       // as part of inputs_).
-      NodeTask task = local_ready_queue->pop();
+      NodeTask task = [&]() -> NodeTask {
+        if (worker_device == CPU_DEVICE && !cpu_ready_queues_.empty()) {
+          // CPU threads drain their own queue first and then try to steal
+          // from a sibling CPU pool queue before going to sleep.
+          // See Note [CPU work stealing]
+          if (auto local_task = local_ready_queue->tryPop()) {
+            return std::move(*local_task);
+          }
+          if (auto stolen_task = steal_cpu_task()) {
+            return std::move(*stolen_task);
+          }
+        }
+        return local_ready_queue->pop();
+      }();
       // This will only work if the worker is running a non backward task
       // TODO Needs to be fixed this to work in all cases
       if (task.isShutdownTask_) {
@@ -437,12 +520,16 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // If it has work, it might see that graph_task->outstanding_tasks_ == 0
       // before it gets to the task, but it's a no-op anyway.
       //
-      // NB: This is not necessary if the current thread is the owning thread.
-      if (worker_device != base_owner) {
+      // NB: This is not necessary if the owning thread pops from the same
+      // queue as the current thread. We compare queues rather than worker
+      // devices because several CPU threads with distinct queues may work
+      // on one graph task; see Note [CPU work stealing]
+      auto owner_queue =
+          ready_queue_by_index(local_graph_task->cpu_ready_queue_, base_owner);
+      if (owner_queue != local_ready_queue) {
         // Synchronize outstanding_tasks_ with queue mutex
         std::atomic_thread_fence(std::memory_order_release);
-        ready_queue_by_index(local_graph_task->cpu_ready_queue_, base_owner)
-            ->push(NodeTask(local_graph_task, nullptr, InputBuffer(0)));
+        owner_queue->push(NodeTask(local_graph_task, nullptr, InputBuffer(0)));
       }
     }
   }
@@ -708,7 +795,13 @@ static variable_list call_function(
     auto inputs_copy = inputs;
     outputs = fn(std::move(inputs_copy));
   } else {
+    // NOLINTNEXTLINE(bugprone-use-after-move)
     outputs = fn(std::move(inputs));
+    // The apply above was the inputs' last use (they are only kept alive
+    // past it to feed post hooks); release whatever the node did not
+    // consume now, so the buffers can be reused by downstream allocations
+    // instead of only dying at scope exit.
+    inputs.clear();
   }
 
   validate_outputs(fn.next_edges(), outputs, [&](const std::string& msg) {
@@ -724,6 +817,53 @@ static variable_list call_function(
   return outputs;
 }
 
+// Cached kill switch for Note [Stream-parallel backwards]. Set
+// TORCH_AUTOGRAD_STREAM_PARALLEL_BACKWARD=0 to keep every function on its
+// forward stream.
+static bool stream_parallel_backward_enabled() {
+  static const bool enabled = []() {
+    const auto* env = getenv("TORCH_AUTOGRAD_STREAM_PARALLEL_BACKWARD");
+    return env == nullptr || std::string(env) != "0";
+  }();
+  return enabled;
+}
+
+// Note [Anticipated execution]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Some nodes have work that does not depend on their input gradients, the
+// prime example being checkpointed segments that must recompute their
+// forward before they can run backward. Left to Node::apply, that
+// recomputation serializes with the rest of the backward pass. Instead, the
+// first time the engine buffers a gradient for a node that is still waiting
+// on other inputs, it asks the node (via should_anticipate) whether it has
+// such work and, if so, dispatches Node::anticipate on the interop thread
+// pool. By the time the last input gradient arrives the recomputation has
+// been overlapping with the other branches' gradient kernels, and apply
+// only has to pick up the result.
+//
+// Each node is anticipated at most once per backward: the trigger sits on
+// the path that creates the node's InputBuffer, which runs exactly once
+// (under graph_task->mutex_). Nodes whose first gradient also makes them
+// ready are not anticipated — they are about to run anyway, so there is
+// nothing to overlap with. Because the launched closure can run
+// concurrently with apply (or after it, if the pool is backed up),
+// anticipate implementations must synchronize with apply. Errors are
+// swallowed here with a warning: apply falls back to doing the work itself
+// and surfaces the real failure on the normal error path.
+static void anticipate_node(
+    const std::shared_ptr<GraphTask>& graph_task,
+    const std::shared_ptr<Node>& fn) {
+  // The closure keeps both the node and the graph task alive; holding the
+  // graph task pins the autograd graph for the duration of the call.
+  at::launch([graph_task, fn]() {
+    try {
+      fn->anticipate();
+    } catch (std::exception& e) {
+      TORCH_WARN("Anticipated execution of ", fn->name(), " failed: ", e.what());
+    }
+  });
+}
+
 void Engine::evaluate_function(
     std::shared_ptr<GraphTask>& graph_task,
     Node* func,
@@ -755,8 +895,24 @@ void Engine::evaluate_function(
   // always saves ThreadLocalState without grad_mode.
   at::ThreadLocalStateGuard tls_guard(graph_task->thread_locals_);
 
-  // Switches to a function's CUDA stream (if applicable) before calling it
-  const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
+  // Switches to a function's CUDA stream (if applicable) before calling it.
+  // If other ready work is already queued for this device, divert the
+  // function to a pool stream so independent branches of the graph overlap
+  // on the GPU; see Note [Stream-parallel backwards]
+  auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
+  if (opt_parent_stream && stream_parallel_backward_enabled() &&
+      ready_queue_size(graph_task, opt_parent_stream->device()) > 0) {
+    const c10::impl::VirtualGuardImpl guard(c10::DeviceType::CUDA);
+    auto side_stream = guard.getStreamFromGlobalPool(opt_parent_stream->device());
+    if (side_stream != *opt_parent_stream) {
+      // The inputs were made safe for consumption on the forward stream by
+      // InputBuffer::add; carry that guarantee over to the pool stream.
+      auto event = c10::Event{c10::DeviceType::CUDA};
+      event.record(*opt_parent_stream);
+      side_stream.wait(event);
+      opt_parent_stream = side_stream;
+    }
+  }
   c10::OptionalStreamGuard parent_stream_guard{opt_parent_stream};
 
   auto outputs = call_function(graph_task, func, inputs);
@@ -832,10 +988,17 @@ void Engine::evaluate_function(
                        opt_next_stream);
 
       if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
+        auto queue =
+            ready_queue_for_push(graph_task, cpu_ready_queue, input_buffer.device());
         queue->push(
             NodeTask(graph_task, next.function, std::move(input_buffer)));
       } else {
+        // First gradient for a node that is still waiting on other inputs:
+        // let it start its gradient-independent work in the background.
+        // See Note [Anticipated execution]
+        if (next.function->should_anticipate()) {
+          anticipate_node(graph_task, next.function);
+        }
         not_ready.emplace(next.function.get(), std::move(input_buffer));
       }
     } else {
@@ -849,7 +1012,8 @@ void Engine::evaluate_function(
                        opt_parent_stream,
                        opt_next_stream);
       if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
+        auto queue =
+            ready_queue_for_push(graph_task, cpu_ready_queue, input_buffer.device());
         queue->push(
             NodeTask(graph_task, next.function, std::move(input_buffer)));
         not_ready.erase(not_ready_it);
@@ -894,6 +1058,73 @@ auto Engine::compute_dependencies(Node* root, GraphTask& task, uint64_t min_topo
   }
 }
 
+// Note [Dependency cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// When backward runs repeatedly over the same retained graph (keep_graph
+// with a static training graph), compute_dependencies re-traverses every
+// edge on every call only to reproduce the same counts. The engine keeps
+// the dependency maps of the last few executed graphs, keyed by the root
+// edge set and min_topo_nr. An entry is only reused when every cached
+// std::weak_ptr<Node> root locks to the exact node passed in, which rules
+// out stale hits from recycled Node addresses: as long as the roots are
+// alive, their next_edges (fixed when the graph was recorded) keep the
+// rest of the graph alive and unchanged, so the cached counts are valid
+// and a copy of the map replaces the traversal. Fresh graphs built each
+// iteration simply miss and are computed as before.
+static constexpr size_t kDependenciesCacheMaxEntries = 8;
+
+void Engine::compute_dependencies_cached(
+    const edge_list& roots,
+    Node* graph_root,
+    GraphTask& task,
+    uint64_t min_topo_nr) {
+  {
+    std::lock_guard<std::mutex> lock(dependencies_cache_mutex_);
+    for (const auto& entry : dependencies_cache_) {
+      if (entry.min_topo_nr != min_topo_nr ||
+          entry.roots.size() != roots.size()) {
+        continue;
+      }
+      bool match = true;
+      for (size_t i = 0; i < roots.size(); i++) {
+        if (entry.roots[i].lock() != roots[i].function) {
+          match = false;
+          break;
+        }
+      }
+      if (match) {
+        // The engine consumes the counts during execution, so hand out a copy.
+        task.dependencies_ = entry.dependencies;
+        return;
+      }
+    }
+  }
+
+  compute_dependencies(graph_root, task, min_topo_nr);
+
+  std::lock_guard<std::mutex> lock(dependencies_cache_mutex_);
+  // Evict entries whose graphs are gone before making room for the new one.
+  dependencies_cache_.erase(
+      std::remove_if(
+          dependencies_cache_.begin(),
+          dependencies_cache_.end(),
+          [](const CachedGraphDependencies& entry) {
+            return entry.roots.empty() || entry.roots[0].expired();
+          }),
+      dependencies_cache_.end());
+  if (dependencies_cache_.size() >= kDependenciesCacheMaxEntries) {
+    dependencies_cache_.erase(dependencies_cache_.begin());
+  }
+  CachedGraphDependencies entry;
+  entry.roots.reserve(roots.size());
+  for (const auto& root : roots) {
+    entry.roots.emplace_back(root.function);
+  }
+  entry.min_topo_nr = min_topo_nr;
+  entry.dependencies = task.dependencies_;
+  dependencies_cache_.push_back(std::move(entry));
+}
+
 auto Engine::execute(const edge_list& roots,
                      const variable_list& inputs,
                      bool keep_graph,
@@ -925,8 +1156,10 @@ auto Engine::execute(const edge_list& roots,
     std::make_shared<GraphRoot>(roots, inputs);
 
   auto min_topo_nr = compute_min_topological_nr(outputs);
-  // Now compute the dependencies for all executable functions
-  compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+  // Now compute the dependencies for all executable functions, reusing the
+  // counts from a previous backward over the same retained graph when
+  // possible. See Note [Dependency cache]
+  compute_dependencies_cached(roots, graph_root.get(), *graph_task, min_topo_nr);
 
   if (!outputs.empty()) {
     graph_task->init_to_execute(*graph_root, outputs, accumulate_grad, min_topo_nr);
@@ -972,7 +1205,8 @@ std::shared_ptr<at::ivalue::Future> Engine::execute_with_graph_task(
   // Lock mutex for GraphTask.
   std::unique_lock<std::mutex> lock(graph_task->mutex_);
 
-  auto queue = ready_queue(graph_task->cpu_ready_queue_, input_buffer.device());
+  auto queue = ready_queue_for_push(
+      graph_task, graph_task->cpu_ready_queue_, input_buffer.device());
 
   // worker_device == NO_DEVICE it's a CPU thread and it's trying to drive the
   // autograd engine with corresponding GraphTask, and its NOT a re-entrant call
@@ -1103,6 +1337,49 @@ auto Engine::ready_queue(std::shared_ptr<ReadyQueue> cpu_ready_queue, at::Device
   }
 }
 
+// CPU-bound work normally lands on the graph task's cpu_ready_queue_; with
+// the CPU pool enabled it is scattered round-robin over the workers' queues
+// instead. Work scheduled through any other queue (the distributed engine
+// passes in private queues that it drains itself) is left alone.
+// See Note [CPU work stealing]
+auto Engine::ready_queue_for_push(
+    const std::shared_ptr<GraphTask>& graph_task,
+    const std::shared_ptr<ReadyQueue>& cpu_ready_queue,
+    at::Device device) -> std::shared_ptr<ReadyQueue> {
+  if ((device.type() == at::kCPU || device.type() == at::DeviceType::Meta) &&
+      !cpu_ready_queues_.empty() &&
+      cpu_ready_queue == graph_task->cpu_ready_queue_) {
+    return cpu_ready_queues_[next_cpu_ready_queue_++ % cpu_ready_queues_.size()];
+  }
+  return ready_queue(cpu_ready_queue, device);
+}
+
+auto Engine::steal_cpu_task() -> c10::optional<NodeTask> {
+  const auto num_queues = cpu_ready_queues_.size();
+  // Start at this worker's successor (or at the round-robin cursor for CPU
+  // threads outside the pool) so concurrent stealers spread over different
+  // victims instead of all hitting the first queue.
+  const size_t start = cpu_pool_worker_id >= 0
+      ? static_cast<size_t>(cpu_pool_worker_id) + 1
+      : next_cpu_ready_queue_.load() % num_queues;
+  for (size_t i = 0; i < num_queues; ++i) {
+    const auto& queue = cpu_ready_queues_[(start + i) % num_queues];
+    if (queue == local_ready_queue) {
+      continue;
+    }
+    if (auto task = queue->tryPop()) {
+      if (task->isShutdownTask_) {
+        // Shutdown tasks are addressed to the queue's own worker; put it
+        // back so that worker actually exits.
+        queue->pushShutdownTask();
+        continue;
+      }
+      return task;
+    }
+  }
+  return c10::nullopt;
+}
+
 auto Engine::ready_queue_by_index(std::shared_ptr<ReadyQueue> cpu_ready_queue, int device_index) -> std::shared_ptr<ReadyQueue> {
   if (device_index == CPU_DEVICE) {
     // return the cpu ready queue passed in
@@ -1118,6 +1395,22 @@ auto Engine::ready_queue_by_index(std::shared_ptr<ReadyQueue> cpu_ready_queue, i
   }
 }
 
+// Number of threads in the work-stealing CPU pool, overridable with
+// TORCH_AUTOGRAD_CPU_WORKERS. 0 disables the pool and restores the
+// historic behavior of running all CPU work on the calling thread.
+// See Note [CPU work stealing]
+static size_t num_cpu_pool_workers() {
+  const auto* num_workers_str = getenv("TORCH_AUTOGRAD_CPU_WORKERS");
+  if (num_workers_str) {
+    const auto num_workers = std::atoi(num_workers_str);
+    return num_workers > 0 ? static_cast<size_t>(num_workers) : 0;
+  }
+  const auto hardware_concurrency = std::thread::hardware_concurrency();
+  // A pool of one adds a thread hop over running on the calling thread
+  // without buying any parallelism, so don't bother.
+  return hardware_concurrency > 1 ? static_cast<size_t>(hardware_concurrency) : 0;
+}
+
 auto Engine::start_device_threads() -> void {
   // See Note [Allocating GPUs to autograd threads]
   c10::DeviceIndex num_devices = 0;
@@ -1136,16 +1429,35 @@ auto Engine::start_device_threads() -> void {
     queue.reset(new ReadyQueue());
   }
 
+  // The work-stealing CPU pool, one queue per worker.
+  // See Note [CPU work stealing]
+  const size_t num_cpu_workers = num_cpu_pool_workers();
+  cpu_ready_queues_ = std::vector<std::shared_ptr<ReadyQueue>>(num_cpu_workers);
+  for (auto& queue : cpu_ready_queues_) {
+    // NOLINTNEXTLINE(modernize-make-shared)
+    queue.reset(new ReadyQueue());
+  }
+
   thread_pool_shared_ = std::make_shared<ThreadPoolShared>();
 
   for (int i = 0; i < num_devices; ++i) {
     std::thread t(&Engine::thread_init, this, i, device_ready_queues_[i], true);
     t.detach();
   }
+  for (size_t i = 0; i < num_cpu_workers; ++i) {
+    // thread_init is virtual, so the pool workers get the same thread state
+    // setup (e.g. PythonEngine's) as the device threads.
+    std::thread t([this, i]() {
+      cpu_pool_worker_id = static_cast<int>(i);
+      this->thread_init(CPU_DEVICE, cpu_ready_queues_[i], /*should_increment=*/true);
+    });
+    t.detach();
+  }
   // Wait for the threads to start
   {
     std::unique_lock<std::mutex> lk(non_reentrant_device_thread_mutex_);
-    while(non_reentrant_device_thread_count_.load() != static_cast<uint32_t>(num_devices)) {
+    const auto num_threads = static_cast<uint32_t>(num_devices) + num_cpu_workers;
+    while(non_reentrant_device_thread_count_.load() != num_threads) {
       non_reentrant_device_thread_condvar_.wait(lk);
     }
   }
@@ -11,6 +11,7 @@
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/input_buffer.h>
+#include <c10/util/Optional.h>
 
 #include <deque>
 #include <exception>
@@ -263,6 +264,9 @@ struct ReadyQueue {
   void push(NodeTask item, bool incrementOutstandingTasks = true);
   void pushShutdownTask();
   NodeTask pop();
+  // Non-blocking variant of pop() used by the work-stealing CPU workers;
+  // returns c10::nullopt when the queue is empty. See Note [CPU work stealing]
+  c10::optional<NodeTask> tryPop();
   bool empty() const;
   size_t size() const;
 };
@@ -339,6 +343,15 @@ struct TORCH_API Engine {
   Engine();
   void compute_dependencies(Node* root, GraphTask& task, uint64_t min_topo_nr);
 
+  // Like compute_dependencies, but reuses the dependency counts computed by
+  // an earlier backward over the same still-alive graph.
+  // See Note [Dependency cache]
+  void compute_dependencies_cached(
+      const edge_list& roots,
+      Node* graph_root,
+      GraphTask& task,
+      uint64_t min_topo_nr);
+
   // initialize the thread local ready queue with the ready queue that is created
   // elsewhere (i.e. thread_init, Engine::execute, etc), or create a new
   // ready queue if ready_queue is not provided.
@@ -350,6 +363,17 @@ struct TORCH_API Engine {
   std::shared_ptr<ReadyQueue> ready_queue_by_index(
       std::shared_ptr<ReadyQueue> cpu_ready_queue,
       int device_index);
+  // Selects the queue a newly ready NodeTask should be pushed to, scattering
+  // CPU work across the work-stealing CPU pool when the graph task is
+  // scheduled through its own cpu_ready_queue_.
+  // See Note [CPU work stealing]
+  std::shared_ptr<ReadyQueue> ready_queue_for_push(
+      const std::shared_ptr<GraphTask>& graph_task,
+      const std::shared_ptr<ReadyQueue>& cpu_ready_queue,
+      at::Device device);
+  // Pops a task from a sibling CPU pool queue, or returns c10::nullopt if
+  // all of them are empty. See Note [CPU work stealing]
+  c10::optional<NodeTask> steal_cpu_task();
   // start device threads (CUDA, XLA, etc.) in Engine,
   // note that it does NOT start CPU thread.
   void start_device_threads();
@@ -366,6 +390,31 @@ struct TORCH_API Engine {
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::vector<std::shared_ptr<ReadyQueue>> device_ready_queues_;
 
+  // One ready queue per work-stealing CPU pool worker. Initialized together
+  // with device_ready_queues_ in start_device_threads and safe to read
+  // without synchronization afterwards. Empty when the pool is disabled.
+  // See Note [CPU work stealing]
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::vector<std::shared_ptr<ReadyQueue>> cpu_ready_queues_;
+  // Round-robin cursor for scattering CPU work across cpu_ready_queues_
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::atomic<size_t> next_cpu_ready_queue_{0};
+
+  // Dependency counts of recently executed graphs, so that repeated
+  // backward calls over an unchanged graph skip the full traversal in
+  // compute_dependencies. Entries are validated by root node identity.
+  // See Note [Dependency cache]
+  struct CachedGraphDependencies {
+    std::vector<std::weak_ptr<Node>> roots;
+    uint64_t min_topo_nr;
+    std::unordered_map<Node*, int> dependencies;
+  };
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::vector<CachedGraphDependencies> dependencies_cache_;
+  // To protect reads and writes to dependencies_cache_
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::mutex dependencies_cache_mutex_;
+
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_
@@ -0,0 +1,60 @@
+#include <torch/csrc/autograd/flat_grad_buffer.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+namespace torch { namespace autograd {
+
+FlatGradBuffer::FlatGradBuffer(std::vector<Variable> parameters)
+    : parameters_(std::move(parameters)) {
+  TORCH_CHECK(
+      !parameters_.empty(),
+      "FlatGradBuffer requires at least one parameter.");
+
+  int64_t total_numel = 0;
+  const auto& first = parameters_[0];
+  for (const auto& param : parameters_) {
+    TORCH_CHECK(
+        param.defined() && param.is_leaf(),
+        "FlatGradBuffer parameters must be defined leaf tensors.");
+    TORCH_CHECK(
+        param.dtype() == first.dtype() && param.device() == first.device(),
+        "FlatGradBuffer parameters must share one dtype and device, got ",
+        param.dtype(), " on ", param.device(), " and ",
+        first.dtype(), " on ", first.device());
+    TORCH_CHECK(
+        param.layout() == at::kStrided && param.is_non_overlapping_and_dense(),
+        "FlatGradBuffer parameters must be strided, non-overlapping and dense.");
+    total_numel += param.numel();
+  }
+
+  flat_ = at::zeros({total_numel}, first.options());
+
+  views_.reserve(parameters_.size());
+  int64_t offset = 0;
+  for (const auto i : c10::irange(parameters_.size())) {
+    auto& param = parameters_[i];
+    // Match the parameter's own strides so the view obeys the "Gradient
+    // Layout Contract" (see accumulate_grad.h) and downstream optimizer
+    // kernels see the layout they expect.
+    auto view = flat_.as_strided(
+        param.sizes(), param.strides(), offset);
+    const auto& existing_grad = param.grad();
+    if (existing_grad.defined()) {
+      TORCH_CHECK(
+          !existing_grad.is_sparse(),
+          "FlatGradBuffer cannot absorb a sparse gradient.");
+      view.copy_(existing_grad);
+    }
+    param.mutable_grad() = view;
+    views_.push_back(std::move(view));
+    offset += param.numel();
+  }
+}
+
+void FlatGradBuffer::zero_() {
+  flat_.zero_();
+}
+
+}} // namespace torch::autograd
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <vector>
+
+namespace torch { namespace autograd {
+
+// FlatGradBuffer accumulates the gradients of a group of parameters into one
+// preallocated flat tensor instead of many individually allocated ones.
+//
+// On construction it allocates a single contiguous buffer large enough for
+// all of the parameters' gradients and points every parameter's .grad at a
+// view into it (copying over any already-accumulated grad). From then on
+// AccumulateGrad finds a defined grad and takes its in-place
+// "variable_grad += new_grad" path, so each backward writes straight into
+// the flat buffer: no per-parameter grad allocation, no stealing/cloning,
+// and a layout that flat optimizer updates and DDP-style bucketing can
+// consume directly. zero_() clears every gradient with a single kernel.
+//
+// Limitations: the parameters must share one dtype and device and be
+// non-overlapping and dense; and anything that replaces a parameter's grad
+// tensor out-of-place (double backward with create_graph, sparse grads,
+// manual `p.grad = ...`) detaches that parameter from the buffer until it
+// is re-registered.
+struct TORCH_API FlatGradBuffer {
+  explicit FlatGradBuffer(std::vector<Variable> parameters);
+
+  // The flat tensor holding all gradients back to back.
+  const at::Tensor& flat() const {
+    return flat_;
+  }
+
+  // Per-parameter views into flat(), in registration order.
+  const std::vector<at::Tensor>& views() const {
+    return views_;
+  }
+
+  // Zeroes all gradients with a single kernel.
+  void zero_();
+
+ private:
+  std::vector<Variable> parameters_;
+  at::Tensor flat_;
+  std::vector<at::Tensor> views_;
+};
+
+}} // namespace torch::autograd
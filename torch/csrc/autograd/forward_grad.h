@@ -83,6 +83,24 @@ struct ForwardGrad;
 // to be common.
 #define EXPECTED_MAX_LEVEL 2
 
+// Note [Batched forward grad]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Computing N JVPs of the same function normally takes N forward passes. To
+// amortize that, a tangent may carry one extra leading "batch" dimension of
+// size N: a Tensor of size [s0, ..., sk] can be given a tangent of size
+// [N, s0, ..., sk] and one forward pass computes all N JVPs at once.
+//
+// The batch size is a property of the level: the first batched tangent set
+// at a level fixes N (recorded here via set_batch_size) and every other
+// batched tangent at that level must use the same N, so that tangents of
+// different inputs stay aligned when a formula combines them. Unbatched and
+// batched tangents cannot be mixed within a level.
+//
+// Propagation reuses the existing JVP formulas unchanged: the batch
+// dimension rides along by broadcasting. This works for the elementwise and
+// broadcasting-based formulas that dominate pointwise math; formulas with
+// rank-sensitive ops (e.g. mm) will raise a shape error on batched
+// tangents, in which case the op needs an unbatched fall back.
 struct TORCH_API ForwardADLevel {
     ForwardADLevel(uint64_t idx): idx_(idx) {}
     ~ForwardADLevel();
@@ -102,10 +120,29 @@ struct TORCH_API ForwardADLevel {
         grads_.insert(grad);
     }
 
+    // See Note [Batched forward grad]. The first batched tangent of the
+    // level fixes the batch size; later ones must match it.
+    void set_batch_size(int64_t batch_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TORCH_CHECK(batch_size_ == 0 || batch_size_ == batch_size, "All batched tangents within a "
+                    "forward AD level must share the same batch size, but this level already has "
+                    "batched tangents of size ", batch_size_, " and a new tangent with batch size ",
+                    batch_size, " was given.");
+        batch_size_ = batch_size;
+    }
+
+    // Returns 0 if no batched tangent has been set at this level.
+    int64_t batch_size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batch_size_;
+    }
+
 private:
     std::unordered_set<std::shared_ptr<ForwardGrad>> grads_;
     std::mutex mutex_;
     uint64_t idx_;
+    // See Note [Batched forward grad]; 0 means unbatched.
+    int64_t batch_size_ = 0;
 
 };
 
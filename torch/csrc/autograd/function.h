@@ -6,6 +6,7 @@
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/autograd/saved_variable.h>
 #include <torch/csrc/autograd/input_metadata.h>
+#include <torch/csrc/autograd/slim_mode.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/utils/python_stub.h>
 #include <torch/csrc/utils/variadic.h>
@@ -119,13 +120,19 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
       assign_parent();
     }
 
-    // Store the thread_id of the forward operator.
-    // See NOTE [ Sequence Numbers ]
-    thread_id_ = at::RecordFunction::currentThreadId();
+    if (!slim_autograd_enabled()) {
+      // Store the thread_id of the forward operator.
+      // See NOTE [ Sequence Numbers ]
+      thread_id_ = at::RecordFunction::currentThreadId();
+    }
   }
 
+  // Slim autograd skips the sequence number: it only feeds profiler
+  // correlation and engine tie-breaking, neither of which affects results.
+  // See Note [Slim autograd]
   explicit Node(edge_list&& next_edges = edge_list())
-    : Node(/*sequence_nr=*/at::sequence_number::get_and_increment(),
+    : Node(/*sequence_nr=*/slim_autograd_enabled()
+        ? 0 : at::sequence_number::get_and_increment(),
     std::move(next_edges)) {}
 
   /// Nodes are neither copyable nor moveable.
@@ -144,7 +151,7 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
     at::NoNamesGuard no_names_guard;
 
     bool pre_sampled = false;
-    if (at::shouldRunRecordFunction(&pre_sampled)) {
+    if (!slim_autograd_enabled() && at::shouldRunRecordFunction(&pre_sampled)) {
       // Using RecordFunction to trigger observers in the backward pass
       at::RecordFunction guard(at::RecordScope::BACKWARD_FUNCTION, pre_sampled);
       if (guard.isActive()) {
@@ -453,6 +460,25 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
     return false;
   }
 
+  /// Returns true if this node has gradient-independent work it would like
+  /// to start before all of its input gradients have arrived, e.g.
+  /// recomputing a checkpointed forward segment. The engine calls this
+  /// while holding the GraphTask mutex, so implementations must be cheap
+  /// and, for Python nodes, must not take the GIL.
+  /// See Note [Anticipated execution] in engine.cpp.
+  virtual bool should_anticipate() const {
+    return false;
+  }
+
+  /// Performs the gradient-independent part of this node's work. Called at
+  /// most once per backward pass, from an interop worker thread, as soon
+  /// as the engine discovers the node is on the execution path but still
+  /// waiting on input gradients. May run concurrently with (or, rarely,
+  /// after) `apply()` on another thread, so implementations must
+  /// synchronize with it; `apply()` should fall back to doing the work
+  /// itself if anticipation has not finished.
+  virtual void anticipate() {}
+
  protected:
   /// Performs the `Node`'s actual operation.
   virtual variable_list apply(variable_list&& inputs) = 0;
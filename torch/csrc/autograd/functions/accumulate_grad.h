@@ -155,6 +155,27 @@ struct TORCH_API AccumulateGrad : public Node {
         auto result = new_grad + variable_grad;
         CHECK_RESULT(result, variable);
         update_grad(std::move(result));
+      } else if (variable_grad.is_sparse() && new_grad.is_sparse()) {
+        // `variable_grad += new_grad` for sparse tensors runs a
+        // coalesce-style merge of the two index lists and materializes the
+        // sum, every step. An uncoalesced sparse tensor already means
+        // "duplicate indices sum", so simply concatenating indices and
+        // values is an equally valid accumulation that costs a memcpy
+        // instead; the single coalesce() the consumer (e.g. the optimizer)
+        // performs when it reads the grad folds all the deferred duplicates
+        // at once. The uncoalesced bit on SparseTensorImpl is what marks
+        // the grad as needing that fold.
+        auto result = at::_sparse_coo_tensor_unsafe(
+            at::cat({variable_grad._indices(), new_grad._indices()}, 1),
+            at::cat({variable_grad._values(), new_grad._values()}, 0),
+            variable_grad.sizes(),
+            variable_grad.options());
+        // Prevent unbounded growth of nnz if the grad is never read
+        // (mirrors the heuristic in add_out_sparse_non_contiguous).
+        if (result._nnz() > result.numel()) {
+          result = result.coalesce();
+        }
+        update_grad(std::move(result));
       } else if (!at::inplaceIsVmapCompatible(variable_grad, new_grad)) {
         // Ideally we'd perform an in-place operation to avoid changing
         // the grad tensor. However, if that's impossible because the grads
@@ -167,12 +188,14 @@ struct TORCH_API AccumulateGrad : public Node {
         // In this case we can avoid changing the grad tensor. There are three
         // scenarios when we'll hit this case:
         //
-        // 1. `variable_grad` is sparse, and `new_grad` is sparse.
-        // 2. `variable_grad` is dense, and `new_grad` is sparse.
-        // 3. `variable_grad` is dense, and `new_grad` is dense.
-        // 4. `variable_grad` is mkldnn, and `new_grad` is mkldnn.
+        // 1. `variable_grad` is dense, and `new_grad` is sparse.
+        // 2. `variable_grad` is dense, and `new_grad` is dense.
+        // 3. `variable_grad` is mkldnn, and `new_grad` is mkldnn.
+        //
+        // (sparse += sparse is handled by the deferred-coalesce branch
+        // above.)
         //
-        // In all of these four cases, `variable_grad += new_grad` is a
+        // In all of these three cases, `variable_grad += new_grad` is a
         // valid operation which adds `new_grad` to `variable_grad` in
         // place. `variable_grad` is thus still referring to the same tensor
         // after the operation.
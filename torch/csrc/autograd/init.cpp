@@ -4,6 +4,7 @@
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/flat_grad_buffer.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <ATen/autocast_mode.h>
 #include <torch/csrc/autograd/profiler.h>
@@ -218,6 +219,12 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
     at::clearCallbacks();
   });
 
+  py::class_<torch::autograd::FlatGradBuffer>(m, "_FlatGradBuffer")
+      .def(py::init<std::vector<at::Tensor>>())
+      .def_property_readonly("flat", &torch::autograd::FlatGradBuffer::flat)
+      .def_property_readonly("views", &torch::autograd::FlatGradBuffer::views)
+      .def("zero_", &torch::autograd::FlatGradBuffer::zero_);
+
   Py_RETURN_TRUE;
 }
 
@@ -11,6 +11,49 @@
 
 namespace torch { namespace autograd {
 
+  namespace {
+  // Note [InputBuffer recycling]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Every NodeTask carries an InputBuffer, so a backward pass over a graph
+  // of small ops spends a measurable slice of its time allocating and
+  // freeing the underlying Variable vectors. InputBuffer lifetimes are
+  // strictly bounded by the backward call, so instead of returning retired
+  // storage to the allocator we park it in a thread-local freelist and hand
+  // it to the next InputBuffer constructed on the thread. Only the raw
+  // capacity is kept: Variables are released eagerly at destruction, same
+  // as before. A buffer may be constructed on one engine thread and
+  // destroyed on another; its storage then simply migrates to the
+  // destroying thread's freelist.
+  constexpr size_t kMaxPooledBuffers = 64;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static thread_local std::vector<std::vector<Variable>> buffer_pool;
+
+  std::vector<Variable> acquire_buffer(size_t size) {
+    if (!buffer_pool.empty()) {
+      auto buffer = std::move(buffer_pool.back());
+      buffer_pool.pop_back();
+      buffer.resize(size);
+      return buffer;
+    }
+    return std::vector<Variable>(size);
+  }
+
+  void recycle_buffer(std::vector<Variable>&& buffer) {
+    // Moved-from buffers have no capacity worth keeping.
+    if (buffer.capacity() == 0 || buffer_pool.size() >= kMaxPooledBuffers) {
+      return;
+    }
+    buffer.clear();
+    buffer_pool.push_back(std::move(buffer));
+  }
+  } // anonymous namespace
+
+  InputBuffer::InputBuffer(size_t size) : buffer(acquire_buffer(size)) {}
+
+  InputBuffer::~InputBuffer() {
+    recycle_buffer(std::move(buffer));
+  }
+
   static void accumulate(std::vector<Variable>& buffer,
                          const size_t pos,
                          Variable&& var) {
@@ -25,9 +68,25 @@ namespace torch { namespace autograd {
       } else {
           buffer[pos] = var + old_var;
       }
+    } else if (var.is_sparse()) {
+      if (old_var.is_contiguous() && old_var.storage().use_count() == 1) {
+          buffer[pos] = old_var.add_(var);
+      } else {
+          buffer[pos] = old_var + var;
+      }
     } else {
-      if (var.is_sparse() && !old_var.is_sparse() && old_var.is_contiguous() && old_var.storage().use_count() == 1) {
+      // Dense + dense: out-of-place addition would materialize a third
+      // buffer at the moment two gradients meet, which on memory-bound
+      // cards sets peak backward memory. When this buffer (resp. the
+      // incoming grad) is the sole owner of its tensor and storage, nothing
+      // else can observe the mutation and the sum can be accumulated in
+      // place, reusing one of the two buffers. Any outside reference (a
+      // saved variable, a hook, a user-held grad_output) keeps use counts
+      // above one and falls back to the allocation.
+      if (old_var.use_count() == 1 && old_var.storage().use_count() == 1) {
           buffer[pos] = old_var.add_(var);
+      } else if (var.use_count() == 1 && var.storage().use_count() == 1) {
+          buffer[pos] = var.add_(old_var);
       } else {
           buffer[pos] = old_var + var;
       }
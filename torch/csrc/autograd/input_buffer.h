@@ -17,8 +17,10 @@
 namespace torch { namespace autograd {
 
 struct InputBuffer {
-  explicit InputBuffer(size_t size)
-    : buffer(size) {}
+  // Storage comes from a thread-local freelist of retired buffers.
+  // See Note [InputBuffer recycling]
+  explicit InputBuffer(size_t size);
+  ~InputBuffer();
   InputBuffer(const InputBuffer& other) = delete;
   InputBuffer(InputBuffer&& other) = default;
   explicit InputBuffer(variable_list&& inputs): buffer(std::move(inputs)) {};
@@ -5,6 +5,7 @@
 #include <c10/core/DeviceType.h>
 #include <c10/core/Stream.h>
 #include <c10/core/impl/DeviceGuardImplInterface.h>
+#include <torch/csrc/autograd/slim_mode.h>
 
 #include <cstdint>
 
@@ -22,7 +23,12 @@ struct InputMetadata {
 
   InputMetadata(const at::TensorOptions options, at::IntArrayRef shape, at::Device device)
   : options_{options}, shape_{shape}, device_{device} {
-    stream_ = c10::impl::getDeviceGuardImpl(device_.type())->getStream(device_);
+    // A CPU device's current stream is always the default stream that
+    // stream_ is initialized with, so slim autograd skips the query.
+    // See Note [Slim autograd]
+    if (!(slim_autograd_enabled() && device_.is_cpu())) {
+      stream_ = c10::impl::getDeviceGuardImpl(device_.type())->getStream(device_);
+    }
   }
 
   InputMetadata(const at::Tensor& t)
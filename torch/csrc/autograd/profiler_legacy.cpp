@@ -153,6 +153,17 @@ inline const CUDAStubs*& cuda_stubs() {
 }
 }
 
+namespace {
+// Innermost-first stack of profiled ranges currently open on this thread,
+// used to attribute allocator events to the op that triggered them. Kept as
+// a plain thread local since ranges open and close on the same thread in the
+// common case; ranges popped from another thread (async ops) simply leave no
+// entry to erase here and are skipped in popRange.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::vector<std::pair<at::RecordFunctionHandle, at::StringView>>
+    active_op_stack_;
+} // namespace
+
 // Profiler state
 const ProfilerConfig& ProfilerThreadLocalState::config() const {
   return config_;
@@ -243,6 +254,7 @@ void ProfilerThreadLocalState::pushRange(
       evt.setStack(callstackStr(cs));
     }
 #endif
+    active_op_stack_.emplace_back(fn.handle(), fn.name());
     getEventList().record(std::move(evt));
   }
 }
@@ -265,19 +277,45 @@ void ProfilerThreadLocalState::popRange(const at::RecordFunction& fn, const bool
         record_cuda,
         fn.handle());
     evt.setNodeId(at::RecordFunction::getDefaultNodeId());
+    for (auto it = active_op_stack_.rbegin(); it != active_op_stack_.rend();
+         ++it) {
+      if (it->first == fn.handle()) {
+        active_op_stack_.erase(std::next(it).base());
+        break;
+      }
+    }
     getEventList(fn.threadId()).record(std::move(evt));
   }
 }
 
 void ProfilerThreadLocalState::reportMemoryUsage(
-    void* /* unused */,
+    void* ptr,
     int64_t alloc_size,
     c10::Device device) {
   if (config_.profile_memory && config_.state != ProfilerState::Disabled) {
     uint64_t thread_id = at::RecordFunction::currentThreadId();
+    // Attribute the event to the innermost profiled range active on this
+    // thread; a free is attributed to the op that made the matching
+    // allocation, so per-op live memory stays meaningful even when a
+    // different op (or no op at all) releases the buffer.
+    at::StringView name("");
+    if (alloc_size > 0) {
+      if (!active_op_stack_.empty()) {
+        name = active_op_stack_.back().second;
+      }
+      std::lock_guard<std::mutex> guard(state_mutex_);
+      allocation_sites_[ptr] = name.str();
+    } else {
+      std::lock_guard<std::mutex> guard(state_mutex_);
+      auto it = allocation_sites_.find(ptr);
+      if (it != allocation_sites_.end()) {
+        name = at::StringView(std::move(it->second));
+        allocation_sites_.erase(it);
+      }
+    }
     LegacyEvent evt(
         EventKind::MemoryAlloc,
-        at::StringView(""),
+        std::move(name),
         thread_id,
         config_.state == ProfilerState::CUDA);
     evt.updateMemoryStats(alloc_size, device);
@@ -720,6 +758,66 @@ void writeProfilerEventsToStream(std::ostream& out, const std::vector<LegacyEven
   out << "]\n";
 }
 
+std::vector<MemoryAttributionReport> computeMemoryAttribution(
+    const thread_event_lists& event_lists) {
+  std::vector<const LegacyEvent*> mem_events;
+  for (const auto& list : event_lists) {
+    for (const auto& evt : list) {
+      if (evt.kind() == EventKind::MemoryAlloc) {
+        mem_events.push_back(&evt);
+      }
+    }
+  }
+  // live/peak bookkeeping needs the order in which the allocator saw the
+  // events; memory events are stamped at report time, so sorting by
+  // timestamp reconstructs that order across threads
+  std::sort(
+      mem_events.begin(),
+      mem_events.end(),
+      [](const LegacyEvent* a, const LegacyEvent* b) {
+        return a->cpuUs() < b->cpuUs();
+      });
+  std::unordered_map<std::string, MemoryAttributionReport> reports;
+  for (const auto* evt : mem_events) {
+    auto& report = reports[evt->name()];
+    report.name = evt->name();
+    const int64_t cpu_bytes = evt->cpuMemoryUsage();
+    const int64_t cuda_bytes = evt->cudaMemoryUsage();
+    if (cpu_bytes > 0 || cuda_bytes > 0) {
+      report.alloc_count++;
+    }
+    if (cpu_bytes >= 0) {
+      report.cpu_alloc_bytes += cpu_bytes;
+    } else {
+      report.cpu_freed_bytes -= cpu_bytes;
+    }
+    report.cpu_live_bytes = report.cpu_alloc_bytes - report.cpu_freed_bytes;
+    report.cpu_peak_live_bytes =
+        std::max(report.cpu_peak_live_bytes, report.cpu_live_bytes);
+    if (cuda_bytes >= 0) {
+      report.cuda_alloc_bytes += cuda_bytes;
+    } else {
+      report.cuda_freed_bytes -= cuda_bytes;
+    }
+    report.cuda_live_bytes = report.cuda_alloc_bytes - report.cuda_freed_bytes;
+    report.cuda_peak_live_bytes =
+        std::max(report.cuda_peak_live_bytes, report.cuda_live_bytes);
+  }
+  std::vector<MemoryAttributionReport> result;
+  result.reserve(reports.size());
+  for (auto& kv : reports) {
+    result.push_back(std::move(kv.second));
+  }
+  std::sort(
+      result.begin(),
+      result.end(),
+      [](const MemoryAttributionReport& a, const MemoryAttributionReport& b) {
+        return std::max(a.cpu_peak_live_bytes, a.cuda_peak_live_bytes) >
+            std::max(b.cpu_peak_live_bytes, b.cuda_peak_live_bytes);
+      });
+  return result;
+}
+
 RecordProfile::RecordProfile(std::ostream& out)
 : out_(out) {
   init();
@@ -755,4 +853,114 @@ void RecordProfile::processEvents(const std::vector<LegacyEvent*>& events) {
   writeProfilerEventsToStream(out_, events);
 }
 
+RecordStreamingProfile::RecordStreamingProfile(
+    std::ostream& out,
+    int64_t flush_interval_ms)
+    : out_(out), flush_interval_ms_(flush_interval_ms) {
+  init();
+}
+
+RecordStreamingProfile::RecordStreamingProfile(
+    const std::string& filename,
+    int64_t flush_interval_ms)
+    : file_(new std::ofstream(filename)),
+      out_(*file_),
+      flush_interval_ms_(flush_interval_ms) {
+  init();
+}
+
+void RecordStreamingProfile::init() {
+  TORCH_CHECK(out_, "Could not open file");
+  enableProfilerLegacy(ProfilerConfig(ProfilerState::CPU));
+  state_ = std::static_pointer_cast<ProfilerThreadLocalState>(
+      c10::ThreadLocalDebugInfo::_peek(c10::DebugInfoKind::PROFILER_STATE));
+  // chrome://tracing tolerates a missing closing bracket, so events can be
+  // appended to the array as they complete; the bracket is still written on
+  // destruction so that well-formed JSON is produced on a clean shutdown
+  out_ << "[\n";
+  writer_ = std::thread([this]() { writerLoop(); });
+}
+
+RecordStreamingProfile::~RecordStreamingProfile() {
+  try {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      done_ = true;
+    }
+    cv_.notify_all();
+    writer_.join();
+    // with the writer thread stopped, disable the profiler and flush
+    // whatever was recorded after the last periodic drain
+    processEvents(disableProfilerLegacy());
+    out_ << "\n]\n";
+    out_.flush();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what() << std::endl;
+  } catch (...) {
+    LOG(ERROR) << "Unknown error" << std::endl;
+  }
+}
+
+void RecordStreamingProfile::writerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!done_) {
+    cv_.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_));
+    if (done_) {
+      break;
+    }
+    lock.unlock();
+    drain();
+    lock.lock();
+  }
+}
+
+void RecordStreamingProfile::drain() {
+  // consolidate() erases the events from the per-thread lists, so recording
+  // threads keep appending to (mostly) empty lists while we serialize
+  processEvents(state_->consolidate());
+  out_.flush();
+}
+
+void RecordStreamingProfile::processEvents(thread_event_lists&& event_lists) {
+  for (auto& list : event_lists) {
+    for (auto& evt : list) {
+      switch (evt.kind()) {
+        case EventKind::Mark:
+          if (!profiler_start_ && 0 == strcmp(evt.name(), "__start_profile")) {
+            profiler_start_ = std::make_unique<LegacyEvent>(evt);
+          }
+          break;
+        case EventKind::PushRange:
+          pending_.emplace(evt.handle(), std::move(evt));
+          break;
+        case EventKind::PopRange: {
+          auto it = pending_.find(evt.handle());
+          TORCH_CHECK(it != pending_.end(), "Unmatched pop event");
+          writeEvent(it->second, evt);
+          pending_.erase(it);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+}
+
+void RecordStreamingProfile::writeEvent(
+    const LegacyEvent& start,
+    const LegacyEvent& stop) {
+  TORCH_INTERNAL_ASSERT(profiler_start_, "Could not find __start_profile mark");
+  if (!first_event_) {
+    out_ << ",\n";
+  }
+  first_event_ = false;
+  jit::TemplateEnv env;
+  env.s("name", start.name());
+  env.d("ts", profiler_start_->cpuElapsedUs(start));
+  env.d("dur", start.cpuElapsedUs(stop));
+  env.d("tid", start.threadId());
+  out_ << event_template.format(env);
+}
+
 }}}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <condition_variable>
 #include <iostream>
 #include <mutex>
 #include <memory>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 #include <string>
@@ -454,6 +457,31 @@ TORCH_API ProfilerConfig getProfilerConfig();
 // Writes profiled events to a stream.
 TORCH_API void writeProfilerEventsToStream(std::ostream& out, const std::vector<LegacyEvent*>& events);
 
+// Per-op memory attribution computed from the MemoryAlloc events of a
+// memory-profiling run (profile_memory = true); see
+// computeMemoryAttribution. Allocations are attributed to the innermost
+// profiled range that was active on the allocating thread, frees to the op
+// that made the matching allocation, so live_bytes reflects what an op
+// allocated and has not been freed yet even when another op frees it.
+struct TORCH_API MemoryAttributionReport {
+  // op name; empty for events recorded outside of any profiled range
+  std::string name;
+  int64_t alloc_count = 0;
+  int64_t cpu_alloc_bytes = 0;
+  int64_t cpu_freed_bytes = 0;
+  int64_t cpu_live_bytes = 0;
+  int64_t cpu_peak_live_bytes = 0;
+  int64_t cuda_alloc_bytes = 0;
+  int64_t cuda_freed_bytes = 0;
+  int64_t cuda_live_bytes = 0;
+  int64_t cuda_peak_live_bytes = 0;
+};
+
+// Folds the memory events of the given profiling result into per-op reports,
+// sorted by decreasing peak live bytes.
+TORCH_API std::vector<MemoryAttributionReport> computeMemoryAttribution(
+    const thread_event_lists& event_lists);
+
 // Usage:
 //   {
 //     RecordProfile guard("filename.trace");
@@ -472,6 +500,51 @@ private:
   void processEvents(const std::vector<LegacyEvent*>& events);
 };
 
+struct ProfilerThreadLocalState;
+
+// Variant of RecordProfile for long, always-on traces: instead of holding
+// every event in memory until the guard is destroyed, a background thread
+// periodically drains completed events and appends them to the output in
+// chrome://tracing format, so memory usage is bounded by the flush interval
+// rather than by the trace duration (events are also dropped from memory as
+// soon as they are written out). The output stream must stay valid for the
+// lifetime of the guard; like RecordProfile, the guard must be created and
+// destroyed on the same thread.
+struct TORCH_API RecordStreamingProfile {
+  static constexpr int64_t kDefaultFlushIntervalMs = 200;
+
+  explicit RecordStreamingProfile(
+      std::ostream& out,
+      int64_t flush_interval_ms = kDefaultFlushIntervalMs);
+  explicit RecordStreamingProfile(
+      const std::string& filename,
+      int64_t flush_interval_ms = kDefaultFlushIntervalMs);
+
+  ~RecordStreamingProfile();
+
+ private:
+  void init();
+  void writerLoop();
+  void drain();
+  void processEvents(thread_event_lists&& event_lists);
+  void writeEvent(const LegacyEvent& start, const LegacyEvent& stop);
+
+  std::unique_ptr<std::ofstream> file_;
+  std::ostream& out_;
+  int64_t flush_interval_ms_;
+  std::shared_ptr<ProfilerThreadLocalState> state_;
+  // start events of the currently open ranges, keyed by record function
+  // handle; only the events recorded since the last drain plus the open
+  // ranges are held in memory
+  std::unordered_map<at::RecordFunctionHandle, LegacyEvent> pending_;
+  std::unique_ptr<LegacyEvent> profiler_start_;
+  bool first_event_ = true;
+  std::thread writer_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool done_ = false;
+};
+
 // A guard that enables the profiler, taking in an optional callback to process
 // the results
 // Usage:
@@ -553,7 +626,7 @@ struct TORCH_API ProfilerThreadLocalState : public c10::MemoryReportingInfoBase
   }
 
   void reportMemoryUsage(
-      void* /* unused */,
+      void* ptr,
       int64_t alloc_size,
       c10::Device device) override;
 
@@ -580,6 +653,10 @@ struct TORCH_API ProfilerThreadLocalState : public c10::MemoryReportingInfoBase
   at::CallbackHandle handle_ = 0;
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   c10::optional<std::vector<std::vector<LegacyEvent>>> remoteProfiledEvents_;
+  // Maps live allocations to the name of the op that made them, so frees can
+  // be attributed back to the allocating op; guarded by state_mutex_
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::unordered_map<const void*, std::string> allocation_sites_;
 };
 
 
@@ -201,6 +201,16 @@ auto PyNode::is_traceable() -> bool {
   return traceable_py_bool == Py_True;
 }
 
+auto PyNode::anticipate() -> void {
+  pybind11::gil_scoped_acquire gil;
+  THPObjectPtr forward_class {PyObject_GetAttrString(obj, "_forward_cls")};
+  if (!forward_class) throw_python_error();
+  THPObjectPtr anticipate_fn {PyObject_GetAttrString(forward_class, "anticipate")};
+  if (!anticipate_fn) throw_python_error();
+  THPObjectPtr r {PyObject_CallFunctionObjArgs(anticipate_fn.get(), obj, nullptr)};
+  if (!r) throw_python_error();
+}
+
 auto PyNode::release_variables() -> void {
   pybind11::gil_scoped_acquire gil;
   auto f = (THPFunction*) obj;
@@ -22,11 +22,30 @@ namespace torch { namespace autograd {
 // A Function which is implemented by a Python object (i.e., a THPFunction).
 // Calls to 'apply' are forwarded to the Python method implementation.
 struct PyNode : public Node {
-  PyNode(THPObjectPtr obj) : obj(obj.release()) {}
+  PyNode(THPObjectPtr obj) : obj(obj.release()) {
+    // Cache whether the function defines `anticipate` while we hold the
+    // GIL; should_anticipate() is called from the engine under the
+    // GraphTask mutex and must not take it. Legacy functions have no
+    // _forward_cls and never anticipate.
+    THPObjectPtr forward_cls(PyObject_GetAttrString(this->obj, "_forward_cls"));
+    if (forward_cls) {
+      has_anticipate_ = PyObject_HasAttrString(forward_cls.get(), "anticipate") != 0;
+    } else {
+      PyErr_Clear();
+    }
+  }
 
   variable_list apply(variable_list&& inputs) override;
   variable_list legacy_apply(const variable_list& inputs);
 
+  bool should_anticipate() const override {
+    return has_anticipate_;
+  }
+
+  // Calls `_forward_cls.anticipate(ctx)`. See Note [Anticipated execution]
+  // in engine.cpp.
+  void anticipate() override;
+
   // Throw a python_error with the PyErr state persisted, so that we
   // don't lose the error state if the GIL is released when we don't
   // have a PyThreadState created beforehand, this is made so that
@@ -45,6 +64,10 @@ struct PyNode : public Node {
   // THPFunction this Function is wrapping.  Owning!
   PyObject* obj;
 
+  // Whether obj's _forward_cls defines `anticipate`; cached at construction
+  // so should_anticipate() doesn't need the GIL.
+  bool has_anticipate_ = false;
+
   // NOLINTNEXTLINE(modernize-use-override)
   ~PyNode() {
     // Can't use THPObjectPtr as a field in this class; destructor won't take
@@ -0,0 +1,18 @@
+#include <torch/csrc/autograd/slim_mode.h>
+
+#include <cstdlib>
+
+namespace torch {
+namespace autograd {
+
+bool slim_autograd_enabled() {
+  // See Note [Slim autograd]
+  static const bool enabled = []() {
+    const auto* env = std::getenv("PYTORCH_SLIM_AUTOGRAD");
+    return env != nullptr && env[0] == '1' && env[1] == '\0';
+  }();
+  return enabled;
+}
+
+} // namespace autograd
+} // namespace torch
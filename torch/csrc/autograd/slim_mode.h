@@ -0,0 +1,27 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+namespace torch { namespace autograd {
+
+// Note [Slim autograd]
+// ~~~~~~~~~~~~~~~~~~~~
+// Production training jobs that never profile pay for profiler bookkeeping
+// on every recorded Node: a sequence number increment and a forward
+// thread-id capture (both only consumed by the profiler to correlate
+// backward nodes with forward ops), a current-stream query per recorded
+// input, and the RecordFunction observer check on every Node apply.
+//
+// Setting PYTORCH_SLIM_AUTOGRAD=1 strips those from the record and apply
+// hot paths. Functional behavior is unchanged: gradients, shape
+// validation, hooks and CUDA stream syncing all work as before (the
+// stream query is only skipped for CPU inputs, whose current stream is
+// always the default one). What you lose is profiler correlation of
+// backward nodes and the ability to trigger RecordFunction observers from
+// the backward pass, so the flag must not be combined with the profiler.
+//
+// The flag is read once and cached; it has to be set before the first
+// Node is recorded.
+TORCH_API bool slim_autograd_enabled();
+
+}} // namespace torch::autograd
@@ -431,6 +431,41 @@ PyObject * THCPModule_memorySnapshot(PyObject *_unused, PyObject *noargs)
   END_HANDLE_TH_ERRORS
 }
 
+PyObject * THCPModule_memoryTraceDump(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+
+  using c10::cuda::CUDACachingAllocator::TraceEntry;
+
+  const auto actionToString = [](TraceEntry::Action action) {
+    switch (action) {
+      case TraceEntry::ALLOC: return "alloc";
+      case TraceEntry::FREE: return "free";
+      case TraceEntry::SEGMENT_ALLOC: return "segment_alloc";
+      case TraceEntry::SEGMENT_FREE: return "segment_free";
+      case TraceEntry::OOM: return "oom";
+    }
+    return "unknown";
+  };
+
+  const std::vector<TraceEntry>& trace = c10::cuda::CUDACachingAllocator::snapshotTrace();
+  py::list result;
+
+  for (const auto& entry : trace) {
+    py::dict entryDict;
+    entryDict["action"] = actionToString(entry.action);
+    entryDict["device"] = entry.device;
+    entryDict["addr"] = entry.addr;
+    entryDict["size"] = entry.size;
+    entryDict["stream"] = reinterpret_cast<int64_t>(entry.stream);
+    entryDict["time_us"] = entry.time_us;
+    result.append(entryDict);
+  }
+
+  return result.release().ptr();
+  END_HANDLE_TH_ERRORS
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Cuda module initialization
 ////////////////////////////////////////////////////////////////////////////////
@@ -559,6 +594,7 @@ static struct PyMethodDef _THCPModule_methods[] = {
   {"_cuda_resetAccumulatedMemoryStats", THCPModule_resetAccumulatedMemoryStats, METH_O, nullptr},
   {"_cuda_resetPeakMemoryStats", THCPModule_resetPeakMemoryStats, METH_O,  nullptr},
   {"_cuda_memorySnapshot", THCPModule_memorySnapshot, METH_NOARGS, nullptr},
+  {"_cuda_memoryTraceDump", THCPModule_memoryTraceDump, METH_NOARGS, nullptr},
   {"_cuda_cudaHostAllocator", THCPModule_cudaHostAllocator, METH_NOARGS, nullptr},
   {"_cuda_cudaCachingAllocator_raw_alloc", THCPModule_cudaCachingAllocator_raw_alloc, METH_VARARGS, nullptr},
   {"_cuda_cudaCachingAllocator_raw_delete", THCPModule_cudaCachingAllocator_raw_delete, METH_O, nullptr},
@@ -155,5 +155,113 @@ void LoadBalancer::free(int where) {
   __atomic_fetch_sub(&uses_[8 * where], 1ULL, __ATOMIC_SEQ_CST);
 }
 
+bool LoadBalancer::tryTakeOutOfService(int where) {
+  uint64_t prev = 0;
+  return __atomic_compare_exchange_n(
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+      &uses_[8 * where],
+      &prev,
+      kOutOfService,
+      false,
+      __ATOMIC_SEQ_CST,
+      __ATOMIC_SEQ_CST);
+}
+
+void LoadBalancer::returnToService(int where) {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+  __atomic_store_n(&uses_[8 * where], 0ULL, __ATOMIC_SEQ_CST);
+}
+
+void InterpreterManager::setWarmup(
+    std::function<void(InterpreterSession&)> warmup) {
+  warmup_ = std::move(warmup);
+  if (!warmup_) {
+    return;
+  }
+  for (auto& interp : instances_) {
+    auto I = interp.acquire_session();
+    warmup_(I);
+  }
+}
+
+void InterpreterManager::startHealthMonitor(std::chrono::milliseconds interval) {
+  TORCH_CHECK(!health_monitor_.joinable(), "health monitor already running");
+  health_done_ = false;
+  health_monitor_ = std::thread([this, interval] {
+    healthMonitorLoop(interval);
+  });
+}
+
+void InterpreterManager::stopHealthMonitor() {
+  if (!health_monitor_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> guard(health_mutex_);
+    health_done_ = true;
+  }
+  health_cv_.notify_all();
+  health_monitor_.join();
+}
+
+bool InterpreterManager::healthy(size_t idx) {
+  try {
+    auto I = instances_[idx].acquire_session();
+    // any Python that round-trips successfully suffices as a liveness probe
+    I.global("sys", "maxsize");
+    return true;
+  } catch (const std::exception& e) {
+    TORCH_WARN(
+        "torch::deploy interpreter ", idx, " failed health check: ", e.what());
+    return false;
+  }
+}
+
+void InterpreterManager::rebuild(size_t idx) {
+  // construct the replacement first so a failure here leaves the old
+  // interpreter intact; Interpreter is move-constructible only, so swap it
+  // into the slot with destroy + placement-new. The load balancer has already
+  // taken this slot out of rotation, so no session can be using it.
+  Interpreter fresh(this);
+  instances_[idx].~Interpreter();
+  new (&instances_[idx]) Interpreter(std::move(fresh));
+  auto I = instances_[idx].acquire_session();
+  I.global("torch", "version").attr("__setattr__")({"interp", int(idx)});
+  if (warmup_) {
+    warmup_(I);
+  }
+}
+
+void InterpreterManager::healthMonitorLoop(std::chrono::milliseconds interval) {
+  std::unique_lock<std::mutex> lock(health_mutex_);
+  while (!health_done_) {
+    health_cv_.wait_for(lock, interval);
+    if (health_done_) {
+      break;
+    }
+    lock.unlock();
+    for (size_t i = 0; i < instances_.size(); ++i) {
+      if (healthy(i)) {
+        continue;
+      }
+      // replace only when no one is using the interpreter; otherwise leave it
+      // for the next pass rather than tearing down in-flight sessions
+      if (resources_.tryTakeOutOfService(static_cast<int>(i))) {
+        try {
+          rebuild(i);
+        } catch (const std::exception& e) {
+          TORCH_WARN(
+              "torch::deploy failed to rebuild interpreter ",
+              i,
+              ": ",
+              e.what());
+        }
+        resources_.returnToService(static_cast<int>(i));
+      }
+    }
+    lock.lock();
+  }
+}
+
 } // namespace deploy
 } // namespace torch
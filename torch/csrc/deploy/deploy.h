@@ -2,8 +2,12 @@
 // NOLINTNEXTLINE(modernize-deprecated-headers)
 #include <assert.h>
 #include <torch/csrc/deploy/interpreter/interpreter_impl.h>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -87,8 +91,16 @@ struct TORCH_API LoadBalancer {
   }
   int acquire();
   void free(int where);
+  // take an interpreter out of rotation so it can be torn down and rebuilt.
+  // only succeeds when the interpreter currently has no users; acquire() will
+  // not hand it out again until returnToService() is called.
+  bool tryTakeOutOfService(int where);
+  void returnToService(int where);
 
  private:
+  // larger than any real use count, so acquire()'s least-used scan never
+  // picks an interpreter that is being replaced
+  static constexpr uint64_t kOutOfService = UINT64_MAX;
   // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
   std::unique_ptr<uint64_t[]>
       uses_; // the approximate count of the number of users of interpreter
@@ -127,6 +139,24 @@ struct TORCH_API InterpreterManager {
   }
   Package load_package(const std::string& uri);
   Package load_package(std::shared_ptr<caffe2::serialize::ReadAdapterInterface> reader);
+
+  // run warmup on every interpreter now, and again on every interpreter the
+  // health monitor rebuilds, so a replacement comes back with its model
+  // already loaded (e.g. warmup can load a package and run one example batch)
+  // rather than paying first-request latency. Set this before starting the
+  // health monitor.
+  void setWarmup(std::function<void(InterpreterSession&)> warmup);
+
+  // periodically check that each interpreter can still run Python, and
+  // rebuild the ones that cannot. Replacement waits until an interpreter has
+  // no users, so in-flight sessions are never torn down.
+  void startHealthMonitor(
+      std::chrono::milliseconds interval = std::chrono::seconds(1));
+  void stopHealthMonitor();
+
+  ~InterpreterManager() {
+    stopHealthMonitor();
+  }
   InterpreterManager(const InterpreterManager&) = delete;
   InterpreterManager& operator=(const InterpreterManager&) = delete;
   InterpreterManager& operator=(InterpreterManager&&) = delete;
@@ -134,9 +164,17 @@ struct TORCH_API InterpreterManager {
  private:
   friend struct Package;
   friend struct InterpreterSession;
+  void healthMonitorLoop(std::chrono::milliseconds interval);
+  bool healthy(size_t idx);
+  void rebuild(size_t idx);
   size_t next_object_id_ = 0;
   std::vector<Interpreter> instances_;
   LoadBalancer resources_;
+  std::function<void(InterpreterSession&)> warmup_;
+  std::thread health_monitor_;
+  std::mutex health_mutex_;
+  std::condition_variable health_cv_;
+  bool health_done_ = false;
 };
 
 struct TORCH_API ReplicatedObjImpl {
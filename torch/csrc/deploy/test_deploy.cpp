@@ -125,3 +125,28 @@ TEST(TorchpyTest, ThreadedSimpleModel) {
     ASSERT_TRUE(ref_output.equal(outputs[i]));
   }
 }
+
+TEST(TorchpyTest, WarmPoolHealthMonitor) {
+  size_t nthreads = 2;
+  torch::deploy::InterpreterManager manager(nthreads);
+
+  // warmup runs on every interpreter up front (and again on any replacement),
+  // so request-time acquisition never pays import/load latency
+  std::atomic<size_t> warmups(0);
+  manager.setWarmup([&](torch::deploy::InterpreterSession& I) {
+    I.global("torch", "ones")({at::IValue(std::vector<int64_t>({2, 2}))});
+    ++warmups;
+  });
+  ASSERT_EQ(warmups.load(), nthreads);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+  manager.startHealthMonitor(std::chrono::milliseconds(10));
+  // interpreters are healthy, so the pool keeps serving while being probed
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+  for (int i = 0; i < 20; ++i) {
+    auto I = manager.acquire_one();
+    I.global("sys", "maxsize");
+  }
+  manager.stopHealthMonitor();
+  ASSERT_EQ(warmups.load(), nthreads);
+}
@@ -6,6 +6,7 @@
 #include <c10d/Utils.hpp>
 #ifndef _WIN32
 #include <c10d/HashStore.hpp>
+#include <c10d/ProcessGroupHierarchical.hpp>
 #include <c10d/ProcessGroupRoundRobin.hpp>
 #endif
 #include <c10d/ProcessGroup.hpp>
@@ -26,6 +27,7 @@
 #include <fmt/format.h>
 #include <pybind11/chrono.h>
 
+#include <c10d/FlightRecorder.hpp>
 #include <c10d/comm.hpp>
 #include <c10d/frontend.hpp>
 #include <c10d/logger.hpp>
@@ -299,9 +301,12 @@ Replaces the tensor in the bucket with the input tensor.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS``,
+``POWER_SGD`` and ``QUANTIZE_8BIT``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("POWER_SGD", ::c10d::BuiltinCommHookType::POWER_SGD)
+      .value("QUANTIZE_8BIT", ::c10d::BuiltinCommHookType::QUANTIZE_8BIT);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -369,6 +374,10 @@ An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_CO
           "_set_ddp_runtime_logging_sample_rate",
           &::c10d::Reducer::set_ddp_runtime_logging_sample_rate,
           py::arg("sample_rate"),
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_set_static_graph",
+          &::c10d::Reducer::set_static_graph,
           py::call_guard<py::gil_scoped_release>());
 
   shared_ptr_class_<::c10d::Logger>(module, "Logger")
@@ -1176,6 +1185,25 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
       },
       py::arg("process_groups"),
       py::call_guard<py::gil_scoped_release>());
+
+  module.def(
+      "_hierarchical_process_group",
+      // Composes an intra-node group and an inter-node group (one rank per
+      // node) into a process group whose allreduce runs reduce-scatter
+      // within the node, allreduce across nodes, and allgather within the
+      // node.
+      [](c10::intrusive_ptr<::c10d::ProcessGroup> intra_group,
+         c10::intrusive_ptr<::c10d::ProcessGroup> inter_group,
+         int rank,
+         int size) -> c10::intrusive_ptr<::c10d::ProcessGroup> {
+        return c10::make_intrusive<::c10d::ProcessGroupHierarchical>(
+            rank, size, std::move(intra_group), std::move(inter_group));
+      },
+      py::arg("intra_group"),
+      py::arg("inter_group"),
+      py::arg("rank"),
+      py::arg("size"),
+      py::call_guard<py::gil_scoped_release>());
 #endif
 
 #ifdef USE_C10D_GLOO
@@ -1227,19 +1255,37 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
                       std::chrono::milliseconds timeout) {
             auto options = ::c10d::ProcessGroupGloo::Options::create();
 
+            // "GLOO_CONNECTIONS_PER_PEER" creates that many devices per
+            // interface. Each device gets its own context, I/O thread and
+            // connection to every peer, which is needed to saturate fast
+            // NICs that a single connection cannot fill. Distinct device
+            // objects are required; replicating one object would share a
+            // single I/O thread (see the note in the ProcessGroupGloo
+            // constructor).
+            int connections = 1;
+            char* connectionsEnv = getenv("GLOO_CONNECTIONS_PER_PEER");
+            if (connectionsEnv) {
+              connections = std::max(1, std::atoi(connectionsEnv));
+            }
+
             // Use interfaces listed in "GLOO_SOCKET_IFNAME", if set.
             char* ifnameEnv = getenv(::c10d::GLOO_SOCKET_IFNAME_ENV);
             if (ifnameEnv) {
               for (const auto& iface : ::c10d::split(',', ifnameEnv)) {
-                options->devices.push_back(
-                    ::c10d::ProcessGroupGloo::createDeviceForInterface(iface));
+                for (int i = 0; i < connections; i++) {
+                  options->devices.push_back(
+                      ::c10d::ProcessGroupGloo::createDeviceForInterface(
+                          iface));
+                }
               }
             } else {
               // If no hostname is specified, this function looks up
               // the machine's hostname and returns a device instance
               // associated with the address that the hostname resolves to.
-              options->devices.push_back(
-                  ::c10d::ProcessGroupGloo::createDefaultDevice());
+              for (int i = 0; i < connections; i++) {
+                options->devices.push_back(
+                    ::c10d::ProcessGroupGloo::createDefaultDevice());
+              }
             }
 
             options->timeout = timeout;
@@ -1437,6 +1483,67 @@ Example::
       py::arg("replicas"),
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_flight_recorder_dump",
+      // Returns the retained (seq, op, bytes, enqueue_ns, start_ns, end_ns)
+      // tuples of this process' collective flight recorder, oldest first.
+      []() {
+        std::vector<
+            std::tuple<uint64_t, std::string, int64_t, int64_t, int64_t, int64_t>>
+            result;
+        for (const auto& e : ::c10d::FlightRecorder::get().dump()) {
+          result.emplace_back(
+              e.seq,
+              ::c10d::opTypeToString(e.opType),
+              e.bytes,
+              e.enqueueTimeNs,
+              e.startTimeNs,
+              e.endTimeNs);
+        }
+        return result;
+      },
+      py::call_guard<py::gil_scoped_release>());
+
+  module.def(
+      "_flight_recorder_compute_skew",
+      // Takes the per-rank dumps produced by _flight_recorder_dump (e.g.
+      // collected via all_gather_object) and returns, per collective present
+      // in all dumps, (seq, start_skew_ns, end_skew_ns, slack_ns,
+      // last_start_rank). The op name is not repeated here; join with a dump
+      // by seq when it is needed.
+      [](const std::vector<std::vector<
+             std::tuple<uint64_t, std::string, int64_t, int64_t, int64_t, int64_t>>>&
+             dumps) {
+        std::vector<std::vector<::c10d::FlightRecorderEntry>> rankDumps;
+        rankDumps.reserve(dumps.size());
+        for (const auto& dump : dumps) {
+          std::vector<::c10d::FlightRecorderEntry> entries;
+          entries.reserve(dump.size());
+          for (const auto& t : dump) {
+            ::c10d::FlightRecorderEntry e{};
+            e.seq = std::get<0>(t);
+            // The op name is carried for the user's benefit only; skew
+            // matching is purely by seq.
+            e.opType = ::c10d::OpType::UNKNOWN;
+            e.bytes = std::get<2>(t);
+            e.enqueueTimeNs = std::get<3>(t);
+            e.startTimeNs = std::get<4>(t);
+            e.endTimeNs = std::get<5>(t);
+            entries.push_back(e);
+          }
+          rankDumps.push_back(std::move(entries));
+        }
+        std::vector<std::tuple<uint64_t, int64_t, int64_t, int64_t, size_t>>
+            result;
+        for (const auto& s : ::c10d::computeCollectiveSkew(rankDumps)) {
+          result.emplace_back(
+              s.seq, s.startSkewNs, s.endSkewNs, s.slackNs, s.lastStartRank);
+        }
+        return result;
+      },
+      py::arg("dumps"),
+      py::call_guard<py::gil_scoped_release>());
+
   module.def(
       "_broadcast_coalesced",
       // Define a lambda such that the pybind11 prototype can take a std::vector
@@ -1451,11 +1558,40 @@ Example::
       },
       py::arg("process_group"),
       py::arg("tensors"),
-      py::arg("buffer_size"),
+      py::arg("buffer_size") = ::c10d::kDefaultBroadcastBucketBytesCap,
       // The source of truth rank to broadcast the tensors from.
       py::arg("src") = 0,
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_sparse_all_to_all",
+      &::c10d::sparse_all_to_all,
+      py::arg("process_group"),
+      py::arg("indices"),
+      py::arg("rows"),
+      py::arg("rows_per_rank"),
+      py::call_guard<py::gil_scoped_release>());
+
+  module.def(
+      "_tree_barrier",
+      // Store-based barrier with tree fanout: every rank only touches its
+      // parent and children keys, so the store master is no longer a
+      // bottleneck at large world sizes. The prefix must be unique per
+      // invocation.
+      [](c10::intrusive_ptr<::c10d::Store> store,
+         const std::string& prefix,
+         int rank,
+         int world_size,
+         std::chrono::milliseconds timeout) {
+        ::c10d::treeBarrier(*store, prefix, rank, world_size, timeout);
+      },
+      py::arg("store"),
+      py::arg("prefix"),
+      py::arg("rank"),
+      py::arg("world_size"),
+      py::arg("timeout") = ::c10d::Store::kDefaultTimeout,
+      py::call_guard<py::gil_scoped_release>());
+
   module.def(
       "_test_python_store",
       // Define a function that takes a c10d store and runs a few tests.
@@ -40,6 +40,30 @@ std::unordered_map<std::string, worker_id_t> collectNames(
   return nameToId;
 }
 
+std::vector<std::string> collectShmDomains(
+    ::c10d::PrefixStore store,
+    const worker_id_t selfId,
+    const std::string& selfDomain,
+    const int worldSize) {
+  std::vector<uint8_t> selfDomainVector(
+      (uint8_t*)selfDomain.c_str(),
+      (uint8_t*)selfDomain.c_str() + selfDomain.length());
+  store.set(c10::to_string(selfId), selfDomainVector);
+
+  std::vector<std::string> domains(worldSize);
+  domains[selfId] = selfDomain;
+  for (worker_id_t workerId = 0; workerId < worldSize; ++workerId) {
+    if (workerId == selfId) {
+      continue;
+    }
+    std::vector<uint8_t> workerDomainVector =
+        store.get(c10::to_string(workerId));
+    domains[workerId] = std::string(
+        (char*)workerDomainVector.data(), workerDomainVector.size());
+  }
+  return domains;
+}
+
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
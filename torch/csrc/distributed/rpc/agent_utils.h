@@ -16,6 +16,17 @@ std::unordered_map<std::string, worker_id_t> collectNames(
     const std::string& selfName,
     const int worldSize);
 
+// All RPC peers should call into this function at the same time. Each peer
+// provides its shared-memory domain fingerprint (an opaque string identifying
+// the host-level shared-memory namespace it can reach, or an empty string if
+// none), and this function uses the given Store to gather the fingerprints of
+// all peers, indexed by rank. Unlike names, fingerprints need not be unique.
+std::vector<std::string> collectShmDomains(
+    ::c10d::PrefixStore store,
+    const worker_id_t selfId,
+    const std::string& selfDomain,
+    const int worldSize);
+
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
@@ -29,14 +29,17 @@ Message::Message(Message&& other) noexcept = default;
 Message& Message::operator=(Message const& rhs) & {
   auto payload = rhs.payload_;
   auto tensors = rhs.tensors_;
-  Message(std::move(payload), std::move(tensors), rhs.type_, rhs.id_)
-      .swap(*this);
+  Message copied(std::move(payload), std::move(tensors), rhs.type_, rhs.id_);
+  copied.priority_ = rhs.priority_;
+  copied.swap(*this);
   return *this;
 }
 
 Message& Message::operator=(Message&& rhs) & {
-  Message(std::move(rhs.payload_), std::move(rhs.tensors_), rhs.type_, rhs.id_)
-      .swap(*this);
+  Message moved(
+      std::move(rhs.payload_), std::move(rhs.tensors_), rhs.type_, rhs.id_);
+  moved.priority_ = rhs.priority_;
+  moved.swap(*this);
   return *this;
 }
 
@@ -45,6 +48,7 @@ void Message::swap(Message& rhs) noexcept {
   std::swap(tensors_, rhs.tensors_);
   std::swap(type_, rhs.type_);
   std::swap(id_, rhs.id_);
+  std::swap(priority_, rhs.priority_);
 }
 
 std::vector<char>&& Message::movePayload() && {
@@ -91,6 +95,14 @@ void Message::setId(int64_t id) {
   id_ = id;
 }
 
+MessagePriority Message::priority() const {
+  return priority_;
+}
+
+void Message::setPriority(MessagePriority priority) {
+  priority_ = priority;
+}
+
 Message createExceptionResponse(const std::exception& e, int64_t id) {
   return createExceptionResponse(e.what(), id);
 }
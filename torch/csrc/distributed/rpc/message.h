@@ -23,6 +23,16 @@ enum MessageTypeFlags {
   RESPONSE_TYPE = 0x200,
 };
 
+// Priority class of a message, used by agents that run differentiated
+// execution lanes. INTERACTIVE marks small latency-critical RPCs (parameter
+// fetches, control messages); BULK marks large transfers (gradient pushes)
+// that may queue behind interactive work. Agents may upgrade a message to
+// BULK based on its type or size; they never downgrade an explicit BULK.
+enum class MessagePriority : uint8_t {
+  INTERACTIVE = 0,
+  BULK = 1,
+};
+
 // Message types must have values between 0x00 to 0xff
 enum MessageType {
   // messages for dist.rpc on builtin operators
@@ -149,11 +159,17 @@ class TORCH_API Message final : public torch::CustomClassHolder {
   int64_t id() const;
   void setId(int64_t id);
 
+  // Priority class used by agents with differentiated execution lanes; see
+  // MessagePriority. Defaults to INTERACTIVE.
+  MessagePriority priority() const;
+  void setPriority(MessagePriority priority);
+
  private:
   std::vector<char> payload_;
   std::vector<torch::Tensor> tensors_;
   MessageType type_ = MessageType::UNKNOWN;
   int64_t id_ = -1;
+  MessagePriority priority_ = MessagePriority::INTERACTIVE;
 };
 
 // Create a response Message of type Exception.
@@ -6,6 +6,13 @@
 #include <torch/csrc/distributed/rpc/agent_utils.h>
 #include <torch/csrc/distributed/rpc/utils.h>
 
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace torch {
 namespace distributed {
 namespace rpc {
@@ -57,6 +64,40 @@ const std::string kGilAverageWaitTime = "agent.gil_average_wait_time_us";
 const std::string kClientActiveCalls = "agent.client_active_calls";
 const std::string kServerActiveCalls = "agent.server_active_calls";
 const std::string kServerActiveAsyncCalls = "agent.server_active_async_calls";
+const std::string kInteractiveLaneQueueDepth =
+    "agent.interactive_lane_queue_depth";
+const std::string kBulkLaneQueueDepth = "agent.bulk_lane_queue_depth";
+
+// Messages whose tensors hold at least this many bytes send the tensor
+// storages as separate zero-copy segments instead of copying them into the
+// contiguous wire buffer. Below this the extra sends cost more than the copy.
+constexpr size_t kZeroCopyTensorBytes = 64 * 1024;
+
+// Messages carrying at least this many tensor bytes are classified as BULK
+// and processed on the bulk lane, keeping the interactive lane free for
+// small latency-critical RPCs such as parameter fetches.
+constexpr size_t kBulkMessageBytes = 1024 * 1024;
+
+// Identifies the shared-memory namespace this process can reach: two
+// processes with equal non-empty fingerprints see the same /dev/shm and can
+// pass tensors through it instead of the transport. The device/inode pair
+// distinguishes containers that share a hostname but mount separate tmpfs
+// instances. An empty fingerprint never matches, disabling the fast path.
+static std::string shmDomainFingerprint() {
+#ifdef _WIN32
+  return std::string();
+#else
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  char hostname[256];
+  struct stat shmStat {};
+  if (gethostname(hostname, sizeof(hostname)) != 0 ||
+      stat("/dev/shm", &shmStat) != 0) {
+    return std::string();
+  }
+  hostname[sizeof(hostname) - 1] = '\0';
+  return fmt::format("{}:{}:{}", hostname, shmStat.st_dev, shmStat.st_ino);
+#endif
+}
 
 ProcessGroupAgent::ProcessGroupAgent(
     const c10::intrusive_ptr<::c10d::Store>& store,
@@ -75,6 +116,7 @@ ProcessGroupAgent::ProcessGroupAgent(
       nextId_(0),
       sendMutexes_(pg_->getSize()),
       threadPool_(numSendRecvThreads),
+      bulkThreadPool_(std::max(1, numSendRecvThreads / 2)),
       timeoutThreadEnabled_{false} {
   // initialize metric info counters
   metrics_.resize(ProcessGroupAgentMetrics::N_METRICS);
@@ -111,6 +153,22 @@ ProcessGroupAgent::ProcessGroupAgent(
   for (worker_id_t rank = 0; rank < worldSize; ++rank) {
     allWorkerInfo_.emplace_back(std::move(tmpWorkerIds[rank]), rank);
   }
+
+  // Exchange shared-memory domain fingerprints so that handleSend() knows
+  // which peers can receive tensor storages through /dev/shm instead of the
+  // transport.
+  const auto selfDomain = shmDomainFingerprint();
+  const auto domains = collectShmDomains(
+      ::c10d::PrefixStore("shm_domains", store),
+      workerInfo_.id_,
+      selfDomain,
+      worldSize);
+  colocatedPeers_.resize(worldSize, false);
+  if (!selfDomain.empty()) {
+    for (worker_id_t rank = 0; rank < worldSize; ++rank) {
+      colocatedPeers_[rank] = domains[rank] == selfDomain;
+    }
+  }
 }
 
 ProcessGroupAgent::~ProcessGroupAgent() {
@@ -207,8 +265,9 @@ void ProcessGroupAgent::sync() {
   pg_->barrier()->wait();
   // block until all peers agree that all sent messages have been processed.
   do {
-    // Finish all send/recv tasks in the thread pool
+    // Finish all send/recv tasks on both lanes
     threadPool_.waitWorkComplete();
+    bulkThreadPool_.waitWorkComplete();
     // As there could be nested RPC calls, or response callback could also
     // trigger more messages to be sent, we need to wait for the thread pool
     // again.
@@ -262,6 +321,7 @@ void ProcessGroupAgent::shutdownImpl() {
   // that we can finish any possible work enqueued into the thread pool, before
   // python RPC handler is shutdown (see shutdown in rpc/api.py).
   threadPool_.waitWorkComplete();
+  bulkThreadPool_.waitWorkComplete();
 }
 
 std::shared_ptr<JitFuture> ProcessGroupAgent::send(
@@ -365,15 +425,41 @@ std::shared_ptr<JitFuture> ProcessGroupAgent::send(
 }
 
 void ProcessGroupAgent::handleSend(const SendWork& work) {
-  // NOLINTNEXTLINE(clang-diagnostic-pessimizing-move)
-  auto serializedPayload = std::make_unique<std::string>(std::move(
-      wireSerialize(work.message_.payload(), work.message_.tensors())));
+  // For messages carrying substantial tensor data, ship the storages as
+  // separate segments so they are never copied into the wire buffer; the
+  // contiguous buffer then only holds the payload and pickled metadata.
+  size_t tensorBytes = 0;
+  for (const auto& tensor : work.message_.tensors()) {
+    if (tensor.has_storage()) {
+      tensorBytes += tensor.element_size() * tensor.numel();
+    }
+  }
+
+  std::unique_ptr<std::string> serializedPayload;
+  std::vector<torch::Tensor> segments;
+  if (tensorBytes >= kZeroCopyTensorBytes && colocatedPeers_[work.to_.id_]) {
+    // Co-located peer: the storages travel through shared-memory segments
+    // and only their handles cross the transport. The receive path needs no
+    // special casing since the result is an ordinary single wire buffer.
+    serializedPayload = std::make_unique<std::string>(
+        wireSerializeShm(work.message_.payload(), work.message_.tensors()));
+  } else if (tensorBytes >= kZeroCopyTensorBytes) {
+    auto wire =
+        wireSerializeSegments(work.message_.payload(), work.message_.tensors());
+    serializedPayload = std::make_unique<std::string>(std::move(wire.meta));
+    segments = std::move(wire.segments);
+  } else {
+    serializedPayload = std::make_unique<std::string>(
+        wireSerialize(work.message_.payload(), work.message_.tensors()));
+  }
 
   std::vector<torch::Tensor> preamble = {torch::tensor(
       {(int64_t)pg_->getRank(),
        (int64_t)serializedPayload->length(),
        (int64_t)work.message_.type(),
-       (int64_t)work.message_.id()},
+       (int64_t)work.message_.id(),
+       (int64_t)segments.size(),
+       (int64_t)classifyPriority(work.message_)},
       {torch::kInt64})};
 
   // ProcessGroup is not thread-safe when sending with the same tag,
@@ -390,7 +476,7 @@ void ProcessGroupAgent::handleSend(const SendWork& work) {
       serializedPayloadSize,
       [deleteWhenDone](void*) { delete deleteWhenDone; },
       {torch::kChar})};
-  pendingSends.reserve(2);
+  pendingSends.reserve(2 + segments.size());
 
   sendCounts_.increment(dst);
 
@@ -398,6 +484,13 @@ void ProcessGroupAgent::handleSend(const SendWork& work) {
     std::lock_guard<std::mutex> guard(sendMutexes_[dst]);
     pendingSends.emplace_back(pg_->send(preamble, dst, dst /* channelTag */));
     pendingSends.emplace_back(pg_->send(payload, dst, dst /* channelTag */));
+    // The segment tensors alias the message tensors' storages; they stay
+    // alive until the waits below return, so no deleter juggling is needed.
+    for (auto& segment : segments) {
+      std::vector<torch::Tensor> segmentVec = {segment};
+      pendingSends.emplace_back(
+          pg_->send(segmentVec, dst, dst /* channelTag */));
+    }
   }
   // Write pendingSends to a global map so that they can be interrupted by
   // ::shutdown().
@@ -427,10 +520,45 @@ void ProcessGroupAgent::handleSend(const SendWork& work) {
   }
 }
 
+MessagePriority ProcessGroupAgent::classifyPriority(const Message& message) {
+  if (message.priority() == MessagePriority::BULK) {
+    return MessagePriority::BULK;
+  }
+  // Gradient traffic on the backward pass is throughput-bound and can be
+  // arbitrarily large; keep it off the interactive lane regardless of size.
+  if (message.type() == MessageType::BACKWARD_AUTOGRAD_REQ ||
+      message.type() == MessageType::BACKWARD_AUTOGRAD_RESP) {
+    return MessagePriority::BULK;
+  }
+  size_t tensorBytes = 0;
+  for (const auto& tensor : message.tensors()) {
+    if (tensor.defined() && tensor.has_storage()) {
+      tensorBytes += tensor.element_size() * tensor.numel();
+    }
+  }
+  return tensorBytes >= kBulkMessageBytes ? MessagePriority::BULK
+                                          : MessagePriority::INTERACTIVE;
+}
+
+void ProcessGroupAgent::runOnLane(
+    MessagePriority priority,
+    std::function<void()> fn) {
+  auto& pool =
+      priority == MessagePriority::BULK ? bulkThreadPool_ : threadPool_;
+  auto& depth = priority == MessagePriority::BULK ? bulkLaneDepth_
+                                                  : interactiveLaneDepth_;
+  ++depth;
+  pool.run([fn{std::move(fn)}, &depth]() {
+    fn();
+    --depth;
+  });
+}
+
 void ProcessGroupAgent::sendToSelf(Message&& message) {
+  const auto priority = classifyPriority(message);
   // NOLINTNEXTLINE(modernize-avoid-bind)
-  threadPool_.run(std::bind(
-      [this](const Message& message) {
+  auto task = std::bind(
+      [this, priority](const Message& message) {
         // Unlike the other cases, need to add a tensor deleter, since the
         // data outlives the scope of this function. It's shared_ptr<> due
         // to c++11 lambda capture limitations with unique_ptr<>.
@@ -456,15 +584,19 @@ void ProcessGroupAgent::sendToSelf(Message&& message) {
                 (void*)data,
                 len,
                 [delete_when_done](void*) { delete delete_when_done; },
-                {torch::kChar})));
+                {torch::kChar}),
+            {},
+            priority));
       },
-      std::move(message)));
+      std::move(message));
+  runOnLane(priority, std::move(task));
 }
 
 void ProcessGroupAgent::enqueueSend(SendWork work) {
+  const auto priority = classifyPriority(work.message_);
   // NB: this can be changed to use a native move capture when moved to C++14
   // NOLINTNEXTLINE(modernize-avoid-bind)
-  threadPool_.run(std::bind(
+  auto task = std::bind(
       [this](const SendWork& work) {
         try {
           handleSend(work);
@@ -485,12 +617,16 @@ void ProcessGroupAgent::enqueueSend(SendWork work) {
           }
         }
       },
-      std::move(work)));
+      std::move(work));
+  runOnLane(priority, std::move(task));
 }
 
 bool ProcessGroupAgent::handleRecv(RecvWork& work) {
   torch::Tensor& payload = work.payload_;
-  auto data = wireDeserialize(payload.storage().data(), payload.numel());
+  auto data = work.segments_.empty()
+      ? wireDeserialize(payload.storage().data(), payload.numel())
+      : wireDeserializeSegments(
+            payload.storage().data(), payload.numel(), work.segments_);
   Message message(
       std::move(data.first), std::move(data.second), work.type_, work.id_);
   if (message.isRequest()) {
@@ -589,8 +725,9 @@ bool ProcessGroupAgent::handleRecv(RecvWork& work) {
 }
 
 void ProcessGroupAgent::enqueueRecv(RecvWork work) {
+  const auto priority = work.priority_;
   // NOLINTNEXTLINE(modernize-avoid-bind)
-  threadPool_.run(std::bind(
+  auto task = std::bind(
       [&](RecvWork& work) {
         try {
           // Only increment recvCounts if handleRecv() tells us to. We may not,
@@ -618,7 +755,8 @@ void ProcessGroupAgent::enqueueRecv(RecvWork work) {
           recvCounts_.increment(work.from_.id_);
         }
       },
-      std::move(work)));
+      std::move(work));
+  runOnLane(priority, std::move(task));
 }
 
 void ProcessGroupAgent::markFutureWithError(Message& message) {
@@ -699,8 +837,8 @@ void ProcessGroupAgent::listenLoop() {
 
 void ProcessGroupAgent::listenLoopInternal() {
   while (rpcAgentRunning_.load()) {
-    // rank, tensor size, message type
-    std::vector<torch::Tensor> preamble = {torch::empty({4}, {torch::kInt64})};
+    // rank, tensor size, message type, message id, segment count, priority
+    std::vector<torch::Tensor> preamble = {torch::empty({6}, {torch::kInt64})};
     auto work = pg_->recvAnysource(preamble, pg_->getRank());
     {
       // Write class variable so it can be aborted by shutdown()
@@ -718,6 +856,8 @@ void ProcessGroupAgent::listenLoopInternal() {
     auto size = preamble_items[1];
     MessageType type = MessageType(preamble_items[2]);
     int64_t id = preamble_items[3];
+    int64_t numSegments = preamble_items[4];
+    MessagePriority priority = MessagePriority(preamble_items[5]);
 
     std::vector<torch::Tensor> tensors = {torch::empty({size}, {torch::kChar})};
     work = pg_->recv(tensors, srcRank, pg_->getRank());
@@ -731,8 +871,41 @@ void ProcessGroupAgent::listenLoopInternal() {
       return;
     }
 
-    enqueueRecv(
-        RecvWork(allWorkerInfo_[srcRank], type, id, std::move(tensors[0])));
+    // Tensor storages sent as separate segments are received directly into
+    // preallocated buffers; their sizes come from the section header of the
+    // metadata buffer we just read.
+    std::vector<torch::Tensor> segments;
+    if (numSegments > 0) {
+      auto segmentSizes =
+          wireSegmentSizes(tensors[0].storage().data(), tensors[0].numel());
+      TORCH_INTERNAL_ASSERT(
+          (int64_t)segmentSizes.size() == numSegments,
+          "Segment count mismatch between preamble and wire header");
+      segments.reserve(segmentSizes.size());
+      for (auto segmentSize : segmentSizes) {
+        std::vector<torch::Tensor> segment = {
+            torch::empty({segmentSize}, {torch::kChar})};
+        work = pg_->recv(segment, srcRank, pg_->getRank());
+        {
+          // Write class variable so it can be aborted by shutdown()
+          std::lock_guard<std::mutex> guard(recvWorkMutex_);
+          recvWork_ = work;
+        }
+
+        if (!rpcAgentRunning_.load() || !work->wait() /* aborted */) {
+          return;
+        }
+        segments.push_back(std::move(segment[0]));
+      }
+    }
+
+    enqueueRecv(RecvWork(
+        allWorkerInfo_[srcRank],
+        type,
+        id,
+        std::move(tensors[0]),
+        std::move(segments),
+        priority));
   }
 }
 
@@ -844,6 +1017,9 @@ std::unordered_map<std::string, std::string> ProcessGroupAgent::getMetrics() {
   metrics[kServerActiveCalls] = c10::to_string(serverActiveCalls_.load());
   metrics[kServerActiveAsyncCalls] =
       c10::to_string(serverActiveAsyncCalls_.load());
+  metrics[kInteractiveLaneQueueDepth] =
+      c10::to_string(interactiveLaneDepth_.load());
+  metrics[kBulkLaneQueueDepth] = c10::to_string(bulkLaneDepth_.load());
   if (isGILProfilingEnabled()) {
     // Add time-series based metrics, just GIL wait times for now.
     {
@@ -49,13 +49,25 @@ struct RecvWork {
       const WorkerInfo& from,
       MessageType type,
       int64_t id,
-      torch::Tensor&& payload)
-      : from_(from), type_(type), id_(id), payload_(payload) {}
+      torch::Tensor&& payload,
+      std::vector<torch::Tensor>&& segments = {},
+      MessagePriority priority = MessagePriority::INTERACTIVE)
+      : from_(from),
+        type_(type),
+        id_(id),
+        payload_(payload),
+        segments_(std::move(segments)),
+        priority_(priority) {}
 
   const WorkerInfo& from_;
   const MessageType type_;
   const int64_t id_;
   torch::Tensor payload_;
+  // Tensor storages received as separate zero-copy segments; empty when the
+  // sender inlined all tensor data into the payload buffer.
+  std::vector<torch::Tensor> segments_;
+  // Execution lane the work is processed on, as classified by the sender.
+  const MessagePriority priority_;
 };
 
 class TORCH_API ProcessGroupAgent : public RpcAgent {
@@ -216,6 +228,9 @@ class TORCH_API ProcessGroupAgent : public RpcAgent {
   // worker name -> rank
   std::unordered_map<std::string, worker_id_t> nameMap_;
   std::vector<WorkerInfo> allWorkerInfo_;
+  // colocatedPeers_[rank] is true when that peer shares this process's
+  // shared-memory domain, enabling the shm tensor fast path in handleSend().
+  std::vector<bool> colocatedPeers_;
   // record the number of messages sent to and received from each peer. The recv
   // counter is only marked after the message is processed. Join uses allgather
   // to collect all counts from all peers, uses these counters to detect global
@@ -254,6 +269,20 @@ class TORCH_API ProcessGroupAgent : public RpcAgent {
   //     NB: Ideally, this should be addressed by supporting asynchronous UDF.
   //         This is just a temporary solution for (2).
   ThreadPool threadPool_;
+  // Separate lane for BULK messages (gradient pushes, large transfers) so
+  // that latency-critical interactive RPCs on threadPool_ never queue behind
+  // them. See Message::priority() and classifyPriority().
+  ThreadPool bulkThreadPool_;
+  // Classifies a message onto a lane: explicit BULK priority, autograd
+  // gradient traffic, and messages with large tensor payloads go to the bulk
+  // lane, everything else stays interactive.
+  static MessagePriority classifyPriority(const Message& message);
+  // Runs fn on the lane corresponding to priority, maintaining the per-lane
+  // queue-depth counters below.
+  void runOnLane(MessagePriority priority, std::function<void()> fn);
+  // Number of tasks enqueued but not yet finished on each lane.
+  std::atomic<int64_t> interactiveLaneDepth_{0};
+  std::atomic<int64_t> bulkLaneDepth_{0};
   // Atomic to indicate whether the timeout thread is enabled.
   std::atomic<bool> timeoutThreadEnabled_;
   // Mapping of request id to FutureInfo struct.
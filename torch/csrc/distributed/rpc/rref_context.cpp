@@ -95,14 +95,17 @@ std::vector<c10::intrusive_ptr<RRef>> RRefContext::destroyInstance(
   }
   ctx.checkRRefLeaks(ignoreRRefLeak);
   std::vector<c10::intrusive_ptr<RRef>> deletedRRefs;
-  for (auto& entry : ctx.owners_) {
-    auto rref = entry.second;
-    if (rref->isPyObj()) {
-      deletedRRefs.emplace_back(std::move(rref));
+  for (auto& shard : ctx.ownerShards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto& entry : shard.owners) {
+      auto rref = entry.second;
+      if (rref->isPyObj()) {
+        deletedRRefs.emplace_back(std::move(rref));
+      }
     }
+    shard.owners.clear();
+    shard.pendingOwners.clear();
   }
-  ctx.owners_.clear();
-  ctx.pendingOwners_.clear();
   return deletedRRefs;
 }
 
@@ -117,8 +120,17 @@ void RRefContext::handleException(const JitFuture& jitFuture) {
 RRefContext::RRefContext(std::shared_ptr<RpcAgent> agent)
     : agent_(std::move(agent)), destroyed_(false) {}
 
+size_t RRefContext::numOwners() const {
+  size_t total = 0;
+  for (const auto& shard : ownerShards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    total += shard.owners.size();
+  }
+  return total;
+}
+
 RRefContext::~RRefContext() {
-  if (!owners_.empty()) {
+  if (numOwners() != 0) {
     VLOG(1) << "Destructing RRefContext with non-empty OwnerRRef set. "
             << "This would likely cause Python deref error. "
             << "Make sure destroyInstance() is invoked before destruction.";
@@ -127,13 +139,17 @@ RRefContext::~RRefContext() {
 
 std::unordered_map<std::string, std::string> RRefContext::getDebugInfo() {
   std::unordered_map<std::string, std::string> info;
-  std::unique_lock<std::mutex> lock(mutex_);
-  auto ownerSize = owners_.size();
-  auto numPendingUsers = pendingUsers_.size();
+  size_t ownerSize = 0;
   int numForks = 0;
-  for (const auto& owner : forks_) {
-    numForks += owner.second.size();
+  for (const auto& shard : ownerShards_) {
+    std::lock_guard<std::mutex> shardLock(shard.mutex);
+    ownerSize += shard.owners.size();
+    for (const auto& owner : shard.forks) {
+      numForks += owner.second.size();
+    }
   }
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto numPendingUsers = pendingUsers_.size();
   lock.unlock();
   info[kNumOwnerRRefs] = c10::to_string(ownerSize);
   info[kNumPendingFutures] = c10::to_string(numPendingFutures_.load());
@@ -143,16 +159,20 @@ std::unordered_map<std::string, std::string> RRefContext::getDebugInfo() {
 }
 
 void RRefContext::checkRRefLeaks(bool ignoreRRefLeak) {
-  if (!forks_.empty()) {
-    std::stringstream ss;
-    for (auto& entry : forks_) {
+  bool hasLeaks = false;
+  std::stringstream ss;
+  for (auto& shard : ownerShards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto& entry : shard.forks) {
       const RRefId& rrefId = entry.first;
       for (const auto& forkId : entry.second) {
+        hasLeaks = true;
         ss << "Leaking RRef " << rrefId << " with fork Id " << forkId
            << std::endl;
       }
     }
-
+  }
+  if (hasLeaks) {
     LOG(WARNING)
         << "Detected RRef Leaks during shutdown. This usually "
         << "occurs when the application code still holds references to RRef "
@@ -262,27 +282,27 @@ void RRefContext::delAllUsersAndUnforkedOwners(
     rref_ptr->tryDel();
   }
 
-  // If an rref in the owners_ map has never been forked, we will never get a
+  // If an rref in the owners map has never been forked, we will never get a
   // corresponding message from the forking node(s) telling us to delete the
   // RRef. Hence we delete the RRef here. This can occur when a remote call is
   // sent to self and times out.
-  {
-    std::unique_lock<std::mutex> lock(mutex_);
+  for (auto& shard : ownerShards_) {
+    std::unique_lock<std::mutex> lock(shard.mutex);
     std::vector<RRefId> unforkedOwners;
-    for (const auto& it : owners_) {
+    for (const auto& it : shard.owners) {
       auto rrefId = it.first;
-      if (forks_.find(rrefId) == forks_.end()) {
+      if (shard.forks.find(rrefId) == shard.forks.end()) {
         // Successful fork of owner was never processed.
         unforkedOwners.push_back(rrefId);
       }
     }
     for (auto& rrefId : unforkedOwners) {
       LOG(INFO) << "Removing unforked OwnerRRef with RRefId: " << rrefId;
-      auto iter = owners_.find(rrefId);
+      auto iter = shard.owners.find(rrefId);
       TORCH_CHECK(
-          iter != owners_.end(),
+          iter != shard.owners.end(),
           c10::str("Did not find OwnerRRef with RRefId: ", rrefId));
-      owners_.erase(iter);
+      shard.owners.erase(iter);
     }
   }
   // Wait for this node to process all delete UserRRef messages it may get for
@@ -290,7 +310,7 @@ void RRefContext::delAllUsersAndUnforkedOwners(
   {
     std::unique_lock<std::mutex> lock(mutex_);
     bool noOwner = deleteAllUsersCV_.wait_for(
-        lock, timeoutMillis, [this]() { return owners_.size() == 0; });
+        lock, timeoutMillis, [this]() { return numOwners() == 0; });
     if (!noOwner) {
       LOG(ERROR) << "Timed out waiting for pending OwnerRRefs to be deleted.";
     }
@@ -314,22 +334,23 @@ c10::intrusive_ptr<OwnerRRef> RRefContext::getOrCreateOwnerRRef(
     const RRefId& rrefId,
     const TypePtr& type,
     std::vector<c10::DeviceIndex> devices) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  const auto iter = owners_.find(rrefId);
-  if (iter == owners_.end()) {
+  auto& shard = ownerShardFor(rrefId);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto iter = shard.owners.find(rrefId);
+  if (iter == shard.owners.end()) {
     // Scenario (1) the first time this owner knows about this RRef
     //
     // NB: cannot use make_shared here as the constructor of OwnerRRef is
     // private.
     auto rref = c10::make_intrusive<OwnerRRef>(
         getWorkerId(), rrefId, type, std::move(devices));
-    owners_[rref->rrefId()] = rref;
-    const auto pendingOwnerIter = pendingOwners_.find(rrefId);
-    if (pendingOwnerIter != pendingOwners_.end()) {
+    shard.owners[rref->rrefId()] = rref;
+    const auto pendingOwnerIter = shard.pendingOwners.find(rrefId);
+    if (pendingOwnerIter != shard.pendingOwners.end()) {
       // cast to RRefInterface to hold it into IValue
       auto rrefPtr = fromOwnerRRef(rref);
       pendingOwnerIter->second->markCompleted(IValue(rrefPtr));
-      pendingOwners_.erase(pendingOwnerIter);
+      shard.pendingOwners.erase(pendingOwnerIter);
     }
     return rref;
   } else {
@@ -370,7 +391,7 @@ c10::intrusive_ptr<OwnerRRef> RRefContext::getOrCreateOwnerRRef(
 c10::intrusive_ptr<OwnerRRef> RRefContext::createOwnerRRef(
     const TypePtr& type,
     std::vector<c10::DeviceIndex> devices) {
-  // Don't add this OnwerRRef to the owners_ map yet, otherwise
+  // Don't add this OnwerRRef to the owners map yet, otherwise
   // it will never be removed from there. Instead, only add it to the
   // map in prepareChildFork, in case this local RRef is being passed
   // to another worker.
@@ -381,23 +402,24 @@ c10::intrusive_ptr<OwnerRRef> RRefContext::createOwnerRRef(
 c10::intrusive_ptr<JitFuture> RRefContext::getOwnerRRef(
     const RRefId& rrefId,
     bool forceCreated) {
-  std::unique_lock<std::mutex> lock(mutex_);
-  const auto iter = owners_.find(rrefId);
-  if (iter == owners_.end()) {
+  auto& shard = ownerShardFor(rrefId);
+  std::unique_lock<std::mutex> lock(shard.mutex);
+  const auto iter = shard.owners.find(rrefId);
+  if (iter == shard.owners.end()) {
     if (forceCreated) {
       TORCH_INTERNAL_ASSERT(
           false,
           c10::str("Expected OwnerRRef with id ", rrefId, " to be created."));
     }
     // Scenario (1) RRef is used before it is created
-    const auto pendingOwnerIter = pendingOwners_.find(rrefId);
-    if (pendingOwnerIter == pendingOwners_.end()) {
+    const auto pendingOwnerIter = shard.pendingOwners.find(rrefId);
+    if (pendingOwnerIter == shard.pendingOwners.end()) {
       // Note: The type passed into RRefType::create() does not matter here, as
       // the future is marked as completed with the RRef of the specific type
       // in getOrCreateOwnerRRef().
       auto futureOwner =
           c10::make_intrusive<JitFuture>(RRefType::create(c10::AnyType::get()));
-      pendingOwners_[rrefId] = futureOwner;
+      shard.pendingOwners[rrefId] = futureOwner;
       return futureOwner;
     } else {
       return pendingOwnerIter->second;
@@ -437,11 +459,12 @@ RRefForkData RRefContext::prepareChildFork(
     // TODO: When adding failure retries and timeout, this fork needs to be
     // deleted if the owner does not receive the ACK within the timeout.
     addForkOfOwner(rrefForkData.rrefId_, rrefForkData.forkId_);
-    // ensure that this RRef is in the owners_ list to keep it alive.
+    // ensure that this RRef is in the owners map to keep it alive.
     // this is needed for OwnerRRefs that were created locally.
     {
-      std::lock_guard<std::mutex> lock(mutex_);
-      owners_[rref->rrefId()] = rref;
+      auto& shard = ownerShardFor(rref->rrefId());
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.owners[rref->rrefId()] = rref;
     }
   } else {
     // Note [Useful Phantom Fork ID for User to Owner Call]
@@ -482,7 +505,7 @@ void RRefContext::notifyOwnerAndParentOfFork(
       }
     } else {
       // If the parent is the owner, this fork has already been added into the
-      // forks_ map when the owner sends the message to the callee user.
+      // forks map when the owner sends the message to the callee user.
       // Hence, it is not necessary to send another RREF_CHILD_ACCEPT or
       // RREF_FORK_REQUEST back to the owner. See Note [Early Fork
       // Registration].
@@ -496,7 +519,7 @@ void RRefContext::notifyOwnerAndParentOfFork(
   if (rref->isOwner()) {
     // See Note [Useful Phantom Fork ID for User to Owner Call]
     // In this case, the owner is the caller, and it does not add the fork id
-    // into forks_. Because, there will be no real `UserRRef` associated
+    // into the forks map. Because, there will be no real `UserRRef` associated
     // with this fork ID.
     ++numPendingFutures_;
     auto jitFuture = agent_->sendWithRetries(
@@ -705,10 +728,11 @@ void RRefContext::finishForkRequest(const ForkId& forkId, worker_id_t parent) {
 }
 
 void RRefContext::addSelfAsFork(c10::intrusive_ptr<OwnerRRef>& rref) {
-  std::lock_guard<std::mutex> lock(mutex_);
   const auto& rrefId = rref->rrefId();
-  owners_[rrefId] = rref;
-  auto& rrefForks = forks_[rrefId];
+  auto& shard = ownerShardFor(rrefId);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.owners[rrefId] = rref;
+  auto& rrefForks = shard.forks[rrefId];
   TORCH_INTERNAL_ASSERT(
       rrefForks.find(rrefId) == rrefForks.end(),
       "Attempt to add self as fork twice ",
@@ -717,8 +741,9 @@ void RRefContext::addSelfAsFork(c10::intrusive_ptr<OwnerRRef>& rref) {
 }
 
 void RRefContext::addForkOfOwner(const RRefId& rrefId, const ForkId& forkId) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto& rrefForks = forks_[rrefId];
+  auto& shard = ownerShardFor(rrefId);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto& rrefForks = shard.forks[rrefId];
   TORCH_INTERNAL_ASSERT(
       rrefForks.find(forkId) == rrefForks.end(),
       "Got fork notification twice on the same RRef ",
@@ -729,8 +754,9 @@ void RRefContext::addForkOfOwner(const RRefId& rrefId, const ForkId& forkId) {
 void RRefContext::addForkOfOwnerIfNotPresent(
     const RRefId& rrefId,
     const ForkId& forkId) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto& rrefForks = forks_[rrefId];
+  auto& shard = ownerShardFor(rrefId);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto& rrefForks = shard.forks[rrefId];
   // We first check whether the child exists in rrefForks. It's possible
   // the child may have been added by a previous send attempt, and this check
   // (as opposed to an assertion here) ensures that messages that trigger this
@@ -754,9 +780,10 @@ c10::intrusive_ptr<RRef> RRefContext::delForkOfOwner(
   // statements to ensure this function is idempotent. This makes it safe to
   // retry RRefUserDelete messages.
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto rrefIter = forks_.find(rrefId);
-    if (rrefIter != forks_.end()) {
+    auto& shard = ownerShardFor(rrefId);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto rrefIter = shard.forks.find(rrefId);
+    if (rrefIter != shard.forks.end()) {
       auto& rrefForks = rrefIter->second;
       auto forkIter = rrefForks.find(forkId);
       if (forkIter != rrefForks.end()) {
@@ -768,13 +795,13 @@ c10::intrusive_ptr<RRef> RRefContext::delForkOfOwner(
             << ", likely because it was deleted by a previously retried message";
       }
       if (rrefForks.empty()) {
-        auto ownerIter = owners_.find(rrefId);
-        if (ownerIter != owners_.end()) {
+        auto ownerIter = shard.owners.find(rrefId);
+        if (ownerIter != shard.owners.end()) {
           deletedRRef = ownerIter->second;
-          owners_.erase(ownerIter);
+          shard.owners.erase(ownerIter);
           ownerReduced = true;
         }
-        forks_.erase(rrefIter);
+        shard.forks.erase(rrefIter);
       }
     } else {
       LOG(INFO)
@@ -783,6 +810,13 @@ c10::intrusive_ptr<RRef> RRefContext::delForkOfOwner(
     }
   }
   if (ownerReduced) {
+    // The shutdown path in delAllUsersAndUnforkedOwners() evaluates the
+    // sharded owner count while holding mutex_. Briefly acquiring mutex_
+    // before notifying ensures the waiter either observes the removal above
+    // or is fully blocked on the cond var, so the wakeup cannot be lost.
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+    }
     deleteAllUsersCV_.notify_all();
   }
   return deletedRRef;
@@ -7,6 +7,7 @@
 #include <torch/csrc/distributed/rpc/types.h>
 #include <torch/csrc/distributed/rpc/utils.h>
 
+#include <array>
 #include <atomic>
 
 namespace torch {
@@ -111,13 +112,13 @@ class TORCH_API RRefContext {
       const RRefId& rrefId,
       bool forceCreated = false);
 
-  // Adding the RRefId of an OwnerRRef into the forks_ map. This is useful when
+  // Adding the RRefId of an OwnerRRef into the forks map. This is useful when
   // making a remote call to self, which as for now, still goes through serde
   // and invokes request callback. In this case, the OwnerRRef has already been
   // created on the send side, and we need to pass it to the receive side,
   // instead of creating a new OwnerRRef. This is done by adding the OwnerRRef
-  // into owners_. However, that alone is not enough, as it could be deleted
-  // when all UserRRef die, which would then remove the OwnerRRef from owners_
+  // into the owners map. However, that alone is not enough, as it could be deleted
+  // when all UserRRef die, which would then remove the OwnerRRef from the owners map
   // and this could happen before the self remote call finishes. To prevent
   // that, this API adds the RRefId as a ForkId, which will then delete the
   // ForkId when the self remote is done.
@@ -243,26 +244,51 @@ class TORCH_API RRefContext {
   static std::atomic<local_id_t> nextLocalId_;
 
   const std::shared_ptr<RpcAgent> agent_;
+  // Guards the ForkId-keyed user tables below (pendingUsers_, confirmedUsers_,
+  // pendingChildren_). The RRefId-keyed owner tables are sharded and carry
+  // their own per-shard locks; see OwnerShard.
   mutable std::mutex mutex_;
-  // Keep OwnerRRefs alive until there is no living UserRRefs.
-  std::unordered_map<RRefId, c10::intrusive_ptr<RRef>, RRefId::Hash> owners_;
-  // A map to track OwnerRRefs that are requested but not yet created. This can
-  // happen if the to_here() message is processed on the owner before the
-  // corresponding creator rpc.remote() message. If this happens, instead of
-  // to_here() RPC thread to block waiting for the OwnerRRef creation, the
-  // RRefContext returns a Future, so that the RPC request processing logic can
-  // attach subsequent code as a callback to that Future.
-  // NB: the OwnerRRefs in this map must be cleared when the corresponding
-  // OwnerRRef is created. Note that the values in this map are intrusive_ptrs
-  // to c10::ivalue::Future that will be marked completed with the owner RRef.
-  std::unordered_map<RRefId, c10::intrusive_ptr<JitFuture>, RRefId::Hash>
-      pendingOwners_;
-  // Tracks known living UserRRefs of an OwnerRRef
-  std::unordered_map<
-      RRefId,
-      std::unordered_set<ForkId, ForkId::Hash>,
-      RRefId::Hash>
-      forks_;
+
+  // Owner-side bookkeeping is sharded by RRefId hash so that concurrent
+  // operations on unrelated RRefs do not convoy on a single context-wide
+  // mutex. All three tables in a shard are keyed by RRefId, and the
+  // fork/delete protocol always touches them with the same id, so locking one
+  // shard preserves the atomicity the protocol relies on (e.g., delForkOfOwner
+  // removing the last fork and the OwnerRRef together).
+  struct OwnerShard {
+    mutable std::mutex mutex;
+    // Keep OwnerRRefs alive until there is no living UserRRefs.
+    std::unordered_map<RRefId, c10::intrusive_ptr<RRef>, RRefId::Hash> owners;
+    // A map to track OwnerRRefs that are requested but not yet created. This
+    // can happen if the to_here() message is processed on the owner before the
+    // corresponding creator rpc.remote() message. If this happens, instead of
+    // to_here() RPC thread to block waiting for the OwnerRRef creation, the
+    // RRefContext returns a Future, so that the RPC request processing logic
+    // can attach subsequent code as a callback to that Future.
+    // NB: the OwnerRRefs in this map must be cleared when the corresponding
+    // OwnerRRef is created. Note that the values in this map are
+    // intrusive_ptrs to c10::ivalue::Future that will be marked completed with
+    // the owner RRef.
+    std::unordered_map<RRefId, c10::intrusive_ptr<JitFuture>, RRefId::Hash>
+        pendingOwners;
+    // Tracks known living UserRRefs of an OwnerRRef
+    std::unordered_map<
+        RRefId,
+        std::unordered_set<ForkId, ForkId::Hash>,
+        RRefId::Hash>
+        forks;
+  };
+
+  static constexpr size_t kNumOwnerShards = 16;
+
+  inline OwnerShard& ownerShardFor(const RRefId& rrefId) {
+    return ownerShards_[RRefId::Hash()(rrefId) % kNumOwnerShards];
+  }
+
+  // Total number of OwnerRRefs across all shards.
+  size_t numOwners() const;
+
+  std::array<OwnerShard, kNumOwnerShards> ownerShards_;
 
   // This cond var is used by deleteAllUsers(), a event notificaton is sent if
   // number of pending UserRRef or UserRRef children is reduced, or
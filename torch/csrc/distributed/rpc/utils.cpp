@@ -1,5 +1,6 @@
 #include <torch/csrc/distributed/rpc/utils.h>
 
+#include <TH/THAllocator.h>
 #include <fmt/format.h>
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/cleanup_autograd_context_req.h>
@@ -23,6 +24,18 @@
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
 
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <random>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace torch::autograd::profiler;
 
 namespace torch {
@@ -262,11 +275,12 @@ namespace {
 //
 // Note that per the header comments, the format is subject to change,
 // and is best used for rpcs, rather than persistent disk storage.
-std::unordered_map<std::string, std::pair<const char*, size_t>>
-parseWireSections(const void* data, size_t data_size) {
-  const char* ptr = static_cast<const char*>(data);
-  const char* endp = ptr + data_size;
-
+// Parses just the header of the format above. Returns the (name, size)
+// entries in header order and leaves `ptr` pointing one past the trailing
+// blank line, where section data (if any) begins.
+std::vector<std::pair<std::string, size_t>> parseWireHeader(
+    const char*& ptr,
+    const char* endp) {
   std::vector<std::pair<std::string, size_t>> headerEnts;
   bool ok = false;
   while (ptr != endp) {
@@ -302,6 +316,15 @@ parseWireSections(const void* data, size_t data_size) {
   if (!ok) {
     throw std::runtime_error("failed parse");
   }
+  return headerEnts;
+}
+
+std::unordered_map<std::string, std::pair<const char*, size_t>>
+parseWireSections(const void* data, size_t data_size) {
+  const char* ptr = static_cast<const char*>(data);
+  const char* endp = ptr + data_size;
+
+  auto headerEnts = parseWireHeader(ptr, endp);
 
   std::unordered_map<std::string, std::pair<const char*, size_t>> out;
   for (const auto& headerEnt : headerEnts) {
@@ -316,6 +339,72 @@ parseWireSections(const void* data, size_t data_size) {
 
 static const char* kMeta = "meta";
 static const char* kPayload = "payload";
+// Marker section present when tensor sections hold shared-memory handles
+// instead of raw storage bytes; see wireSerializeShm().
+static const char* kShm = "shm";
+
+#ifndef _WIN32
+// Copies `size` bytes into a fresh POSIX shared-memory segment and returns
+// its name. The segment is deliberately not unlinked here: the receiver maps
+// it with TH_ALLOCATOR_MAPPED_UNLINK, which removes the name as soon as the
+// mapping exists. (THMapAllocator cannot create the segment on this side
+// because its close() unlinks shared-memory names it created, which would
+// race with the receiver's open.)
+std::string writeShmSegment(const char* data, size_t size) {
+  std::string handle;
+  int fd = -1;
+  constexpr int kMaxAttempts = 10;
+  for (int attempt = 0; attempt < kMaxAttempts; ++attempt) {
+    // Same naming scheme as THPStorage_(__newHandle)() in
+    // torch/csrc/generic/StorageSharing.cpp.
+    handle = fmt::format("/torch_rpc_{}_{}", getpid(), std::random_device()());
+    fd = shm_open(handle.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0 || errno != EEXIST) {
+      break;
+    }
+  }
+  TORCH_CHECK(
+      fd >= 0, "shm_open of RPC tensor segment failed: ", strerror(errno));
+  if (ftruncate(fd, (off_t)size) == -1) {
+    close(fd);
+    shm_unlink(handle.c_str());
+    TORCH_CHECK(false, "ftruncate of RPC tensor segment failed");
+  }
+  void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    shm_unlink(handle.c_str());
+    TORCH_CHECK(false, "mmap of RPC tensor segment failed");
+  }
+  memcpy(ptr, data, size);
+  munmap(ptr, size);
+  return handle;
+}
+#endif
+
+// Maps the shared-memory segment referenced by a "<nbytes> <handle>" tensor
+// section of the format produced by wireSerializeShm(). Mapping with
+// TH_ALLOCATOR_MAPPED_UNLINK removes the segment name right away, so its
+// memory is reclaimed once the mapping goes away even if the receiving
+// process later dies without cleanup.
+at::DataPtr mapShmSection(const char* data, size_t size) {
+  std::string ref(data, size);
+  auto sep = ref.find(' ');
+  size_t nbytes = c10::stoull(ref.substr(0, sep));
+  if (nbytes == 0) {
+    // Zero-byte storages carry no segment; see wireSerializeImpl().
+    return at::getCPUAllocator()->allocate(0);
+  }
+  TORCH_CHECK(
+      sep != std::string::npos, "malformed shm tensor section: \"", ref, "\"");
+  std::string handle = ref.substr(sep + 1);
+  return THMapAllocator::makeDataPtr(
+      handle.c_str(),
+      TH_ALLOCATOR_MAPPED_SHAREDMEM | TH_ALLOCATOR_MAPPED_NOCREATE |
+          TH_ALLOCATOR_MAPPED_UNLINK,
+      nbytes,
+      /* actual_size_out */ nullptr);
+}
 }; // namespace
 
 c10::List<at::Tensor> cloneSparseTensors(
@@ -342,9 +431,18 @@ c10::List<at::Tensor> cloneSparseTensors(
   return pTensors;
 }
 
-std::string wireSerialize(
+// Shared implementation for wireSerialize(), wireSerializeSegments() and
+// wireSerializeShm(). When `inlineTensorData` is set, the raw tensor storages
+// are appended to the returned buffer (the classic single-buffer format);
+// otherwise they are returned as separate aliasing segments and only their
+// sizes are recorded in the header. When `shmTensorData` is set, each storage
+// is instead copied into a POSIX shared-memory segment and its section holds
+// the "<nbytes> <handle>" reference.
+static WireSegments wireSerializeImpl(
     const std::vector<char>& payload,
-    const std::vector<at::Tensor>& tensors) {
+    const std::vector<at::Tensor>& tensors,
+    bool inlineTensorData,
+    bool shmTensorData = false) {
   for (const auto& tensor : tensors) {
     TORCH_CHECK(
         tensor.device().is_cpu(),
@@ -358,13 +456,17 @@ std::string wireSerialize(
     std::string name;
     const char* data;
     size_t size;
+    bool isTensorData;
   };
   std::vector<Ent> entries;
   std::string metaEntry;
   std::vector<at::Tensor> tensorData;
+  // Owns the "<nbytes> <handle>" strings the shm-mode entries point into;
+  // reserved up front so the data() pointers stay stable.
+  std::vector<std::string> shmRefs;
 
   if (!payload.empty()) {
-    entries.push_back({kPayload, payload.data(), payload.size()});
+    entries.push_back({kPayload, payload.data(), payload.size(), false});
   }
 
   if (!tensors.empty()) {
@@ -376,7 +478,11 @@ std::string wireSerialize(
     pickler.pushIValue(cloneSparseTensors(tensors));
     pickler.stop();
     tensorData = pickler.tensorData();
-    entries.push_back({kMeta, metaEntry.data(), metaEntry.size()});
+    entries.push_back({kMeta, metaEntry.data(), metaEntry.size(), false});
+    if (shmTensorData) {
+      entries.push_back({kShm, "1", 1, false});
+      shmRefs.reserve(tensorData.size());
+    }
     for (size_t i = 0; i < tensorData.size(); i++) {
       // Construct WritableTensorData for each tensor in the pickler tensorData
       // Since tensorData is in function scope, and getWritableTensorData just
@@ -386,10 +492,33 @@ std::string wireSerialize(
       // converts CUDA tensor to cpu and data() might get destructed as we go
       // out of scope of this loop.
       auto writeableTensorData = jit::getWriteableTensorData(tensorData[i]);
+#ifndef _WIN32
+      if (shmTensorData) {
+        // The section carries a "<nbytes> <handle>" reference to a fresh
+        // shared-memory segment rather than the storage bytes themselves.
+        if (writeableTensorData.sizeInBytes() == 0) {
+          shmRefs.emplace_back("0");
+        } else {
+          shmRefs.emplace_back(fmt::format(
+              "{} {}",
+              writeableTensorData.sizeInBytes(),
+              writeShmSegment(
+                  writeableTensorData.data(),
+                  writeableTensorData.sizeInBytes())));
+        }
+        entries.push_back(
+            {c10::to_string(i),
+             shmRefs.back().data(),
+             shmRefs.back().size(),
+             true});
+        continue;
+      }
+#endif
       entries.push_back(
           {c10::to_string(i),
            writeableTensorData.data(),
-           writeableTensorData.sizeInBytes()});
+           writeableTensorData.sizeInBytes(),
+           true});
     }
   }
 
@@ -404,13 +533,69 @@ std::string wireSerialize(
   }
   header.push_back('\n');
 
-  std::string out;
+  WireSegments result;
+  std::string& out = result.meta;
   out.reserve(header.size() + tot);
   out.append(header);
   for (const auto& e : entries) {
+    if (!inlineTensorData && e.isTensorData) {
+      // Hand the storage back as an aliasing flat char tensor instead of
+      // copying it into the wire buffer. Capturing the source tensor in the
+      // deleter keeps the storage alive for as long as the segment is.
+      at::Tensor src = tensorData[c10::stoull(e.name)];
+      result.segments.push_back(at::from_blob(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+          const_cast<char*>(e.data),
+          {(int64_t)e.size},
+          [src](void*) {},
+          at::kChar));
+      continue;
+    }
     out.append(e.data, e.size);
   }
-  return out;
+  return result;
+}
+
+std::string wireSerialize(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+  return std::move(
+      wireSerializeImpl(payload, tensors, /* inlineTensorData */ true).meta);
+}
+
+WireSegments wireSerializeSegments(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+  return wireSerializeImpl(payload, tensors, /* inlineTensorData */ false);
+}
+
+std::string wireSerializeShm(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+#ifdef _WIN32
+  // POSIX shared memory only; callers on Windows get the regular format.
+  return wireSerialize(payload, tensors);
+#else
+  return std::move(wireSerializeImpl(
+                       payload,
+                       tensors,
+                       /* inlineTensorData */ true,
+                       /* shmTensorData */ true)
+                       .meta);
+#endif
+}
+
+std::vector<int64_t> wireSegmentSizes(const void* data, size_t data_size) {
+  const char* ptr = static_cast<const char*>(data);
+  auto headerEnts = parseWireHeader(ptr, ptr + data_size);
+  std::vector<int64_t> sizes;
+  for (const auto& headerEnt : headerEnts) {
+    // Tensor storage sections carry numeric names; see wireSerializeImpl().
+    if (!headerEnt.first.empty() && isdigit(headerEnt.first[0])) {
+      sizes.push_back((int64_t)headerEnt.second);
+    }
+  }
+  return sizes;
 }
 
 std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
@@ -440,12 +625,18 @@ std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
       metaDataPos += toCopy;
       return toCopy;
     };
+    // Tensor sections of the shared-memory format hold "<nbytes> <handle>"
+    // references to be mapped instead of raw bytes to be copied out.
+    const bool shmTensors = sections.find(kShm) != sections.end();
     auto sectionReadFunc = [&](const std::string& ename) -> at::DataPtr {
       auto it = sections.find(ename);
       if (it == sections.end()) {
         throw std::runtime_error("Couldn't find entity " + ename);
       }
       const auto& idat = it->second;
+      if (shmTensors) {
+        return mapShmSection(idat.first, idat.second);
+      }
       auto dptr = at::getCPUAllocator()->allocate(idat.second);
       if (idat.second != 0) {
         memcpy(dptr.get(), idat.first, idat.second);
@@ -465,6 +656,92 @@ std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
   return {std::move(payload), std::move(tensors)};
 }
 
+std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserializeSegments(
+    const void* data,
+    size_t data_size,
+    std::vector<at::Tensor>& segments) {
+  const char* ptr = static_cast<const char*>(data);
+  const char* endp = ptr + data_size;
+  auto headerEnts = parseWireHeader(ptr, endp);
+
+  // Unlike parseWireSections(), only the payload and unpickler metadata live
+  // in this buffer; tensor storage sections were received separately into
+  // `segments`.
+  std::unordered_map<std::string, std::pair<const char*, size_t>> sections;
+  size_t numSegments = 0;
+  for (const auto& headerEnt : headerEnts) {
+    if (!headerEnt.first.empty() && isdigit(headerEnt.first[0])) {
+      auto idx = c10::stoull(headerEnt.first);
+      TORCH_CHECK(
+          idx < segments.size() &&
+              (size_t)segments[idx].numel() == headerEnt.second,
+          "Tensor segment ",
+          headerEnt.first,
+          " missing or of unexpected size");
+      ++numSegments;
+      continue;
+    }
+    sections[headerEnt.first] = {ptr, headerEnt.second};
+    ptr += headerEnt.second;
+  }
+  if (ptr != endp) {
+    throw std::runtime_error("failed bounds");
+  }
+  TORCH_CHECK(
+      numSegments == segments.size(),
+      "Expected ",
+      numSegments,
+      " tensor segments, got ",
+      segments.size());
+
+  std::vector<char> payload;
+  auto payloadIt = sections.find(kPayload);
+  if (payloadIt != sections.end() && payloadIt->second.second != 0) {
+    payload.assign(
+        payloadIt->second.first,
+        payloadIt->second.first + payloadIt->second.second);
+  }
+
+  std::vector<at::Tensor> tensors;
+  auto metaIt = sections.find(kMeta);
+  if (metaIt != sections.end()) {
+    const auto& metaData = metaIt->second;
+    size_t metaDataPos = 0;
+    auto metaDataReadFunc = [&](char* buf, size_t n) -> size_t {
+      if (metaDataPos >= metaData.second || n == 0) {
+        return 0;
+      }
+      size_t toCopy = std::min(metaDataPos + n, metaData.second) - metaDataPos;
+      memcpy(buf, metaData.first + metaDataPos, toCopy);
+      metaDataPos += toCopy;
+      return toCopy;
+    };
+    auto sectionReadFunc = [&](const std::string& ename) -> at::DataPtr {
+      // Adopt the received segment's storage outright instead of copying it
+      // into a fresh allocation. The DataPtr context keeps the segment tensor
+      // (and thereby the storage) alive.
+      auto idx = c10::stoull(ename);
+      TORCH_CHECK(idx < segments.size(), "Couldn't find entity ", ename);
+      auto* holder = new at::Tensor(segments[idx]);
+      return at::DataPtr(
+          holder->data_ptr(),
+          holder,
+          [](void* ctx) { delete static_cast<at::Tensor*>(ctx); },
+          at::kCPU);
+    };
+
+    // No need to pass typeResolver here, as it always processes string and
+    // tensors only
+    torch::jit::Unpickler unpickler(
+        metaDataReadFunc, nullptr, nullptr, sectionReadFunc, {});
+    auto ival = unpickler.parse_ivalue();
+    for (auto&& t : ival.toTensorList()) {
+      tensors.emplace_back(std::move(t));
+    }
+  }
+  return {std::move(payload), std::move(tensors)};
+}
+
 void writeWrappedPayload(
     std::vector<char>& originalPayload,
     std::vector<char>& additionalPayload) {
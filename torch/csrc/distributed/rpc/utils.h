@@ -56,6 +56,48 @@ TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
     const void* data,
     size_t data_size);
 
+// Scatter-gather variant of wireSerialize(). The returned string holds the
+// section header, the payload, and the pickled tensor metadata, but the raw
+// tensor storages are left out and returned as flat CPU char tensors that
+// alias the original storages, so large tensors are never copied into the
+// wire buffer. Each segment must be transmitted, in order, alongside the
+// metadata buffer.
+struct WireSegments {
+  std::string meta;
+  std::vector<at::Tensor> segments;
+};
+
+TORCH_API WireSegments wireSerializeSegments(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors);
+
+// Parses the section header of a buffer produced by wireSerializeSegments()
+// and returns the byte sizes of the tensor storage segments, in transmission
+// order. Used by receivers to preallocate the buffers they read segments into.
+TORCH_API std::vector<int64_t> wireSegmentSizes(
+    const void* data,
+    size_t data_size);
+
+// Counterpart of wireSerializeSegments(). `segments` must hold flat CPU char
+// tensors matching the sizes reported by wireSegmentSizes(); the deserialized
+// tensors adopt their storages directly instead of copying out of them.
+TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>>
+wireDeserializeSegments(
+    const void* data,
+    size_t data_size,
+    std::vector<at::Tensor>& segments);
+
+// Same-host variant of wireSerialize(). Tensor storages are copied into
+// freshly created POSIX shared-memory segments and only the segment handles
+// are embedded in the returned buffer, so the transport never carries the
+// tensor bytes. wireDeserialize() recognizes the format and maps the segments
+// in place of allocating; each mapping unlinks its segment, so a message
+// serialized this way must be deserialized exactly once, by a process sharing
+// the sender's /dev/shm. On Windows this falls back to plain wireSerialize().
+TORCH_API std::string wireSerializeShm(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors);
+
 // We use vector<char> as the type of blobs because it's what rpc::Message uses
 // for its payload, even though it has the disadvantage that it cannot be
 // allocated with uninitialized memory: it is always zeroed out.
@@ -0,0 +1,95 @@
+#include <torch/csrc/jit/cuda/graph_runner.h>
+
+#include <ATen/core/grad_mode.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAGuard.h>
+
+namespace torch {
+namespace jit {
+namespace cuda {
+
+CudaGraphRunner::CudaGraphRunner(Module module, size_t warmup_runs)
+    : module_(std::move(module)),
+      warmup_runs_(warmup_runs),
+      // Capture is illegal on the default stream; warmup, capture and
+      // replay all happen on this side stream so their ordering is trivial.
+      capture_stream_(c10::cuda::getStreamFromPool()) {
+  TORCH_CHECK(
+      !module_.is_training(),
+      "CudaGraphRunner requires a frozen module; run torch::jit::freeze "
+      "on it first.");
+}
+
+IValue CudaGraphRunner::run_eager(std::vector<IValue> inputs) {
+  return module_.forward(std::move(inputs));
+}
+
+void CudaGraphRunner::check_and_copy_inputs(
+    const std::vector<IValue>& inputs) {
+  TORCH_CHECK(
+      inputs.size() == static_inputs_.size(),
+      "CudaGraphRunner: expected ", static_inputs_.size(),
+      " inputs, got ", inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const at::Tensor& t = inputs[i].toTensor();
+    const at::Tensor& s = static_inputs_[i];
+    TORCH_CHECK(
+        t.sizes() == s.sizes() && t.dtype() == s.dtype() &&
+            t.device() == s.device(),
+        "CudaGraphRunner: input ", i, " (", t.toString(), t.sizes(),
+        ") doesn't match the captured input (", s.toString(), s.sizes(),
+        "); captured graphs require static shapes.");
+    s.copy_(t, /*non_blocking=*/true);
+  }
+}
+
+IValue CudaGraphRunner::run(std::vector<IValue> inputs) {
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    TORCH_CHECK(
+        inputs[i].isTensor() && inputs[i].toTensor().is_cuda(),
+        "CudaGraphRunner: all forward() arguments must be CUDA tensors, "
+        "but argument ", i, " is ", inputs[i].tagKind());
+  }
+
+  at::NoGradGuard no_grad;
+  c10::cuda::CUDAStreamGuard stream_guard(capture_stream_);
+
+  if (captured_) {
+    check_and_copy_inputs(inputs);
+    graph_.replay();
+    return static_output_;
+  }
+
+  if (runs_so_far_ < warmup_runs_) {
+    ++runs_so_far_;
+    auto result = run_eager(std::move(inputs));
+    capture_stream_.synchronize();
+    return result;
+  }
+
+  // Warmup is done; capture this call. forward() must see the tensors the
+  // replays will see, so the incoming inputs are cloned into static
+  // buffers first (outside the graph, they're real allocations).
+  static_inputs_.reserve(inputs.size());
+  std::vector<IValue> static_input_ivalues;
+  static_input_ivalues.reserve(inputs.size());
+  for (const auto& input : inputs) {
+    static_inputs_.push_back(input.toTensor().clone());
+    static_input_ivalues.emplace_back(static_inputs_.back());
+  }
+  capture_stream_.synchronize();
+
+  graph_.capture_begin();
+  static_output_ = run_eager(std::move(static_input_ivalues));
+  graph_.capture_end();
+  captured_ = true;
+
+  // Capture only records the work; replay once so this call also returns
+  // real results.
+  graph_.replay();
+  return static_output_;
+}
+
+} // namespace cuda
+} // namespace jit
+} // namespace torch
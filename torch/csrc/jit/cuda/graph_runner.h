@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ATen/cuda/CUDAGraph.h>
+#include <c10/cuda/CUDAStream.h>
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/api/module.h>
+
+#include <vector>
+
+namespace torch {
+namespace jit {
+namespace cuda {
+
+// Executes a frozen, static-shape module by replaying a captured CUDA
+// graph instead of re-launching its kernels one by one. For launch-bound
+// models (many small kernels per forward) replay collapses per-kernel
+// launch overhead into a single cudaGraphLaunch.
+//
+// The first `warmup_runs` calls execute the module eagerly on a side
+// stream so lazy state settles (cuDNN heuristics, allocator pools,
+// lazily-compiled fusions); the next call captures forward() into a CUDA
+// graph, allocating through a capture-private memory pool in the caching
+// allocator (see Note [Interaction with CUDA graph capture]); every call
+// after that copies the inputs into the captured input tensors and
+// replays the graph.
+//
+// Constraints, checked at runtime:
+//  - the module must be frozen (run torch::jit::freeze first);
+//  - all forward() arguments must be CUDA tensors whose shapes, dtypes
+//    and devices match the captured run exactly;
+//  - the returned IValue references the graph's static output tensors,
+//    which are overwritten by the next run() - copy them out before the
+//    next request if they need to survive.
+class TORCH_CUDA_CU_API CudaGraphRunner {
+ public:
+  explicit CudaGraphRunner(Module module, size_t warmup_runs = 3);
+
+  IValue run(std::vector<IValue> inputs);
+
+  // True once forward() has been captured and run() replays the graph.
+  bool captured() const {
+    return captured_;
+  }
+
+ private:
+  IValue run_eager(std::vector<IValue> inputs);
+  void check_and_copy_inputs(const std::vector<IValue>& inputs);
+
+  Module module_;
+  size_t warmup_runs_;
+  size_t runs_so_far_ = 0;
+  bool captured_ = false;
+
+  at::cuda::CUDAGraph graph_;
+  c10::cuda::CUDAStream capture_stream_;
+  std::vector<at::Tensor> static_inputs_;
+  IValue static_output_;
+};
+
+} // namespace cuda
+} // namespace jit
+} // namespace torch
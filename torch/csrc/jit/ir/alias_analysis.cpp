@@ -201,9 +201,13 @@ AliasDb::AliasDb(std::shared_ptr<Graph> graph, bool isFrozen)
     }
   }
 
-  // Now that we've built the write index, we can null out the WriteRegistry to
-  // make future access an error. In this way we prevent the index from getting
-  // out of sync (since we have no way of registering new writes)
+  // Keep track of the wildcard writers, so that wildcard elements created by
+  // incremental analysis can be added to their write sets as well.
+  wildcardWriters_ = std::move(writeRegistry_->writesToAllWildcards_);
+
+  // Now that we've built the write index, we can null out the WriteRegistry.
+  // Incremental analysis (see tryAnalyzeInsertedNode) registers new writes
+  // directly against the index instead.
   writeRegistry_ = nullptr;
 
   // initialize the write cache
@@ -805,11 +809,29 @@ void AliasDb::registerWrite(const Value* v, Node* n, bool writeToContained) {
     // don't need to register a write if the value isn't mutable
     return;
   }
+  if (writeRegistry_) {
+    if (writeToContained) {
+      writeRegistry_->registerWriteToAllContained(v, n);
+    } else {
+      writeRegistry_->registerWrite(v, n);
+    }
+    return;
+  }
+  // We are in incremental analysis (see tryAnalyzeInsertedNode); the memory
+  // locations of `v` are already final, so fold the write into the indices
+  // directly.
+  auto it = elementMap_.find(v);
+  TORCH_INTERNAL_ASSERT(
+      it != elementMap_.end(), "Tried to write to value not in MemoryDAG");
+  MemoryLocations writtenMemoryLocations;
   if (writeToContained) {
-    writeRegistry_->registerWriteToAllContained(v, n);
+    memoryDAG_->collectAllContainedMemoryLocations(
+        it->second, writtenMemoryLocations);
   } else {
-    writeRegistry_->registerWrite(v, n);
+    writtenMemoryLocations = memoryDAG_->getMemoryLocations(it->second);
   }
+  (*writeIndex_)[n] |= writtenMemoryLocations;
+  *writtenToLocationsIndex_ |= writtenMemoryLocations;
 }
 
 void AliasDb::analyzeIf(Node* node) {
@@ -915,7 +937,16 @@ void AliasDb::analyzeWait(Node* node) {
   // the forked subgraph that `wait` is waiting on may write to any of its
   // inputs. We don't have a reliable way of recovering the fork inputs, so
   // for safety we just register a write to every wildcard.
-  writeRegistry_->registerWriteToAllWildcards(node);
+  if (writeRegistry_) {
+    writeRegistry_->registerWriteToAllWildcards(node);
+  } else {
+    wildcardWriters_.insert(node);
+    auto& writes = (*writeIndex_)[node];
+    for (const auto& pr : wildcardIndex_) {
+      writes.set(pr.second->index);
+      writtenToLocationsIndex_->set(pr.second->index);
+    }
+  }
 }
 
 void AliasDb::analyzeRpcAsync(Node* node) {
@@ -1033,8 +1064,13 @@ void AliasDb::analyzeContainerConstruct(Node* node) {
   for (auto input : node->inputs()) {
     auto maybe_wildcard_elem = setWildcard(input);
     if (maybe_wildcard_elem) {
-      memoryDAGBuilder_->addToContainedElements(
-          *maybe_wildcard_elem, container_elem);
+      if (memoryDAGBuilder_) {
+        memoryDAGBuilder_->addToContainedElements(
+            *maybe_wildcard_elem, container_elem);
+      } else {
+        memoryDAG_->unsafeAddToContainedElements(
+            *maybe_wildcard_elem, container_elem);
+      }
     }
   }
 }
@@ -1104,7 +1140,16 @@ void AliasDb::makePointerTo(const Value* from, const Value* to) {
   auto fromEl = getOrCreateElement(from);
   auto toEl = getOrCreateElement(to);
 
-  memoryDAGBuilder_->makePointerTo(fromEl, toEl);
+  if (memoryDAGBuilder_) {
+    memoryDAGBuilder_->makePointerTo(fromEl, toEl);
+  } else {
+    // Incremental analysis may only add edges from elements it created
+    // itself; everything older may have memoized memory locations.
+    TORCH_INTERNAL_ASSERT(
+        newElements_.count(fromEl),
+        "Incremental analysis tried to change the aliasing of a pre-existing value");
+    memoryDAG_->unsafeMakePointerTo(fromEl, toEl);
+  }
 }
 
 void AliasDb::addToContainedElements(
@@ -1119,7 +1164,11 @@ void AliasDb::addToContainedElements(
   auto elemEl = getOrCreateElement(elem);
   auto contEl = getOrCreateElement(container);
 
-  memoryDAGBuilder_->addToContainedElements(elemEl, contEl);
+  if (memoryDAGBuilder_) {
+    memoryDAGBuilder_->addToContainedElements(elemEl, contEl);
+  } else {
+    memoryDAG_->unsafeAddToContainedElements(elemEl, contEl);
+  }
 }
 
 bool AliasDb::mayAlias(const Value* a, const Value* b) const {
@@ -1215,7 +1264,14 @@ void AliasDb::giveFreshAlias(
     return;
   }
 
-  auto new_elem = memoryDAGBuilder_->makeFreshValue(value);
+  Element* new_elem;
+  if (memoryDAGBuilder_) {
+    new_elem = memoryDAGBuilder_->makeFreshValue(value);
+  } else {
+    // Incremental analysis after construction; see tryAnalyzeInsertedNode.
+    new_elem = memoryDAG_->unsafeMakeFreshValue(value);
+    newElements_.insert(new_elem);
+  }
   elementMap_[value] = new_elem;
   if (add_wildcard_to_contained_elems) {
     addContainedTypesToFreshElement(new_elem, *maybe_mut_type);
@@ -1264,6 +1320,138 @@ void AliasDb::copyValue(Value* from, Value* to) {
   origElem->values.insert(to);
 }
 
+// A node can be analyzed incrementally if its effects can be expressed
+// without touching aliasing information that was already computed: fresh
+// elements, points-to edges out of fresh elements, and new write entries are
+// all fine; making a pre-existing value point at the wildcard set is not,
+// because the constructor has already run the batched wildcard handling (see
+// MemoryDAG::setWildcards). The checks below are conservative: inner nodes of
+// sub-blocks only operate on values created along with `node`, but we reject
+// them by kind all the same to keep this simple.
+bool AliasDb::canAnalyzeNodeIncrementally(Node* node) const {
+  for (Block* block : node->blocks()) {
+    for (Node* inner : block->nodes()) {
+      if (!canAnalyzeNodeIncrementally(inner)) {
+        return false;
+      }
+    }
+  }
+
+  auto hasMutableInput = [&]() {
+    return std::any_of(
+        node->inputs().begin(), node->inputs().end(), [&](Value* input) {
+          return isMutableTypeInternal(input);
+        });
+  };
+
+  switch (node->kind()) {
+    case prim::FusionGroup:
+    case prim::CudaFusionGroup:
+    case prim::FunctionalGraph:
+    case prim::DifferentiableGraph:
+    case prim::FallbackGraph: {
+      const auto subgraph = node->g(attr::Subgraph).get();
+      for (Node* inner : subgraph->block()->nodes()) {
+        if (!canAnalyzeNodeIncrementally(inner)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case prim::fork:
+    case prim::rpc_async:
+    case prim::rpc_sync:
+    case prim::rpc_remote:
+    case prim::CallFunction:
+    case prim::CallMethod:
+    case prim::Enter:
+    case prim::Exit:
+    case prim::TupleConstruct:
+    case prim::DictConstruct:
+    case prim::ListConstruct:
+      // These may add pre-existing inputs to the wildcard set.
+      return !hasMutableInput();
+    case prim::SetAttr:
+      // The assigned value becomes a wildcard.
+      return !isMutableTypeInternal(node->inputs().at(1));
+    default:
+      break;
+  }
+
+  auto op = node->maybeOperator();
+  if (!op) {
+    // The remaining special cases in analyzeImpl only assign aliasing
+    // information to the node's own outputs, which are necessarily new
+    // values.
+    return true;
+  }
+  switch (op->aliasAnalysisKind()) {
+    case AliasAnalysisKind::CONSERVATIVE:
+      // Conservative analysis wildcards every mutable input.
+      return !hasMutableInput();
+    case AliasAnalysisKind::FROM_SCHEMA: {
+      const auto& schema = node->schema();
+      for (size_t i = 0; i < schema.arguments().size(); i++) {
+        const auto& formal = schema.arguments()[i].alias_info();
+        if (formal && formal->isWildcardAfter() &&
+            isMutableTypeInternal(node->inputs().at(i))) {
+          return false;
+        }
+      }
+      return true;
+    }
+    default:
+      return true;
+  }
+}
+
+bool AliasDb::tryAnalyzeInsertedNode(Node* node) {
+  if (!canAnalyzeNodeIncrementally(node)) {
+    return false;
+  }
+  newElements_.clear();
+  analyze(node);
+  newElements_.clear();
+  return true;
+}
+
+void AliasDb::removeNodeImpl(Node* node, bool* removed_writes) {
+  for (Block* block : node->blocks()) {
+    for (Value* input : block->inputs()) {
+      auto it = elementMap_.find(input);
+      if (it != elementMap_.end()) {
+        it->second->values.erase(input);
+        elementMap_.erase(it);
+      }
+    }
+    for (Node* inner : block->nodes()) {
+      removeNodeImpl(inner, removed_writes);
+    }
+  }
+  if (writeIndex_->erase(node)) {
+    *removed_writes = true;
+  }
+  wildcardWriters_.erase(node);
+  for (Value* output : node->outputs()) {
+    auto it = elementMap_.find(output);
+    if (it != elementMap_.end()) {
+      // The element stays behind in the MemoryDAG (its edges may be shared
+      // with values that are still alive), but it must not be reachable from
+      // the dead value anymore.
+      it->second->values.erase(output);
+      elementMap_.erase(it);
+    }
+  }
+}
+
+void AliasDb::removeNode(Node* node) {
+  bool removed_writes = false;
+  removeNodeImpl(node, &removed_writes);
+  if (removed_writes) {
+    buildWrittenToLocationsIndex();
+  }
+}
+
 bool AliasDb::moveAfterTopologicallyValid(Node* n, Node* movePoint) {
   return tryMove(n, movePoint, MoveSide::AFTER, /*dryRun=*/false);
 }
@@ -1650,7 +1838,20 @@ c10::optional<Element*> AliasDb::tryGetOrCreateWildcard(const TypePtr& type) {
     return existing_wildcard->second;
   }
 
-  auto wildcard_elem = memoryDAGBuilder_->makeFreshValue(nullptr);
+  Element* wildcard_elem;
+  if (memoryDAGBuilder_) {
+    wildcard_elem = memoryDAGBuilder_->makeFreshValue(nullptr);
+  } else {
+    wildcard_elem = memoryDAG_->unsafeMakeFreshValue(nullptr);
+    // Wildcard writers must write to every wildcard element, including ones
+    // created after construction.
+    for (Node* writer : wildcardWriters_) {
+      (*writeIndex_)[writer].set(wildcard_elem->index);
+    }
+    if (!wildcardWriters_.empty()) {
+      writtenToLocationsIndex_->set(wildcard_elem->index);
+    }
+  }
   wildcardIndex_.emplace(mapped_type, wildcard_elem);
   addContainedTypesToFreshElement(wildcard_elem, mapped_type);
   return wildcard_elem;
@@ -1662,7 +1863,11 @@ void AliasDb::addContainedTypesToFreshElement(
   for (const auto& contained : mut_type->containedTypes()) {
     auto maybe_elem = tryGetOrCreateWildcard(contained);
     if (maybe_elem) {
-      memoryDAGBuilder_->addToContainedElements(*maybe_elem, container_elem);
+      if (memoryDAGBuilder_) {
+        memoryDAGBuilder_->addToContainedElements(*maybe_elem, container_elem);
+      } else {
+        memoryDAG_->unsafeAddToContainedElements(*maybe_elem, container_elem);
+      }
     }
   }
 }
@@ -1690,7 +1895,17 @@ c10::optional<Element*> AliasDb::setWildcard(const Value* v) {
   }
   // Ensure that we create a corresponding element for `v` still, as it is an
   // invariant that all mutable values have an element.
-  getOrCreateElement(v);
+  auto elem = getOrCreateElement(v);
+  if (!memoryDAGBuilder_) {
+    // The batched wildcard handling in the constructor has already run, so
+    // point the element at the wildcard directly. The element must be one we
+    // just created, otherwise we would be invalidating memoized memory
+    // locations.
+    TORCH_INTERNAL_ASSERT(
+        newElements_.count(elem),
+        "Incremental analysis tried to add a pre-existing value to the wildcard set");
+    memoryDAG_->unsafeMakePointerTo(elem, *maybe_wildcardElement);
+  }
   wildcards_.insert(v);
   return *maybe_wildcardElement;
 }
@@ -146,6 +146,25 @@ class AliasDb {
   // Create a new `value` that does not alias anything else.
   void createValue(const Value* value);
 
+  // Incrementally analyze `node`, which must have been inserted into the
+  // graph after this AliasDb was built. Returns true on success. Returns
+  // false, leaving the AliasDb untouched, if `node`'s aliasing behavior
+  // cannot be expressed without rewriting aliasing information that has
+  // already been computed (e.g. it adds a pre-existing value to the wildcard
+  // set); the caller must then rebuild the AliasDb.
+  //
+  // Together with `removeNode` and the value-level methods above, this
+  // allows a single AliasDb instance to survive a pipeline of mutating
+  // passes instead of being rebuilt from scratch by each one. To replace a
+  // node, analyze the replacement first, transfer each output's aliasing
+  // with `replaceWithNewValue`, then `removeNode` the original.
+  TORCH_API bool tryAnalyzeInsertedNode(Node* node);
+  // Remove the aliasing and write information associated with `node` and its
+  // outputs. Call this right before destroying a node, so that a stale entry
+  // is not left behind (or matched by a new node allocated at the same
+  // address).
+  TORCH_API void removeNode(Node* node);
+
   friend struct MutationRemover;
 
  private:
@@ -207,6 +226,14 @@ class AliasDb {
   void analyzeContainerConstruct(Node* node);
   bool tryRegisteredAnalysis(Node* node);
 
+  /**
+   * Incremental update methods
+   */
+  // Can `node`'s aliasing behavior be expressed with post-construction
+  // updates only? See `tryAnalyzeInsertedNode`.
+  bool canAnalyzeNodeIncrementally(Node* node) const;
+  void removeNodeImpl(Node* node, bool* removed_writes);
+
   /**
    * Alias manipulation methods
    */
@@ -239,6 +266,10 @@ class AliasDb {
 
   // Mapping of values to MemoryDAG elements
   ska::flat_hash_map<const Value*, Element*> elementMap_;
+  // Elements created by the in-flight `tryAnalyzeInsertedNode` call. Only
+  // these may gain new points-to edges after construction; everything older
+  // may have memoized memory locations (see MemoryDAG::getMemoryLocations).
+  ska::flat_hash_set<const Element*> newElements_;
   // All wildcard elements (one for each unique mutable type).
   std::unordered_map<TypePtr, Element*, HashType, EqualType> wildcardIndex_;
   Element* getWildcard(const TypePtr& type) const;
@@ -270,6 +301,10 @@ class AliasDb {
   // Collection of all memory locations that are written to.
   c10::optional<MemoryLocations> writtenToLocationsIndex_;
   void buildWrittenToLocationsIndex();
+  // Nodes that write to every wildcard element (e.g. aten::wait). Retained
+  // after construction so that wildcards created by incremental analysis can
+  // be added to their write sets.
+  std::unordered_set<Node*> wildcardWriters_;
 
   std::unordered_set<const Value*> wildcards_;
 
@@ -1235,7 +1235,7 @@ void Node::eraseOutput(size_t i) {
 
 Block* Node::addBlock() {
   op_ = nullptr;
-  blocks_.push_back(new Block(owningGraph(), this));
+  blocks_.push_back(new (*graph_) Block(owningGraph(), this));
   return blocks_.back();
 }
 
@@ -1350,14 +1350,14 @@ void Node::replaceInputWith(Value* from, Value* to) {
 }
 
 Value* Node::addOutput() {
-  outputs_.push_back(new Value(this, outputs_.size()));
+  outputs_.push_back(new (*graph_) Value(this, outputs_.size()));
   op_ = nullptr;
   return outputs_.back();
 }
 
 Value* Node::insertOutput(size_t i) {
   op_ = nullptr;
-  outputs_.insert(outputs_.begin() + i, new Value(this, i));
+  outputs_.insert(outputs_.begin() + i, new (*graph_) Value(this, i));
   for (size_t itr = i + 1; itr < outputs_.size(); ++itr) {
     outputs_[itr]->setOffset(outputs_[itr]->offset() + 1);
   }
@@ -1585,7 +1585,7 @@ Value* Graph::insert(
 
 Node* Graph::create(NodeKind kind, size_t num_outputs) {
   // NB: Node constructor adds node to all_nodes
-  auto n = new Node(this, kind);
+  auto n = new (*this) Node(this, kind);
   for (size_t i = 0; i < num_outputs; i++) {
     n->addOutput();
   }
@@ -2101,7 +2101,7 @@ void ProfileOp::cloneFrom(Node* other_) {
 }
 
 Node* ProfileOp::allocNewInstance(Graph* g) {
-  return new ProfileOp(g, {nullptr});
+  return new (*g) ProfileOp(g, {nullptr});
 }
 
 void ProfileIValueOp::cloneFrom(Node* other_) {
@@ -2111,7 +2111,7 @@ void ProfileIValueOp::cloneFrom(Node* other_) {
 }
 
 Node* ProfileIValueOp::allocNewInstance(Graph* g) {
-  return new ProfileIValueOp(g, {nullptr});
+  return new (*g) ProfileIValueOp(g, {nullptr});
 }
 
 TypePtr NamedValue::type() const {
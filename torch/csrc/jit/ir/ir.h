@@ -19,8 +19,11 @@
 #include <c10/util/ArrayRef.h>
 #include <c10/util/Exception.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -167,10 +170,58 @@ struct Wrap {
   void (*clear_cb)(void*);
 };
 
+// Note [IR object arena]
+// ~~~~~~~~~~~~~~~~~~~~~~
+// Nodes, Values and Blocks are owned by their Graph and die with it (see
+// all_nodes/all_values/all_blocks and ~Graph), so allocating each of them
+// individually on the heap buys nothing and costs a lot on big graphs:
+// passes like DCE and CSE spend much of their time in the allocator and
+// chasing pointers scattered across the heap. Instead, every Graph owns a
+// bump arena that hands out IR objects from large contiguous chunks in
+// creation order, which is roughly traversal order for most passes.
+// Destroying a single Node/Value (e.g. during DCE) runs its destructor but
+// intentionally returns no memory; everything is reclaimed at once when the
+// Graph is destroyed. Consequently IR objects can only be allocated via the
+// placement forms of operator new declared on Value/Node/Block, which take
+// the owning Graph.
+class IRArena {
+ public:
+  void* allocate(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (size > remaining_) {
+      grow(size);
+    }
+    char* result = cur_;
+    cur_ += size;
+    remaining_ -= size;
+    return result;
+  }
+
+ private:
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  void grow(size_t min_size) {
+    size_t chunk_size = std::max(min_size, kChunkSize);
+    chunks_.emplace_back(new char[chunk_size]);
+    cur_ = chunks_.back().get();
+    remaining_ = chunk_size;
+  }
+
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  char* cur_ = nullptr;
+  size_t remaining_ = 0;
+};
+
 struct Value {
   TH_DISALLOW_COPY_AND_ASSIGN(Value);
   Value(Node* node_, size_t offset_);
 
+  // See Note [IR object arena]
+  static void* operator new(size_t size, Graph& g);
+  static void operator delete(void* ptr, Graph& g) {}
+  static void operator delete(void* ptr) {}
+
  private:
   friend struct Node;
   friend struct Graph;
@@ -284,6 +335,12 @@ struct Value {
 
 struct TORCH_API Node {
   TH_DISALLOW_COPY_AND_ASSIGN(Node);
+
+  // See Note [IR object arena]; covers subclasses such as ProfileOp too
+  static void* operator new(size_t size, Graph& g);
+  static void operator delete(void* ptr, Graph& g) {}
+  static void operator delete(void* ptr) {}
+
   friend struct Graph;
   friend struct Block;
   friend struct Value;
@@ -932,7 +989,7 @@ struct TORCH_API Node {
   // concrete type as 'this', but in graph 'g' which might be different
   // than graph_
   virtual Node* allocNewInstance(Graph* g) {
-    return new Node(g, kind());
+    return new (*g) Node(g, kind());
   }
   // create a copy of all properties of Node s into this.
   // subclasses should extend if they have additional information to copy.
@@ -949,6 +1006,11 @@ struct Block {
   TH_DISALLOW_COPY_AND_ASSIGN(Block);
   TORCH_API Block(Graph* graph_, Node* node_);
 
+  // See Note [IR object arena]
+  static void* operator new(size_t size, Graph& g);
+  static void operator delete(void* ptr, Graph& g) {}
+  static void operator delete(void* ptr) {}
+
   at::ArrayRef<Value*> inputs() {
     return input_->outputs();
   }
@@ -1085,6 +1147,10 @@ struct Graph {
   friend struct Block;
 
  private:
+  // backs the memory of all Nodes, Values and Blocks of this graph;
+  // declared first so it outlives them. See Note [IR object arena]
+  IRArena arena_;
+
   // only used to keep track of allocated nodes
   // actual representation of Graph is done with
   // inputs, outputs, nodes
@@ -1111,7 +1177,7 @@ struct Graph {
   Graph(ScopePtr scope_root)
       : next_unique_(0),
         current_scope_(std::move(scope_root)),
-        block_(new Block(this, nullptr)),
+        block_(new (*this) Block(this, nullptr)),
         insert_before_(return_node()) {}
 
   Graph() : Graph(c10::make_intrusive<Scope>()) {}
@@ -1379,6 +1445,18 @@ struct WithCurrentScope {
   ScopePtr prev_scope_;
 };
 
+inline void* Value::operator new(size_t size, Graph& g) {
+  return g.arena_.allocate(size);
+}
+
+inline void* Node::operator new(size_t size, Graph& g) {
+  return g.arena_.allocate(size);
+}
+
+inline void* Block::operator new(size_t size, Graph& g) {
+  return g.arena_.allocate(size);
+}
+
 inline Value::Value(Node* node_, size_t offset_)
     : node_(node_),
       offset_(offset_),
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <c10/util/StringUtil.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+struct PassStats {
+  size_t invocations = 0;
+  uint64_t total_time_ns = 0;
+  int64_t node_delta = 0;
+};
+
+std::mutex& stats_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<std::string, PassStats>& passes_to_stats() {
+  static std::unordered_map<std::string, PassStats> passes_to_stats;
+  return passes_to_stats;
+}
+
+uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t countNodes(Block* block) {
+  int64_t count = 0;
+  for (Node* node : block->nodes()) {
+    ++count;
+    for (Block* sub : node->blocks()) {
+      count += countNodes(sub);
+    }
+  }
+  return count;
+}
+
+std::string passNameFromFile(const char* cfname) {
+  std::string pass{cfname};
+  pass = c10::detail::StripBasename(pass);
+  pass = c10::detail::ExcludeFileExtension(pass);
+  return pass;
+}
+
+} // namespace
+
+bool pass_stats_enabled() {
+  static const bool enabled = std::getenv("PYTORCH_JIT_PASS_STATS") != nullptr;
+  return enabled;
+}
+
+void record_pass_stats(
+    const char* cfname,
+    uint64_t wall_time_ns,
+    int64_t node_delta) {
+  std::lock_guard<std::mutex> guard(stats_mutex());
+  PassStats& stats = passes_to_stats()[passNameFromFile(cfname)];
+  stats.invocations++;
+  stats.total_time_ns += wall_time_ns;
+  stats.node_delta += node_delta;
+}
+
+PassStatsScope::PassStatsScope(const char* cfname, const Graph& graph)
+    : cfname_(cfname), graph_(graph), enabled_(pass_stats_enabled()) {
+  if (enabled_) {
+    start_nodes_ = countNodes(graph_.block());
+    start_ns_ = now_ns();
+  }
+}
+
+PassStatsScope::~PassStatsScope() {
+  if (enabled_) {
+    uint64_t elapsed_ns = now_ns() - start_ns_;
+    record_pass_stats(
+        cfname_, elapsed_ns, countNodes(graph_.block()) - start_nodes_);
+  }
+}
+
+std::string pass_stats_report() {
+  std::vector<std::pair<std::string, PassStats>> ranked;
+  {
+    std::lock_guard<std::mutex> guard(stats_mutex());
+    ranked.assign(passes_to_stats().begin(), passes_to_stats().end());
+  }
+  std::sort(
+      ranked.begin(),
+      ranked.end(),
+      [](const std::pair<std::string, PassStats>& a,
+         const std::pair<std::string, PassStats>& b) {
+        return a.second.total_time_ns > b.second.total_time_ns;
+      });
+
+  std::stringstream ss;
+  ss << std::left << std::setw(40) << "pass" << std::right << std::setw(10)
+     << "calls" << std::setw(14) << "total_ms" << std::setw(14) << "avg_ms"
+     << std::setw(12) << "node_delta"
+     << "\n";
+  for (const auto& entry : ranked) {
+    const PassStats& stats = entry.second;
+    double total_ms = static_cast<double>(stats.total_time_ns) / 1e6;
+    ss << std::left << std::setw(40) << entry.first << std::right
+       << std::setw(10) << stats.invocations << std::setw(14) << std::fixed
+       << std::setprecision(3) << total_ms << std::setw(14)
+       << total_ms / static_cast<double>(stats.invocations) << std::setw(12)
+       << stats.node_delta << "\n";
+  }
+  return ss.str();
+}
+
+void reset_pass_stats() {
+  std::lock_guard<std::mutex> guard(stats_mutex());
+  passes_to_stats().clear();
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,68 @@
+#pragma once
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <cstdint>
+#include <string>
+
+// `TorchScript` offers a lightweight per-pass profiler that can be enabled by
+// setting the environment variable `PYTORCH_JIT_PASS_STATS` (to any value).
+
+// For every instrumented pass it accumulates, keyed by the pass's file name
+// (the same convention `PYTORCH_JIT_LOG_LEVEL` and `PYTORCH_JIT_OPT_LIMIT`
+// use), the number of invocations, the total wall time spent in the pass and
+// the net change in graph node count the pass produced. The latter is a cheap
+// proxy for how much work a pass actually did, which, together with the wall
+// time, answers the usual compile-latency question: which passes are
+// expensive, and are the expensive ones earning their keep.
+
+// A pass is instrumented by placing `JIT_PASS_STATS_SCOPE(graph)` at the top
+// of its entry point. The scope is free when `PYTORCH_JIT_PASS_STATS` is not
+// set; when it is set, entering and leaving the scope counts the graph's
+// nodes and timestamps the pass.
+
+// The accumulated report, ranked by total wall time, can be retrieved with
+// `pass_stats_report()` in C++ or `torch._C._jit_pass_stats_report()` in
+// Python, and cleared with `reset_pass_stats()` /
+// `torch._C._jit_pass_stats_reset()`.
+
+namespace torch {
+namespace jit {
+
+struct Graph;
+
+TORCH_API bool pass_stats_enabled();
+
+// Folds one timed invocation of the pass identified by \p cfname (a __FILE__
+// string) into the accumulated statistics.
+TORCH_API void record_pass_stats(
+    const char* cfname,
+    uint64_t wall_time_ns,
+    int64_t node_delta);
+
+// RAII helper that times the enclosing scope and records the node-count delta
+// of \p graph between construction and destruction. Does nothing unless
+// `PYTORCH_JIT_PASS_STATS` is set.
+struct TORCH_API PassStatsScope {
+  PassStatsScope(const char* cfname, const Graph& graph);
+  ~PassStatsScope();
+
+  PassStatsScope(const PassStatsScope&) = delete;
+  PassStatsScope& operator=(const PassStatsScope&) = delete;
+
+ private:
+  const char* cfname_;
+  const Graph& graph_;
+  bool enabled_;
+  uint64_t start_ns_ = 0;
+  int64_t start_nodes_ = 0;
+};
+
+// Returns the accumulated statistics as a table ranked by total wall time.
+TORCH_API std::string pass_stats_report();
+
+TORCH_API void reset_pass_stats();
+
+#define JIT_PASS_STATS_SCOPE(GRAPH) \
+  ::torch::jit::PassStatsScope jit_pass_stats_scope_(__FILE__, (GRAPH))
+
+} // namespace jit
+} // namespace torch
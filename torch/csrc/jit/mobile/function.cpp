@@ -97,6 +97,7 @@ void Function::set_register_size(size_t size) {
 }
 
 std::string Function::get_module_debug_info(size_t pc) const {
+  materialize();
   TORCH_CHECK(
       pc < pc_to_module_debug_info_.size(),
       "Module debug info index out of boundary.");
@@ -108,9 +109,38 @@ void Function::setSchema(c10::FunctionSchema schema) {
 }
 
 const at::optional<c10::FunctionSchema>& Function::getSchema() const {
+  materialize();
   return schema_;
 }
 
+void Function::set_lazy_parse(std::function<void(Function&)> parse) {
+  lazy_parse_ = std::move(parse);
+  parse_pending_.store(true, std::memory_order_release);
+}
+
+void Function::materialize() const {
+  if (!parse_pending_.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(parse_mutex_);
+  if (!parse_pending_.load(std::memory_order_relaxed)) {
+    return; // another thread won the race
+  }
+  // Consume the callback before invoking it; if it throws (e.g. because of
+  // an unsupported operator), the error surfaces on the first call instead
+  // of at load time, and the function stays unusable rather than being
+  // half-parsed a second time.
+  TORCH_CHECK(
+      static_cast<bool>(lazy_parse_),
+      "Method '",
+      name(),
+      "' cannot be run: its deferred parsing failed previously.");
+  auto parse = std::move(lazy_parse_);
+  lazy_parse_ = nullptr;
+  parse(*const_cast<Function*>(this));
+  parse_pending_.store(false, std::memory_order_release);
+}
+
 bool Function::run(Stack& stack) const {
   const auto& schema = getSchema();
   if (schema) { // if we have a schema then resolve optional args if any
@@ -127,6 +157,7 @@ c10::IValue Function::operator()(Stack& stack) const {
 }
 
 const std::shared_ptr<Code> Function::get_code() const {
+  materialize();
   return code_;
 }
 
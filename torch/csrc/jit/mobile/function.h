@@ -2,6 +2,9 @@
 
 #include <ATen/core/function_schema.h>
 #include <ATen/core/ivalue.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <vector>
 
 namespace torch {
@@ -37,11 +40,25 @@ class Function {
   void setSchema(c10::FunctionSchema schema);
   const at::optional<c10::FunctionSchema>& getSchema() const;
 
+  // Defer construction of the function body (see
+  // MobileModuleLoadOptions::LAZY_METHOD_PARSING in import.h). `parse` is
+  // invoked at most once, on the first run of the function or the first
+  // access to its code, schema or debug info.
+  void set_lazy_parse(std::function<void(Function&)> parse);
+
  private:
+  // Runs the pending lazy parse, if there is one.
+  void materialize() const;
+
   c10::QualifiedName name_;
   std::shared_ptr<Code> code_;
   at::optional<c10::FunctionSchema> schema_; // (byte-code version 4+)
   std::vector<std::string> pc_to_module_debug_info_;
+  // Set if the function body has not been parsed yet; consumed by
+  // materialize().
+  mutable std::function<void(Function&)> lazy_parse_;
+  mutable std::atomic<bool> parse_pending_{false};
+  mutable std::mutex parse_mutex_;
 };
 
 } // namespace mobile
@@ -110,6 +110,208 @@ void print_unsupported_ops_and_throw(
       error_message);
 }
 
+TypePtr resolveTypeNameMobile(
+    const c10::QualifiedName& qn,
+    const std::shared_ptr<CompilationUnit>& compilation_unit) {
+  // HACK: first we check whether the name starts with special prefix to
+  // tell if it's a supported pytorch class type. There are two special
+  // prefixes. "__torch__" for nn module, and "torch.jit" from to_backend.
+  // This is a reliable
+  // check today, but there is no guarantee that this is the case. The
+  // real solution is to merge type parsers so we can share class
+  // resolution logic.
+  static const c10::QualifiedName torchPrefix = "__torch__";
+  static const c10::QualifiedName jitPrefix = "torch.jit";
+  if (torchPrefix.isPrefixOf(qn) || jitPrefix.isPrefixOf(qn)) {
+    if (compilation_unit->get_class(qn) == nullptr) {
+      auto typeptr = ClassType::create(qn, compilation_unit, true);
+      compilation_unit->register_type(typeptr);
+    }
+    return compilation_unit->get_class(qn);
+  } else {
+    return c10::parseType(qn.qualifiedName());
+  }
+}
+
+/**
+ * Loads operators by looking them up in the Dispatcher and returns
+ * the set of operator names (with overload) that are not supported
+ * by the current runtime.
+ */
+std::unordered_set<std::string> load_and_find_unsupported_operator_names(
+    const std::vector<IValue>& ops_list,
+    mobile::Function* function,
+    int64_t model_version) {
+  std::unordered_set<std::string> unsupported_op_names;
+  // ops_list is the list of operator names that were read in from
+  // bytecode.plk for the method that is currently being processed.
+  for (const auto& op : ops_list) {
+    auto op_item = op.toTuple()->elements();
+    TORCH_CHECK(
+        op_item.size() == 2, "There should be two parts in an operator name.");
+    auto op_found = function->append_operator(
+        op_item[0].toString()->string(),
+        op_item[1].toString()->string(),
+        model_version);
+    if (!op_found) {
+      unsupported_op_names.emplace(operator_str(
+          op_item[0].toString()->string(), op_item[1].toString()->string()));
+    }
+  }
+  return unsupported_op_names;
+}
+
+// Builds the body of `function` from one element of the bytecode table (and
+// optionally the matching element of the debug info table). With
+// MobileModuleLoadOptions::LAZY_METHOD_PARSING this runs on the first call of
+// the method rather than at load time, so it must not depend on the
+// deserializer or the archive reader staying alive.
+void parseFunction(
+    mobile::Function* function,
+    const IValue& element,
+    const c10::optional<IValue>& debug_info_element,
+    int64_t model_version,
+    uint64_t module_load_options,
+    const std::shared_ptr<CompilationUnit>& compilation_unit) {
+  const auto& m_tuple = element.toTuple()->elements();
+  const std::string& function_name = m_tuple[0].toStringRef();
+  IValue codeTable = m_tuple[1];
+  auto schemaTable = // older files do not store function schema
+      (model_version > 0x4L || (model_version == 0x4L && m_tuple.size() >= 3))
+      ? at::optional<IValue>{m_tuple[2]}
+      : at::nullopt;
+
+  const auto& ins_list =
+      expect_field(codeTable, "instructions", BYTECODE_INDEX_INSTRUCTION)
+          .toTuple()
+          ->elements();
+  const auto& ops_list =
+      expect_field(codeTable, "operators", BYTECODE_INDEX_OPERATOR)
+          .toTuple()
+          ->elements();
+  const auto& consts_list =
+      expect_field(codeTable, "constants", BYTECODE_INDEX_CONSTANT)
+          .toTuple()
+          ->elements();
+  const auto& types_list =
+      expect_field(codeTable, "types", BYTECODE_INDEX_TYPE)
+          .toTuple()
+          ->elements();
+  const auto& register_size =
+      expect_field(codeTable, "register_size", BYTECODE_INDEX_REGISTER_SIZE)
+          .toInt();
+
+  bool has_debug_info = debug_info_element.has_value();
+  std::vector<IValue> module_debug_info_list;
+  if (has_debug_info) {
+    const auto& debug_info_m_tuple = debug_info_element->toTuple()->elements();
+    const std::string& debug_info_function_name =
+        debug_info_m_tuple[0].toStringRef();
+    TORCH_CHECK(
+        debug_info_function_name == function_name,
+        "The function names in the bytecode table and the debug info table do not match.");
+    IValue debug_info_table = debug_info_m_tuple[1];
+    module_debug_info_list = expect_field(
+                                 debug_info_table,
+                                 "module_debug_info",
+                                 BYTECODE_INDEX_MODULE_DEBUG_INFO)
+                                 .toTuple()
+                                 ->elements();
+    TORCH_CHECK(
+        module_debug_info_list.size() == ops_list.size(),
+        "The numbers of operators and module info strings do not match.");
+  }
+
+  function->set_module_debug_info_list_size(ins_list.size());
+  for (size_t i = 0; i < ins_list.size(); ++i) {
+    auto ins_item = ins_list[i].toTuple()->elements();
+    TORCH_CHECK(
+        ins_item.size() == 3,
+        "There should be three parts in an instruction. The function name is ",
+        function_name);
+    OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
+    int X = ins_item[1].toInt();
+    int N = ins_item[2].toInt();
+    function->append_instruction(op_code, X, N);
+    if (op_code == OP) {
+      std::string module_debug_info = (has_debug_info)
+          ? module_debug_info_list[X].toString()->string()
+          : "";
+      function->set_module_info(module_debug_info, i);
+    }
+  }
+
+  std::unordered_set<std::string> unsupported_op_names =
+      load_and_find_unsupported_operator_names(
+          ops_list, function, model_version);
+  if ((module_load_options & MobileModuleLoadOptions::OPERATOR_CHECK) &&
+      !unsupported_op_names.empty()) {
+    print_unsupported_ops_and_throw(unsupported_op_names);
+  }
+
+  for (const auto& constant : consts_list) {
+    function->append_constant(constant);
+  }
+
+  static const c10::QualifiedName classPrefix = "__torch__.torch.classes";
+  for (const auto& t : types_list) {
+    c10::QualifiedName qn(t.toStringRef());
+    if (classPrefix.isPrefixOf(qn)) {
+      auto classType = getCustomClass(qn.qualifiedName());
+      TORCH_CHECK(
+          classType,
+          "The implementation of class ",
+          qn.qualifiedName(),
+          " cannot be found.");
+      function->append_type(classType);
+    } else {
+      function->append_type(c10::parseType(t.toStringRef()));
+    }
+  }
+
+  function->set_register_size(register_size);
+
+  // function schema
+  if (schemaTable) { // (schema is optional for back compat)
+    auto parseArgList = [&compilation_unit](
+                            const std::vector<IValue>& argTables) {
+      std::vector<c10::Argument> args;
+      for (auto&& argTable : argTables) {
+        auto name = expect_field(argTable, "name", BYTECODE_INDEX_ARGUMENT_NAME)
+                        .toStringRef();
+        const auto& type = resolveTypeNameMobile(
+            (expect_field(argTable, "type", BYTECODE_INDEX_ARGUMENT_TYPE))
+                .toStringRef(),
+            compilation_unit);
+        auto default_value = expect_field(
+                                 argTable,
+                                 "default_value",
+                                 BYTECODE_INDEX_ARGUMENT_DEFAULT_VALUE)
+                                 .toIValue();
+        auto arg = c10::Argument(name, type, c10::nullopt /*N*/, default_value);
+        args.emplace_back(std::move(arg));
+      }
+      return args;
+    };
+    const auto& arg_list =
+        expect_field(*schemaTable, "arguments", BYTECODE_INDEX_SCHEMA_ARGUMENTS)
+            .toTuple()
+            ->elements();
+    const auto& ret_list =
+        expect_field(*schemaTable, "returns", BYTECODE_INDEX_SCHEMA_RETURNS)
+            .toTuple()
+            ->elements();
+    c10::FunctionSchema schema(
+        function_name,
+        "" /*overload_name*/,
+        parseArgList(arg_list),
+        parseArgList(ret_list),
+        false /*is_varargs*/,
+        false /*is_varret*/);
+    function->setSchema(std::move(schema));
+  }
+}
+
 // The deserializer class which loads the bytecode package from bc files.
 class BytecodeDeserializer final {
  public:
@@ -137,15 +339,6 @@ class BytecodeDeserializer final {
       std::shared_ptr<mobile::CompilationUnit> mcu);
   std::unordered_map<std::string, std::string> readMobileMetadata(
       std::shared_ptr<mobile::CompilationUnit> mcu);
-  /**
-   * Loads operators by looking them up in the Dispatcher and returns
-   * the set of operator names (with overload) that are not supported
-   * by the current runtime.
-   */
-  std::unordered_set<std::string> load_and_find_unsupported_operator_names(
-      const std::vector<IValue>& ops_list,
-      mobile::Function* function,
-      int64_t model_version) const;
   std::shared_ptr<CompilationUnit> compilation_unit_;
   std::unordered_set<std::string> imported_libs_;
   std::unique_ptr<PyTorchStreamReader> reader_{};
@@ -160,49 +353,8 @@ BytecodeDeserializer::BytecodeDeserializer(
       reader_(std::move(reader)),
       module_load_options_(module_load_options) {}
 
-std::unordered_set<std::string> BytecodeDeserializer::
-    load_and_find_unsupported_operator_names(
-        const std::vector<IValue>& ops_list,
-        mobile::Function* function,
-        int64_t model_version) const {
-  std::unordered_set<std::string> unsupported_op_names;
-  // ops_list is the list of operator names that were read in from
-  // bytecode.plk for the method that is currently being processed.
-  for (const auto& op : ops_list) {
-    auto op_item = op.toTuple()->elements();
-    TORCH_CHECK(
-        op_item.size() == 2, "There should be two parts in an operator name.");
-    auto op_found = function->append_operator(
-        op_item[0].toString()->string(),
-        op_item[1].toString()->string(),
-        model_version);
-    if (!op_found) {
-      unsupported_op_names.emplace(operator_str(
-          op_item[0].toString()->string(), op_item[1].toString()->string()));
-    }
-  }
-  return unsupported_op_names;
-}
-
 TypePtr BytecodeDeserializer::resolveTypeName(const c10::QualifiedName& qn) {
-  // HACK: first we check whether the name starts with special prefix to
-  // tell if it's a supported pytorch class type. There are two special
-  // prefixes. "__torch__" for nn module, and "torch.jit" from to_backend.
-  // This is a reliable
-  // check today, but there is no guarantee that this is the case. The
-  // real solution is to merge type parsers so we can share class
-  // resolution logic.
-  static const c10::QualifiedName torchPrefix = "__torch__";
-  static const c10::QualifiedName jitPrefix = "torch.jit";
-  if (torchPrefix.isPrefixOf(qn) || jitPrefix.isPrefixOf(qn)) {
-    if (compilation_unit_->get_class(qn) == nullptr) {
-      auto typeptr = ClassType::create(qn, compilation_unit_, true);
-      compilation_unit_->register_type(typeptr);
-    }
-    return compilation_unit_->get_class(qn);
-  } else {
-    return c10::parseType(qn.qualifiedName());
-  }
+  return resolveTypeNameMobile(qn, compilation_unit_);
 }
 
 void BytecodeDeserializer::parseMethods(
@@ -242,147 +394,45 @@ void BytecodeDeserializer::parseMethods(
   // Process all methods in this mobile module.
   for (size_t i = method_i_start; i < vals.size(); ++i) {
     const auto& element = vals[i];
-    const auto& m_tuple = element.toTuple()->elements();
-    const std::string& function_name = m_tuple[0].toStringRef();
-    IValue codeTable = m_tuple[1];
-    auto schemaTable = // older files do not store function schema
-        (model_version > 0x4L || (model_version == 0x4L && m_tuple.size() >= 3))
-        ? at::optional<IValue>{m_tuple[2]}
-        : at::nullopt;
+    const std::string& function_name =
+        element.toTuple()->elements()[0].toStringRef();
 
     // NOLINTNEXTLINE(modernize-make-unique)
     auto function = std::unique_ptr<mobile::Function>(
         new mobile::Function(c10::QualifiedName(function_name)));
 
-    const auto& ins_list =
-        expect_field(codeTable, "instructions", BYTECODE_INDEX_INSTRUCTION)
-            .toTuple()
-            ->elements();
-    const auto& ops_list =
-        expect_field(codeTable, "operators", BYTECODE_INDEX_OPERATOR)
-            .toTuple()
-            ->elements();
-    const auto& consts_list =
-        expect_field(codeTable, "constants", BYTECODE_INDEX_CONSTANT)
-            .toTuple()
-            ->elements();
-    const auto& types_list =
-        expect_field(codeTable, "types", BYTECODE_INDEX_TYPE)
-            .toTuple()
-            ->elements();
-    const auto& register_size =
-        expect_field(codeTable, "register_size", BYTECODE_INDEX_REGISTER_SIZE)
-            .toInt();
-
-    std::vector<IValue> module_debug_info_list;
+    c10::optional<IValue> debug_info_element;
     if (has_debug_info) {
-      const auto& debug_info_element = (*debug_info_vals)[i];
-      const auto& debug_info_m_tuple = debug_info_element.toTuple()->elements();
-      const std::string& debug_info_function_name =
-          debug_info_m_tuple[0].toStringRef();
-      TORCH_CHECK(
-          debug_info_function_name == function_name,
-          "The function names in the bytecode table and the debug info table do not match.");
-      IValue debug_info_table = debug_info_m_tuple[1];
-      module_debug_info_list = expect_field(
-                                   debug_info_table,
-                                   "module_debug_info",
-                                   BYTECODE_INDEX_MODULE_DEBUG_INFO)
-                                   .toTuple()
-                                   ->elements();
-      TORCH_CHECK(
-          module_debug_info_list.size() == ops_list.size(),
-          "The numbers of operators and module info strings do not match.");
-    }
-
-    function->set_module_debug_info_list_size(ins_list.size());
-    for (size_t i = 0; i < ins_list.size(); ++i) {
-      auto ins_item = ins_list[i].toTuple()->elements();
-      TORCH_CHECK(
-          ins_item.size() == 3,
-          "There should be three parts in an instruction. The function name is ",
-          function_name);
-      OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
-      int X = ins_item[1].toInt();
-      int N = ins_item[2].toInt();
-      function->append_instruction(op_code, X, N);
-      if (op_code == OP) {
-        std::string module_debug_info = (has_debug_info)
-            ? module_debug_info_list[X].toString()->string()
-            : "";
-        function->set_module_info(module_debug_info, i);
-      }
-    }
-
-    std::unordered_set<std::string> unsupported_op_names =
-        load_and_find_unsupported_operator_names(
-            ops_list, function.get(), model_version);
-    if ((module_load_options_ & MobileModuleLoadOptions::OPERATOR_CHECK) &&
-        !unsupported_op_names.empty()) {
-      print_unsupported_ops_and_throw(unsupported_op_names);
+      debug_info_element = (*debug_info_vals)[i];
     }
 
-    for (const auto& constant : consts_list) {
-      function->append_constant(constant);
-    }
-
-    static const c10::QualifiedName classPrefix = "__torch__.torch.classes";
-    for (const auto& t : types_list) {
-      c10::QualifiedName qn(t.toStringRef());
-      if (classPrefix.isPrefixOf(qn)) {
-        auto classType = getCustomClass(qn.qualifiedName());
-        TORCH_CHECK(
-            classType,
-            "The implementation of class ",
-            qn.qualifiedName(),
-            " cannot be found.");
-        function->append_type(classType);
-      } else {
-        function->append_type(c10::parseType(t.toStringRef()));
-      }
-    }
-
-    function->set_register_size(register_size);
-
-    // function schema
-    if (schemaTable) { // (schema is optional for back compat)
-      auto parseArgList = [this](const std::vector<IValue>& argTables) {
-        std::vector<c10::Argument> args;
-        for (auto&& argTable : argTables) {
-          auto name =
-              expect_field(argTable, "name", BYTECODE_INDEX_ARGUMENT_NAME)
-                  .toStringRef();
-          const auto& type = resolveTypeName(
-              (expect_field(argTable, "type", BYTECODE_INDEX_ARGUMENT_TYPE))
-                  .toStringRef());
-          auto default_value = expect_field(
-                                   argTable,
-                                   "default_value",
-                                   BYTECODE_INDEX_ARGUMENT_DEFAULT_VALUE)
-                                   .toIValue();
-          auto arg =
-              c10::Argument(name, type, c10::nullopt /*N*/, default_value);
-          args.emplace_back(std::move(arg));
-        }
-        return args;
-      };
-      const auto& arg_list =
-          expect_field(
-              *schemaTable, "arguments", BYTECODE_INDEX_SCHEMA_ARGUMENTS)
-              .toTuple()
-              ->elements();
-      const auto& ret_list =
-          expect_field(*schemaTable, "returns", BYTECODE_INDEX_SCHEMA_RETURNS)
-              .toTuple()
-              ->elements();
-      c10::FunctionSchema schema(
-          function_name,
-          "" /*overload_name*/,
-          parseArgList(arg_list),
-          parseArgList(ret_list),
-          false /*is_varargs*/,
-          false /*is_varret*/);
-      function->setSchema(std::move(schema));
+    if (module_load_options_ & MobileModuleLoadOptions::LAZY_METHOD_PARSING) {
+      // Everything the parser needs is captured by value: the (already
+      // unpickled) bytecode element keeps the method table alive, and the
+      // compilation unit is shared. The deserializer and the archive reader
+      // do not stay alive until first call.
+      function->set_lazy_parse(
+          [element,
+           debug_info_element,
+           model_version,
+           module_load_options = module_load_options_,
+           compilation_unit = compilation_unit_](mobile::Function& fn) {
+            parseFunction(
+                &fn,
+                element,
+                debug_info_element,
+                model_version,
+                module_load_options,
+                compilation_unit);
+          });
+    } else {
+      parseFunction(
+          function.get(),
+          element,
+          debug_info_element,
+          model_version,
+          module_load_options_,
+          compilation_unit_);
     }
 
     mcu.register_function(std::move(function));
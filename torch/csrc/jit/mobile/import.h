@@ -15,6 +15,11 @@ using ExtraFilesMap = std::unordered_map<std::string, std::string>;
 
 enum MobileModuleLoadOptions {
   OPERATOR_CHECK = 1,
+  // Defer parsing of each method's bytecode (instruction decoding, operator
+  // resolution, constants, types and schema) until the method is first run.
+  // Errors such as unsupported operators are then reported on first call
+  // instead of at load time.
+  LAZY_METHOD_PARSING = 2,
 };
 
 const uint64_t _default_mobile_module_load_options =
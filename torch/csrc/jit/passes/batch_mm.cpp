@@ -365,31 +365,101 @@ RegisterOperators mm_batch_side_reg({Operator(
     },
     aliasAnalysisIsSpecialCase())});
 
-std::pair<std::vector<Node*>, std::vector<Node*>> gatherIndependentMMUses(
-    Value* value,
+// Like prim::MMBatchSide, but for families of addmm ops sharing one matrix
+// operand (typically a weight). The shared operand is concatenated with the
+// varying ones into a single wide GEMM and the per-member bias additions are
+// applied to the chunks of the result. The rewrite only forms families whose
+// members all use the default alpha/beta of 1, so the runtime doesn't need to
+// deal with scaling.
+// Inputs: side_input, other_side_inputs..., biases...
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+RegisterOperators addmm_batch_side_reg({Operator(
+    Symbol::prim("AddMMBatchSide"),
+    [](const Node* node) -> Operation {
+      size_t num_members = (node->inputs().size() - 1) / 2;
+      Side single_side = static_cast<Side>(node->i(Symbol::attr("side")));
+      return [num_members, single_side](Stack* stack) {
+        at::Tensor side_input;
+        std::vector<at::Tensor> other_side_inputs;
+        other_side_inputs.reserve(num_members);
+        std::vector<at::Tensor> biases;
+        biases.reserve(num_members);
+        for (auto it = stack->end() - num_members; it != stack->end(); ++it) {
+          biases.push_back(std::move(*it).toTensor());
+        }
+        drop(stack, num_members);
+        for (auto it = stack->end() - num_members; it != stack->end(); ++it) {
+          other_side_inputs.push_back(std::move(*it).toTensor());
+        }
+        drop(stack, num_members);
+        pop(stack, side_input);
+
+        if (have_same_shape(other_side_inputs) &&
+            shape_is_fast_for_side(other_side_inputs[0])) {
+          auto other_side_input =
+              at::cat(other_side_inputs, single_side == Side::LHS ? 1 : 0);
+          auto mm_out = single_side == Side::LHS
+              ? side_input.mm(other_side_input)
+              : other_side_input.mm(side_input);
+          auto outputs = at::chunk(
+              mm_out,
+              num_members,
+              /*dim=*/single_side == Side::LHS ? 1 : 0);
+          for (size_t i = 0; i < num_members; ++i) {
+            stack->emplace_back(outputs[i].add(biases[i]));
+          }
+        } else {
+          for (size_t i = 0; i < num_members; ++i) {
+            stack->emplace_back(
+                single_side == Side::LHS
+                    ? at::addmm(biases[i], side_input, other_side_inputs[i])
+                    : at::addmm(biases[i], other_side_inputs[i], side_input));
+          }
+        }
+      };
+    },
+    aliasAnalysisIsSpecialCase())});
+
+static constexpr auto addmm_schema =
+    "aten::addmm(Tensor self, Tensor mat1, Tensor mat2, *, Scalar beta, Scalar alpha) -> Tensor";
+
+bool hasUnitAlphaBeta(Node* addmm) {
+  auto beta = addmm->get<at::Scalar>(attr::beta);
+  auto alpha = addmm->get<at::Scalar>(attr::alpha);
+  return beta && alpha && beta->toComplexDouble() == 1.0 &&
+      alpha->toComplexDouble() == 1.0;
+}
+
+// Filter out dependent MMs. This algorithm might do very badly if e.g. you
+// have a lot of independent MMs, that depend on the first one, but I doubt
+// this will be a common scenario.
+std::vector<Node*> filterIndependentMMs(
+    std::vector<Node*> mms,
     AliasDb& alias_db) {
-  const auto postprocess = [&](std::vector<Node*> mms) {
-    if (mms.size() == 0) {
-      return mms;
-    }
-    std::sort(mms.begin(), mms.end(), [](Node* n, Node* m) {
-      return n->isBefore(m);
-    });
-    // Filter out dependent MMs. This algorithm might do very badly if e.g. you
-    // have a lot of independent MMs, that depend on the first one, but I doubt
-    // this will be a common scenario.
-    for (size_t i = 0; i < mms.size(); ++i) {
-      if (mms[i] == nullptr)
+  if (mms.size() == 0) {
+    return mms;
+  }
+  std::sort(
+      mms.begin(), mms.end(), [](Node* n, Node* m) { return n->isBefore(m); });
+  for (size_t i = 0; i < mms.size(); ++i) {
+    if (mms[i] == nullptr)
+      continue;
+    for (size_t j = i + 1; j < mms.size(); ++j) {
+      if (mms[j] == nullptr)
         continue;
-      for (size_t j = i + 1; j < mms.size(); ++j) {
-        if (mms[j] == nullptr)
-          continue;
-        if (!alias_db.couldMoveBeforeTopologically(mms[j], mms[i])) {
-          mms[j] = nullptr;
-        }
+      if (!alias_db.couldMoveBeforeTopologically(mms[j], mms[i])) {
+        mms[j] = nullptr;
       }
     }
-    return c10::filter(mms, [](Node* n) { return n != nullptr; });
+  }
+  return c10::filter(mms, [](Node* n) { return n != nullptr; });
+}
+
+std::pair<std::vector<Node*>, std::vector<Node*>> gatherIndependentMMUses(
+    Value* value,
+    AliasDb& alias_db) {
+  const auto postprocess = [&](std::vector<Node*> mms) {
+    return filterIndependentMMs(std::move(mms), alias_db);
   };
 
   Block* block = value->node()->owningBlock();
@@ -408,6 +478,30 @@ std::pair<std::vector<Node*>, std::vector<Node*>> gatherIndependentMMUses(
   return std::make_pair(postprocess(lhses), postprocess(rhses));
 }
 
+// Same as gatherIndependentMMUses, but for addmm families, where value is
+// used as mat1 (lhs) or mat2 (rhs). Transformer-style graphs are full of
+// addmms sharing a weight as mat2, which plain MM batching never sees.
+std::pair<std::vector<Node*>, std::vector<Node*>> gatherIndependentAddMMUses(
+    Value* value,
+    AliasDb& alias_db) {
+  Block* block = value->node()->owningBlock();
+  std::vector<Node*> lhses; // Will contain nodes where value is used as mat1
+  std::vector<Node*> rhses; // Like above, but mat2
+  for (Use u : value->uses()) {
+    if (u.user->owningBlock() == block && u.user->matches(addmm_schema) &&
+        hasUnitAlphaBeta(u.user)) {
+      if (u.offset == 1 && u.user->inputs()[2] != value) {
+        lhses.push_back(u.user);
+      } else if (u.offset == 2 && u.user->inputs()[1] != value) {
+        rhses.push_back(u.user);
+      }
+    }
+  }
+  return std::make_pair(
+      filterIndependentMMs(std::move(lhses), alias_db),
+      filterIndependentMMs(std::move(rhses), alias_db));
+}
+
 void BatchMMSide(Block* block, AliasDb& alias_db) {
   // NB: 8 is the current loop unrolling factor
   static constexpr size_t how_many_is_many = 8;
@@ -433,6 +527,34 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
     }
   };
 
+  const auto batch_addmm_side = [&](std::vector<Node*>& addmms, Side side) {
+    AT_ASSERT(!addmms.empty());
+    for (int64_t i = static_cast<int64_t>(addmms.size()) - 2; i >= 0; --i) {
+      bool move_ok =
+          alias_db.moveBeforeTopologicallyValid(addmms[i], addmms[i + 1]);
+      AT_ASSERT(move_ok);
+    }
+    WithInsertPoint insert_guard{addmms[0]};
+    Graph* graph = addmms[0]->owningGraph();
+    Node* batch_addmm = graph->create(
+        Symbol::prim("AddMMBatchSide"),
+        /*inputs=*/{},
+        /*num_outputs=*/addmms.size());
+    graph->insertNode(batch_addmm);
+    batch_addmm->i_(Symbol::attr("side"), static_cast<int>(side));
+    Value* const_side = addmms[0]->inputs().at(side == Side::LHS ? 1 : 2);
+    batch_addmm->addInput(const_side);
+    for (Node* addmm : addmms) {
+      batch_addmm->addInput(addmm->inputs().at(side == Side::LHS ? 2 : 1));
+    }
+    for (Node* addmm : addmms) {
+      batch_addmm->addInput(addmm->inputs().at(0));
+    }
+    for (size_t i = 0; i < addmms.size(); ++i) {
+      addmms[i]->output()->replaceAllUsesWith(batch_addmm->outputs().at(i));
+    }
+  };
+
   std::unordered_set<Value*> considered_values;
   for (Node* node : block->nodes()) {
     if (node->matches("aten::mm(Tensor self, Tensor mat2) -> Tensor")) {
@@ -448,6 +570,21 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
           batch_side(uses_with_many.second, Side::RHS);
         }
       }
+    } else if (node->matches(addmm_schema)) {
+      // Only the matrix operands can be shared sides; the bias is always a
+      // per-member input.
+      for (Value* input : {node->inputs()[1], node->inputs()[2]}) {
+        if (/*bool not_inserted = */ !considered_values.emplace(input).second) {
+          continue;
+        }
+        auto uses_with_many = gatherIndependentAddMMUses(input, alias_db);
+        if (uses_with_many.first.size() >= how_many_is_many) {
+          batch_addmm_side(uses_with_many.first, Side::LHS);
+        }
+        if (uses_with_many.second.size() >= how_many_is_many) {
+          batch_addmm_side(uses_with_many.second, Side::RHS);
+        }
+      }
     } else {
       for (Block* subblock : node->blocks()) {
         BatchMMSide(subblock, alias_db);
@@ -4,6 +4,7 @@
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/ir/node_hashing.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 
 #include <unordered_map>
 
@@ -114,6 +115,7 @@ struct CommonSubexpressionEliminator {
 } // namespace
 
 bool EliminateCommonSubexpression(const std::shared_ptr<Graph>& graph) {
+  JIT_PASS_STATS_SCOPE(*graph);
   GRAPH_DUMP("Before CSE", graph);
   CommonSubexpressionEliminator cse(graph);
   return cse.run([](Node*) { return nullptr; });
@@ -9,6 +9,7 @@
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/ir/node_hashing.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/runtime/operator.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
@@ -399,6 +400,7 @@ struct ConstantPropagator {
 bool ConstantPropagation(
     std::shared_ptr<Graph>& graph,
     bool ignore_custom_classes) {
+  JIT_PASS_STATS_SCOPE(*graph);
   ConstantPropagator cp =
       ConstantPropagator::WithAliasDb(graph, ignore_custom_classes);
   bool made_change = cp.run();
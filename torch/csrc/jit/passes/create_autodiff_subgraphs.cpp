@@ -4,6 +4,7 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/passes/canonicalize.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
 #include <torch/csrc/jit/passes/utils/subgraph_utils.h>
@@ -270,6 +271,7 @@ class SubgraphSlicer {
 std::vector<Node*> CreateAutodiffSubgraphs(
     const std::shared_ptr<Graph>& graph,
     size_t threshold) {
+  JIT_PASS_STATS_SCOPE(*graph);
   std::vector<Node*> diff_nodes;
   AliasDb db(graph);
   GRAPH_DEBUG("Before creating autodiff subgraphs", *graph);
@@ -3,6 +3,7 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/ir_views.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/utils/memory.h>
 
 #include <unordered_map>
@@ -416,6 +417,7 @@ class DeadCodeEliminator {
 void EliminateDeadCode(
     const std::shared_ptr<Graph>& graph,
     DCESideEffectPolicy sideEffectPolicy) {
+  JIT_PASS_STATS_SCOPE(*graph);
   DeadCodeEliminator(graph, sideEffectPolicy)
       .run(graph->block(), /*recurse=*/true);
   GRAPH_DUMP("After EliminateDeadCode: ", graph);
@@ -0,0 +1,190 @@
+#include <torch/csrc/jit/passes/frozen_attention_fusion.h>
+
+#include <ATen/ATen.h>
+
+#include <torch/csrc/jit/frontend/code_template.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/graph_rewrite_helper.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+using graph_rewrite_helper::getIValue;
+using graph_rewrite_helper::PatternInfo;
+
+// Processing the queries in blocks keeps the live score slab at
+// kQueryBlockSize x S_k instead of S_q x S_k. The block is large enough that
+// the matmuls stay efficient on both CPU and CUDA.
+constexpr int64_t kQueryBlockSize = 512;
+
+at::Tensor scaledDotProductAttention(
+    const at::Tensor& query,
+    const at::Tensor& key,
+    const at::Tensor& value,
+    const c10::optional<at::Tensor>& attn_mask,
+    double scale) {
+  auto key_t = key.transpose(-2, -1);
+  int64_t query_len = query.size(-2);
+  std::vector<at::Tensor> outputs;
+  outputs.reserve((query_len + kQueryBlockSize - 1) / kQueryBlockSize);
+  for (int64_t start = 0; start < query_len; start += kQueryBlockSize) {
+    int64_t len = std::min(kQueryBlockSize, query_len - start);
+    auto q_block = query_len <= kQueryBlockSize
+        ? query
+        : query.narrow(-2, start, len);
+    auto scores = at::matmul(q_block, key_t).mul_(scale);
+    if (attn_mask.has_value()) {
+      const auto& mask = *attn_mask;
+      // Masks broadcasting over the query dimension are applied whole.
+      if (mask.dim() >= 2 && mask.size(-2) == query_len) {
+        scores.add_(mask.narrow(-2, start, len));
+      } else {
+        scores.add_(mask);
+      }
+    }
+    auto probs = at::softmax(scores, -1);
+    outputs.push_back(at::matmul(probs, value));
+  }
+  if (outputs.size() == 1) {
+    return outputs[0];
+  }
+  return at::cat(outputs, -2);
+}
+
+const RegisterOperators ScaledDotProductAttentionOpReg({
+    torch::jit::Operator(
+        "prim::ScaledDotProductAttention(Tensor query, Tensor key, Tensor value, Tensor? attn_mask, float scale) -> Tensor",
+        [](Stack* stack) {
+          double scale = pop(stack).toDouble();
+          auto attn_mask = pop(stack).toOptional<at::Tensor>();
+          auto value = pop(stack).toTensor();
+          auto key = pop(stack).toTensor();
+          auto query = pop(stack).toTensor();
+          push(
+              stack,
+              scaledDotProductAttention(query, key, value, attn_mask, scale));
+        },
+        AliasAnalysisKind::FROM_SCHEMA),
+});
+
+bool isConstantInt(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap,
+    const std::string& name,
+    int64_t expected) {
+  auto value = getIValue(name, match.values_map, vmap);
+  return value && value->isInt() && value->toInt() == expected;
+}
+
+// Checks the parts of a match that the pattern text cannot express: the
+// transpose must swap the last two dimensions, softmax must run over the
+// last dimension without a dtype cast, the scale must have folded to a
+// constant number, and an add's alpha must be one.
+bool attentionMatchOk(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  bool transpose_ok =
+      (isConstantInt(match, vmap, "td0", -2) &&
+       isConstantInt(match, vmap, "td1", -1)) ||
+      (isConstantInt(match, vmap, "td0", -1) &&
+       isConstantInt(match, vmap, "td1", -2));
+  if (!transpose_ok || !isConstantInt(match, vmap, "sdim", -1)) {
+    return false;
+  }
+  auto dtype = getIValue("dtype", match.values_map, vmap);
+  if (!dtype || !dtype->isNone()) {
+    return false;
+  }
+  auto scale = getIValue("scale", match.values_map, vmap);
+  if (!scale || !(scale->isDouble() || scale->isInt()) ||
+      scale->toScalar().toDouble() == 0.) {
+    return false;
+  }
+  if (vmap.count("alpha") != 0) {
+    auto alpha = getIValue("alpha", match.values_map, vmap);
+    if (!alpha || !alpha->isScalar() || alpha->toScalar().toDouble() != 1.) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void fuseAttentionPattern(
+    std::shared_ptr<Graph>& graph,
+    const PatternInfo& pattern,
+    bool has_mask,
+    bool scale_is_divisor) {
+  const Graph& pattern_graph = *pattern.pattern_graph;
+  const auto& vmap = pattern.vmap;
+  for (const Match& match : findPatternMatches(pattern_graph, *graph)) {
+    if (!attentionMatchOk(match, vmap)) {
+      continue;
+    }
+    Value* query = match.values_map.at(vmap.at("q"));
+    Value* key = match.values_map.at(vmap.at("k"));
+    Value* value = match.values_map.at(vmap.at("v"));
+    Value* out = match.values_map.at(vmap.at("out"));
+    double scale =
+        getIValue("scale", match.values_map, vmap)->toScalar().toDouble();
+    if (scale_is_divisor) {
+      scale = 1. / scale;
+    }
+
+    Node* out_node = out->node();
+    WithInsertPoint guard(out_node);
+    Value* mask = has_mask ? match.values_map.at(vmap.at("mask"))
+                           : graph->insertConstant(IValue());
+    Node* fused = graph->create(
+        Symbol::fromQualString("prim::ScaledDotProductAttention"),
+        {query, key, value, mask, graph->insertConstant(scale)},
+        1);
+    graph->insertNode(fused);
+    fused->output()->setType(out->type());
+    out->replaceAllUsesWith(fused->output());
+  }
+}
+
+} // namespace
+
+void FuseFrozenScaledDotProductAttention(std::shared_ptr<Graph>& graph) {
+  auto masked_rstring = CodeTemplate(R"(
+    graph(%q, %k, %v, %mask, %scale, %td0, %td1, %alpha, %sdim, %dtype):
+      %kt = aten::transpose(%k, %td0, %td1)
+      %qk = aten::matmul(%q, %kt)
+      %scaled = aten::${scale_op}(%qk, %scale)
+      %masked = aten::add(%scaled, %mask, %alpha)
+      %probs = aten::softmax(%masked, %sdim, %dtype)
+      %out = aten::matmul(%probs, %v)
+      return (%out))");
+  auto unmasked_rstring = CodeTemplate(R"(
+    graph(%q, %k, %v, %scale, %td0, %td1, %sdim, %dtype):
+      %kt = aten::transpose(%k, %td0, %td1)
+      %qk = aten::matmul(%q, %kt)
+      %scaled = aten::${scale_op}(%qk, %scale)
+      %probs = aten::softmax(%scaled, %sdim, %dtype)
+      %out = aten::matmul(%probs, %v)
+      return (%out))");
+
+  for (bool scale_is_divisor : {true, false}) {
+    TemplateEnv env;
+    env.s("scale_op", scale_is_divisor ? "div" : "mul");
+    // The masked pattern must run first: it strictly contains the unmasked
+    // one, and replacing the inner match would break the outer one.
+    PatternInfo masked =
+        PatternInfo::parse_from_str(masked_rstring.format(env));
+    fuseAttentionPattern(graph, masked, /*has_mask=*/true, scale_is_divisor);
+    PatternInfo unmasked =
+        PatternInfo::parse_from_str(unmasked_rstring.format(env));
+    fuseAttentionPattern(
+        graph, unmasked, /*has_mask=*/false, scale_is_divisor);
+  }
+  EliminateDeadCode(graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Fuses the scaled-dot-product attention pattern
+//   softmax(matmul(Q, K^T) / sqrt(d) [+ mask]) @ V
+// (also matched with a multiplicative scale) into a single
+// prim::ScaledDotProductAttention op whose implementation processes the
+// queries in blocks, so the full S_q x S_k score matrix is never
+// materialized. Run on frozen inference graphs, where the scale has been
+// constant-folded; the divisive form is rewritten as a multiplication by the
+// reciprocal, so this belongs with the other numerics-changing frozen
+// optimizations.
+TORCH_API void FuseFrozenScaledDotProductAttention(
+    std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,85 @@
+#include <torch/csrc/jit/passes/frozen_batch_norm_relu_fusion.h>
+
+#include <ATen/ATen.h>
+#include <ATen/native/batch_norm.h>
+
+#include <torch/csrc/jit/frontend/code_template.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/graph_rewrite_helper.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+using graph_rewrite_helper::getIValue;
+
+const RegisterOperators BatchNormReluOpReg({
+    torch::jit::Operator(
+        "prim::BatchNormRelu(Tensor input, Tensor? weight, Tensor? bias, Tensor? running_mean, Tensor? running_var, float eps) -> Tensor",
+        [](Stack* stack) {
+          double eps = pop(stack).toDouble();
+          auto running_var = pop(stack).toOptional<at::Tensor>();
+          auto running_mean = pop(stack).toOptional<at::Tensor>();
+          auto bias = pop(stack).toOptional<at::Tensor>();
+          auto weight = pop(stack).toOptional<at::Tensor>();
+          auto input = pop(stack).toTensor();
+          push(
+              stack,
+              at::native::batch_norm_relu_inference(
+                  input, weight, bias, running_mean, running_var, eps));
+        },
+        AliasAnalysisKind::FROM_SCHEMA),
+});
+
+bool batchNormReluMatchOk(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  // Only inference-mode batch_norm may be fused; a training node needs the
+  // batch statistics and running-stat updates.
+  auto training = getIValue("training", match.values_map, vmap);
+  if (!training || !training->isBool() || training->toBool()) {
+    return false;
+  }
+  // The fused kernel is CPU only; leave CUDA graphs to cudnn.
+  auto running_mean = getIValue("running_mean", match.values_map, vmap);
+  if (!running_mean || !running_mean->isTensor() ||
+      !running_mean->toTensor().device().is_cpu()) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+void FuseFrozenBatchNormRelu(std::shared_ptr<Graph>& graph) {
+  SubgraphRewriter rewriter;
+
+  std::array<std::string, 2> relu_operators = {"relu", "relu_"};
+
+  auto bn_relu_rstring = CodeTemplate(R"(
+    graph(%input, %weight, %bias, %running_mean, %running_var, %training, %momentum, %eps, %cudnn):
+      %bn = aten::batch_norm(%input, %weight, %bias, %running_mean, %running_var, %training, %momentum, %eps, %cudnn)
+      %res = aten::${relu}(%bn)
+      return (%res))");
+
+  std::string bn_relu_fused = R"(
+    graph(%input, %weight, %bias, %running_mean, %running_var, %training, %momentum, %eps, %cudnn):
+      %res = prim::BatchNormRelu(%input, %weight, %bias, %running_mean, %running_var, %eps)
+      return (%res))";
+
+  for (const auto& relu : relu_operators) {
+    TemplateEnv env;
+    env.s("relu", relu);
+    rewriter.RegisterRewritePattern(
+        bn_relu_rstring.format(env), bn_relu_fused);
+  }
+
+  rewriter.runOnGraph(graph, batchNormReluMatchOk);
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Fuses inference-mode (aten::batch_norm -> aten::relu) pairs left over
+// after conv folding into a single prim::BatchNormRelu op backed by a
+// fused CPU kernel, so the activation does not re-read and re-write the
+// normalized tensor.
+TORCH_API void FuseFrozenBatchNormRelu(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
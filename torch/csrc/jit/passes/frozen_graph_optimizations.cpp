@@ -1,7 +1,10 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/ir_views.h>
+#include <torch/csrc/jit/passes/frozen_attention_fusion.h>
+#include <torch/csrc/jit/passes/frozen_batch_norm_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_conv_folding.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
+#include <torch/csrc/jit/passes/frozen_residual_layer_norm_fusion.h>
 #include <torch/csrc/jit/passes/remove_dropout.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/utils/memory.h>
@@ -20,6 +23,13 @@ void OptimizeFrozenGraph(
       FoldFrozenConvAddOrSub(graph);
       FoldFrozenConvMulOrDiv(graph);
     }
+    FuseFrozenScaledDotProductAttention(graph);
+    // BN blocks whose conv was not foldable (or with no conv at all) still
+    // benefit from running the following relu in-register.
+    FuseFrozenBatchNormRelu(graph);
+    // dropout is already gone from the frozen graph, so the transformer
+    // residual tail shows up as add + layer_norm.
+    FuseFrozenResidualLayerNorm(graph);
   }
 }
 
@@ -562,11 +562,28 @@ void moveConvWeightsToMKLDNN(Node* conv) {
   }
 }
 
+// Reorder the weight into the blocked layout inner_product expects, so
+// oneDNN doesn't have to repack it on every call. This covers plain linear
+// layers as well as the projection weights of frozen attention/RNN modules,
+// which all lower to aten::linear.
+void moveLinearWeightsToMKLDNN(Node* linear) {
+  auto linear_w_mkldnn =
+      constant_as<Tensor>(linear->namedInput("weight")).value().to_mkldnn();
+  linear_w_mkldnn = mkldnn_reorder_linear_weight(linear_w_mkldnn);
+  replaceInputWithMKLDNNTensor(linear, "weight", linear_w_mkldnn);
+
+  if (linear->namedInput("bias")->type() != NoneType::get()) {
+    replaceInputWithMKLDNNTensor(linear, "bias");
+  }
+}
+
 void moveWeightsToMKLDNN(Node* n) {
-  // conv goes through special pathway so we can call mkldnn reorder conv
-  // primitive
+  // conv and linear go through special pathways so we can call the mkldnn
+  // reorder primitives on their weights
   if (n->kind() == aten::conv2d || n->kind() == aten::conv3d) {
     moveConvWeightsToMKLDNN(n);
+  } else if (n->kind() == aten::linear) {
+    moveLinearWeightsToMKLDNN(n);
   } else {
     for (size_t i = 0; i < n->inputs().size(); ++i) {
       if (!n->input(i)->type()->cast<TensorType>() ||
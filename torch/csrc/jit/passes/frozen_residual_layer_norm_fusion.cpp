@@ -0,0 +1,52 @@
+#include <torch/csrc/jit/passes/frozen_residual_layer_norm_fusion.h>
+
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/graph_rewrite_helper.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+using graph_rewrite_helper::getIValue;
+
+bool residualLayerNormMatchOk(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  // alpha must be the default 1 for the add to be a plain residual sum
+  auto alpha = getIValue("alpha", match.values_map, vmap);
+  if (!alpha || !alpha->isInt() || alpha->toInt() != 1) {
+    return false;
+  }
+  // the intermediate sum must not escape the pattern
+  Value* sum = match.values_map.at(vmap.at("sum"));
+  return sum->uses().size() == 1;
+}
+
+} // namespace
+
+void FuseFrozenResidualLayerNorm(std::shared_ptr<Graph>& graph) {
+  SubgraphRewriter rewriter;
+
+  std::string residual_layer_norm = R"(
+    graph(%input, %residual, %alpha, %shape, %weight, %bias, %eps, %cudnn):
+      %sum = aten::add(%input, %residual, %alpha)
+      %res = aten::layer_norm(%sum, %shape, %weight, %bias, %eps, %cudnn)
+      return (%res))";
+
+  std::string residual_layer_norm_fused = R"(
+    graph(%input, %residual, %alpha, %shape, %weight, %bias, %eps, %cudnn):
+      %p : float = prim::Constant[value=0.]()
+      %train : bool = prim::Constant[value=0]()
+      %res = aten::_residual_dropout_layer_norm(%input, %residual, %shape, %weight, %bias, %p, %train, %eps)
+      return (%res))";
+
+  rewriter.RegisterRewritePattern(
+      residual_layer_norm, residual_layer_norm_fused);
+  rewriter.runOnGraph(graph, residualLayerNormMatchOk);
+}
+
+} // namespace jit
+} // namespace torch
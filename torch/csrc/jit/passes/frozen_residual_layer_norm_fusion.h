@@ -0,0 +1,17 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Fuses the frozen transformer residual tail
+//   layer_norm(add(x, residual), ...)
+// into aten::_residual_dropout_layer_norm, whose kernel performs the residual
+// add and the normalization in a single pass over the tensor instead of two.
+// Dropout has already been stripped from frozen inference graphs by
+// removeDropout, so the fused op is emitted with p=0, train=False.
+TORCH_API void FuseFrozenResidualLayerNorm(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
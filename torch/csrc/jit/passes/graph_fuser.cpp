@@ -2,6 +2,7 @@
 
 #include <c10/util/Exception.h>
 #include <torch/csrc/jit/codegen/fuser/interface.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/frontend/ir_emitter.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
@@ -1116,6 +1117,92 @@ struct GraphFuser {
     }
   }
 
+  // The fusion kernel executor launches one kernel over a single map size
+  // shared by all outputs of a group, so two groups can share a kernel only
+  // if we can prove they iterate over the same space. Require every output
+  // to have complete, identical sizes on one common device.
+  bool haveSameMapSize(Node* a, Node* b) {
+    c10::optional<std::vector<int64_t>> sizes;
+    c10::optional<at::Device> device;
+    for (Node* group : {a, b}) {
+      for (Value* output : group->outputs()) {
+        auto type = output->type()->cast<TensorType>();
+        if (!type) {
+          return false;
+        }
+        auto concrete_sizes = type->sizes().concrete_sizes();
+        auto output_device = type->device();
+        if (!concrete_sizes || !output_device) {
+          return false;
+        }
+        if (!sizes) {
+          sizes = std::move(concrete_sizes);
+          device = output_device;
+        } else if (*concrete_sizes != *sizes || *output_device != *device) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool isHorizontallyFusableGroup(Node* group) {
+    if (group->kind() != prim::FusionGroup) {
+      return false;
+    }
+    // Chunks and concats change the iteration space inside the kernel, so
+    // keep horizontal merging to purely elementwise groups.
+    for (Node* n : getSubgraph(group).nodes()) {
+      if (n->kind() == prim::ConstantChunk || n->kind() == prim::FusedConcat) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Horizontal fusion: merge fusion groups that have no data dependence on
+  // each other but map over the same iteration space, so that e.g. N
+  // independent per-feature normalization branches become one kernel launch
+  // instead of N launches over small tensors. The regular scan only fuses
+  // producers into consumers, so sibling groups survive it untouched;
+  // mergeFusionGroups itself doesn't care whether an edge connects the two
+  // groups, it only needs the producer to be movable next to the consumer.
+  void fuseIndependentGroups() {
+    std::vector<Node*> groups;
+    for (Node* node : block_->nodes()) {
+      if (isHorizontallyFusableGroup(node)) {
+        groups.push_back(node);
+      }
+    }
+    // groups is in topological order; try to merge every earlier group into
+    // each later one. Merged producers are destroyed, so null them out.
+    for (size_t j = 1; j < groups.size(); ++j) {
+      Node* consumer = groups[j];
+      for (size_t i = 0; i < j; ++i) {
+        Node* producer = groups[i];
+        if (producer == nullptr) {
+          continue;
+        }
+        if (!haveSameMapSize(consumer, producer)) {
+          continue;
+        }
+        if ((consumer->inputs().size() + consumer->outputs().size() +
+             producer->inputs().size() + producer->outputs().size()) >
+            subgraph_arg_limit_) {
+          continue;
+        }
+        // Rearrange nodes such that all uses of producer's outputs are after
+        // the consumer, just like tryFuse does; those uses get rewritten to
+        // the merged group's outputs.
+        if (!aliasDb_->moveBeforeTopologicallyValid(producer, consumer)) {
+          continue;
+        }
+        mergeFusionGroups(consumer, producer);
+        groups[i] = nullptr;
+      }
+    }
+  }
+
   void optimizeFusedGraphs() {
     for (Node* node : block_->nodes()) {
       if (node->kind() != prim::FusionGroup) {
@@ -1163,6 +1250,10 @@ struct GraphFuser {
       }
     }
 
+    // Merge independent groups that map over the same iteration space into a
+    // single kernel launch.
+    fuseIndependentGroups();
+
     fuseConcats();
 
     optimizeFusedGraphs();
@@ -1245,6 +1336,7 @@ void PeepholeOptimizeShapeExpressions(Block* block, AliasDb* db) {
 } // anonymous namespace
 
 void FuseGraph(std::shared_ptr<Graph>& graph, bool strict_fuser_check) {
+  JIT_PASS_STATS_SCOPE(*graph);
   AliasDb db(graph);
   GraphFuser(&db, graph->block(), strict_fuser_check).run();
   Lint(&db);
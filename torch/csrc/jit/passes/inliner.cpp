@@ -3,6 +3,7 @@
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/frontend/error_report.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 
 namespace torch {
 namespace jit {
@@ -53,6 +54,7 @@ void inlineCalls(Block* block) {
 }
 
 void Inline(Graph& graph) {
+  JIT_PASS_STATS_SCOPE(graph);
   GRAPH_DUMP("Before Inlining: ", &graph);
   inlineCalls(graph.block());
   GRAPH_DUMP("After Inlining: ", &graph);
@@ -0,0 +1,260 @@
+#include <torch/csrc/jit/passes/insert_fork_wait.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+
+#include <algorithm>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Rough per-node cost. Ops that dominate inference time count for much more
+// than glue ops, so a tower is only worth forking when it contains real work.
+size_t nodeCost(Node* node) {
+  switch (node->kind()) {
+    case aten::conv1d:
+    case aten::conv2d:
+    case aten::conv3d:
+    case aten::convolution:
+    case aten::_convolution:
+    case aten::matmul:
+    case aten::mm:
+    case aten::bmm:
+    case aten::baddbmm:
+    case aten::addmm:
+    case aten::linear:
+    case aten::einsum:
+    case aten::lstm:
+    case aten::gru:
+      return 100;
+    default:
+      return node->kind().is_aten() ? 1 : 0;
+  }
+}
+
+class ForkInserter {
+ public:
+  ForkInserter(std::shared_ptr<Graph> graph, size_t min_cost)
+      : graph_(std::move(graph)), alias_db_(graph_), min_cost_(min_cost) {}
+
+  bool run() {
+    findTowers();
+    bool changed = false;
+    for (const auto& candidate : candidates_) {
+      changed |= tryFork(candidate);
+    }
+    return changed;
+  }
+
+ private:
+  // A tower that converged into `join`: `nodes` is a snapshot of the
+  // dataflow-connected component, in topological order, taken just before
+  // `join` merged it with its siblings.
+  struct Candidate {
+    std::vector<Node*> nodes;
+    Node* join;
+  };
+
+  // Union-find over dataflow-connected components of the top-level block.
+  // Per-root bookkeeping lives in nodes_/cost_; union by size keeps the node
+  // lists cheap to merge while preserving topological order within each list
+  // (we always append the later-rooted group).
+  size_t find(size_t group) {
+    while (parent_[group] != group) {
+      parent_[group] = parent_[parent_[group]];
+      group = parent_[group];
+    }
+    return group;
+  }
+
+  size_t merge(size_t a, size_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+      return a;
+    }
+    // The larger-id root was created later; append its nodes so the merged
+    // list stays topologically ordered only if we merge in creation order.
+    if (a > b) {
+      std::swap(a, b);
+    }
+    parent_[b] = a;
+    nodes_[a].insert(nodes_[a].end(), nodes_[b].begin(), nodes_[b].end());
+    nodes_[b].clear();
+    cost_[a] += cost_[b];
+    return a;
+  }
+
+  void findTowers() {
+    // Scan the top-level block in order, growing one group per independent
+    // dataflow component. When a node's inputs come from several groups, it
+    // is the join point of those towers: snapshot each sufficiently costly
+    // tower as a fork candidate, then merge them all into one group and keep
+    // going. Nested blocks are left alone; forking inside a loop body would
+    // fan out a fork per iteration.
+    std::unordered_map<Node*, size_t> group_of;
+    for (Node* node : graph_->block()->nodes()) {
+      if (node->kind() == prim::Constant) {
+        continue;
+      }
+      std::vector<size_t> producer_groups;
+      for (Value* input : node->inputs()) {
+        auto it = group_of.find(input->node());
+        if (it == group_of.end()) {
+          continue;
+        }
+        size_t root = find(it->second);
+        if (std::find(producer_groups.begin(), producer_groups.end(), root) ==
+            producer_groups.end()) {
+          producer_groups.push_back(root);
+        }
+      }
+      if (producer_groups.size() >= 2) {
+        for (size_t group : producer_groups) {
+          if (cost_[group] >= min_cost_) {
+            candidates_.push_back({nodes_[group], node});
+          }
+        }
+      }
+      size_t group;
+      if (producer_groups.empty()) {
+        group = parent_.size();
+        parent_.push_back(group);
+        nodes_.emplace_back();
+        cost_.push_back(0);
+      } else {
+        group = producer_groups[0];
+        for (size_t i = 1; i < producer_groups.size(); ++i) {
+          group = merge(group, producer_groups[i]);
+        }
+      }
+      nodes_[group].push_back(node);
+      cost_[group] += nodeCost(node);
+      group_of[node] = group;
+    }
+  }
+
+  // The single value of the tower that is consumed outside of it, or nullptr
+  // if the tower cannot be forked (side effects, aliasing writes, several
+  // escaping values, or a use before the join).
+  Value* forkableOutput(const Candidate& candidate) {
+    std::unordered_set<Node*> in_tower(
+        candidate.nodes.begin(), candidate.nodes.end());
+    Value* escaping = nullptr;
+    for (Node* node : candidate.nodes) {
+      if (node->hasSideEffects() || !node->blocks().empty() ||
+          node->kind() == prim::fork || node->kind() == aten::wait) {
+        return nullptr;
+      }
+      for (Value* input : node->inputs()) {
+        if (alias_db_.hasWriters(input)) {
+          return nullptr;
+        }
+      }
+      for (Value* output : node->outputs()) {
+        if (alias_db_.hasWriters(output)) {
+          return nullptr;
+        }
+        for (const Use& use : output->uses()) {
+          if (in_tower.count(use.user)) {
+            continue;
+          }
+          if (use.user != candidate.join &&
+              use.user->isBefore(candidate.join)) {
+            return nullptr;
+          }
+          if (escaping != nullptr && escaping != output) {
+            return nullptr;
+          }
+          escaping = output;
+        }
+      }
+    }
+    return escaping;
+  }
+
+  bool tryFork(const Candidate& candidate) {
+    // A bigger enclosing tower may already have been forked.
+    for (Node* node : candidate.nodes) {
+      if (forked_.count(node)) {
+        return false;
+      }
+    }
+    Value* output = forkableOutput(candidate);
+    if (output == nullptr) {
+      return false;
+    }
+
+    // All forks at a join must precede its first wait, or waiting on the
+    // first tower would delay launching the next one.
+    Node* insert_before = candidate.join;
+    auto first_wait = first_wait_.find(candidate.join);
+    if (first_wait != first_wait_.end()) {
+      insert_before = first_wait->second;
+    }
+
+    Node* fork = graph_->create(prim::fork, 1);
+    fork->insertBefore(insert_before);
+    auto subgraph = std::make_shared<Graph>();
+    std::unordered_map<Value*, Value*> value_map;
+    auto lookup_value = [&](Value* v) -> Value* {
+      auto it = value_map.find(v);
+      if (it != value_map.end()) {
+        return it->second;
+      }
+      // Free value: becomes an input of the fork and of its subgraph.
+      Value* input = subgraph->addInput()->copyMetadata(v);
+      fork->addInput(v);
+      value_map[v] = input;
+      return input;
+    };
+    for (Node* node : candidate.nodes) {
+      Node* clone = subgraph->insertNode(subgraph->createClone(
+          node, lookup_value, /*copy_blocks=*/false));
+      for (size_t i = 0; i < node->outputs().size(); ++i) {
+        value_map[node->outputs()[i]] = clone->outputs()[i];
+      }
+    }
+    subgraph->registerOutput(value_map.at(output));
+    fork->g_(attr::Subgraph, std::move(subgraph));
+    fork->output()->setType(FutureType::create(output->type()));
+
+    Node* wait = graph_->create(aten::wait, 1);
+    wait->addInput(fork->output());
+    wait->output()->setType(output->type());
+    wait->insertBefore(candidate.join);
+    if (first_wait == first_wait_.end()) {
+      first_wait_.emplace(candidate.join, wait);
+    }
+
+    output->replaceAllUsesAfterNodeWith(wait, wait->output());
+    for (auto it = candidate.nodes.rbegin(); it != candidate.nodes.rend();
+         ++it) {
+      forked_.insert(*it);
+      (*it)->destroy();
+    }
+    return true;
+  }
+
+  std::shared_ptr<Graph> graph_;
+  AliasDb alias_db_;
+  const size_t min_cost_;
+
+  std::vector<size_t> parent_;
+  std::vector<std::vector<Node*>> nodes_;
+  std::vector<size_t> cost_;
+  std::vector<Candidate> candidates_;
+  std::unordered_set<Node*> forked_;
+  std::unordered_map<Node*, Node*> first_wait_;
+};
+
+} // namespace
+
+bool InsertForkWait(const std::shared_ptr<Graph>& graph, size_t min_cost) {
+  ForkInserter inserter(graph, min_cost);
+  return inserter.run();
+}
+
+} // namespace jit
+} // namespace torch
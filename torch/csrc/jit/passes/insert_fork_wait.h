@@ -0,0 +1,26 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Automatically parallelize a frozen inference graph: find independent
+// subgraphs ("towers") that converge at a common consumer, and move each one
+// whose estimated cost is at least `min_cost` into a prim::fork, with an
+// aten::wait inserted in front of the consumer. The forked sections then run
+// concurrently on the existing inter-op thread pool, which is the inverse of
+// InlineForkWait's transformation.
+//
+// Only side-effect-free subgraphs whose values have no writers (according to
+// AliasDb) are considered, so the pass is intended for graphs that went
+// through freezing. Node costs are a rough per-op estimate where
+// convolutions, matrix multiplies, and RNN ops dominate; the default
+// threshold requires at least one such op per tower. Returns true if any
+// fork was inserted.
+TORCH_API bool InsertForkWait(
+    const std::shared_ptr<Graph>& graph,
+    size_t min_cost = 100);
+
+} // namespace jit
+} // namespace torch
@@ -6,6 +6,7 @@
 #include <torch/csrc/jit/ir/constants.h>
 #include <torch/csrc/jit/ir/ir_views.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 
 namespace torch {
@@ -366,6 +367,7 @@ Node* PeelLoop(Node* n, size_t times) {
 }
 
 bool UnrollLoops(std::shared_ptr<Graph>& graph) {
+  JIT_PASS_STATS_SCOPE(*graph);
   bool changed = UnrollLoops(graph->block());
   if (changed) {
     EliminateDeadCode(graph);
@@ -4,6 +4,7 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/ir_views.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/peephole_alias_sensitive.h>
 #include <torch/csrc/jit/passes/peephole_list_idioms.h>
@@ -544,6 +545,7 @@ bool FuseAddMM(const std::shared_ptr<Graph>& graph) {
 bool PeepholeOptimize(
     const std::shared_ptr<Graph>& graph,
     bool addmm_fusion_enabled) {
+  JIT_PASS_STATS_SCOPE(*graph);
   PeepholeOptimizeImpl peephole(graph, addmm_fusion_enabled);
   bool changed = peephole.run();
   GRAPH_DUMP("After PeepholeOptimize: ", graph);
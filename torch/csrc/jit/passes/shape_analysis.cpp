@@ -5,6 +5,7 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/constants.h>
 #include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/runtime/exception_message.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
@@ -86,7 +87,82 @@ class ShapePropagator {
     }
   }
 
+  // Incremental variant of PropagateShapeOnBlock(). Only repropagates nodes
+  // that consume a value in `changed` (including through values captured by
+  // subblocks), and extends `changed` with outputs whose type the revisit
+  // actually altered, so propagation stops at nodes whose output types don't
+  // depend on the changed values (e.g. full reductions). Expands are not
+  // inserted: the graph already went through the full pass and this revisit
+  // must not mutate it.
+  void PropagateShapeOnBlockIncremental(
+      Block* block,
+      std::unordered_set<Value*>& changed) {
+    for (Node* node : block->nodes()) {
+      bool affected = std::any_of(
+          node->inputs().begin(), node->inputs().end(), [&](Value* input) {
+            return changed.count(input) != 0;
+          });
+      if (!affected) {
+        for (Block* sub_block : node->blocks()) {
+          if (blockConsumesChanged(sub_block, changed)) {
+            affected = true;
+            break;
+          }
+        }
+      }
+      if (!affected) {
+        continue;
+      }
+      std::vector<TypePtr> prev_types;
+      prev_types.reserve(node->outputs().size());
+      for (Value* output : node->outputs()) {
+        prev_types.push_back(output->type());
+      }
+      try {
+        PropagateShapeOnNode(node, /*insert_expands=*/false);
+      } catch (propagation_error& e) {
+        setUnshapedType(node);
+      } catch (std::exception& e) {
+        throw ErrorReport(node->sourceRange())
+            << ExceptionMessage(e)
+            << "\nThe above operation failed shape propagation in this context";
+      }
+      for (size_t i = 0; i < node->outputs().size(); ++i) {
+        if (!(*node->outputs()[i]->type() == *prev_types[i])) {
+          changed.insert(node->outputs()[i]);
+        }
+      }
+    }
+  }
+
  private:
+  // Whether any node in `block` (or a nested block) reads a value in
+  // `changed`. Subblocks close over values from enclosing scopes, so a
+  // control-flow node can depend on a changed value that never appears among
+  // its own inputs.
+  static bool blockConsumesChanged(
+      Block* block,
+      const std::unordered_set<Value*>& changed) {
+    for (Value* output : block->outputs()) {
+      if (changed.count(output) != 0) {
+        return true;
+      }
+    }
+    for (Node* node : block->nodes()) {
+      for (Value* input : node->inputs()) {
+        if (changed.count(input) != 0) {
+          return true;
+        }
+      }
+      for (Block* sub_block : node->blocks()) {
+        if (blockConsumesChanged(sub_block, changed)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
   ValueSet resized_alias_set;
   const AliasDb aliasDb_;
 
@@ -2171,11 +2247,124 @@ class ShapePropagator {
 } // anonymous namespace
 
 void PropagateInputShapes(const std::shared_ptr<Graph>& graph) {
+  JIT_PASS_STATS_SCOPE(*graph);
   ShapePropagator(graph).PropagateShapeOnBlock(graph->block());
 }
 
 namespace {
 
+// True when `prev` and `next` have complete shapes agreeing everywhere but
+// the size of dimension 0, along with matching dtype and device.
+bool onlyBatchDimDiffers(const TensorType& prev, const TensorType& next) {
+  auto prev_sizes = prev.sizes().concrete_sizes();
+  auto next_sizes = next.sizes().concrete_sizes();
+  if (!prev_sizes || !next_sizes || prev_sizes->empty() ||
+      prev_sizes->size() != next_sizes->size()) {
+    return false;
+  }
+  if (prev.scalarType() != next.scalarType() ||
+      prev.device() != next.device()) {
+    return false;
+  }
+  if ((*prev_sizes)[0] == (*next_sizes)[0]) {
+    return false;
+  }
+  return std::equal(
+      prev_sizes->begin() + 1, prev_sizes->end(), next_sizes->begin() + 1);
+}
+
+// True when `current` already carries a symbolic (non-static) batch
+// dimension and describes `next` in every other respect, i.e. `next` is just
+// another batch size of a shape that has already been propagated
+// symbolically.
+bool batchDimAlreadySymbolic(const TensorType& current, const TensorType& next) {
+  const auto& symbolic = current.symbolic_sizes();
+  auto next_sizes = next.sizes().concrete_sizes();
+  if (!symbolic.rank() || !next_sizes || next_sizes->empty() ||
+      *symbolic.rank() != next_sizes->size()) {
+    return false;
+  }
+  if (current.scalarType() != next.scalarType() ||
+      current.device() != next.device()) {
+    return false;
+  }
+  if (symbolic[0].is_static()) {
+    return false;
+  }
+  for (size_t d = 1; d < next_sizes->size(); ++d) {
+    if (!symbolic[d].is_static() ||
+        symbolic[d].static_size() != (*next_sizes)[d]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns `type` with dimension 0 generalized to a fresh symbolic size, so
+// that any further batch-size-only profile change is indistinguishable from
+// the recorded type.
+TensorTypePtr withSymbolicBatchDim(const TensorTypePtr& type) {
+  auto sizes = type->sizes().concrete_sizes();
+  TORCH_INTERNAL_ASSERT(sizes && !sizes->empty());
+  std::vector<c10::ShapeSymbol> symbols;
+  symbols.reserve(sizes->size());
+  symbols.push_back(c10::ShapeSymbol::newSymbol());
+  for (size_t d = 1; d < sizes->size(); ++d) {
+    symbols.push_back(c10::ShapeSymbol::fromStaticSize((*sizes)[d]));
+  }
+  return type->withSymbolicShapes(c10::SymbolicShape(std::move(symbols)));
+}
+
+} // anonymous namespace
+
+void PropagateInputShapesIncremental(
+    const std::shared_ptr<Graph>& graph,
+    const std::vector<TypePtr>& new_input_types) {
+  JIT_PASS_STATS_SCOPE(*graph);
+  TORCH_CHECK(
+      new_input_types.size() == graph->inputs().size(),
+      "Expected one type per graph input, got ",
+      new_input_types.size(),
+      " types for ",
+      graph->inputs().size(),
+      " inputs");
+
+  std::unordered_set<Value*> changed;
+  for (size_t i = 0; i < new_input_types.size(); ++i) {
+    Value* input = graph->inputs()[i];
+    const TypePtr& next = new_input_types[i];
+    if (!next || *next == *input->type()) {
+      continue;
+    }
+    auto current_tt = input->type()->cast<TensorType>();
+    auto next_tt = next->cast<TensorType>();
+    if (current_tt && next_tt) {
+      if (batchDimAlreadySymbolic(*current_tt, *next_tt)) {
+        // Just another batch size of a shape already propagated with a
+        // symbolic batch dimension; every recorded type still holds.
+        continue;
+      }
+      if (onlyBatchDimDiffers(*current_tt, *next_tt)) {
+        // First batch-size change: generalize the batch dimension to a
+        // symbolic size before repropagating, so subsequent batch-size
+        // changes hit the branch above and touch nothing.
+        input->setType(withSymbolicBatchDim(next_tt));
+        changed.insert(input);
+        continue;
+      }
+    }
+    input->setType(next);
+    changed.insert(input);
+  }
+  if (changed.empty()) {
+    return;
+  }
+  ShapePropagator(graph).PropagateShapeOnBlockIncremental(
+      graph->block(), changed);
+}
+
+namespace {
+
 using TypeCache = std::unordered_map<TypePtr, TypePtr>;
 
 TypePtr getOrCreateUnshapedType(TypePtr type, TypeCache& unshaped_type_cache);
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/ir/ir.h>
 #include <memory>
+#include <vector>
 
 namespace torch {
 namespace jit {
@@ -11,5 +13,18 @@ struct Graph;
 TORCH_API void EraseShapeInformation(const std::shared_ptr<Graph>& graph);
 TORCH_API void PropagateInputShapes(const std::shared_ptr<Graph>& graph);
 
+// Incremental variant of PropagateInputShapes() for graphs that have already
+// been through the full pass. `new_input_types` holds one entry per graph
+// input (nullptr leaves that input untouched). Only nodes whose output types
+// are actually affected by the inputs that changed are repropagated;
+// propagation stops where the recomputed types come out unchanged. An input
+// whose new type differs from the recorded one only in the size of dimension
+// 0 (the batch dimension) has that dimension generalized to a symbolic size
+// before repropagating, so all further batch-size-only changes compare equal
+// to the recorded type and leave the graph entirely untouched.
+TORCH_API void PropagateInputShapesIncremental(
+    const std::shared_ptr<Graph>& graph,
+    const std::vector<TypePtr>& new_input_types);
+
 } // namespace jit
 } // namespace torch
@@ -7,6 +7,7 @@
 #include <torch/csrc/jit/codegen/fuser/interface.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/jit_opt_limit.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
 #include <torch/csrc/jit/passes/constant_pooling.h>
@@ -90,8 +91,9 @@ static const OperatorSet& supported_eltwise_set() {
       // TODO: uncomment when we properly support pow
       // "aten::pow.Tensor_Tensor(Tensor self, Tensor exponent) -> Tensor",
       // "aten::pow.Scalar(Scalar self, Tensor exponent) -> Tensor",
-      // TODO: support clamp_min, clamp_max
       "aten::clamp(Tensor self, Scalar? min=None, Scalar? max=None) -> Tensor",
+      "aten::clamp_min(Tensor self, Scalar min) -> Tensor",
+      "aten::clamp_max(Tensor self, Scalar max) -> Tensor",
       "aten::lerp.Scalar(Tensor self, Tensor end, Scalar weight) -> Tensor",
       "aten::lerp.Tensor(Tensor self, Tensor end, Tensor weight) -> Tensor",
       "aten::to.dtype(Tensor self, ScalarType dtype, bool non_blocking=False, bool copy=False, MemoryFormat? memory_format=None) -> Tensor",
@@ -1229,6 +1231,7 @@ void FuseTensorExprs(
     std::shared_ptr<Graph>& graph,
     size_t min_group_size,
     bool disable_shape_checks) {
+  JIT_PASS_STATS_SCOPE(*graph);
   GRAPH_DUMP("Before TExprFuser: ", graph);
 
   // Temporary change for Block code generation.
@@ -214,5 +214,22 @@ void MemoryDAG::setWildcards(
 Element* MemoryDAG::unsafeMakeFreshValue(const Value* v) {
   return makeFreshValueImpl(v, indexToElementMap_);
 }
+
+void MemoryDAG::unsafeMakePointerTo(Element* from, Element* to) {
+  makePointerToImpl(from, to);
+  // `from` is no longer a memory location, so any locations it memoized are
+  // wrong. Nothing may point to `from` yet (see the header comment), so no
+  // other element's cache can mention it.
+  from->cachedMemoryLocations_ = c10::nullopt;
+}
+
+void MemoryDAG::unsafeAddToContainedElements(Element* elem, Element* container) {
+  TORCH_INTERNAL_ASSERT(
+      elem != container, "Elements cannot contain themselves");
+  // Containment edges are not part of the memoized memory locations
+  // (mayContainAlias recomputes containment on every query), so this is safe
+  // on a frozen DAG.
+  container->containedElements.set(elem->index);
+}
 } // namespace jit
 } // namespace torch
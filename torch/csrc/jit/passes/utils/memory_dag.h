@@ -111,6 +111,13 @@ class TORCH_API MemoryDAG {
       const ska::flat_hash_map<const Value*, Element*>& elementMap,
       const std::function<Element*(const Value*)>& getWildcardElement);
   Element* unsafeMakeFreshValue(const Value* v);
+  // Make `from` point at `to` after the DAG has been frozen. This is only
+  // cache-safe if nothing may point to `from` yet, i.e. if `from` was itself
+  // created with `unsafeMakeFreshValue` and no queries have established
+  // aliasing through it. AliasDb's incremental analysis is the only intended
+  // caller.
+  void unsafeMakePointerTo(Element* from, Element* to);
+  void unsafeAddToContainedElements(Element* elem, Element* container);
 
  private:
   bool mayAliasImpl(const Element* a, const Element* b) const;
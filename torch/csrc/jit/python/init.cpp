@@ -9,6 +9,7 @@
 #include <torch/csrc/jit/frontend/ir_emitter.h>
 #include <torch/csrc/jit/frontend/tracer.h>
 #include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/jit_pass_stats.h>
 #include <torch/csrc/jit/passes/canonicalize.h>
 #include <torch/csrc/jit/passes/canonicalize_graph_fuser_ops.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
@@ -30,6 +31,7 @@
 #include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/inline_fork_wait.h>
+#include <torch/csrc/jit/passes/insert_fork_wait.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_graph.h>
@@ -455,6 +457,13 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_remove_expands", RemoveExpands)
       .def("_jit_pass_erase_number_types", EraseNumberTypes)
       .def("_jit_pass_inline_fork_wait", InlineForkWait)
+      .def(
+          "_jit_pass_insert_fork_wait",
+          [](const std::shared_ptr<Graph>& graph, size_t min_cost) {
+            return InsertForkWait(graph, min_cost);
+          },
+          py::arg("graph"),
+          py::arg("min_cost") = 100)
       .def("_jit_pass_inline", Inline)
       .def("_jit_pass_prepare_division_for_onnx", PrepareDivisionForONNX)
       .def(
@@ -577,6 +586,8 @@ void initJITBindings(PyObject* module) {
             size_t num_runs = getNumProfiledRuns();
             return num_runs;
           })
+      .def("_jit_pass_stats_report", []() { return pass_stats_report(); })
+      .def("_jit_pass_stats_reset", []() { reset_pass_stats(); })
       .def(
           "_jit_set_bailout_depth",
           [](size_t depth) {
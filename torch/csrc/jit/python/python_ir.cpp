@@ -209,7 +209,7 @@ Node* Graph::createPythonOp(
     THPObjectPtr&& pyobj,
     const std::string& cconv,
     pyobj_list&& scalar_args) {
-  ConcretePythonOp* op = new ConcretePythonOp(this);
+  ConcretePythonOp* op = new (*this) ConcretePythonOp(this);
   return op->init(std::move(pyobj), cconv, std::move(scalar_args));
 }
 
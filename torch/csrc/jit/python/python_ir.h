@@ -39,7 +39,7 @@ struct ConcretePythonOp : public PythonOp {
   std::string name() const override;
   void cloneFrom(Node* other_) override;
   Node* allocNewInstance(Graph* g) override {
-    return new ConcretePythonOp(g);
+    return new (*g) ConcretePythonOp(g);
   }
   // recover the autograd.Function instance, if this PythonOp's function
   // was originally SomeFunction.apply
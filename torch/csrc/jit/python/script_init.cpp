@@ -1046,6 +1046,24 @@ void initJitScriptBindings(PyObject* module) {
             throw std::runtime_error(
                 "Attempted to call get_debug_state on a Module without a compiled forward()");
           })
+      .def(
+          "_serialize_shape_profile",
+          [](Module& self) {
+            if (auto m = self.find_method("forward")) {
+              return py::bytes(m->get_executor().serializeShapeProfile());
+            }
+            throw std::runtime_error(
+                "Attempted to call _serialize_shape_profile on a Module without a compiled forward()");
+          })
+      .def(
+          "_restore_shape_profile",
+          [](Module& self, const std::string& data) {
+            if (auto m = self.find_method("forward")) {
+              return m->get_executor().restoreShapeProfile(data);
+            }
+            throw std::runtime_error(
+                "Attempted to call _restore_shape_profile on a Module without a compiled forward()");
+          })
       .def(
           "_define",
           [](Module& m,
@@ -1370,6 +1388,17 @@ void initJitScriptBindings(PyObject* module) {
           [](const StrongFunctionPtr& self) {
             return self.function_->get_executor().getDebugState();
           })
+      .def(
+          "_serialize_shape_profile",
+          [](const StrongFunctionPtr& self) {
+            return py::bytes(
+                self.function_->get_executor().serializeShapeProfile());
+          })
+      .def(
+          "_restore_shape_profile",
+          [](const StrongFunctionPtr& self, const std::string& data) {
+            return self.function_->get_executor().restoreShapeProfile(data);
+          })
       .def(
           "_debug_flush_compilation_cache",
           [](const StrongFunctionPtr& self) {
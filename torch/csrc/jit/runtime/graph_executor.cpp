@@ -43,13 +43,23 @@
 #include <torch/csrc/jit/runtime/logging.h>
 
 #include <cstdint>
+#include <cstdlib>
 #include <iterator>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+C10_DEFINE_int64(
+    torch_jit_execution_plan_cache_size,
+    0,
+    "Maximum number of shape-specialized ExecutionPlans cached per graph "
+    "executor; the least recently used plan is evicted when the cache is "
+    "full (0 = unbounded)");
+
 namespace torch {
 namespace jit {
 
@@ -539,10 +549,13 @@ void GraphExecutorImplBase::run(Stack& stack) {
   logging::getLogger()->addStatValue(
       logging::runtime_counters::GRAPH_EXECUTOR_INVOCATIONS, 1.0);
 
-  const ExecutionPlan& plan =
+  // take the plan by value: it shares ownership of the code and graph, so
+  // a concurrent eviction from a bounded plan cache can't free them while
+  // this invocation is still running
+  ExecutionPlan plan =
       getPlanFor(stack, GraphExecutor::getDefaultNumBailOuts());
   InterpreterState(plan.code).run(stack);
-  last_executed_optimized_graph = plan.graph;
+  last_executed_optimized_graph = std::move(plan.graph);
 }
 
 c10::intrusive_ptr<Future> GraphExecutorImplBase::runAsync(
@@ -605,7 +618,7 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
       state.fallback = fallback;
     }
     for (auto& entry : plan_cache) {
-      state.execution_plans.emplace(entry.first, entry.second);
+      state.execution_plans.emplace(entry.first, entry.second.first);
     }
     return state;
   }
@@ -632,15 +645,29 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
       std::lock_guard<std::mutex> lock(compile_mutex);
       auto it = plan_cache.find(spec);
       if (it != plan_cache.end()) {
+        // mark the plan as most recently used
+        lru_list_.splice(lru_list_.end(), lru_list_, it->second.second);
         logging::getLogger()->addStatValue(
             logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
-        return it->second;
+        return it->second.first;
       }
       auto plan = compileSpec(spec);
-      auto r = plan_cache.emplace(std::move(spec), std::move(plan));
       logging::getLogger()->addStatValue(
           logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
-      return r.first->second;
+      const size_t capacity = getPlanCacheCapacity();
+      if (capacity != 0 && plan_cache.size() >= capacity) {
+        // Evict the least recently used specialization. In-flight
+        // invocations are safe because they share ownership of the plan's
+        // code and graph (see GraphExecutorImplBase::run/runAsync).
+        plan_cache.erase(lru_list_.front());
+        lru_list_.pop_front();
+        logging::getLogger()->addStatValue(
+            logging::runtime_counters::EXECUTION_PLAN_CACHE_EVICTION, 1.0);
+      }
+      auto lru_it = lru_list_.insert(lru_list_.end(), spec);
+      auto r = plan_cache.emplace(
+          std::move(spec), std::make_pair(std::move(plan), lru_it));
+      return r.first->second.first;
     }
   }
 
@@ -737,6 +764,18 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
 
   ~GraphExecutorImpl() override = default;
 
+  static size_t getPlanCacheCapacity() {
+    // 0 means unbounded, which is the historical behavior
+    static const size_t capacity = []() -> size_t {
+      if (const char* env =
+              std::getenv("TORCH_JIT_EXECUTION_PLAN_CACHE_SIZE")) {
+        return std::max<int64_t>(std::atoll(env), 0);
+      }
+      return std::max<int64_t>(FLAGS_torch_jit_execution_plan_cache_size, 0);
+    }();
+    return capacity;
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   ArgumentSpecCreator arg_spec_creator_;
   // Populated only when optimize is false (and in that case plan_cache will be
@@ -745,9 +784,17 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
   ExecutionPlan fallback;
 
   // Mapping from argument configurations to optimized versions of the graph
-  // that are specialized to the spec.
+  // that are specialized to the spec, plus each entry's position in
+  // lru_list_. Bounded by getPlanCacheCapacity(); hit/miss/eviction counts
+  // are reported through the runtime counters in logging.h.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::unordered_map<
+      ArgumentSpec,
+      std::pair<ExecutionPlan, std::list<ArgumentSpec>::iterator>>
+      plan_cache;
+  // Argument configurations in least- to most-recently-used order.
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
-  std::unordered_map<ArgumentSpec, ExecutionPlan> plan_cache;
+  std::list<ArgumentSpec> lru_list_;
 };
 
 GraphExecutor::GraphExecutor(
@@ -790,6 +837,14 @@ GraphExecutorState GraphExecutor::getDebugState() {
   return pImpl->getDebugState();
 }
 
+std::string GraphExecutor::serializeShapeProfile() {
+  return pImpl->serializeShapeProfile();
+}
+
+bool GraphExecutor::restoreShapeProfile(const std::string& data) {
+  return pImpl->restoreShapeProfile(data);
+}
+
 void GraphExecutor::debugFlushCompilationCache() {
   if (auto ppImpl =
           std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
@@ -84,6 +84,16 @@ struct TORCH_API GraphExecutor {
   std::shared_ptr<Graph> graph() const;
   GraphExecutorState getDebugState();
 
+  // Serializes the shape information collected by the profiling runs into an
+  // opaque blob that can be stored next to the module, and replays such a
+  // blob into a fresh executor so the first call already compiles the
+  // optimized plan. restoreShapeProfile returns false (and leaves the
+  // executor in regular profiling mode) if the blob doesn't match this
+  // executor's graph. See Note [Serialized shape profiles] in
+  // profiling_graph_executor_impl.cpp
+  std::string serializeShapeProfile();
+  bool restoreShapeProfile(const std::string& data);
+
   static size_t getDefaultNumBailOuts();
 
   void debugFlushCompilationCache();
@@ -80,6 +80,17 @@ struct GraphExecutorImplBase {
       Stack& stack,
       size_t remaining_bailout_depth) = 0;
   virtual GraphExecutorState getDebugState() = 0;
+
+  // Snapshot/replay of profiled shape information. Only meaningful for the
+  // profiling executor; the legacy executor has no profiling state to save.
+  // See Note [Serialized shape profiles] in profiling_graph_executor_impl.cpp
+  virtual std::string serializeShapeProfile() {
+    return std::string();
+  }
+  virtual bool restoreShapeProfile(const std::string& /*data*/) {
+    return false;
+  }
+
   virtual ~GraphExecutorImplBase() = default;
 
  protected:
@@ -45,6 +45,41 @@ using torch::distributed::autograd::DistAutogradContainer;
 namespace torch {
 namespace jit {
 
+// Note [Computed-goto dispatch]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The interpreter's hot loop dispatches on OpCode once per instruction. With
+// a plain switch, every handler funnels back through a single indirect jump
+// whose target the branch predictor has to guess across all opcodes. On
+// compilers that can take the address of a label (GCC/Clang), we instead
+// build a per-opcode table of label addresses and have every handler jump
+// straight to the next instruction's handler (direct-threaded dispatch):
+// each of those indirect jumps gets its own predictor slot, which captures
+// opcode-pair correlations in instruction-dense graphs. Other compilers
+// (and explicit opt-outs via TORCH_JIT_DISABLE_COMPUTED_GOTO) keep the
+// portable switch; the INST/INST_NEXT macros expand so the loop body is
+// written only once for both modes. Handlers that suspend or unwind still
+// use return/break and re-enter through the switch, which stays correct in
+// both modes since the loop top re-fetches and re-dispatches.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(TORCH_JIT_DISABLE_COMPUTED_GOTO)
+#define JIT_USE_COMPUTED_GOTO
+#endif
+
+#ifdef JIT_USE_COMPUTED_GOTO
+#define INST(NAME)  \
+  NAME##_dispatch:  \
+  case NAME
+#define INST_NEXT                                     \
+  do {                                                \
+    frame = &frames.back();                           \
+    inst = frame->function->instructions_[frame->pc]; \
+    goto* kDispatchTable[inst.op];                    \
+  } while (false)
+#else
+#define INST(NAME) case NAME
+#define INST_NEXT break
+#endif
+
 // Before we translate to intepreter instructions, we do
 // some preprocessing of the graph to turn it into a form that is closer
 // to what the instructions will look like.
@@ -1192,10 +1227,58 @@ struct MobileCodeImpl : CodeImpl {
 struct InterpreterStateImpl : c10::intrusive_ptr_target {
   InterpreterStateImpl(const Code& code, TaskLauncher taskLauncher)
       : taskLauncher_(std::move(taskLauncher)) {
+    registers = acquireRegisterBank(code.pImpl->register_size_);
+    frames = acquireFrameStack();
     enterFrame(code, 0);
   }
 
+  ~InterpreterStateImpl() override {
+    recycleRegisterBank(std::move(registers));
+    recycleFrameStack(std::move(frames));
+  }
+
  private:
+  // Note [Interpreter state recycling]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Services that make many short script calls construct and destroy one
+  // InterpreterStateImpl per call, and the allocations behind the register
+  // bank and frame stack show up in profiles. Both vectors' lifetimes are
+  // bounded by the interpreter state, so retired storage is parked in small
+  // thread-local freelists and handed to the next state constructed on the
+  // thread; steady-state calls then allocate nothing for interpreter
+  // bookkeeping. Only raw capacity is kept — IValues and Frames are
+  // destroyed as eagerly as before. The entry frame's register count is
+  // known from the CodeImpl, so the bank is reserved for it up front;
+  // nested calls grow it and the grown capacity is what gets recycled. A
+  // state destroyed on a different thread than it was created on (e.g.
+  // after a continuation) migrates its storage to the destroying thread's
+  // freelist.
+  static constexpr size_t kMaxPooledStates = 8;
+
+  static std::vector<std::vector<IValue>>& registerBankPool() {
+    static thread_local std::vector<std::vector<IValue>> pool;
+    return pool;
+  }
+
+  static std::vector<IValue> acquireRegisterBank(size_t register_size) {
+    auto& pool = registerBankPool();
+    std::vector<IValue> bank;
+    if (!pool.empty()) {
+      bank = std::move(pool.back());
+      pool.pop_back();
+    }
+    bank.reserve(register_size);
+    return bank;
+  }
+
+  static void recycleRegisterBank(std::vector<IValue>&& bank) {
+    auto& pool = registerBankPool();
+    if (bank.capacity() == 0 || pool.size() >= kMaxPooledStates) {
+      return;
+    }
+    bank.clear();
+    pool.push_back(std::move(bank));
+  }
   struct WarnedNodes {
    public:
     // Inserts idx into warned_nodes_, returns a boolean indicates whether
@@ -1264,6 +1347,31 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 
   std::vector<Frame> frames;
 
+  // See Note [Interpreter state recycling]
+  static std::vector<std::vector<Frame>>& frameStackPool() {
+    static thread_local std::vector<std::vector<Frame>> pool;
+    return pool;
+  }
+
+  static std::vector<Frame> acquireFrameStack() {
+    auto& pool = frameStackPool();
+    if (!pool.empty()) {
+      auto stack = std::move(pool.back());
+      pool.pop_back();
+      return stack;
+    }
+    return {};
+  }
+
+  static void recycleFrameStack(std::vector<Frame>&& stack) {
+    auto& pool = frameStackPool();
+    if (stack.capacity() == 0 || pool.size() >= kMaxPooledStates) {
+      return;
+    }
+    stack.clear();
+    pool.push_back(std::move(stack));
+  }
+
   c10::intrusive_ptr<InterpreterStateImpl> intrusive_from_this() {
     c10::raw::intrusive_ptr::incref(this);
     return c10::intrusive_ptr<InterpreterStateImpl>::reclaim(this);
@@ -1337,20 +1445,29 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     if (frames.back().pc == 0 && stack_start_ == 0) {
       checkAndStartRecordFunction(frames.back(), stack);
     }
+#ifdef JIT_USE_COMPUTED_GOTO
+    // Per-opcode label addresses. See Note [Computed-goto dispatch]
+    static const void* const kDispatchTable[] = {
+#define DISPATCH_TABLE_ENTRY(op, _) &&op##_dispatch,
+        FORALL_OPCODES(DISPATCH_TABLE_ENTRY)
+#undef DISPATCH_TABLE_ENTRY
+    };
+#endif
     try {
       while (true) {
-        Frame& frame = frames.back();
+        Frame* frame = &frames.back();
         // std::cout << "RUNNING ";
-        // frames.back().function->dump(std::cout, frame.pc);
-        Instruction inst = frame.function->instructions_[frame.pc];
+        // frames.back().function->dump(std::cout, frame->pc);
+        Instruction inst = frame->function->instructions_[frame->pc];
         switch (inst.op) {
-          case ENTER: {
+          INST(ENTER) : {
             const auto& obj = peek(stack, 0, 1);
             TORCH_INTERNAL_ASSERT(obj.isObject());
             entered_objects.push_back(obj);
-            ++frame.pc;
-          } break;
-          case EXIT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(EXIT) : {
             auto obj = entered_objects.back().toObject();
             auto& f = obj->type()->getMethod("__exit__");
             push(stack, std::move(obj));
@@ -1359,65 +1476,68 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             push(stack, IValue());
             push(stack, IValue());
             runGraphFunction(stack, &f);
-          } break;
-          case OP:
-            frame.function->operator_table_[inst.X](&stack);
-            ++frame.pc;
-            break;
-          case OPN:
+          }
+            INST_NEXT;
+          INST(OP) :
+            frame->function->operator_table_[inst.X](&stack);
+            ++frame->pc;
+            INST_NEXT;
+          INST(OPN) :
             stack.push_back(inst.N);
-            frame.function->operator_table_[inst.X](&stack);
-            ++frame.pc;
-            break;
-          case LOAD:
+            frame->function->operator_table_[inst.X](&stack);
+            ++frame->pc;
+            INST_NEXT;
+          INST(LOAD) :
             stack.emplace_back(reg(inst.X));
-            ++frame.pc;
-            break;
-          case MOVE:
+            ++frame->pc;
+            INST_NEXT;
+          INST(MOVE) :
             stack.emplace_back(std::move(reg(inst.X)));
-            ++frame.pc;
-            break;
-          case STORE:
+            ++frame->pc;
+            INST_NEXT;
+          INST(STORE) :
             reg(inst.X) = pop(stack);
-            ++frame.pc;
-            break;
-          case STOREN:
+            ++frame->pc;
+            INST_NEXT;
+          INST(STOREN) :
             for (size_t i = inst.N; i > 0; --i) {
               reg(inst.X + i - 1) = pop(stack);
             }
-            ++frame.pc;
-            break;
-          case DROP:
+            ++frame->pc;
+            INST_NEXT;
+          INST(DROP) :
             pop(stack);
-            ++frame.pc;
-            break;
-          case DROPR:
+            ++frame->pc;
+            INST_NEXT;
+          INST(DROPR) :
             reg(inst.X) = IValue();
-            ++frame.pc;
-            break;
-          case LOADC:
-            stack.emplace_back(frame.function->constant_table_[inst.X]);
-            ++frame.pc;
-            break;
-          case GET_ATTR: {
+            ++frame->pc;
+            INST_NEXT;
+          INST(LOADC) :
+            stack.emplace_back(frame->function->constant_table_[inst.X]);
+            ++frame->pc;
+            INST_NEXT;
+          INST(GET_ATTR) : {
             auto userObj = pop(stack).toObject();
             auto value = userObj->getSlot(inst.X);
             push(stack, std::move(value));
-            ++frame.pc;
-          } break;
-          case SET_ATTR: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(SET_ATTR) : {
             auto v = pop(stack);
             auto userObj = pop(stack).toObject();
             userObj->setSlot(inst.X, std::move(v));
-            ++frame.pc;
-          } break;
-          case JF:
-            frame.pc += (pop(stack).toBool()) ? 1 : inst.X;
-            break;
-          case JMP:
-            frame.pc += inst.X;
-            break;
-          case LOOP: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(JF) :
+            frame->pc += (pop(stack).toBool()) ? 1 : inst.X;
+            INST_NEXT;
+          INST(JMP) :
+            frame->pc += inst.X;
+            INST_NEXT;
+          INST(LOOP) : {
             // stack: iteration_count, max_iter, cond, loop_carried_deps...
             auto fr = stack.end() - (inst.N + 1);
             int64_t trip_count = fr[0].toInt();
@@ -1426,25 +1546,27 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             if (trip_count < max_trip_count && cond) {
               fr[2] = trip_count;
               fr[0] = trip_count + 1;
-              ++frame.pc;
+              ++frame->pc;
             } else {
               size_t n_loop_carried = inst.N - 2;
               for (size_t i = 0; i < n_loop_carried; ++i) {
                 fr[i] = std::move(fr[i + 3]);
               }
               drop(stack, 3); // iteration_count, max_iter, cond
-              frame.pc += inst.X;
+              frame->pc += inst.X;
             }
-          } break;
-          case CALL: {
-            Function* fn = frame.function->function_table_[inst.X];
+          }
+            INST_NEXT;
+          INST(CALL) : {
+            Function* fn = frame->function->function_table_[inst.X];
             if (!fn->isGraphFunction()) {
               runBuiltinFunction(stack, fn);
             } else {
               runGraphFunction(stack, fn);
             }
-          } break;
-          case INTERFACE_CALL: {
+          }
+            INST_NEXT;
+          INST(INTERFACE_CALL) : {
             // note the hash table lookup to find the function
             // this can be more optimized if necessary, caching parts
             // of the hashing computation or storing the offset when
@@ -1462,17 +1584,18 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
                     .toObject()
                     ->type()
                     ->getMethod(
-                        frame.function->constant_table_[inst.X].toStringRef());
+                        frame->function->constant_table_[inst.X].toStringRef());
             if (!function.isGraphFunction()) {
               runBuiltinFunction(stack, &function);
             } else {
               runGraphFunction(stack, &function);
             }
-          } break;
-          case RET:
+          }
+            INST_NEXT;
+          INST(RET) :
             if (frames.size() > 1) {
               leaveFrame();
-              break;
+              INST_NEXT;
             }
             if (future_) {
               auto num_outputs = frames.back().function->n_outputs;
@@ -1486,7 +1609,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             // destroy the last frame and call RecordFunction's end callbacks
             leaveFrame();
             return false;
-          case WAIT: {
+          INST(WAIT) : {
             auto future = stack.back().toFuture();
             if (!future->completed()) {
               getOrCreateFuture();
@@ -1541,30 +1664,31 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             }
             stack.pop_back();
             stack.emplace_back(future->value());
-            ++frame.pc;
-          } break;
-          case PROFILE_OP: {
-            auto& frame_id_ref = frame.id;
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(PROFILE_OP) : {
+            auto& frame_id_ref = frame->id;
             if (!frame_id_ref.has_value()) {
               frame_id_ref = Frame::num_frames++;
             }
             const auto& callback =
-                frame.function->profile_function_table_[inst.X];
+                frame->function->profile_function_table_[inst.X];
             push(stack, c10::IValue{static_cast<int64_t>(*frame_id_ref)});
             callback(stack);
-            ++frame.pc;
-            break;
+            ++frame->pc;
           }
-          case FAIL_GUARD: {
+            INST_NEXT;
+          INST(FAIL_GUARD) : {
             // patch FAIL_GUARD back to GUARD
             GRAPH_DEBUG(
                 "Bailout ", inst.X, " triggered via bailout_requests_!");
-            frame.function->instructions_[frame.pc].op = GUARD;
+            frame->function->instructions_[frame->pc].op = GUARD;
             push(stack, false);
-            ++frame.pc;
-            break;
+            ++frame->pc;
           }
-          case TYPECHECK: {
+            INST_NEXT;
+          INST(TYPECHECK) : {
             int num_inputs = inst.N, i = 0;
             // NOLINTNEXTLINE(clang-diagnostic-sign-compare)
             TORCH_INTERNAL_ASSERT(stack.size() >= num_inputs && num_inputs > 0);
@@ -1572,7 +1696,8 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             for (i = 0; i < num_inputs; i++) {
               auto& input = peek(stack, i, num_inputs);
               auto& t = input.toTensor();
-              const TypePtr& expected = frame.function->type_table_[inst.X + i];
+              const TypePtr& expected =
+                  frame->function->type_table_[inst.X + i];
               auto* expected_type = expected->castRaw<TensorType>();
               if (t.defined() && !expected_type->matchTensor(t)) {
                 push(stack, false);
@@ -1582,10 +1707,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             if (i == num_inputs) {
               push(stack, true);
             }
-            ++frame.pc;
-            break;
+            ++frame->pc;
           }
-          case GUARD: {
+            INST_NEXT;
+          INST(GUARD) : {
             if (!stack.back().isTensor()) {
               // stack.back() is an Uninitialized IValue and this is a guard
               // on a block output. Uninitialized IValues are never used
@@ -1593,7 +1718,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               push(stack, true);
             } else {
               auto& t = stack.back().toTensor();
-              const TypePtr& expected = frame.function->type_table_[inst.X];
+              const TypePtr& expected = frame->function->type_table_[inst.X];
               auto* expected_type = expected->castRaw<TensorType>();
               if (t.defined() &&
                   !frames.back().symbols2dims.bindSymbolicShapes(
@@ -1603,21 +1728,22 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
                 push(stack, expected_type->matchTensor(t));
               }
             }
-            ++frame.pc;
-          } break;
-          case TAIL_CALL: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(TAIL_CALL) : {
             GRAPH_DEBUG("running TAIL_CALL for ", inst.X);
-            frame.function->function_table_[inst.X]->ensure_defined();
+            frame->function->function_table_[inst.X]->ensure_defined();
             size_t remaining_bailout_depth =
-                frame.function->remaining_bailout_depth_ > 0
-                ? frame.function->remaining_bailout_depth_ - 1
+                frame->function->remaining_bailout_depth_ > 0
+                ? frame->function->remaining_bailout_depth_ - 1
                 : 0;
-            const Code& code = frame.function->function_table_[inst.X]
+            const Code& code = frame->function->function_table_[inst.X]
                                    ->get_executor()
                                    .getPlanFor(stack, remaining_bailout_depth)
                                    .code;
             size_t num_inputs = code.num_inputs();
-            size_t base_pointer = frame.base_pointer;
+            size_t base_pointer = frame->base_pointer;
             TORCH_INTERNAL_ASSERT(stack.size() >= num_inputs);
             size_t inputs_start = stack.size() - num_inputs;
             for (size_t i = 0; i < num_inputs; ++i) {
@@ -1628,54 +1754,63 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             leaveFrame();
             enterFrame(code, base_pointer);
             checkAndStartRecordFunction(frames.back(), stack);
-          } break;
-          case LIST_UNPACK: {
+          }
+            INST_NEXT;
+          INST(LIST_UNPACK) : {
             listUnpack(stack, inst.X);
-            ++frame.pc;
-          } break;
-          case TUPLE_CONSTRUCT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(TUPLE_CONSTRUCT) : {
             tupleConstruct(stack, inst.X);
-            ++frame.pc;
-          } break;
-          case TUPLE_SLICE: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(TUPLE_SLICE) : {
             tupleSlice(stack, inst.X, inst.X + inst.N);
-            ++frame.pc;
-          } break;
-          case NAMED_TUPLE_CONSTRUCT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(NAMED_TUPLE_CONSTRUCT) : {
             namedTupleConstruct(
                 stack,
-                frame.function->type_table_[inst.X]->expect<TupleType>(),
+                frame->function->type_table_[inst.X]->expect<TupleType>(),
                 inst.N);
-            ++frame.pc;
-          } break;
-          case LIST_CONSTRUCT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(LIST_CONSTRUCT) : {
             const auto& type =
-                frame.function->type_table_[inst.X]->expectRef<ListType>();
+                frame->function->type_table_[inst.X]->expectRef<ListType>();
             listConstruct(stack, type, inst.N);
-            ++frame.pc;
-          } break;
-          case DICT_CONSTRUCT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(DICT_CONSTRUCT) : {
             const auto& type =
-                frame.function->type_table_[inst.X]->expectRef<DictType>();
+                frame->function->type_table_[inst.X]->expectRef<DictType>();
             dictConstruct(stack, type, inst.N);
-            ++frame.pc;
-          } break;
-          case CREATE_OBJECT: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(CREATE_OBJECT) : {
             auto type =
-                frame.function->type_table_[inst.X]->expect<ClassType>();
+                frame->function->type_table_[inst.X]->expect<ClassType>();
             createObject(stack, type);
-            ++frame.pc;
-          } break;
-          case ISINSTANCE: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(ISINSTANCE) : {
             at::ArrayRef<TypePtr> types(
-                &(frame.function->type_table_[inst.X]),
-                &(frame.function->type_table_[inst.X + inst.N]));
+                &(frame->function->type_table_[inst.X]),
+                &(frame->function->type_table_[inst.X + inst.N]));
             isinstance(stack, types);
-            ++frame.pc;
-          } break;
-          case FORK: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(FORK) : {
             // Move inputs to a separate stack
-            Function* forked_fn = frame.function->function_table_[inst.X];
+            Function* forked_fn = frame->function->function_table_[inst.X];
             InterpreterState forked_interpreter(
                 forked_fn->get_executor()
                     .getPlanFor(stack, GraphExecutor::getDefaultNumBailOuts())
@@ -1688,9 +1823,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             drop(stack, inst.N);
             push(stack, forked_interpreter.getFuture());
             taskLauncher_(std::move(continuation));
-            ++frame.pc;
-          } break;
-          case WARN: {
+            ++frame->pc;
+          }
+            INST_NEXT;
+          INST(WARN) : {
             // Keeps track of which WARN instruction has been executed before,
             // we only want to execute each WARN once to match default Python
             // warning behavior.
@@ -1700,7 +1836,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             }
 
             Node* node =
-                frames.back().function->instructions_source_.at(frame.pc);
+                frames.back().function->instructions_source_.at(frame->pc);
             auto range = node->sourceRange().source();
             if (range->filename()) {
               drop(stack, 1);
@@ -1723,8 +1859,9 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               }
               stack.pop_back();
             }
-            ++frame.pc;
-          } break;
+            ++frame->pc;
+          }
+            INST_NEXT;
         }
       }
     } catch (std::exception& e) {
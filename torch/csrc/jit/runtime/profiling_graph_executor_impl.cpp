@@ -32,6 +32,7 @@
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/passes/update_differentiable_graph_requires_grad.h>
 #include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <torch/csrc/jit/serialization/pickle.h>
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 C10_DEFINE_bool(
@@ -648,6 +649,301 @@ GraphExecutorState ProfilingGraphExecutorImpl::getDebugState() {
   return state;
 }
 
+// Note [Serialized shape profiles]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The profiling executor needs getNumProfiledRuns() warm executions before
+// it can compile an optimized plan, so every process restart serves slow
+// requests while re-learning shapes the previous incarnation already knew.
+// serializeShapeProfile() snapshots what those warm runs learned - the
+// merged TensorTypes on prim::profile nodes and the ivalue observations
+// accumulated on prim::profile_ivalue nodes - into a pickled blob that a
+// deployment can store next to the module. restoreShapeProfile() replays
+// the blob onto a freshly instrumented copy of the graph and marks the
+// profiling record ready, so the very first call compiles the optimized
+// plan directly.
+//
+// The blob identifies profile nodes by their order in this build's
+// instrumentation pipeline; restore validates the node count and kinds and
+// falls back to regular profiling (with a warning) on any mismatch, so a
+// stale blob only costs the warm runs it would have saved. Non-static
+// ShapeSymbols are process-local, so they are exported as densely numbered
+// negative ids and mapped back to fresh symbols on restore, preserving
+// which dimensions were observed to vary together.
+namespace {
+
+constexpr int64_t kShapeProfileFormatVersion = 1;
+
+void collectProfileNodes(Block* b, std::vector<Node*>& profile_nodes) {
+  for (Node* n : b->nodes()) {
+    if (n->kind() == prim::profile || n->kind() == prim::profile_ivalue) {
+      profile_nodes.push_back(n);
+    }
+    for (Block* ib : n->blocks()) {
+      collectProfileNodes(ib, profile_nodes);
+    }
+  }
+}
+
+IValue serializeProfiledType(
+    const TensorTypePtr& type,
+    std::map<c10::ShapeSymbol, int64_t>& symbol_ids) {
+  IValue sizes;
+  if (auto sym_sizes = type->symbolic_sizes().sizes()) {
+    std::vector<IValue> dims;
+    dims.reserve(sym_sizes->size());
+    for (const auto& s : *sym_sizes) {
+      if (s.is_static()) {
+        dims.emplace_back(s.static_size());
+      } else {
+        auto it = symbol_ids.find(s);
+        if (it == symbol_ids.end()) {
+          it = symbol_ids
+                   .emplace(s, -static_cast<int64_t>(symbol_ids.size()) - 1)
+                   .first;
+        }
+        dims.emplace_back(it->second);
+      }
+    }
+    sizes = c10::ivalue::Tuple::create(std::move(dims));
+  }
+
+  IValue strides;
+  if (auto stride_dims = type->stride_properties().sizes()) {
+    std::vector<IValue> dims;
+    dims.reserve(stride_dims->size());
+    for (const auto& s : *stride_dims) {
+      if (!s.has_value()) {
+        dims.emplace_back();
+        continue;
+      }
+      std::vector<IValue> fields;
+      fields.emplace_back(
+          s->stride_index_ ? IValue(static_cast<int64_t>(*s->stride_index_))
+                           : IValue());
+      fields.emplace_back(s->contiguous_ ? IValue(*s->contiguous_) : IValue());
+      fields.emplace_back(
+          s->stride_ ? IValue(static_cast<int64_t>(*s->stride_)) : IValue());
+      dims.emplace_back(c10::ivalue::Tuple::create(std::move(fields)));
+    }
+    strides = c10::ivalue::Tuple::create(std::move(dims));
+  }
+
+  std::vector<IValue> fields;
+  fields.emplace_back(
+      type->scalarType() ? IValue(static_cast<int64_t>(*type->scalarType()))
+                         : IValue());
+  fields.emplace_back(type->device() ? IValue(type->device()->str()) : IValue());
+  fields.emplace_back(
+      type->requiresGrad() ? IValue(*type->requiresGrad()) : IValue());
+  fields.emplace_back(type->undefined() ? IValue(*type->undefined()) : IValue());
+  fields.emplace_back(std::move(sizes));
+  fields.emplace_back(std::move(strides));
+  return c10::ivalue::Tuple::create(std::move(fields));
+}
+
+TensorTypePtr restoreProfiledType(
+    const IValue& entry,
+    std::unordered_map<int64_t, c10::ShapeSymbol>& symbols) {
+  const auto& fields = entry.toTuple()->elements();
+  TORCH_INTERNAL_ASSERT(fields.size() == 6);
+
+  c10::optional<at::ScalarType> scalar_type;
+  if (!fields[0].isNone()) {
+    scalar_type = static_cast<at::ScalarType>(fields[0].toInt());
+  }
+  c10::optional<c10::Device> device;
+  if (!fields[1].isNone()) {
+    device = c10::Device(fields[1].toStringRef());
+  }
+  c10::optional<bool> requires_grad;
+  if (!fields[2].isNone()) {
+    requires_grad = fields[2].toBool();
+  }
+  c10::optional<bool> undefined;
+  if (!fields[3].isNone()) {
+    undefined = fields[3].toBool();
+  }
+
+  c10::SymbolicShape sizes;
+  if (!fields[4].isNone()) {
+    std::vector<c10::ShapeSymbol> dims;
+    for (const auto& d : fields[4].toTuple()->elements()) {
+      auto v = d.toInt();
+      if (v >= 0) {
+        dims.push_back(c10::ShapeSymbol::fromStaticSize(v));
+      } else {
+        auto it = symbols.find(v);
+        if (it == symbols.end()) {
+          it = symbols.emplace(v, c10::ShapeSymbol::newSymbol()).first;
+        }
+        dims.push_back(it->second);
+      }
+    }
+    sizes = c10::SymbolicShape(std::move(dims));
+  }
+
+  c10::VaryingShape<c10::Stride> strides;
+  if (!fields[5].isNone()) {
+    std::vector<c10::optional<c10::Stride>> dims;
+    for (const auto& d : fields[5].toTuple()->elements()) {
+      if (d.isNone()) {
+        dims.emplace_back(c10::nullopt);
+        continue;
+      }
+      const auto& sf = d.toTuple()->elements();
+      c10::optional<size_t> stride_index;
+      c10::optional<bool> contiguous;
+      c10::optional<size_t> stride;
+      if (!sf.at(0).isNone()) {
+        stride_index = static_cast<size_t>(sf.at(0).toInt());
+      }
+      if (!sf.at(1).isNone()) {
+        contiguous = sf.at(1).toBool();
+      }
+      if (!sf.at(2).isNone()) {
+        stride = static_cast<size_t>(sf.at(2).toInt());
+      }
+      dims.emplace_back(c10::Stride(stride_index, contiguous, stride));
+    }
+    strides = c10::VaryingShape<c10::Stride>(std::move(dims));
+  }
+
+  return TensorType::create(
+      scalar_type, device, sizes, strides, requires_grad, undefined);
+}
+
+} // namespace
+
+std::string ProfilingGraphExecutorImpl::serializeShapeProfile() {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (!pr_ || !pr_->ready()) {
+    // nothing has been learned yet
+    return std::string();
+  }
+
+  std::vector<Node*> profile_nodes;
+  collectProfileNodes(pr_->graph()->block(), profile_nodes);
+
+  std::map<c10::ShapeSymbol, int64_t> symbol_ids;
+  std::vector<IValue> entries;
+  entries.reserve(profile_nodes.size());
+  for (Node* n : profile_nodes) {
+    if (n->kind() == prim::profile) {
+      IValue payload;
+      if (n->hasAttribute(attr::profiled_type)) {
+        auto type = n->ty(attr::profiled_type)->cast<TensorType>();
+        if (type && type != TensorType::get()) {
+          payload = serializeProfiledType(type, symbol_ids);
+        }
+      }
+      entries.emplace_back(
+          c10::ivalue::Tuple::create({IValue("t"), std::move(payload)}));
+    } else {
+      // prim::profile_ivalue accumulates its observations in ival attributes
+      std::vector<IValue> attrs;
+      for (auto name : n->attributeNames()) {
+        if (n->kindOf(name) == AttributeKind::ival) {
+          attrs.emplace_back(c10::ivalue::Tuple::create(
+              {IValue(name.toQualString()), n->ival(name)}));
+        }
+      }
+      entries.emplace_back(c10::ivalue::Tuple::create(
+          {IValue("i"), c10::ivalue::Tuple::create(std::move(attrs))}));
+    }
+  }
+
+  auto blob = c10::ivalue::Tuple::create(
+      {kShapeProfileFormatVersion,
+       c10::ivalue::Tuple::create(std::move(entries))});
+  try {
+    auto bytes = jit::pickle(blob);
+    return std::string(bytes.begin(), bytes.end());
+  } catch (const std::exception& e) {
+    TORCH_WARN("Could not serialize shape profile: ", e.what());
+    return std::string();
+  }
+}
+
+bool ProfilingGraphExecutorImpl::restoreShapeProfile(const std::string& data) {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (data.empty()) {
+    return false;
+  }
+  if (pr_ || optimized_plan_ || fallback_plan_) {
+    TORCH_WARN(
+        "restoreShapeProfile() must be called before the first execution; "
+        "ignoring shape profile data");
+    return false;
+  }
+
+  IValue blob;
+  try {
+    blob = jit::unpickle(data.data(), data.size());
+  } catch (const std::exception& e) {
+    TORCH_WARN("Could not decode shape profile data: ", e.what());
+    return false;
+  }
+  if (!blob.isTuple() || blob.toTuple()->elements().size() != 2 ||
+      !blob.toTuple()->elements()[0].isInt() ||
+      blob.toTuple()->elements()[0].toInt() != kShapeProfileFormatVersion ||
+      !blob.toTuple()->elements()[1].isTuple()) {
+    TORCH_WARN(
+        "Shape profile data has an unexpected format; "
+        "falling back to profiling");
+    return false;
+  }
+  const auto& entries = blob.toTuple()->elements()[1].toTuple()->elements();
+
+  // instrument a fresh copy of the graph exactly the way getOptimizedPlanFor
+  // would, then replay the recorded observations onto the profile nodes
+  auto copy = graph->copy();
+  runProfilingInsensitiveOptimizations(copy);
+  auto pr = ProfilingRecord::instrumentGraph(copy);
+  InsertProfileNodesForSpecializeAutogradZero(pr.get());
+
+  std::vector<Node*> profile_nodes;
+  collectProfileNodes(pr->graph()->block(), profile_nodes);
+  if (profile_nodes.size() != entries.size()) {
+    TORCH_WARN(
+        "Shape profile data doesn't match this graph (",
+        entries.size(),
+        " recorded entries vs ",
+        profile_nodes.size(),
+        " profile nodes); falling back to profiling");
+    return false;
+  }
+
+  std::unordered_map<int64_t, c10::ShapeSymbol> symbols;
+  for (size_t i = 0; i < profile_nodes.size(); i++) {
+    Node* n = profile_nodes[i];
+    const auto& fields = entries[i].toTuple()->elements();
+    const auto& tag = fields.at(0).toStringRef();
+    if ((tag == "t") != (n->kind() == prim::profile)) {
+      TORCH_WARN(
+          "Shape profile data doesn't match this graph; "
+          "falling back to profiling");
+      return false;
+    }
+    if (n->kind() == prim::profile) {
+      if (!fields.at(1).isNone()) {
+        n->ty_(attr::profiled_type, restoreProfiledType(fields.at(1), symbols));
+      }
+    } else {
+      for (const auto& attr_entry : fields.at(1).toTuple()->elements()) {
+        const auto& kv = attr_entry.toTuple()->elements();
+        n->ival_(Symbol::fromQualString(kv.at(0).toStringRef()), kv.at(1));
+      }
+    }
+  }
+
+  // mark the record ready, so the next getPlanFor call compiles the
+  // optimized plan without any warm-up runs
+  pr->profiling_count_ = 0;
+  pr_ = std::move(pr);
+  profiling_plan_ = ExecutionPlan(pr_->graph(), function_name_);
+  return true;
+}
+
 Node* insertFallbackFunctionCall(
     Graph* graph,
     Function* func,
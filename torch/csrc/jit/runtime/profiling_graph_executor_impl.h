@@ -12,6 +12,11 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   const ExecutionPlan& getPlanFor(Stack& stack, size_t remaining_bailout_depth)
       override;
   GraphExecutorState getDebugState() override;
+
+  // See Note [Serialized shape profiles]
+  std::string serializeShapeProfile() override;
+  bool restoreShapeProfile(const std::string& data) override;
+
   ~ProfilingGraphExecutorImpl() override = default;
 
   void debugFlushCompilationCache() {
@@ -85,7 +85,7 @@ ProfilingRecord::ProfilingRecord(std::shared_ptr<Graph> g)
 ProfileOp* ProfilingRecord::createProfileNode(
     const std::function<void(Stack&)>& fp,
     at::ArrayRef<Value*> inputs) {
-  auto pn = new ProfileOp(profiled_graph_.get(), fp);
+  auto pn = new (*profiled_graph_) ProfileOp(profiled_graph_.get(), fp);
 
   for (auto in : inputs) {
     pn->addInput(in);
@@ -94,7 +94,8 @@ ProfileOp* ProfilingRecord::createProfileNode(
 }
 
 ProfileIValueOp* ProfilingRecord::createProfileIValueNode(Value* in_val) {
-  auto pn = new ProfileIValueOp(this->profiled_graph_.get(), nullptr);
+  auto pn = new (*this->profiled_graph_)
+      ProfileIValueOp(this->profiled_graph_.get(), nullptr);
   pn->addInput(in_val);
   auto pno = pn->addOutput();
   pno->setType(in_val->type());
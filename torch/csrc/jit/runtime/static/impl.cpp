@@ -14,6 +14,8 @@
 #include <torch/csrc/jit/runtime/static/ops.h>
 #include <torch/csrc/jit/runtime/static/passes.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 
 namespace torch {
@@ -528,6 +530,35 @@ StaticModule::StaticModule(
           "When optimize_memory is true, enable_out_variant must be set to true");
     }
   }
+  if (opts_.strict_out_variants) {
+    if (!opts_.enable_out_variant) {
+      throw std::runtime_error(
+          "When strict_out_variants is true, enable_out_variant must be set to true");
+    }
+    // Fail at load time with the full list of uncovered ops, rather than
+    // letting each uncovered node silently take the interpreter fallback
+    // (and reallocate its outputs) at runtime.
+    std::set<std::string> fallback_ops;
+    for (Node* node : graph_->nodes()) {
+      if (node->kind() == prim::Constant) {
+        continue;
+      }
+      if (!canRunOutOfPlace(node) && !canRunNatively(node)) {
+        fallback_ops.insert(node->kind().toQualString());
+      }
+    }
+    if (!fallback_ops.empty()) {
+      std::ostringstream oss;
+      oss << "strict_out_variants is set, but the following ops have "
+             "neither an out variant nor a native impl: ";
+      bool first = true;
+      for (const auto& op : fallback_ops) {
+        oss << (first ? "" : ", ") << op;
+        first = false;
+      }
+      throw std::runtime_error(oss.str());
+    }
+  }
   // map Value* to IValue (from inputs or prim::Constant) or null
   std::unordered_map<Value*, IValue*> value_to_ivalue;
   // map Value* to its SSA definition IR
@@ -1153,6 +1184,36 @@ size_t MemoryPlanner::compute_aligned_tensor_size(size_t nbytes) {
   return (nbytes + c10::gAlignment - 1) & (~(c10::gAlignment - 1));
 }
 
+// Round the size up to a bucket boundary: the next power of two for small
+// sizes, and the next 1/8th step of the enclosing power of two for large
+// ones (at most 12.5% slack). Inputs with varying batch sizes would
+// otherwise move every managed slot's high-water mark on most runs, which
+// changes managed_bytes_ and defeats the size-keyed reuse in the CPU
+// caching allocator; with bucketed slots both the per-slot sizes and the
+// total stabilize after a few requests and the arena is reused across
+// differing batch dimensions.
+size_t MemoryPlanner::compute_bucketed_tensor_size(size_t nbytes) {
+  static constexpr size_t kLargeSizeThreshold = 32 * 1024;
+  const size_t aligned = compute_aligned_tensor_size(nbytes);
+  if (aligned == 0) {
+    return 0;
+  }
+  if (aligned <= kLargeSizeThreshold) {
+    size_t bucket = c10::gAlignment;
+    while (bucket < aligned) {
+      bucket <<= 1;
+    }
+    return bucket;
+  }
+  // A full power-of-two step would waste up to 2x on large activations.
+  size_t pow2 = kLargeSizeThreshold;
+  while (pow2 < aligned) {
+    pow2 <<= 1;
+  }
+  const size_t step = pow2 / 8;
+  return (aligned + step - 1) / step * step;
+}
+
 at::DataPtr MemoryPlanner::allocate_buffer(size_t size) {
   at::Allocator* allocator = c10::GetCPUCachingAllocator();
   return allocator->allocate(size);
@@ -1200,15 +1261,18 @@ void MemoryPlanner::deallocate() {
     size_t max = ms.first;
     for (auto& tensor : tensors) {
       size_t current_size =
-          compute_aligned_tensor_size(tensor->storage().nbytes());
+          compute_bucketed_tensor_size(tensor->storage().nbytes());
       tensor->storage().unsafeGetStorageImpl()->reset();
       max = std::max(max, current_size);
     }
     // Static runtime does not know the size of tensors statically, so we use
     // the tensor size from the previous run to allocate tensors for the next
     // run (following C2 tradition), exploiting the fact that tensor storage
-    // size does not have to match that of real tensor size. The following logic
-    // records the tensor storage size for the next run.
+    // size does not have to match that of real tensor size. The following
+    // logic records the high-water mark of the slot, rounded to a bucket
+    // boundary (see compute_bucketed_tensor_size) so that per-request shape
+    // jitter converges onto a stable, reusable arena instead of resizing it
+    // on most runs.
     ms.first = max;
     managed_bytes_ += max;
   }
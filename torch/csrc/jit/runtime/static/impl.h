@@ -24,6 +24,11 @@ struct TORCH_API StaticModuleOptions {
   // graph, where storage is deallocated outside static runtime
   // (enable_out_variant must be true)
   bool optimize_graph_output_memory{false};
+  // to fail StaticModule construction with the full list of ops that have
+  // neither an out variant nor a native impl, instead of silently falling
+  // back to the JIT interpreter for them at runtime
+  // (enable_out_variant must be true)
+  bool strict_out_variants{false};
 };
 
 /// The static runime supports two execution modes.
@@ -322,6 +327,7 @@ class MemoryPlanner {
   // at::DataPtr output_buffer_; // allocated each time we call Run()
 
   static size_t compute_aligned_tensor_size(size_t nbytes);
+  static size_t compute_bucketed_tensor_size(size_t nbytes);
   static at::DataPtr allocate_buffer(size_t size);
 };
 
@@ -185,7 +185,16 @@ void listUnpack(Stack& stack, size_t num_outputs) {
       num_outputs,
       " elements in a list but found ",
       list.size());
-  stack.insert(stack.end(), list.begin(), list.end());
+  if (list.use_count() == 1) {
+    // We hold the only reference (the common case: the list was consumed by
+    // its last use), so the elements can be moved onto the stack instead of
+    // paying a retain/release pair for each one.
+    for (size_t i = 0; i < num_outputs; ++i) {
+      stack.push_back(list.extract(i));
+    }
+  } else {
+    stack.insert(stack.end(), list.begin(), list.end());
+  }
 }
 
 void tupleConstruct(Stack& stack, size_t num_inputs) {
@@ -230,12 +239,12 @@ void dictConstruct(Stack& stack, const at::DictType& type, size_t num_inputs) {
   auto vals = c10::impl::GenericDict(type.getKeyType(), type.getValueType());
   vals.reserve(num_inputs / 2);
   // loop from the bottom of the stack to ensure the dictConstruct preserve
-  // the inputs order.
-  auto inputs = last(stack, num_inputs);
+  // the inputs order; moving the entries off the stack avoids a
+  // retain/release pair for every key and value.
+  size_t base = stack.size() - num_inputs;
   for (size_t i = 0; i < num_inputs; i += 2) {
-    auto key = inputs[i];
-    auto val = inputs[i + 1];
-    vals.insert_or_assign(std::move(key), std::move(val));
+    vals.insert_or_assign(
+        std::move(stack[base + i]), std::move(stack[base + i + 1]));
   }
   drop(stack, num_inputs);
   push(stack, std::move(vals));
@@ -23,7 +23,12 @@
 
 #include <ATen/core/jit_type.h>
 #include <ATen/core/qualified_name.h>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -422,16 +427,76 @@ class ScriptModuleSerializer {
           return type_name_uniquer_.getUniqueName(t);
         },
         &memoizedClassTypes);
-    data_pickle.protocol();
-    data_pickle.pushIValue(value);
-    data_pickle.stop();
-    size_t i = 0;
+    if (std::getenv("TORCH_SERIALIZATION_DEDUP_STORAGES")) {
+      data_pickle.setStorageContentDedup(true);
+    }
+
+    // Write tensor records on a separate thread as the pickler schedules
+    // them, so archive I/O overlaps with pickling instead of happening
+    // serially afterwards. The writer is only touched from that thread until
+    // it is joined; the .pkl record is written last, as before.
     std::string prefix = archive_name + "/";
-    for (const auto& td : data_pickle.tensorData()) {
-      WriteableTensorData writable_td = getWriteableTensorData(td);
-      std::string fname = prefix + c10::to_string(i++);
-      writer_.writeRecord(fname, writable_td.data(), writable_td.sizeInBytes());
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<at::Tensor> queued_tensors;
+    bool pickling_done = false;
+    std::exception_ptr write_error;
+    std::thread write_thread([&]() {
+      size_t i = 0;
+      std::unique_lock<std::mutex> lock(queue_mutex);
+      while (true) {
+        queue_cv.wait(
+            lock, [&]() { return !queued_tensors.empty() || pickling_done; });
+        if (queued_tensors.empty()) {
+          return;
+        }
+        at::Tensor td = std::move(queued_tensors.front());
+        queued_tensors.pop_front();
+        lock.unlock();
+        try {
+          WriteableTensorData writable_td = getWriteableTensorData(td);
+          std::string fname = prefix + c10::to_string(i++);
+          writer_.writeRecord(
+              fname, writable_td.data(), writable_td.sizeInBytes());
+        } catch (...) {
+          lock.lock();
+          write_error = std::current_exception();
+          return;
+        }
+        lock.lock();
+      }
+    });
+    data_pickle.setTensorDataCallback([&](const at::Tensor& tensor) {
+      {
+        std::lock_guard<std::mutex> guard(queue_mutex);
+        queued_tensors.push_back(tensor);
+      }
+      queue_cv.notify_one();
+    });
+    try {
+      data_pickle.protocol();
+      data_pickle.pushIValue(value);
+      data_pickle.stop();
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> guard(queue_mutex);
+        pickling_done = true;
+        queued_tensors.clear();
+      }
+      queue_cv.notify_one();
+      write_thread.join();
+      throw;
+    }
+    {
+      std::lock_guard<std::mutex> guard(queue_mutex);
+      pickling_done = true;
     }
+    queue_cv.notify_one();
+    write_thread.join();
+    if (write_error) {
+      std::rethrow_exception(write_error);
+    }
+
     std::string fname = archive_name + ".pkl";
     writer_.writeRecord(fname, data.data(), data.size());
 
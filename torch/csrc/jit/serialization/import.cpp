@@ -22,7 +22,9 @@
 #include <ATen/ATen.h>
 #include <fmt/format.h>
 
+#include <cstdlib>
 #include <fstream>
+#include <future>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -31,6 +33,7 @@ namespace torch {
 namespace jit {
 
 using caffe2::serialize::FileAdapter;
+using caffe2::serialize::MemoryMappedFileAdapter;
 using caffe2::serialize::IStreamAdapter;
 using caffe2::serialize::PyTorchStreamReader;
 using caffe2::serialize::ReadAdapterInterface;
@@ -85,7 +88,37 @@ IValue readArchiveAndTensors(
   };
 
   std::string archive_name_plus_slash = archive_name + "/";
-  auto read_record = [&](const std::string& name) {
+
+  // Kick off prefetch of all of this archive's tensor records;
+  // getRecordsAsync reads them on background threads when the underlying
+  // adapter supports it, so unpickling overlaps with the I/O instead of
+  // issuing one blocking read per tensor. The unpickler then waits on each
+  // record's future only when it first needs that record.
+  std::vector<std::string> record_names;
+  for (const auto& name : stream_reader.getAllRecords()) {
+    if (name.compare(
+            0, archive_name_plus_slash.size(), archive_name_plus_slash) == 0) {
+      record_names.push_back(name);
+    }
+  }
+  auto prefetched = std::make_shared<std::unordered_map<
+      std::string,
+      std::future<std::tuple<at::DataPtr, size_t>>>>();
+  auto record_futures = stream_reader.getRecordsAsync(record_names);
+  for (size_t i = 0; i < record_names.size(); ++i) {
+    prefetched->emplace(
+        record_names[i].substr(archive_name_plus_slash.size()),
+        std::move(record_futures[i]));
+  }
+
+  auto read_record = [&stream_reader, archive_name_plus_slash, prefetched](
+                         const std::string& name) {
+    auto it = prefetched->find(name);
+    if (it != prefetched->end()) {
+      at::DataPtr data = std::get<0>(it->second.get());
+      prefetched->erase(it);
+      return data;
+    }
     std::string ss = archive_name_plus_slash + name;
     return std::get<0>(stream_reader.getRecord(ss));
   };
@@ -352,7 +385,17 @@ Module load(
     const std::string& filename,
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files) {
-  std::unique_ptr<FileAdapter> rai = std::make_unique<FileAdapter>(filename);
+  // When TORCH_SERIALIZATION_MMAP is set, memory-map the archive so that
+  // uncompressed tensor records are used in place instead of being copied
+  // into freshly allocated storage. The mapping is private (copy-on-write),
+  // so the loaded tensors are still mutable.
+  std::unique_ptr<ReadAdapterInterface> rai;
+  if (std::getenv("TORCH_SERIALIZATION_MMAP")) {
+    rai = MemoryMappedFileAdapter::tryCreate(filename);
+  }
+  if (!rai) {
+    rai = std::make_unique<FileAdapter>(filename);
+  }
   auto module = load(std::move(rai), device, extra_files);
   return module;
 }
@@ -6,6 +6,7 @@
 #include <aten/src/ATen/quantized/Quantizer.h>
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/serialization/pickler.h>
+#include <cstring>
 #include <string>
 
 namespace torch {
@@ -278,6 +279,19 @@ void Pickler::pushString(const std::string& string) {
   }
 }
 
+namespace {
+// FNV-1a over a byte range; used to bucket storages when deduplicating them
+// by content.
+uint64_t hashBytes(const void* data, size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash;
+}
+} // namespace
+
 void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
   const at::Storage& storage = tensor.storage();
   void* addr = storage.unsafeGetStorageImpl();
@@ -287,6 +301,29 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
     return;
   }
 
+  // With content dedup on, a distinct storage whose bytes match one we
+  // already scheduled for writing reuses that storage's root key instead of
+  // getting its own record.
+  size_t root_key = tensor_data_.size();
+  bool is_duplicate = false;
+  if (dedup_storage_content_ && tensor.device().is_cpu() &&
+      storage.data() != nullptr) {
+    uint64_t content_hash = hashBytes(storage.data(), storage.nbytes());
+    auto& candidates = storage_content_map_[content_hash];
+    for (uint32_t candidate : candidates) {
+      const at::Storage& other = tensor_data_[candidate].storage();
+      if (other.nbytes() == storage.nbytes() &&
+          memcmp(other.data(), storage.data(), storage.nbytes()) == 0) {
+        root_key = candidate;
+        is_duplicate = true;
+        break;
+      }
+    }
+    if (!is_duplicate) {
+      candidates.push_back(root_key);
+    }
+  }
+
   // Tuple for persistent_load
   push<PickleOpCode>(PickleOpCode::MARK);
   // typename
@@ -296,7 +333,7 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
       std::string(toString(tensor.scalar_type())).append("Storage");
   pushGlobal("torch", data_type);
   // root_key
-  pushString(c10::to_string(tensor_data_.size()));
+  pushString(c10::to_string(root_key));
   // location
   pushString(tensor.device().str());
   // size
@@ -307,7 +344,12 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
 
   // TODO: Skip this if not writing tensors
   memoized_storage_map_[addr] = pushNextBinPut();
-  tensor_data_.push_back(tensor);
+  if (!is_duplicate) {
+    tensor_data_.push_back(tensor);
+    if (tensor_data_callback_) {
+      tensor_data_callback_(tensor_data_.back());
+    }
+  }
 }
 
 void Pickler::pushBytes(const std::string& string) {
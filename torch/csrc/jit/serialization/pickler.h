@@ -152,6 +152,23 @@ class TORCH_API Pickler {
     return tensor_data_;
   }
 
+  // Deduplicate tensor storages by content: a CPU storage whose bytes match
+  // one that was already scheduled for writing reuses that storage's record
+  // instead of getting its own, even when the two storages are distinct
+  // objects (e.g. tied embeddings saved as separate tensors). Deduplicated
+  // storages share one storage after loading. Must be set before pushing any
+  // values.
+  void setStorageContentDedup(bool enabled) {
+    dedup_storage_content_ = enabled;
+  }
+
+  // Called with each tensor as soon as its storage is scheduled for writing,
+  // in tensorData() order. Lets callers overlap writing tensor data with
+  // pickling instead of draining tensorData() once pickling is done.
+  void setTensorDataCallback(std::function<void(const at::Tensor&)> callback) {
+    tensor_data_callback_ = std::move(callback);
+  }
+
   void pushEmptyDict();
   void pushDict(const IValue& ivalue);
   void pushInt(int64_t value);
@@ -264,6 +281,13 @@ class TORCH_API Pickler {
   std::vector<at::Tensor> tensor_data_;
   std::unordered_map<const void*, uint32_t> memoized_storage_map_;
 
+  // Content-based storage deduplication (setStorageContentDedup): hash of the
+  // storage bytes -> indices into tensor_data_ with that hash. Collisions are
+  // resolved by comparing the actual bytes.
+  bool dedup_storage_content_ = false;
+  std::unordered_map<uint64_t, std::vector<uint32_t>> storage_content_map_;
+  std::function<void(const at::Tensor&)> tensor_data_callback_;
+
   std::unordered_map<std::string, uint32_t> memoized_globals_map_;
   std::unordered_map<std::string, uint32_t> memoized_strings_map_;
   std::unordered_map<std::string, uint32_t> memoized_devices_map_;
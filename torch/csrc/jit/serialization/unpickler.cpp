@@ -406,16 +406,23 @@ PickleOpCode Unpickler::readInstruction() {
       if (device_) {
         device = *device_;
       }
-      at::DataPtr storage_ptr = read_record_(key);
       int64_t numel = args.at(4).toInt();
       caffe2::TypeMeta dtype = at::CPU(type).typeMeta();
-      at::Storage storage(
-          c10::Storage::use_byte_size_t(),
-          numel * dtype.itemsize(),
-          std::move(storage_ptr),
-          /*allocator=*/nullptr,
-          /*resizable=*/false); // NB: we didn't set any allocator for the
-                                // tensor
+      at::Storage storage;
+      auto loaded = loaded_storages_.find(key);
+      if (loaded != loaded_storages_.end()) {
+        storage = loaded->second;
+      } else {
+        at::DataPtr storage_ptr = read_record_(key);
+        storage = at::Storage(
+            c10::Storage::use_byte_size_t(),
+            numel * dtype.itemsize(),
+            std::move(storage_ptr),
+            /*allocator=*/nullptr,
+            /*resizable=*/false); // NB: we didn't set any allocator for the
+                                  // tensor
+        loaded_storages_.emplace(key, storage);
+      }
       auto options = at::CPU(type).options();
 
       if (use_storage_device_) {
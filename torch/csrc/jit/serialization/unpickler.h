@@ -146,6 +146,11 @@ class TORCH_API Unpickler {
   IValue empty_tuple_;
 
   std::function<at::DataPtr(const std::string&)> read_record_;
+  // Storages already materialized from read_record_, by record key. A key can
+  // be referenced by more than one persistent id when the pickler
+  // deduplicated storages by content; reusing the loaded storage keeps those
+  // tensors sharing memory, matching torch.serialization.
+  std::unordered_map<std::string, at::Storage> loaded_storages_;
   c10::optional<at::Device> device_;
   // When set to true, Unpickler will ignore the pickled device and use the
   // device of the DataPtr returned by the read_record_ function. The default
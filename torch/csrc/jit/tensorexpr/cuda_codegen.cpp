@@ -1,6 +1,19 @@
 #include <torch/csrc/jit/tensorexpr/cuda_codegen.h>
 #include <torch/csrc/jit/tensorexpr/half_support.h>
 
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <ATen/CUDAGeneratorImpl.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <torch/csrc/jit/codegen/fuser/cuda/resource_strings.h>
@@ -116,6 +129,101 @@ static void codegenOutputQuery(
   compile_to_sass = (major == prop->major) && (minor == prop->minor);
 }
 
+// Note [TensorExpr compiled-kernel cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// NVRTC compilation of a fused kernel takes tens to hundreds of
+// milliseconds, and a fleet of identical workers pays it once per process
+// for the exact same source. The generated CUDA source is already a
+// normalized form of the fused subgraph (names and layout are
+// deterministic), so we cache compiled images content-addressed by
+// (source hash, target arch, NVRTC version):
+//
+// - an in-memory map serves repeat compilations within a process;
+// - if PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR is set, images are also
+//   persisted there as one file per kernel, so restarted or sibling
+//   processes (e.g. on a shared filesystem) skip NVRTC entirely.
+//
+// The arch tag and NVRTC version live in the file name, so a toolkit or
+// GPU change simply misses the old entries instead of loading stale
+// images. Files are written to a pid-suffixed temp name and renamed into
+// place, which keeps concurrent writers on a shared directory safe.
+namespace {
+
+uint64_t kernelSourceHash(const std::string& s) {
+  // FNV-1a, matching the hashing style used for other raw-byte keys
+  // (see ATen/native/utils/ParamsHash.h).
+  uint64_t h = 0xcbf29ce484222325ull;
+  for (char c : s) {
+    h = (h ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+  }
+  return h;
+}
+
+struct CompiledKernelCache {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::shared_ptr<std::vector<char>>> images;
+};
+
+CompiledKernelCache& kernelCache() {
+  static CompiledKernelCache cache;
+  return cache;
+}
+
+int kernelCachePid() {
+#ifdef _WIN32
+  return _getpid();
+#else
+  return getpid();
+#endif
+}
+
+std::string kernelCacheFilePath(const std::string& key) {
+  const char* dir = std::getenv("PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR");
+  if (dir == nullptr || *dir == '\0') {
+    return "";
+  }
+  return std::string(dir) + "/" + key + ".kernel";
+}
+
+std::shared_ptr<std::vector<char>> readKernelCacheFile(
+    const std::string& path) {
+  FILE* f = std::fopen(path.c_str(), "rb");
+  if (f == nullptr) {
+    return nullptr;
+  }
+  auto image = std::make_shared<std::vector<char>>();
+  if (std::fseek(f, 0, SEEK_END) == 0) {
+    long size = std::ftell(f);
+    if (size > 0 && std::fseek(f, 0, SEEK_SET) == 0) {
+      image->resize(size);
+      if (std::fread(image->data(), 1, size, f) != static_cast<size_t>(size)) {
+        image->clear();
+      }
+    }
+  }
+  std::fclose(f);
+  return image->empty() ? nullptr : image;
+}
+
+void writeKernelCacheFile(
+    const std::string& path,
+    const std::vector<char>& image) {
+  // Content for a given key is deterministic, so a failed or raced write
+  // just means some process recompiles; never let it throw.
+  std::string tmp_path = path + ".tmp." + std::to_string(kernelCachePid());
+  FILE* f = std::fopen(tmp_path.c_str(), "wb");
+  if (f == nullptr) {
+    return;
+  }
+  bool ok = std::fwrite(image.data(), 1, image.size(), f) == image.size();
+  ok = (std::fclose(f) == 0) && ok;
+  if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+} // namespace
+
 std::string cudaDtypeCppString(const Dtype& dtype) {
   switch (dtype.scalar_type()) {
     case ScalarType::Bool:
@@ -1228,76 +1336,116 @@ void CudaCodeGen::CompileToNVRTC(
   bool compile_to_sass = false;
   codegenOutputQuery(prop, major, minor, compile_to_sass);
 
-  // Creates the NVRTC program
+  // See Note [TensorExpr compiled-kernel cache]. The key folds in
+  // everything the compiled image depends on: the generated source, the
+  // target architecture, and the NVRTC version.
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  nvrtcProgram program;
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
-      &program, code.c_str(), nullptr, 0, nullptr, nullptr));
+  int nvrtc_major, nvrtc_minor;
+  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+  std::stringstream key_ss;
+  key_ss << std::hex << kernelSourceHash(code) << std::dec << "_"
+         << code.size() << "_" << (compile_to_sass ? "sm" : "compute") << major
+         << minor << "_nvrtc" << nvrtc_major << "." << nvrtc_minor;
+  const std::string cache_key = key_ss.str();
+  const std::string cache_path = kernelCacheFilePath(cache_key);
+
+  std::shared_ptr<std::vector<char>> image;
+  {
+    std::lock_guard<std::mutex> lock(kernelCache().mutex);
+    auto it = kernelCache().images.find(cache_key);
+    if (it != kernelCache().images.end()) {
+      image = it->second;
+    }
+  }
+  if (!image && !cache_path.empty()) {
+    image = readKernelCacheFile(cache_path);
+    if (image) {
+      std::lock_guard<std::mutex> lock(kernelCache().mutex);
+      kernelCache().images.emplace(cache_key, image);
+    }
+  }
+
+  if (!image) {
+    // Creates the NVRTC program
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    nvrtcProgram program;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
+        &program, code.c_str(), nullptr, 0, nullptr, nullptr));
 
 #ifdef __HIP_PLATFORM_HCC__
-  std::vector<const char*> args = {"--std=c++14"};
+    std::vector<const char*> args = {"--std=c++14"};
 #if ROCM_VERSION >= 40200
-  args.push_back("-hip-pch");
+    args.push_back("-hip-pch");
 #endif
 #else
-  const std::string compute = std::string("--gpu-architecture=") +
+    const std::string compute = std::string("--gpu-architecture=") +
 #if CUDA_VERSION >= 11010
-      // CUDA 11.1 allows going directly to SASS (sm_) instead of PTX (compute_)
-      // which gives better backwards compatibility to work on older driver,
-      // (since older driver doesn't necessrily recognize PTX emitted by new
-      // toolkit);
-      // Meanwhile, for forward compatibility (future device with
-      // `compile_to_sass==false`), since SASS are not necessarily compatible,
-      // we fallback to PTX instead.
-      (compile_to_sass ? "sm_" : "compute_") +
+        // CUDA 11.1 allows going directly to SASS (sm_) instead of PTX
+        // (compute_) which gives better backwards compatibility to work on
+        // older driver, (since older driver doesn't necessrily recognize PTX
+        // emitted by new toolkit);
+        // Meanwhile, for forward compatibility (future device with
+        // `compile_to_sass==false`), since SASS are not necessarily
+        // compatible, we fallback to PTX instead.
+        (compile_to_sass ? "sm_" : "compute_") +
 #else
-      "compute_" +
+        "compute_" +
 #endif
-      std::to_string(major) + std::to_string(minor);
-  const std::vector<const char*> args = {
-      "--std=c++14", compute.c_str(), "-default-device"};
+        std::to_string(major) + std::to_string(minor);
+    const std::vector<const char*> args = {
+        "--std=c++14", compute.c_str(), "-default-device"};
 #endif
 
-  const auto result =
-      nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
-  if (result != NVRTC_SUCCESS) {
+    const auto result =
+        nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
+    if (result != NVRTC_SUCCESS) {
+      // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+      size_t logsize;
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
+      std::vector<char> log(logsize);
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
+      std::stringstream cu;
+      cu << log.data() << std::endl;
+      cu << "nvrtc compilation failed: " << std::endl;
+      cu << code << std::endl;
+      throw std::runtime_error(cu.str());
+    }
+    ResourceGuard holdProgram(
+        [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
+    AT_CUDA_NVRTC_CHECK(result);
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    size_t logsize;
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
-    std::vector<char> log(logsize);
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
-    std::stringstream cu;
-    cu << log.data() << std::endl;
-    cu << "nvrtc compilation failed: " << std::endl;
-    cu << code << std::endl;
-    throw std::runtime_error(cu.str());
-  }
-  ResourceGuard holdProgram(
-      [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
-  AT_CUDA_NVRTC_CHECK(result);
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  size_t ptx_size;
-  std::vector<char> ptx;
+    size_t ptx_size;
+    std::vector<char> ptx;
 #if CUDA_VERSION >= 11010
-  // compile_to_sass determines whether we are generating SASS or PTX, hence
-  // the different API.
-  const auto getSize = compile_to_sass
-      ? at::globalContext().getNVRTC().nvrtcGetCUBINSize
-      : at::globalContext().getNVRTC().nvrtcGetPTXSize;
-  const auto getFunc = compile_to_sass
-      ? at::globalContext().getNVRTC().nvrtcGetCUBIN
-      : at::globalContext().getNVRTC().nvrtcGetPTX;
+    // compile_to_sass determines whether we are generating SASS or PTX, hence
+    // the different API.
+    const auto getSize = compile_to_sass
+        ? at::globalContext().getNVRTC().nvrtcGetCUBINSize
+        : at::globalContext().getNVRTC().nvrtcGetPTXSize;
+    const auto getFunc = compile_to_sass
+        ? at::globalContext().getNVRTC().nvrtcGetCUBIN
+        : at::globalContext().getNVRTC().nvrtcGetPTX;
 #else
-  const auto getSize = at::globalContext().getNVRTC().nvrtcGetPTXSize;
-  const auto getFunc = at::globalContext().getNVRTC().nvrtcGetPTX;
+    const auto getSize = at::globalContext().getNVRTC().nvrtcGetPTXSize;
+    const auto getFunc = at::globalContext().getNVRTC().nvrtcGetPTX;
 #endif
-  AT_CUDA_NVRTC_CHECK(getSize(program, &ptx_size));
-  ptx.resize(ptx_size);
-  AT_CUDA_NVRTC_CHECK(getFunc(program, ptx.data()));
+    AT_CUDA_NVRTC_CHECK(getSize(program, &ptx_size));
+    ptx.resize(ptx_size);
+    AT_CUDA_NVRTC_CHECK(getFunc(program, ptx.data()));
+
+    image = std::make_shared<std::vector<char>>(std::move(ptx));
+    {
+      std::lock_guard<std::mutex> lock(kernelCache().mutex);
+      kernelCache().images.emplace(cache_key, image);
+    }
+    if (!cache_path.empty()) {
+      writeKernelCacheFile(cache_path, *image);
+    }
+  }
 
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   CUmodule module;
-  AT_CUDA_DRIVER_CHECK(nvrtc().cuModuleLoadData(&module, ptx.data()));
+  AT_CUDA_DRIVER_CHECK(nvrtc().cuModuleLoadData(&module, image->data()));
   AT_CUDA_DRIVER_CHECK(
       nvrtc().cuModuleGetFunction(&function_, module, func_name.c_str()));
 
@@ -808,6 +808,20 @@ class SimpleIREvaluatorImpl : public IRVisitor {
     internal_buffers_.insert(std::make_pair(buffer_var, std::move(buffer)));
   }
 
+  void visit(const PlacementAllocate* v) override {
+    const Var* arena_var = v->arena()->base_handle();
+    auto iter = buffer_mapping_.find(arena_var);
+    if (iter == buffer_mapping_.end() || iter->second == nullptr) {
+      throw std::runtime_error(
+          "PlacementAllocate into an arena that has not been allocated: " +
+          arena_var->name_hint());
+    }
+    v->offset()->accept(this);
+    int offset = value_.as<int>();
+    buffer_mapping_[v->buf()->base_handle()] =
+        reinterpret_cast<uint8_t*>(iter->second) + offset;
+  }
+
   void visit(const Free* v) override {
     const Var* buffer_var = v->buffer_var();
     int count = internal_buffers_.erase(buffer_var);
@@ -437,6 +437,20 @@ Stmt* IRMutator::mutate(const Allocate* v) {
   return new Allocate(buf_new);
 }
 
+Stmt* IRMutator::mutate(const PlacementAllocate* v) {
+  const Buf* buf_new = dynamic_cast<const Buf*>(v->buf()->accept_mutator(this));
+  const Buf* arena_new =
+      dynamic_cast<const Buf*>(v->arena()->accept_mutator(this));
+  TORCH_INTERNAL_ASSERT(buf_new && arena_new);
+  const Expr* offset_new = v->offset()->accept_mutator(this);
+  if (buf_new == v->buf() && arena_new == v->arena() &&
+      offset_new == v->offset()) {
+    return (Stmt*)v;
+  }
+
+  return new PlacementAllocate(buf_new, arena_new, offset_new);
+}
+
 Stmt* IRMutator::mutate(const Free* v) {
   const Buf* buf = v->buf();
   const Buf* buf_new = dynamic_cast<const Buf*>(buf->accept_mutator(this));
@@ -491,6 +505,7 @@ class StmtClone : public IRMutator {
   Stmt* mutate(const Block* v) override;
   Stmt* mutate(const Store* v) override;
   Stmt* mutate(const Allocate* v) override;
+  Stmt* mutate(const PlacementAllocate* v) override;
   Stmt* mutate(const Free* v) override;
   Stmt* mutate(const Let* v) override;
   Stmt* mutate(const Cond* v) override;
@@ -524,6 +539,10 @@ Stmt* StmtClone::mutate(const Allocate* v) {
   return new Allocate(v->buf());
 }
 
+Stmt* StmtClone::mutate(const PlacementAllocate* v) {
+  return new PlacementAllocate(v->buf(), v->arena(), v->offset());
+}
+
 Stmt* StmtClone::mutate(const Free* v) {
   return new Free(v->buf());
 }
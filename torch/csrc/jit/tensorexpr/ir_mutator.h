@@ -40,6 +40,7 @@ class ExprHandle;
 class Expr;
 class Intrinsics;
 class Allocate;
+class PlacementAllocate;
 class Free;
 class Let;
 class Cond;
@@ -100,6 +101,7 @@ class TORCH_API IRMutator {
   virtual Stmt* mutate(const ExternalCall* v);
 
   virtual Stmt* mutate(const Allocate* v);
+  virtual Stmt* mutate(const PlacementAllocate* v);
   virtual Stmt* mutate(const Free* v);
   virtual Stmt* mutate(const Let* v);
   virtual Stmt* mutate(const Cond* v);
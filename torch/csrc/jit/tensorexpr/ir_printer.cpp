@@ -431,6 +431,13 @@ void IRPrinter::visit(const Allocate* v) {
   os() << "]" << std::endl;
 }
 
+void IRPrinter::visit(const PlacementAllocate* v) {
+  emitIndent();
+  os() << "PlacementAllocate(" << *v->buf()->base_handle() << ", "
+       << *v->arena()->base_handle() << ", offset=" << *v->offset()
+       << "); // dtype=" << v->buf()->dtype().ToCppString() << std::endl;
+}
+
 void IRPrinter::visit(const Free* v) {
   emitIndent();
   os() << "Free(" << *v->buffer_var() << ");" << std::endl;
@@ -57,6 +57,7 @@ class TORCH_API IRPrinter : public IRVisitor {
   void visit(const Cond* v) override;
   void visit(const Block* v) override;
   void visit(const Allocate* v) override;
+  void visit(const PlacementAllocate* v) override;
   void visit(const Free* v) override;
   void visit(const Let* v) override;
 
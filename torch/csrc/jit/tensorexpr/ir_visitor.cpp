@@ -167,6 +167,12 @@ void IRVisitor::visit(const Allocate* v) {
   }
 }
 
+void IRVisitor::visit(const PlacementAllocate* v) {
+  v->buf()->base_handle()->accept(this);
+  v->arena()->base_handle()->accept(this);
+  v->offset()->accept(this);
+}
+
 void IRVisitor::visit(const Free* v) {
   v->buffer_var()->accept(this);
 }
@@ -38,6 +38,7 @@ class Broadcast;
 class IfThenElse;
 class Intrinsics;
 class Allocate;
+class PlacementAllocate;
 class Free;
 class Let;
 class Cond;
@@ -86,6 +87,7 @@ class TORCH_API IRVisitor {
   virtual void visit(const IfThenElse* v);
   virtual void visit(const Intrinsics* v);
   virtual void visit(const Allocate* v);
+  virtual void visit(const PlacementAllocate* v);
   virtual void visit(const Free* v);
   virtual void visit(const Let* v);
   virtual void visit(const Cond* v);
@@ -495,6 +495,8 @@ std::vector<ExprHandle> TensorExprKernel::inferSizesForValue(
     case aten::atan:
     case aten::tanh:
     case aten::hardtanh:
+    case aten::clamp_min:
+    case aten::clamp_max:
     case aten::sqrt:
     case aten::rsqrt:
     case aten::abs:
@@ -851,18 +853,22 @@ Tensor* computeTwoOperand(
     const std::vector<ExprHandle>& outputShape,
     const c10::optional<ScalarType>& outputType,
     const std::function<ExprHandle(const ExprHandle&, const ExprHandle&)>&
-        innerExpr) {
+        innerExpr,
+    bool promote_inputs = true) {
   return Compute(
       name,
       c10::fmap<DimArg>(outputShape),
-      [inputValues, outputType, innerExpr](const std::vector<VarHandle>& axes) {
+      [inputValues, outputType, innerExpr, promote_inputs](
+          const std::vector<VarHandle>& axes) {
         std::vector<ExprHandle> indices(axes.begin(), axes.end());
         std::vector<ExprHandle> inputs = {
             tensorOrConstant(inputValues[0], indices),
             tensorOrConstant(inputValues[1], indices),
         };
 
-        promoteInputs(inputs);
+        if (promote_inputs) {
+          promoteInputs(inputs);
+        }
         ExprHandle compute = innerExpr(inputs[0], inputs[1]);
         return demoteOutput(compute, outputType);
       });
@@ -1277,6 +1283,32 @@ Tensor* tensorexpr::computeOperandValue(
           },
           false /* promote_inputs */);
     } break;
+    case aten::clamp_min: {
+      return computeTwoOperand(
+          "aten_clamp_min",
+          inputs,
+          outputShape,
+          outputType,
+          [](const ExprHandle& in, const ExprHandle& min) {
+            // As with clamp, the bound casts to the input dtype rather than
+            // promoting the whole tensor to the scalar's dtype.
+            auto cmin = Cast::make(in.dtype(), min);
+            return CompareSelect::make(in, cmin, cmin, in, kLT);
+          },
+          false /* promote_inputs */);
+    } break;
+    case aten::clamp_max: {
+      return computeTwoOperand(
+          "aten_clamp_max",
+          inputs,
+          outputShape,
+          outputType,
+          [](const ExprHandle& in, const ExprHandle& max) {
+            auto cmax = Cast::make(in.dtype(), max);
+            return CompareSelect::make(in, cmax, cmax, in, kGT);
+          },
+          false /* promote_inputs */);
+    } break;
     case aten::addcmul: {
       return computeFourOperand(
           "aten_addcmul",
@@ -1914,6 +1946,8 @@ Tensor* TensorExprKernel::computeValue(const torch::jit::Value* v) {
     case aten::max:
     case aten::masked_fill:
     case aten::clamp:
+    case aten::clamp_min:
+    case aten::clamp_max:
     case aten::addcmul:
     case aten::sigmoid:
     case aten::reciprocal:
@@ -2215,6 +2249,13 @@ Stmt* TensorExprKernel::transformLoops(BackendType backendType, Stmt* st) {
     l.vectorizeInnerLoops();
   }
 
+  if (backendType == kLLVMCodeGen || backendType == kSimpleIREval) {
+    // With static shapes, every non-inlined intermediate has a size known at
+    // compile time: pack them into one arena so that kernel invocations make
+    // no per-intermediate allocator calls.
+    l.planMemory();
+  }
+
   Stmt* stmt = l.root_stmt();
   // Arithmetic Simplification.
   stmt = IRSimplifier::simplify(stmt);
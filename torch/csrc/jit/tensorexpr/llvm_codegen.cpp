@@ -9,6 +9,7 @@
 
 #include <memory>
 
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
 #include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
@@ -18,6 +19,7 @@
 #include <llvm/IR/Verifier.h>
 #include <llvm/MC/MCSubtargetInfo.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/SHA1.h>
 #include <llvm/Support/TargetSelect.h>
 
 #if LLVM_VERSION_MAJOR >= 10
@@ -247,6 +249,7 @@ class LLVMCodeGenImpl : public IRVisitor {
   void visit(const IfThenElse* v) override;
   void visit(const Intrinsics* v) override;
   void visit(const Allocate* v) override;
+  void visit(const PlacementAllocate* v) override;
   void visit(const Free* v) override;
   void visit(const Let* v) override;
   void visit(const Cond* v) override;
@@ -539,15 +542,37 @@ void LLVMCodeGenImpl::emitKernel(
     throw std::runtime_error("Function verification failed");
   }
 
-  // print graph debug info before optimization
+  // Print the unoptimized module; it feeds both the graph debug output and
+  // the content hash below.
   llvm::SmallVector<char, 0> asmBuffer;
   llvm::raw_svector_ostream asmStream(asmBuffer);
-  if (GRAPH_DEBUG_ENABLED) {
-    module_->print(asmStream, nullptr);
-  }
+  module_->print(asmStream, nullptr);
   GRAPH_DEBUG(
       "\nLLVM module before optimizations\n\n", asmStream.str().str(), "\n");
 
+  // Name the module with a content hash of its unoptimized IR and the
+  // compilation target, so that the kernel object cache can reuse object code
+  // compiled earlier (possibly by another process) for identical kernels.
+  // See Note [TE kernel object cache] in llvm_jit.cpp.
+  auto& TM = jit_->getTargetMachine();
+  llvm::SHA1 hasher;
+  hasher.update(asmStream.str());
+  hasher.update(module_->getTargetTriple());
+  hasher.update(TM.getTargetCPU());
+  hasher.update(TM.getTargetFeatureString());
+  module_->setModuleIdentifier(
+      kTEKernelCacheKeyPrefix + llvm::toHex(hasher.final()));
+
+  // If the cache already holds object code for this module, the JIT will load
+  // it instead of compiling, and the optimization pipeline and assembly dump
+  // below would be wasted work.  Skip them unless graph debugging is on, in
+  // which case llvmCode_/asmCode_ should still show what the cached object
+  // was compiled from.
+  if (!GRAPH_DEBUG_ENABLED &&
+      teKernelCacheContains(module_->getModuleIdentifier())) {
+    return;
+  }
+
   optimize(*module_);
 
   asmBuffer.set_size(0);
@@ -1925,6 +1950,19 @@ void LLVMCodeGenImpl::visit(const Allocate* v) {
   varToVal_[v->buffer_var()] = malloc;
 }
 
+void LLVMCodeGenImpl::visit(const PlacementAllocate* v) {
+  llvm::Value* arena = varToVal_.at(v->arena()->base_handle());
+  v->offset()->accept(this);
+  llvm::Value* offset = irb_.CreateZExt(value_, LongTy_);
+
+  llvm::Value* base = irb_.CreatePointerCast(arena, irb_.getInt8PtrTy());
+  llvm::Value* ptr = irb_.CreateGEP(base, offset);
+  varToVal_[v->buf()->base_handle()] = irb_.CreatePointerCast(
+      ptr, dtypeToLLVM(v->buf()->dtype())->getPointerTo());
+
+  value_ = llvm::ConstantInt::get(IntTy_, 0);
+}
+
 void LLVMCodeGenImpl::visit(const Free* v) {
   value_ = llvm::ConstantInt::get(IntTy_, 0);
   llvm::Value* ptr = varToVal_.at(v->buffer_var());
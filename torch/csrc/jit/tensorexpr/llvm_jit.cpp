@@ -5,6 +5,7 @@
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/JITSymbol.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/CompileUtils.h>
 #include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
 #include <llvm/ExecutionEngine/Orc/IRCompileLayer.h>
@@ -17,7 +18,10 @@
 #include <llvm/IR/Mangler.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 
@@ -26,8 +30,12 @@
 #include <c10/util/Half.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -92,6 +100,138 @@ static void registerIntrinsics(
       absoluteSymbols({entry("DispatchParallel", DispatchParallel)})));
 }
 
+// Note [TE kernel object cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Compiling a fused group through LLVM (optimization pipeline + instruction
+// selection) dominates TensorExpr kernel construction time, and workers that
+// repeatedly compile the same models pay it again on every process start.
+// LLVMCodeGen therefore names each module with a content hash of its
+// unoptimized IR plus the target triple/CPU/features (see emitKernel in
+// llvm_codegen.cpp), and this ObjectCache memoizes the compiled object code
+// under that name.  Hits skip both the optimization pipeline and codegen; the
+// JIT only has to relocate the cached object.  The cache always lives in
+// memory for the duration of the process; setting
+// TORCH_TENSOREXPR_KERNEL_CACHE_DIR additionally persists objects to (and
+// preloads them from) that directory, so warm starts across processes avoid
+// LLVM entirely.  Modules without the content-hash prefix (i.e. not produced
+// by LLVMCodeGen) bypass the cache.
+class TEKernelObjectCache : public llvm::ObjectCache {
+ public:
+  static TEKernelObjectCache& get() {
+    static TEKernelObjectCache cache;
+    return cache;
+  }
+
+  void notifyObjectCompiled(
+      const llvm::Module* M,
+      llvm::MemoryBufferRef Obj) override {
+    const std::string& key = M->getModuleIdentifier();
+    if (!isCacheKey(key)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = objects_[key];
+    if (entry) {
+      return;
+    }
+    entry = llvm::MemoryBuffer::getMemBufferCopy(Obj.getBuffer(), key);
+    if (!cacheDir_.empty()) {
+      writeToDisk(key, entry->getBuffer());
+    }
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M) override {
+    const std::string& key = M->getModuleIdentifier();
+    if (!isCacheKey(key)) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    llvm::MemoryBuffer* entry = lookupLocked(key);
+    if (!entry) {
+      return nullptr;
+    }
+    // RuntimeDyld may take ownership of the returned buffer, so hand out a
+    // copy and keep the cached one.
+    return llvm::MemoryBuffer::getMemBufferCopy(entry->getBuffer(), key);
+  }
+
+  // Used by LLVMCodeGen to decide whether the optimization pipeline can be
+  // skipped for a module before handing it to the JIT.
+  bool contains(const std::string& key) {
+    if (!isCacheKey(key)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookupLocked(key) != nullptr;
+  }
+
+ private:
+  TEKernelObjectCache() {
+    if (const char* dir = std::getenv("TORCH_TENSOREXPR_KERNEL_CACHE_DIR")) {
+      cacheDir_ = dir;
+      if (!cacheDir_.empty() &&
+          llvm::sys::fs::create_directories(cacheDir_)) {
+        // Directory can't be created; fall back to the in-memory cache only.
+        cacheDir_.clear();
+      }
+    }
+  }
+
+  static bool isCacheKey(const std::string& key) {
+    return key.compare(
+               0,
+               strlen(kTEKernelCacheKeyPrefix),
+               kTEKernelCacheKeyPrefix) == 0;
+  }
+
+  std::string diskPath(const std::string& key) const {
+    llvm::SmallString<128> path(cacheDir_);
+    llvm::sys::path::append(path, key + ".o");
+    return path.str().str();
+  }
+
+  llvm::MemoryBuffer* lookupLocked(const std::string& key) {
+    auto it = objects_.find(key);
+    if (it != objects_.end()) {
+      return it->second.get();
+    }
+    if (cacheDir_.empty()) {
+      return nullptr;
+    }
+    auto file = llvm::MemoryBuffer::getFile(diskPath(key));
+    if (!file) {
+      return nullptr;
+    }
+    auto& entry = objects_[key];
+    entry = std::move(*file);
+    return entry.get();
+  }
+
+  void writeToDisk(const std::string& key, llvm::StringRef contents) const {
+    // Write to a unique temporary in the cache directory and rename so
+    // concurrent processes sharing the directory never observe a partially
+    // written object.
+    llvm::SmallString<128> tmpPath;
+    int tmpFD = -1;
+    if (llvm::sys::fs::createUniqueFile(
+            diskPath(key) + ".tmp.%%%%%%", tmpFD, tmpPath)) {
+      return;
+    }
+    {
+      llvm::raw_fd_ostream out(tmpFD, /*shouldClose=*/true);
+      out.write(contents.data(), contents.size());
+    }
+    if (llvm::sys::fs::rename(tmpPath, diskPath(key))) {
+      llvm::sys::fs::remove(tmpPath);
+    }
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<llvm::MemoryBuffer>>
+      objects_;
+  std::string cacheDir_;
+};
+
 namespace llvm {
 namespace orc {
 
@@ -110,6 +250,25 @@ class TORCH_API PytorchLLVMJITImpl {
         LLJ(assertSuccess(
             LLJITBuilder()
                 .setJITTargetMachineBuilder(makeTargetMachineBuilder())
+                // Route compilation through the TE kernel object cache so
+                // content-identical modules reuse previously emitted object
+                // code.  See Note [TE kernel object cache].
+#if LLVM_VERSION_MAJOR >= 10
+                .setCompileFunctionCreator(
+                    [](JITTargetMachineBuilder JTMB)
+                        -> Expected<
+                            std::unique_ptr<IRCompileLayer::IRCompiler>> {
+                      return std::make_unique<ConcurrentIRCompiler>(
+                          std::move(JTMB), &TEKernelObjectCache::get());
+                    })
+#else
+                .setCompileFunctionCreator(
+                    [](JITTargetMachineBuilder JTMB)
+                        -> Expected<IRCompileLayer::CompileFunction> {
+                      return IRCompileLayer::CompileFunction(ConcurrentIRCompiler(
+                          std::move(JTMB), &TEKernelObjectCache::get()));
+                    })
+#endif
                 .create())) {
     auto ProcSymbolsGenerator =
         assertSuccess(DynamicLibrarySearchGenerator::GetForCurrentProcess(
@@ -192,7 +351,9 @@ class TORCH_API PytorchLLVMJITImpl {
               return RTDyldObjectLinkingLayer::Resources{
                   std::make_shared<SectionMemoryManager>(), Resolver};
             }),
-        CompileLayer(ObjectLayer, SimpleCompiler(*TM)) {
+        CompileLayer(
+            ObjectLayer,
+            SimpleCompiler(*TM, &TEKernelObjectCache::get())) {
     auto& JD = ES.getMainJITDylib();
     MangleAndInterner Mangle(ES, DL);
     registerIntrinsics(JD, Mangle, intrinsics);
@@ -278,4 +439,16 @@ void dumpCFG(const llvm::cfg::Update<llvm::BasicBlock*>& update) {
 } // end namespace orc
 } // end namespace llvm
 
+namespace torch {
+namespace jit {
+namespace tensorexpr {
+
+bool teKernelCacheContains(const std::string& key) {
+  return TEKernelObjectCache::get().contains(key);
+}
+
+} // namespace tensorexpr
+} // namespace jit
+} // namespace torch
+
 #endif // TORCH_ENABLE_LLVM
@@ -18,6 +18,15 @@ namespace tensorexpr {
 
 void DispatchParallel(int8_t* func, int start, int stop, int8_t* packed_data);
 
+// Module identifier prefix marking content-addressed TE modules, whose
+// compiled object code is memoized across (and, optionally, between)
+// processes.  See Note [TE kernel object cache] in llvm_jit.cpp.
+constexpr const char* kTEKernelCacheKeyPrefix = "te_";
+
+// Whether the kernel object cache already holds compiled object code for the
+// given module identifier.
+TORCH_API bool teKernelCacheContains(const std::string& key);
+
 inline std::string formatError(llvm::Error&& err, const char* msg) {
   static constexpr char* defaultErrorMsg = "Unexpected failure in LLVM JIT";
   std::string errorMsg(msg ? msg : defaultErrorMsg);
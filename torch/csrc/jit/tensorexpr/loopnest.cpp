@@ -1,5 +1,7 @@
 #include <torch/csrc/jit/tensorexpr/loopnest.h>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
@@ -961,6 +963,158 @@ void LoopNest::prepareForCodegen() {
   root_stmt_ = insertAllocFree(root_stmt_);
 }
 
+namespace {
+
+struct ArenaPlacement {
+  Allocate* alloc;
+  Free* free;
+  size_t size; // bytes, rounded up to the arena alignment
+  size_t first; // position of the first top-level stmt touching the buffer
+  size_t last; // position of the last top-level stmt touching the buffer
+  size_t offset;
+};
+
+// Buffers are packed at cache-line granularity so that sharing the arena does
+// not introduce false sharing or misaligned vector accesses.
+constexpr size_t kArenaAlignment = 64;
+
+} // namespace
+
+void LoopNest::planMemory() {
+  Block* root = dynamic_cast<Block*>(root_stmt_);
+  if (!root) {
+    return;
+  }
+
+  // Liveness is tracked at the granularity of the top-level statements of the
+  // root block: a buffer is live from the first top-level statement that
+  // touches it through the last one. Buffers whose live ranges are disjoint
+  // may occupy the same arena bytes.
+  std::unordered_map<const Stmt*, size_t> top_position;
+  size_t pos = 0;
+  for (Stmt* s : *root) {
+    top_position[s] = pos++;
+  }
+
+  auto uses = findLoadOrStoreUses(root_stmt_);
+  std::unordered_map<const Buf*, Free*> free_of;
+  for (Free* f : NodeFinder<Free>::find(root_stmt_)) {
+    free_of[f->buf()] = f;
+  }
+
+  std::vector<ArenaPlacement> placements;
+  for (Allocate* a : NodeFinder<Allocate>::find(root_stmt_)) {
+    const Buf* buf = a->buf();
+    auto free_it = free_of.find(buf);
+    auto use_it = uses.find(buf);
+    if (free_it == free_of.end() || use_it == uses.end()) {
+      continue;
+    }
+
+    // Only buffers whose size is known at compile time can be laid out.
+    int64_t size = a->dtype().byte_size();
+    bool constant_size = true;
+    for (const Expr* dim : a->dims()) {
+      if (!dim->isConstant()) {
+        constant_size = false;
+        break;
+      }
+      size *= immediateAs<int64_t>(dim);
+    }
+    if (!constant_size || size < 0) {
+      continue;
+    }
+
+    size_t first = std::numeric_limits<size_t>::max();
+    size_t last = 0;
+    bool found_all_uses = true;
+    for (const auto& use : use_it->second) {
+      Stmt* top = use.s;
+      while (top && top->get_parent() != root) {
+        top = top->get_parent();
+      }
+      if (!top) {
+        found_all_uses = false;
+        break;
+      }
+      size_t p = top_position.at(top);
+      first = std::min(first, p);
+      last = std::max(last, p);
+    }
+    if (!found_all_uses) {
+      continue;
+    }
+
+    size_t aligned = (static_cast<size_t>(size) + kArenaAlignment - 1) /
+        kArenaAlignment * kArenaAlignment;
+    placements.push_back({a, free_it->second, aligned, first, last, 0});
+  }
+  if (placements.empty()) {
+    return;
+  }
+
+  // Assign offsets greedily, biggest buffers first: each buffer takes the
+  // lowest offset at which it does not overlap any already placed buffer
+  // whose live range intersects its own.
+  std::vector<size_t> order(placements.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (placements[a].size != placements[b].size) {
+      return placements[a].size > placements[b].size;
+    }
+    return placements[a].first < placements[b].first;
+  });
+  size_t arena_size = 0;
+  std::vector<size_t> placed;
+  for (size_t i : order) {
+    ArenaPlacement& p = placements[i];
+    std::vector<std::pair<size_t, size_t>> conflicts;
+    for (size_t j : placed) {
+      const ArenaPlacement& q = placements[j];
+      if (p.first <= q.last && q.first <= p.last) {
+        conflicts.emplace_back(q.offset, q.offset + q.size);
+      }
+    }
+    std::sort(conflicts.begin(), conflicts.end());
+    size_t offset = 0;
+    for (const auto& c : conflicts) {
+      if (offset + p.size <= c.first) {
+        break;
+      }
+      offset = std::max(offset, c.second);
+    }
+    p.offset = offset;
+    arena_size = std::max(arena_size, offset + p.size);
+    placed.push_back(i);
+  }
+  // Offsets are baked in as IntImms, so bail out on (pathologically) huge
+  // arenas rather than overflow.
+  if (arena_size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return;
+  }
+
+  // Replace the individual Allocate/Free pairs with offsets into the arena.
+  const Buf* arena = new Buf(
+      "arena", {new IntImm(static_cast<int>(arena_size))}, kByte);
+  std::vector<Stmt*> placement_stmts;
+  for (const ArenaPlacement& p : placements) {
+    Block* alloc_block = dynamic_cast<Block*>(p.alloc->get_parent());
+    Block* free_block = dynamic_cast<Block*>(p.free->get_parent());
+    TORCH_INTERNAL_ASSERT(alloc_block && free_block);
+    alloc_block->remove_stmt(p.alloc);
+    free_block->remove_stmt(p.free);
+    placement_stmts.push_back(new PlacementAllocate(
+        p.alloc->buf(), arena, new IntImm(static_cast<int>(p.offset))));
+  }
+  for (auto it = placement_stmts.rbegin(); it != placement_stmts.rend(); it++) {
+    root->prepend_stmt(*it);
+  }
+  root->prepend_stmt(new Allocate(arena));
+  root->append_stmt(new Free(arena));
+}
+
 void LoopNest::vectorizeInnerLoops() {
   std::vector<For*> innerLoops;
   std::vector<For*> worklist;
@@ -341,6 +341,15 @@ class TORCH_API LoopNest {
   void eliminateDeadStores();
   void prepareForCodegen();
 
+  // Static memory planner: replaces the individual allocations of
+  // constant-sized intermediate buffers (inserted by prepareForCodegen) with
+  // byte offsets into a single arena, assigned by liveness so that buffers
+  // that are never live at the same time share memory. Kernel execution then
+  // performs one allocation instead of one per intermediate. Must run after
+  // prepareForCodegen; only the LLVM and IR evaluator backends understand the
+  // resulting PlacementAllocate statements.
+  void planMemory();
+
   // Find the inner-most loops and vectorize them. Currently, this only works
   // for the LLVM backend, when no reductions are involved.
   void vectorizeInnerLoops();
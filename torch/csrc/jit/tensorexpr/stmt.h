@@ -336,6 +336,45 @@ class TORCH_API Allocate : public StmtNode<Allocate> {
   // TODO: add memory types.
 };
 
+// Binds the memory of a buffer to a byte offset inside an arena buffer that
+// is allocated separately, instead of giving the buffer an allocation of its
+// own. Inserted by the static memory planner (LoopNest::planMemory), which
+// packs all constant-sized intermediate buffers into a single arena.
+class TORCH_API PlacementAllocate : public StmtNode<PlacementAllocate> {
+ public:
+  static PlacementAllocate* make(
+      const BufHandle& buf_handle,
+      const BufHandle& arena_handle,
+      const ExprHandle& offset) {
+    return new PlacementAllocate(
+        buf_handle.node(), arena_handle.node(), offset.node());
+  }
+
+  const Buf* buf() const {
+    return buf_;
+  }
+
+  const Buf* arena() const {
+    return arena_;
+  }
+
+  // Offset into the arena, in bytes.
+  const Expr* offset() const {
+    return offset_;
+  }
+
+  explicit PlacementAllocate(
+      const Buf* buf,
+      const Buf* arena,
+      const Expr* offset)
+      : buf_(buf), arena_(arena), offset_(offset) {}
+
+ private:
+  const Buf* buf_;
+  const Buf* arena_;
+  const Expr* offset_;
+};
+
 // Free the specific buffer. It is an error.
 class TORCH_API Free : public StmtNode<Free> {
  public:
@@ -397,6 +397,23 @@ def memory_snapshot():
     return torch._C._cuda_memorySnapshot()
 
 
+def memory_trace():
+    r"""Returns the CUDA memory allocator's flight recorder across all devices.
+
+    The allocator keeps a small ring buffer of its recent events (allocations,
+    frees, segment acquisitions/releases, and OOMs). Each entry is a dict with
+    ``action``, ``device``, ``addr``, ``size``, ``stream`` and ``time_us``
+    keys, ordered oldest first. The buffer size can be tuned with the
+    ``PYTORCH_CUDA_ALLOC_TRACE_ENTRIES`` environment variable (0 disables
+    recording).
+
+    .. note::
+        See :ref:`cuda-memory-management` for more details about GPU memory
+        management.
+    """
+    return torch._C._cuda_memoryTraceDump()
+
+
 def memory_summary(device: Union[Device, int] = None, abbreviated: bool = False) -> str:
     r"""Returns a human-readable printout of the current memory allocator
     statistics for a given device.
@@ -0,0 +1,100 @@
+#include <c10d/FlightRecorder.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+namespace c10d {
+
+FlightRecorder::FlightRecorder(size_t capacity) : capacity_(capacity) {
+  entries_.reserve(capacity_);
+}
+
+FlightRecorder& FlightRecorder::get() {
+  static FlightRecorder recorder;
+  return recorder;
+}
+
+uint64_t FlightRecorder::nextSeq() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return seq_++;
+}
+
+void FlightRecorder::record(const FlightRecorderEntry& entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.size() < capacity_) {
+    entries_.push_back(entry);
+  } else {
+    entries_[next_] = entry;
+  }
+  next_ = (next_ + 1) % capacity_;
+}
+
+std::vector<FlightRecorderEntry> FlightRecorder::dump() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<FlightRecorderEntry> result;
+  result.reserve(entries_.size());
+  // Once the buffer has wrapped, next_ points at the oldest entry.
+  const size_t begin = entries_.size() < capacity_ ? 0 : next_;
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    result.push_back(entries_[(begin + i) % entries_.size()]);
+  }
+  return result;
+}
+
+int64_t flightRecorderTimeNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::vector<CollectiveSkew> computeCollectiveSkew(
+    const std::vector<std::vector<FlightRecorderEntry>>& rankDumps) {
+  // seq -> entries seen so far, paired with the rank they came from. Only
+  // sequence numbers present in every dump describe a collective whose record
+  // survives on all ranks, so only those yield a skew entry.
+  std::map<uint64_t, std::vector<std::pair<size_t, FlightRecorderEntry>>>
+      bySeq;
+  for (size_t rank = 0; rank < rankDumps.size(); ++rank) {
+    for (const auto& entry : rankDumps[rank]) {
+      bySeq[entry.seq].emplace_back(rank, entry);
+    }
+  }
+
+  std::vector<CollectiveSkew> result;
+  for (const auto& kv : bySeq) {
+    const auto& entries = kv.second;
+    if (entries.size() != rankDumps.size()) {
+      continue;
+    }
+    CollectiveSkew skew{};
+    skew.seq = kv.first;
+    int64_t minStart = entries[0].second.startTimeNs;
+    int64_t maxStart = minStart;
+    int64_t minEnd = entries[0].second.endTimeNs;
+    int64_t maxEnd = minEnd;
+    int64_t minDuration = minEnd - minStart;
+    int64_t maxDuration = minDuration;
+    skew.lastStartRank = entries[0].first;
+    for (const auto& rankEntry : entries) {
+      const auto& e = rankEntry.second;
+      if (e.startTimeNs > maxStart) {
+        maxStart = e.startTimeNs;
+        skew.lastStartRank = rankEntry.first;
+      }
+      minStart = std::min(minStart, e.startTimeNs);
+      minEnd = std::min(minEnd, e.endTimeNs);
+      maxEnd = std::max(maxEnd, e.endTimeNs);
+      const int64_t duration = e.endTimeNs - e.startTimeNs;
+      minDuration = std::min(minDuration, duration);
+      maxDuration = std::max(maxDuration, duration);
+    }
+    skew.startSkewNs = maxStart - minStart;
+    skew.endSkewNs = maxEnd - minEnd;
+    skew.slackNs = maxDuration - minDuration;
+    result.push_back(skew);
+  }
+  return result;
+}
+
+} // namespace c10d
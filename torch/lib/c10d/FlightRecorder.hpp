@@ -0,0 +1,92 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include <c10d/ProcessGroup.hpp>
+
+namespace c10d {
+
+// One completed collective (or p2p operation), as captured by the flight
+// recorder. Timestamps come from a monotonic clock and are in nanoseconds;
+// they are only comparable within the process that recorded them.
+struct FlightRecorderEntry {
+  // Monotonically increasing per-process sequence number, assigned when the
+  // work object is created. In the common SPMD case where all ranks issue the
+  // same sequence of collectives, entries with equal seq describe the same
+  // collective on every rank, which is what makes the cross-rank skew
+  // computation below possible.
+  uint64_t seq;
+  OpType opType;
+  // Total bytes of the input tensors, 0 when unknown.
+  int64_t bytes;
+  // When the work object was created, i.e. when the caller issued the op.
+  int64_t enqueueTimeNs;
+  // When the backend started executing the op. Backends that do not report a
+  // separate start time fall back to the enqueue time.
+  int64_t startTimeNs;
+  // When completion of the op was observed on the host.
+  int64_t endTimeNs;
+};
+
+// Cross-rank statistics for one collective, computed from the flight recorder
+// dumps of all ranks; see computeCollectiveSkew().
+struct CollectiveSkew {
+  uint64_t seq;
+  // Spread between the first and last rank to start (resp. finish) the
+  // collective. A consistently large start skew points at a straggler that is
+  // late producing its input.
+  int64_t startSkewNs;
+  int64_t endSkewNs;
+  // Difference between the slowest and fastest rank's time spent inside the
+  // collective. Fast ranks spend roughly this long blocked waiting for the
+  // stragglers, so this is the per-collective slack the slow host costs.
+  int64_t slackNs;
+  // Index (into the dumps passed in) of the rank that started last. With
+  // per-rank dumps ordered by rank this directly names the straggler.
+  size_t lastStartRank;
+};
+
+// Always-on fixed-capacity ring buffer of recently completed collectives.
+// Recording is a sequence number bump plus a handful of stores under a mutex,
+// cheap relative to any collective, so it stays enabled in production. The
+// base ProcessGroup::Work records into the process-wide instance on
+// completion; dump the buffers of all ranks (e.g. via all_gather_object) and
+// feed them to computeCollectiveSkew() to locate stragglers.
+class TORCH_API FlightRecorder {
+ public:
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  explicit FlightRecorder(size_t capacity = kDefaultCapacity);
+
+  // The process-wide recorder fed by ProcessGroup::Work.
+  static FlightRecorder& get();
+
+  // Returns the sequence number for the next operation.
+  uint64_t nextSeq();
+
+  void record(const FlightRecorderEntry& entry);
+
+  // Returns the retained entries, oldest first.
+  std::vector<FlightRecorderEntry> dump() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<FlightRecorderEntry> entries_;
+  const size_t capacity_;
+  // Index of the slot the next entry goes into.
+  size_t next_ = 0;
+  uint64_t seq_ = 0;
+};
+
+// Cheap monotonic clock used for all flight recorder timestamps.
+TORCH_API int64_t flightRecorderTimeNs();
+
+// Matches entries with equal seq across the per-rank dumps and returns skew
+// statistics, ordered by seq, for every collective present in all dumps.
+// Collectives that some rank has already overwritten (or never finished) are
+// skipped.
+TORCH_API std::vector<CollectiveSkew> computeCollectiveSkew(
+    const std::vector<std::vector<FlightRecorderEntry>>& rankDumps);
+
+} // namespace c10d
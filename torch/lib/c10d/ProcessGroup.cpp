@@ -1,4 +1,5 @@
 #include <ATen/ThreadLocalState.h>
+#include <c10d/FlightRecorder.hpp>
 #include <c10d/ProcessGroup.hpp>
 
 #include <c10/util/Logging.h>
@@ -57,7 +58,17 @@ ProcessGroup::Work::Work(
     OpType opType,
     const char* profilingTitle,
     const c10::optional<std::vector<at::Tensor>>& inputTensors)
-    : rank_(rank), opType_(opType) {
+    : rank_(rank),
+      opType_(opType),
+      flightSeq_(FlightRecorder::get().nextSeq()),
+      flightEnqueueTimeNs_(flightRecorderTimeNs()) {
+  if (inputTensors) {
+    for (const auto& tensor : *inputTensors) {
+      if (tensor.defined() && tensor.has_storage()) {
+        flightBytes_ += tensor.numel() * tensor.element_size();
+      }
+    }
+  }
   if (profilingTitle != nullptr) {
     auto recordingFunction =
         std::make_shared<at::RecordFunction>(at::RecordScope::USER_SCOPE);
@@ -143,10 +154,34 @@ c10::intrusive_ptr<c10::ivalue::Future> ProcessGroup::Work::getFuture() {
   TORCH_CHECK(false, "ProcessGroup::Work::getFuture not implemented.")
 }
 
+void ProcessGroup::Work::recordFlightStart() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (flightStartTimeNs_ == 0) {
+    flightStartTimeNs_ = flightRecorderTimeNs();
+  }
+}
+
+void ProcessGroup::Work::recordFlightEntryLocked() {
+  if (flightRecorded_) {
+    return;
+  }
+  flightRecorded_ = true;
+  FlightRecorderEntry entry{};
+  entry.seq = flightSeq_;
+  entry.opType = opType_;
+  entry.bytes = flightBytes_;
+  entry.enqueueTimeNs = flightEnqueueTimeNs_;
+  entry.startTimeNs =
+      flightStartTimeNs_ != 0 ? flightStartTimeNs_ : flightEnqueueTimeNs_;
+  entry.endTimeNs = flightRecorderTimeNs();
+  FlightRecorder::get().record(entry);
+}
+
 void ProcessGroup::Work::finish(std::exception_ptr exception) {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_ = true;
   exception_ = exception;
+  recordFlightEntryLocked();
   if (recordFunctionEndCallback_) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
@@ -159,6 +194,7 @@ void ProcessGroup::Work::finishAndThrow(std::exception_ptr exception) {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_ = true;
   exception_ = exception;
+  recordFlightEntryLocked();
   if (recordFunctionEndCallback_) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
@@ -154,6 +154,18 @@ class ProcessGroup : public torch::CustomClassHolder {
     // provided by the user.
     void finishAndThrow(std::exception_ptr exception);
 
+    // Stamps the flight recorder start time, i.e. the moment the backend
+    // actually began executing the op (as opposed to when it was enqueued).
+    // Optional; when never called the enqueue time is used instead.
+    void recordFlightStart();
+
+    // Records this work into the process-wide FlightRecorder. Safe to call
+    // repeatedly; only the first call records. Must be called with mutex_
+    // held. finish() and finishAndThrow() call this; backends that complete
+    // work without going through either (e.g. by polling device events) call
+    // it themselves.
+    void recordFlightEntryLocked();
+
     mutable std::mutex mutex_;
     std::condition_variable cv_;
     bool completed_ = false;
@@ -168,6 +180,15 @@ class ProcessGroup : public torch::CustomClassHolder {
     // When profiling, the callback to record end of operation event. This
     // callback needs to be called when collective operation is complete.
     std::function<void()> recordFunctionEndCallback_;
+
+    // Flight recorder bookkeeping; see FlightRecorder.hpp. The sequence
+    // number and enqueue time are stamped at construction, the rest as the
+    // op progresses.
+    uint64_t flightSeq_;
+    int64_t flightBytes_ = 0;
+    int64_t flightEnqueueTimeNs_;
+    int64_t flightStartTimeNs_ = 0;
+    bool flightRecorded_ = false;
   };
 
   // ProcessGroup Options is a base struct that defines the basic options
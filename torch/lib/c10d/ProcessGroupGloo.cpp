@@ -929,6 +929,68 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
   std::vector<at::Tensor> outputs_;
 };
 
+// Buckets below this size are not worth splitting: the per-chunk latency
+// costs more than the pipelining saves.
+constexpr int64_t kMinAllreduceChunkBytes = 1024 * 1024;
+
+// Ties together the per-chunk works of a chunked allreduce. The chunks are
+// enqueued as independent works with their own tags, so the worker threads
+// execute them concurrently: while one chunk runs its local reduction the
+// others are on the wire, and with multiple contexts each chunk uses its own
+// connections to every peer. The caller sees a single Work for the whole
+// tensor, completed when every chunk is.
+class ChunkedAllreduceWork : public ProcessGroup::Work {
+ public:
+  ChunkedAllreduceWork(
+      std::vector<c10::intrusive_ptr<ProcessGroupGloo::AsyncWork>> chunkWorks,
+      std::vector<at::Tensor> outputs)
+      : ProcessGroup::Work(
+            -1,
+            OpType::ALLREDUCE,
+            "gloo:chunked_all_reduce",
+            outputs),
+        chunkWorks_(std::move(chunkWorks)),
+        outputs_(std::move(outputs)) {}
+
+  bool isCompleted() override {
+    for (auto& work : chunkWorks_) {
+      if (!work->isCompleted()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isSuccess() const override {
+    for (auto& work : chunkWorks_) {
+      if (!work->isSuccess()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool wait(std::chrono::milliseconds timeout) override {
+    bool completed = true;
+    for (auto& work : chunkWorks_) {
+      completed &= work->wait(timeout);
+    }
+    return completed;
+  }
+
+  std::vector<at::Tensor> result() override {
+    TORCH_CHECK(
+        isCompleted(),
+        "Work needs to be completed before calling result(). "
+        "Should call wait() before result().");
+    return outputs_;
+  }
+
+ private:
+  std::vector<c10::intrusive_ptr<ProcessGroupGloo::AsyncWork>> chunkWorks_;
+  std::vector<at::Tensor> outputs_;
+};
+
 class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
  public:
   AsyncAllreduceCoalescedWork(
@@ -1389,6 +1451,35 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
         "(allreduce of sparse tensors only works with ReduceOp.SUM)");
   }
 
+  // Large dense CPU buckets are split into chunks that run as independent
+  // works: the worker threads overlap local reduction and transmission
+  // across chunks, which a single monolithic gloo operation cannot do.
+  if (device.type() == at::kCPU && layout == c10::kStrided &&
+      inputs.size() == 1 && inputs[0].is_contiguous()) {
+    const int64_t bytes = inputs[0].numel() * inputs[0].element_size();
+    const int64_t numChunks = std::min<int64_t>(
+        options_->threads, bytes / kMinAllreduceChunkBytes);
+    if (numChunks >= 2) {
+      auto flat = inputs[0].view({-1});
+      const int64_t numel = flat.numel();
+      const int64_t chunkSize = (numel + numChunks - 1) / numChunks;
+      std::vector<c10::intrusive_ptr<AsyncWork>> chunkWorks;
+      chunkWorks.reserve(numChunks);
+      for (int64_t offset = 0; offset < numel; offset += chunkSize) {
+        std::vector<at::Tensor> chunk = {
+            flat.narrow(0, offset, std::min(chunkSize, numel - offset))};
+        auto chunkTag = nextTag();
+        chunkWorks.push_back(c10::make_intrusive<AsyncAllreduceWork>(
+            getContext(chunkTag), chunk, opts.reduceOp, chunkTag));
+      }
+      for (auto& chunkWork : chunkWorks) {
+        enqueue(chunkWork);
+      }
+      return c10::make_intrusive<ChunkedAllreduceWork>(
+          std::move(chunkWorks), inputs);
+    }
+  }
+
   c10::intrusive_ptr<AsyncWork> work;
   auto tag = nextTag();
   auto context = getContext(tag);
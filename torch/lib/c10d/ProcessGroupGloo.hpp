@@ -80,6 +80,7 @@ class ProcessGroupGloo : public ProcessGroup {
     static void execute(c10::intrusive_ptr<AsyncWork> work) {
       std::exception_ptr eptr;
       try {
+        work->recordFlightStart();
         work->run();
       } catch (...) {
         eptr = std::current_exception();
@@ -0,0 +1,208 @@
+#include <c10d/ProcessGroupHierarchical.hpp>
+
+namespace c10d {
+
+ProcessGroupHierarchical::ProcessGroupHierarchical(
+    int rank,
+    int size,
+    c10::intrusive_ptr<ProcessGroup> intraGroup,
+    c10::intrusive_ptr<ProcessGroup> interGroup)
+    : ProcessGroup(rank, size),
+      intraGroup_(std::move(intraGroup)),
+      interGroup_(std::move(interGroup)) {
+  TORCH_CHECK(intraGroup_, "intra-node process group must not be null");
+  TORCH_CHECK(interGroup_, "inter-node process group must not be null");
+  // Every rank belongs to exactly one intra-node group (its node) and one
+  // inter-node group (the ranks at the same position on every node), so
+  // together the two must tile the global group.
+  TORCH_CHECK(
+      intraGroup_->getSize() * interGroup_->getSize() == size_,
+      "intra-node size (",
+      intraGroup_->getSize(),
+      ") times inter-node size (",
+      interGroup_->getSize(),
+      ") must equal the global size (",
+      size_,
+      ")");
+}
+
+ProcessGroupHierarchical::~ProcessGroupHierarchical() {}
+
+c10::intrusive_ptr<ProcessGroup::Work>
+ProcessGroupHierarchical::allreduceOneTensor(
+    at::Tensor& tensor,
+    const AllreduceOptions& opts) {
+  const auto intraSize = static_cast<int64_t>(intraGroup_->getSize());
+  const auto numel = tensor.numel();
+
+  // The intra-node reduce-scatter needs one equally sized chunk per local
+  // rank. Reduce in place when the tensor splits evenly; otherwise stage
+  // through a padded flat buffer.
+  at::Tensor flat;
+  const bool staged = !tensor.is_contiguous() || numel % intraSize != 0;
+  if (staged) {
+    const auto paddedNumel = (numel + intraSize - 1) / intraSize * intraSize;
+    flat = at::empty({paddedNumel}, tensor.options());
+    flat.narrow(0, 0, numel).copy_(tensor.reshape({numel}));
+    if (paddedNumel != numel) {
+      flat.narrow(0, numel, paddedNumel - numel).zero_();
+    }
+  } else {
+    flat = tensor.view({numel});
+  }
+  auto chunks = flat.chunk(intraSize);
+  auto myChunk = chunks[intraGroup_->getRank()];
+
+  ReduceScatterOptions reduceScatterOpts;
+  reduceScatterOpts.reduceOp = opts.reduceOp;
+  reduceScatterOpts.timeout = opts.timeout;
+  std::vector<at::Tensor> scatterOutputs = {myChunk};
+  std::vector<std::vector<at::Tensor>> scatterInputs = {
+      std::vector<at::Tensor>(chunks.begin(), chunks.end())};
+  intraGroup_->reduce_scatter(scatterOutputs, scatterInputs, reduceScatterOpts)
+      ->wait();
+
+  AllreduceOptions allreduceOpts;
+  allreduceOpts.reduceOp = opts.reduceOp;
+  allreduceOpts.timeout = opts.timeout;
+  std::vector<at::Tensor> interTensors = {myChunk};
+  interGroup_->allreduce(interTensors, allreduceOpts)->wait();
+
+  AllgatherOptions allgatherOpts;
+  allgatherOpts.timeout = opts.timeout;
+  std::vector<std::vector<at::Tensor>> gatherOutputs = {
+      std::vector<at::Tensor>(chunks.begin(), chunks.end())};
+  std::vector<at::Tensor> gatherInputs = {myChunk};
+  auto work =
+      intraGroup_->allgather(gatherOutputs, gatherInputs, allgatherOpts);
+  if (staged) {
+    work->wait();
+    tensor.copy_(flat.narrow(0, 0, numel).view_as(tensor));
+  }
+  return work;
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::allreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  // Degenerate layouts fall through to the only level that has peers.
+  if (intraGroup_->getSize() == 1) {
+    return interGroup_->allreduce(tensors, opts);
+  }
+  if (interGroup_->getSize() == 1) {
+    return intraGroup_->allreduce(tensors, opts);
+  }
+  c10::intrusive_ptr<ProcessGroup::Work> work;
+  for (auto& tensor : tensors) {
+    if (work) {
+      work->wait();
+    }
+    work = allreduceOneTensor(tensor, opts);
+  }
+  return work;
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::broadcast(
+    std::vector<at::Tensor>& /* unused */,
+    const BroadcastOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support broadcast");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work>
+ProcessGroupHierarchical::allreduce_coalesced(
+    std::vector<at::Tensor>& /* unused */,
+    const AllreduceCoalescedOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support allreduce_coalesced");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::reduce(
+    std::vector<at::Tensor>& /* unused */,
+    const ReduceOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support reduce");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::allgather(
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    std::vector<at::Tensor>& /* unused */,
+    const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support allgather");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::_allgather_base(
+    at::Tensor& /* unused */,
+    at::Tensor& /* unused */,
+    const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support _allgather_base");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work>
+ProcessGroupHierarchical::allgather_coalesced(
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    std::vector<at::Tensor>& /* unused */,
+    const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support allgather_coalesced");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::gather(
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    std::vector<at::Tensor>& /* unused */,
+    const GatherOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support gather");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::scatter(
+    std::vector<at::Tensor>& /* unused */,
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    const ScatterOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support scatter");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::reduce_scatter(
+    std::vector<at::Tensor>& /* unused */,
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    const ReduceScatterOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support reduce_scatter");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::alltoall_base(
+    at::Tensor& /* unused */,
+    at::Tensor& /* unused */,
+    std::vector<int64_t>& /* unused */,
+    std::vector<int64_t>& /* unused */,
+    const AllToAllOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support alltoall_base");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::send(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support send");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::recv(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support recv");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::recvAnysource(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support recv");
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupHierarchical::barrier(
+    const BarrierOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support barrier");
+}
+
+} // namespace c10d
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <c10d/ProcessGroup.hpp>
+
+namespace c10d {
+
+constexpr const char* HIERARCHICAL_BACKEND_NAME = "hierarchical";
+
+// ProcessGroupHierarchical implements a two-level allreduce.
+//
+// It is constructed from two child process groups: an intra-node group
+// containing the ranks that share a node, and an inter-node group containing
+// one rank per node (the ranks with the same intra-node rank on every node).
+// allreduce is decomposed into an intra-node reduce-scatter, an inter-node
+// allreduce of this rank's shard, and an intra-node allgather. On clusters
+// with fast intra-node links (e.g. NVLink) this uses the cross-node network
+// far more efficiently than a flat ring over all ranks.
+//
+// The phases depend on each other, so unlike the plain backends the
+// intermediate steps are waited on inside the call; only the final
+// allgather's work object is returned (already in flight or completed).
+//
+// All functions of the class are expected to be called in the same order
+// across all processes in the process group. This is the only way that we
+// can guarantee to match up the same calls among all processes.
+//
+class ProcessGroupHierarchical final : public ProcessGroup {
+ public:
+  ProcessGroupHierarchical(
+      int rank,
+      int size,
+      c10::intrusive_ptr<ProcessGroup> intraGroup,
+      c10::intrusive_ptr<ProcessGroup> interGroup);
+
+  ~ProcessGroupHierarchical() override;
+
+  const std::string getBackendName() const override {
+    return std::string(HIERARCHICAL_BACKEND_NAME);
+  }
+
+  c10::intrusive_ptr<ProcessGroup::Work> broadcast(
+      std::vector<at::Tensor>& tensors,
+      const BroadcastOptions& opts = BroadcastOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> allreduce(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts = AllreduceOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> allreduce_coalesced(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceCoalescedOptions& opts =
+          AllreduceCoalescedOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> reduce(
+      std::vector<at::Tensor>& tensors,
+      const ReduceOptions& opts = ReduceOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> allgather(
+      std::vector<std::vector<at::Tensor>>& outputs,
+      std::vector<at::Tensor>& inputs,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> _allgather_base(
+      at::Tensor& outputBuffer,
+      at::Tensor& inputBuffer,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> allgather_coalesced(
+      std::vector<std::vector<at::Tensor>>& outputTensorLists,
+      std::vector<at::Tensor>& inputTensors,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> gather(
+      std::vector<std::vector<at::Tensor>>& outputs,
+      std::vector<at::Tensor>& inputs,
+      const GatherOptions& opts = GatherOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> scatter(
+      std::vector<at::Tensor>& outputs,
+      std::vector<std::vector<at::Tensor>>& inputs,
+      const ScatterOptions& opts = ScatterOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> reduce_scatter(
+      std::vector<at::Tensor>& outputs,
+      std::vector<std::vector<at::Tensor>>& inputs,
+      const ReduceScatterOptions& opts = ReduceScatterOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> alltoall_base(
+      at::Tensor& outputTensor,
+      at::Tensor& inputTensor,
+      std::vector<int64_t>& outputSplitSizes,
+      std::vector<int64_t>& inputSplitSizes,
+      const AllToAllOptions& opts = AllToAllOptions()) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> send(
+      std::vector<at::Tensor>& tensors,
+      int dstRank,
+      int tag) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> recv(
+      std::vector<at::Tensor>& tensors,
+      int srcRank,
+      int tag) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> recvAnysource(
+      std::vector<at::Tensor>& tensors,
+      int tag) override;
+
+  c10::intrusive_ptr<ProcessGroup::Work> barrier(
+      const BarrierOptions& opts = BarrierOptions()) override;
+
+ private:
+  // Runs the reduce-scatter / allreduce / allgather decomposition for a
+  // single tensor and returns the final allgather's work object.
+  c10::intrusive_ptr<ProcessGroup::Work> allreduceOneTensor(
+      at::Tensor& tensor,
+      const AllreduceOptions& opts);
+
+  c10::intrusive_ptr<ProcessGroup> intraGroup_;
+  c10::intrusive_ptr<ProcessGroup> interGroup_;
+};
+
+} // namespace c10d
@@ -1,6 +1,7 @@
 #include <c10d/ProcessGroupNCCL.hpp>
 #include <c10/util/Optional.h>
 
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <tuple>
@@ -114,6 +115,32 @@ std::string getKeyFromDevices(const std::vector<at::Device>& devices) {
   return deviceList;
 }
 
+// Process-wide cache of NCCL communicators that outlives individual
+// ProcessGroupNCCL instances (see NCCL_PERSISTENT_COMM). Keyed by
+// "<comm world size>:<comm rank>:<device list>"; the original ncclUniqueId
+// is kept so that ranks can verify through the store that they are all
+// reusing members of the same communicator clique before skipping
+// ncclCommInitRank.
+struct CachedNCCLComms {
+  ncclUniqueId ncclId;
+  std::vector<std::shared_ptr<NCCLComm>> comms;
+};
+
+std::mutex ncclCommCacheMutex;
+
+std::unordered_map<std::string, CachedNCCLComms>& ncclCommCache() {
+  static std::unordered_map<std::string, CachedNCCLComms> cache;
+  return cache;
+}
+
+std::string getNcclCommCacheKey(
+    int worldSize,
+    int rank,
+    const std::string& devicesKey) {
+  return std::to_string(worldSize) + ":" + std::to_string(rank) + ":" +
+      devicesKey;
+}
+
 std::string getKeySendRecv(int myRank, int peer) {
   int lowRank = myRank < peer ? myRank : peer;
   int highRank = myRank < peer ? peer : myRank;
@@ -202,6 +229,10 @@ const int64_t ProcessGroupNCCL::kWatchdogThreadSleepMillis = 10000;
 const int64_t ProcessGroupNCCL::kWorkCleanupThreadSleepMillis = 1000;
 constexpr int64_t kWaitForAbortCommStoreKey = 1000;
 constexpr int64_t kSynchronizeBusyWaitMillis = 10;
+// Initial poll interval for blocking waits; doubles up to
+// kSynchronizeBusyWaitMillis so short collectives complete with
+// microsecond-scale wait latency.
+constexpr int64_t kSynchronizeBusyWaitMicrosMin = 50;
 thread_local uint64_t ProcessGroupNCCL::ncclActiveGroupCounter_ = 0;
 
 std::ostream& operator<<(
@@ -256,7 +287,16 @@ ProcessGroupNCCL::WorkNCCL::~WorkNCCL() {}
 
 bool ProcessGroupNCCL::WorkNCCL::isCompleted() {
   checkAndSetException();
-  return exception() || finishedGPUExecutionInternal();
+  bool completed = exception() || finishedGPUExecutionInternal();
+  if (completed) {
+    // WorkNCCL never goes through finish(); record into the flight recorder
+    // on the first observed completion instead. The end time reflects when
+    // the host noticed the GPU was done, so it is only as fresh as the
+    // caller's polling interval.
+    std::lock_guard<std::mutex> lock(mutex_);
+    recordFlightEntryLocked();
+  }
+  return completed;
 }
 
 bool ProcessGroupNCCL::WorkNCCL::isSuccess() const {
@@ -356,7 +396,10 @@ void ProcessGroupNCCL::WorkNCCL::synchronizeInternal(
     // opTimeout for each WorkNCCL object.
     std::chrono::milliseconds workTimeout =
         timeout == kNoTimeout ? opTimeout_ : timeout;
-    // Wait for the operation to complete.
+    // Wait for the operation to complete, polling with exponential backoff
+    // so the latency of short collectives is bounded by the GPU rather than
+    // a fixed sleep interval.
+    auto backoff = std::chrono::microseconds(kSynchronizeBusyWaitMicrosMin);
     while (!isCompleted()) {
       if (timedOut()) {
         // When operation times out due to some errors that are not
@@ -395,8 +438,10 @@ void ProcessGroupNCCL::WorkNCCL::synchronizeInternal(
       }
       // Check for errors and throw appropriate exception.
       checkAndThrowException();
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(kSynchronizeBusyWaitMillis));
+      std::this_thread::sleep_for(backoff);
+      backoff = std::min(
+          backoff * 2,
+          std::chrono::microseconds(kSynchronizeBusyWaitMillis * 1000));
     }
     checkAndThrowException();
   }
@@ -451,6 +496,7 @@ ProcessGroupNCCL::ProcessGroupNCCL(
     "ProcessGroupNCCL is only supported with GPUs, no GPUs found!");
   blockingWait_ = parseEnvVarFlag(NCCL_BLOCKING_WAIT);
   asyncErrorHandling_ = parseEnvVarFlag(NCCL_ASYNC_ERROR_HANDLING);
+  persistentComms_ = parseEnvVarFlag(NCCL_PERSISTENT_COMM);
 
   if (blockingWait_ && asyncErrorHandling_) {
     LOG(INFO) << "[Rank " << rank_
@@ -482,7 +528,18 @@ ProcessGroupNCCL::ProcessGroupNCCL(
             << "\nTIMEOUT(ms): " << options_->timeout.count()
             << "\nUSE_HIGH_PRIORITY_STREAM: "
             << options_->is_high_priority_stream
+            << "\nNCCL_PERSISTENT_COMM: " << persistentComms_
             << "\nNCCL_DEBUG: " << ncclDebugLevel;
+
+  if (parseEnvVarFlag(NCCL_EAGER_INIT)) {
+    // Create the communicator for the current device now, while all ranks
+    // are known to be inside process group creation, instead of lazily on
+    // the first collective. Together with NCCL_PERSISTENT_COMM this makes
+    // restarts pay the ncclCommInitRank cost at rendezvous at most once.
+    std::vector<at::Device> devices = {
+        at::Device(at::kCUDA, at::cuda::current_device())};
+    getNCCLComm(getKeyFromDevices(devices), devices, OpType::ALLREDUCE);
+  }
 }
 
 void ProcessGroupNCCL::setSequenceNumberForGroup() {
@@ -524,12 +581,43 @@ ProcessGroupNCCL::~ProcessGroupNCCL() {
     workCleanupThread_.join();
   }
 
+  // Free any work that was staged after the cleanup loop's final drain.
+  auto* node = pendingWorkHead_.exchange(nullptr);
+  while (node != nullptr) {
+    auto* prev = node;
+    node = node->next;
+    delete prev;
+  }
+
   {
     // Abort all NCCL Communicators on Process Group Destruction
     std::lock_guard<std::mutex> lock(mutex_);
     for (auto & it : devNCCLCommMap_) {
       auto& ncclComms = it.second;
 
+      // With NCCL_PERSISTENT_COMM, park healthy communicators in the
+      // process-wide cache instead of aborting them, so a subsequently
+      // created process group over the same ranks and devices can reuse
+      // them and skip ncclCommInitRank entirely.
+      if (persistentComms_) {
+        bool healthy = true;
+        for (const auto& ncclComm : ncclComms) {
+          if (ncclComm->isAborted()) {
+            healthy = false;
+            break;
+          }
+        }
+        if (healthy) {
+          std::lock_guard<std::mutex> cacheLock(ncclCommCacheMutex);
+          CachedNCCLComms entry;
+          entry.ncclId = ncclComms[0]->getNcclId();
+          entry.comms = ncclComms;
+          ncclCommCache()[getNcclCommCacheKey(size_, rank_, it.first)] =
+              std::move(entry);
+          continue;
+        }
+      }
+
       for (const auto& ncclComm : ncclComms) {
         ncclComm->ncclCommAbort();
       }
@@ -720,10 +808,35 @@ void ProcessGroupNCCL::workCleanupLoop() {
           std::chrono::milliseconds(kWorkCleanupThreadSleepMillis),
           [&]() -> bool { return terminateProcessGroup_.load(); });
 
+      // Drain the lock-free staging stack into the shared list. The stack
+      // is LIFO, so prepend while unlinking to restore enqueue order.
+      auto* node = pendingWorkHead_.exchange(nullptr, std::memory_order_acquire);
+      std::list<WorkNCCL> newWorks;
+      while (node != nullptr) {
+        newWorks.emplace_front(std::move(node->work));
+        auto* prev = node;
+        node = node->next;
+        delete prev;
+      }
+      workMetaList_.splice(workMetaList_.end(), newWorks);
+
+      bool sawIncomplete = false;
       for (auto it = workMetaList_.begin(); it != workMetaList_.end();
            /* no increment*/) {
         auto& work = *it;
-        if (work.isCompleted()) {
+        bool completed;
+        if (!sawIncomplete) {
+          completed = work.isCompleted();
+          sawIncomplete = !completed;
+        } else {
+          // NCCL kernels on a stream finish in issue order, so once the
+          // oldest outstanding work is still pending there is little point
+          // querying the CUDA events of newer ones; keep surfacing async
+          // communicator errors, which needs no event query.
+          work.checkAndSetException();
+          completed = static_cast<bool>(work.exception());
+        }
+        if (completed) {
           // Handle Exceptions on failed GPU operations and remove completed
           // workNCCL objects from work vector.
           if (!terminateProcessGroup_.load()) {
@@ -829,6 +942,84 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
     }
   }
 
+  // With NCCL_PERSISTENT_COMM, a previous process group over the same ranks
+  // and devices may have parked its communicators in the process-wide cache
+  // when it was destroyed. Reusing them requires unanimous consent: every
+  // rank must hold a cached entry carrying the same ncclUniqueId, otherwise
+  // the parked clique is incomplete and ncclCommInitRank has to run again.
+  // Consensus is reached through the store, mirroring how the unique id
+  // itself is broadcast below.
+  if (persistentComms_ && !isP2POp(opType)) {
+    const std::string cacheKey =
+        getNcclCommCacheKey(size_, rank_, devicesKey);
+    const std::string seqKey = std::to_string(ncclCommCounter_);
+    c10::optional<CachedNCCLComms> cached;
+    {
+      std::lock_guard<std::mutex> cacheLock(ncclCommCacheMutex);
+      auto it = ncclCommCache().find(cacheKey);
+      if (it != ncclCommCache().end()) {
+        cached = it->second;
+      }
+    }
+    if (rank_ == 0) {
+      store_->set(
+          seqKey + "_reuse",
+          std::vector<uint8_t>{cached ? uint8_t(1) : uint8_t(0)});
+      if (cached) {
+        auto idBytes = reinterpret_cast<uint8_t*>(&cached->ncclId);
+        store_->set(
+            seqKey + "_reuse_id",
+            std::vector<uint8_t>(idBytes, idBytes + NCCL_UNIQUE_ID_BYTES));
+      }
+    }
+    auto reuseFlag = store_->get(seqKey + "_reuse");
+    if (!reuseFlag.empty() && reuseFlag[0] == 1) {
+      auto idVec = store_->get(seqKey + "_reuse_id");
+      TORCH_CHECK(idVec.size() == NCCL_UNIQUE_ID_BYTES);
+      bool hit = cached &&
+          std::memcmp(&cached->ncclId, idVec.data(), NCCL_UNIQUE_ID_BYTES) ==
+              0;
+      store_->add(seqKey + "_reuse_votes", hit ? 1 : 0);
+      store_->add(seqKey + "_reuse_voters", 1);
+      while (store_->add(seqKey + "_reuse_voters", 0) < size_) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      if (store_->add(seqKey + "_reuse_votes", 0) == size_) {
+        // Every rank still holds the matching communicators. Adopt them and
+        // bump the counter so the broadcast key sequence stays aligned with
+        // groups that went through the fresh-id path.
+        ncclCommCounter_++;
+        {
+          std::lock_guard<std::mutex> cacheLock(ncclCommCacheMutex);
+          ncclCommCache().erase(cacheKey);
+        }
+        std::vector<at::cuda::CUDAStream> reuseStreams;
+        reuseStreams.reserve(devices.size());
+        for (size_t i = 0; i < devices.size(); ++i) {
+          reuseStreams.push_back(
+              at::cuda::getStreamFromPool(options_->is_high_priority_stream));
+        }
+        ncclStreams_.emplace(devicesKey, std::move(reuseStreams));
+        ncclEvents_.emplace(
+            std::piecewise_construct,
+            std::make_tuple(devicesKey),
+            std::make_tuple(devices.size()));
+        std::lock_guard<std::mutex> lock(mutex_);
+        ncclIdToCommMap_.emplace(
+            buildNcclUniqueIdStr(cached->ncclId), cached->comms);
+        devNCCLCommMap_.emplace(devicesKey, std::move(cached->comms));
+        return devNCCLCommMap_[devicesKey];
+      }
+    }
+    if (cached) {
+      // Membership changed, so the parked communicators can never form a
+      // complete clique again. Drop the entry; releasing the last reference
+      // destroys the communicators.
+      std::lock_guard<std::mutex> cacheLock(ncclCommCacheMutex);
+      ncclCommCache().erase(cacheKey);
+    }
+  }
+
   // NCCL communicator not cached, create a new entry
   std::vector<std::shared_ptr<NCCLComm>> ncclComms;
   ncclComms.resize(devices.size());
@@ -1048,12 +1239,22 @@ c10::intrusive_ptr<c10::ivalue::Future> ProcessGroupNCCL::WorkNCCL::
 void ProcessGroupNCCL::workEnqueue(
     c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL> work) {
   if (!terminateProcessGroup_.load()) {
-    std::lock_guard<std::mutex> lock(workMetaListMutex_);
     // Avoid view tensors to be processed in cleanup thread.
     // View tensors' destruction invokes autograd_meta, which
     // needs to be destructed in user thread. Otherwise will
     // get deadlock. Here we enqueue work without outputs_.
-    workMetaList_.emplace_back(WorkNCCL(*work));
+    //
+    // Push onto the lock-free staging stack so that enqueueing a collective
+    // never waits behind the cleanup loop's event-query scan, which can hold
+    // workMetaListMutex_ for a while when many works are outstanding.
+    auto* node = new PendingWorkNode(WorkNCCL(*work));
+    node->next = pendingWorkHead_.load(std::memory_order_relaxed);
+    while (!pendingWorkHead_.compare_exchange_weak(
+        node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    // Wake the cleanup loop so completed work gets retired promptly instead
+    // of on the next fixed-interval wakeup.
+    workMetaListCV_.notify_one();
   }
 }
 
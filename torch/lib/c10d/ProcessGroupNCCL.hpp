@@ -32,6 +32,19 @@ constexpr const char* NCCL_BLOCKING_WAIT = "NCCL_BLOCKING_WAIT";
 // Handling with NCCL.
 constexpr const char* NCCL_ASYNC_ERROR_HANDLING = "NCCL_ASYNC_ERROR_HANDLING";
 
+// Environment variable which controls whether healthy NCCL communicators are
+// parked in a process-wide cache on ProcessGroup destruction and reused by a
+// later ProcessGroupNCCL with the same (world size, rank, device set),
+// instead of being aborted. Skips the multi-second ncclCommInitRank on
+// elastic restarts and subgroup churn.
+constexpr const char* NCCL_PERSISTENT_COMM = "NCCL_PERSISTENT_COMM";
+
+// Environment variable which controls whether the NCCL communicator for the
+// current CUDA device is created eagerly in the ProcessGroupNCCL constructor
+// (i.e. during rendezvous) rather than lazily on the first collective. The
+// CUDA device must be set before the process group is created.
+constexpr const char* NCCL_EAGER_INIT = "NCCL_EAGER_INIT";
+
 constexpr const char* NCCL_BACKEND_NAME = "nccl";
 
 // ProcessGroupNCCL implements NCCL bindings for c10d.
@@ -501,6 +514,17 @@ class ProcessGroupNCCL : public ProcessGroup {
   // Vector to Store WorkNCCL pointers
   std::list<ProcessGroupNCCL::WorkNCCL> workMetaList_;
 
+  // Node of the lock-free MPSC staging stack for newly enqueued work.
+  // Collective-issuing threads push here without taking workMetaListMutex_,
+  // so enqueueing never blocks behind the cleanup loop's scan; the cleanup
+  // loop drains the stack into workMetaList_ in enqueue order.
+  struct PendingWorkNode {
+    explicit PendingWorkNode(WorkNCCL work) : work(std::move(work)) {}
+    WorkNCCL work;
+    PendingWorkNode* next{nullptr};
+  };
+  std::atomic<PendingWorkNode*> pendingWorkHead_{nullptr};
+
   // Add Work Pointer to workVector
   void workEnqueue(c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL>);
 
@@ -542,6 +566,10 @@ class ProcessGroupNCCL : public ProcessGroup {
   // handling.
   bool asyncErrorHandling_ = false;
 
+  // Whether healthy communicators survive this process group's destruction
+  // in the process-wide communicator cache. See NCCL_PERSISTENT_COMM.
+  bool persistentComms_ = false;
+
   // Set of communicators that this process group has aborted and their
   // ncclUniqueId has been written to the store. We don't need a lock
   // for this map since only the watchdog thread accesses this set. The
@@ -17,4 +17,58 @@ void Store::setTimeout(const std::chrono::milliseconds& timeout) {
   timeout_ = timeout;
 }
 
+namespace {
+
+// Children per node in the notification tree. Rank r's parent is
+// (r - 1) / kTreeFanout and its children are kTreeFanout * r + 1 .. + 2.
+constexpr int kTreeFanout = 2;
+
+std::string treeKey(const std::string& prefix, const char* phase, int rank) {
+  return prefix + "/" + phase + "/" + std::to_string(rank);
+}
+
+} // namespace
+
+void treeBarrier(
+    Store& store,
+    const std::string& prefix,
+    int rank,
+    int worldSize,
+    const std::chrono::milliseconds& timeout) {
+  TORCH_CHECK(
+      rank >= 0 && rank < worldSize,
+      "treeBarrier: rank ",
+      rank,
+      " is out of bound for world size ",
+      worldSize);
+  if (worldSize == 1) {
+    return;
+  }
+  const std::vector<uint8_t> token = {1};
+
+  // Arrival phase: wait for all children to report, then report to the
+  // parent. After rank 0 passes this phase every rank has arrived.
+  std::vector<std::string> childKeys;
+  for (int i = 1; i <= kTreeFanout; ++i) {
+    const auto child = kTreeFanout * rank + i;
+    if (child < worldSize) {
+      childKeys.push_back(treeKey(prefix, "arrive", child));
+    }
+  }
+  if (!childKeys.empty()) {
+    store.wait(childKeys, timeout);
+  }
+  if (rank != 0) {
+    store.set(treeKey(prefix, "arrive", rank), token);
+    // Release phase: block until the parent propagates rank 0's release
+    // down the tree.
+    store.wait(
+        {treeKey(prefix, "release", (rank - 1) / kTreeFanout)}, timeout);
+  }
+  // Leaves have nobody to release.
+  if (!childKeys.empty()) {
+    store.set(treeKey(prefix, "release", rank), token);
+  }
+}
+
 } // namespace c10d
@@ -80,4 +80,21 @@ class Store : public torch::CustomClassHolder {
   std::chrono::milliseconds timeout_;
 };
 
+// Performs a barrier across worldSize participants using a k-ary notification
+// tree layered on top of any Store implementation. Instead of every rank
+// waiting on a single key owned by rank 0 -- which makes the store master
+// answer O(worldSize) waiters per barrier -- each rank only waits on its
+// parent's release key and on the arrival keys of its (at most fanout)
+// children, so per-rank store traffic stays constant and the critical path
+// grows as log(worldSize).
+//
+// The prefix must be unique per barrier invocation (e.g. include a sequence
+// number); keys written under it are not cleaned up.
+void treeBarrier(
+    Store& store,
+    const std::string& prefix,
+    int rank,
+    int worldSize,
+    const std::chrono::milliseconds& timeout = Store::kDefaultTimeout);
+
 } // namespace c10d
@@ -8,8 +8,14 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#endif
+
 #include <fcntl.h>
 #include <algorithm>
+#include <array>
 #include <system_error>
 
 namespace c10d {
@@ -244,27 +250,7 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       tcputil::closeSocket(fds[fdIdx].fd);
 
       // Remove all the tracking state of the close FD
-      for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
-        for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
-          if (*vecIt == fds[fdIdx].fd) {
-            vecIt = it->second.erase(vecIt);
-          } else {
-            ++vecIt;
-          }
-        }
-        if (it->second.size() == 0) {
-          it = waitingSockets_.erase(it);
-        } else {
-          ++it;
-        }
-      }
-      for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
-        if (it->first == fds[fdIdx].fd) {
-          it = keysAwaited_.erase(it);
-        } else {
-          ++it;
-        }
-      }
+      clearSocketWaitState(fds[fdIdx].fd);
       fds.erase(fds.begin() + fdIdx);
       sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
       --fdIdx;
@@ -273,6 +259,47 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
   }
 }
 
+void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.size() == 0) {
+      it = waitingSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
+    if (it->first == socket) {
+      it = keysAwaited_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // Also forget any watches the client registered, so later key updates do
+  // not try to notify a closed socket (which would tear down the connection
+  // of whichever client triggered the update).
+  for (auto it = watchedSockets_.begin(); it != watchedSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.size() == 0) {
+      it = watchedSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 // query communicates with the worker. The format
 // of the query is as follows:
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
@@ -540,6 +567,72 @@ void TCPStoreMasterDaemon::run() {
     queryFds(fds);
   }
 }
+#elif defined(__linux__)
+
+// On Linux the master daemon multiplexes its clients with epoll instead of
+// poll, so each wakeup costs O(ready sockets) rather than O(connected
+// sockets). With thousands of workers hammering the store during rendezvous,
+// the poll-based loop below spends most of its time rebuilding and scanning
+// the pollfd array.
+void TCPStoreMasterDaemon::run() {
+  int epollFd;
+  SYSCHECK_ERR_RETURN_NEG1(epollFd = epoll_create1(EPOLL_CLOEXEC));
+  auto addToEpoll = [epollFd](int fd, uint32_t events) {
+    struct epoll_event ev {};
+    ev.events = events;
+    ev.data.fd = fd;
+    SYSCHECK_ERR_RETURN_NEG1(epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev));
+  };
+  addToEpoll(storeListenSocket_, EPOLLIN);
+  // The control pipe's read end reports EPOLLHUP (always reported, no need
+  // to ask for it) once the write end is closed to stop the daemon.
+  addToEpoll(controlPipeFd_[0], 0);
+
+  std::array<struct epoll_event, 64> events{};
+  bool finished = false;
+  while (!finished) {
+    int numReady;
+    SYSCHECK_ERR_RETURN_NEG1(
+        numReady = epoll_wait(epollFd, events.data(), events.size(), -1));
+    for (int i = 0; i < numReady; i++) {
+      const int readyFd = events[i].data.fd;
+      if (readyFd == controlPipeFd_[0]) {
+        // The pipe receives an event which tells us to shutdown the daemon
+        finished = true;
+        break;
+      }
+      if (readyFd == storeListenSocket_) {
+        // The listening socket should now be able to accept new connections.
+        int sockFd = std::get<0>(tcputil::accept(storeListenSocket_));
+        sockets_.push_back(sockFd);
+        addToEpoll(sockFd, EPOLLIN);
+        continue;
+      }
+      try {
+        // Drain every request the client has already pipelined onto the
+        // socket, so a burst of get/set traffic costs one wakeup instead of
+        // one wakeup per request.
+        int pendingBytes = 0;
+        do {
+          query(readyFd);
+          SYSCHECK_ERR_RETURN_NEG1(ioctl(readyFd, FIONREAD, &pendingBytes));
+        } while (pendingBytes > 0);
+      } catch (...) {
+        // See the comment in queryFds: an exception here almost always means
+        // the client closed its connection, so drop the socket and all state
+        // that refers to it and keep serving the remaining clients.
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, readyFd, nullptr);
+        tcputil::closeSocket(readyFd);
+        clearSocketWaitState(readyFd);
+        sockets_.erase(
+            std::remove(sockets_.begin(), sockets_.end(), readyFd),
+            sockets_.end());
+      }
+    }
+  }
+  ::close(epollFd);
+}
+
 #else
 
 void TCPStoreMasterDaemon::run() {
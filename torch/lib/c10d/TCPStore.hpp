@@ -75,6 +75,8 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   bool checkKeys(const std::vector<std::string>& keys) const;
   // Helper function to alerts waiting workers, used in setHandler, getHandler
   void wakeupWaitingClients(const std::string& key);
+  // Drops all wait/watch bookkeeping for a disconnected client socket.
+  void clearSocketWaitState(int socket);
   // Helper function used when the key is changed
   // used in setHandler, addHandler, getHandler, deleteHandler
   void sendKeyUpdatesToClients(
@@ -1,23 +1,95 @@
 #include <c10d/comm.hpp>
 
 #include <deque>
+#include <mutex>
 
 #include <ATen/core/functional.h>
 #include <c10d/reducer.hpp>
 #include <torch/csrc/jit/python/pybind_utils.h>
-#include <torch/csrc/utils/tensor_flatten.h>
 
 namespace c10d {
 namespace {
 
+// Staging buffers retained between broadcast_coalesced calls so that
+// repeated full-model broadcasts (elastic-worker joins, checkpoint resumes)
+// do not reallocate their flat buffers every time. A buffer is exclusively
+// owned by one BroadcastWork while in use and returned to the pool when the
+// work finishes, so sharing the pool across process groups is safe. With at
+// most two broadcasts in flight per call we never retain more than a couple
+// of buffers per device and dtype.
+constexpr size_t kMaxCachedStagingBuffers = 2;
+
+std::mutex& stagingBufferMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<at::Tensor>& stagingBufferPool() {
+  static std::vector<at::Tensor> pool;
+  return pool;
+}
+
+at::Tensor acquireStagingBuffer(int64_t numel, const at::TensorOptions& options) {
+  {
+    std::lock_guard<std::mutex> lock(stagingBufferMutex());
+    auto& pool = stagingBufferPool();
+    for (auto it = pool.begin(); it != pool.end(); ++it) {
+      if (it->device() == options.device() &&
+          it->scalar_type() == at::typeMetaToScalarType(options.dtype()) &&
+          it->numel() >= numel) {
+        auto buffer = *it;
+        pool.erase(it);
+        return buffer;
+      }
+    }
+  }
+  // Pin CPU staging buffers when CUDA is around so that the copies in and
+  // out of the buffer can be asynchronous.
+  auto allocOptions = options;
+  if (options.device().is_cpu() && at::globalContext().hasCUDA()) {
+    allocOptions = allocOptions.pinned_memory(true);
+  }
+  return at::empty({numel}, allocOptions);
+}
+
+void releaseStagingBuffer(at::Tensor buffer) {
+  std::lock_guard<std::mutex> lock(stagingBufferMutex());
+  auto& pool = stagingBufferPool();
+  size_t cached = 0;
+  for (const auto& t : pool) {
+    if (t.device() == buffer.device() &&
+        t.scalar_type() == buffer.scalar_type()) {
+      cached++;
+    }
+  }
+  if (cached < kMaxCachedStagingBuffers) {
+    pool.push_back(std::move(buffer));
+  }
+}
+
 class BroadcastWork {
  public:
   BroadcastWork(
       const c10::intrusive_ptr<c10d::ProcessGroup>& process_group,
       std::vector<at::Tensor> bucket_tensors,
       int root_rank = 0)
-      : bucket_tensors_(std::move(bucket_tensors)),
-        flat_tensor_({torch::utils::flatten_dense_tensors(bucket_tensors_)}) {
+      : bucket_tensors_(std::move(bucket_tensors)) {
+    // Flatten into a pooled staging buffer instead of a freshly allocated
+    // tensor. The copies below overlap with any broadcast that is already in
+    // flight on a different buffer.
+    int64_t total_numel = 0;
+    for (const auto& tensor : bucket_tensors_) {
+      total_numel += tensor.numel();
+    }
+    buffer_ = acquireStagingBuffer(total_numel, bucket_tensors_[0].options());
+    flat_tensor_ = {buffer_.narrow(0, 0, total_numel)};
+    int64_t offset = 0;
+    for (const auto& tensor : bucket_tensors_) {
+      flat_tensor_.front()
+          .narrow(0, offset, tensor.numel())
+          .copy_(tensor.reshape({-1}), /*non_blocking=*/true);
+      offset += tensor.numel();
+    }
     BroadcastOptions broadcastOptions;
     broadcastOptions.rootRank = root_rank;
     work_ = process_group->broadcast(flat_tensor_, broadcastOptions);
@@ -27,12 +99,18 @@ class BroadcastWork {
     work_->wait();
 
     // Copy the output of the broadcast operation back.
-    auto output_tensors = torch::utils::unflatten_dense_tensors(
-        flat_tensor_.front(), bucket_tensors_);
-    TORCH_INTERNAL_ASSERT(output_tensors.size() == bucket_tensors_.size());
-    for (size_t i = 0; i < output_tensors.size(); i++) {
-      bucket_tensors_[i].copy_(output_tensors[i], /*non_blocking=*/true);
+    int64_t offset = 0;
+    for (auto& tensor : bucket_tensors_) {
+      tensor.copy_(
+          flat_tensor_.front()
+              .narrow(0, offset, tensor.numel())
+              .view(tensor.sizes()),
+          /*non_blocking=*/true);
+      offset += tensor.numel();
     }
+    // The copies above are ordered on the buffer's stream before anything a
+    // subsequent owner enqueues, so the buffer can go back to the pool now.
+    releaseStagingBuffer(std::move(buffer_));
   }
 
  protected:
@@ -40,6 +118,10 @@ class BroadcastWork {
   // placed on the same device and have the same dtype.
   std::vector<at::Tensor> bucket_tensors_;
 
+  // The pooled buffer backing flat_tensor_, kept so it can be returned to
+  // the pool once the broadcast finished.
+  at::Tensor buffer_;
+
   // The vector with a single flattened tensor containing the contents
   // of the tensors in bucket_tensors_. It must be stored in a vector
   // because c10d::ProcessGroup::broadcast takes a vector argument.
@@ -86,6 +168,71 @@ void broadcast_coalesced(
   }
 }
 
+std::tuple<at::Tensor, at::Tensor, at::Tensor> sparse_all_to_all(
+    c10::intrusive_ptr<c10d::ProcessGroup> process_group,
+    const at::Tensor& indices,
+    const at::Tensor& rows,
+    int64_t rows_per_rank) {
+  TORCH_CHECK(
+      indices.dim() == 1 && indices.scalar_type() == at::kLong,
+      "indices must be a 1-D int64 tensor");
+  TORCH_CHECK(
+      rows.dim() == 2 && rows.size(0) == indices.numel(),
+      "rows must be a 2-D tensor with one row per index");
+  TORCH_CHECK(rows_per_rank > 0, "rows_per_rank must be positive");
+
+  const auto worldSize = process_group->getSize();
+  if (worldSize == 1) {
+    return std::make_tuple(
+        indices,
+        rows,
+        at::arange(indices.numel(), indices.options()));
+  }
+
+  // Bucket by destination rank and derive the permutation that makes the
+  // send buffers rank-contiguous. Everything stays on the indices' device.
+  auto dstRanks = at::floor_divide(indices, rows_per_rank);
+  at::Tensor sortedDst, perm;
+  std::tie(sortedDst, perm) = dstRanks.sort(0);
+  auto sendCounts = at::bincount(sortedDst, {}, worldSize);
+
+  // Exchange per-rank counts first; equal splits, one slot per rank. The
+  // permutation of the send indices overlaps this round trip.
+  auto recvCounts = at::empty_like(sendCounts);
+  std::vector<int64_t> equalSplits;
+  auto countsWork = process_group->alltoall_base(
+      recvCounts, sendCounts, equalSplits, equalSplits);
+  auto sendIndices = indices.index_select(0, perm);
+  countsWork->wait();
+
+  auto sendCountsCpu = sendCounts.to(at::kCPU);
+  auto recvCountsCpu = recvCounts.to(at::kCPU);
+  std::vector<int64_t> sendSplits(
+      sendCountsCpu.data_ptr<int64_t>(),
+      sendCountsCpu.data_ptr<int64_t>() + worldSize);
+  std::vector<int64_t> recvSplits(
+      recvCountsCpu.data_ptr<int64_t>(),
+      recvCountsCpu.data_ptr<int64_t>() + worldSize);
+  int64_t totalRecv = 0;
+  for (const auto split : recvSplits) {
+    totalRecv += split;
+  }
+
+  // Kick off the index exchange, then permute the (much larger) rows while
+  // it is in flight, then exchange the rows with the same splits.
+  auto recvIndices = at::empty({totalRecv}, indices.options());
+  auto indicesWork = process_group->alltoall_base(
+      recvIndices, sendIndices, recvSplits, sendSplits);
+  auto sendRows = rows.index_select(0, perm);
+  auto recvRows = at::empty({totalRecv, rows.size(1)}, rows.options());
+  auto rowsWork = process_group->alltoall_base(
+      recvRows, sendRows, recvSplits, sendSplits);
+  indicesWork->wait();
+  rowsWork->wait();
+
+  return std::make_tuple(recvIndices, recvRows, perm);
+}
+
 std::vector<at::Tensor> GradBucket::getPerParameterTensors() const {
   std::vector<at::Tensor> per_parameter_tensors;
   size_t num_parameters = offsets_.size();
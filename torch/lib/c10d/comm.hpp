@@ -6,13 +6,33 @@
 
 namespace c10d {
 
+// Default per-bucket staging buffer size for broadcast_coalesced, analogous
+// to the reducer's kDefaultBucketBytesCap. Matches the bucket size
+// DistributedDataParallel uses for its state broadcasts.
+constexpr size_t kDefaultBroadcastBucketBytesCap = size_t(250 * 1024 * 1024);
+
 // Broadcast many tensors to all processes in the process group.
 void broadcast_coalesced(
     c10::intrusive_ptr<c10d::ProcessGroup> process_group,
     at::TensorList tensors,
-    size_t buffer_size,
+    size_t buffer_size = kDefaultBroadcastBucketBytesCap,
     int rank = 0);
 
+// Fused exchange of embedding rows for row-sharded tables. `indices` holds
+// global row ids (1-D int64) and `rows` the corresponding looked-up rows
+// ([n, dim], aligned with `indices`); rank `id / rows_per_rank` owns row
+// `id`. The op buckets the indices by destination rank, permutes rows into
+// rank-contiguous order on-device, exchanges both with alltoall_base
+// (overlapping the index exchange with the row permutation), and returns
+// {received indices, received rows, send permutation}. The permutation maps
+// position i of the permuted send order to the original position perm[i],
+// letting callers scatter replies back.
+std::tuple<at::Tensor, at::Tensor, at::Tensor> sparse_all_to_all(
+    c10::intrusive_ptr<c10d::ProcessGroup> process_group,
+    const at::Tensor& indices,
+    const at::Tensor& rows,
+    int64_t rows_per_rank);
+
 // This class passes bucket contents tensor to DDP communication hook.
 class GradBucket {
  public:
@@ -4,8 +4,30 @@
 #include <c10d/ProcessGroup.hpp>
 #include <torch/torch.h>
 
+#include <ATen/CPUGeneratorImpl.h>
+
+#include <cmath>
+
 namespace c10d {
 
+namespace {
+
+// Seed for the deterministic initialization of the PowerSGD Q factor. Every
+// rank must start from the same Q, otherwise the first power iteration would
+// project onto different subspaces and the allreduced factors would be
+// meaningless.
+constexpr uint64_t kPowerSGDSeed = 271828;
+
+// Replaces the columns of `matrix` with an orthonormal basis of its column
+// span via a reduced QR decomposition.
+void orthogonalize(at::Tensor& matrix) {
+  at::Tensor q, r;
+  std::tie(q, r) = at::qr(matrix, /*some=*/true);
+  matrix.copy_(q);
+}
+
+} // namespace
+
 c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getTensorRef()};
@@ -38,4 +60,130 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
       decompress_and_div_by_process_group_size, fut->elementType());
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> PowerSGDCommHook::runHook(
+    GradBucket& bucket) {
+  auto& tensor = bucket.getTensorRef();
+  const auto numel = tensor.numel();
+  const size_t bucket_index = bucket.getIndex();
+
+  // View the flat bucket as a (padded) square matrix M, so that both factors
+  // have roughly sqrt(numel) * rank elements.
+  const int64_t side =
+      static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(numel))));
+  const int64_t rank = std::min(matrix_approximation_rank_, side);
+
+  auto options = tensor.options().dtype(at::kFloat);
+  auto matrix = at::zeros({side, side}, options);
+  matrix.view(-1).narrow(0, 0, numel).copy_(tensor.view(-1));
+
+  // Apply the error feedback from the previous iteration before compressing.
+  auto error_it = errors_.find(bucket_index);
+  if (error_it != errors_.end() && error_it->second.numel() == side * side) {
+    matrix.add_(error_it->second);
+  } else {
+    errors_[bucket_index] = at::zeros({side, side}, options);
+  }
+
+  // Warm-start Q from the previous iteration; initialize it identically on
+  // all ranks from a fixed-seed CPU generator otherwise.
+  auto q_it = qs_.find(bucket_index);
+  if (q_it == qs_.end() || q_it->second.size(0) != side ||
+      q_it->second.size(1) != rank) {
+    auto cpu_gen = at::detail::createCPUGenerator(kPowerSGDSeed + bucket_index);
+    auto q_init = at::randn(
+        {side, rank}, cpu_gen, options.device(at::kCPU));
+    qs_[bucket_index] = q_init.to(tensor.device());
+  }
+  auto q = qs_[bucket_index];
+  orthogonalize(q);
+
+  // First power iteration step: P = M * Q, averaged across ranks.
+  auto p = at::matmul(matrix, q);
+  std::vector<at::Tensor> p_tensors = {p};
+  auto p_work = state_->allreduce(p_tensors);
+
+  auto compute_q_and_decompress =
+      [p_work, p, matrix, numel, bucket_index, this]() mutable {
+        p.div_(state_->getSize());
+        orthogonalize(p);
+
+        // Second step: Q = M^T * P, averaged across ranks. NCCL collectives
+        // are enqueued on the communication stream, so wait() only orders
+        // streams here and does not block the callback thread.
+        auto new_q = at::matmul(matrix.t(), p);
+        std::vector<at::Tensor> q_tensors = {new_q};
+        auto q_work = state_->allreduce(q_tensors);
+        q_work->wait();
+        new_q.div_(state_->getSize());
+        qs_[bucket_index] = new_q;
+
+        // Decompress M_hat = P * Q^T and stash the approximation error for
+        // the next iteration.
+        auto decompressed = at::matmul(p, new_q.t());
+        errors_[bucket_index] = matrix - decompressed;
+        return c10::IValue(
+            decompressed.view(-1).narrow(0, 0, numel).contiguous());
+      };
+
+  auto fut = p_work->getFuture();
+  return fut->then(compute_q_and_decompress, fut->elementType());
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> Quantize8BitCommHook::runHook(
+    GradBucket& bucket) {
+  auto& tensor = bucket.getTensorRef();
+  const size_t bucket_index = bucket.getIndex();
+  const auto world_size = state_->getSize();
+
+  auto compress_input = tensor.to(at::kFloat);
+  auto error_it = errors_.find(bucket_index);
+  if (error_it != errors_.end() &&
+      error_it->second.numel() == compress_input.numel()) {
+    compress_input.add_(error_it->second);
+  }
+
+  // One symmetric scale per bucket, chosen so the largest magnitude maps to
+  // 127. The scale has to travel with the payload, hence the extra (tiny)
+  // allgather of one float per rank.
+  auto scale = compress_input.abs().max().clamp_min(1e-10).div(127.0);
+  auto quantized =
+      compress_input.div(scale).round_().clamp_(-127, 127).to(at::kChar);
+
+  // Stash the quantization error for the next iteration.
+  errors_[bucket_index] =
+      compress_input - quantized.to(at::kFloat).mul_(scale);
+
+  std::vector<at::Tensor> scale_inputs = {scale.view({1})};
+  std::vector<at::Tensor> value_inputs = {quantized};
+  std::vector<std::vector<at::Tensor>> scale_outputs(1);
+  std::vector<std::vector<at::Tensor>> value_outputs(1);
+  for (int i = 0; i < world_size; i++) {
+    scale_outputs[0].push_back(at::empty_like(scale_inputs[0]));
+    value_outputs[0].push_back(at::empty_like(quantized));
+  }
+
+  // Both collectives run on the same process group and therefore complete in
+  // order; only the second one's future needs to be chained.
+  state_->allgather(scale_outputs, scale_inputs);
+  auto value_work = state_->allgather(value_outputs, value_inputs);
+
+  // Capture the bucket tensor handle by value: the GradBucket itself does
+  // not outlive the hook invocation, its flat tensor does.
+  auto flat = tensor;
+  auto dequantize_and_average =
+      [value_work, scale_outputs, value_outputs, flat, world_size]() {
+        auto accumulated =
+            at::zeros_like(flat, flat.options().dtype(at::kFloat));
+        for (int i = 0; i < world_size; i++) {
+          accumulated.add_(
+              value_outputs[0][i].to(at::kFloat).mul_(scale_outputs[0][i]));
+        }
+        flat.copy_(accumulated.div_(world_size));
+        return c10::IValue(flat);
+      };
+
+  auto fut = value_work->getFuture();
+  return fut->then(dequantize_and_average, fut->elementType());
+}
+
 } // namespace c10d
@@ -913,9 +913,16 @@ void Reducer::initialize_bucket_views(
     // previous iteration, old grad needs to be copied into new bucket_view and
     // let grad point to the new bucket_view, initialize_bucket_views could also
     // be called inside initialize_buckets during construction. Grads are not
-    // defined during construction time, in this case, do not let grad point to
-    // bucket_view, because grads should be kept as being undefined for globally
-    // unused parameters.
+    // defined during construction time. If unused parameter detection is on,
+    // do not let grad point to bucket_view in that case, because grads should
+    // be kept as being undefined for globally unused parameters. Without
+    // unused parameter detection every parameter is guaranteed a gradient
+    // each iteration, so the grad can be handed out as a zeroed bucket view
+    // right away: AccumulateGrad then accumulates straight into the
+    // communication buffer from the first backward pass, which avoids both
+    // the one-time copy into the bucket and the transient doubling of
+    // gradient memory while the separately allocated grads and the buckets
+    // coexist.
     if (gradient_as_bucket_view_) {
       auto& bucket_view = replica.bucket_views_in.back();
       runGradCallbackForVariable(v, [&](auto& grad) {
@@ -925,6 +932,12 @@ void Reducer::initialize_bucket_views(
           // The grad is modefied and needs to be written back.
           return true;
         }
+        if (!grad.defined() && !find_unused_parameters_) {
+          bucket_view.zero_();
+          grad = bucket_view;
+          // The grad is modified and needs to be written back.
+          return true;
+        }
         // The grad is not modified and does not need to be written back.
         return false;
       });
@@ -957,6 +970,14 @@ void Reducer::populate_bucket_views_out(
   }
 }
 
+void Reducer::set_static_graph() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(
+      num_iterations_ == 0,
+      "set_static_graph() should be called before training loop starts.");
+  static_graph_ = true;
+}
+
 void Reducer::prepare_for_forward() {
   std::lock_guard<std::mutex> lock(mutex_);
   num_iterations_++;
@@ -1060,7 +1081,20 @@ void Reducer::prepare_for_backward(
   // Reset per iteration marked ready parameters.
   perIterationReadyParams_.clear();
 
+  // With a static graph the same parameters go unused in every iteration,
+  // so after the first backward pass we replay the set recorded back then
+  // instead of traversing the autograd graph from the forward outputs again.
+  if (static_graph_ && static_graph_unused_recorded_) {
+    unused_parameters_ = static_unused_parameters_;
+    return;
+  }
+
   search_unused_parameters(outputs);
+
+  if (static_graph_) {
+    static_unused_parameters_ = unused_parameters_;
+    static_graph_unused_recorded_ = true;
+  }
 }
 
 void Reducer::copy_bucket_to_grad(
@@ -1292,6 +1326,10 @@ void Reducer::finalize_backward() {
   if (should_collect_runtime_stats()) {
     record_backward_comm_end_time();
   }
+
+  // Fold this iteration's gradient ready timestamps into the moving averages
+  // driving the periodic timing-based bucket rebuild.
+  accumulate_grad_ready_times();
 }
 
 void Reducer::runGradCallbackForVariable(
@@ -1401,7 +1439,9 @@ bool Reducer::rebuild_buckets() {
   std::lock_guard<std::mutex> lock(mutex_);
   ensure_prior_reduction_finished();
   if (!should_rebuild_buckets() || rebuilt_params_.empty()) {
-    return false;
+    // Once the arrival-order rebuild is done, keep re-tuning the boundaries
+    // periodically from gradient ready timing.
+    return rebuild_buckets_from_timing();
   }
 
   TORCH_INTERNAL_ASSERT(
@@ -1442,6 +1482,93 @@ bool Reducer::rebuild_buckets() {
   return true;
 }
 
+void Reducer::accumulate_grad_ready_times() {
+  // Only replica 0 drives bucket assignment, matching push_rebuilt_params.
+  // Timing samples are only meaningful once the arrival-order rebuild has
+  // settled the bucket layout.
+  if (find_unused_parameters_ || !has_rebuilt_bucket_) {
+    return;
+  }
+  const auto variable_count = replicas_[0].size();
+  if (avg_grad_ready_times_.size() != variable_count) {
+    avg_grad_ready_times_.assign(variable_count, 0.0);
+    num_grad_ready_time_samples_ = 0;
+  }
+  // Smoothing factor for the moving average; large enough to adapt to phase
+  // changes in the model within one rebuild interval, small enough to ride
+  // out per-iteration jitter.
+  constexpr double kAlpha = 0.2;
+  for (size_t i = 0; i < variable_count; i++) {
+    auto sample = static_cast<double>(backward_stats_[0][i]);
+    if (num_grad_ready_time_samples_ == 0) {
+      avg_grad_ready_times_[i] = sample;
+    } else {
+      avg_grad_ready_times_[i] += kAlpha * (sample - avg_grad_ready_times_[i]);
+    }
+  }
+  num_grad_ready_time_samples_++;
+}
+
+bool Reducer::rebuild_buckets_from_timing() {
+  if (find_unused_parameters_ || !has_rebuilt_bucket_ ||
+      num_grad_ready_time_samples_ < kAdaptiveBucketRebuildInterval ||
+      buckets_.size() < 2) {
+    return false;
+  }
+  // Sparse gradients must keep their dedicated buckets; the timing partition
+  // below only handles dense gradients, so leave the layout alone when any
+  // parameter expects a sparse gradient.
+  for (const auto expect : expect_sparse_gradients_[0]) {
+    if (expect) {
+      num_grad_ready_time_samples_ = 0;
+      return false;
+    }
+  }
+
+  const auto variable_count = replicas_[0].size();
+  std::vector<size_t> order(variable_count);
+  for (size_t i = 0; i < variable_count; i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return avg_grad_ready_times_[a] < avg_grad_ready_times_[b];
+  });
+
+  const double first = avg_grad_ready_times_[order.front()];
+  const double span = avg_grad_ready_times_[order.back()] - first;
+  if (span <= 0.0) {
+    num_grad_ready_time_samples_ = 0;
+    return false;
+  }
+
+  // Cut the ready-time axis into as many equal slices as there are buckets
+  // now, and group gradients by the slice they typically become ready in.
+  // Buckets then complete at roughly even intervals, spreading allreduce
+  // launches over the whole backward pass instead of bunching them wherever
+  // the byte cap happened to fall.
+  const size_t num_buckets = buckets_.size();
+  std::vector<std::vector<size_t>> rebuilt_bucket_indices;
+  size_t prev_slice = 0;
+  for (const auto variable_index : order) {
+    auto slice = static_cast<size_t>(
+        (avg_grad_ready_times_[variable_index] - first) / span * num_buckets);
+    slice = std::min(slice, num_buckets - 1);
+    if (rebuilt_bucket_indices.empty() || slice != prev_slice) {
+      rebuilt_bucket_indices.emplace_back();
+      prev_slice = slice;
+    }
+    rebuilt_bucket_indices.back().push_back(variable_index);
+  }
+
+  // All ranks must agree on the new assignment even if their timings differ;
+  // broadcast rank 0's result, as the arrival-order rebuild does.
+  sync_bucket_indices(rebuilt_bucket_indices);
+
+  num_grad_ready_time_samples_ = 0;
+  initialize_buckets(std::move(rebuilt_bucket_indices));
+  return true;
+}
+
 // See Note [DDP Communication Hook]
 void Reducer::register_comm_hook(std::unique_ptr<CommHookInterface> iface) {
   TORCH_CHECK(
@@ -1474,6 +1601,16 @@ void Reducer::register_builtin_comm_hook(
           std::make_unique<c10d::FP16CompressCommHook>(process_group_.get());
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::POWER_SGD:
+      comm_hook_ =
+          std::make_unique<c10d::PowerSGDCommHook>(process_group_.get());
+      LOG(INFO) << "Built-in communication hook POWER_SGD is registered.";
+      break;
+    case c10d::BuiltinCommHookType::QUANTIZE_8BIT:
+      comm_hook_ =
+          std::make_unique<c10d::Quantize8BitCommHook>(process_group_.get());
+      LOG(INFO) << "Built-in communication hook QUANTIZE_8BIT is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
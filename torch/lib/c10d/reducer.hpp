@@ -25,6 +25,10 @@ constexpr int kDefaultFirstBucketBytes = int(1024 * 1024);
 constexpr int kDefaultBucketBytesCap = int(25 * 1024 * 1024);
 // Collect runtime stats once for every kDDPRuntimeLoggingSampleRate iterations.
 constexpr int kDDPRuntimeLoggingSampleRate = 100;
+// After the initial arrival-order bucket rebuild, re-partition bucket
+// boundaries from gradient ready timing once for every
+// kAdaptiveBucketRebuildInterval backward passes.
+constexpr int kAdaptiveBucketRebuildInterval = 100;
 
 class Reducer {
  public:
@@ -91,8 +95,10 @@ class Reducer {
   // find_unused_parameters = true case, as we could rebuild buckets more than
   // once for find_unused_parameters = true case, where subgraphs are trained
   // and parameter indices order may change more frequently.
-  // For find_unused_parameters = false case, buckets are only rebuilt once,
-  // the performance cost is negligible. Returns true if the buckets were
+  // For find_unused_parameters = false case, the arrival-order rebuild
+  // happens once; after that the boundaries keep being re-tuned periodically
+  // from gradient ready timing (see rebuild_buckets_from_timing), so the
+  // performance cost stays negligible. Returns true if the buckets were
   // rebuilt.
   bool rebuild_buckets();
 
@@ -126,6 +132,14 @@ class Reducer {
   // recorded once every "sample_rate" training iterations.
   void set_ddp_runtime_logging_sample_rate(int sample_rate);
 
+  // Declares the autograd graph static: the same set of parameters receives
+  // gradients in every backward pass. Must be called before the first
+  // forward pass. After the first iteration `prepare_for_backward` replays
+  // the unused-parameter set recorded in iteration one instead of
+  // re-traversing the autograd graph from the forward outputs, removing the
+  // fixed per-iteration search overhead.
+  void set_static_graph();
+
  protected:
   // Forward declaration.
   struct Bucket;
@@ -164,6 +178,13 @@ class Reducer {
   const bool find_unused_parameters_;
   const bool gradient_as_bucket_view_;
   std::vector<VariableIndex> unused_parameters_;
+  // Set by set_static_graph(). When true, the unused-parameter set recorded
+  // during the first backward pass is replayed by every later
+  // `prepare_for_backward` call instead of being recomputed from the
+  // autograd graph.
+  bool static_graph_ = false;
+  bool static_graph_unused_recorded_ = false;
+  std::vector<VariableIndex> static_unused_parameters_;
   // Locally used parameter maps indicating if parameters are used locally
   // during the current iteration or no_sync session if no_sync is on. One
   // tensor for each model replica and each tensor is one-dim int32 tensor of
@@ -395,6 +416,17 @@ class Reducer {
   std::vector<int64_t> rebuilt_param_indices_;
   const int64_t bucket_bytes_cap_;
 
+  // Timing-driven adaptive bucket sizing. We keep an exponential moving
+  // average of every gradient's ready timestamp (replica 0, relative to
+  // backward start, taken from backward_stats_), and periodically
+  // re-partition the bucket boundaries so that bucket completions - and
+  // therefore allreduce launches - are evenly spaced over the backward pass
+  // rather than evenly sized in bytes.
+  void accumulate_grad_ready_times();
+  bool rebuild_buckets_from_timing();
+  std::vector<double> avg_grad_ready_times_;
+  long num_grad_ready_time_samples_ = 0;
+
   struct RpcContext {
     using ContextPtr = torch::distributed::autograd::ContextPtr;
     // The shared_ptr is to hold the context instance.
@@ -0,0 +1,65 @@
+#include <c10d/FlightRecorder.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+c10d::FlightRecorderEntry makeEntry(
+    uint64_t seq,
+    int64_t start,
+    int64_t end) {
+  c10d::FlightRecorderEntry entry{};
+  entry.seq = seq;
+  entry.opType = c10d::OpType::ALLREDUCE;
+  entry.bytes = 1024;
+  entry.enqueueTimeNs = start;
+  entry.startTimeNs = start;
+  entry.endTimeNs = end;
+  return entry;
+}
+
+} // namespace
+
+TEST(FlightRecorderTest, RingBufferKeepsNewestOldestFirst) {
+  c10d::FlightRecorder recorder(4);
+  for (uint64_t i = 0; i < 6; ++i) {
+    recorder.record(makeEntry(i, 0, 1));
+  }
+  auto entries = recorder.dump();
+  ASSERT_EQ(entries.size(), size_t(4));
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(entries[i].seq, uint64_t(i + 2));
+  }
+}
+
+TEST(FlightRecorderTest, SkewIdentifiesStraggler) {
+  // Two ranks, two collectives. Rank 1 starts the second collective 50ns
+  // late but runs it just as fast, so all slack shows up as start skew.
+  std::vector<std::vector<c10d::FlightRecorderEntry>> dumps = {
+      {makeEntry(0, 0, 10), makeEntry(1, 100, 120)},
+      {makeEntry(0, 0, 10), makeEntry(1, 150, 170)},
+  };
+  auto skews = c10d::computeCollectiveSkew(dumps);
+  ASSERT_EQ(skews.size(), size_t(2));
+  EXPECT_EQ(skews[0].seq, uint64_t(0));
+  EXPECT_EQ(skews[0].startSkewNs, 0);
+  EXPECT_EQ(skews[0].endSkewNs, 0);
+  EXPECT_EQ(skews[0].slackNs, 0);
+  EXPECT_EQ(skews[1].seq, uint64_t(1));
+  EXPECT_EQ(skews[1].startSkewNs, 50);
+  EXPECT_EQ(skews[1].endSkewNs, 50);
+  EXPECT_EQ(skews[1].slackNs, 0);
+  EXPECT_EQ(skews[1].lastStartRank, size_t(1));
+}
+
+TEST(FlightRecorderTest, SkewSkipsPartiallyRetainedCollectives) {
+  // Rank 1's buffer no longer holds seq 0, so no skew is reported for it.
+  std::vector<std::vector<c10d::FlightRecorderEntry>> dumps = {
+      {makeEntry(0, 0, 10), makeEntry(1, 20, 30)},
+      {makeEntry(1, 20, 40)},
+  };
+  auto skews = c10d::computeCollectiveSkew(dumps);
+  ASSERT_EQ(skews.size(), size_t(1));
+  EXPECT_EQ(skews[0].seq, uint64_t(1));
+  EXPECT_EQ(skews[0].slackNs, 10);
+}
@@ -2,6 +2,7 @@
 
 #include <unistd.h>
 
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -82,6 +83,23 @@ void stressTestStore(std::string prefix = "") {
   c10d::test::check(store, "counter", expected);
 }
 
+void testTreeBarrier(int worldSize) {
+  auto store = c10::make_intrusive<c10d::HashStore>();
+  std::atomic<int> arrived(0);
+  std::vector<std::thread> threads;
+  for (auto rank = 0; rank < worldSize; rank++) {
+    threads.push_back(std::thread([&, rank] {
+      arrived++;
+      c10d::treeBarrier(*store, "barrier/0", rank, worldSize);
+      // No rank may pass the barrier before every rank has arrived.
+      EXPECT_EQ(arrived.load(), worldSize);
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 TEST(HashStoreTest, testGetAndSet) {
   testGetSet();
 }
@@ -97,3 +115,11 @@ TEST(HashStoreTest, testStressStore) {
 TEST(HashStoreTest, testStressStoreWithPrefix) {
   stressTestStore("testPrefix");
 }
+
+TEST(HashStoreTest, testTreeBarrier) {
+  // Cover a single participant, a full tree, and a tree with a partial
+  // last level.
+  testTreeBarrier(1);
+  testTreeBarrier(7);
+  testTreeBarrier(10);
+}
@@ -352,6 +352,9 @@ class DistributedDataParallel(Module):
                       saved memory size will be equal to the total gradients
                       size. Moreover, it avoids the overhead of copying between
                       gradients and ``allreduce`` communication buckets. When
+                      ``find_unused_parameters=False``, the ``grad`` attributes
+                      are set to (zero-filled) bucket views at construction
+                      time, so even the first iteration avoids the copy. When
                       gradients are views, ``detach_()`` cannot be called on the
                       gradients. If hitting such errors, please fix it by
                       referring to the :meth:`~torch.optim.Optimizer.zero_grad`
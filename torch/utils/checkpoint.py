@@ -1,4 +1,5 @@
 import torch
+import threading
 import warnings
 from typing import Any, Iterable, List, Tuple
 
@@ -86,17 +87,18 @@ class CheckpointFunction(torch.autograd.Function):
 
         ctx.save_for_backward(*tensor_inputs)
 
+        # Synchronizes the engine-driven eager recompute (anticipate) with
+        # backward, which may run concurrently on different threads.
+        ctx._recompute_lock = threading.Lock()
+        ctx._recomputed = None
+        ctx._backward_ran = False
+
         with torch.no_grad():
             outputs = run_function(*args)
         return outputs
 
     @staticmethod
-    def backward(ctx, *args):
-        if not torch.autograd._is_checkpoint_valid():
-            raise RuntimeError(
-                "Checkpointing is not compatible with .grad() or when an `inputs` parameter"
-                " is passed to .backward(). Please use .backward() and do not pass its `inputs`"
-                " argument.")
+    def _recompute(ctx):
         # Copy the list to avoid modifying original list.
         inputs = list(ctx.inputs)
         tensor_indices = ctx.tensor_indices
@@ -120,6 +122,37 @@ class CheckpointFunction(torch.autograd.Function):
             detached_inputs = detach_variable(tuple(inputs))
             with torch.enable_grad(), torch.cuda.amp.autocast(ctx.had_autocast_in_fwd):
                 outputs = ctx.run_function(*detached_inputs)
+        return detached_inputs, outputs
+
+    @staticmethod
+    def anticipate(ctx):
+        # Called by the autograd engine from a worker thread as soon as the
+        # backward pass is known to need this segment, so the recomputation
+        # overlaps with other branches' gradient kernels instead of
+        # serializing in backward(). See Note [Anticipated execution] in
+        # torch/csrc/autograd/engine.cpp.
+        if ctx.preserve_rng_state:
+            # Replaying the stashed RNG states from a worker thread would
+            # race with concurrent RNG users; leave the recompute to
+            # backward(), which runs with well-defined RNG ownership.
+            return
+        with ctx._recompute_lock:
+            if ctx._recomputed is None and not ctx._backward_ran:
+                ctx._recomputed = CheckpointFunction._recompute(ctx)
+
+    @staticmethod
+    def backward(ctx, *args):
+        if not torch.autograd._is_checkpoint_valid():
+            raise RuntimeError(
+                "Checkpointing is not compatible with .grad() or when an `inputs` parameter"
+                " is passed to .backward(). Please use .backward() and do not pass its `inputs`"
+                " argument.")
+        with ctx._recompute_lock:
+            ctx._backward_ran = True
+            recomputed = ctx._recomputed
+            if recomputed is None:
+                recomputed = CheckpointFunction._recompute(ctx)
+        detached_inputs, outputs = recomputed
 
         if isinstance(outputs, torch.Tensor):
             outputs = (outputs,)
@@ -8104,6 +8104,11 @@ C10_MAPPINGS = collections.OrderedDict(
         ("c10/cuda/CUDAStream.h", ("c10/hip/HIPStream.h", API_C10)),
         ("c10/cuda/CUDAGraphsC10Utils.h", ("c10/hip/HIPGraphsC10Utils.h", API_C10)),
         ("c10/cuda/CUDACachingAllocator.h", ("c10/hip/HIPCachingAllocator.h", API_C10)),
+        ("c10/cuda/CUDAEventPool.h", ("c10/hip/HIPEventPool.h", API_C10)),
+        (
+            "c10/cuda/CUDAMallocAsyncAllocator.h",
+            ("c10/hip/HIPMallocAsyncAllocator.h", API_C10),
+        ),
         ("c10/cuda/impl/CUDATest.h", ("c10/hip/impl/HIPTest.h", API_C10)),
         ("c10/cuda/impl/CUDAGuardImpl.h", ("c10/hip/impl/HIPGuardImpl.h", API_C10)),
         (